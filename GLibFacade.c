@@ -15,39 +15,69 @@
 #include <string.h>
 #include <stdarg.h>
 
-/*
- * The following section came from:
- *
- *	http://lists-archives.org/mingw-users/12649-asprintf-missing-vsnprintf-
- *		behaving-differently-and-_vsncprintf-undefined.html
- *
- * and
- *
- *	http://groups.google.com/group/jansson-users/browse_thread/thread/
- *		76a88d63d9519978/041a7d0570de2d48?lnk=raot
- */
+/* vsnprintf() is C99, so declare it for strict -ansi builds */
+extern int vsnprintf(char *str, size_t size, const char *format, va_list ap);
+
+
+/* Memory allocation */
+
+static void* defaultAlloc(size_t size, void* user)
+{
+	return malloc(size);
+}
+
+static void* defaultRealloc(void* mem, size_t size, void* user)
+{
+	return realloc(mem, size);
+}
+
+static void defaultFree(void* mem, void* user)
+{
+	free(mem);
+}
+
+static const GMemAllocator defaultAllocator = { defaultAlloc, defaultRealloc, defaultFree, NULL };
+static MD_THREAD_LOCAL GMemAllocator currentAllocator = { defaultAlloc, defaultRealloc, defaultFree, NULL };
+
+/* Sets the calling thread's allocator; NULL restores the C library's */
+void g_mem_set_allocator(const GMemAllocator* allocator)
+{
+	currentAllocator = (allocator != NULL) ? *allocator : defaultAllocator;
+}
+
+void g_mem_get_allocator(GMemAllocator* allocator)
+{
+	*allocator = currentAllocator;
+}
 
-/* Solaris and Windows do not provide vasprintf() or asprintf(). */
-#if defined(__WIN32) || (defined(__SVR4) && defined(__sun))
-int vasprintf( char **sptr, char *fmt, va_list argv ) 
-{ 
-    int wanted = vsnprintf( *sptr = NULL, 0, fmt, argv ); 
-    if( (wanted > 0) && ((*sptr = malloc( 1 + wanted )) != NULL) ) 
-        return vsprintf( *sptr, fmt, argv ); 
- 
-    return wanted; 
-} 
- 
-int asprintf( char **sptr, char *fmt, ... ) 
-{ 
-    int retval; 
-    va_list argv; 
-    va_start( argv, fmt ); 
-    retval = vasprintf( sptr, fmt, argv ); 
-    va_end( argv ); 
-    return retval; 
-} 
-#endif
+void* g_malloc(size_t size)
+{
+	return currentAllocator.alloc(size, currentAllocator.user);
+}
+
+void* g_realloc(void* mem, size_t size)
+{
+	if (mem == NULL)
+		return currentAllocator.alloc(size, currentAllocator.user);
+
+	return currentAllocator.realloc(mem, size, currentAllocator.user);
+}
+
+void g_free(void* mem)
+{
+	if (mem != NULL)
+		currentAllocator.free(mem, currentAllocator.user);
+}
+
+char* g_strdup(const char* str)
+{
+	if (str == NULL) return NULL;
+
+	size_t size = strlen(str) + 1;
+	char* copy = g_malloc(size);
+	memcpy(copy, str, size);
+	return copy;
+}
 
 
 /* GString */
@@ -57,7 +87,7 @@ int asprintf( char **sptr, char *fmt, ... )
 
 GString* g_string_new(char *startingString)
 {
-	GString* newString = malloc(sizeof(GString));
+	GString* newString = g_malloc(sizeof(GString));
 
 	if (startingString == NULL) startingString = "";
 
@@ -68,7 +98,7 @@ GString* g_string_new(char *startingString)
 		startingBufferSize *= kStringBufferGrowthMultiplier;
 	}
 	
-	newString->str = malloc(startingBufferSize);
+	newString->str = g_malloc(startingBufferSize);
 	newString->currentStringBufferSize = startingBufferSize;
 	strncpy(newString->str, startingString, startingStringSize);
 	newString->str[startingStringSize] = '\0';
@@ -84,12 +114,12 @@ char* g_string_free(GString* ripString, bool freeCharacterData)
 	{
 		if (ripString->str != NULL)
 		{
-			free(ripString->str);
+			g_free(ripString->str);
 		}
 		returnedString = NULL;
 	}
 	
-	free(ripString);
+	g_free(ripString);
 	
 	return returnedString;
 }
@@ -106,7 +136,7 @@ static void ensureStringBufferCanHold(GString* baseString, size_t newStringSize)
 			newBufferSize *= kStringBufferGrowthMultiplier;
 		}
 		
-		baseString->str = realloc(baseString->str, newBufferSize);
+		baseString->str = g_realloc(baseString->str, newBufferSize);
 		baseString->currentStringBufferSize = newBufferSize;
 	}
 }
@@ -125,6 +155,19 @@ void g_string_append(GString* baseString, char* appendedString)
 	}
 }
 
+void g_string_append_len(GString* baseString, const char* appendedString, size_t length)
+{
+	if (length > 0)
+	{
+		size_t newStringLength = baseString->currentStringLength + length;
+		ensureStringBufferCanHold(baseString, newStringLength);
+
+		memcpy(baseString->str + baseString->currentStringLength, appendedString, length);
+		baseString->currentStringLength = newStringLength;
+		baseString->str[newStringLength] = '\0';
+	}
+}
+
 void g_string_append_c(GString* baseString, char appendedCharacter)
 {	
 	size_t newSizeNeeded = baseString->currentStringLength + 1;
@@ -138,16 +181,24 @@ void g_string_append_c(GString* baseString, char appendedCharacter)
 void g_string_append_printf(GString* baseString, char* format, ...)
 {
 	va_list args;
+
+	/* Measure first, then format straight into the buffer so the only
+	   allocation is buffer growth through the current allocator */
 	va_start(args, format);
-	
-	char* formattedString = NULL;
-	vasprintf(&formattedString, format, args);
-	if (formattedString != NULL)
+	int formattedLength = vsnprintf(NULL, 0, format, args);
+	va_end(args);
+
+	if (formattedLength > 0)
 	{
-		g_string_append(baseString, formattedString);
-		free(formattedString);
+		ensureStringBufferCanHold(baseString, baseString->currentStringLength + formattedLength);
+
+		va_start(args, format);
+		vsnprintf(baseString->str + baseString->currentStringLength, formattedLength + 1, format, args);
+		va_end(args);
+
+		baseString->currentStringLength += formattedLength;
 	}
-} 
+}
 
 void g_string_prepend(GString* baseString, char* prependedString)
 {
@@ -173,8 +224,9 @@ void g_slist_free(GSList* ripList)
 	{
 		GSList* nextItem = thisListItem->next;
 		
-		/* I guess we don't release the data? Non-retained memory management is hard... let's figure it out later. */
-		free(thisListItem);
+		/* As in GLib, the data is not ours to release: the endnotes list only
+		   borrows elements that are freed with the document tree */
+		g_free(thisListItem);
 		
 		thisListItem = nextItem;
 	}
@@ -200,7 +252,7 @@ GSList* g_slist_reverse(GSList* theList)
 
 GSList* g_slist_prepend(GSList* targetElement, void* newElementData)
 {
-	GSList* newElement = malloc(sizeof(GSList));
+	GSList* newElement = g_malloc(sizeof(GSList));
 	newElement->data = newElementData;
 	newElement->next = targetElement;
 	return newElement;
@@ -20,6 +20,49 @@
 typedef int gboolean;
 typedef char gchar;
 
+/* Parser and printer state, and the current allocator, are kept per
+ * thread, so separate threads can convert documents at the same time.
+ * There is no single-threaded fallback: without thread-local storage the
+ * build fails rather than silently sharing that state. */
+#if defined(MD_THREAD_LOCAL)
+/* supplied by the build */
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define MD_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+#define MD_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define MD_THREAD_LOCAL __declspec(thread)
+#else
+#error "MultiMarkdown needs thread-local storage: build as C11 or define MD_THREAD_LOCAL"
+#endif
+
+/* Memory allocation
+ *
+ * Every allocation made by MultiMarkdown goes through g_malloc(), g_realloc()
+ * and g_free(), which dispatch to the currently installed allocator.  By
+ * default this is the C library's malloc/realloc/free.  An embedding
+ * application can substitute its own (per-request arena, thread-caching
+ * allocator, accounting wrapper, ...) with g_mem_set_allocator().  The user
+ * pointer is handed back on every call.  Each thread has its own current
+ * allocator, which starts as the C library's.
+ */
+
+typedef struct
+{
+	void* (*alloc)(size_t size, void* user);
+	void* (*realloc)(void* mem, size_t size, void* user);
+	void (*free)(void* mem, void* user);
+	void* user;
+} GMemAllocator;
+
+void g_mem_set_allocator(const GMemAllocator* allocator);
+void g_mem_get_allocator(GMemAllocator* allocator);
+
+void* g_malloc(size_t size);
+void* g_realloc(void* mem, size_t size);
+void g_free(void* mem);
+char* g_strdup(const char* str);
+
 /* This style of bool is used in shared source code */
 #define FALSE false
 #define TRUE true
@@ -47,6 +90,7 @@ char* g_string_free(GString* ripString, bool freeCharacterData);
 
 void g_string_append_c(GString* baseString, char appendedCharacter);
 void g_string_append(GString* baseString, char *appendedString);
+void g_string_append_len(GString* baseString, const char *appendedString, size_t length);
 
 void g_string_prepend(GString* baseString, char* prependedString);
 
@@ -0,0 +1,143 @@
+/**********************************************************************
+
+  alloc_check.c - allocation accounting check for the markdown library.
+
+  Installs a counting allocator, converts each input file repeatedly
+  to every output format, and fails if any conversion leaves memory
+  behind.  The parser buffers are trimmed after each conversion so
+  that a clean run returns to exactly zero live blocks.
+
+  Usage: alloc_check [-n ROUNDS] FILE...
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+ ***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "markdown_peg.h"
+#include "harness.h"
+
+/* Each block carries its size in a header so frees can be accounted. */
+typedef union {
+    size_t size;
+    double align_d;
+    void *align_p;
+} block_header;
+
+typedef struct {
+    long blocks;
+    long bytes;
+    long calls;
+} alloc_counts;
+
+static void *counting_alloc(size_t size, void *user) {
+    alloc_counts *counts = user;
+    block_header *h = malloc(sizeof(block_header) + size);
+    if (h == NULL)
+        return NULL;
+    h->size = size;
+    counts->blocks++;
+    counts->bytes += size;
+    counts->calls++;
+    return h + 1;
+}
+
+static void *counting_realloc(void *mem, size_t size, void *user) {
+    alloc_counts *counts = user;
+    block_header *h;
+    if (mem == NULL)
+        return counting_alloc(size, user);
+    h = (block_header *)mem - 1;
+    counts->bytes -= h->size;
+    h = realloc(h, sizeof(block_header) + size);
+    if (h == NULL)
+        return NULL;
+    h->size = size;
+    counts->bytes += size;
+    counts->calls++;
+    return h + 1;
+}
+
+static void counting_free(void *mem, void *user) {
+    alloc_counts *counts = user;
+    block_header *h = (block_header *)mem - 1;
+    counts->blocks--;
+    counts->bytes -= h->size;
+    free(h);
+}
+
+static const int extension_sets[] = {
+    EXT_SMART | EXT_NOTES,
+    EXT_COMPATIBILITY,
+    EXT_SMART | EXT_NOTES | EXT_PROCESS_HTML,
+};
+
+int main(int argc, char *argv[]) {
+    alloc_counts counts = { 0, 0, 0 };
+    markdown_allocator allocator;
+    char *text, *out, *value;
+    int rounds = 3;
+    int failures = 0;
+    int i, f, e, r;
+
+    allocator.alloc = counting_alloc;
+    allocator.realloc = counting_realloc;
+    allocator.free = counting_free;
+    allocator.user = &counts;
+
+    i = 1;
+    if (argc > 2 && strcmp(argv[1], "-n") == 0) {
+        rounds = atoi(argv[2]);
+        i = 3;
+    }
+    if (i >= argc) {
+        fprintf(stderr, "Usage: %s [-n ROUNDS] FILE...\n", argv[0]);
+        return 2;
+    }
+
+    markdown_set_allocator(&allocator);
+
+    for (; i < argc; i++) {
+        if ((text = harness_read_file(argv[i], NULL)) == NULL) {
+            perror(argv[i]);
+            failures++;
+            continue;
+        }
+        for (f = 0; harness_formats[f] != NULL; f++) {
+            for (e = 0; e < sizeof(extension_sets) / sizeof(extension_sets[0]); e++) {
+                for (r = 0; r < rounds; r++) {
+                    out = markdown_to_string(text, extension_sets[e],
+                        markdown_format_from_name(harness_formats[f]));
+                    g_free(out);
+                    markdown_trim_parser_buffers();
+                    if (counts.blocks != 0) {
+                        fprintf(stderr, "%s: %s, extensions 0x%x, round %d: "
+                            "%ld blocks (%ld bytes) not freed\n", argv[i],
+                            harness_formats[f], extension_sets[e], r + 1,
+                            counts.blocks, counts.bytes);
+                        failures++;
+                        counts.blocks = counts.bytes = 0;
+                    }
+                }
+            }
+        }
+        value = extract_metadata_value(text, EXT_SMART | EXT_NOTES, "title");
+        g_free(value);
+        markdown_trim_parser_buffers();
+        if (counts.blocks != 0) {
+            fprintf(stderr, "%s: metadata extraction: %ld blocks (%ld bytes) "
+                "not freed\n", argv[i], counts.blocks, counts.bytes);
+            failures++;
+            counts.blocks = counts.bytes = 0;
+        }
+        free(text);
+    }
+
+    markdown_set_allocator(NULL);
+    printf("%ld allocator calls, %d failures\n", counts.calls, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,861 @@
+/**********************************************************************
+
+  bibliography.c - citations resolved from a bibliography file.
+
+  A BibTeX or CSL-JSON bibliography is read once and indexed by citation
+  key.  A citation such as [#knuth1984] that a document does not define
+  itself is looked up in it, and the entry found becomes the citation's
+  note, in every output format.  Entries are formatted as markdown text
+  when they are indexed, so a lookup is a hash and a comparison.
+
+  The index is a single block holding offsets rather than pointers, so
+  it can be written to a file and later mapped back in as it is, without
+  reading the bibliography again:
+
+      header      "MMDBIB1\n", byte order mark, entry count, slot count,
+                  size of the whole index
+      slots       offset of an entry, or 0, for each slot; a power of two
+                  of them, probed linearly from the key's hash
+      entries     hash, key, NUL, text, NUL; each starts on 4 bytes
+
+  Numbers are 32-bit and in the byte order of the machine that wrote the
+  index; an index written by another kind of machine is rejected.  Once
+  set, the index is read by every conversion, in any thread, and never
+  modified.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+ ***********************************************************************/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <errno.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "glib.h"
+#include "markdown_peg.h"
+
+#define BIBLIOGRAPHY_MAGIC  "MMDBIB1\n"
+#define BIBLIOGRAPHY_ORDER  0x01020304
+
+typedef struct {
+    char magic[8];
+    uint32_t order;
+    uint32_t count;
+    uint32_t slots;
+    uint32_t size;
+} bibliography_header;
+
+struct markdown_bibliography {
+    char *data;
+    size_t size;
+    bool mapped;            /* data is a mapped index file */
+};
+
+/* Bibliography shared, read-only, by every conversion */
+const markdown_bibliography *shared_bibliography = NULL;
+
+/* The parts of an entry that go into its note */
+enum bibliography_fields {
+    FIELD_AUTHOR,
+    FIELD_EDITOR,
+    FIELD_TITLE,
+    FIELD_CONTAINER,        /* journal, or book an article is in */
+    FIELD_PUBLISHER,
+    FIELD_YEAR,
+    FIELD_COUNT
+};
+
+typedef struct {
+    GString *key;
+    GString *field[FIELD_COUNT];
+    GString *ignored;       /* fields not wanted, or given twice */
+    GString *text;          /* of its note */
+} bibliography_entry;
+
+/* Entries formatted so far, laid out as in the index but without slots */
+typedef struct {
+    GString *entries;
+    uint32_t count;
+} bibliography_builder;
+
+/* hash_citation - FNV-1a hash of a citation key */
+static uint32_t hash_citation(const char *key) {
+    uint32_t hash = 2166136261U;
+    for (; *key != '\0'; key++)
+        hash = (hash ^ (unsigned char)*key) * 16777619U;
+    return hash;
+}
+
+static void clear_string(GString *s) {
+    s->currentStringLength = 0;
+    s->str[0] = '\0';
+}
+
+/* squeeze - collapse each run of whitespace in 's' to a space, and trim
+ * it from both ends */
+static void squeeze(GString *s) {
+    char *from, *to;
+    bool space = false;
+
+    for (from = to = s->str; *from != '\0'; from++) {
+        if (isspace((unsigned char)*from)) {
+            space = (to != s->str);
+            continue;
+        }
+        if (space)
+            *to++ = ' ';
+        space = false;
+        *to++ = *from;
+    }
+    *to = '\0';
+    s->currentStringLength = to - s->str;
+}
+
+/* append_escaped - append 's' to 'out' as markdown text that reads back
+ * as 's' itself.  At the start of 'out', a list marker is escaped too. */
+static void append_escaped(GString *out, const char *s) {
+    const char *c = s;
+
+    if (out->currentStringLength == 0) {
+        while (isdigit((unsigned char)*c))
+            c++;
+        if (c > s && (*c == '.' || *c == ')')) {
+            g_string_append_len(out, s, c - s);
+            s = c;
+            g_string_append_c(out, '\\');
+        } else if (*s == '-' || *s == '+') {
+            g_string_append_c(out, '\\');
+        }
+    }
+    for (c = s; *c != '\0'; c++) {
+        if (strchr("\\`*_{}[]<>#|", *c) != NULL)
+            g_string_append_c(out, '\\');
+        g_string_append_c(out, *c);
+    }
+}
+
+/* append_sentence - append 'text', if any, as a sentence of its own,
+ * between 'mark's */
+static void append_sentence(GString *out, GString *text, const char *mark) {
+    char last;
+
+    if (text->currentStringLength == 0)
+        return;
+    if (out->currentStringLength != 0)
+        g_string_append_c(out, ' ');
+    g_string_append(out, (char *)mark);
+    append_escaped(out, text->str);
+    g_string_append(out, (char *)mark);
+    last = text->str[text->currentStringLength - 1];
+    if (last != '.' && last != '?' && last != '!')
+        g_string_append_c(out, '.');
+}
+
+/* format_entry - set the text of an entry's note:
+ *
+ *     Authors. *Title*. Journal. Publisher, Year.
+ *
+ * leaving out the parts the entry does not have, and with its editors if
+ * it has no authors. */
+static void format_entry(bibliography_entry *entry) {
+    GString **field = entry->field;
+    GString *out = entry->text;
+
+    clear_string(out);
+    append_sentence(out, field[FIELD_AUTHOR]->currentStringLength ? field[FIELD_AUTHOR] : field[FIELD_EDITOR], "");
+    append_sentence(out, field[FIELD_TITLE], "*");
+    append_sentence(out, field[FIELD_CONTAINER], "");
+    if (field[FIELD_PUBLISHER]->currentStringLength && field[FIELD_YEAR]->currentStringLength)
+        g_string_append(field[FIELD_PUBLISHER], ", ");
+    g_string_append(field[FIELD_PUBLISHER], field[FIELD_YEAR]->str);
+    append_sentence(out, field[FIELD_PUBLISHER], "");
+    if (out->currentStringLength == 0)
+        append_escaped(out, entry->key->str);
+}
+
+static void entry_init(bibliography_entry *entry) {
+    int i;
+    entry->key = g_string_new("");
+    for (i = 0; i < FIELD_COUNT; i++)
+        entry->field[i] = g_string_new("");
+    entry->ignored = g_string_new("");
+    entry->text = g_string_new("");
+}
+
+static void entry_clear(bibliography_entry *entry) {
+    int i;
+    clear_string(entry->key);
+    for (i = 0; i < FIELD_COUNT; i++)
+        clear_string(entry->field[i]);
+}
+
+static void entry_free(bibliography_entry *entry) {
+    int i;
+    g_string_free(entry->key, true);
+    for (i = 0; i < FIELD_COUNT; i++)
+        g_string_free(entry->field[i], true);
+    g_string_free(entry->ignored, true);
+    g_string_free(entry->text, true);
+}
+
+/* add_entry - format 'entry' and add it to the index being built.  An
+ * entry with no key is dropped. */
+static void add_entry(bibliography_builder *builder, bibliography_entry *entry) {
+    GString *out = builder->entries;
+    uint32_t hash;
+    int i;
+
+    for (i = 0; i < FIELD_COUNT; i++)
+        squeeze(entry->field[i]);
+    squeeze(entry->key);
+    if (entry->key->currentStringLength == 0)
+        return;
+    hash = hash_citation(entry->key->str);
+    g_string_append_len(out, (char *)&hash, sizeof(hash));
+    g_string_append_len(out, entry->key->str, entry->key->currentStringLength + 1);
+    format_entry(entry);
+    g_string_append_len(out, entry->text->str, entry->text->currentStringLength);
+    do
+        g_string_append_c(out, '\0');
+    while (out->currentStringLength % 4 != 0);
+    builder->count++;
+}
+
+/* build_index - lay out the slots and entries of a finished builder.
+ * Where keys repeat, the first entry wins and the rest are left out. */
+static markdown_bibliography * build_index(bibliography_builder *builder) {
+    markdown_bibliography *bib = g_malloc(sizeof(markdown_bibliography));
+    bibliography_header *header;
+    uint32_t *slot;
+    uint32_t slots, table, offset, i, placed = 0;
+    const char *entry, *key, *text;
+
+    for (slots = 16; slots < 2 * builder->count; slots *= 2)
+        ;
+    table = sizeof(bibliography_header) + slots * sizeof(uint32_t);
+    bib->size = table + builder->entries->currentStringLength;
+    bib->data = g_malloc(bib->size);
+    bib->mapped = false;
+    memset(bib->data, 0, table);
+    memcpy(bib->data + table, builder->entries->str, builder->entries->currentStringLength);
+
+    header = (bibliography_header *)bib->data;
+    slot = (uint32_t *)(bib->data + sizeof(bibliography_header));
+    for (offset = table; offset < bib->size; ) {
+        entry = bib->data + offset;
+        key = entry + sizeof(uint32_t);
+        for (i = *(uint32_t *)entry & (slots - 1); slot[i] != 0; i = (i + 1) & (slots - 1))
+            if (strcmp(bib->data + slot[i] + sizeof(uint32_t), key) == 0)
+                break;
+        if (slot[i] == 0) {
+            slot[i] = offset;
+            placed++;
+        }
+        text = key + strlen(key) + 1;
+        offset = (text + strlen(text) + 1 - bib->data + 3) & ~3U;
+    }
+
+    memcpy(header->magic, BIBLIOGRAPHY_MAGIC, sizeof(header->magic));
+    header->order = BIBLIOGRAPHY_ORDER;
+    header->count = placed;
+    header->slots = slots;
+    header->size = bib->size;
+    return bib;
+}
+
+/**********************************************************************
+
+  BibTeX
+
+ ***********************************************************************/
+
+/* Combining marks for the TeX accents \` \' \^ \~ \= \. \" */
+static const char tex_accents[] = "`'^~=.\"";
+static const char *tex_marks[] = {
+    "\xCC\x80", "\xCC\x81", "\xCC\x82", "\xCC\x83", "\xCC\x84", "\xCC\x87", "\xCC\x88"
+};
+
+/* TeX commands for letters, and logos */
+static const struct {
+    const char *command;
+    const char *text;
+} tex_letters[] = {
+    { "ss", "\xC3\x9F" }, { "o", "\xC3\xB8" }, { "O", "\xC3\x98" },
+    { "ae", "\xC3\xA6" }, { "AE", "\xC3\x86" }, { "oe", "\xC5\x93" },
+    { "OE", "\xC5\x92" }, { "aa", "\xC3\xA5" }, { "AA", "\xC3\x85" },
+    { "l", "\xC5\x82" }, { "L", "\xC5\x81" }, { "i", "\xC4\xB1" },
+    { "TeX", "TeX" }, { "LaTeX", "LaTeX" }, { "BibTeX", "BibTeX" }
+};
+
+/* append_tex - append the 'length' characters of TeX at 's' to 'out' as
+ * plain text.  Braces go; \& and the like become the character; accents
+ * become Unicode combining marks; ~ becomes a space; \ss and the like
+ * become the letter.  Other commands are dropped, leaving their
+ * arguments. */
+static void append_tex(GString *out, const char *s, size_t length) {
+    const char *end = s + length;
+    const char *accent, *command;
+    size_t i;
+
+    while (s < end) {
+        if (*s == '{' || *s == '}') {
+            s++;
+        } else if (*s == '~') {
+            g_string_append_c(out, ' ');
+            s++;
+        } else if (*s != '\\' || s + 1 == end) {
+            g_string_append_c(out, *s++);
+        } else if (isalpha((unsigned char)s[1])) {
+            for (command = ++s; s < end && isalpha((unsigned char)*s); s++)
+                ;
+            for (i = 0; i < sizeof(tex_letters) / sizeof(tex_letters[0]); i++)
+                if (strlen(tex_letters[i].command) == (size_t)(s - command) &&
+                    strncmp(tex_letters[i].command, command, s - command) == 0)
+                    g_string_append(out, (char *)tex_letters[i].text);
+            if (s < end && *s == ' ')
+                s++;
+        } else if ((accent = strchr(tex_accents, s[1])) != NULL) {
+            for (s += 2; s < end && (*s == '{' || *s == ' '); s++)
+                ;
+            if (s + 1 < end && *s == '\\' && (s[1] == 'i' || s[1] == 'j'))
+                s++;
+            if (s < end && *s != '}' && *s != '\\')
+                g_string_append_c(out, *s++);
+            g_string_append(out, (char *)tex_marks[accent - tex_accents]);
+        } else if (s[1] == '\\') {
+            g_string_append_c(out, ' ');
+            s += 2;
+        } else {
+            g_string_append_c(out, s[1]);
+            s += 2;
+        }
+    }
+}
+
+static const char *skip_tex_space(const char *c) {
+    while (isspace((unsigned char)*c))
+        c++;
+    return c;
+}
+
+/* skip_group - return the character after the 'close' that ends the group
+ * begun before 'c', or NULL */
+static const char *skip_group(const char *c, char close) {
+    int depth = 0;
+    for (; *c != '\0'; c++) {
+        if (*c == '\\' && c[1] != '\0')
+            c++;
+        else if (*c == '{')
+            depth++;
+        else if (*c == '}' && depth > 0)
+            depth--;
+        else if (*c == close && depth == 0)
+            return c + 1;
+    }
+    return NULL;
+}
+
+/* bibtex_macro - the value of the @string named by the 'length'
+ * characters at 'name', or NULL.  'macros' holds name, NUL, value, NUL
+ * for each. */
+static const char *bibtex_macro(GString *macros, const char *name, size_t length) {
+    const char *macro = macros->str;
+    const char *end = macros->str + macros->currentStringLength;
+    const char *value;
+
+    while (macro < end) {
+        value = macro + strlen(macro) + 1;
+        if (strlen(macro) == length && strncasecmp(macro, name, length) == 0)
+            return value;
+        macro = value + strlen(value) + 1;
+    }
+    return NULL;
+}
+
+/* read_bibtex_value - append to 'out' the field value at 'c': braced or
+ * quoted text, or a bare word, or several joined by #.  A bare word is a
+ * number, or the name of a @string, or else is kept as it is.  Returns
+ * the character after the value, or NULL. */
+static const char *read_bibtex_value(const char *c, GString *out, char close, GString *macros) {
+    const char *start, *value;
+
+    for (;;) {
+        c = skip_tex_space(c);
+        start = c + 1;
+        if (*c == '{') {
+            if ((c = skip_group(start, '}')) == NULL)
+                return NULL;
+            append_tex(out, start, c - 1 - start);
+        } else if (*c == '"') {
+            if ((c = skip_group(start, '"')) == NULL)
+                return NULL;
+            append_tex(out, start, c - 1 - start);
+        } else {
+            for (start = c; *c != '\0' && *c != ',' && *c != close && *c != '#' && !isspace((unsigned char)*c); c++)
+                ;
+            if (c == start)
+                return NULL;
+            if ((value = bibtex_macro(macros, start, c - start)) != NULL)
+                g_string_append(out, (char *)value);
+            else
+                append_tex(out, start, c - start);
+        }
+        c = skip_tex_space(c);
+        if (*c != '#')
+            return c;
+        c++;
+    }
+}
+
+/* bibtex_field - where the value of the field 'name' goes */
+static GString *bibtex_field(bibliography_entry *entry, const char *name, size_t length) {
+    static const struct {
+        const char *name;
+        int field;
+    } fields[] = {
+        { "author", FIELD_AUTHOR },
+        { "editor", FIELD_EDITOR },
+        { "title", FIELD_TITLE },
+        { "journal", FIELD_CONTAINER },
+        { "booktitle", FIELD_CONTAINER },
+        { "publisher", FIELD_PUBLISHER },
+        { "school", FIELD_PUBLISHER },
+        { "institution", FIELD_PUBLISHER },
+        { "organization", FIELD_PUBLISHER },
+        { "year", FIELD_YEAR }
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(fields) / sizeof(fields[0]); i++)
+        if (strlen(fields[i].name) == length && strncasecmp(fields[i].name, name, length) == 0 &&
+            entry->field[fields[i].field]->currentStringLength == 0)
+            return entry->field[fields[i].field];
+    clear_string(entry->ignored);
+    return entry->ignored;
+}
+
+/* read_bibtex_name - the length of the field or @string name at 'c' */
+static size_t read_bibtex_name(const char *c) {
+    const char *start = c;
+    while (isalnum((unsigned char)*c) || *c == '_' || *c == '-' || *c == ':' || *c == '.')
+        c++;
+    return c - start;
+}
+
+/* read_bibtex - index each entry of the BibTeX at 'c'.  Text outside
+ * entries is skipped, as are @preamble and @comment; @string defines a
+ * name for later values to use.  After an entry that cannot be read,
+ * reading goes on at the next @. */
+static void read_bibtex(bibliography_builder *builder, const char *c) {
+    bibliography_entry entry;
+    GString *macros = g_string_new("");
+    const char *start;
+    size_t type, length;
+    GString *field;
+    char close;
+
+    entry_init(&entry);
+    while ((c = strchr(c, '@')) != NULL) {
+        for (start = ++c; isalpha((unsigned char)*c); c++)
+            ;
+        type = c - start;
+        c = skip_tex_space(c);
+        if (*c != '{' && *c != '(')
+            continue;
+        close = (*c++ == '{') ? '}' : ')';
+        if (type == 6 && strncasecmp(start, "string", 6) == 0) {
+            start = skip_tex_space(c);
+            length = read_bibtex_name(start);
+            c = skip_tex_space(start + length);
+            if (length == 0 || *c != '=')
+                continue;
+            g_string_append_len(macros, start, length);
+            g_string_append_c(macros, '\0');
+            clear_string(entry.ignored);
+            if ((c = read_bibtex_value(c + 1, entry.ignored, close, macros)) == NULL)
+                break;
+            squeeze(entry.ignored);
+            g_string_append_len(macros, entry.ignored->str, entry.ignored->currentStringLength + 1);
+            continue;
+        }
+        if ((type == 8 && strncasecmp(start, "preamble", 8) == 0) ||
+            (type == 7 && strncasecmp(start, "comment", 7) == 0)) {
+            if ((c = skip_group(c, close)) == NULL)
+                break;
+            continue;
+        }
+
+        entry_clear(&entry);
+        for (start = c = skip_tex_space(c); *c != '\0' && *c != ',' && *c != close && !isspace((unsigned char)*c); c++)
+            ;
+        g_string_append_len(entry.key, start, c - start);
+        for (;;) {
+            c = skip_tex_space(c);
+            if (*c == ',') {
+                c++;
+                continue;
+            }
+            if (*c == close) {
+                add_entry(builder, &entry);
+                c++;
+                break;
+            }
+            length = read_bibtex_name(c);
+            field = bibtex_field(&entry, c, length);
+            if (length == 0 || *(c = skip_tex_space(c + length)) != '=')
+                break;
+            if ((c = read_bibtex_value(c + 1, field, close, macros)) == NULL)
+                break;
+        }
+        if (c == NULL)
+            break;
+    }
+    entry_free(&entry);
+    g_string_free(macros, true);
+}
+
+/**********************************************************************
+
+  CSL-JSON
+
+ ***********************************************************************/
+
+/* json_member - step to the next member of the object whose '{' or
+ * previous member '*c' is at.  Returns false at the end of the object,
+ * with '*c' after it, or NULL if the object is malformed. */
+static bool json_member(const char **c, json_span *key, json_span *value) {
+    const char *p = json_skip_space(*c);
+
+    if (*p == '{' || *p == ',')
+        p = json_skip_space(p + 1);
+    if (*p == '}') {
+        *c = p + 1;
+        return false;
+    }
+    *c = NULL;
+    if (*p != '"' || (key->end = json_skip_string(key->start = p)) == NULL)
+        return false;
+    p = json_skip_space(key->end);
+    if (*p++ != ':')
+        return false;
+    value->start = p = json_skip_space(p);
+    if ((value->end = json_skip_value(p)) == NULL || value->end == value->start)
+        return false;
+    *c = value->end;
+    return true;
+}
+
+/* json_element - step to the next element of an array, as json_member
+ * does for an object */
+static bool json_element(const char **c, json_span *value) {
+    const char *p = json_skip_space(*c);
+
+    if (*p == '[' || *p == ',')
+        p = json_skip_space(p + 1);
+    if (*p == ']') {
+        *c = p + 1;
+        return false;
+    }
+    *c = NULL;
+    value->start = p;
+    if ((value->end = json_skip_value(p)) == NULL || value->end == value->start)
+        return false;
+    *c = value->end;
+    return true;
+}
+
+static bool key_is(json_span key, const char *name) {
+    size_t length = strlen(name);
+    return (size_t)(key.end - key.start) == length + 2 && strncmp(key.start + 1, name, length) == 0;
+}
+
+/* append_json_text - append a string, or a number as it was written */
+static void append_json_text(GString *out, json_span value) {
+    if (*value.start == '"')
+        json_decode_string(out, value);
+    else if (*value.start == '-' || isdigit((unsigned char)*value.start))
+        g_string_append_len(out, value.start, value.end - value.start);
+}
+
+/* append_csl_names - append the names in a CSL name list as BibTeX would
+ * have them: "Family, Given and Family, Given" */
+static void append_csl_names(GString *out, json_span names) {
+    const char *c = names.start;
+    const char *member;
+    json_span name, key, value, family, given;
+
+    if (*c != '[')
+        return;
+    while (json_element(&c, &name)) {
+        if (*name.start != '{')
+            continue;
+        family.start = given.start = NULL;
+        member = name.start;
+        while (json_member(&member, &key, &value)) {
+            if (key_is(key, "family") || key_is(key, "literal"))
+                family = value;
+            else if (key_is(key, "given"))
+                given = value;
+        }
+        if (family.start == NULL && given.start == NULL)
+            continue;
+        if (out->currentStringLength != 0)
+            g_string_append(out, " and ");
+        if (family.start != NULL)
+            append_json_text(out, family);
+        if (family.start != NULL && given.start != NULL)
+            g_string_append(out, ", ");
+        if (given.start != NULL)
+            append_json_text(out, given);
+    }
+}
+
+/* append_csl_year - append the year of a CSL date: the first of its
+ * "date-parts", or else its "literal" or "raw" form */
+static void append_csl_year(GString *out, json_span date) {
+    const char *c = date.start;
+    json_span key, value, parts, year;
+
+    if (*c != '{')
+        return;
+    while (json_member(&c, &key, &value)) {
+        if (key_is(key, "date-parts") && *value.start == '[') {
+            c = value.start;
+            if (json_element(&c, &parts) && *parts.start == '[') {
+                c = parts.start;
+                if (json_element(&c, &year)) {
+                    clear_string(out);
+                    append_json_text(out, year);
+                    return;
+                }
+            }
+            c = value.end;
+        } else if ((key_is(key, "literal") || key_is(key, "raw")) && out->currentStringLength == 0) {
+            append_json_text(out, value);
+        }
+    }
+}
+
+/* read_csl - index each item of the CSL-JSON array (or single item) at
+ * 'c'.  Returns false if it is not well-formed. */
+static bool read_csl(bibliography_builder *builder, const char *c) {
+    bibliography_entry entry;
+    json_span item, key, value;
+    const char *member;
+    bool single = (*c == '{');
+    bool ok = true;
+
+    entry_init(&entry);
+    while (single ? (item.start = c) != NULL : json_element(&c, &item)) {
+        if (*item.start == '{') {
+            entry_clear(&entry);
+            member = item.start;
+            while (json_member(&member, &key, &value)) {
+                if (key_is(key, "id"))
+                    append_json_text(entry.key, value);
+                else if (key_is(key, "author"))
+                    append_csl_names(entry.field[FIELD_AUTHOR], value);
+                else if (key_is(key, "editor"))
+                    append_csl_names(entry.field[FIELD_EDITOR], value);
+                else if (key_is(key, "title"))
+                    append_json_text(entry.field[FIELD_TITLE], value);
+                else if (key_is(key, "container-title"))
+                    append_json_text(entry.field[FIELD_CONTAINER], value);
+                else if (key_is(key, "publisher"))
+                    append_json_text(entry.field[FIELD_PUBLISHER], value);
+                else if (key_is(key, "issued"))
+                    append_csl_year(entry.field[FIELD_YEAR], value);
+            }
+            if (member == NULL) {
+                ok = false;
+                break;
+            }
+            add_entry(builder, &entry);
+        }
+        if (single) {
+            c = json_skip_value(c);
+            break;
+        }
+    }
+    entry_free(&entry);
+    return ok && c != NULL && *json_skip_space(c) == '\0';
+}
+
+/**********************************************************************
+
+  Creating, loading and saving
+
+ ***********************************************************************/
+
+/* markdown_bibliography_create - index the BibTeX or CSL-JSON in 'text'.
+ * Returns NULL if it is CSL-JSON that is not well-formed. */
+markdown_bibliography * markdown_bibliography_create(const char *text) {
+    bibliography_builder builder;
+    markdown_bibliography *bib = NULL;
+    bool ok = true;
+
+    builder.entries = g_string_new("");
+    builder.count = 0;
+    if (strncmp(text, "\xEF\xBB\xBF", 3) == 0)
+        text += 3;
+    text = json_skip_space(text);
+    if (*text == '[' || *text == '{')
+        ok = read_csl(&builder, text);
+    else
+        read_bibtex(&builder, text);
+    if (ok)
+        bib = build_index(&builder);
+    g_string_free(builder.entries, true);
+    return bib;
+}
+
+/* valid_index - whether the 'size' bytes at 'data' are an index that
+ * lookups can trust: every slot leads to a key and text within it, and
+ * some slots are empty, so that probing ends */
+static bool valid_index(const char *data, size_t size) {
+    const bibliography_header *header = (const bibliography_header *)data;
+    const uint32_t *slot = (const uint32_t *)(data + sizeof(bibliography_header));
+    const char *key;
+    uint32_t i, table, used = 0;
+
+    if (size < sizeof(bibliography_header) || data[size - 1] != '\0' ||
+        memcmp(header->magic, BIBLIOGRAPHY_MAGIC, sizeof(header->magic)) != 0 ||
+        header->order != BIBLIOGRAPHY_ORDER || header->size != size ||
+        header->slots == 0 || (header->slots & (header->slots - 1)) != 0 ||
+        header->slots > (size - sizeof(bibliography_header)) / sizeof(uint32_t) ||
+        header->count >= header->slots)
+        return false;
+    table = sizeof(bibliography_header) + header->slots * sizeof(uint32_t);
+    for (i = 0; i < header->slots; i++) {
+        if (slot[i] == 0)
+            continue;
+        if (slot[i] < table || slot[i] % 4 != 0 || slot[i] > size - sizeof(uint32_t) - 2)
+            return false;
+        key = data + slot[i] + sizeof(uint32_t);
+        if (key + strlen(key) + 1 >= data + size)
+            return false;
+        used++;
+    }
+    return used == header->count;
+}
+
+/* markdown_bibliography_load - read the bibliography in the file 'path',
+ * which is either BibTeX or CSL-JSON to index, or an index written by
+ * markdown_bibliography_save(), which is mapped into memory as it is.
+ * Returns NULL with errno set if the file cannot be read, or with errno
+ * 0 if it is neither. */
+markdown_bibliography * markdown_bibliography_load(const char *path) {
+    markdown_bibliography *bib;
+    struct stat info;
+    char *data;
+    size_t size, done = 0;
+    ssize_t got;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return NULL;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return NULL;
+    }
+    size = info.st_size;
+    data = g_malloc(size + 1);
+    /* the magic first, to see whether the rest need be read at all */
+    while (done < size && done < sizeof(BIBLIOGRAPHY_MAGIC) - 1 &&
+           (got = read(fd, data + done, sizeof(BIBLIOGRAPHY_MAGIC) - 1 - done)) > 0)
+        done += got;
+
+    if (size >= sizeof(bibliography_header) && memcmp(data, BIBLIOGRAPHY_MAGIC, done) == 0 &&
+        done == sizeof(BIBLIOGRAPHY_MAGIC) - 1) {
+        g_free(data);
+        data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+            return NULL;
+        errno = 0;
+        if (!valid_index(data, size)) {
+            munmap(data, size);
+            return NULL;
+        }
+        bib = g_malloc(sizeof(markdown_bibliography));
+        bib->data = data;
+        bib->size = size;
+        bib->mapped = true;
+        return bib;
+    }
+
+    while (done < size && (got = read(fd, data + done, size - done)) > 0)
+        done += got;
+    data[done] = '\0';
+    close(fd);
+    errno = 0;
+    bib = markdown_bibliography_create(data);
+    g_free(data);
+    return bib;
+}
+
+/* markdown_bibliography_save - write the index to the file 'path', for
+ * markdown_bibliography_load() to map.  Returns false, with errno set, if
+ * it cannot be written. */
+bool markdown_bibliography_save(const markdown_bibliography *bib, const char *path) {
+    FILE *out;
+    bool ok;
+
+    if ((out = fopen(path, "wb")) == NULL)
+        return false;
+    ok = fwrite(bib->data, 1, bib->size, out) == bib->size;
+    return (fclose(out) == 0) && ok;
+}
+
+/* markdown_bibliography_destroy - free or unmap the index.  It must not
+ * be in use by any conversion. */
+void markdown_bibliography_destroy(markdown_bibliography *bib) {
+    if (bib == NULL)
+        return;
+    if (shared_bibliography == bib)
+        shared_bibliography = NULL;
+    if (bib->mapped)
+        munmap(bib->data, bib->size);
+    else
+        g_free(bib->data);
+    g_free(bib);
+}
+
+/* markdown_set_bibliography - resolve citations missing from each
+ * document from 'bib' from now on; NULL stops doing so. */
+void markdown_set_bibliography(const markdown_bibliography *bib) {
+    shared_bibliography = bib;
+}
+
+/* lookup_bibliography - the note text of the entry for 'key' in the
+ * shared bibliography, or NULL */
+const char * lookup_bibliography(const char *key) {
+    const markdown_bibliography *bib = shared_bibliography;
+    const bibliography_header *header;
+    const uint32_t *slot;
+    const char *entry;
+    uint32_t hash, i;
+
+    if (bib == NULL)
+        return NULL;
+    header = (const bibliography_header *)bib->data;
+    slot = (const uint32_t *)(bib->data + sizeof(bibliography_header));
+    hash = hash_citation(key);
+    for (i = hash & (header->slots - 1); slot[i] != 0; i = (i + 1) & (header->slots - 1)) {
+        entry = bib->data + slot[i];
+        if (*(const uint32_t *)entry == hash && strcmp(entry + sizeof(uint32_t), key) == 0)
+            return entry + sizeof(uint32_t) + strlen(key) + 1;
+    }
+    return NULL;
+}
@@ -0,0 +1,80 @@
+/**********************************************************************
+
+  converter_check.c - consistency check for markdown converter handles.
+
+  Converts each input file to every output format through a converter
+  handle, twice, and again after resetting the handle, and fails if any
+  of those conversions differs from markdown_to_string().  The files
+  are converted through the same handles one after another, so output
+  left over from one document would show up in the next.
+
+  Usage: converter_check FILE...
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+ ***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "markdown_peg.h"
+#include "harness.h"
+
+static const int extensions = EXT_SMART | EXT_NOTES;
+
+/* check - convert 'text' through 'converter' and compare the result with
+ * 'expected'.  Returns 1 if they differ, 0 if not. */
+static int check(markdown_converter *converter, const char *text, const char *expected,
+                 const char *path, const char *format, const char *pass) {
+    const char *out;
+    size_t length;
+
+    out = markdown_converter_convert(converter, text, &length);
+    if (out == NULL || strcmp(out, expected) != 0 || length != strlen(expected)) {
+        fprintf(stderr, "%s: %s, %s conversion differs from markdown_to_string\n",
+            path, format, pass);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    markdown_converter *converters[HARNESS_FORMATS];
+    char *text, *expected;
+    int failures = 0;
+    int i, f, format;
+
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s FILE...\n", argv[0]);
+        return 2;
+    }
+
+    for (f = 0; harness_formats[f] != NULL; f++)
+        converters[f] = markdown_converter_create(extensions,
+            markdown_format_from_name(harness_formats[f]));
+
+    for (i = 1; i < argc; i++) {
+        if ((text = harness_read_file(argv[i], NULL)) == NULL) {
+            perror(argv[i]);
+            failures++;
+            continue;
+        }
+        for (f = 0; harness_formats[f] != NULL; f++) {
+            format = markdown_format_from_name(harness_formats[f]);
+            expected = markdown_to_string(text, extensions, format);
+            failures += check(converters[f], text, expected, argv[i], harness_formats[f], "first");
+            failures += check(converters[f], text, expected, argv[i], harness_formats[f], "second");
+            markdown_converter_reset(converters[f]);
+            failures += check(converters[f], text, expected, argv[i], harness_formats[f], "post-reset");
+            markdown_free(expected);
+        }
+        free(text);
+    }
+
+    for (f = 0; harness_formats[f] != NULL; f++)
+        markdown_converter_destroy(converters[f]);
+    printf("%d files, %d failures\n", argc - 1, failures);
+    return failures ? 1 : 0;
+}
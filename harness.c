@@ -0,0 +1,56 @@
+/**********************************************************************
+
+  harness.c - helpers shared by the check and bench programs.
+
+  The checks (alloc_check, converter_check) and the benchmarks
+  (kernel_bench, parser_bench) read input files, step through every
+  output format and time what they run; those parts live here rather
+  than in a copy per program.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+ ***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include "harness.h"
+
+const char *harness_formats[HARNESS_FORMATS + 1] = {
+    "html", "latex", "memoir", "beamer", "opml", "odf", "stats", NULL
+};
+
+/* harness_read_file - return the contents of 'path' as a malloc'd,
+ * null-terminated string, storing its length in *length if not NULL.
+ * Returns NULL if it cannot be read. */
+char *harness_read_file(const char *path, size_t *length) {
+    FILE *f;
+    char *text;
+    long size;
+    size_t got;
+
+    if ((f = fopen(path, "rb")) == NULL)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size < 0 || (text = malloc(size + 1)) == NULL) {
+        fclose(f);
+        return NULL;
+    }
+    got = fread(text, 1, size, f);
+    text[got] = '\0';
+    fclose(f);
+    if (length != NULL)
+        *length = got;
+    return text;
+}
+
+/* harness_seconds - the time of day, in seconds */
+double harness_seconds(void) {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return now.tv_sec + now.tv_usec / 1e6;
+}
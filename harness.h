@@ -0,0 +1,11 @@
+#include <stddef.h>
+
+/* Helpers shared by the check and bench programs.  See harness.c. */
+
+/* Names of every output format, NULL-terminated; look each up with
+ * markdown_format_from_name(). */
+#define HARNESS_FORMATS 7
+extern const char *harness_formats[HARNESS_FORMATS + 1];
+
+char *harness_read_file(const char *path, size_t *length);
+double harness_seconds(void);
@@ -0,0 +1,172 @@
+/**********************************************************************
+
+  json.c - reading JSON in place, and writing JSON strings.
+
+  Values are found by skipping over them, without building a tree, and
+  strings are decoded only when they are wanted.  Used for JSON Lines
+  records and for CSL-JSON bibliographies.  Strings are written with the
+  one escaper, so every JSON the program emits is escaped alike.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+ ***********************************************************************/
+
+#include <stdbool.h>
+#include <string.h>
+#include "glib.h"
+#include "markdown_peg.h"
+
+/* json_skip_space - return the first character at or after 'c' that is
+ * not JSON whitespace */
+const char * json_skip_space(const char *c) {
+    while (*c == ' ' || *c == '\t' || *c == '\r' || *c == '\n')
+        c++;
+    return c;
+}
+
+/* json_skip_string - 'c' is at the opening quote; return the character after
+ * the closing one, or NULL */
+const char * json_skip_string(const char *c) {
+    for (c++; *c != '"'; c++) {
+        if (*c == '\0')
+            return NULL;
+        if (*c == '\\' && *++c == '\0')
+            return NULL;
+    }
+    return c + 1;
+}
+
+/* json_skip_value - return the character after the JSON value at 'c', or NULL */
+const char * json_skip_value(const char *c) {
+    int depth = 0;
+    if (*c == '"')
+        return json_skip_string(c);
+    if (*c != '{' && *c != '[') {
+        while (*c != '\0' && *c != ',' && *c != '}' && *c != ']' &&
+            *c != ' ' && *c != '\t' && *c != '\r' && *c != '\n')
+            c++;
+        return c;
+    }
+    for (; *c != '\0'; c++) {
+        if (*c == '"') {
+            if ((c = json_skip_string(c)) == NULL)
+                return NULL;
+            c--;
+        } else if (*c == '{' || *c == '[') {
+            depth++;
+        } else if ((*c == '}' || *c == ']') && --depth == 0) {
+            return c + 1;
+        }
+    }
+    return NULL;
+}
+
+static int hex_value(const char *c) {
+    int value = 0;
+    int i;
+    for (i = 0; i < 4; i++) {
+        value <<= 4;
+        if (c[i] >= '0' && c[i] <= '9')
+            value |= c[i] - '0';
+        else if (c[i] >= 'a' && c[i] <= 'f')
+            value |= c[i] - 'a' + 10;
+        else if (c[i] >= 'A' && c[i] <= 'F')
+            value |= c[i] - 'A' + 10;
+        else
+            return -1;
+    }
+    return value;
+}
+
+static void append_utf8(GString *out, long code) {
+    if (code < 0x80) {
+        g_string_append_c(out, code);
+    } else if (code < 0x800) {
+        g_string_append_c(out, 0xC0 | (code >> 6));
+        g_string_append_c(out, 0x80 | (code & 0x3F));
+    } else if (code < 0x10000) {
+        g_string_append_c(out, 0xE0 | (code >> 12));
+        g_string_append_c(out, 0x80 | ((code >> 6) & 0x3F));
+        g_string_append_c(out, 0x80 | (code & 0x3F));
+    } else {
+        g_string_append_c(out, 0xF0 | (code >> 18));
+        g_string_append_c(out, 0x80 | ((code >> 12) & 0x3F));
+        g_string_append_c(out, 0x80 | ((code >> 6) & 0x3F));
+        g_string_append_c(out, 0x80 | (code & 0x3F));
+    }
+}
+
+/* json_decode_string - append the JSON string 'value' to 'out', unescaped.
+ * Unpaired surrogates become U+FFFD. */
+bool json_decode_string(GString *out, json_span value) {
+    const char *c = value.start + 1;
+    const char *end = value.end - 1;
+    const char *run;
+    long code, low;
+
+    while (c < end) {
+        for (run = c; c < end && *c != '\\'; c++)
+            ;
+        if (c > run)
+            g_string_append_len(out, run, c - run);
+        if (c == end)
+            break;
+        switch (*++c) {
+        case 'b': g_string_append_c(out, '\b'); break;
+        case 'f': g_string_append_c(out, '\f'); break;
+        case 'n': g_string_append_c(out, '\n'); break;
+        case 'r': g_string_append_c(out, '\r'); break;
+        case 't': g_string_append_c(out, '\t'); break;
+        case 'u':
+            if (end - c < 5 || (code = hex_value(c + 1)) < 0)
+                return false;
+            c += 4;
+            if (code >= 0xD800 && code < 0xDC00) {
+                if (end - c >= 7 && c[1] == '\\' && c[2] == 'u' &&
+                    (low = hex_value(c + 3)) >= 0xDC00 && low < 0xE000) {
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    c += 6;
+                } else {
+                    code = 0xFFFD;
+                }
+            } else if (code >= 0xDC00 && code < 0xE000) {
+                code = 0xFFFD;
+            }
+            append_utf8(out, code);
+            break;
+        default:
+            g_string_append_c(out, *c);
+        }
+        c++;
+    }
+    return true;
+}
+
+/* json_append_string - append the 'length' bytes at 's' to 'out' as a
+ * quoted JSON string */
+void json_append_string(GString *out, const char *s, size_t length) {
+    const char *end = s + length;
+    const char *run;
+
+    g_string_append_c(out, '"');
+    while (s < end) {
+        for (run = s; s < end && *s != '"' && *s != '\\' && (unsigned char)*s >= 0x20; s++)
+            ;
+        if (s > run)
+            g_string_append_len(out, run, s - run);
+        if (s == end)
+            break;
+        switch (*s) {
+        case '"':  g_string_append(out, "\\\""); break;
+        case '\\': g_string_append(out, "\\\\"); break;
+        case '\n': g_string_append(out, "\\n"); break;
+        case '\t': g_string_append(out, "\\t"); break;
+        case '\r': g_string_append(out, "\\r"); break;
+        default:   g_string_append_printf(out, "\\u%04x", *s);
+        }
+        s++;
+    }
+    g_string_append_c(out, '"');
+}
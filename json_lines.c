@@ -0,0 +1,290 @@
+/**********************************************************************
+
+  json_lines.c - bulk conversion of JSON Lines records.
+
+  Each input line is a JSON object such as
+
+      {"id": 17, "md": "Some *text*", "format": "html"}
+
+  where "format" is optional and defaults to the one given on the
+  command line.  Each record produces one output line,
+
+      {"id": 17, "output": "<p>Some <em>text</em></p>"}
+
+  or, if it cannot be converted, {"id": 17, "error": "..."}.  The id is
+  copied through exactly as it was written, whatever its type.
+
+  Records are converted by a pool of worker threads, each with its own
+  converters and parser buffers.  At most a fixed number of records are
+  in flight at once, and results are written in input order.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+ ***********************************************************************/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "glib.h"
+#include "markdown_peg.h"
+#include "json_lines.h"
+
+/* Records in flight for each worker */
+#define RECORDS_PER_WORKER 4
+
+enum slot_states {
+    SLOT_PENDING,           /* read, waiting for a worker */
+    SLOT_BUSY,              /* being converted */
+    SLOT_DONE               /* converted, waiting to be written */
+};
+
+typedef struct {
+    GString *record;        /* the line as read; then the line to write */
+    int state;
+    bool failed;
+} record_slot;
+
+/* Ring of records in flight.  Records from 'head' to 'tail' are in
+ * flight; 'next' is the first one no worker has taken yet. */
+typedef struct {
+    record_slot *slots;
+    long size;
+    long head;
+    long next;
+    long tail;
+    bool eof;
+    pthread_mutex_t lock;
+    pthread_cond_t work;    /* a record was added, or input ended */
+    pthread_cond_t done;    /* a record was converted */
+    int extensions;
+    int output_format;
+} record_pool;
+
+/* parse_record - find the id, md and format members of a record.  Those
+ * missing are left with start NULL.  Returns an error message or NULL. */
+static const char *parse_record(const char *c, json_span *id, json_span *md, json_span *format) {
+    json_span key, value;
+
+    id->start = md->start = format->start = NULL;
+    id->end = md->end = format->end = NULL;
+    c = json_skip_space(c);
+    if (*c++ != '{')
+        return "record is not a JSON object";
+    c = json_skip_space(c);
+    if (*c == '}')
+        return NULL;
+    for (;;) {
+        if (*c != '"' || (key.end = json_skip_string(key.start = c)) == NULL)
+            return "malformed JSON";
+        c = json_skip_space(key.end);
+        if (*c++ != ':')
+            return "malformed JSON";
+        value.start = c = json_skip_space(c);
+        if ((value.end = c = json_skip_value(c)) == NULL || value.end == value.start)
+            return "malformed JSON";
+        if (key.end - key.start == 4 && strncmp(key.start, "\"id\"", 4) == 0)
+            *id = value;
+        else if (key.end - key.start == 4 && strncmp(key.start, "\"md\"", 4) == 0)
+            *md = value;
+        else if (key.end - key.start == 8 && strncmp(key.start, "\"format\"", 8) == 0)
+            *format = value;
+        c = json_skip_space(c);
+        if (*c == '}')
+            return NULL;
+        if (*c++ != ',')
+            return "malformed JSON";
+        c = json_skip_space(c);
+    }
+}
+
+/* convert_record - replace the record in 'slot' with its result line,
+ * using and creating as needed the worker's converter for each format */
+static void convert_record(record_pool *pool, record_slot *slot, markdown_converter **converters) {
+    json_span id, md, format;
+    GString *text = g_string_new("");
+    GString *result = g_string_new("{\"id\":");
+    const char *error;
+    const char *out = NULL;
+    size_t length;
+    int output_format = pool->output_format;
+
+    error = parse_record(slot->record->str, &id, &md, &format);
+    if (error == NULL && md.start == NULL)
+        error = "record has no \"md\" member";
+    else if (error == NULL && (*md.start != '"' || !json_decode_string(text, md)))
+        error = "\"md\" is not a valid JSON string";
+    if (error == NULL && format.start != NULL) {
+        g_string_append_c(text, '\0');
+        length = text->currentStringLength;
+        if (*format.start != '"' || !json_decode_string(text, format) ||
+            (output_format = markdown_format_from_name(text->str + length)) < 0)
+            error = "unknown \"format\"";
+        text->currentStringLength = length - 1;
+        text->str[length - 1] = '\0';
+    }
+    if (error == NULL) {
+        if (converters[output_format] == NULL)
+            converters[output_format] = markdown_converter_create(pool->extensions, output_format);
+        if ((out = markdown_converter_convert(converters[output_format], text->str, &length)) == NULL)
+            error = "input is not valid UTF-8";
+    }
+
+    if (id.start != NULL)
+        g_string_append_len(result, id.start, id.end - id.start);
+    else
+        g_string_append(result, "null");
+    if (error == NULL) {
+        g_string_append(result, ",\"output\":");
+        json_append_string(result, out, length);
+    } else {
+        g_string_append(result, ",\"error\":");
+        json_append_string(result, error, strlen(error));
+        slot->failed = true;
+    }
+    g_string_append(result, "}\n");
+
+    g_string_free(text, true);
+    g_string_free(slot->record, true);
+    slot->record = result;
+}
+
+/* worker - convert records until input ends and none are left */
+static void *worker(void *arg) {
+    record_pool *pool = arg;
+    markdown_converter *converters[STATS_FORMAT + 1];
+    record_slot *slot;
+    int i;
+
+    memset(converters, 0, sizeof(converters));
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->next == pool->tail && !pool->eof)
+            pthread_cond_wait(&pool->work, &pool->lock);
+        if (pool->next == pool->tail)
+            break;
+        slot = &pool->slots[pool->next++ % pool->size];
+        slot->state = SLOT_BUSY;
+        pthread_mutex_unlock(&pool->lock);
+        convert_record(pool, slot, converters);
+        pthread_mutex_lock(&pool->lock);
+        slot->state = SLOT_DONE;
+        pthread_cond_broadcast(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i <= STATS_FORMAT; i++)
+        if (converters[i] != NULL)
+            markdown_converter_destroy(converters[i]);
+    markdown_trim_parser_buffers();
+    return NULL;
+}
+
+/* write_head - wait for the oldest record in flight, if 'wait', and write
+ * it out.  Called and returns with the lock held.  Returns false if
+ * there was nothing to write. */
+static bool write_head(record_pool *pool, FILE *out, long *failures, bool wait) {
+    record_slot *slot;
+    GString *line;
+
+    if (pool->head == pool->tail)
+        return false;
+    slot = &pool->slots[pool->head % pool->size];
+    while (wait && slot->state != SLOT_DONE)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    if (slot->state != SLOT_DONE)
+        return false;
+    line = slot->record;
+    slot->record = NULL;
+    if (slot->failed)
+        (*failures)++;
+    pool->head++;
+    pthread_mutex_unlock(&pool->lock);
+    fwrite(line->str, 1, line->currentStringLength, out);
+    g_string_free(line, true);
+    pthread_mutex_lock(&pool->lock);
+    return true;
+}
+
+/* read_line - read the next non-blank line of 'in' into 'line' */
+static bool read_line(FILE *in, GString *line) {
+    char buf[4096];
+    size_t len;
+
+    do {
+        line->currentStringLength = 0;
+        line->str[0] = '\0';
+        while (fgets(buf, sizeof(buf), in) != NULL) {
+            len = strlen(buf);
+            g_string_append_len(line, buf, len);
+            if (len > 0 && buf[len - 1] == '\n')
+                break;
+        }
+        if (line->currentStringLength == 0)
+            return false;
+    } while (*json_skip_space(line->str) == '\0');
+    return true;
+}
+
+long convert_json_lines(FILE *in, FILE *out, int extensions, int output_format, int threads) {
+    record_pool pool;
+    pthread_t *workers;
+    record_slot *slot;
+    GString *line;
+    long failures = 0;
+    int i;
+
+    if (threads < 1)
+        threads = 1;
+    pool.size = threads * RECORDS_PER_WORKER;
+    pool.slots = g_malloc(pool.size * sizeof(record_slot));
+    pool.head = pool.next = pool.tail = 0;
+    pool.eof = false;
+    pool.extensions = extensions;
+    pool.output_format = output_format;
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.work, NULL);
+    pthread_cond_init(&pool.done, NULL);
+
+    workers = g_malloc(threads * sizeof(pthread_t));
+    for (i = 0; i < threads; i++)
+        pthread_create(&workers[i], NULL, worker, &pool);
+
+    pthread_mutex_lock(&pool.lock);
+    for (;;) {
+        /* write what is ready, and make room for the next record */
+        while (write_head(&pool, out, &failures, pool.tail - pool.head == pool.size))
+            ;
+        pthread_mutex_unlock(&pool.lock);
+        line = g_string_new("");
+        if (!read_line(in, line)) {
+            g_string_free(line, true);
+            pthread_mutex_lock(&pool.lock);
+            break;
+        }
+        pthread_mutex_lock(&pool.lock);
+        slot = &pool.slots[pool.tail % pool.size];
+        slot->record = line;
+        slot->state = SLOT_PENDING;
+        slot->failed = false;
+        pool.tail++;
+        pthread_cond_signal(&pool.work);
+    }
+    pool.eof = true;
+    pthread_cond_broadcast(&pool.work);
+    while (write_head(&pool, out, &failures, true))
+        ;
+    pthread_mutex_unlock(&pool.lock);
+
+    for (i = 0; i < threads; i++)
+        pthread_join(workers[i], NULL);
+    g_free(workers);
+    g_free(pool.slots);
+    pthread_mutex_destroy(&pool.lock);
+    pthread_cond_destroy(&pool.work);
+    pthread_cond_destroy(&pool.done);
+    return failures;
+}
@@ -0,0 +1,6 @@
+#include <stdio.h>
+
+/* Convert JSON Lines records read from 'in', writing one JSON line per
+ * record to 'out' in the same order.  See json_lines.c.  Returns the
+ * number of records that failed. */
+long convert_json_lines(FILE *in, FILE *out, int extensions, int output_format, int threads);
@@ -0,0 +1,121 @@
+/**********************************************************************
+
+  kernel_bench.c - timings of the SIMD kernels at each level.
+
+  Runs every kernel in kernels.c at every level the CPU supports, over
+  text with short runs (prose, markup every few words) and long ones
+  (plain paragraphs), checks that each level gives the same answers as
+  the portable one, and prints throughput.
+
+  Usage: kernel_bench [-n MEGABYTES]
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+ ***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "markdown_peg.h"
+#include "harness.h"
+
+#define SAMPLE_SIZE (1 << 20)
+
+/* make_sample - SAMPLE_SIZE bytes of text with a character that ends a
+ * run about every 'spacing' bytes.  Bytes from 0x80 up, which end plain
+ * runs but not HTML ones, are among those characters, so the kernels
+ * see them as well as ASCII. */
+static char *make_sample(int spacing) {
+    static const char stops[] = "\n<&\"\t>";
+    char *text = malloc(SAMPLE_SIZE + 1);
+    int i, stop;
+
+    srand(spacing);
+    for (i = 0; i < SAMPLE_SIZE; i++) {
+        if (rand() % spacing == 0) {
+            stop = rand() % sizeof(stops);
+            text[i] = stop < sizeof(stops) - 1 ? stops[stop] : (char)(0x80 + rand() % 128);
+        } else
+            text[i] = 'a' + rand() % 26;
+    }
+    text[SAMPLE_SIZE] = '\0';
+    return text;
+}
+
+/* run_plain - split 'text' into plain runs; returns a checksum */
+static unsigned long run_plain(const char *text) {
+    const unsigned char *s = (const unsigned char *)text;
+    size_t i = 0;
+    unsigned long sum = 0;
+
+    while (i < SAMPLE_SIZE) {
+        i += plain_run(s + i, SAMPLE_SIZE - i) + 1;
+        sum = sum * 31 + i;
+    }
+    return sum;
+}
+
+/* run_html - split 'text' into runs needing no HTML escape */
+static unsigned long run_html(const char *text) {
+    size_t i = 0;
+    unsigned long sum = 0;
+
+    while (i < SAMPLE_SIZE) {
+        i += html_run(text + i, SAMPLE_SIZE - i) + 1;
+        sum = sum * 31 + i;
+    }
+    return sum;
+}
+
+static const struct {
+    const char *name;
+    unsigned long (*run)(const char *text);
+} kernels[] = {
+    { "plain_run", run_plain },
+    { "html_run",  run_html },
+};
+
+static const int spacings[] = { 8, 80, 4096 };
+
+int main(int argc, char *argv[]) {
+    int megabytes = 256;
+    int best = best_kernel_level();
+    int k, s, level, rounds, r;
+    unsigned long expected, sum;
+    double start, elapsed;
+    char *text;
+    int failures = 0;
+
+    if (argc > 2 && strcmp(argv[1], "-n") == 0)
+        megabytes = atoi(argv[2]);
+    rounds = megabytes > 0 ? megabytes : 1;
+
+    printf("best level on this CPU: %s\n\n", kernel_level_name(best));
+    printf("%-10s %8s %-8s %10s\n", "kernel", "run", "level", "MB/s");
+    for (k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        for (s = 0; s < sizeof(spacings) / sizeof(spacings[0]); s++) {
+            text = make_sample(spacings[s]);
+            set_kernel_level(KERNEL_GENERIC);
+            expected = kernels[k].run(text);
+            for (level = KERNEL_GENERIC; level <= best; level++) {
+                set_kernel_level(level);
+                sum = 0;
+                start = harness_seconds();
+                for (r = 0; r < rounds; r++)
+                    sum = kernels[k].run(text);
+                elapsed = harness_seconds() - start;
+                if (sum != expected) {
+                    fprintf(stderr, "%s at %s differs from generic\n",
+                        kernels[k].name, kernel_level_name(level));
+                    failures++;
+                }
+                printf("%-10s %8d %-8s %10.0f\n", kernels[k].name, spacings[s],
+                    kernel_level_name(level), elapsed > 0 ? rounds / elapsed : 0);
+            }
+            free(text);
+        }
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,258 @@
+/**********************************************************************
+
+  kernels.c - byte loops that have SIMD variants.
+
+  Each kernel has a portable version and, on x86, SSE2, AVX2 and
+  AVX-512 versions compiled with per-function target attributes, so one
+  binary runs everywhere.  The best level the CPU supports is chosen
+  once, when the program or library is loaded; MMD_SIMD=generic, sse2,
+  avx2 or avx512 in the environment forces a lower one.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+ ***********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "markdown_peg.h"
+
+#if defined(__GNUC__) && __GNUC__ >= 5 && (defined(__x86_64__) || defined(__i386__)) && !defined(MD_NO_SIMD)
+#define KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+static const char *kernel_level_names[KERNEL_LEVELS] = {
+    "generic",
+    "sse2",
+    "avx2",
+    "avx512"
+};
+
+/* Word-at-a-time tests on the bytes of 'w': any byte below n (n <= 128),
+ * any byte with the high bit set, and any byte equal to c. */
+#define ONES            (~0UL / 255)
+#define HAS_LESS(w, n)  (((w) - ONES * (n)) & ~(w) & ONES * 128)
+#define HAS_HIGH(w)     ((w) & ONES * 128)
+#define HAS_BYTE(w, c)  HAS_LESS((w) ^ ONES * (c), 1)
+
+/* plain_run_generic - length of the run at 's' (of 'len' bytes) of
+ * printable ASCII, checked a word at a time. */
+static size_t plain_run_generic(const unsigned char *s, size_t len) {
+    unsigned long w;
+    size_t i = 0;
+
+    while (i + sizeof(w) <= len) {
+        memcpy(&w, s + i, sizeof(w));
+        if (HAS_LESS(w, 0x20) || HAS_HIGH(w))
+            break;
+        i += sizeof(w);
+    }
+    while (i < len && s[i] >= 0x20 && s[i] < 0x80)
+        i++;
+    return i;
+}
+
+/* html_run_generic - length of the run at 's' (of 'len' bytes) needing
+ * no HTML escape, checked a word at a time. */
+static size_t html_run_generic(const char *s, size_t len) {
+    unsigned long w;
+    size_t i = 0;
+
+    while (i + sizeof(w) <= len) {
+        memcpy(&w, s + i, sizeof(w));
+        if (HAS_BYTE(w, '&') || HAS_BYTE(w, '<') || HAS_BYTE(w, '>') || HAS_BYTE(w, '"'))
+            break;
+        i += sizeof(w);
+    }
+    while (i < len && s[i] != '&' && s[i] != '<' && s[i] != '>' && s[i] != '"')
+        i++;
+    return i;
+}
+
+#ifdef KERNEL_X86
+
+/* Printable ASCII is 0x20 to 0x7F; as signed bytes, those above 0x1F.
+ * Each variant checks whole blocks while they fit in 'len' and leaves
+ * the tail to the level below, so none reads past the end. */
+
+__attribute__((target("sse2")))
+static size_t plain_run_sse2(const unsigned char *s, size_t len) {
+    const __m128i space = _mm_set1_epi8(0x1F);
+    unsigned int mask;
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        mask = _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)(s + i)), space));
+        if (mask != 0xFFFF)
+            return i + __builtin_ctz(~mask);
+    }
+    return i + plain_run_generic(s + i, len - i);
+}
+
+__attribute__((target("sse2")))
+static unsigned int html_mask_sse2(__m128i v) {
+    __m128i hit = _mm_cmpeq_epi8(v, _mm_set1_epi8('&'));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('<')));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('>')));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+    return _mm_movemask_epi8(hit);
+}
+
+__attribute__((target("sse2")))
+static size_t html_run_sse2(const char *s, size_t len) {
+    unsigned int mask;
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16)
+        if ((mask = html_mask_sse2(_mm_loadu_si128((const __m128i *)(s + i)))) != 0)
+            return i + __builtin_ctz(mask);
+    return i + html_run_generic(s + i, len - i);
+}
+
+__attribute__((target("avx2")))
+static size_t plain_run_avx2(const unsigned char *s, size_t len) {
+    const __m256i space = _mm256_set1_epi8(0x1F);
+    unsigned int mask;
+    size_t i = 0;
+
+    for (; i + 32 <= len; i += 32) {
+        mask = _mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_loadu_si256((const __m256i *)(s + i)), space));
+        if (mask != 0xFFFFFFFF)
+            return i + __builtin_ctz(~mask);
+    }
+    return i + plain_run_sse2(s + i, len - i);
+}
+
+__attribute__((target("avx2")))
+static unsigned int html_mask_avx2(__m256i v) {
+    __m256i hit = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('&'));
+    hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('<')));
+    hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('>')));
+    hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')));
+    return _mm256_movemask_epi8(hit);
+}
+
+__attribute__((target("avx2")))
+static size_t html_run_avx2(const char *s, size_t len) {
+    unsigned int mask;
+    size_t i = 0;
+
+    for (; i + 32 <= len; i += 32)
+        if ((mask = html_mask_avx2(_mm256_loadu_si256((const __m256i *)(s + i)))) != 0)
+            return i + __builtin_ctz(mask);
+    return i + html_run_sse2(s + i, len - i);
+}
+
+__attribute__((target("avx512bw")))
+static size_t plain_run_avx512(const unsigned char *s, size_t len) {
+    const __m512i space = _mm512_set1_epi8(0x1F);
+    unsigned long long mask;
+    size_t i = 0;
+
+    for (; i + 64 <= len; i += 64) {
+        mask = _mm512_cmpgt_epi8_mask(_mm512_loadu_si512((const void *)(s + i)), space);
+        if (mask != ~0ULL)
+            return i + __builtin_ctzll(~mask);
+    }
+    return i + plain_run_avx2(s + i, len - i);
+}
+
+__attribute__((target("avx512bw")))
+static unsigned long long html_mask_avx512(__m512i v) {
+    return _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8('&')) |
+        _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8('<')) |
+        _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8('>')) |
+        _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8('"'));
+}
+
+__attribute__((target("avx512bw")))
+static size_t html_run_avx512(const char *s, size_t len) {
+    unsigned long long mask;
+    size_t i = 0;
+
+    for (; i + 64 <= len; i += 64)
+        if ((mask = html_mask_avx512(_mm512_loadu_si512((const void *)(s + i)))) != 0)
+            return i + __builtin_ctzll(mask);
+    return i + html_run_avx2(s + i, len - i);
+}
+
+#endif
+
+size_t (*plain_run)(const unsigned char *s, size_t len) = plain_run_generic;
+size_t (*html_run)(const char *s, size_t len) = html_run_generic;
+
+static int current_level = KERNEL_GENERIC;
+
+/* best_kernel_level - the highest level this CPU supports */
+int best_kernel_level(void) {
+#ifdef KERNEL_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512bw"))
+        return KERNEL_AVX512;
+    if (__builtin_cpu_supports("avx2"))
+        return KERNEL_AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return KERNEL_SSE2;
+#endif
+    return KERNEL_GENERIC;
+}
+
+/* set_kernel_level - use the kernels of 'level', or of the best level
+ * the CPU supports if that is lower.  Not thread-safe; call it before
+ * any conversion starts. */
+void set_kernel_level(int level) {
+    int best = best_kernel_level();
+    if (level > best)
+        level = best;
+    if (level < KERNEL_GENERIC)
+        level = KERNEL_GENERIC;
+    current_level = level;
+    switch (level) {
+#ifdef KERNEL_X86
+    case KERNEL_AVX512:
+        plain_run = plain_run_avx512;
+        html_run = html_run_avx512;
+        break;
+    case KERNEL_AVX2:
+        plain_run = plain_run_avx2;
+        html_run = html_run_avx2;
+        break;
+    case KERNEL_SSE2:
+        plain_run = plain_run_sse2;
+        html_run = html_run_sse2;
+        break;
+#endif
+    default:
+        plain_run = plain_run_generic;
+        html_run = html_run_generic;
+    }
+}
+
+int kernel_level(void) {
+    return current_level;
+}
+
+const char * kernel_level_name(int level) {
+    if (level < 0 || level >= KERNEL_LEVELS)
+        return "unknown";
+    return kernel_level_names[level];
+}
+
+/* choose_kernels - pick the kernels at load time, honouring MMD_SIMD */
+#ifdef __GNUC__
+__attribute__((constructor))
+#endif
+static void choose_kernels(void) {
+    const char *forced = getenv("MMD_SIMD");
+    int level;
+
+    if (forced != NULL)
+        for (level = 0; level < KERNEL_LEVELS; level++)
+            if (strcmp(forced, kernel_level_names[level]) == 0) {
+                set_kernel_level(level);
+                return;
+            }
+    set_kernel_level(KERNEL_LEVELS - 1);
+}
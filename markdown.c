@@ -22,12 +22,764 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <errno.h>
 #include <getopt.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef MD_USE_ZLIB
+#include <zlib.h>
+#endif
 #include "glib.h"
 #include "markdown_peg.h"
+#include "json_lines.h"
 
 static int extensions;
 
+/**********************************************************************
+
+  Timeline tracing (--trace FILE).  Spans for each input file, its
+  reading and writing, and each phase of the conversion are written as
+  Chrome trace events, which chrome://tracing or Perfetto can display.
+  Each event is one formatted write, so tracing is cheap enough to
+  leave on for batch runs.
+
+ ***********************************************************************/
+
+static FILE *trace_file = NULL;
+static struct timeval trace_epoch;
+static int trace_pid;
+
+/* trace_thread_id - small, stable id for the calling thread */
+static int trace_thread_id(void) {
+    static int next_tid = 0;
+    static MD_THREAD_LOCAL int tid = 0;
+    if (tid == 0)
+        tid = __sync_add_and_fetch(&next_tid, 1);
+    return tid;
+}
+
+/* trace_event - write a begin ('B') or end ('E') event for span 'name';
+   'file', when given, is attached to the event as an argument */
+static void trace_event(const char *name, char ph, const char *file) {
+    struct timeval now;
+    GString *event;
+
+    if (trace_file == NULL)
+        return;
+    gettimeofday(&now, NULL);
+    event = g_string_new("");
+    g_string_append_printf(event,
+        "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%ld,\"pid\":%d,\"tid\":%d",
+        name, file ? "file" : "phase", ph,
+        (long)(now.tv_sec - trace_epoch.tv_sec) * 1000000L +
+            (long)(now.tv_usec - trace_epoch.tv_usec),
+        trace_pid, trace_thread_id());
+    if (file != NULL) {
+        g_string_append(event, ",\"args\":{\"file\":");
+        json_append_string(event, file, strlen(file));
+        g_string_append_c(event, '}');
+    }
+    g_string_append(event, "},\n");
+    fputs(event->str, trace_file);
+    g_string_free(event, true);
+}
+
+/* trace_phase - trace hook for the library's conversion phases */
+static void trace_phase(int phase, int begin, void *user) {
+    trace_event(markdown_phase_name(phase), begin ? 'B' : 'E', NULL);
+}
+
+static void trace_open(const char *path) {
+    if ((trace_file = fopen(path, "w")) == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    gettimeofday(&trace_epoch, NULL);
+    trace_pid = (int)getpid();
+    fputs("[\n", trace_file);
+    markdown_set_trace_hook(trace_phase, NULL);
+}
+
+/* trace_close - end the event array with a metadata event naming the
+   process, so no trailing comma is left */
+static void trace_close(void) {
+    if (trace_file == NULL)
+        return;
+    markdown_set_trace_hook(NULL, NULL);
+    fprintf(trace_file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+        "\"args\":{\"name\":\"multimarkdown\"}}\n]\n", trace_pid);
+    fclose(trace_file);
+    trace_file = NULL;
+}
+
+/**********************************************************************
+
+  Link inventory (--inventory=tsv|json).  Every link, image, reference
+  definition, anchor, note and citation in a document, with the line it
+  is on, is written to a side file next to the output: one row per item
+  as kind, name, target and line separated by tabs, or a JSON array of
+  objects with those fields.
+
+ ***********************************************************************/
+
+static bool inventory_on = false;
+static bool inventory_json = false;
+
+/* append_tsv_field - append 's' to 'out', escaping what would break a row */
+static void append_tsv_field(GString *out, const char *s) {
+    for (; *s != '\0'; s++) {
+        switch (*s) {
+        case '\t': g_string_append(out, "\\t"); break;
+        case '\n': g_string_append(out, "\\n"); break;
+        case '\\': g_string_append(out, "\\\\"); break;
+        default:   g_string_append_c(out, *s);
+        }
+    }
+}
+
+/* inventory_item - inventory hook, adding one item to the GString 'user' */
+static void inventory_item(int kind, const char *name, const char *target, int line, void *user) {
+    GString *buf = user;
+    if (name == NULL)
+        name = "";
+    if (target == NULL)
+        target = "";
+    if (inventory_json) {
+        g_string_append_printf(buf, "%s{\"kind\":\"%s\",\"name\":",
+            buf->currentStringLength > 2 ? ",\n" : "",
+            markdown_inventory_kind_name(kind));
+        json_append_string(buf, name, strlen(name));
+        g_string_append(buf, ",\"target\":");
+        json_append_string(buf, target, strlen(target));
+        g_string_append_printf(buf, ",\"line\":%d}", line);
+    } else {
+        g_string_append_printf(buf, "%s\t", markdown_inventory_kind_name(kind));
+        append_tsv_field(buf, name);
+        g_string_append_c(buf, '\t');
+        append_tsv_field(buf, target);
+        g_string_append_printf(buf, "\t%d\n", line);
+    }
+}
+
+/* inventory_start - collect the inventory of the next document the
+   calling thread converts; returns NULL if there is no inventory */
+static GString *inventory_start(void) {
+    GString *buf;
+    if (!inventory_on)
+        return NULL;
+    buf = g_string_new("");
+    if (inventory_json)
+        g_string_append(buf, "[\n");
+    markdown_set_inventory_hook(inventory_item, buf);
+    return buf;
+}
+
+/* inventory_write - write the inventory in 'buf' to the side file for
+   output 'base' (its name without extension), and free it */
+static void inventory_write(GString *buf, const char *base) {
+    GString *path;
+    FILE *side;
+
+    if (buf == NULL)
+        return;
+    markdown_set_inventory_hook(NULL, NULL);
+    if (inventory_json)
+        g_string_append(buf, buf->currentStringLength > 2 ? "\n]\n" : "]\n");
+    path = g_string_new("");
+    g_string_append_printf(path, "%s.links.%s", base, inventory_json ? "json" : "tsv");
+    if (!(side = fopen(path->str, "w"))) {
+        perror(path->str);
+        exit(EXIT_FAILURE);
+    }
+    fputs(buf->str, side);
+    fclose(side);
+    g_string_free(path, true);
+    g_string_free(buf, true);
+}
+
+/**********************************************************************
+
+  Batch pipeline (-b).  Files pass through three stages joined by
+  bounded queues: reader threads load upcoming inputs, converter threads
+  convert them, and writer threads save the results, so the converters
+  are not left idle while files are read from or written to slow disks.
+  This holds even with a single converter thread.  --fsync syncs output
+  files to disk, a batch at a time.  --gzip writes a gzipped copy of
+  each output beside it.  Outputs that would not change are not
+  rewritten; the rest are written under temporary names and renamed
+  into place once complete, the gzipped copy first.  --stats reports
+  how each stage spent its time.
+
+ ***********************************************************************/
+
+#define BATCH_READERS 2
+#define BATCH_WRITERS 2
+#define BATCH_QUEUE_DEPTH 4      /* files queued for each converter */
+#define FSYNC_BATCH 16           /* files written between syncs */
+#define GZIP_CHUNK 65536         /* bytes compressed, and written, at a time */
+
+/* An output file being written under a temporary name */
+typedef struct {
+    int fd;
+    char *temp;
+    char *path;              /* where it goes once complete */
+} pending_output;
+
+typedef struct {
+    const char *input;
+    char *base;              /* output path, less its extension */
+    GString *text;           /* input, until converted */
+    char *out;               /* output, with its final newline */
+    size_t length;
+    GString *inventory;
+} batch_job;
+
+/* Bounded queue of jobs between two stages */
+typedef struct {
+    batch_job **jobs;
+    int size;
+    int head;
+    int count;
+    int producers;           /* threads that may still add jobs */
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+} job_queue;
+
+enum batch_stages {
+    STAGE_READ,
+    STAGE_CONVERT,
+    STAGE_WRITE,
+    STAGE_COUNT
+};
+
+static const char *stage_names[STAGE_COUNT] = { "read", "convert", "write" };
+
+/* Time spent by the threads of a stage, in seconds */
+typedef struct {
+    int threads;
+    long files;
+    double busy;
+    double wait_in;          /* waiting for a job */
+    double wait_out;         /* waiting for room in the next queue */
+    double compress;         /* writers only: part of busy spent on gzip */
+    long compressed;
+    long unchanged;          /* writers only: outputs left as they were */
+} stage_stats;
+
+typedef struct {
+    char **inputs;
+    int count;
+    int next_input;
+    int output_format;
+    bool fsync;
+    bool gzip;
+    job_queue to_convert;
+    job_queue to_write;
+    stage_stats stats[STAGE_COUNT];
+    pthread_mutex_t lock;
+} batch_pipeline;
+
+static double seconds_now(void) {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return now.tv_sec + now.tv_usec / 1e6;
+}
+
+static void queue_init(job_queue *queue, int size, int producers) {
+    queue->jobs = g_malloc(size * sizeof(batch_job *));
+    queue->size = size;
+    queue->head = queue->count = 0;
+    queue->producers = producers;
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->changed, NULL);
+}
+
+static void queue_free(job_queue *queue) {
+    g_free(queue->jobs);
+    pthread_mutex_destroy(&queue->lock);
+    pthread_cond_destroy(&queue->changed);
+}
+
+/* queue_put - add 'job', waiting for room; the wait is added to 'waited' */
+static void queue_put(job_queue *queue, batch_job *job, double *waited) {
+    double start = seconds_now();
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == queue->size)
+        pthread_cond_wait(&queue->changed, &queue->lock);
+    queue->jobs[(queue->head + queue->count++) % queue->size] = job;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+    *waited += seconds_now() - start;
+}
+
+/* queue_get - take the next job, waiting for one; NULL once the queue is
+   empty and every producer is done */
+static batch_job *queue_get(job_queue *queue, double *waited) {
+    batch_job *job = NULL;
+    double start = seconds_now();
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == 0 && queue->producers > 0)
+        pthread_cond_wait(&queue->changed, &queue->lock);
+    if (queue->count > 0) {
+        job = queue->jobs[queue->head];
+        queue->head = (queue->head + 1) % queue->size;
+        queue->count--;
+        pthread_cond_broadcast(&queue->changed);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    *waited += seconds_now() - start;
+    return job;
+}
+
+static bool queue_empty(job_queue *queue) {
+    bool empty;
+    pthread_mutex_lock(&queue->lock);
+    empty = queue->count == 0;
+    pthread_mutex_unlock(&queue->lock);
+    return empty;
+}
+
+/* queue_done - a producer will add no more jobs */
+static void queue_done(job_queue *queue) {
+    pthread_mutex_lock(&queue->lock);
+    queue->producers--;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/* stage_add - add the times of one thread to those of its stage */
+static void stage_add(batch_pipeline *batch, int stage, const stage_stats *thread) {
+    stage_stats *total = &batch->stats[stage];
+    pthread_mutex_lock(&batch->lock);
+    total->files += thread->files;
+    total->busy += thread->busy;
+    total->wait_in += thread->wait_in;
+    total->wait_out += thread->wait_out;
+    total->compress += thread->compress;
+    total->compressed += thread->compressed;
+    total->unchanged += thread->unchanged;
+    pthread_mutex_unlock(&batch->lock);
+}
+
+/* output_base - 'input' less its extension, if it has one */
+static char *output_base(const char *input) {
+    GString *base = g_string_new((char *)input);
+    char *dot = strrchr(base->str, '.');
+    if (dot != NULL && dot != base->str)
+        *dot = '\0';
+    return g_string_free(base, false);
+}
+
+static const char *output_extension(int output_format) {
+    switch (output_format) {
+    case HTML_FORMAT:   return ".html";
+    case OPML_FORMAT:   return ".opml";
+    case ODF_FORMAT:    return ".fodt";
+    case STATS_FORMAT:  return ".txt";
+    default:            return ".tex";
+    }
+}
+
+static void *batch_reader(void *arg) {
+    batch_pipeline *batch = arg;
+    stage_stats mine;
+    batch_job *job;
+    FILE *input;
+    int curchar;
+    int i;
+    double start;
+
+    memset(&mine, 0, sizeof(mine));
+    while ((i = __sync_fetch_and_add(&batch->next_input, 1)) < batch->count) {
+        start = seconds_now();
+        trace_event("read", 'B', batch->inputs[i]);
+        job = g_malloc(sizeof(batch_job));
+        job->input = batch->inputs[i];
+        job->base = output_base(job->input);
+        job->text = g_string_new("");
+        job->out = NULL;
+        job->length = 0;
+        job->inventory = NULL;
+        if ((input = fopen(job->input, "r")) == NULL) {
+            perror(job->input);
+            exit(EXIT_FAILURE);
+        }
+        while ((curchar = fgetc(input)) != EOF)
+            g_string_append_c(job->text, curchar);
+        fclose(input);
+        trace_event("read", 'E', NULL);
+        mine.busy += seconds_now() - start;
+        mine.files++;
+        queue_put(&batch->to_convert, job, &mine.wait_out);
+    }
+    queue_done(&batch->to_convert);
+    stage_add(batch, STAGE_READ, &mine);
+    return NULL;
+}
+
+static void *batch_converter(void *arg) {
+    batch_pipeline *batch = arg;
+    stage_stats mine;
+    batch_job *job;
+    double start;
+
+    memset(&mine, 0, sizeof(mine));
+    while ((job = queue_get(&batch->to_convert, &mine.wait_in)) != NULL) {
+        start = seconds_now();
+        trace_event("convert", 'B', job->input);
+        markdown_set_document_path(job->input);
+        job->inventory = inventory_start();
+        job->out = markdown_to_string(job->text->str, extensions, batch->output_format);
+        markdown_set_inventory_hook(NULL, NULL);
+        if (job->out == NULL) {
+            fprintf(stderr, "%s: input is not valid UTF-8\n", job->input);
+            exit(EXIT_FAILURE);
+        }
+        job->length = strlen(job->out);
+        job->out = g_realloc(job->out, job->length + 2);
+        job->out[job->length++] = '\n';
+        job->out[job->length] = '\0';
+        g_string_free(job->text, true);
+        job->text = NULL;
+        trace_event("convert", 'E', NULL);
+        mine.busy += seconds_now() - start;
+        mine.files++;
+        queue_put(&batch->to_write, job, &mine.wait_out);
+    }
+    /* the parser buffers and include cache belong to this thread */
+    markdown_trim_parser_buffers();
+    markdown_set_document_path(NULL);
+    markdown_clear_include_cache();
+    queue_done(&batch->to_write);
+    stage_add(batch, STAGE_CONVERT, &mine);
+    return NULL;
+}
+
+/* finish_outputs - close 'count' output files, flushing them to disk
+   first if 'sync', and rename each into place, in order */
+static void finish_outputs(pending_output *outputs, int count, bool sync) {
+    int i;
+    for (i = 0; i < count; i++) {
+        if (sync)
+            fsync(outputs[i].fd);
+        close(outputs[i].fd);
+    }
+    for (i = 0; i < count; i++) {
+        if (rename(outputs[i].temp, outputs[i].path) != 0) {
+            perror(outputs[i].path);
+            exit(EXIT_FAILURE);
+        }
+        g_free(outputs[i].temp);
+        g_free(outputs[i].path);
+    }
+}
+
+/* write_output - write 'length' bytes of 'text' to 'fd' */
+static void write_output(int fd, const char *text, size_t length, const char *path) {
+    ssize_t written;
+    while (length > 0) {
+        if ((written = write(fd, text, length)) < 0) {
+            perror(path);
+            exit(EXIT_FAILURE);
+        }
+        text += written;
+        length -= written;
+    }
+}
+
+/* same_contents - whether the file at 'path' holds exactly 'text' */
+static bool same_contents(const char *path, const char *text, size_t length) {
+    struct stat status;
+    char buf[GZIP_CHUNK];
+    ssize_t got;
+    int fd;
+    bool same = true;
+
+    if (stat(path, &status) != 0 || status.st_size != (off_t)length)
+        return false;
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return false;
+    while (same && length > 0) {
+        if ((got = read(fd, buf, length < sizeof(buf) ? length : sizeof(buf))) <= 0)
+            same = false;
+        else if (memcmp(buf, text, got) != 0)
+            same = false;
+        else {
+            text += got;
+            length -= got;
+        }
+    }
+    close(fd);
+    return same;
+}
+
+/* open_output - create a temporary file beside 'path' to be renamed to
+   it by finish_outputs() */
+static void open_output(pending_output *output, const char *path) {
+    GString *temp = g_string_new("");
+    g_string_append_printf(temp, "%s.%d.tmp", path, (int)getpid());
+    if ((output->fd = open(temp->str, O_WRONLY | O_CREAT | O_TRUNC, 0666)) < 0) {
+        perror(temp->str);
+        exit(EXIT_FAILURE);
+    }
+    output->temp = temp->str;
+    output->path = g_strdup(path);
+    g_string_free(temp, false);
+}
+
+#ifdef MD_USE_ZLIB
+/* write_gzip - write 'text' to 'fd' in gzip format, compressing and
+   writing a chunk at a time */
+static void write_gzip(int fd, const char *text, size_t length, const char *path) {
+    z_stream stream;
+    unsigned char buf[GZIP_CHUNK];
+    size_t chunk;
+    int flush;
+    int status = Z_OK;
+
+    memset(&stream, 0, sizeof(stream));
+    /* 16 + 15: gzip header, largest window */
+    if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 16 + 15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        fprintf(stderr, "%s: cannot start compression\n", path);
+        exit(EXIT_FAILURE);
+    }
+    do {
+        chunk = length < GZIP_CHUNK ? length : GZIP_CHUNK;
+        stream.next_in = (unsigned char *)text;
+        stream.avail_in = chunk;
+        text += chunk;
+        length -= chunk;
+        flush = length == 0 ? Z_FINISH : Z_NO_FLUSH;
+        do {
+            stream.next_out = buf;
+            stream.avail_out = sizeof(buf);
+            status = deflate(&stream, flush);
+            if (status != Z_OK && status != Z_STREAM_END && status != Z_BUF_ERROR) {
+                fprintf(stderr, "%s: compression failed\n", path);
+                exit(EXIT_FAILURE);
+            }
+            write_output(fd, (char *)buf, sizeof(buf) - stream.avail_out, path);
+        } while (stream.avail_out == 0);
+    } while (flush != Z_FINISH);
+    if (status != Z_STREAM_END || deflateEnd(&stream) != Z_OK) {
+        fprintf(stderr, "%s: compression failed\n", path);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/* same_gzip_contents - whether the file at 'path' is a complete gzip
+   stream of exactly 'text' */
+static bool same_gzip_contents(const char *path, const char *text, size_t length) {
+    z_stream stream;
+    unsigned char in[GZIP_CHUNK];
+    unsigned char out[GZIP_CHUNK];
+    size_t produced;
+    ssize_t got;
+    int status = Z_OK;
+    int fd;
+    bool same = true;
+
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return false;
+    memset(&stream, 0, sizeof(stream));
+    if (inflateInit2(&stream, 16 + 15) != Z_OK) {
+        close(fd);
+        return false;
+    }
+    while (same && status != Z_STREAM_END) {
+        if ((got = read(fd, in, sizeof(in))) <= 0) {
+            same = false;
+            break;
+        }
+        stream.next_in = in;
+        stream.avail_in = got;
+        while (same && stream.avail_in > 0 && status != Z_STREAM_END) {
+            stream.next_out = out;
+            stream.avail_out = sizeof(out);
+            status = inflate(&stream, Z_NO_FLUSH);
+            if (status != Z_OK && status != Z_STREAM_END) {
+                same = false;
+                break;
+            }
+            produced = sizeof(out) - stream.avail_out;
+            if (produced > length || memcmp(out, text, produced) != 0)
+                same = false;
+            text += produced;
+            length -= produced;
+        }
+    }
+    /* nothing may follow the stream */
+    if (same && (length != 0 || stream.avail_in != 0 || read(fd, in, 1) != 0))
+        same = false;
+    inflateEnd(&stream);
+    close(fd);
+    return same;
+}
+#endif
+
+static void *batch_writer(void *arg) {
+    batch_pipeline *batch = arg;
+    stage_stats mine;
+    batch_job *job;
+    pending_output unsynced[2 * FSYNC_BATCH];
+    int pending = 0;
+    pending_output output;
+    bool write_html;
+    GString *file;
+    bool unchanged;
+    double start;
+
+    memset(&mine, 0, sizeof(mine));
+    while ((job = queue_get(&batch->to_write, &mine.wait_in)) != NULL) {
+        start = seconds_now();
+        trace_event("write", 'B', job->input);
+        inventory_write(job->inventory, job->base);
+        file = g_string_new(job->base);
+        g_string_append(file, (char *)output_extension(batch->output_format));
+
+        /* an output that would not change is left alone, and so is its
+           gzipped copy if that holds the same text */
+        unchanged = same_contents(file->str, job->out, job->length);
+        if (unchanged)
+            mine.unchanged++;
+        write_html = !unchanged;
+#ifdef MD_USE_ZLIB
+        if (batch->gzip) {
+            GString *gzipped = g_string_new("");
+            double compress_start;
+
+            g_string_append_printf(gzipped, "%s.gz", file->str);
+            compress_start = seconds_now();
+            if (!unchanged || !same_gzip_contents(gzipped->str, job->out, job->length)) {
+                trace_event("gzip", 'B', NULL);
+                open_output(&output, gzipped->str);
+                write_gzip(output.fd, job->out, job->length, output.temp);
+                /* renamed before the output itself, so a run stopped
+                   between the two leaves an output that will be redone */
+                unsynced[pending++] = output;
+                trace_event("gzip", 'E', NULL);
+                mine.compressed++;
+            }
+            mine.compress += seconds_now() - compress_start;
+            g_string_free(gzipped, true);
+        }
+#endif
+        if (write_html) {
+            open_output(&output, file->str);
+            write_output(output.fd, job->out, job->length, output.temp);
+            unsynced[pending++] = output;
+        }
+        if (!batch->fsync) {
+            finish_outputs(unsynced, pending, false);
+            pending = 0;
+        } else if (pending >= FSYNC_BATCH || queue_empty(&batch->to_write)) {
+            /* sync a batch at a time, or whatever is written when the
+               converters fall behind */
+            finish_outputs(unsynced, pending, true);
+            pending = 0;
+        }
+        g_string_free(file, true);
+        g_free(job->out);
+        g_free(job->base);
+        g_free(job);
+        trace_event("write", 'E', NULL);
+        mine.busy += seconds_now() - start;
+        mine.files++;
+    }
+    start = seconds_now();
+    finish_outputs(unsynced, pending, batch->fsync);
+    mine.busy += seconds_now() - start;
+    stage_add(batch, STAGE_WRITE, &mine);
+    return NULL;
+}
+
+/* print_stage_stats - how each stage spent the 'elapsed' seconds */
+static void print_stage_stats(const batch_pipeline *batch, double elapsed) {
+    const stage_stats *stage;
+    int i;
+
+    fprintf(stderr, "%-8s %7s %7s %9s %9s %9s %7s\n", "stage", "threads",
+        "files", "busy s", "starved s", "blocked s", "busy %");
+    for (i = 0; i < STAGE_COUNT; i++) {
+        stage = &batch->stats[i];
+        fprintf(stderr, "%-8s %7d %7ld %9.3f %9.3f %9.3f %6.1f%%\n",
+            stage_names[i], stage->threads, stage->files, stage->busy,
+            stage->wait_in, stage->wait_out,
+            elapsed > 0 ? 100 * stage->busy / (elapsed * stage->threads) : 0);
+    }
+    stage = &batch->stats[STAGE_WRITE];
+    if (batch->gzip)
+        fprintf(stderr, "%-8s %7d %7ld %9.3f %9s %9s %6.1f%%\n", "  gzip",
+            stage->threads, stage->compressed, stage->compress, "-", "-",
+            elapsed > 0 ? 100 * stage->compress / (elapsed * stage->threads) : 0);
+    fprintf(stderr, "%ld unchanged outputs not rewritten\n", stage->unchanged);
+    fprintf(stderr, "%.3f s elapsed\n", elapsed);
+}
+
+/* convert_batch - convert each of 'inputs' to a file beside it */
+static void convert_batch(char **inputs, int count, int output_format, int converters, bool fsync, bool gzip, bool stats) {
+    batch_pipeline batch;
+    pthread_t *threads;
+    int thread_count;
+    int i, t = 0;
+    double start = seconds_now();
+
+    if (converters < 1)
+        converters = 1;
+    memset(&batch, 0, sizeof(batch));
+    batch.inputs = inputs;
+    batch.count = count;
+    batch.output_format = output_format;
+    batch.fsync = fsync;
+    batch.gzip = gzip;
+    batch.stats[STAGE_READ].threads = BATCH_READERS;
+    batch.stats[STAGE_CONVERT].threads = converters;
+    batch.stats[STAGE_WRITE].threads = BATCH_WRITERS;
+    pthread_mutex_init(&batch.lock, NULL);
+    queue_init(&batch.to_convert, converters * BATCH_QUEUE_DEPTH, BATCH_READERS);
+    queue_init(&batch.to_write, converters * BATCH_QUEUE_DEPTH, converters);
+
+    thread_count = BATCH_READERS + converters + BATCH_WRITERS;
+    threads = g_malloc(thread_count * sizeof(pthread_t));
+    for (i = 0; i < BATCH_READERS; i++)
+        pthread_create(&threads[t++], NULL, batch_reader, &batch);
+    for (i = 0; i < converters; i++)
+        pthread_create(&threads[t++], NULL, batch_converter, &batch);
+    for (i = 0; i < BATCH_WRITERS; i++)
+        pthread_create(&threads[t++], NULL, batch_writer, &batch);
+    for (t = 0; t < thread_count; t++)
+        pthread_join(threads[t], NULL);
+
+    if (stats)
+        print_stage_stats(&batch, seconds_now() - start);
+    g_free(threads);
+    queue_free(&batch.to_convert);
+    queue_free(&batch.to_write);
+    pthread_mutex_destroy(&batch.lock);
+}
+
+/* read_template - compile the header or footer template in 'path' */
+static markdown_template *read_template(const char *path) {
+    GString *text = g_string_new("");
+    markdown_template *result;
+    FILE *input;
+    int curchar;
+
+    if ((input = fopen(path, "r")) == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    while ((curchar = fgetc(input)) != EOF)
+        g_string_append_c(text, curchar);
+    fclose(input);
+    result = markdown_template_create(text->str);
+    g_string_free(text, true);
+    return result;
+}
+
 /**********************************************************************
 
   The main program is just a wrapper around the library functions in
@@ -74,15 +826,44 @@ Application Options:\n\
   -c, --compatibility     markdown compatibility mode\n\
   -b, --batch             process multiple files automatically\n\
   -e, --extract           extract and display specified metadata\n\
+  --references=FILE       look up link references missing from a document\n\
+                          in FILE, which is parsed once for the whole run\n\
+  --bibliography=FILE     resolve citations missing from a document from\n\
+                          FILE, BibTeX or CSL-JSON, indexed once for the\n\
+                          whole run, or an index saved from one\n\
+  --save-bibliography=FILE  save the index of --bibliography in FILE, for\n\
+                          later runs to map rather than build, and exit\n\
+  --header=FILE           begin each output with FILE instead of the\n\
+                          format's own preamble; [%%key] in it is replaced\n\
+                          by the document's metadata value for key\n\
+  --footer=FILE           end each output with FILE likewise\n\
+  --invalid-utf8=ACTION   what to do with input that is not UTF-8:\n\
+                          pass (default), replace or reject\n\
+  --jsonl                 convert JSON Lines records from stdin, each like\n\
+                          {\"id\": ..., \"md\": \"...\", \"format\": \"html\"},\n\
+                          writing {\"id\": ..., \"output\": \"...\"} lines\n\
+  --jobs=N                convert batch files or JSON Lines records in\n\
+                          N threads (default: one per processor)\n\
+  --fsync                 in batch mode, sync output files to disk\n\
+  --gzip                  in batch mode, also write FILE.html.gz and so on\n\
+  --stats                 in batch mode, report how the reading, converting\n\
+                          and writing stages spent their time\n\
+  --trace=FILE            write a timeline of each conversion to FILE\n\
+                          in Chrome trace-event format\n\
+  --inventory=FORMAT      list the links, anchors, notes and citations of\n\
+                          each output file in FILE.links.FORMAT beside it;\n\
+                          FORMAT is tsv or json\n\
 \n\
 Syntax extensions\n\
   --smart --nosmart       toggle smart typography extension\n\
   --notes --nonotes       toggle notes extension\n\
   --process-html          process MultiMarkdown inside of raw HTML\n\
   --nolabels              do not generate id attributes for headers\n\
+  --transclude            replace lines of the form {{file}} with file\n\
 \n\
 Converts text in specified files (or stdin) from markdown to FORMAT.\n\
-Available FORMATs:  html, latex, memoir, beamer, odf, opml\n");
+Available FORMATs:  html, latex, memoir, beamer, odf, opml, stats\n\
+(stats counts words, headings, notes, tables, links and so on)\n");
 }
 
 int main(int argc, char * argv[]) {
@@ -97,8 +878,13 @@ int main(int argc, char * argv[]) {
     char *fake;
     FILE *input;
     FILE *output;
-    char curchar;
+    int curchar;
     char *progname = argv[0];
+    markdown_reference_index *references = NULL;
+    markdown_bibliography *bibliography = NULL;
+    markdown_template *header = NULL;
+    markdown_template *footer = NULL;
+    GString *inventory;
 
     int output_format = HTML_FORMAT;
 
@@ -119,6 +905,20 @@ int main(int argc, char * argv[]) {
     static gboolean opt_batchmode = FALSE;
     static gchar *opt_extract_meta = FALSE;
     static gboolean opt_no_labels = FALSE;
+    static gboolean opt_transclude = FALSE;
+    static gchar *opt_trace = 0;
+    static gchar *opt_invalid_utf8 = 0;
+    static gchar *opt_references = 0;
+    static gchar *opt_bibliography = 0;
+    static gchar *opt_save_bibliography = 0;
+    static gchar *opt_header = 0;
+    static gchar *opt_footer = 0;
+    static gchar *opt_inventory = 0;
+    static gboolean opt_jsonl = FALSE;
+    static gchar *opt_jobs = 0;
+    static gboolean opt_fsync = FALSE;
+    static gboolean opt_stats = FALSE;
+    static gboolean opt_gzip = FALSE;
 
 	static struct option entries[] =
 	{
@@ -138,6 +938,20 @@ int main(int argc, char * argv[]) {
       MD_ARGUMENT_FLAG( "nonotes", 0, 1, &opt_no_notes, "do not use notes extension", NULL ),
       MD_ARGUMENT_FLAG( "process-html", 0, 1, &opt_process_html, "process MultiMarkdown inside of raw HTML", NULL ),
       MD_ARGUMENT_FLAG( "nolabels", 0, 1, &opt_no_labels, "do not generate id attributes for headers", NULL ),
+      MD_ARGUMENT_FLAG( "transclude", 0, 1, &opt_transclude, "replace lines of the form {{file}} with file", NULL ),
+      MD_ARGUMENT_STRING( "references", 'R', &opt_references, "look up link references missing from a document in FILE", "FILE" ),
+      MD_ARGUMENT_STRING( "bibliography", 'B', &opt_bibliography, "resolve citations missing from a document from FILE", "FILE" ),
+      MD_ARGUMENT_STRING( "save-bibliography", 'S', &opt_save_bibliography, "save the index of --bibliography in FILE", "FILE" ),
+      MD_ARGUMENT_STRING( "header", 'H', &opt_header, "begin each output with FILE", "FILE" ),
+      MD_ARGUMENT_STRING( "footer", 'F', &opt_footer, "end each output with FILE", "FILE" ),
+      MD_ARGUMENT_STRING( "invalid-utf8", 'U', &opt_invalid_utf8, "what to do with input that is not UTF-8", "ACTION" ),
+      MD_ARGUMENT_STRING( "trace", 'T', &opt_trace, "write a timeline of each conversion to FILE", "FILE" ),
+      MD_ARGUMENT_FLAG( "jsonl", 0, 1, &opt_jsonl, "convert JSON Lines records from stdin", NULL ),
+      MD_ARGUMENT_STRING( "jobs", 'J', &opt_jobs, "convert in N threads", "N" ),
+      MD_ARGUMENT_FLAG( "fsync", 0, 1, &opt_fsync, "in batch mode, sync output files to disk", NULL ),
+      MD_ARGUMENT_FLAG( "gzip", 0, 1, &opt_gzip, "in batch mode, also write a gzipped copy of each output", NULL ),
+      MD_ARGUMENT_FLAG( "stats", 0, 1, &opt_stats, "in batch mode, report how each stage spent its time", NULL ),
+      MD_ARGUMENT_STRING( "inventory", 'I', &opt_inventory, "list links, anchors, notes and citations beside the output", "FORMAT" ),
       { NULL }
     };
 
@@ -172,6 +986,42 @@ int main(int argc, char * argv[]) {
 				opt_extract_meta = malloc(strlen(optarg) + 1);
 				strcpy(opt_extract_meta, optarg);
 				break;
+			case 'R':
+				opt_references = malloc(strlen(optarg) + 1);
+				strcpy(opt_references, optarg);
+				break;
+			case 'B':
+				opt_bibliography = malloc(strlen(optarg) + 1);
+				strcpy(opt_bibliography, optarg);
+				break;
+			case 'S':
+				opt_save_bibliography = malloc(strlen(optarg) + 1);
+				strcpy(opt_save_bibliography, optarg);
+				break;
+			case 'H':
+				opt_header = malloc(strlen(optarg) + 1);
+				strcpy(opt_header, optarg);
+				break;
+			case 'F':
+				opt_footer = malloc(strlen(optarg) + 1);
+				strcpy(opt_footer, optarg);
+				break;
+			case 'U':
+				opt_invalid_utf8 = malloc(strlen(optarg) + 1);
+				strcpy(opt_invalid_utf8, optarg);
+				break;
+			case 'T':
+				opt_trace = malloc(strlen(optarg) + 1);
+				strcpy(opt_trace, optarg);
+				break;
+			case 'I':
+				opt_inventory = malloc(strlen(optarg) + 1);
+				strcpy(opt_inventory, optarg);
+				break;
+			case 'J':
+				opt_jobs = malloc(strlen(optarg) + 1);
+				strcpy(opt_jobs, optarg);
+				break;
 		 }
 	}
 
@@ -208,6 +1058,8 @@ int main(int argc, char * argv[]) {
         extensions = extensions | EXT_FILTER_STYLES;
     if (opt_no_labels)
         extensions = extensions | EXT_NO_LABELS;
+    if (opt_transclude)
+        extensions = extensions | EXT_TRANSCLUDE;
 
     /* Compatibility mode turns off extensions and most 
         MultiMarkdown-specific features */
@@ -219,94 +1071,143 @@ int main(int argc, char * argv[]) {
 
     if (opt_to == NULL)
         output_format = HTML_FORMAT;
-    else if (strcmp(opt_to, "html") == 0)
-        output_format = HTML_FORMAT;
-    else if (strcmp(opt_to, "latex") == 0)
-        output_format = LATEX_FORMAT;
-    else if (strcmp(opt_to, "memoir") == 0)
-        output_format = MEMOIR_FORMAT;
-    else if (strcmp(opt_to, "beamer") == 0)
-        output_format = BEAMER_FORMAT;
-    else if (strcmp(opt_to, "opml") == 0)
-        output_format = OPML_FORMAT;
-    else if (strcmp(opt_to, "odf") == 0)
-        output_format = ODF_FORMAT;
-    else {
+    else if ((output_format = markdown_format_from_name(opt_to)) < 0) {
         fprintf(stderr, "%s: Unknown output format '%s'\n", progname, opt_to);
         exit(EXIT_FAILURE);
     }
 
+    if (opt_invalid_utf8 == NULL || strcmp(opt_invalid_utf8, "pass") == 0)
+        markdown_set_utf8_policy(UTF8_PASS);
+    else if (strcmp(opt_invalid_utf8, "replace") == 0)
+        markdown_set_utf8_policy(UTF8_REPLACE);
+    else if (strcmp(opt_invalid_utf8, "reject") == 0)
+        markdown_set_utf8_policy(UTF8_REJECT);
+    else {
+        fprintf(stderr, "%s: Unknown action '%s' for invalid UTF-8\n", progname, opt_invalid_utf8);
+        exit(EXIT_FAILURE);
+    }
+
     numargs = argc - 1;
 
-    if (opt_batchmode && numargs != 0) {
-        /* handle each file individually, and set output to filename with
-            appropriate extension */
-        
-           for (i = 0; i < numargs; i++) {
-                inputbuf = g_string_new("");   /* string for concatenated input */
-                /* Read file */
-                if ((input = fopen(argv[i+1], "r")) == NULL) {
-                    perror(argv[i+1]);
-                    exit(EXIT_FAILURE);
-                }
-                while ((curchar = fgetc(input)) != EOF)
-                    g_string_append_c(inputbuf, curchar);
-                fclose(input);
+    if (opt_inventory != NULL) {
+        if (strcmp(opt_inventory, "json") == 0)
+            inventory_json = true;
+        else if (strcmp(opt_inventory, "tsv") != 0) {
+            fprintf(stderr, "%s: Unknown inventory format '%s'\n", progname, opt_inventory);
+            exit(EXIT_FAILURE);
+        }
+        /* the inventory goes beside an output file, so there must be one */
+        if (!(opt_batchmode && numargs != 0) &&
+            (opt_output == NULL || strcmp(opt_output, "-") == 0)) {
+            fprintf(stderr, "%s: --inventory needs --output or --batch\n", progname);
+            exit(EXIT_FAILURE);
+        }
+        inventory_on = true;
+    }
 
-                /* Display metadata on request */
-                if (opt_extract_meta) {
-                    out = extract_metadata_value(inputbuf->str, extensions, opt_extract_meta);
-                    if (out != NULL) fprintf(stdout, "%s\n", out);
-                    return(EXIT_SUCCESS);
-                }
-                
-                /* remove file extension, if present */
-                fake = argv[i+1];
-                if (strrchr(fake, '.') != NULL) {
-                    int count = strrchr(fake,'.') - fake;
-                    if (count != 0) {
-                        fake[count] = '\0';
-                    }
-                }
+#ifndef MD_USE_ZLIB
+    if (opt_gzip) {
+        fprintf(stderr, "%s: --gzip needs a build with zlib\n", progname);
+        exit(EXIT_FAILURE);
+    }
+#endif
 
-                file = g_string_new(fake);
-                if (output_format == HTML_FORMAT) {
-                    g_string_append(file,".html");
-                } else if (output_format == OPML_FORMAT) {
-                    g_string_append(file,".opml");
-                } else if (output_format == ODF_FORMAT) {
-                    g_string_append(file,".fodt");
-                } else {
-                    g_string_append(file,".tex");
-                }
+    if (opt_trace)
+        trace_open(opt_trace);
 
-                /* open output file */
-                if (!(output = fopen(file->str, "w"))) {
-                    perror(opt_output);
-                    return 1;
-                }
-               
-                out = markdown_to_string(inputbuf->str, extensions, output_format);
-
-                fprintf(output, "%s\n", out);
-                fclose(output);
-                g_string_free(file,true);
-                free(out);
-                g_string_free(inputbuf, true);
-           }
-        
+    /* Shared references are parsed once and used for every file */
+    if (opt_references) {
+        inputbuf = g_string_new("");
+        if ((input = fopen(opt_references, "r")) == NULL) {
+            perror(opt_references);
+            exit(EXIT_FAILURE);
+        }
+        while ((curchar = fgetc(input)) != EOF)
+            g_string_append_c(inputbuf, curchar);
+        fclose(input);
+        references = markdown_reference_index_create(inputbuf->str, extensions);
+        if (references == NULL) {
+            fprintf(stderr, "%s: input is not valid UTF-8\n", opt_references);
+            exit(EXIT_FAILURE);
+        }
+        markdown_set_reference_index(references);
+        g_string_free(inputbuf, true);
+    }
+
+    /* So is the bibliography, or its saved index mapped */
+    if (opt_save_bibliography && !opt_bibliography) {
+        fprintf(stderr, "%s: --save-bibliography needs --bibliography\n", progname);
+        exit(EXIT_FAILURE);
+    }
+    if (opt_bibliography) {
+        if ((bibliography = markdown_bibliography_load(opt_bibliography)) == NULL) {
+            if (errno != 0)
+                perror(opt_bibliography);
+            else
+                fprintf(stderr, "%s: not a BibTeX or CSL-JSON bibliography, or an index of one\n", opt_bibliography);
+            exit(EXIT_FAILURE);
+        }
+        if (opt_save_bibliography) {
+            if (!markdown_bibliography_save(bibliography, opt_save_bibliography)) {
+                perror(opt_save_bibliography);
+                exit(EXIT_FAILURE);
+            }
+            markdown_bibliography_destroy(bibliography);
+            return EXIT_SUCCESS;
+        }
+        markdown_set_bibliography(bibliography);
+    }
+
+    /* Templates are compiled once and used for every file */
+    if (opt_header)
+        header = read_template(opt_header);
+    if (opt_footer)
+        footer = read_template(opt_footer);
+    markdown_set_templates(header, footer);
+
+    if (opt_jsonl) {
+        long failures;
+
+        /* we allow "-" as a synonym for stdout here */
+        if (opt_output == NULL || strcmp(opt_output, "-") == 0)
+            output = stdout;
+        else if (!(output = fopen(opt_output, "w"))) {
+            perror(opt_output);
+            return 1;
+        }
+        i = opt_jobs ? atoi(opt_jobs) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+        failures = convert_json_lines(stdin, output, extensions, output_format, i);
+        fclose(output);
+        if (failures != 0)
+            fprintf(stderr, "%s: %ld records could not be converted\n", progname, failures);
+        trace_close();
+        markdown_reference_index_destroy(references);
+        markdown_bibliography_destroy(bibliography);
+        markdown_template_destroy(header);
+        markdown_template_destroy(footer);
+        return(failures ? EXIT_FAILURE : EXIT_SUCCESS);
+    }
+
+    if (opt_batchmode && numargs != 0 && !opt_extract_meta) {
+        /* handle each file individually, and set output to filename with
+            appropriate extension */
+        convert_batch(argv + 1, numargs, output_format,
+            opt_jobs ? atoi(opt_jobs) : (int)sysconf(_SC_NPROCESSORS_ONLN),
+            opt_fsync, opt_gzip, opt_stats);
     } else {
         /* Read input from stdin or input files into inputbuf */
 
+        trace_event("file", 'B', numargs == 0 ? "-" : argv[1]);
         inputbuf = g_string_new("");   /* string for concatenated input */
 
+        trace_event("read", 'B', NULL);
         if (numargs == 0) {        /* use stdin if no files specified */
             while ((curchar = fgetc(stdin)) != EOF)
                 g_string_append_c(inputbuf, curchar);
             fclose(stdin);
         }
         else {                  /* open all the files on command line */
-           for (i = 0; i < numargs; i++) {
+           for (i = 0; i < (opt_batchmode ? 1 : numargs); i++) {
                 if ((input = fopen(argv[i+1], "r")) == NULL) {
                     perror(argv[i+1]);
                     exit(EXIT_FAILURE);
@@ -316,14 +1217,34 @@ int main(int argc, char * argv[]) {
                 fclose(input);
            }
         }
+        trace_event("read", 'E', NULL);
 
-        /* Display metadata on request */
+        /* Display metadata on request (in batch mode, for the first file) */
         if (opt_extract_meta) {
             out = extract_metadata_value(inputbuf->str, extensions, opt_extract_meta);
             if (out != NULL) fprintf(stdout, "%s\n", out);
+            trace_event("file", 'E', NULL);
+            trace_close();
             return(EXIT_SUCCESS);
         }
         
+        markdown_set_document_path(numargs == 0 ? NULL : argv[1]);
+        inventory = inventory_start();
+        out = markdown_to_string(inputbuf->str, extensions, output_format);
+        if (out == NULL) {
+            fprintf(stderr, "%s: input is not valid UTF-8\n", progname);
+            exit(EXIT_FAILURE);
+        }
+
+        /* the inventory is named after the output, less its extension */
+        if (inventory != NULL) {
+            file = g_string_new(opt_output);
+            if ((fake = strrchr(file->str, '.')) != NULL && fake != file->str && strchr(fake, '/') == NULL)
+                *fake = '\0';
+            inventory_write(inventory, file->str);
+            g_string_free(file, true);
+        }
+
        /* we allow "-" as a synonym for stdout here */
         if (opt_output == NULL || strcmp(opt_output, "-") == 0)
             output = stdout;
@@ -332,13 +1253,22 @@ int main(int argc, char * argv[]) {
             return 1;
         }
 
-        out = markdown_to_string(inputbuf->str, extensions, output_format);
+        trace_event("write", 'B', NULL);
         fprintf(output, "%s\n", out);
-        free(out);
+        g_free(out);
         fclose(output);
+        trace_event("write", 'E', NULL);
         g_string_free(inputbuf, true);
+        trace_event("file", 'E', NULL);
         
     }
 
+    trace_close();
+    markdown_reference_index_destroy(references);
+    markdown_bibliography_destroy(bibliography);
+    markdown_template_destroy(header);
+    markdown_template_destroy(footer);
+    markdown_clear_include_cache();
+
     return(EXIT_SUCCESS);
 }
@@ -19,41 +19,530 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 #include "markdown_peg.h"
 
 #define TABSTOP 4
 
-/* preformat_text - allocate and copy text buffer while
- * performing tab expansion. */
+/* The parser's buffers grow to fit the largest input seen and are kept
+ * between runs.  After a conversion whose input is more than trim_factor
+ * times the median of the last TRIM_HISTORY inputs they are trimmed, so
+ * one outsized document does not pin that memory for good. */
+#define TRIM_HISTORY 16
+
+static int trim_factor = 8;
+static int utf8_policy = UTF8_PASS;
+static MD_THREAD_LOCAL size_t recent_sizes[TRIM_HISTORY];
+static MD_THREAD_LOCAL int recent_count = 0;
+static MD_THREAD_LOCAL int recent_next = 0;
+static MD_THREAD_LOCAL unsigned long trim_count = 0;
+
+/* Transclusion.  A line holding only {{path}} is replaced by the contents
+ * of that file, resolved relative to the file that includes it.  Files
+ * are cached per thread and read again only when their size or
+ * modification time changes, so a fragment shared by many documents in a
+ * run is read once. */
+#define MAX_INCLUDE_DEPTH 16
+
+typedef struct included_file {
+    char *path;
+    time_t mtime;
+    off_t size;
+    GString *text;
+    struct included_file *next;
+} included_file;
+
+/* The chain of files being included, to refuse cycles */
+typedef struct include_frame {
+    const char *path;
+    const struct include_frame *up;
+} include_frame;
+
+/* Inventory hook, per thread since what it collects is per document */
+static MD_THREAD_LOCAL markdown_inventory_hook inventory_hook = NULL;
+static MD_THREAD_LOCAL void *inventory_user = NULL;
+
+static const struct {
+    const char *name;
+    int format;
+} format_names[] = {
+    { "html",    HTML_FORMAT },
+    { "latex",   LATEX_FORMAT },
+    { "memoir",  MEMOIR_FORMAT },
+    { "beamer",  BEAMER_FORMAT },
+    { "opml",    OPML_FORMAT },
+    { "odf",     ODF_FORMAT },
+    { "stats",   STATS_FORMAT },
+    { NULL,      0 }
+};
+
+static const char *inventory_kind_names[INVENTORY_COUNT] = {
+    "link",
+    "image",
+    "reference",
+    "anchor",
+    "note",
+    "noteref",
+    "glossary",
+    "citation"
+};
+
+static MD_THREAD_LOCAL included_file *include_cache = NULL;
+static MD_THREAD_LOCAL char *document_path = NULL;
+
+/* Allocator the calling thread's parser buffers and include cache were
+ * made with, so they can be handed back to it after a switch */
+static MD_THREAD_LOCAL markdown_allocator buffers_allocator;
+static MD_THREAD_LOCAL bool buffers_allocator_set = false;
+
+/* Trace hook; a single test of trace_hook when tracing is off */
+static markdown_trace_hook trace_hook = NULL;
+static void *trace_user = NULL;
+
+#define TRACE_BEGIN(phase)  if (trace_hook) trace_hook(phase, 1, trace_user)
+#define TRACE_END(phase)    if (trace_hook) trace_hook(phase, 0, trace_user)
+
+static const char *phase_names[PHASE_COUNT] = {
+    "preformat",
+    "parse references",
+    "parse notes",
+    "parse labels",
+    "parse document",
+    "parse raw blocks",
+    "render"
+};
+
+/* utf8_length - length of the well-formed UTF-8 sequence at 's', or 0.
+ * Overlong forms, surrogates and code points past U+10FFFF are rejected.
+ * A NUL ends the check early, so 's' need only be NUL-terminated. */
+static int utf8_length(const unsigned char *s) {
+    unsigned char c = s[0];
+
+    if (c < 0x80)
+        return 1;
+    if (c < 0xC2 || c > 0xF4 || (s[1] & 0xC0) != 0x80)
+        return 0;
+    if (c < 0xE0)
+        return 2;
+    if ((c == 0xE0 && s[1] < 0xA0) || (c == 0xED && s[1] > 0x9F) ||
+        (c == 0xF0 && s[1] < 0x90) || (c == 0xF4 && s[1] > 0x8F) ||
+        (s[2] & 0xC0) != 0x80)
+        return 0;
+    if (c < 0xF0)
+        return 3;
+    return (s[3] & 0xC0) == 0x80 ? 4 : 0;
+}
+
+/* preformat_text - allocate and copy text buffer while performing tab
+ * expansion, turning CRLF and CR line endings into LF, and checking that
+ * the text is UTF-8.  Bytes that are not are handled according to
+ * utf8_policy; returns NULL if they are rejected. */
 static GString *preformat_text(char *text) {
     GString *buf;
-    char next_char;
+    const unsigned char *s = (const unsigned char *)text;
+    size_t len = strlen(text);
+    size_t i = 0;
+    size_t run;
     int charstotab;
 
-    int len = 0;
-
     buf = g_string_new("");
 
     charstotab = TABSTOP;
-    while ((next_char = *text++) != '\0') {
-        switch (next_char) {
+    while (i < len) {
+        /* Runs of plain text are copied whole; columns only matter for
+           where the next tab stop falls */
+        if ((run = plain_run(s + i, len - i)) > 0) {
+            g_string_append_len(buf, text + i, run);
+            charstotab = TABSTOP - (TABSTOP - charstotab + run) % TABSTOP;
+            i += run;
+            continue;
+        }
+        if (s[i] >= 0x80) {
+            if ((run = utf8_length(s + i)) == 0) {
+                if (utf8_policy == UTF8_REJECT) {
+                    g_string_free(buf, TRUE);
+                    return NULL;
+                }
+                if (utf8_policy == UTF8_REPLACE) {
+                    g_string_append(buf, "\357\277\275");   /* U+FFFD */
+                    charstotab = TABSTOP - (TABSTOP - charstotab + 3) % TABSTOP;
+                    i++;
+                    continue;
+                }
+                run = 1;
+            }
+            g_string_append_len(buf, text + i, run);
+            charstotab = TABSTOP - (TABSTOP - charstotab + run) % TABSTOP;
+            i += run;
+            continue;
+        }
+        switch (s[i]) {
         case '\t':
             while (charstotab > 0)
-                g_string_append_c(buf, ' '), len++, charstotab--;
+                g_string_append_c(buf, ' '), charstotab--;
             break;
+        case '\r':
+            if (s[i + 1] == '\n')
+                i++;
+            /* fall through */
         case '\n':
-            g_string_append_c(buf, '\n'), len++, charstotab = TABSTOP;
+            g_string_append_c(buf, '\n'), charstotab = TABSTOP;
             break;
         default:
-            g_string_append_c(buf, next_char), len++, charstotab--;
+            g_string_append_c(buf, s[i]), charstotab--;
         }
         if (charstotab == 0)
             charstotab = TABSTOP;
+        i++;
     }
     g_string_append(buf, "\n\n");
     return(buf);
 }
 
+/* cached_include - contents of the file at 'path', from the cache if it
+ * has not changed since it was read.  Returns NULL if it cannot be read. */
+static GString *cached_include(const char *path) {
+    included_file *f;
+    struct stat st;
+    FILE *input;
+    char buf[4096];
+    size_t n;
+
+    if (stat(path, &st) != 0)
+        return NULL;
+    for (f = include_cache; f != NULL; f = f->next)
+        if (strcmp(f->path, path) == 0)
+            break;
+    if (f != NULL && f->mtime == st.st_mtime && f->size == st.st_size)
+        return f->text;
+
+    if ((input = fopen(path, "r")) == NULL)
+        return NULL;
+    if (f == NULL) {
+        f = g_malloc(sizeof(included_file));
+        f->path = g_strdup(path);
+        f->text = g_string_new("");
+        f->next = include_cache;
+        include_cache = f;
+    } else {
+        f->text->currentStringLength = 0;
+        f->text->str[0] = '\0';
+    }
+    while ((n = fread(buf, 1, sizeof(buf), input)) > 0)
+        g_string_append_len(f->text, buf, n);
+    fclose(input);
+    f->mtime = st.st_mtime;
+    f->size = st.st_size;
+    return f->text;
+}
+
+/* include_target - if the line at 'line' is an include, {{path}} with at
+ * most three spaces before it and only spaces after, return the length
+ * of the path and point *path at it; otherwise return 0. */
+static size_t include_target(const char *line, const char **path) {
+    const char *p = line;
+    const char *end;
+    int indent;
+
+    for (indent = 0; *p == ' ' && indent < 3; indent++)
+        p++;
+    if (p[0] != '{' || p[1] != '{')
+        return 0;
+    *path = p += 2;
+    while (*p != '\0' && *p != '\n' && *p != '\r' && *p != '}')
+        p++;
+    if (p == *path || p[0] != '}' || p[1] != '}')
+        return 0;
+    end = p;
+    for (p += 2; *p == ' ' || *p == '\t'; p++)
+        ;
+    if (*p != '\0' && *p != '\n' && *p != '\r')
+        return 0;
+    return end - *path;
+}
+
+/* transclude - append 'text' to 'out', replacing includes with the
+ * contents of the files they name.  'chain' lists the files 'text' is
+ * nested in, innermost first; includes resolve against its first path
+ * (or the current directory if there is none).  An include that cannot be
+ * read, that includes itself, or that nests too deeply, is left as is. */
+static void transclude(GString *out, const char *text, const include_frame *chain, int depth) {
+    const char *line = text;
+    const char *base = chain ? chain->path : NULL;
+    const char *eol;
+    const char *target;
+    const char *slash;
+    const include_frame *up;
+    include_frame frame;
+    size_t len;
+    GString *path;
+    GString *contents;
+
+    while (*line != '\0') {
+        if ((eol = strchr(line, '\n')) != NULL)
+            eol++;
+        else
+            eol = line + strlen(line);
+        if (depth < MAX_INCLUDE_DEPTH && (len = include_target(line, &target)) > 0) {
+            path = g_string_new("");
+            if (target[0] != '/' && base != NULL && (slash = strrchr(base, '/')) != NULL)
+                g_string_append_len(path, base, slash - base + 1);
+            g_string_append_len(path, target, len);
+            for (up = chain; up != NULL; up = up->up)
+                if (strcmp(up->path, path->str) == 0)
+                    break;
+            if (up == NULL && (contents = cached_include(path->str)) != NULL) {
+                frame.path = path->str;
+                frame.up = chain;
+                transclude(out, contents->str, &frame, depth + 1);
+                if (out->currentStringLength > 0 && out->str[out->currentStringLength - 1] != '\n')
+                    g_string_append_c(out, '\n');
+                g_string_free(path, TRUE);
+                line = eol;
+                continue;
+            }
+            g_string_free(path, TRUE);
+        }
+        g_string_append_len(out, line, eol - line);
+        line = eol;
+    }
+}
+
+/* Line numbers for positions in the text being converted */
+typedef struct {
+    int *starts;            /* offset of the start of each line */
+    int count;
+} line_table;
+
+static void make_line_table(line_table *lines, const char *text) {
+    const char *c;
+    int size = 64;
+    lines->starts = g_malloc(size * sizeof(int));
+    lines->starts[0] = 0;
+    lines->count = 1;
+    for (c = text; *c != '\0'; c++) {
+        if (*c != '\n')
+            continue;
+        if (lines->count == size) {
+            size *= 2;
+            lines->starts = g_realloc(lines->starts, size * sizeof(int));
+        }
+        lines->starts[lines->count++] = c - text + 1;
+    }
+}
+
+/* line_number - 1-based line holding offset 'pos' */
+static int line_number(const line_table *lines, int pos) {
+    int lo = 0;
+    int hi = lines->count - 1;
+    int mid;
+    while (lo < hi) {
+        mid = (lo + hi + 1) / 2;
+        if (lines->starts[mid] <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo + 1;
+}
+
+/* note_id - the id of the note in 'notes' whose body is 'body' */
+static const char *note_id(element *notes, element *body) {
+    for (; notes != NULL; notes = notes->next)
+        if (notes->children == body)
+            return notes->contents.str;
+    return NULL;
+}
+
+/* citation_key - key of a citation, whose text is "[#key]" when the
+ * document does not define it; returned in 'key', which is reset */
+static const char *citation_key(GString *key, const char *text) {
+    key->currentStringLength = 0;
+    key->str[0] = '\0';
+    if (strncmp(text, "[#", 2) == 0) {
+        g_string_append_len(key, text + 2, strlen(text) - 2);
+        if (key->currentStringLength > 0 && key->str[key->currentStringLength - 1] == ']')
+            key->str[--key->currentStringLength] = '\0';
+        return key->str;
+    }
+    return text;
+}
+
+/* inventory_elements - report the links, images and note and citation
+ * references in 'list'.  The document has its own copy of each note, so
+ * the bodies that references borrow from the notes list are skipped. */
+static void inventory_elements(element *list, element *notes, const line_table *lines, GString *key) {
+    const char *id;
+    for (; list != NULL; list = list->next) {
+        switch (list->key) {
+        case LINK:
+            inventory_hook(INVENTORY_LINK, list->contents.link->identifier,
+                list->contents.link->url, line_number(lines, list->pos), inventory_user);
+            inventory_elements(list->contents.link->label, notes, lines, key);
+            continue;
+        case IMAGE:
+        case IMAGEBLOCK:
+            inventory_hook(INVENTORY_IMAGE, list->contents.link->identifier,
+                list->contents.link->url, line_number(lines, list->pos), inventory_user);
+            continue;
+        case NOTE:
+            if (list->contents.str == NULL && (id = note_id(notes, list->children)) != NULL) {
+                inventory_hook(INVENTORY_NOTE_REF, id, NULL, line_number(lines, list->pos), inventory_user);
+                continue;
+            }
+            break;
+        case CITATION:
+        case NOCITATION:
+            inventory_hook(INVENTORY_CITATION, citation_key(key, list->contents.str), NULL,
+                line_number(lines, list->pos), inventory_user);
+            if (list->children != NULL && list->children->key == LOCATOR)
+                inventory_elements(list->children->children, notes, lines, key);
+            continue;
+        default:
+            break;
+        }
+        inventory_elements(list->children, notes, lines, key);
+    }
+}
+
+/* inventory - report everything in a parsed document that can be linked
+ * to or from, to the inventory hook */
+static void inventory(const char *text, element *result, element *references, element *notes, element *labels) {
+    line_table lines;
+    GString *key = g_string_new("");
+    element *cur;
+
+    make_line_table(&lines, text);
+    for (cur = references; cur != NULL; cur = cur->next)
+        inventory_hook(INVENTORY_REFERENCE, cur->contents.link->identifier,
+            cur->contents.link->url, line_number(&lines, cur->pos), inventory_user);
+    for (cur = labels; cur != NULL; cur = cur->next)
+        inventory_hook(INVENTORY_ANCHOR, cur->contents.str, NULL,
+            line_number(&lines, cur->pos), inventory_user);
+    for (cur = notes; cur != NULL; cur = cur->next)
+        inventory_hook(cur->key == GLOSSARY ? INVENTORY_GLOSSARY : INVENTORY_NOTE,
+            cur->contents.str, NULL, line_number(&lines, cur->pos), inventory_user);
+    inventory_elements(result, notes, &lines, key);
+    g_free(lines.starts);
+    g_string_free(key, TRUE);
+}
+
+/* Words per minute for markdown_stats.reading_minutes */
+#define READING_SPEED 200
+
+/* count_text - add the words and characters of 's' to 'stats'.
+ * 'in_word' carries over from text before it, which may end mid-word. */
+static void count_text(markdown_stats *stats, const char *s, bool *in_word) {
+    for (; *s != '\0'; s++) {
+        if (((unsigned char)*s & 0xC0) != 0x80)
+            stats->characters++;
+        if (*s == ' ' || *s == '\n' || *s == '\t') {
+            *in_word = false;
+        } else if (!*in_word) {
+            stats->words++;
+            *in_word = true;
+        }
+    }
+}
+
+/* count_elements - add what is in 'list' to 'stats'.  As for the
+ * inventory, bodies borrowed from the notes list are not counted twice. */
+static void count_elements(markdown_stats *stats, element *list, element *notes, bool *in_word) {
+    for (; list != NULL; list = list->next) {
+        switch (list->key) {
+        case STR:
+        case CODE:
+            count_text(stats, list->contents.str, in_word);
+            continue;
+        case SPACE:
+        case LINEBREAK:
+        case ELLIPSIS:
+        case EMDASH:
+        case ENDASH:
+            stats->characters++;
+            *in_word = false;
+            continue;
+        case APOSTROPHE:
+            stats->characters++;
+            continue;
+        case LIST:
+        case EMPH:
+        case STRONG:
+        case SINGLEQUOTED:
+        case DOUBLEQUOTED:
+            count_elements(stats, list->children, notes, in_word);
+            continue;
+        case LINK:
+            stats->links++;
+            count_elements(stats, list->contents.link->label, notes, in_word);
+            continue;
+        case IMAGE:
+        case IMAGEBLOCK:
+            stats->images++;
+            continue;
+        case NOTE:
+            if (list->contents.str == NULL) {
+                stats->footnotes++;
+                if (note_id(notes, list->children) != NULL)
+                    continue;
+            }
+            break;
+        case CITATION:
+        case NOCITATION:
+            stats->citations++;
+            continue;
+        case H1: case H2: case H3: case H4: case H5: case H6:
+            stats->headings++;
+            break;
+        case TABLE:
+            stats->tables++;
+            break;
+        case VERBATIM:
+            stats->code_blocks++;
+            continue;
+        case RAW:
+        case HTML:
+        case HTMLBLOCK:
+        case REFERENCE:
+        case METADATA:
+        case NOTELABEL:
+        case TABLELABEL:
+        case TABLESEPARATOR:
+        case AUTOLABEL:
+        case ATTRIBUTE:
+        case GLOSSARYSORTKEY:
+        case MATHSPAN:
+            continue;
+        default:
+            break;
+        }
+        /* blocks start and end words */
+        *in_word = false;
+        count_elements(stats, list->children, notes, in_word);
+        *in_word = false;
+    }
+}
+
+/* print_stats - print 'stats' as MultiMarkdown metadata */
+static void print_stats(GString *out, const markdown_stats *stats) {
+    g_string_append_printf(out,
+        "Words: %ld\n"
+        "Characters: %ld\n"
+        "Reading Minutes: %ld\n"
+        "Headings: %d\n"
+        "Footnotes: %d\n"
+        "Citations: %d\n"
+        "Tables: %d\n"
+        "Code Blocks: %d\n"
+        "Links: %d\n"
+        "Images: %d",
+        stats->words, stats->characters, stats->reading_minutes,
+        stats->headings, stats->footnotes, stats->citations, stats->tables,
+        stats->code_blocks, stats->links, stats->images);
+}
+
 /* print_tree - print tree of elements, for debugging only. */
 static void print_tree(element * elt, int indent) {
     int i;
@@ -114,25 +603,34 @@ static void print_tree(element * elt, int indent) {
  * of parent elements.  The result should be a tree of elements without any RAWs. */
 static element * process_raw_blocks(element *input, int extensions, element *references, element *notes, element *labels) {
     element *current = NULL;
-    element *last_child = NULL;
+    element **tail;
     char *contents;
+    char *end;
+    size_t length;
     current = input;
 
     while (current != NULL) {
         if (current->key == RAW) {
             /* \001 is used to indicate boundaries between nested lists when there
-             * is no blank line.  We split the string by \001 and parse
-             * each chunk separately. */
-            contents = strtok(current->contents.str, "\001");
+             * is no blank line.  Each non-empty chunk between them is parsed
+             * in place, by offset, and its elements appended at the tail. */
             current->key = LIST;
-            current->children = parse_markdown(contents, extensions, references, notes, labels);
-            last_child = current->children;
-            while ((contents = strtok(NULL, "\001"))) {
-                while (last_child->next != NULL)
-                    last_child = last_child->next;
-                last_child->next = parse_markdown(contents, extensions, references, notes, labels);
+            current->children = NULL;
+            tail = &current->children;
+            set_raw_block_pos(current->pos);
+            for (contents = current->contents.str; contents != NULL; contents = end) {
+                if ((end = strchr(contents, '\001')) != NULL)
+                    length = end++ - contents;
+                else
+                    length = strlen(contents);
+                if (length == 0)
+                    continue;
+                *tail = parse_markdown_range(contents, length, extensions, references, notes, labels);
+                while (*tail != NULL)
+                    tail = &(*tail)->next;
             }
-            free(current->contents.str);
+            set_raw_block_pos(-1);
+            g_free(current->contents.str);
             current->contents.str = NULL;
         }
         if (current->children != NULL)
@@ -142,56 +640,282 @@ static element * process_raw_blocks(element *input, int extensions, element *ref
     return input;
 }
 
-/* markdown_to_gstring - convert markdown text to the output format specified.
- * Returns a GString, which must be freed after use using g_string_free(). */
-GString * markdown_to_g_string(char *text, int extensions, int output_format) {
+static bool same_allocator(const markdown_allocator *a, const markdown_allocator *b) {
+    return a->alloc == b->alloc && a->realloc == b->realloc &&
+        a->free == b->free && a->user == b->user;
+}
+
+/* free_include_cache - free the calling thread's included files and
+ * document path. */
+static void free_include_cache(void) {
+    included_file *f;
+    while ((f = include_cache) != NULL) {
+        include_cache = f->next;
+        g_free(f->path);
+        g_string_free(f->text, TRUE);
+        g_free(f);
+    }
+    g_free(document_path);
+    document_path = NULL;
+}
+
+/* own_thread_buffers - see that the calling thread's parser buffers and
+ * include cache belong to its current allocator.  If they were made with
+ * another, they are handed back to it (the document path is kept). */
+static void own_thread_buffers(void) {
+    markdown_allocator current;
+    char *path;
+
+    g_mem_get_allocator(&current);
+    if (buffers_allocator_set && !same_allocator(&current, &buffers_allocator)) {
+        path = document_path ? g_strdup(document_path) : NULL;
+        g_mem_set_allocator(&buffers_allocator);
+        release_parser_buffers();
+        free_include_cache();
+        g_mem_set_allocator(&current);
+        document_path = path;
+    }
+    buffers_allocator = current;
+    buffers_allocator_set = true;
+}
+
+/* markdown_set_allocator - route the calling thread's further allocations
+ * through 'allocator'; NULL restores malloc/realloc/free.  Other threads
+ * keep their own.  Anything a conversion returns must be released with
+ * the allocator that was active for it. */
+void markdown_set_allocator(const markdown_allocator *allocator) {
+    g_mem_set_allocator(allocator);
+    own_thread_buffers();
+}
+
+/* markdown_set_trace_hook - call 'hook' at the start and end of each phase
+ * of every conversion; NULL turns tracing off. */
+void markdown_set_trace_hook(markdown_trace_hook hook, void *user) {
+    trace_hook = hook;
+    trace_user = user;
+}
+
+/* markdown_format_from_name - the output format called 'name' on the
+ * command line, or -1 if there is none. */
+int markdown_format_from_name(const char *name) {
+    int i;
+    for (i = 0; format_names[i].name != NULL; i++)
+        if (strcmp(name, format_names[i].name) == 0)
+            return format_names[i].format;
+    return -1;
+}
+
+/* markdown_phase_name - printable name of a conversion phase. */
+const char * markdown_phase_name(int phase) {
+    if (phase < 0 || phase >= PHASE_COUNT)
+        return "unknown";
+    return phase_names[phase];
+}
+
+/* markdown_set_utf8_policy - choose what conversions do with input that
+ * is not valid UTF-8 (see enum markdown_utf8_policies). */
+void markdown_set_utf8_policy(int policy) {
+    utf8_policy = policy;
+}
+
+/* markdown_set_inventory_hook - call 'hook' for every link, image,
+ * reference definition, anchor, note and citation in each document the
+ * calling thread converts; NULL turns this off. */
+void markdown_set_inventory_hook(markdown_inventory_hook hook, void *user) {
+    inventory_hook = hook;
+    inventory_user = user;
+}
+
+/* markdown_inventory_kind_name - printable name of an inventory kind. */
+const char * markdown_inventory_kind_name(int kind) {
+    if (kind < 0 || kind >= INVENTORY_COUNT)
+        return "unknown";
+    return inventory_kind_names[kind];
+}
+
+/* markdown_set_document_path - path of the file the calling thread's next
+ * conversions come from, against which includes are resolved; NULL means
+ * the current directory. */
+void markdown_set_document_path(const char *path) {
+    own_thread_buffers();
+    g_free(document_path);
+    document_path = path ? g_strdup(path) : NULL;
+}
+
+/* markdown_clear_include_cache - free the calling thread's cache of
+ * included files, and its document path. */
+void markdown_clear_include_cache(void) {
+    own_thread_buffers();
+    free_include_cache();
+}
+
+/* markdown_set_trim_factor - trim the parser buffers after any conversion
+ * larger than 'factor' times the recent median size.  0 disables. */
+void markdown_set_trim_factor(int factor) {
+    trim_factor = factor;
+}
+
+/* markdown_trim_parser_buffers - release the parser buffers now; they are
+ * allocated again, at their initial size, on the next conversion. */
+void markdown_trim_parser_buffers(void) {
+    own_thread_buffers();
+    release_parser_buffers();
+    trim_count++;
+}
+
+/* markdown_parser_buffer_sizes - fill in the current buffer capacities. */
+void markdown_parser_buffer_sizes(markdown_parser_buffers *sizes) {
+    parser_buffer_sizes(sizes);
+    sizes->trims = trim_count;
+}
+
+/* median_recent_size - median of the recorded input sizes (0 if none). */
+static size_t median_recent_size(void) {
+    size_t sorted[TRIM_HISTORY];
+    size_t key;
+    int i, j;
+
+    for (i = 0; i < recent_count; i++) {
+        key = recent_sizes[i];
+        for (j = i; j > 0 && sorted[j - 1] > key; j--)
+            sorted[j] = sorted[j - 1];
+        sorted[j] = key;
+    }
+    return recent_count ? sorted[recent_count / 2] : 0;
+}
+
+/* note_input_size - apply the trim policy to a finished conversion of
+ * 'size' bytes, then record it. */
+static void note_input_size(size_t size) {
+    size_t median = median_recent_size();
+
+    if (trim_factor > 0 && median > 0 && size > median * trim_factor)
+        markdown_trim_parser_buffers();
+
+    recent_sizes[recent_next] = size;
+    recent_next = (recent_next + 1) % TRIM_HISTORY;
+    if (recent_count < TRIM_HISTORY)
+        recent_count++;
+}
+
+/* convert - append the conversion of 'text' to 'out'.  Returns FALSE,
+ * leaving 'out' untouched, if the text is rejected as invalid UTF-8.
+ * Given 'stats', fills it in and renders nothing; 'out' may be NULL. */
+static bool convert(GString *out, char *text, int extensions, int output_format, markdown_stats *stats) {
+    markdown_stats counted;
+    bool in_word = false;
     element *result;
-    element *references;
-    element *notes;
-    element *labels;
+    element *references = NULL;
+    element *notes = NULL;
+    element *labels = NULL;
     GString *formatted_text;
-    GString *out;
-    out = g_string_new("");
+    GString *transcluded = NULL;
+    size_t input_size;
 
+    own_thread_buffers();
+    TRACE_BEGIN(PHASE_PREFORMAT);
+    if (extensions & EXT_TRANSCLUDE) {
+        include_frame top;
+        top.path = document_path;
+        top.up = NULL;
+        transcluded = g_string_new("");
+        transclude(transcluded, text, document_path ? &top : NULL, 0);
+        text = transcluded->str;
+    }
     formatted_text = preformat_text(text);
+    if (transcluded != NULL)
+        g_string_free(transcluded, TRUE);
+    TRACE_END(PHASE_PREFORMAT);
+    if (formatted_text == NULL)
+        return FALSE;
 
     if (output_format == OPML_FORMAT) {
+        TRACE_BEGIN(PHASE_DOCUMENT);
         result = parse_markdown_for_opml(formatted_text->str, extensions);
+        TRACE_END(PHASE_DOCUMENT);
     } else {
+        TRACE_BEGIN(PHASE_REFERENCES);
         references = parse_references(formatted_text->str, extensions);
+        TRACE_END(PHASE_REFERENCES);
+        TRACE_BEGIN(PHASE_NOTES);
         notes = parse_notes(formatted_text->str, extensions, references);
+        TRACE_END(PHASE_NOTES);
+        TRACE_BEGIN(PHASE_LABELS);
         labels = parse_labels(formatted_text->str, extensions, references, notes);
+        TRACE_END(PHASE_LABELS);
+        TRACE_BEGIN(PHASE_DOCUMENT);
         result = parse_markdown_with_metadata(formatted_text->str, extensions, references, notes, labels);
+        TRACE_END(PHASE_DOCUMENT);
 
+        TRACE_BEGIN(PHASE_RAW_BLOCKS);
         result = process_raw_blocks(result, extensions, references, notes, labels);
+        TRACE_END(PHASE_RAW_BLOCKS);
     }
 
+    if (inventory_hook)
+        inventory(formatted_text->str, result, references, notes, labels);
+
+    input_size = formatted_text->currentStringLength;
     g_string_free(formatted_text, TRUE);
+    note_input_size(input_size);
 
-    print_element_list(out, result, output_format, extensions);
+    TRACE_BEGIN(PHASE_RENDER);
+    if (stats != NULL || output_format == STATS_FORMAT) {
+        if (stats == NULL)
+            stats = &counted;
+        memset(stats, 0, sizeof(markdown_stats));
+        count_elements(stats, result, notes, &in_word);
+        stats->reading_minutes = (stats->words + READING_SPEED - 1) / READING_SPEED;
+        if (out != NULL)
+            print_stats(out, stats);
+    } else {
+        print_element_list(out, result, output_format, extensions);
+    }
+    TRACE_END(PHASE_RENDER);
 
+    detach_shared_notes(result);
     free_element_list(result);
+    free_note_list(notes);
+    free_bibliography_notes();
+    free_element_list(references);
+    free_element_list(labels);
+    return TRUE;
+}
 
-    if (output_format != OPML_FORMAT) {
-        free_element_list(references);
-        free_element_list(labels);
+/* markdown_to_g_string - convert markdown text to the output format
+ * specified.  Returns NULL if the text is rejected as invalid UTF-8. */
+GString * markdown_to_g_string(char *text, int extensions, int output_format) {
+    GString *out;
+    out = g_string_new("");
+    if (!convert(out, text, extensions, output_format, NULL)) {
+        g_string_free(out, TRUE);
+        return NULL;
     }
     return out;
 }
 
+/* markdown_statistics - count the words, headings, links and so on in
+ * markdown text, without rendering it.  Returns FALSE if the text is
+ * rejected as invalid UTF-8. */
+bool markdown_statistics(char *text, int extensions, markdown_stats *stats) {
+    return convert(NULL, text, extensions, STATS_FORMAT, stats);
+}
+
 /* markdown_to_string - convert markdown text to the output format specified.
- * Returns a null-terminated string, which must be freed after use. */
+ * Returns a null-terminated string, which must be freed after use with
+ * g_free() (or the free function of the allocator in use), or NULL if
+ * the text is rejected as invalid UTF-8. */
 char * markdown_to_string(char *text, int extensions, int output_format) {
     GString *out;
     char *char_out;
     out = markdown_to_g_string(text, extensions, output_format);
+    if (out == NULL)
+        return NULL;
     char_out = out->str;
     g_string_free(out, FALSE);
     return char_out;
 }
 
-/* vim:set ts=4 sw=4: */
-
 /* extract_metadata_value - parse document and return value of specified
    metadata key (e.g. "LateX Mode")/
    Returns a null-terminated string, which must be freed after use. */
@@ -200,12 +924,128 @@ char * extract_metadata_value(char *text, int extensions, char *key) {
     element *result;
     GString *formatted_text;
 
+    own_thread_buffers();
+    TRACE_BEGIN(PHASE_PREFORMAT);
     formatted_text = preformat_text(text);
+    TRACE_END(PHASE_PREFORMAT);
+    if (formatted_text == NULL)
+        return NULL;
     
+    TRACE_BEGIN(PHASE_DOCUMENT);
     result = parse_metadata_only(formatted_text->str, extensions);
+    TRACE_END(PHASE_DOCUMENT);
+    g_string_free(formatted_text, TRUE);
     
     value = metavalue_for_key(key, result->children);
     free_element_list(result);
     return value;
 }
 
+/* markdown_free - free a string returned by markdown_to_string() or
+ * extract_metadata_value(). */
+void markdown_free(void *string) {
+    g_free(string);
+}
+
+/* markdown_reference_index_create - parse the reference definitions in
+ * 'text' (only the references pass is run) and index them.  Returns NULL
+ * if the text is rejected as invalid UTF-8. */
+markdown_reference_index * markdown_reference_index_create(char *text, int extensions) {
+    GString *formatted_text;
+    element *references;
+
+    own_thread_buffers();
+    if ((formatted_text = preformat_text(text)) == NULL)
+        return NULL;
+    references = parse_references(formatted_text->str, extensions);
+    g_string_free(formatted_text, TRUE);
+    return build_reference_index(references);
+}
+
+/* markdown_reference_index_destroy - free the index.  It must not be in
+ * use by any conversion. */
+void markdown_reference_index_destroy(markdown_reference_index *index) {
+    if (shared_references == index)
+        shared_references = NULL;
+    free_reference_index(index);
+}
+
+/* markdown_set_reference_index - look up references missing from each
+ * document in 'index' from now on; NULL stops doing so. */
+void markdown_set_reference_index(const markdown_reference_index *index) {
+    shared_references = index;
+}
+
+struct markdown_converter {
+    int extensions;
+    int output_format;
+    GString *out;               /* output of the last conversion */
+    markdown_allocator allocator;   /* current when it was created */
+};
+
+/* markdown_converter_create - new converter for the given extensions and
+ * output format, which allocates with the calling thread's current
+ * allocator whichever thread uses it.  Returns NULL if out of memory. */
+markdown_converter * markdown_converter_create(int extensions, int output_format) {
+    markdown_converter *converter;
+    if ((converter = g_malloc(sizeof(markdown_converter))) == NULL)
+        return NULL;
+    converter->extensions = extensions;
+    converter->output_format = output_format;
+    g_mem_get_allocator(&converter->allocator);
+    converter->out = g_string_new("");
+    return converter;
+}
+
+/* markdown_converter_convert - convert 'text' into the converter's buffer.
+ * Returns the null-terminated output, which stays valid until the next
+ * call on this converter; its length is stored in *length if not NULL.
+ * Returns NULL if the text is rejected as invalid UTF-8. */
+const char * markdown_converter_convert(markdown_converter *converter, const char *text, size_t *length) {
+    GString *out = converter->out;
+    markdown_allocator saved;
+    bool ok;
+
+    g_mem_get_allocator(&saved);
+    g_mem_set_allocator(&converter->allocator);
+    out->currentStringLength = 0;
+    out->str[0] = '\0';
+    ok = convert(out, (char *)text, converter->extensions, converter->output_format, NULL);
+    g_mem_set_allocator(&saved);
+    if (!ok)
+        return NULL;
+    if (length != NULL)
+        *length = out->currentStringLength;
+    return out->str;
+}
+
+/* markdown_converter_reset - give back the memory held for reuse: the
+ * converter's output buffer and the calling thread's parser buffers. */
+void markdown_converter_reset(markdown_converter *converter) {
+    markdown_allocator saved;
+
+    g_mem_get_allocator(&saved);
+    g_mem_set_allocator(&converter->allocator);
+    g_string_free(converter->out, TRUE);
+    converter->out = g_string_new("");
+    markdown_trim_parser_buffers();
+    g_mem_set_allocator(&saved);
+}
+
+/* markdown_converter_destroy - free the converter.  The calling thread's
+ * parser buffers are kept for other converters, but if the converter's
+ * allocator made them they are handed back to it first. */
+void markdown_converter_destroy(markdown_converter *converter) {
+    markdown_allocator saved;
+
+    if (converter == NULL)
+        return;
+    g_mem_get_allocator(&saved);
+    g_mem_set_allocator(&converter->allocator);
+    g_string_free(converter->out, TRUE);
+    g_free(converter);
+    g_mem_set_allocator(&saved);
+    own_thread_buffers();
+}
+
+/* vim:set ts=4 sw=4: */
@@ -2,6 +2,14 @@
 #include <stdio.h>
 #include "glib.h"
 
+/* The shared library is built with -fvisibility=hidden; only functions
+ * marked MD_API are exported from it. */
+#if defined(__GNUC__) && __GNUC__ >= 4
+#define MD_API __attribute__((visibility("default")))
+#else
+#define MD_API
+#endif
+
 enum markdown_extensions {
     EXT_SMART            = 1 << 0,
     EXT_NOTES            = 1 << 1,
@@ -10,6 +18,7 @@ enum markdown_extensions {
     EXT_COMPATIBILITY    = 1 << 4,
     EXT_PROCESS_HTML     = 1 << 5,
 	EXT_NO_LABELS		 = 1 << 6,
+    EXT_TRANSCLUDE       = 1 << 7,
 };
 
 enum markdown_formats {
@@ -20,11 +29,159 @@ enum markdown_formats {
     OPML_FORMAT,
     GROFF_MM_FORMAT,
     ODF_FORMAT,
-    ODF_BODY_FORMAT
+    ODF_BODY_FORMAT,
+    STATS_FORMAT             /* markdown_stats, as metadata lines */
+};
+
+/* Format named as on the command line ("html", "latex", ...), or -1 */
+MD_API int markdown_format_from_name(const char *name);
+
+/* Phases of a conversion, reported to the trace hook */
+enum markdown_phases {
+    PHASE_PREFORMAT,         /* tab expansion and copy of the input */
+    PHASE_REFERENCES,        /* first pass: link references */
+    PHASE_NOTES,             /* second pass: notes and glossary */
+    PHASE_LABELS,            /* third pass: heading and table labels */
+    PHASE_DOCUMENT,          /* main parse */
+    PHASE_RAW_BLOCKS,        /* re-parse of nested raw blocks */
+    PHASE_RENDER,            /* output */
+    PHASE_COUNT
+};
+
+/* Called with begin = 1 as a phase starts and begin = 0 as it ends */
+typedef void (*markdown_trace_hook)(int phase, int begin, void *user);
+
+MD_API void markdown_set_trace_hook(markdown_trace_hook hook, void *user);
+MD_API const char * markdown_phase_name(int phase);
+
+/* Everything in a document that can be linked to or from, reported as it
+ * is converted, with no extra parse */
+enum markdown_inventory_kinds {
+    INVENTORY_LINK,          /* name: reference id, target: url */
+    INVENTORY_IMAGE,         /* name: reference id, target: url */
+    INVENTORY_REFERENCE,     /* definition; name: id, target: url */
+    INVENTORY_ANCHOR,        /* id of a heading or table */
+    INVENTORY_NOTE,          /* definition of a footnote or citation */
+    INVENTORY_NOTE_REF,      /* footnote reference */
+    INVENTORY_GLOSSARY,      /* glossary entry */
+    INVENTORY_CITATION,      /* citation; name: key */
+    INVENTORY_COUNT
+};
+
+/* 'name' and 'target' may be NULL or empty.  'line' is where the item
+ * was found; inside a list it is the line where the list item starts. */
+typedef void (*markdown_inventory_hook)(int kind, const char *name, const char *target, int line, void *user);
+
+MD_API void markdown_set_inventory_hook(markdown_inventory_hook hook, void *user);
+MD_API const char * markdown_inventory_kind_name(int kind);
+
+/* Document statistics, counted from the parse with nothing rendered.
+ * Words and characters are those of the text as read, without markup,
+ * metadata, raw HTML or code blocks; characters include spaces. */
+typedef struct {
+    long words;
+    long characters;
+    long reading_minutes;    /* at 200 words a minute, rounded up */
+    int headings;
+    int footnotes;           /* references to footnotes, and inline notes */
+    int citations;
+    int tables;
+    int code_blocks;
+    int links;
+    int images;
+} markdown_stats;
+
+MD_API bool markdown_statistics(char *text, int extensions, markdown_stats *stats);
+
+/* Allocator used for everything the library allocates, including the
+ * strings it returns.  It is set per thread; see GLibFacade.h. */
+typedef GMemAllocator markdown_allocator;
+
+MD_API void markdown_set_allocator(const markdown_allocator *allocator);
+
+/* Capacities, in bytes, of the buffers the parser keeps between
+ * conversions, and how often they have been trimmed back. */
+typedef struct {
+    size_t input;          /* input text */
+    size_t text;           /* matched text handed to actions */
+    size_t thunks;         /* deferred actions */
+    size_t values;         /* semantic values */
+    unsigned long trims;
+} markdown_parser_buffers;
+
+/* What conversions do with input that is not valid UTF-8 */
+enum markdown_utf8_policies {
+    UTF8_PASS,               /* copy it through unchanged (the default) */
+    UTF8_REPLACE,            /* replace each invalid byte with U+FFFD */
+    UTF8_REJECT              /* fail: the conversion functions return NULL */
 };
 
+MD_API void markdown_set_utf8_policy(int policy);
+
+/* With EXT_TRANSCLUDE, a line holding only {{path}} is replaced by that
+ * file, resolved relative to the document's own path.  Files read this way
+ * are cached per thread until cleared. */
+MD_API void markdown_set_document_path(const char *path);
+MD_API void markdown_clear_include_cache(void);
+
+MD_API void markdown_set_trim_factor(int factor);
+MD_API void markdown_trim_parser_buffers(void);
+MD_API void markdown_parser_buffer_sizes(markdown_parser_buffers *sizes);
+
+/* Returns a GString, so only for programs built with the library's
+ * sources; not exported from the shared library. */
 GString * markdown_to_g_string(char *text, int extensions, int output_format);
-char * markdown_to_string(char *text, int extensions, int output_format);
-char * extract_metadata_value(char *text, int extensions, char *key);
+MD_API char * markdown_to_string(char *text, int extensions, int output_format);
+MD_API char * extract_metadata_value(char *text, int extensions, char *key);
+MD_API void markdown_free(void *string);
+
+/* Link references parsed once, from a file of definitions shared by many
+ * documents, and looked up by hash.  Once set, the index is consulted by
+ * every conversion, in any thread, for labels a document does not define
+ * itself.  Links refer into the index, so it must outlive the conversions;
+ * it is never modified after it is created. */
+typedef struct markdown_reference_index markdown_reference_index;
+
+MD_API markdown_reference_index * markdown_reference_index_create(char *text, int extensions);
+MD_API void markdown_reference_index_destroy(markdown_reference_index *index);
+MD_API void markdown_set_reference_index(const markdown_reference_index *index);
+
+/* A bibliography, BibTeX or CSL-JSON, indexed once by citation key.
+ * Once set, it is consulted by every conversion, in any thread, for the
+ * citations ([#key]) a document does not define itself, each of which
+ * gets the entry as its note, in every format.  The index can be saved
+ * to a file, which loading maps into memory rather than reading it
+ * again.  Like the reference index, it must outlive the conversions that
+ * use it. */
+typedef struct markdown_bibliography markdown_bibliography;
+
+MD_API markdown_bibliography * markdown_bibliography_create(const char *text);
+MD_API markdown_bibliography * markdown_bibliography_load(const char *path);
+MD_API bool markdown_bibliography_save(const markdown_bibliography *bib, const char *path);
+MD_API void markdown_bibliography_destroy(markdown_bibliography *bib);
+MD_API void markdown_set_bibliography(const markdown_bibliography *bib);
+
+/* Header and footer templates: text with [%key] placeholders for the
+ * document's metadata values, compiled once and then used by every
+ * conversion, in any thread, in place of the format's own preamble and
+ * postamble; either can be NULL.  Like the reference index, templates
+ * must outlive the conversions that use them. */
+typedef struct markdown_template markdown_template;
+
+MD_API markdown_template * markdown_template_create(const char *text);
+MD_API void markdown_template_destroy(markdown_template *tmpl);
+MD_API void markdown_set_templates(const markdown_template *header, const markdown_template *footer);
+
+/* Converter handle.  Each keeps its options, the allocator current when
+ * it was created, and an output buffer that is reused from one conversion
+ * to the next; parser buffers belong to the calling thread and are reused
+ * likewise.  A handle must not be used by two threads at once, but
+ * separate handles can convert concurrently. */
+typedef struct markdown_converter markdown_converter;
+
+MD_API markdown_converter * markdown_converter_create(int extensions, int output_format);
+MD_API const char * markdown_converter_convert(markdown_converter *converter, const char *text, size_t *length);
+MD_API void markdown_converter_reset(markdown_converter *converter);
+MD_API void markdown_converter_destroy(markdown_converter *converter);
 
 /* vim: set ts=4 sw=4 : */
@@ -25,22 +25,23 @@
 #include "glib.h"
 #include "markdown_peg.h"
 #include "utility_functions.c"
+#include "template.c"
 #include "odf.c"
 
-static int extensions;
-static int base_header_level = 1;
-static char *latex_footer;
-static int table_column = 0;
-static char *table_alignment;
-static char cell_type = 'd';
-static int language = ENGLISH;
-static bool html_footer = FALSE;
-static int odf_type = 0;
-static bool in_list = FALSE;
-static bool no_latex_footnote = FALSE;
-static bool am_printing_html_footnote = FALSE;
-static int footnote_counter_to_print = 0;
-static int odf_list_needs_end_p = 0;
+static MD_THREAD_LOCAL int extensions;
+static MD_THREAD_LOCAL int base_header_level = 1;
+static MD_THREAD_LOCAL char *latex_footer;
+static MD_THREAD_LOCAL int table_column = 0;
+static MD_THREAD_LOCAL char *table_alignment;
+static MD_THREAD_LOCAL char cell_type = 'd';
+static MD_THREAD_LOCAL int language = ENGLISH;
+static MD_THREAD_LOCAL bool html_footer = FALSE;
+static MD_THREAD_LOCAL int odf_type = 0;
+static MD_THREAD_LOCAL bool in_list = FALSE;
+static MD_THREAD_LOCAL bool no_latex_footnote = FALSE;
+static MD_THREAD_LOCAL bool am_printing_html_footnote = FALSE;
+static MD_THREAD_LOCAL int footnote_counter_to_print = 0;
+static MD_THREAD_LOCAL int odf_list_needs_end_p = 0;
 
 static void print_html_string(GString *out, char *str, bool obfuscate);
 static void print_html_element_list(GString *out, element *list, bool obfuscate);
@@ -66,6 +67,9 @@ static void print_html_footer(GString *out, bool obfuscate);
 static void print_latex_header(GString *out, element *elt);
 static void print_latex_footer(GString *out);
 
+static void discard_metadata(element *elt, int format);
+static template_value_printer template_printer(int format);
+
 static void print_memoir_element_list(GString *out, element *list);
 static void print_memoir_element(GString *out, element *elt);
 
@@ -76,7 +80,6 @@ static void print_opml_string(GString *out, char *str);
 static void print_opml_element_list(GString *out, element *list);
 static void print_opml_element(GString *out, element *elt);
 static void print_opml_metadata(GString *out, element *elt);
-static void print_opml_section_and_children(GString *out, element *list);
 
 element * print_html_headingsection(GString *out, element *list, bool obfuscate);
 
@@ -96,12 +99,12 @@ element * locator_for_citation(element *elt);
 
  ***********************************************************************/
 
-static int padded = 2;      /* Number of newlines after last output.
+static MD_THREAD_LOCAL int padded = 2;      /* Number of newlines after last output.
                                Starts at 2 so no newlines are needed at start.
                                */
 
-static GSList *endnotes = NULL; /* List of endnotes to print after main content. */
-static int notenumber = 0;  /* Number of footnote. */
+static MD_THREAD_LOCAL GSList *endnotes = NULL; /* List of endnotes to print after main content. */
+static MD_THREAD_LOCAL int notenumber = 0;  /* Number of footnote. */
 
 /* pad - add newlines if needed */
 static void pad(GString *out, int num) {
@@ -138,7 +141,15 @@ bool list_contains_key(element *list, int key) {
 /* print_html_string - print string, escaping for HTML  
  * If obfuscate selected, convert characters to hex or decimal entities at random */
 static void print_html_string(GString *out, char *str, bool obfuscate) {
-    while (*str != '\0') {
+    char *end = str + strlen(str);
+    size_t run;
+    while (str < end) {
+        /* copy text that needs no escaping in one go */
+        if (!obfuscate && (run = html_run(str, end - str)) > 0) {
+            g_string_append_len(out, str, run);
+            str += run;
+            continue;
+        }
         switch (*str) {
         case '&':
             g_string_append_printf(out, "&amp;");
@@ -274,11 +285,11 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
         height = NULL;
         attribute = element_for_attribute("height", elt->contents.link->attr);
         if (attribute != NULL) {
-            height = strdup(attribute->children->contents.str);
+            height = g_strdup(attribute->children->contents.str);
         }
         attribute = element_for_attribute("width", elt->contents.link->attr);
         if (attribute != NULL) {
-            width = strdup(attribute->children->contents.str);
+            width = g_strdup(attribute->children->contents.str);
         }
         if ((height != NULL) || (width != NULL)) {
             g_string_append_printf(out, " style=\"");
@@ -298,8 +309,8 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
             }
             g_string_append_printf(out, "</figure>\n");
         }
-        free(height);
-        free(width);
+        g_free(height);
+        g_free(width);
         break;
     case EMPH:
         g_string_append_printf(out, "<em>");
@@ -335,7 +346,7 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
             label = label_from_element_list(elt->children, obfuscate);
             g_string_append_printf(out, "<h%d id=\"%s\">", lev, label);
             print_html_element_list(out, elt->children, obfuscate);
-            free(label);
+            g_free(label);
         }
         g_string_append_printf(out, "</h%1d>", lev);
         padded = 0;
@@ -427,7 +438,7 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
                 char buf[5];
                 sprintf(buf,"%d",notenumber);
                 /* Assign footnote number for future use */
-                elt->children->contents.str = strdup(buf);
+                elt->children->contents.str = g_strdup(buf);
                 if (elt->children->key == GLOSSARYTERM) {
                     g_string_append_printf(out, "<a href=\"#fn:%d\" id=\"fnref:%d\" title=\"see footnote\" class=\"footnote glossary\">[%d]</a>",
                                 notenumber, notenumber, notenumber);
@@ -440,8 +451,8 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
                 g_string_append_printf(out, "<a href=\"#fn:%s\" title=\"see footnote\" class=\"footnote\">[%s]</a>",
                     elt->children->contents.str, elt->children->contents.str);
             }
+            elt->children = NULL;
         }
-        elt->children = NULL;
         break;
     case GLOSSARY:
         /* Shouldn't do anything */
@@ -492,7 +503,7 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
                 char buf[5];
                 sprintf(buf,"%d",notenumber);
                 /* Store the number for future reference */
-                elt->children->contents.str = strdup(buf);
+                elt->children->contents.str = g_strdup(buf);
             }
             if (locator != NULL) {
                 if ( elt->key == NOCITATION ) {
@@ -518,6 +529,11 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
                 g_string_append_printf(out,"</a>");
             }
         }
+        /* Give the locator back so it is freed with the citation */
+        if (locator != NULL) {
+            locator->next = elt->children;
+            elt->children = locator;
+        }
         break;
     case LOCATOR:
         print_html_element_list(out, elt->children, obfuscate);
@@ -548,7 +564,10 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
     case METADATA:
         /* Metadata is present, so this should be a "complete" document */
         html_footer = is_html_complete_doc(elt);
-        if (html_footer) {
+        if (header_template != NULL) {
+            /* the header has been printed already */
+            discard_metadata(elt, HTML_FORMAT);
+        } else if (html_footer) {
             print_html_header(out, elt, obfuscate);
         } else {
             print_html_element_list(out, elt->children, obfuscate);
@@ -582,7 +601,7 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
             if (strcmp(label, "germanguillemets") == 0) { language = GERMANGUILL; } else 
             if (strcmp(label, "french") == 0) { language = FRENCH; } else 
             if (strcmp(label, "swedish") == 0) { language = SWEDISH; }
-            free(label);
+            g_free(label);
        } else {
             g_string_append_printf(out, "\t<meta name=\"");
             print_html_string(out, elt->contents.str, obfuscate);
@@ -616,7 +635,7 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
         g_string_append_printf(out, "<caption id=\"%s\">", label);
         print_html_element_list(out, elt->children, obfuscate);
         g_string_append_printf(out, "</caption>\n");
-        free(label);
+        g_free(label);
         break;
     case TABLELABEL:
         break;
@@ -708,7 +727,8 @@ static void print_html_endnotes(GString *out) {
     element *note_elt;
     if (endnotes == NULL) 
         return;
-    note = g_slist_reverse(endnotes);
+    endnotes = g_slist_reverse(endnotes);
+    note = endnotes;
     g_string_append_printf(out, "<div class=\"footnotes\">\n<hr />\n<ol>");
     while (note != NULL) {
         note_elt = note->data;
@@ -744,6 +764,7 @@ static void print_html_endnotes(GString *out) {
     g_string_append_printf(out, "</ol>\n</div>\n");
 
     g_slist_free(endnotes);
+    endnotes = NULL;
 }
 
 /**********************************************************************
@@ -814,7 +835,8 @@ static void print_latex_endnotes(GString *out) {
     element *note_elt;
     if (endnotes == NULL) 
         return;
-    note = g_slist_reverse(endnotes);
+    endnotes = g_slist_reverse(endnotes);
+    note = endnotes;
     pad(out,2);
     g_string_append_printf(out, "\\begin{thebibliography}{0}");
     while (note != NULL) {
@@ -830,6 +852,7 @@ static void print_latex_endnotes(GString *out) {
     g_string_append_printf(out, "\\end{thebibliography}\n");
     padded = 1;
     g_slist_free(endnotes);
+    endnotes = NULL;
 }
 
 /* print_latex_element_list - print a list of elements as LaTeX */
@@ -905,7 +928,7 @@ static void print_latex_element(GString *out, element *elt) {
             } else {
                 g_string_append_printf(out, "\\autoref\{%s}", label);
             }
-            free(label);
+            g_free(label);
         } else if ( (elt->contents.link->label != NULL) &&
                 ( elt->contents.link->label->contents.str != NULL) &&
                 ( strcmp(elt->contents.link->label->contents.str, 
@@ -988,8 +1011,8 @@ static void print_latex_element(GString *out, element *elt) {
             g_string_append_printf(out, "\\label{%s}\n", elt->contents.link->identifier);
             g_string_append_printf(out,"\\end{figure}\n");
         }
-        free(height);
-        free(width);
+        g_free(height);
+        g_free(width);
         break;
     case EMPH:
         g_string_append_printf(out, "\\emph{");
@@ -1051,7 +1074,7 @@ static void print_latex_element(GString *out, element *elt) {
         g_string_append_printf(out, "}\n\\label{");
         g_string_append_printf(out, "%s", label);
         g_string_append_printf(out, "}\n");
-        free(label);
+        g_free(label);
         padded = 1;
         break;
     case PLAIN:
@@ -1194,7 +1217,8 @@ static void print_latex_element(GString *out, element *elt) {
                 element *temp;
                 temp = elt->children;
                 elt->children = temp->next;
-                free_element(temp);
+                temp->next = NULL;
+                free_element_list(temp);
             } else {
                 if ((elt->children != NULL) && (elt->children->key == LOCATOR)){
                     if (strcmp(&elt->contents.str[strlen(elt->contents.str) - 1],";") == 0) {
@@ -1208,7 +1232,8 @@ static void print_latex_element(GString *out, element *elt) {
                     element *temp;
                     temp = elt->children;
                     elt->children = temp->next;
-                    free_element(temp);
+                    temp->next = NULL;
+                    free_element_list(temp);
                 } else {
                     if (strcmp(&elt->contents.str[strlen(elt->contents.str) - 1],";") == 0) {
                         elt->contents.str[strlen(elt->contents.str) - 1] = '\0';
@@ -1219,7 +1244,7 @@ static void print_latex_element(GString *out, element *elt) {
                 }
             }
             if ((elt->children != NULL) && (elt->children->contents.str == NULL)) {
-                elt->children->contents.str = strdup(elt->contents.str);
+                elt->children->contents.str = g_strdup(elt->contents.str);
                 add_endnote(elt->children);
             }
             elt->children = NULL;
@@ -1251,7 +1276,10 @@ static void print_latex_element(GString *out, element *elt) {
         break;
     case METADATA:
         /* Metadata is present, so this should be a "complete" document */
-        print_latex_header(out, elt);
+        if (header_template != NULL)
+            discard_metadata(elt, LATEX_FORMAT);
+        else
+            print_latex_header(out, elt);
         html_footer = is_html_complete_doc(elt);
         break;
     case METAKEY:
@@ -1291,7 +1319,7 @@ static void print_latex_element(GString *out, element *elt) {
             if (strcmp(label, "germanguillemets") == 0) { language = GERMANGUILL; } else 
             if (strcmp(label, "french") == 0) { language = FRENCH; } else 
             if (strcmp(label, "swedish") == 0) { language = SWEDISH; }
-            free(label);
+            g_free(label);
         } else {
             g_string_append_printf(out, "\\def\\");
             print_latex_string(out, elt->contents.str);
@@ -1318,13 +1346,13 @@ static void print_latex_element(GString *out, element *elt) {
         padded = 0;
         break;
     case TABLESEPARATOR:
-        upper = strdup(elt->contents.str);
+        upper = g_strdup(elt->contents.str);
 
         for(i = 0; upper[ i ]; i++)
             upper[i] = toupper(upper[ i ]);
     
         g_string_append_printf(out, "\\begin{tabulary}{\\textwidth}{@{}%s@{}} \\toprule\n", upper);
-        free(upper);
+        g_free(upper);
         break;
     case TABLECAPTION:
         if (elt->children->key == TABLELABEL) {
@@ -1335,7 +1363,7 @@ static void print_latex_element(GString *out, element *elt) {
         g_string_append_printf(out, "\\caption{");
         print_latex_element_list(out, elt->children);
         g_string_append_printf(out, "}\n\\label{%s}\n",label);
-        free(label);
+        g_free(label);
         break;
     case TABLELABEL:
         break;
@@ -1400,7 +1428,7 @@ static void print_latex_element(GString *out, element *elt) {
 
  ***********************************************************************/
 
-static bool in_list_item = false; /* True if we're parsing contents of a list item. */
+static MD_THREAD_LOCAL bool in_list_item = false; /* True if we're parsing contents of a list item. */
 
 /* print_groff_string - print string, escaping for groff */
 static void print_groff_string(GString *out, char *str) {
@@ -1786,6 +1814,7 @@ void print_odf_element(GString *out, element *elt) {
             } else {
                 
             }
+            g_free(label);
         } else {
             g_string_append_printf(out, "<text:a xlink:type=\"simple\" xlink:href=\"");
             print_html_string(out, elt->contents.link->url, 0);
@@ -1831,6 +1860,8 @@ void print_odf_element(GString *out, element *elt) {
         } else {
             g_string_append_printf(out, "</draw:text-box></draw:frame>\n");
         }
+        g_free(height);
+        g_free(width);
         break;
     case EMPH:
         g_string_append_printf(out,
@@ -1864,7 +1895,7 @@ void print_odf_element(GString *out, element *elt) {
             g_string_append_printf(out,"<text:bookmark text:name=\"%s\"/>", label);
             print_odf_element_list(out, elt->children);
             g_string_append_printf(out,"<text:bookmark-end text:name=\"%s\"/>", label);
-            free(label);
+            g_free(label);
         }
         g_string_append_printf(out, "</text:h>\n");
         padded = 0;
@@ -1997,8 +2028,8 @@ void print_odf_element(GString *out, element *elt) {
                 print_odf_element_list(out, elt->children);
                 g_string_append_printf(out, "</text:note-body>\n</text:note>\n");
             }
+            elt->children = NULL;
        }
-        elt->children = NULL;
         odf_type = old_type;
         break;
     case GLOSSARY:
@@ -2028,7 +2059,7 @@ void print_odf_element(GString *out, element *elt) {
                 char buf[5];
                 sprintf(buf, "%d",notenumber);
                 /* Store the number for future reference */
-                elt->children->contents.str = strdup(buf);
+                elt->children->contents.str = g_strdup(buf);
                 
                 /* Insert the footnote here */
                 old_type = odf_type;
@@ -2046,6 +2077,11 @@ void print_odf_element(GString *out, element *elt) {
             }
             elt->children = NULL;
         }
+        /* Give the locator back so it is freed with the citation */
+        if (locator != NULL) {
+            locator->next = elt->children;
+            elt->children = locator;
+        }
         break;
     case LOCATOR:
         print_odf_element_list(out, elt->children);
@@ -2103,7 +2139,7 @@ void print_odf_element(GString *out, element *elt) {
              if (strcmp(label, "germanguillemets") == 0) { language = GERMANGUILL; } else 
              if (strcmp(label, "french") == 0) { language = FRENCH; } else 
              if (strcmp(label, "swedish") == 0) { language = SWEDISH; }
-             free(label);
+             g_free(label);
         } else {
             g_string_append_printf(out, "<meta:user-defined meta:name=\"");
             print_odf_string(out,elt->contents.str);
@@ -2134,7 +2170,7 @@ void print_odf_element(GString *out, element *elt) {
             g_string_append_printf(out,"<text:p><text:bookmark text:name=\"%s\"/>Table <text:sequence text:name=\"Table\" text:formula=\"ooow:Table+1\" style:num-format=\"1\"> Update Fields to calculate numbers</text:sequence>:", label);
             print_odf_element_list(out,elt->children->children);
             g_string_append_printf(out, "<text:bookmark-end text:name=\"%s\"/></text:p>\n",label);
-            free(label);
+            g_free(label);
         }
         break;
    case TABLESEPARATOR:
@@ -2210,6 +2246,8 @@ void print_odf_element(GString *out, element *elt) {
  ***********************************************************************/
 
 void print_element_list(GString *out, element *elt, int format, int exts) {
+    element *document = elt;
+
     /* Initialize globals */
     endnotes = NULL;
     notenumber = 0;
@@ -2224,6 +2262,11 @@ void print_element_list(GString *out, element *elt, int format, int exts) {
     padded = 2;  /* set padding to 2, so no extra blank lines at beginning */
 
     format = find_latex_mode(format, elt);
+
+    /* A header or footer template takes the place of the format's own */
+    if (header_template != NULL)
+        template_emit(out, header_template, document, template_printer(format));
+
     switch (format) {
     case HTML_FORMAT:
         print_html_element_list(out, elt, false);
@@ -2231,7 +2274,7 @@ void print_element_list(GString *out, element *elt, int format, int exts) {
             pad(out, 2);
             print_html_endnotes(out);
         }
-        if (html_footer == TRUE) print_html_footer(out, false);
+        if (html_footer == TRUE && footer_template == NULL) print_html_footer(out, false);
         break;
     case LATEX_FORMAT:
         print_latex_element_list(out, elt);
@@ -2243,22 +2286,29 @@ void print_element_list(GString *out, element *elt, int format, int exts) {
         print_beamer_element_list(out, elt);
         break;
     case OPML_FORMAT:
-        g_string_append_printf(out, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<opml version=\"1.0\">\n");
-        g_string_append_printf(out, "<body>\n");
+        if (header_template == NULL)
+            append_literal(out, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<opml version=\"1.0\">\n<body>\n");
         print_opml_element_list(out, elt);
         if (html_footer == TRUE) print_opml_metadata(out, elt);
-        g_string_append_printf(out, "</body>\n</opml>");
+        if (footer_template == NULL)
+            append_literal(out, "</body>\n</opml>");
         break;
     case ODF_FORMAT:
-        print_odf_header(out);
+        if (header_template == NULL)
+            print_odf_header(out);
         if (elt->key == METADATA) {
             /* print metadata */
-            print_odf_element(out,elt);
+            if (header_template == NULL)
+                print_odf_element(out,elt);
+            else
+                discard_metadata(elt, ODF_FORMAT);
             elt = elt->next;
         }
-        g_string_append_printf(out, "<office:body>\n<office:text>\n");
+        if (header_template == NULL)
+            append_literal(out, "<office:body>\n<office:text>\n");
         if (elt != NULL) print_odf_element_list(out,elt);
-        print_odf_footer(out);
+        if (footer_template == NULL)
+            print_odf_footer(out);
         break;
     case ODF_BODY_FORMAT:
         if (elt != NULL) print_odf_body_element_list(out, elt);
@@ -2270,6 +2320,13 @@ void print_element_list(GString *out, element *elt, int format, int exts) {
         fprintf(stderr, "print_element - unknown format = %d\n", format); 
         exit(EXIT_FAILURE);
     }
+
+    if (footer_template != NULL)
+        template_emit(out, footer_template, document, template_printer(format));
+
+    /* Notes collected by a format that never prints them */
+    g_slist_free(endnotes);
+    endnotes = NULL;
 }
 
 
@@ -2281,16 +2338,53 @@ void print_element_list(GString *out, element *elt, int format, int exts) {
 
 
 void print_html_header(GString *out, element *elt, bool obfuscate) {
-    g_string_append_printf(out,
-"<!DOCTYPE html>\n<html>\n<head>\n\t<meta charset=\"utf-8\"/>\n");
-
+    append_literal(out, "<!DOCTYPE html>\n<html>\n<head>\n\t<meta charset=\"utf-8\"/>\n");
     print_html_element_list(out, elt->children, obfuscate);
-    g_string_append_printf(out, "</head>\n<body>\n");    
+    append_literal(out, "</head>\n<body>\n");
 }
 
 
 void print_html_footer(GString *out, bool obfuscate) {
-    g_string_append_printf(out, "\n</body>\n</html>");
+    append_literal(out, "\n</body>\n</html>");
+}
+
+
+/* discard_metadata - act on the metadata keys that change how the rest of
+   the document is printed (header levels, quotes language and so on), but
+   print nothing, for documents whose header is a template */
+static void discard_metadata(element *elt, int format) {
+    GString *unused = g_string_new("");
+    int old_padded = padded;
+
+    if (format == HTML_FORMAT)
+        print_html_element_list(unused, elt->children, false);
+    else if (format == ODF_FORMAT)
+        print_odf_element_list(unused, elt->children);
+    else
+        print_latex_element_list(unused, elt->children);
+    padded = old_padded;
+    g_string_free(unused, true);
+}
+
+
+static void print_html_value(GString *out, char *str) {
+    print_html_string(out, str, false);
+}
+
+/* template_printer - how metadata values in templates are escaped */
+static template_value_printer template_printer(int format) {
+    switch (format) {
+    case HTML_FORMAT:
+        return print_html_value;
+    case LATEX_FORMAT: case MEMOIR_FORMAT: case BEAMER_FORMAT:
+        return print_latex_string;
+    case OPML_FORMAT:
+        return print_opml_string;
+    case GROFF_MM_FORMAT:
+        return print_groff_string;
+    default:
+        return print_odf_string;
+    }
 }
 
 
@@ -2300,12 +2394,14 @@ void print_latex_header(GString *out, element *elt) {
 
 
 void print_latex_footer(GString *out) {
+    if (footer_template != NULL)
+        return;     /* printed at the very end instead */
     if (latex_footer != NULL) {
         pad(out,2);
         g_string_append_printf(out, "\\input{%s}\n", latex_footer);
     }
     if (html_footer) {
-        g_string_append_printf(out, "\n\\end{document}");
+        append_literal(out, "\n\\end{document}");
     }
 }
 
@@ -2368,7 +2464,8 @@ static void print_beamer_endnotes(GString *out) {
     element *note_elt;
     if (endnotes == NULL) 
         return;
-    note = g_slist_reverse(endnotes);
+    endnotes = g_slist_reverse(endnotes);
+    note = endnotes;
     pad(out,2);
     g_string_append_printf(out, "\\part{Bibliography}\n\\begin{frame}[allowframebreaks]\n\\frametitle{Bibliography}\n\\def\\newblock{}\n\\begin{thebibliography}{0}\n");
     while (note != NULL) {
@@ -2384,6 +2481,7 @@ static void print_beamer_endnotes(GString *out) {
     g_string_append_printf(out, "\\end{thebibliography}\n\\end{frame}\n\n");
     padded = 2;
     g_slist_free(endnotes);
+    endnotes = NULL;
 }
 
 /* print_beamer_element - print an element as LaTeX for beamer class */
@@ -2457,7 +2555,7 @@ static void print_beamer_element(GString *out, element *elt) {
             g_string_append_printf(out, "}\n\\label{");
             g_string_append_printf(out, "%s", label);
             g_string_append_printf(out, "}\n");
-            free(label);
+            g_free(label);
             padded = 1;
             break;
         default:
@@ -2491,7 +2589,7 @@ static int find_latex_mode(int format, element *list) {
             label = label_from_element_list(latex_mode->children, 0);
             if (strcmp(label, "beamer") == 0) { format = BEAMER_FORMAT; } else 
             if (strcmp(label, "memoir") == 0) { format = MEMOIR_FORMAT; } 
-            free(label);
+            g_free(label);
         }
         return format;
     } else {
@@ -2514,17 +2612,17 @@ element * metadata_for_key(char *key, element *list) {
             step = step->children;
             while ( step != NULL) {
                 if (strcmp(step->contents.str, label) == 0) {
-                    free(label);
+                    g_free(label);
                     return step;
                 }
                 step = step->next;
             }
-            free(label);
+            g_free(label);
             return NULL;
         }
        step = step->next;
     }
-    free(label);
+    g_free(label);
     return NULL;
 }
 
@@ -2549,19 +2647,19 @@ char * metavalue_for_key(char *key, element *list) {
                         (strcmp(label,"quoteslanguage") == 0)) {
                         result = label_from_string(step->children->contents.str,0);
                     } else {
-                        result = strdup(step->children->contents.str);
+                        result = g_strdup(step->children->contents.str);
                     }
-                    free(label);
+                    g_free(label);
                    return result;
                 }
                 step = step->next;
             }
-            free(label);
+            g_free(label);
             return NULL;
         }
        step = step->next;
     }
-    free(label);
+    g_free(label);
     return NULL;
 }
 
@@ -2574,12 +2672,12 @@ element * element_for_attribute(char *querystring, element *list) {
     
     while (step != NULL) {
         if (strcmp(step->contents.str,query) == 0) {
-            free(query);
+            g_free(query);
             return step;
         }
         step = step->next;
     }
-    free(query);
+    g_free(query);
     return NULL;
 }
 
@@ -2597,8 +2695,8 @@ char * dimension_for_attribute(char *querystring, element *list) {
     attribute = element_for_attribute(querystring, list);
     if (attribute == NULL) return NULL;
 
-    dimension = strdup(attribute->children->contents.str);
-    upper = strdup(attribute->children->contents.str);
+    dimension = g_strdup(attribute->children->contents.str);
+    upper = g_strdup(attribute->children->contents.str);
 
     for(i = 0; dimension[ i ]; i++)
         dimension[i] = tolower(dimension[ i ]);
@@ -2619,8 +2717,8 @@ char * dimension_for_attribute(char *querystring, element *list) {
         g_string_append_printf(result, "pt");
     }
 
-    free(upper);
-    free(dimension);
+    g_free(upper);
+    g_free(dimension);
     
     dimension = result->str;
     g_string_free(result, false);
@@ -2663,41 +2761,40 @@ element * locator_for_citation(element *elt) {
     }
 }
 
-/* print_opml_element_list - print an element list as OPML */
+/* print_opml_element_list - print an element list as OPML, in one pass.
+ * 'open' holds the levels of the sections whose <outline> is still open;
+ * each is one deeper than the last.  A section closes those at its level
+ * or deeper, then opens its own if it is the next level down from what
+ * is left open (or nothing is).  Sections that skip a level are left
+ * out, as they always have been. */
 void print_opml_element_list(GString *out, element *list) {
+    int open[H7 - H1 + 1];   /* levels only ever go up by one */
+    int depth = 0;
     int lev;
     while (list != NULL) {
         if (list->key == HEADINGSECTION) {
             lev = list->children->key;
-            
-            print_opml_section_and_children(out, list);
-            
-            while ((list->next != NULL) && (list->next->key == HEADINGSECTION)
-                && (list->next->children->key > lev)) {
-                    list = list->next;
+            while (depth > 0 && open[depth - 1] >= lev) {
+                g_string_append_printf(out, "</outline>\n");
+                depth--;
+            }
+            if (depth == 0 || open[depth - 1] + 1 == lev) {
+                print_opml_element(out, list);
+                open[depth++] = lev;
             }
         } else {
+            while (depth > 0) {
+                g_string_append_printf(out, "</outline>\n");
+                depth--;
+            }
             print_opml_element(out, list);
         }
         list = list->next;
     }
-}
-
-/* print_opml_section_and_children - print section and "children" */
-static void print_opml_section_and_children(GString *out, element *list) {
-    int lev = list->children->key;
-    /* Print current section, aka "parent" */
-    print_opml_element(out, list);
-    
-    /* check for children */
-    while ((list->next != NULL) && (list->next->key == HEADINGSECTION) 
-        && (list->next->children->key > lev)) {
-            /* next item is also HEADINGSECTION and is child */
-            if (list->next->children->key - lev == 1)
-                print_opml_section_and_children(out,list->next);
-            list = list->next;
-        }
-    g_string_append_printf(out, "</outline>\n");
+    while (depth > 0) {
+        g_string_append_printf(out, "</outline>\n");
+        depth--;
+    }
 }
 
 /* print_opml_element - print an element as OPML */
@@ -0,0 +1,12821 @@
+/* A recursive-descent parser generated by peg 0.1.2 */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define YYRULECOUNT 336
+
+/**********************************************************************
+
+  markdown_parser.leg - markdown parser in C using a PEG grammar.
+  (c) 2008 John MacFarlane (jgm at berkeley dot edu).
+  
+  portions Copyright (c) 2010-2011 Fletcher T. Penney
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+ ***********************************************************************/
+
+#include <stdbool.h>
+#include <assert.h>
+#include "markdown_peg.h"
+#include "utility_functions.c"
+
+#define YY_DEBUG_OFF
+
+/**********************************************************************
+
+  PEG grammar and parser actions for markdown syntax.
+
+ ***********************************************************************/
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic ignored "-Wunused-label"
+#endif
+#ifndef YY_VARIABLE
+#define YY_VARIABLE(T)	static T
+#endif
+#ifndef YY_LOCAL
+#define YY_LOCAL(T)	static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T)	static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T)	static T
+#endif
+#ifndef YY_PARSE
+#define YY_PARSE(T)	T
+#endif
+#ifndef YYPARSE
+#define YYPARSE		yyparse
+#endif
+#ifndef YYPARSEFROM
+#define YYPARSEFROM	yyparsefrom
+#endif
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size)			\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#ifndef YY_MALLOC
+#define YY_MALLOC(N)		malloc(N)
+#endif
+#ifndef YY_REALLOC
+#define YY_REALLOC(P, N)	realloc(P, N)
+#endif
+#ifndef YY_FREE
+#define YY_FREE(P)		free(P)
+#endif
+#ifndef YYRELEASE
+#define YYRELEASE	yyrelease
+#endif
+#ifndef YY_ACTION_POS
+#define YY_ACTION_POS(POS)
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( yybegin= yypos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( yyend= yypos, 1)
+#endif
+#ifndef YY_LIKELY
+# ifdef __GNUC__
+#  define YY_LIKELY(X)		__builtin_expect(!!(X), 1)
+#  define YY_UNLIKELY(X)	__builtin_expect(!!(X), 0)
+# else
+#  define YY_LIKELY(X)		(X)
+#  define YY_UNLIKELY(X)	(X)
+# endif
+#endif
+#ifndef YY_HOT
+# ifdef __GNUC__
+#  define YY_HOT	__attribute__((hot))
+#  define YY_COLD	__attribute__((cold))
+# else
+#  define YY_HOT
+#  define YY_COLD
+# endif
+#endif
+#ifdef YY_DEBUG
+# define yyprintf(args)	fprintf args
+#else
+# define yyprintf(args)
+#endif
+#ifndef YYSTYPE
+#define YYSTYPE	int
+#endif
+
+#ifndef YY_PART
+
+typedef void (*yyaction)(char *yytext, int yyleng);
+typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;
+
+YY_VARIABLE(char *   ) yybuf= 0;
+YY_VARIABLE(int	     ) yybuflen= 0;
+YY_VARIABLE(int	     ) yypos= 0;
+YY_VARIABLE(int	     ) yylimit= 0;
+YY_VARIABLE(char *   ) yytext= 0;
+YY_VARIABLE(int	     ) yytextlen= 0;
+YY_VARIABLE(int	     ) yybegin= 0;
+YY_VARIABLE(int	     ) yyend= 0;
+YY_VARIABLE(int	     ) yytextmax= 0;
+YY_VARIABLE(yythunk *) yythunks= 0;
+YY_VARIABLE(int	     ) yythunkslen= 0;
+YY_VARIABLE(int      ) yythunkpos= 0;
+YY_VARIABLE(YYSTYPE  ) yy;
+YY_VARIABLE(YYSTYPE *) yyval= 0;
+YY_VARIABLE(YYSTYPE *) yyvals= 0;
+YY_VARIABLE(int      ) yyvalslen= 0;
+
+YY_LOCAL(int) yyrefill(void)
+{
+  int yyn;
+  while (yybuflen - yypos < 512)
+    {
+      yybuflen *= 2;
+      yybuf= YY_REALLOC(yybuf, yybuflen);
+    }
+  YY_INPUT((yybuf + yypos), yyn, (yybuflen - yypos));
+  if (!yyn) return 0;
+  yylimit += yyn;
+  return 1;
+}
+
+YY_LOCAL(int) yymatchDot(void)
+{
+  if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;
+  ++yypos;
+  return 1;
+}
+
+YY_LOCAL(int) yymatchChar(int c)
+{
+  if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;
+  if (yybuf[yypos] == c)
+    {
+      ++yypos;
+      yyprintf((stderr, "  ok   yymatchChar(%c) @ %s\n", c, yybuf+yypos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchChar(%c) @ %s\n", c, yybuf+yypos));
+  return 0;
+}
+
+YY_LOCAL(int) yymatchString(char *s)
+{
+  int yysav= yypos;
+  while (*s)
+    {
+      if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;
+      if (yybuf[yypos] != *s)
+        {
+          yypos= yysav;
+          return 0;
+        }
+      ++s;
+      ++yypos;
+    }
+  return 1;
+}
+
+YY_LOCAL(int) yymatchClass(unsigned char *bits)
+{
+  int c;
+  if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;
+  c= (unsigned char)yybuf[yypos];
+  if (bits[c >> 3] & (1 << (c & 7)))
+    {
+      ++yypos;
+      yyprintf((stderr, "  ok   yymatchClass @ %s\n", yybuf+yypos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchClass @ %s\n", yybuf+yypos));
+  return 0;
+}
+
+YY_LOCAL(void) yyDo(yyaction action, int begin, int end)
+{
+  while (YY_UNLIKELY(yythunkpos >= yythunkslen))
+    {
+      yythunkslen *= 2;
+      yythunks= YY_REALLOC(yythunks, sizeof(yythunk) * yythunkslen);
+    }
+  yythunks[yythunkpos].begin=  begin;
+  yythunks[yythunkpos].end=    end;
+  yythunks[yythunkpos].action= action;
+  ++yythunkpos;
+}
+
+YY_LOCAL(int) yyText(int begin, int end)
+{
+  int yyleng= end - begin;
+  if (yyleng <= 0)
+    yyleng= 0;
+  else
+    {
+      while (yytextlen < (yyleng + 1))
+	{
+	  yytextlen *= 2;
+	  yytext= YY_REALLOC(yytext, yytextlen);
+	}
+      memcpy(yytext, yybuf + begin, yyleng);
+    }
+  yytext[yyleng]= '\0';
+  return yyleng;
+}
+
+YY_LOCAL(void) yyDone(void)
+{
+  int pos;
+  for (pos= 0;  pos < yythunkpos;  ++pos)
+    {
+      yythunk *thunk= &yythunks[pos];
+      int yyleng= thunk->end ? yyText(thunk->begin, thunk->end) : thunk->begin;
+      yyprintf((stderr, "DO [%d] %p %s\n", pos, thunk->action, yytext));
+      YY_ACTION_POS(thunk->begin);
+      thunk->action(yytext, yyleng);
+    }
+  yythunkpos= 0;
+}
+
+YY_LOCAL(void) yyCommit()
+{
+  if ((yylimit -= yypos))
+    {
+      memmove(yybuf, yybuf + yypos, yylimit);
+    }
+  yybegin -= yypos;
+  yyend -= yypos;
+  yypos= yythunkpos= 0;
+}
+
+YY_LOCAL(int) yyAccept(int tp0)
+{
+  if (tp0)
+    {
+      fprintf(stderr, "accept denied at %d\n", tp0);
+      return 0;
+    }
+  else
+    {
+      yyDone();
+      yyCommit();
+    }
+  return 1;
+}
+
+YY_LOCAL(void) yyPush(char *text, int count)
+{
+  yyval += count;
+  while (yyval - yyvals >= yyvalslen)
+    {
+      int yyoff= yyval - yyvals;
+      yyvalslen *= 2;
+      yyvals= YY_REALLOC(yyvals, sizeof(YYSTYPE) * yyvalslen);
+      yyval= yyvals + yyoff;
+    }
+}
+YY_LOCAL(void) yyPop(char *text, int count)	{ yyval -= count; }
+YY_LOCAL(void) yySet(char *text, int count)	{ yyval[count]= yy; }
+
+#endif /* YY_PART */
+
+#define	YYACCEPT	yyAccept(yythunkpos0)
+
+YY_RULE(int) yy_MarkdownHtmlAttribute(); /* 336 */
+YY_RULE(int) YY_COLD yy_OPMLSetextHeading2(); /* 335 */
+YY_RULE(int) YY_COLD yy_OPMLSetextHeading1(); /* 334 */
+YY_RULE(int) YY_COLD yy_OPMLSetextHeading(); /* 333 */
+YY_RULE(int) YY_COLD yy_OPMLAtxHeading(); /* 332 */
+YY_RULE(int) YY_COLD yy_OPMLSectionBlock(); /* 331 */
+YY_RULE(int) YY_COLD yy_OPMLHeading(); /* 330 */
+YY_RULE(int) YY_COLD yy_OPMLPlain(); /* 329 */
+YY_RULE(int) YY_COLD yy_OPMLHeadingSection(); /* 328 */
+YY_RULE(int) YY_COLD yy_OPMLBlock(); /* 327 */
+YY_RULE(int) YY_COLD yy_DocForOPML(); /* 326 */
+YY_RULE(int) yy_RightAlign(); /* 325 */
+YY_RULE(int) yy_CenterAlign(); /* 324 */
+YY_RULE(int) yy_LeftAlign(); /* 323 */
+YY_RULE(int) yy_RightAlignWrap(); /* 322 */
+YY_RULE(int) yy_CenterAlignWrap(); /* 321 */
+YY_RULE(int) yy_LeftAlignWrap(); /* 320 */
+YY_RULE(int) yy_AlignmentCell(); /* 319 */
+YY_RULE(int) yy_CellStr(); /* 318 */
+YY_RULE(int) yy_FullCell(); /* 317 */
+YY_RULE(int) yy_EmptyCell(); /* 316 */
+YY_RULE(int) yy_ExtendedCell(); /* 315 */
+YY_RULE(int) yy_TableCell(); /* 314 */
+YY_RULE(int) yy_CellDivider(); /* 313 */
+YY_RULE(int) yy_TableLine(); /* 312 */
+YY_RULE(int) yy_TableRow(); /* 311 */
+YY_RULE(int) yy_Definition(); /* 310 */
+YY_RULE(int) yy_Term(); /* 309 */
+YY_RULE(int) yy_TermLine(); /* 308 */
+YY_RULE(int) yy_SeparatorLine(); /* 307 */
+YY_RULE(int) yy_TableBody(); /* 306 */
+YY_RULE(int) yy_TableCaption(); /* 305 */
+YY_RULE(int) yy_AutoLabels(); /* 304 */
+YY_RULE(int) YY_COLD yy_RawCitationReference(); /* 303 */
+YY_RULE(int) YY_COLD yy_CitationReferenceSingle(); /* 302 */
+YY_RULE(int) YY_COLD yy_CitationReferenceDouble(); /* 301 */
+YY_RULE(int) yy_Notes(); /* 300 */
+YY_RULE(int) yy_InlineNote(); /* 299 */
+YY_RULE(int) yy_RawNoteBlock(); /* 298 */
+YY_RULE(int) YY_COLD yy_GlossarySortKey(); /* 297 */
+YY_RULE(int) YY_COLD yy_GlossaryTerm(); /* 296 */
+YY_RULE(int) yy_RawNoteReference(); /* 295 */
+YY_RULE(int) yy_DoubleQuoteEnd(); /* 294 */
+YY_RULE(int) yy_DoubleQuoteStart(); /* 293 */
+YY_RULE(int) yy_SingleQuoteEnd(); /* 292 */
+YY_RULE(int) yy_SingleQuoteStart(); /* 291 */
+YY_RULE(int) yy_EnDash(); /* 290 */
+YY_RULE(int) yy_EmDash(); /* 289 */
+YY_RULE(int) yy_Apostrophe(); /* 288 */
+YY_RULE(int) yy_DoubleQuoted(); /* 287 */
+YY_RULE(int) yy_SingleQuoted(); /* 286 */
+YY_RULE(int) yy_Dash(); /* 285 */
+YY_RULE(int) yy_Ellipsis(); /* 284 */
+YY_RULE(int) yy_Digit(); /* 283 */
+YY_RULE(int) yy_NonAlphanumeric(); /* 282 */
+YY_RULE(int) yy_ExtendedSpecialChar(); /* 281 */
+YY_RULE(int) yy_Quoted(); /* 280 */
+YY_RULE(int) yy_HtmlTag(); /* 279 */
+YY_RULE(int) yy_Ticks5(); /* 278 */
+YY_RULE(int) yy_Ticks4(); /* 277 */
+YY_RULE(int) yy_Ticks3(); /* 276 */
+YY_RULE(int) yy_Ticks2(); /* 275 */
+YY_RULE(int) yy_Ticks1(); /* 274 */
+YY_RULE(int) yy_References(); /* 273 */
+YY_RULE(int) yy_EmptyTitle(); /* 272 */
+YY_RULE(int) yy_RefTitleParens(); /* 271 */
+YY_RULE(int) yy_RefTitleDouble(); /* 270 */
+YY_RULE(int) yy_RefTitleSingle(); /* 269 */
+YY_RULE(int) yy_UnQuotedValue(); /* 268 */
+YY_RULE(int) yy_QuotedValue(); /* 267 */
+YY_RULE(int) yy_AttrValue(); /* 266 */
+YY_RULE(int) yy_AttrKey(); /* 265 */
+YY_RULE(int) yy_Attribute(); /* 264 */
+YY_RULE(int) yy_Attributes(); /* 263 */
+YY_RULE(int) yy_RefTitle(); /* 262 */
+YY_RULE(int) yy_RefSrc(); /* 261 */
+YY_RULE(int) yy_AutoLinkEmail(); /* 260 */
+YY_RULE(int) yy_AutoLinkUrl(); /* 259 */
+YY_RULE(int) yy_TitleDouble(); /* 258 */
+YY_RULE(int) yy_TitleSingle(); /* 257 */
+YY_RULE(int) yy_Nonspacechar(); /* 256 */
+YY_RULE(int) yy_SourceContents(); /* 255 */
+YY_RULE(int) yy_Title(); /* 254 */
+YY_RULE(int) yy_Source(); /* 253 */
+YY_RULE(int) yy_Label(); /* 252 */
+YY_RULE(int) yy_ReferenceLinkSingle(); /* 251 */
+YY_RULE(int) yy_ReferenceLinkDouble(); /* 250 */
+YY_RULE(int) yy_AutoLink(); /* 249 */
+YY_RULE(int) yy_ReferenceLink(); /* 248 */
+YY_RULE(int) yy_ExplicitLink(); /* 247 */
+YY_RULE(int) yy_TwoUlClose(); /* 246 */
+YY_RULE(int) yy_TwoUlOpen(); /* 245 */
+YY_RULE(int) yy_TwoStarClose(); /* 244 */
+YY_RULE(int) yy_TwoStarOpen(); /* 243 */
+YY_RULE(int) yy_StrongUl(); /* 242 */
+YY_RULE(int) yy_StrongStar(); /* 241 */
+YY_RULE(int) yy_OneUlClose(); /* 240 */
+YY_RULE(int) yy_OneUlOpen(); /* 239 */
+YY_RULE(int) yy_OneStarClose(); /* 238 */
+YY_RULE(int) yy_OneStarOpen(); /* 237 */
+YY_RULE(int) yy_EmphUl(); /* 236 */
+YY_RULE(int) yy_EmphStar(); /* 235 */
+YY_RULE(int) yy_StarLine(); /* 234 */
+YY_RULE(int) yy_UlLine(); /* 233 */
+YY_RULE(int) yy_SpecialChar(); /* 232 */
+YY_RULE(int) yy_Eof(); /* 231 */
+YY_RULE(int) yy_NormalEndline(); /* 230 */
+YY_RULE(int) yy_TerminalEndline(); /* 229 */
+YY_RULE(int) yy_LineBreak(); /* 228 */
+YY_RULE(int) yy_CharEntity(); /* 227 */
+YY_RULE(int) yy_DecEntity(); /* 226 */
+YY_RULE(int) yy_HexEntity(); /* 225 */
+YY_RULE(int) yy_AposChunk(); /* 224 */
+YY_RULE(int) yy_Alphanumeric(); /* 223 */
+YY_RULE(int) yy_StrChunk(); /* 222 */
+YY_RULE(int) yy_NormalChar(); /* 221 */
+YY_RULE(int) yy_Symbol(); /* 220 */
+YY_RULE(int) yy_Smart(); /* 219 */
+YY_RULE(int) yy_EscapedChar(); /* 218 */
+YY_RULE(int) yy_Entity(); /* 217 */
+YY_RULE(int) yy_RawHtml(); /* 216 */
+YY_RULE(int) yy_Code(); /* 215 */
+YY_RULE(int) yy_NoteReference(); /* 214 */
+YY_RULE(int) yy_Link(); /* 213 */
+YY_RULE(int) yy_Image(); /* 212 */
+YY_RULE(int) YY_COLD yy_CitationReference(); /* 211 */
+YY_RULE(int) yy_Emph(); /* 210 */
+YY_RULE(int) yy_Strong(); /* 209 */
+YY_RULE(int) yy_Space(); /* 208 */
+YY_RULE(int) yy_UlOrStarLine(); /* 207 */
+YY_RULE(int) yy_MathSpan(); /* 206 */
+YY_RULE(int) yy_Str(); /* 205 */
+YY_RULE(int) yy_InStyleTags(); /* 204 */
+YY_RULE(int) yy_StyleClose(); /* 203 */
+YY_RULE(int) yy_StyleOpen(); /* 202 */
+YY_RULE(int) YY_COLD yy_HtmlBlockType(); /* 201 */
+YY_RULE(int) YY_COLD yy_HtmlBlockSelfClosing(); /* 200 */
+YY_RULE(int) yy_HtmlComment(); /* 199 */
+YY_RULE(int) yy_MarkdownHtmlTagOpen(); /* 198 */
+YY_RULE(int) YY_COLD yy_HtmlBlockInTags(); /* 197 */
+YY_RULE(int) YY_COLD yy_HtmlBlockScript(); /* 196 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseScript(); /* 195 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenScript(); /* 194 */
+YY_RULE(int) YY_COLD yy_HtmlBlockTr(); /* 193 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTr(); /* 192 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTr(); /* 191 */
+YY_RULE(int) YY_COLD yy_HtmlBlockThead(); /* 190 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseThead(); /* 189 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenThead(); /* 188 */
+YY_RULE(int) YY_COLD yy_HtmlBlockTh(); /* 187 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTh(); /* 186 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTh(); /* 185 */
+YY_RULE(int) YY_COLD yy_HtmlBlockTfoot(); /* 184 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTfoot(); /* 183 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTfoot(); /* 182 */
+YY_RULE(int) YY_COLD yy_HtmlBlockTd(); /* 181 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTd(); /* 180 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTd(); /* 179 */
+YY_RULE(int) YY_COLD yy_HtmlBlockTbody(); /* 178 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTbody(); /* 177 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTbody(); /* 176 */
+YY_RULE(int) YY_COLD yy_HtmlBlockLi(); /* 175 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseLi(); /* 174 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenLi(); /* 173 */
+YY_RULE(int) YY_COLD yy_HtmlBlockFrameset(); /* 172 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseFrameset(); /* 171 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenFrameset(); /* 170 */
+YY_RULE(int) YY_COLD yy_HtmlBlockDt(); /* 169 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseDt(); /* 168 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenDt(); /* 167 */
+YY_RULE(int) YY_COLD yy_HtmlBlockDd(); /* 166 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseDd(); /* 165 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenDd(); /* 164 */
+YY_RULE(int) YY_COLD yy_HtmlBlockVideo(); /* 163 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseVideo(); /* 162 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenVideo(); /* 161 */
+YY_RULE(int) YY_COLD yy_HtmlBlockUl(); /* 160 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseUl(); /* 159 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenUl(); /* 158 */
+YY_RULE(int) YY_COLD yy_HtmlBlockTable(); /* 157 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTable(); /* 156 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTable(); /* 155 */
+YY_RULE(int) YY_COLD yy_HtmlBlockSection(); /* 154 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseSection(); /* 153 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenSection(); /* 152 */
+YY_RULE(int) YY_COLD yy_HtmlBlockProgress(); /* 151 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseProgress(); /* 150 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenProgress(); /* 149 */
+YY_RULE(int) YY_COLD yy_HtmlBlockPre(); /* 148 */
+YY_RULE(int) YY_COLD yy_HtmlBlockClosePre(); /* 147 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenPre(); /* 146 */
+YY_RULE(int) YY_COLD yy_HtmlBlockP(); /* 145 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseP(); /* 144 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenP(); /* 143 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOl(); /* 142 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseOl(); /* 141 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenOl(); /* 140 */
+YY_RULE(int) YY_COLD yy_HtmlBlockNoscript(); /* 139 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseNoscript(); /* 138 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenNoscript(); /* 137 */
+YY_RULE(int) YY_COLD yy_HtmlBlockNoframes(); /* 136 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseNoframes(); /* 135 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenNoframes(); /* 134 */
+YY_RULE(int) YY_COLD yy_HtmlBlockMenu(); /* 133 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseMenu(); /* 132 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenMenu(); /* 131 */
+YY_RULE(int) YY_COLD yy_HtmlBlockH6(); /* 130 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH6(); /* 129 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH6(); /* 128 */
+YY_RULE(int) YY_COLD yy_HtmlBlockH5(); /* 127 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH5(); /* 126 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH5(); /* 125 */
+YY_RULE(int) YY_COLD yy_HtmlBlockH4(); /* 124 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH4(); /* 123 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH4(); /* 122 */
+YY_RULE(int) YY_COLD yy_HtmlBlockH3(); /* 121 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH3(); /* 120 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH3(); /* 119 */
+YY_RULE(int) YY_COLD yy_HtmlBlockH2(); /* 118 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH2(); /* 117 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH2(); /* 116 */
+YY_RULE(int) YY_COLD yy_HtmlBlockH1(); /* 115 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH1(); /* 114 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH1(); /* 113 */
+YY_RULE(int) YY_COLD yy_HtmlBlockHgroup(); /* 112 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseHgroup(); /* 111 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenHgroup(); /* 110 */
+YY_RULE(int) YY_COLD yy_HtmlBlockHeader(); /* 109 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseHeader(); /* 108 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenHeader(); /* 107 */
+YY_RULE(int) YY_COLD yy_HtmlBlockForm(); /* 106 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseForm(); /* 105 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenForm(); /* 104 */
+YY_RULE(int) YY_COLD yy_HtmlBlockFooter(); /* 103 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseFooter(); /* 102 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenFooter(); /* 101 */
+YY_RULE(int) YY_COLD yy_HtmlBlockFigure(); /* 100 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseFigure(); /* 99 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenFigure(); /* 98 */
+YY_RULE(int) YY_COLD yy_HtmlBlockFieldset(); /* 97 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseFieldset(); /* 96 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenFieldset(); /* 95 */
+YY_RULE(int) YY_COLD yy_HtmlBlockDl(); /* 94 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseDl(); /* 93 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenDl(); /* 92 */
+YY_RULE(int) YY_COLD yy_HtmlBlockDiv(); /* 91 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseDiv(); /* 90 */
+YY_RULE(int) YY_COLD yy_HtmlBlockDir(); /* 89 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseDir(); /* 88 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenDir(); /* 87 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCenter(); /* 86 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseCenter(); /* 85 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenCenter(); /* 84 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCanvas(); /* 83 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseCanvas(); /* 82 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenCanvas(); /* 81 */
+YY_RULE(int) YY_COLD yy_HtmlBlockBlockquote(); /* 80 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseBlockquote(); /* 79 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenBlockquote(); /* 78 */
+YY_RULE(int) YY_COLD yy_HtmlBlockAside(); /* 77 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseAside(); /* 76 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenAside(); /* 75 */
+YY_RULE(int) YY_COLD yy_HtmlBlockArticle(); /* 74 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseArticle(); /* 73 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenArticle(); /* 72 */
+YY_RULE(int) YY_COLD yy_HtmlBlockAddress(); /* 71 */
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseAddress(); /* 70 */
+YY_RULE(int) yy_HtmlAttribute(); /* 69 */
+YY_RULE(int) yy_Spnl(); /* 68 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenAddress(); /* 67 */
+YY_RULE(int) yy_OptionallyIndentedLine(); /* 66 */
+YY_RULE(int) yy_Indent(); /* 65 */
+YY_RULE(int) yy_ListBlockLine(); /* 64 */
+YY_RULE(int) yy_ListContinuationBlock(); /* 63 */
+YY_RULE(int) yy_ListBlock(); /* 62 */
+YY_RULE(int) yy_ListItem(); /* 61 */
+YY_RULE(int) yy_Enumerator(); /* 60 */
+YY_RULE(int) yy_ListItemTight(); /* 59 */
+YY_RULE(int) yy_ListLoose(); /* 58 */
+YY_RULE(int) yy_ListTight(); /* 57 */
+YY_RULE(int) yy_Spacechar(); /* 56 */
+YY_RULE(int) yy_Bullet(); /* 55 */
+YY_RULE(int) yy_VerbatimChunk(); /* 54 */
+YY_RULE(int) yy_IndentedLine(); /* 53 */
+YY_RULE(int) yy_NonblankIndentedLine(); /* 52 */
+YY_RULE(int) yy_Line(); /* 51 */
+YY_RULE(int) yy_BlockQuoteRaw(); /* 50 */
+YY_RULE(int) yy_Endline(); /* 49 */
+YY_RULE(int) yy_SetextBottom2(); /* 48 */
+YY_RULE(int) yy_SetextBottom1(); /* 47 */
+YY_RULE(int) yy_SetextHeading2(); /* 46 */
+YY_RULE(int) yy_SetextHeading1(); /* 45 */
+YY_RULE(int) yy_SetextHeading(); /* 44 */
+YY_RULE(int) yy_AtxHeading(); /* 43 */
+YY_RULE(int) yy_AtxStart(); /* 42 */
+YY_RULE(int) yy_Inline(); /* 41 */
+YY_RULE(int) yy_AutoLabel(); /* 40 */
+YY_RULE(int) yy_AtxInline(); /* 39 */
+YY_RULE(int) yy_Inlines(); /* 38 */
+YY_RULE(int) yy_NonindentSpace(); /* 37 */
+YY_RULE(int) yy_Heading(); /* 36 */
+YY_RULE(int) yy_HeadingSectionBlock(); /* 35 */
+YY_RULE(int) yy_Plain(); /* 34 */
+YY_RULE(int) yy_Para(); /* 33 */
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenDiv(); /* 32 */
+YY_RULE(int) yy_ImageBlock(); /* 31 */
+YY_RULE(int) yy_Table(); /* 30 */
+YY_RULE(int) yy_StyleBlock(); /* 29 */
+YY_RULE(int) YY_COLD yy_HtmlBlock(); /* 28 */
+YY_RULE(int) yy_BulletList(); /* 27 */
+YY_RULE(int) yy_OrderedList(); /* 26 */
+YY_RULE(int) yy_HeadingSection(); /* 25 */
+YY_RULE(int) yy_HorizontalRule(); /* 24 */
+YY_RULE(int) yy_Reference(); /* 23 */
+YY_RULE(int) yy_Note(); /* 22 */
+YY_RULE(int) YY_COLD yy_Glossary(); /* 21 */
+YY_RULE(int) yy_DefinitionList(); /* 20 */
+YY_RULE(int) yy_Verbatim(); /* 19 */
+YY_RULE(int) yy_BlockQuote(); /* 18 */
+YY_RULE(int) yy_RawLine(); /* 17 */
+YY_RULE(int) yy_BlankLine(); /* 16 */
+YY_RULE(int) yy_SingleLineMetaKeyValue(); /* 15 */
+YY_RULE(int) yy_AlphanumericAscii(); /* 14 */
+YY_RULE(int) yy_MetaDataValue(); /* 13 */
+YY_RULE(int) yy_SkipBlock(); /* 12 */
+YY_RULE(int) yy_MetaDataOnly(); /* 11 */
+YY_RULE(int) yy_MetaDataKeyValue(); /* 10 */
+YY_RULE(int) yy_MetaData(); /* 9 */
+YY_RULE(int) yy_Newline(); /* 8 */
+YY_RULE(int) yy_Sp(); /* 7 */
+YY_RULE(int) yy_MetaDataKey(); /* 6 */
+YY_RULE(int) yy_DocWithMetaData(); /* 5 */
+YY_RULE(int) yy_Block(); /* 4 */
+YY_RULE(int) yy_StartList(); /* 3 */
+YY_RULE(int) yy_BOM(); /* 2 */
+YY_RULE(int) yy_Doc(); /* 1 */
+
+YY_ACTION(void) yy_6_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_6_MarkdownHtmlTagOpen\n"));
+  
+                yy = mk_str_from_list(a,false);
+                yy->key = HTML;
+            ;
+#undef a
+}
+YY_ACTION(void) yy_5_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_5_MarkdownHtmlTagOpen\n"));
+   a = add_last(mk_token('>'), a);;
+#undef a
+}
+YY_ACTION(void) yy_4_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_4_MarkdownHtmlTagOpen\n"));
+  a = add_last(mk_token(' '), a);
+                a = add_last(mk_str(yytext), a);;
+#undef a
+}
+YY_ACTION(void) yy_3_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_MarkdownHtmlTagOpen\n"));
+  a = add_last(mk_token(' '), a);
+                a = add_last(mk_str(yytext), a);;
+#undef a
+}
+YY_ACTION(void) yy_2_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_MarkdownHtmlTagOpen\n"));
+  a = add_last(mk_str(yytext), a);;
+#undef a
+}
+YY_ACTION(void) yy_1_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_MarkdownHtmlTagOpen\n"));
+  a = add_last(mk_token('<'), a);;
+#undef a
+}
+YY_ACTION(void) yy_2_OPMLPlain(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_OPMLPlain\n"));
+   yy = mk_list(PLAIN, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OPMLPlain(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_OPMLPlain\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OPMLSetextHeading2(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_OPMLSetextHeading2\n"));
+  
+		yy = mk_str(yytext);
+		yy->key = H2;
+	;
+}
+YY_ACTION(void) yy_1_OPMLSetextHeading1(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_OPMLSetextHeading1\n"));
+  
+		yy = mk_str(yytext);
+		yy->key = H1;
+	;
+}
+YY_ACTION(void) yy_1_OPMLAtxHeading(char *yytext, int yyleng)
+{
+#define s yyval[-1]
+  yyprintf((stderr, "do yy_1_OPMLAtxHeading\n"));
+  
+        yy = mk_str(yytext);
+        yy->key = s->key;
+        g_free(s);
+    ;
+#undef s
+}
+YY_ACTION(void) yy_3_OPMLHeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_OPMLHeadingSection\n"));
+   yy = mk_list(HEADINGSECTION, a);;
+#undef a
+}
+YY_ACTION(void) yy_2_OPMLHeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_OPMLHeadingSection\n"));
+  a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OPMLHeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_OPMLHeadingSection\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_DocForOPML(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_DocForOPML\n"));
+   parse_result = close_list(a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_DocForOPML(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_DocForOPML\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_DocForOPML(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_DocForOPML\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_MathSpan(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_MathSpan\n"));
+  
+    /* Basically, these delimiters indicate math in LaTeX syntax, and the
+       delimiters are compatible with MathJax and LaTeX
+       ASCIIMathML is *not* supported */
+    yy = mk_str(yytext);
+    yy->key = MATHSPAN;
+;
+}
+YY_ACTION(void) yy_1_AutoLabel(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AutoLabel\n"));
+   
+    char *label = label_from_string(yytext,0);
+    yy = mk_str(label);
+    yy->key = AUTOLABEL;
+    g_free(label);
+;
+}
+YY_ACTION(void) yy_2_TableCaption(char *yytext, int yyleng)
+{
+#define c yyval[-1]
+#define a yyval[-2]
+#define b yyval[-3]
+  yyprintf((stderr, "do yy_2_TableCaption\n"));
+  
+    yy = a;
+    yy->key = TABLECAPTION;
+    if ( (b != NULL) && (b->key == TABLELABEL) ) {
+        b->next = yy->children;
+        yy->children = b;
+    }
+;
+#undef c
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_TableCaption(char *yytext, int yyleng)
+{
+#define c yyval[-1]
+#define a yyval[-2]
+#define b yyval[-3]
+  yyprintf((stderr, "do yy_1_TableCaption\n"));
+   b = c; b->key = TABLELABEL;;
+#undef c
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_RightAlign(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RightAlign\n"));
+   yy = mk_token('r');;
+}
+YY_ACTION(void) yy_1_RightAlignWrap(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RightAlignWrap\n"));
+   yy = mk_token('R');;
+}
+YY_ACTION(void) yy_1_CenterAlign(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_CenterAlign\n"));
+   yy = mk_token('c');;
+}
+YY_ACTION(void) yy_1_CenterAlignWrap(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_CenterAlignWrap\n"));
+   yy = mk_token('C');;
+}
+YY_ACTION(void) yy_1_LeftAlign(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_LeftAlign\n"));
+   yy = mk_token('l');;
+}
+YY_ACTION(void) yy_1_LeftAlignWrap(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_LeftAlignWrap\n"));
+   yy = mk_token('L');;
+}
+YY_ACTION(void) yy_2_SeparatorLine(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_SeparatorLine\n"));
+  
+        yy = mk_str_from_list(a,false);
+        yy->key = TABLESEPARATOR;
+    ;
+#undef a
+}
+YY_ACTION(void) yy_1_SeparatorLine(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_SeparatorLine\n"));
+   a = add_last(yy, a);;
+#undef a
+}
+YY_ACTION(void) yy_1_EmptyCell(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_EmptyCell\n"));
+   yy = mk_element(TABLECELL);;
+}
+YY_ACTION(void) yy_2_FullCell(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_FullCell\n"));
+   yy = mk_list(TABLECELL,a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_FullCell(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_FullCell\n"));
+   a = add_last(yy, a);
+#undef a
+}
+YY_ACTION(void) yy_1_CellStr(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_CellStr\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_ExtendedCell(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_ExtendedCell\n"));
+  
+        element *span;
+        span = mk_str(yytext);
+        span->key = CELLSPAN;
+        span->next = yy->children;
+        yy->children = span;
+    ;
+}
+YY_ACTION(void) yy_2_TableRow(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_TableRow\n"));
+   yy = mk_list(TABLEROW, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_TableRow(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_TableRow\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_TableBody(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_TableBody\n"));
+   yy = mk_list(TABLEBODY, a);;
+#undef a
+}
+YY_ACTION(void) yy_1_TableBody(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_TableBody\n"));
+  a = add_last(yy, a);;
+#undef a
+}
+YY_ACTION(void) yy_7_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_7_Table\n"));
+  
+        if (b != NULL) { a = add_first(b, a); };
+        yy = mk_list(TABLE, a);
+    ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_6_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_6_Table\n"));
+   b = add_last(yy, b);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_5_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_5_Table\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_4_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_4_Table\n"));
+   a = add_last(yy, a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_Table\n"));
+   a = add_first(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_Table\n"));
+   yy->key = TABLEHEAD; a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_Table\n"));
+   b = add_last(yy, b);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_7_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_7_Definition\n"));
+   if (b != NULL) { a = add_last(b, a);}
+                element *raw = mk_str_from_list(a, false);
+                raw->key = RAW;
+                yy = mk_list(DEFINITION, add_last(raw, NULL));
+            ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_6_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_6_Definition\n"));
+   a = add_last(mk_token('\n'), a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_5_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_5_Definition\n"));
+   a = add_last(mk_str(yytext), a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_4_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_4_Definition\n"));
+  a = add_last(mk_token('\n'), a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_Definition\n"));
+   a = add_last(mk_str(yytext), a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_Definition\n"));
+   a = add_last(mk_str(yytext), a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_Definition\n"));
+   b = add_last(mk_token('\n'), b); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Term(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Term\n"));
+  
+            yy = mk_list(TERM,a);
+        ;
+#undef a
+}
+YY_ACTION(void) yy_1_Term(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Term\n"));
+  a = add_last(yy, a);;
+#undef a
+}
+YY_ACTION(void) yy_3_DefinitionList(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_DefinitionList\n"));
+   yy = mk_list(LIST, a);
+                    yy->key = DEFLIST;
+                ;
+#undef a
+}
+YY_ACTION(void) yy_2_DefinitionList(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_DefinitionList\n"));
+   a = add_last(yy, a);;
+#undef a
+}
+YY_ACTION(void) yy_1_DefinitionList(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_DefinitionList\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_7_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_7_AutoLabels\n"));
+   labels = close_list(a); ;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_6_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_6_AutoLabels\n"));
+  
+                GString *label = g_string_new("");
+                char *lab;
+                if (c->children->key == TABLELABEL) {
+                    print_raw_element_list(label, c->children->children);
+                } else {
+                    print_raw_element_list(label, c->children);
+                }
+                lab = label_from_string(label->str,0);
+                a = add_last(mk_str(lab), a);
+                g_free(lab);
+                g_string_free(label,true);
+                free_element_list(c);;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_5_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_5_AutoLabels\n"));
+   free_element_list(d); ;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_4_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_4_AutoLabels\n"));
+   free_element_list(d); ;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_3_AutoLabels\n"));
+   free_element_list(d); ;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_2_AutoLabels\n"));
+  
+                GString *label = g_string_new("");
+                char *lab;
+                if (c->children->key == TABLELABEL) {
+                    print_raw_element_list(label, c->children->children);
+                } else {
+                    print_raw_element_list(label, c->children);
+                }
+                lab = label_from_string(label->str,0);
+                a = add_last(mk_str(lab), a);
+                g_free(lab);
+                g_string_free(label,true);
+                free_element_list(c);;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_1_AutoLabels\n"));
+   
+                GString *label = g_string_new("");
+                char *lab;
+                print_raw_element_list(label, b->children);
+                if (b->children->key == AUTOLABEL) {
+                    lab = label_from_string(b->children->contents.str,0);
+                } else {
+                    lab = label_from_string(label->str,0);
+                }
+                a = add_last(mk_str(lab), a);
+                g_free(lab);
+                g_string_free(label,true);
+                /* footnotes in the heading borrow their text from the notes */
+                detach_shared_notes(b);
+                free_element_list(b);
+            ;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_RawCitationReference(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RawCitationReference\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_CitationReferenceSingle(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+  yyprintf((stderr, "do yy_1_CitationReferenceSingle\n"));
+     element *match;
+                    if (find_note(&match, ref->contents.str) ||
+                        (match = bibliography_note(ref->contents.str)) != NULL) {
+                        yy = mk_element(CITATION);
+                        assert(match->children != NULL);
+                        yy->children = match->children;
+                        yy->contents.str = g_strdup(ref->contents.str);
+                    } else {
+                        char *s;
+                        s = g_malloc(strlen(ref->contents.str) + 4);
+                        sprintf(s, "[#%s]", ref->contents.str);
+                        yy = mk_str(s);
+                        yy->key = CITATION;
+                        g_free(s);
+                    }
+                    free_element(ref);
+                ;
+#undef ref
+}
+YY_ACTION(void) yy_1_CitationReferenceDouble(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define b yyval[-2]
+  yyprintf((stderr, "do yy_1_CitationReferenceDouble\n"));
+     element *match;
+                    if (find_note(&match, ref->contents.str) ||
+                        (match = bibliography_note(ref->contents.str)) != NULL) {
+                        /* This citation is specified within the document,
+                           or in the shared bibliography */
+                        yy = mk_element(CITATION);
+                        assert(match->children != NULL);
+                        b->next = match->children;
+                        b->key = LOCATOR;
+                        yy->children = b;
+                        yy->contents.str = g_strdup(ref->contents.str);
+                    } else {
+                        /* Citation not specified - likely bibtex citation */
+                        /* TODO: fix this - need to print label as well */
+                        char *s;
+                        s = g_malloc(strlen(ref->contents.str) + 4);
+                        sprintf(s, "[#%s]", ref->contents.str);
+                        yy = mk_str(s);
+                        yy->key = CITATION;
+                        b->key = LOCATOR;
+                        yy->children = b;
+                        g_free(s);
+                    }
+                    GString *label = g_string_new("");
+                    char *lab;
+                    print_raw_element_list(label, b->children);
+                    lab = label_from_string(label->str,0);
+                    if (strcmp(lab,"notcited") == 0 ) {
+                        yy->key = NOCITATION;
+                    }
+                    g_string_free(label, true);
+                    g_free(lab);
+                    free_element(ref);
+                ;
+#undef ref
+#undef b
+}
+YY_ACTION(void) yy_3_RawNoteBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_RawNoteBlock\n"));
+     yy = mk_str_from_list(a, true);
+                    yy->key = RAW;
+                ;
+#undef a
+}
+YY_ACTION(void) yy_2_RawNoteBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_RawNoteBlock\n"));
+   a = add_last(mk_str(yytext), a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_RawNoteBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_RawNoteBlock\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_Notes(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_Notes\n"));
+   notes = close_list(a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Notes(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_Notes\n"));
+   a = add_last(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_InlineNote(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_InlineNote\n"));
+   yy = mk_list(NOTE, a);
+                  yy->contents.str = 0; ;
+#undef a
+}
+YY_ACTION(void) yy_1_InlineNote(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_InlineNote\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_Note(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+#define ref yyval[-2]
+  yyprintf((stderr, "do yy_3_Note\n"));
+     element *label;
+                    label = mk_str(ref->contents.str);
+                    label->key = NOTELABEL;
+                    a = add_last(label, a);
+                    yy = mk_list(NOTE, a);
+                    yy->contents.str = g_strdup(ref->contents.str);
+                    free_element(ref);
+                ;
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_2_Note(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+#define ref yyval[-2]
+  yyprintf((stderr, "do yy_2_Note\n"));
+   a = add_last(yy, a); ;
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_1_Note(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+#define ref yyval[-2]
+  yyprintf((stderr, "do yy_1_Note\n"));
+   a = add_last(yy, a); ;
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_1_GlossarySortKey(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_GlossarySortKey\n"));
+   yy = mk_str(yytext);
+        yy->key = GLOSSARYSORTKEY; ;
+}
+YY_ACTION(void) yy_1_GlossaryTerm(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_GlossaryTerm\n"));
+   
+        yy = mk_list(LIST, NULL);
+        yy->contents.str = 0;
+        yy->children = mk_str(yytext);
+        yy->key = GLOSSARYTERM;
+    ;
+}
+YY_ACTION(void) yy_5_Glossary(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_5_Glossary\n"));
+   yy = mk_list(GLOSSARY, a);
+                yy->contents.str = g_strdup(ref->contents.str);
+                free_element(ref);
+            ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_4_Glossary(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_4_Glossary\n"));
+   a = add_last(yy, a); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_3_Glossary(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_Glossary\n"));
+   a = add_last(yy, a); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_2_Glossary(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_Glossary\n"));
+   a = add_last(yy, a); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_1_Glossary(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_Glossary\n"));
+   a = add_last(yy, a); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_1_RawNoteReference(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RawNoteReference\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_NoteReference(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+  yyprintf((stderr, "do yy_1_NoteReference\n"));
+     element *match;
+                    if (find_note(&match, ref->contents.str)) {
+                        yy = mk_element(NOTE);
+                        assert(match->children != NULL);
+                        yy->children = match->children;
+                        yy->contents.str = 0;
+                    } else {
+                        char *s;
+                        s = g_malloc(strlen(ref->contents.str) + 4);
+                        sprintf(s, "[^%s]", ref->contents.str);
+                        yy = mk_str(s);
+                        g_free(s);
+                    }
+                    free_element(ref);
+                ;
+#undef ref
+}
+YY_ACTION(void) yy_2_DoubleQuoted(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_DoubleQuoted\n"));
+   yy = mk_list(DOUBLEQUOTED, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_DoubleQuoted(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_DoubleQuoted\n"));
+   a = add_last(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_SingleQuoted(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_SingleQuoted\n"));
+   yy = mk_list(SINGLEQUOTED, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_SingleQuoted(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_SingleQuoted\n"));
+   a = add_last(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_EmDash(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_EmDash\n"));
+   yy = mk_element(EMDASH);
+            yy->contents.str  = g_strdup(yytext);
+         ;
+}
+YY_ACTION(void) yy_1_EnDash(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_EnDash\n"));
+   yy = mk_element(ENDASH); 
+            yy->contents.str  = g_strdup(yytext);
+         ;
+}
+YY_ACTION(void) yy_1_Ellipsis(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Ellipsis\n"));
+   yy = mk_element(ELLIPSIS); ;
+}
+YY_ACTION(void) yy_1_Apostrophe(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Apostrophe\n"));
+   yy = mk_element(APOSTROPHE); ;
+}
+YY_ACTION(void) yy_1_SkipBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_SkipBlock\n"));
+   free_element_list(a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Line(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Line\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_StartList(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_StartList\n"));
+   yy = NULL; ;
+}
+YY_ACTION(void) yy_1_RawHtml(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RawHtml\n"));
+     if (extension(EXT_FILTER_HTML)) {
+                    yy = mk_list(LIST, NULL);
+                } else {
+                    yy = mk_str(yytext);
+                    yy->key = HTML;
+                }
+            ;
+}
+YY_ACTION(void) yy_1_Code(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Code\n"));
+   yy = mk_str(yytext); yy->key = CODE; ;
+}
+YY_ACTION(void) yy_2_References(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_References\n"));
+   references = close_list(a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_References(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_References\n"));
+   a = add_last(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_RefTitle(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RefTitle\n"));
+   yy = mk_str(yytext); 
+                yy->key = RAW;;
+}
+YY_ACTION(void) yy_1_RefSrc(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RefSrc\n"));
+   yy = mk_str(yytext); 
+           yy->key = HTML; ;
+}
+YY_ACTION(void) yy_2_Label(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Label\n"));
+   yy = mk_list(LIST, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Label(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Label\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_AttrValue(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AttrValue\n"));
+   yy = mk_str(yytext);
+            yy->key = ATTRVALUE;
+        ;
+}
+YY_ACTION(void) yy_1_AttrKey(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AttrKey\n"));
+  
+            char *lab;
+            lab = label_from_string(yytext,0);
+            yy = mk_str(lab);
+            yy->key = ATTRKEY;
+            g_free(lab);
+        ;
+}
+YY_ACTION(void) yy_1_Attribute(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_Attribute\n"));
+   
+        yy = a;
+        yy->children = b;
+    ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Attributes(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Attributes\n"));
+   yy = mk_list(LIST,a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Attributes(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Attributes\n"));
+   a =add_last(yy, a);;
+#undef a
+}
+YY_ACTION(void) yy_2_Reference(char *yytext, int yyleng)
+{
+#define t yyval[-1]
+#define s yyval[-2]
+#define l yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_2_Reference\n"));
+   
+            char *label;
+            GString *text = g_string_new("");
+            print_raw_element_list(text, l->children);
+            label = label_from_string(text->str,0);
+            if (a == NULL) {
+                yy = mk_link(l->children, s->contents.str,
+                    t->contents.str, a, label);
+            } else {
+                yy = mk_link(l->children, s->contents.str,
+                    t->contents.str, a->children, label);
+            }
+            free_element(s);
+            free_element(t);
+            g_free(l);
+            g_free(a);
+            g_free(label);
+            g_string_free(text, TRUE);
+            yy->key = REFERENCE;
+        ;
+#undef t
+#undef s
+#undef l
+#undef a
+}
+YY_ACTION(void) yy_1_Reference(char *yytext, int yyleng)
+{
+#define t yyval[-1]
+#define s yyval[-2]
+#define l yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_1_Reference\n"));
+   a = yy; ;
+#undef t
+#undef s
+#undef l
+#undef a
+}
+YY_ACTION(void) yy_1_AutoLinkEmail(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AutoLinkEmail\n"));
+     char *mailto = g_malloc(strlen(yytext) + 8);
+                    sprintf(mailto, "mailto:%s", yytext);
+                    yy = mk_link(mk_str(yytext), mailto, "", NULL, "");
+                    g_free(mailto);
+                ;
+}
+YY_ACTION(void) yy_1_AutoLinkUrl(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AutoLinkUrl\n"));
+     yy = mk_link(mk_str(yytext), yytext, "", NULL, ""); ;
+}
+YY_ACTION(void) yy_1_Title(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Title\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_Source(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Source\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_ExplicitLink(char *yytext, int yyleng)
+{
+#define t yyval[-1]
+#define s yyval[-2]
+#define l yyval[-3]
+  yyprintf((stderr, "do yy_1_ExplicitLink\n"));
+  
+                    yy = mk_link(l->children, s->contents.str, t->contents.str, NULL, "");
+                    free_element(s);
+                    free_element(t);
+                    g_free(l);
+                ;
+#undef t
+#undef s
+#undef l
+}
+YY_ACTION(void) yy_1_ReferenceLinkSingle(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ReferenceLinkSingle\n"));
+     link match;
+                           if (find_reference(&match, a->children)) {
+                               yy = mk_link(a->children, match.url, match.title, match.attr, match.identifier);
+                               g_free(a);
+                           } else if ( !extension(EXT_COMPATIBILITY) && 
+                            find_label(&match, a->children)) {
+                                GString *text = g_string_new("");
+                                print_raw_element_list(text, a->children);
+                                char *lab = label_from_string(text->str,0);
+                                GString *label = g_string_new(lab);
+                                g_string_prepend(label,"#");
+                                yy = mk_link(a->children, label->str, "", NULL, lab);
+                                g_string_free(text, TRUE);
+                                g_string_free(label, TRUE);
+                                g_free(lab);
+                                g_free(a);
+                           } else {
+                               element *result;
+                               result = mk_element(LIST);
+                               result->children = cons(mk_token('['), cons(a, cons(mk_token(']'), mk_str(yytext))));
+                               yy = result;
+                           }
+                       ;
+#undef a
+}
+YY_ACTION(void) yy_1_ReferenceLinkDouble(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_ReferenceLinkDouble\n"));
+     link match;
+                           if (find_reference(&match, b->children)) {
+                               yy = mk_link(a->children, match.url, match.title, match.attr, match.identifier);
+                               g_free(a);
+                               free_element_list(b);
+                           } else if ( !extension(EXT_COMPATIBILITY) && 
+                            find_label(&match, b->children)) {
+                                GString *text = g_string_new("");
+                                print_raw_element_list(text, b->children);
+                                char *lab = label_from_string(text->str,0);
+                                GString *label = g_string_new(lab);
+                                g_string_prepend(label,"#");
+                                yy = mk_link(a->children, label->str, "", NULL, lab);
+                                g_free(lab);
+                                g_string_free(text, TRUE);
+                                g_string_free(label, TRUE);
+                                g_free(a);
+                                free_element_list(b);
+                            } else {
+                               element *result;
+                               result = mk_element(LIST);
+                               result->children = cons(mk_token('['), cons(a, cons(mk_token(']'), cons(mk_token('['), cons(b, mk_token(']'))))));
+                               yy = result;
+                           }
+                       ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Image(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Image\n"));
+   if (yy->key == LINK) {
+              yy->key = IMAGE;
+          } else {
+              element *result;
+              result = yy;
+              yy->children = cons(mk_token('!'), result->children);
+          } ;
+}
+YY_ACTION(void) yy_1_ImageBlock(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_ImageBlock\n"));
+   if (yy->key == IMAGE) yy->key = IMAGEBLOCK; ;
+}
+YY_ACTION(void) yy_3_StrongUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_StrongUl\n"));
+   yy = mk_list(STRONG, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_StrongUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_StrongUl\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_StrongUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_StrongUl\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_TwoUlClose(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_TwoUlClose\n"));
+   yy = a; ;
+#undef a
+}
+YY_ACTION(void) yy_3_StrongStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_StrongStar\n"));
+   yy = mk_list(STRONG, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_StrongStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_StrongStar\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_StrongStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_StrongStar\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_TwoStarClose(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_TwoStarClose\n"));
+   yy = a; ;
+#undef a
+}
+YY_ACTION(void) yy_3_EmphUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_EmphUl\n"));
+   yy = mk_list(EMPH, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_EmphUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_EmphUl\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_EmphUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_EmphUl\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OneUlClose(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_OneUlClose\n"));
+   yy = a; ;
+#undef a
+}
+YY_ACTION(void) yy_3_EmphStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_EmphStar\n"));
+   yy = mk_list(EMPH, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_EmphStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_EmphStar\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_EmphStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_EmphStar\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OneStarClose(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_OneStarClose\n"));
+   yy = a; ;
+#undef a
+}
+YY_ACTION(void) yy_1_UlOrStarLine(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_UlOrStarLine\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_Symbol(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Symbol\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_LineBreak(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_LineBreak\n"));
+   free_element_list(a);
+              yy = mk_element(LINEBREAK); ;
+#undef a
+}
+YY_ACTION(void) yy_1_TerminalEndline(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_TerminalEndline\n"));
+   yy = NULL; ;
+}
+YY_ACTION(void) yy_1_NormalEndline(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_NormalEndline\n"));
+   yy = mk_token('\n');
+                    yy->key = SPACE; ;
+}
+YY_ACTION(void) yy_1_Entity(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Entity\n"));
+   yy = mk_str(yytext); yy->key = HTML; ;
+}
+YY_ACTION(void) yy_1_EscapedChar(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_EscapedChar\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_AposChunk(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AposChunk\n"));
+   yy = mk_element(APOSTROPHE); ;
+}
+YY_ACTION(void) yy_1_StrChunk(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_StrChunk\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_3_Str(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_Str\n"));
+   if (a->next == a) { yy = close_list(a); } else { yy = mk_list(LIST, a); } ;
+#undef a
+}
+YY_ACTION(void) yy_2_Str(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Str\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Str(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Str\n"));
+   a = add_last(mk_str(yytext), a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Space(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Space\n"));
+   yy = mk_token(' ');
+          yy->key = SPACE; ;
+}
+YY_ACTION(void) yy_4_Inlines(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define a yyval[-3]
+  yyprintf((stderr, "do yy_4_Inlines\n"));
+   yy = mk_list(LIST, a); ;
+#undef d
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_3_Inlines(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define a yyval[-3]
+  yyprintf((stderr, "do yy_3_Inlines\n"));
+   free_element_list(d); ;
+#undef d
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_2_Inlines(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define a yyval[-3]
+  yyprintf((stderr, "do yy_2_Inlines\n"));
+   a = add_last(c, a); ;
+#undef d
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_1_Inlines(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define a yyval[-3]
+  yyprintf((stderr, "do yy_1_Inlines\n"));
+   a = add_last(yy, a); ;
+#undef d
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_1_StyleBlock(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_StyleBlock\n"));
+     if (extension(EXT_FILTER_STYLES)) {
+                        yy = mk_list(LIST, NULL);
+                    } else {
+                        yy = mk_str(yytext);
+                        yy->key = HTMLBLOCK;
+                    }
+                ;
+}
+YY_ACTION(void) yy_1_HtmlBlock(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_HtmlBlock\n"));
+     if (extension(EXT_FILTER_HTML)) {
+                    yy = mk_list(LIST, NULL);
+                } else {
+                    yy = mk_str(yytext);
+                    if ( extension(EXT_PROCESS_HTML)) yy->key = RAW;
+                        else yy->key = HTMLBLOCK;
+                }
+            ;
+}
+YY_ACTION(void) yy_1_OrderedList(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_OrderedList\n"));
+   yy->key = ORDEREDLIST; ;
+}
+YY_ACTION(void) yy_3_ListContinuationBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_ListContinuationBlock\n"));
+    yy = mk_str_from_list(a, false); ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListContinuationBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_ListContinuationBlock\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListContinuationBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ListContinuationBlock\n"));
+     if (strlen(yytext) == 0)
+                                   a = add_last(mk_token('\001'), a); /* block separator */
+                              else
+                                   a = add_last(mk_str(yytext), a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_ListBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_ListBlock\n"));
+   yy = mk_str_from_list(a, false); ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_ListBlock\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ListBlock\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_ListItemTight(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_ListItemTight\n"));
+    element *raw;
+               raw = mk_str_from_list(a, false);
+               raw->key = RAW;
+               yy = mk_element(LISTITEM);
+               yy->children = raw;
+            ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListItemTight(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_ListItemTight\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListItemTight(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ListItemTight\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_ListItem(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_ListItem\n"));
+    element *raw;
+               raw = mk_str_from_list(a, false);
+               raw->key = RAW;
+               yy = mk_element(LISTITEM);
+               yy->children = raw;
+            ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListItem(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_ListItem\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListItem(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ListItem\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListLoose(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_ListLoose\n"));
+   yy = mk_list(LIST, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_ListLoose(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_ListLoose\n"));
+     element *li;
+                  li = b->children;
+                  li->contents.str = g_realloc(li->contents.str, strlen(li->contents.str) + 3);
+                  strcat(li->contents.str, "\n\n");  /* In loose list, \n\n added to end of each element */
+                  a = add_last(b, a);
+              ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_ListTight(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_ListTight\n"));
+   yy = mk_list(LIST, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListTight(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ListTight\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_BulletList(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_BulletList\n"));
+   yy->key = BULLETLIST; ;
+}
+YY_ACTION(void) yy_1_HorizontalRule(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_HorizontalRule\n"));
+   yy = mk_element(HRULE); ;
+}
+YY_ACTION(void) yy_2_Verbatim(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Verbatim\n"));
+   yy = mk_str_from_list(a, false);
+                 yy->key = VERBATIM; ;
+#undef a
+}
+YY_ACTION(void) yy_1_Verbatim(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Verbatim\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_VerbatimChunk(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_VerbatimChunk\n"));
+   yy = mk_str_from_list(a, false); ;
+#undef a
+}
+YY_ACTION(void) yy_2_VerbatimChunk(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_VerbatimChunk\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_VerbatimChunk(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_VerbatimChunk\n"));
+   a = add_last(mk_token('\n'), a); ;
+#undef a
+}
+YY_ACTION(void) yy_4_BlockQuoteRaw(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_4_BlockQuoteRaw\n"));
+     yy = mk_str_from_list(a, true);
+                     yy->key = RAW;
+                 ;
+#undef a
+}
+YY_ACTION(void) yy_3_BlockQuoteRaw(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_BlockQuoteRaw\n"));
+   a = add_last(mk_token('\n'), a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_BlockQuoteRaw(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_BlockQuoteRaw\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_BlockQuoteRaw(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_BlockQuoteRaw\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_BlockQuote(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_BlockQuote\n"));
+    yy = mk_element(BLOCKQUOTE);
+                yy->children = a;
+             ;
+#undef a
+}
+YY_ACTION(void) yy_3_HeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_HeadingSection\n"));
+   yy = mk_list(HEADINGSECTION, a);;
+#undef a
+}
+YY_ACTION(void) yy_2_HeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_HeadingSection\n"));
+  a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_HeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_HeadingSection\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_SetextHeading2(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_SetextHeading2\n"));
+   yy = mk_list(H2, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_SetextHeading2(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_SetextHeading2\n"));
+   a = add_first(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_SetextHeading2(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_SetextHeading2\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_SetextHeading1(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_SetextHeading1\n"));
+   yy = mk_list(H1, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_SetextHeading1(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_SetextHeading1\n"));
+   a = add_first(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_SetextHeading1(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_SetextHeading1\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_AtxHeading(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+#define s yyval[-3]
+  yyprintf((stderr, "do yy_3_AtxHeading\n"));
+   yy = mk_list(s->key,a);
+            g_free(s); ;
+#undef b
+#undef a
+#undef s
+}
+YY_ACTION(void) yy_2_AtxHeading(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+#define s yyval[-3]
+  yyprintf((stderr, "do yy_2_AtxHeading\n"));
+   a = add_first(b, a); ;
+#undef b
+#undef a
+#undef s
+}
+YY_ACTION(void) yy_1_AtxHeading(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+#define s yyval[-3]
+  yyprintf((stderr, "do yy_1_AtxHeading\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+#undef s
+}
+YY_ACTION(void) yy_1_AtxStart(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AtxStart\n"));
+   yy = mk_element(H1 + (strlen(yytext) - 1)); ;
+}
+YY_ACTION(void) yy_1_Plain(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Plain\n"));
+   yy = a; yy->key = PLAIN; ;
+#undef a
+}
+YY_ACTION(void) yy_1_Para(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Para\n"));
+   yy = a; yy->key = PARA; ;
+#undef a
+}
+YY_ACTION(void) yy_4_MetaDataValue(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_4_MetaDataValue\n"));
+   yy = mk_str_from_list(a,false);
+                    trim_trailing_whitespace(yy->contents.str);
+                    yy->key = METAVALUE;
+                ;
+#undef a
+}
+YY_ACTION(void) yy_3_MetaDataValue(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_MetaDataValue\n"));
+   a = add_last(mk_str(yytext), a);;
+#undef a
+}
+YY_ACTION(void) yy_2_MetaDataValue(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_MetaDataValue\n"));
+   a = add_last(mk_token('\n'), a);;
+#undef a
+}
+YY_ACTION(void) yy_1_MetaDataValue(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_MetaDataValue\n"));
+   a = add_last(mk_str(yytext), a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_MetaDataKey(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_MetaDataKey\n"));
+  
+    char *label = label_from_string(yytext,0);
+    yy = mk_str(label);
+    g_free(label);
+    yy->key = METAKEY;
+;
+}
+YY_ACTION(void) yy_1_MetaDataKeyValue(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_MetaDataKeyValue\n"));
+   yy = a;
+                yy->children = b;
+            ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_MetaDataOnly(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_MetaDataOnly\n"));
+   parse_result = mk_list(LIST,a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_MetaDataOnly(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_MetaDataOnly\n"));
+   a = add_last(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_MetaData(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_MetaData\n"));
+   yy = mk_list(LIST, a);
+                yy->key = METADATA;
+            ;
+#undef a
+}
+YY_ACTION(void) yy_1_MetaData(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_MetaData\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_DocWithMetaData(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_DocWithMetaData\n"));
+   if (b != NULL) a = add_last(b, a);
+        parse_result = close_list(a);
+    ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_DocWithMetaData(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_DocWithMetaData\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_DocWithMetaData(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_DocWithMetaData\n"));
+   a = add_last(yy, a); b = mk_element(FOOTER);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Doc(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Doc\n"));
+   parse_result = close_list(a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Doc(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Doc\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+
+YY_RULE(int) yy_MarkdownHtmlAttribute()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "MarkdownHtmlAttribute"));
+  {  int yypos2= yypos, yythunkpos2= yythunkpos;  if (!yymatchString("markdown")) goto l3;  goto l2;
+  l3:;	  yypos= yypos2; yythunkpos= yythunkpos2;  if (!yymatchString("MARKDOWN")) goto l1;
+  }
+  l2:;	  if (!yy_Spnl()) goto l1;  if (!yymatchChar('=')) goto l1;  if (!yy_Spnl()) goto l1;
+  {  int yypos4= yypos, yythunkpos4= yythunkpos;  if (!yymatchChar('"')) goto l4;  if (!yy_Spnl()) goto l4;  goto l5;
+  l4:;	  yypos= yypos4; yythunkpos= yythunkpos4;
+  }
+  l5:;	  if (!yymatchChar('1')) goto l1;
+  {  int yypos6= yypos, yythunkpos6= yythunkpos;  if (!yy_Spnl()) goto l6;  if (!yymatchChar('"')) goto l6;  goto l7;
+  l6:;	  yypos= yypos6; yythunkpos= yythunkpos6;
+  }
+  l7:;	  if (!yy_Spnl()) goto l1;
+  yyprintf((stderr, "  ok   %s @ %s\n", "MarkdownHtmlAttribute", yybuf+yypos));
+  return 1;
+  l1:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MarkdownHtmlAttribute", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_OPMLSetextHeading2()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "OPMLSetextHeading2"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l8;
+  l9:;	
+  {  int yypos10= yypos, yythunkpos10= yythunkpos;  if (!yymatchClass((unsigned char *)"\377\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l10;  goto l9;
+  l10:;	  yypos= yypos10; yythunkpos= yythunkpos10;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l8;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l8;
+  }  if (!yy_SetextBottom2()) goto l8;  yyDo(yy_1_OPMLSetextHeading2, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLSetextHeading2", yybuf+yypos));
+  return 1;
+  l8:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLSetextHeading2", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_OPMLSetextHeading1()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "OPMLSetextHeading1"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l11;
+  l12:;	
+  {  int yypos13= yypos, yythunkpos13= yythunkpos;  if (!yymatchClass((unsigned char *)"\377\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l13;  goto l12;
+  l13:;	  yypos= yypos13; yythunkpos= yythunkpos13;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l11;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l11;
+  }  if (!yy_SetextBottom1()) goto l11;  yyDo(yy_1_OPMLSetextHeading1, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLSetextHeading1", yybuf+yypos));
+  return 1;
+  l11:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLSetextHeading1", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_OPMLSetextHeading()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "OPMLSetextHeading"));
+  {  int yypos15= yypos, yythunkpos15= yythunkpos;  if (!yy_OPMLSetextHeading1()) goto l16;  goto l15;
+  l16:;	  yypos= yypos15; yythunkpos= yythunkpos15;  if (!yy_OPMLSetextHeading2()) goto l14;
+  }
+  l15:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLSetextHeading", yybuf+yypos));
+  return 1;
+  l14:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLSetextHeading", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_OPMLAtxHeading()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OPMLAtxHeading"));
+  {  int yypos18= yypos, yythunkpos18= yythunkpos;  /* Heading */
+  {
+  {  int yypos19= yypos, yythunkpos19= yythunkpos;  /* SetextHeading */
+  {
+  {  int yypos21= yypos, yythunkpos21= yythunkpos;  if (!yy_SetextHeading1()) goto l22;  goto l21;
+  l22:;	  yypos= yypos21; yythunkpos= yythunkpos21;  if (!yy_SetextHeading2()) goto l20;
+  }
+  l21:;	
+  }  goto l19;
+  l20:;	  yypos= yypos19; yythunkpos= yythunkpos19;  if (!yy_AtxHeading()) goto l17;
+  }
+  l19:;	
+  }  yypos= yypos18; yythunkpos= yythunkpos18;
+  }  if (!yy_AtxStart()) goto l17;  yyDo(yySet, -1, 0);
+  {  int yypos23= yypos, yythunkpos23= yythunkpos;  /* Sp */
+  {
+  l25:;	
+  {  int yypos26= yypos, yythunkpos26= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos27= yypos, yythunkpos27= yythunkpos;  if (!yymatchChar(' ')) goto l28;  goto l27;
+  l28:;	  yypos= yypos27; yythunkpos= yythunkpos27;  if (!yymatchChar('\t')) goto l26;
+  }
+  l27:;	
+  }  goto l25;
+  l26:;	  yypos= yypos26; yythunkpos= yythunkpos26;
+  }
+  }  goto l24;
+  l23:;	  yypos= yypos23; yythunkpos= yythunkpos23;
+  }
+  l24:;	  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l17;
+  l29:;	
+  {  int yypos30= yypos, yythunkpos30= yythunkpos;
+  {  int yypos31= yypos, yythunkpos31= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l31;
+  }  goto l30;
+  l31:;	  yypos= yypos31; yythunkpos= yythunkpos31;
+  }
+  {  int yypos32= yypos, yythunkpos32= yythunkpos;
+  {  int yypos33= yypos, yythunkpos33= yythunkpos;  /* Sp */
+  {
+  l35:;	
+  {  int yypos36= yypos, yythunkpos36= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos37= yypos, yythunkpos37= yythunkpos;  if (!yymatchChar(' ')) goto l38;  goto l37;
+  l38:;	  yypos= yypos37; yythunkpos= yythunkpos37;  if (!yymatchChar('\t')) goto l36;
+  }
+  l37:;	
+  }  goto l35;
+  l36:;	  yypos= yypos36; yythunkpos= yythunkpos36;
+  }
+  }  goto l34;
+  l33:;	  yypos= yypos33; yythunkpos= yythunkpos33;
+  }
+  l34:;	
+  l39:;	
+  {  int yypos40= yypos, yythunkpos40= yythunkpos;  if (!yymatchChar('#')) goto l40;  goto l39;
+  l40:;	  yypos= yypos40; yythunkpos= yythunkpos40;
+  }  /* Sp */
+  {
+  l41:;	
+  {  int yypos42= yypos, yythunkpos42= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos43= yypos, yythunkpos43= yythunkpos;  if (!yymatchChar(' ')) goto l44;  goto l43;
+  l44:;	  yypos= yypos43; yythunkpos= yythunkpos43;  if (!yymatchChar('\t')) goto l42;
+  }
+  l43:;	
+  }  goto l41;
+  l42:;	  yypos= yypos42; yythunkpos= yythunkpos42;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l32;
+  }  goto l30;
+  l32:;	  yypos= yypos32; yythunkpos= yythunkpos32;
+  }  if (!yymatchDot()) goto l30;  goto l29;
+  l30:;	  yypos= yypos30; yythunkpos= yythunkpos30;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l17;
+  {  int yypos45= yypos, yythunkpos45= yythunkpos;
+  {  int yypos47= yypos, yythunkpos47= yythunkpos;  /* Sp */
+  {
+  l49:;	
+  {  int yypos50= yypos, yythunkpos50= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos51= yypos, yythunkpos51= yythunkpos;  if (!yymatchChar(' ')) goto l52;  goto l51;
+  l52:;	  yypos= yypos51; yythunkpos= yythunkpos51;  if (!yymatchChar('\t')) goto l50;
+  }
+  l51:;	
+  }  goto l49;
+  l50:;	  yypos= yypos50; yythunkpos= yythunkpos50;
+  }
+  }  goto l48;
+  l47:;	  yypos= yypos47; yythunkpos= yythunkpos47;
+  }
+  l48:;	  if (!yymatchChar('#')) goto l45;
+  l53:;	
+  {  int yypos54= yypos, yythunkpos54= yythunkpos;  if (!yymatchChar('#')) goto l54;  goto l53;
+  l54:;	  yypos= yypos54; yythunkpos= yythunkpos54;
+  }  goto l46;
+  l45:;	  yypos= yypos45; yythunkpos= yythunkpos45;
+  }
+  l46:;	
+  {  int yypos55= yypos, yythunkpos55= yythunkpos;  /* Sp */
+  {
+  l57:;	
+  {  int yypos58= yypos, yythunkpos58= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos59= yypos, yythunkpos59= yythunkpos;  if (!yymatchChar(' ')) goto l60;  goto l59;
+  l60:;	  yypos= yypos59; yythunkpos= yythunkpos59;  if (!yymatchChar('\t')) goto l58;
+  }
+  l59:;	
+  }  goto l57;
+  l58:;	  yypos= yypos58; yythunkpos= yythunkpos58;
+  }
+  }  goto l56;
+  l55:;	  yypos= yypos55; yythunkpos= yythunkpos55;
+  }
+  l56:;	  /* Newline */
+  {  if (!yymatchChar('\n')) goto l17;
+  }  yyDo(yy_1_OPMLAtxHeading, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLAtxHeading", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l17:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLAtxHeading", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_OPMLSectionBlock()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "OPMLSectionBlock"));
+  l62:;	
+  {  int yypos63= yypos, yythunkpos63= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l64:;	
+  {  int yypos65= yypos, yythunkpos65= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos66= yypos, yythunkpos66= yythunkpos;  if (!yymatchChar(' ')) goto l67;  goto l66;
+  l67:;	  yypos= yypos66; yythunkpos= yythunkpos66;  if (!yymatchChar('\t')) goto l65;
+  }
+  l66:;	
+  }  goto l64;
+  l65:;	  yypos= yypos65; yythunkpos= yythunkpos65;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l63;
+  }
+  }  goto l62;
+  l63:;	  yypos= yypos63; yythunkpos= yythunkpos63;
+  }
+  {  int yypos68= yypos, yythunkpos68= yythunkpos;  if (!yy_OPMLHeading()) goto l68;  goto l61;
+  l68:;	  yypos= yypos68; yythunkpos= yythunkpos68;
+  }  if (!yy_OPMLPlain()) goto l61;
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLSectionBlock", yybuf+yypos));
+  return 1;
+  l61:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLSectionBlock", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_OPMLHeading()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "OPMLHeading"));
+  {  int yypos70= yypos, yythunkpos70= yythunkpos;  if (!yy_OPMLAtxHeading()) goto l71;  goto l70;
+  l71:;	  yypos= yypos70; yythunkpos= yythunkpos70;  if (!yy_OPMLSetextHeading()) goto l69;
+  }
+  l70:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLHeading", yybuf+yypos));
+  return 1;
+  l69:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLHeading", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_OPMLPlain()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OPMLPlain"));  /* StartList */
+  {
+  {  int yypos73= yypos, yythunkpos73= yythunkpos;  if (!yymatchDot()) goto l72;  yypos= yypos73; yythunkpos= yythunkpos73;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos76= yypos, yythunkpos76= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l77:;	
+  {  int yypos78= yypos, yythunkpos78= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos79= yypos, yythunkpos79= yythunkpos;  if (!yymatchChar(' ')) goto l80;  goto l79;
+  l80:;	  yypos= yypos79; yythunkpos= yythunkpos79;  if (!yymatchChar('\t')) goto l78;
+  }
+  l79:;	
+  }  goto l77;
+  l78:;	  yypos= yypos78; yythunkpos= yythunkpos78;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l76;
+  }
+  }  goto l72;
+  l76:;	  yypos= yypos76; yythunkpos= yythunkpos76;
+  }
+  {  int yypos81= yypos, yythunkpos81= yythunkpos;  /* Heading */
+  {
+  {  int yypos82= yypos, yythunkpos82= yythunkpos;  /* SetextHeading */
+  {
+  {  int yypos84= yypos, yythunkpos84= yythunkpos;  if (!yy_SetextHeading1()) goto l85;  goto l84;
+  l85:;	  yypos= yypos84; yythunkpos= yythunkpos84;  if (!yy_SetextHeading2()) goto l83;
+  }
+  l84:;	
+  }  goto l82;
+  l83:;	  yypos= yypos82; yythunkpos= yythunkpos82;  if (!yy_AtxHeading()) goto l81;
+  }
+  l82:;	
+  }  goto l72;
+  l81:;	  yypos= yypos81; yythunkpos= yythunkpos81;
+  }  /* Line */
+  {  if (!yy_RawLine()) goto l72;  yyDo(yy_1_Line, yybegin, yyend);
+  }  yyDo(yy_1_OPMLPlain, yybegin, yyend);
+  l74:;	
+  {  int yypos75= yypos, yythunkpos75= yythunkpos;
+  {  int yypos86= yypos, yythunkpos86= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l87:;	
+  {  int yypos88= yypos, yythunkpos88= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos89= yypos, yythunkpos89= yythunkpos;  if (!yymatchChar(' ')) goto l90;  goto l89;
+  l90:;	  yypos= yypos89; yythunkpos= yythunkpos89;  if (!yymatchChar('\t')) goto l88;
+  }
+  l89:;	
+  }  goto l87;
+  l88:;	  yypos= yypos88; yythunkpos= yythunkpos88;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l86;
+  }
+  }  goto l75;
+  l86:;	  yypos= yypos86; yythunkpos= yythunkpos86;
+  }
+  {  int yypos91= yypos, yythunkpos91= yythunkpos;  /* Heading */
+  {
+  {  int yypos92= yypos, yythunkpos92= yythunkpos;  /* SetextHeading */
+  {
+  {  int yypos94= yypos, yythunkpos94= yythunkpos;  if (!yy_SetextHeading1()) goto l95;  goto l94;
+  l95:;	  yypos= yypos94; yythunkpos= yythunkpos94;  if (!yy_SetextHeading2()) goto l93;
+  }
+  l94:;	
+  }  goto l92;
+  l93:;	  yypos= yypos92; yythunkpos= yythunkpos92;  if (!yy_AtxHeading()) goto l91;
+  }
+  l92:;	
+  }  goto l75;
+  l91:;	  yypos= yypos91; yythunkpos= yythunkpos91;
+  }  /* Line */
+  {  if (!yy_RawLine()) goto l75;  yyDo(yy_1_Line, yybegin, yyend);
+  }  yyDo(yy_1_OPMLPlain, yybegin, yyend);  goto l74;
+  l75:;	  yypos= yypos75; yythunkpos= yythunkpos75;
+  }  yyDo(yy_2_OPMLPlain, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLPlain", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l72:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLPlain", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_OPMLHeadingSection()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OPMLHeadingSection"));  /* StartList */
+  {
+  {  int yypos97= yypos, yythunkpos97= yythunkpos;  if (!yymatchDot()) goto l96;  yypos= yypos97; yythunkpos= yythunkpos97;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  if (!yy_OPMLHeading()) goto l96;  yyDo(yy_1_OPMLHeadingSection, yybegin, yyend);
+  l98:;	
+  {  int yypos99= yypos, yythunkpos99= yythunkpos;  if (!yy_OPMLSectionBlock()) goto l99;  yyDo(yy_2_OPMLHeadingSection, yybegin, yyend);  goto l98;
+  l99:;	  yypos= yypos99; yythunkpos= yythunkpos99;
+  }  yyDo(yy_3_OPMLHeadingSection, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLHeadingSection", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l96:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLHeadingSection", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_OPMLBlock()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "OPMLBlock"));
+  l101:;	
+  {  int yypos102= yypos, yythunkpos102= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l103:;	
+  {  int yypos104= yypos, yythunkpos104= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos105= yypos, yythunkpos105= yythunkpos;  if (!yymatchChar(' ')) goto l106;  goto l105;
+  l106:;	  yypos= yypos105; yythunkpos= yythunkpos105;  if (!yymatchChar('\t')) goto l104;
+  }
+  l105:;	
+  }  goto l103;
+  l104:;	  yypos= yypos104; yythunkpos= yythunkpos104;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l102;
+  }
+  }  goto l101;
+  l102:;	  yypos= yypos102; yythunkpos= yythunkpos102;
+  }
+  {  int yypos107= yypos, yythunkpos107= yythunkpos;  if (!yy_OPMLHeadingSection()) goto l108;  goto l107;
+  l108:;	  yypos= yypos107; yythunkpos= yythunkpos107;  if (!yy_OPMLPlain()) goto l100;
+  }
+  l107:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLBlock", yybuf+yypos));
+  return 1;
+  l100:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLBlock", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_DocForOPML()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "DocForOPML"));  /* StartList */
+  {
+  {  int yypos110= yypos, yythunkpos110= yythunkpos;  if (!yymatchDot()) goto l109;  yypos= yypos110; yythunkpos= yythunkpos110;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);  /* StartList */
+  {
+  {  int yypos111= yypos, yythunkpos111= yythunkpos;  if (!yymatchDot()) goto l109;  yypos= yypos111; yythunkpos= yythunkpos111;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos112= yypos, yythunkpos112= yythunkpos;
+  {  int yypos114= yypos, yythunkpos114= yythunkpos;  if (!yy_MetaDataKey()) goto l112;  /* Sp */
+  {
+  l115:;	
+  {  int yypos116= yypos, yythunkpos116= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos117= yypos, yythunkpos117= yythunkpos;  if (!yymatchChar(' ')) goto l118;  goto l117;
+  l118:;	  yypos= yypos117; yythunkpos= yythunkpos117;  if (!yymatchChar('\t')) goto l116;
+  }
+  l117:;	
+  }  goto l115;
+  l116:;	  yypos= yypos116; yythunkpos= yythunkpos116;
+  }
+  }  if (!yymatchChar(':')) goto l112;  /* Sp */
+  {
+  l119:;	
+  {  int yypos120= yypos, yythunkpos120= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos121= yypos, yythunkpos121= yythunkpos;  if (!yymatchChar(' ')) goto l122;  goto l121;
+  l122:;	  yypos= yypos121; yythunkpos= yythunkpos121;  if (!yymatchChar('\t')) goto l120;
+  }
+  l121:;	
+  }  goto l119;
+  l120:;	  yypos= yypos120; yythunkpos= yythunkpos120;
+  }
+  }
+  {  int yypos123= yypos, yythunkpos123= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l123;
+  }  goto l112;
+  l123:;	  yypos= yypos123; yythunkpos= yythunkpos123;
+  }  yypos= yypos114; yythunkpos= yythunkpos114;
+  }  if (!yy_MetaData()) goto l112;  yyDo(yy_1_DocForOPML, yybegin, yyend);  goto l113;
+  l112:;	  yypos= yypos112; yythunkpos= yythunkpos112;
+  }
+  l113:;	
+  l124:;	
+  {  int yypos125= yypos, yythunkpos125= yythunkpos;  if (!yy_OPMLBlock()) goto l125;  yyDo(yy_2_DocForOPML, yybegin, yyend);  goto l124;
+  l125:;	  yypos= yypos125; yythunkpos= yythunkpos125;
+  }
+  l126:;	
+  {  int yypos127= yypos, yythunkpos127= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l128:;	
+  {  int yypos129= yypos, yythunkpos129= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos130= yypos, yythunkpos130= yythunkpos;  if (!yymatchChar(' ')) goto l131;  goto l130;
+  l131:;	  yypos= yypos130; yythunkpos= yythunkpos130;  if (!yymatchChar('\t')) goto l129;
+  }
+  l130:;	
+  }  goto l128;
+  l129:;	  yypos= yypos129; yythunkpos= yythunkpos129;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l127;
+  }
+  }  goto l126;
+  l127:;	  yypos= yypos127; yythunkpos= yythunkpos127;
+  }  yyDo(yy_3_DocForOPML, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DocForOPML", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l109:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DocForOPML", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_RightAlign()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "RightAlign"));  if (!yymatchChar('-')) goto l132;
+  l133:;	
+  {  int yypos134= yypos, yythunkpos134= yythunkpos;  if (!yymatchChar('-')) goto l134;  goto l133;
+  l134:;	  yypos= yypos134; yythunkpos= yythunkpos134;
+  }  if (!yymatchChar(':')) goto l132;
+  {  int yypos135= yypos, yythunkpos135= yythunkpos;
+  {  int yypos136= yypos, yythunkpos136= yythunkpos;  if (!yymatchChar('-')) goto l136;  goto l132;
+  l136:;	  yypos= yypos136; yythunkpos= yythunkpos136;
+  }
+  {  int yypos137= yypos, yythunkpos137= yythunkpos;  if (!yymatchChar(':')) goto l137;  goto l132;
+  l137:;	  yypos= yypos137; yythunkpos= yythunkpos137;
+  }  yypos= yypos135; yythunkpos= yythunkpos135;
+  }  yyDo(yy_1_RightAlign, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RightAlign", yybuf+yypos));
+  return 1;
+  l132:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RightAlign", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_CenterAlign()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "CenterAlign"));  if (!yymatchChar(':')) goto l138;
+  l139:;	
+  {  int yypos140= yypos, yythunkpos140= yythunkpos;  if (!yymatchChar('-')) goto l140;  goto l139;
+  l140:;	  yypos= yypos140; yythunkpos= yythunkpos140;
+  }  if (!yymatchChar(':')) goto l138;
+  {  int yypos141= yypos, yythunkpos141= yythunkpos;
+  {  int yypos142= yypos, yythunkpos142= yythunkpos;  if (!yymatchChar('-')) goto l142;  goto l138;
+  l142:;	  yypos= yypos142; yythunkpos= yythunkpos142;
+  }
+  {  int yypos143= yypos, yythunkpos143= yythunkpos;  if (!yymatchChar(':')) goto l143;  goto l138;
+  l143:;	  yypos= yypos143; yythunkpos= yythunkpos143;
+  }  yypos= yypos141; yythunkpos= yythunkpos141;
+  }  yyDo(yy_1_CenterAlign, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CenterAlign", yybuf+yypos));
+  return 1;
+  l138:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CenterAlign", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_LeftAlign()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "LeftAlign"));
+  {  int yypos145= yypos, yythunkpos145= yythunkpos;  if (!yymatchChar(':')) goto l145;  goto l146;
+  l145:;	  yypos= yypos145; yythunkpos= yythunkpos145;
+  }
+  l146:;	  if (!yymatchChar('-')) goto l144;
+  l147:;	
+  {  int yypos148= yypos, yythunkpos148= yythunkpos;  if (!yymatchChar('-')) goto l148;  goto l147;
+  l148:;	  yypos= yypos148; yythunkpos= yythunkpos148;
+  }
+  {  int yypos149= yypos, yythunkpos149= yythunkpos;
+  {  int yypos150= yypos, yythunkpos150= yythunkpos;  if (!yymatchChar('-')) goto l150;  goto l144;
+  l150:;	  yypos= yypos150; yythunkpos= yythunkpos150;
+  }
+  {  int yypos151= yypos, yythunkpos151= yythunkpos;  if (!yymatchChar(':')) goto l151;  goto l144;
+  l151:;	  yypos= yypos151; yythunkpos= yythunkpos151;
+  }  yypos= yypos149; yythunkpos= yythunkpos149;
+  }  yyDo(yy_1_LeftAlign, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LeftAlign", yybuf+yypos));
+  return 1;
+  l144:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LeftAlign", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_RightAlignWrap()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "RightAlignWrap"));  if (!yymatchChar('-')) goto l152;
+  l153:;	
+  {  int yypos154= yypos, yythunkpos154= yythunkpos;  if (!yymatchChar('-')) goto l154;  goto l153;
+  l154:;	  yypos= yypos154; yythunkpos= yythunkpos154;
+  }  if (!yymatchChar(':')) goto l152;  if (!yymatchChar('+')) goto l152;
+  {  int yypos155= yypos, yythunkpos155= yythunkpos;
+  {  int yypos156= yypos, yythunkpos156= yythunkpos;  if (!yymatchChar('-')) goto l156;  goto l152;
+  l156:;	  yypos= yypos156; yythunkpos= yythunkpos156;
+  }
+  {  int yypos157= yypos, yythunkpos157= yythunkpos;  if (!yymatchChar(':')) goto l157;  goto l152;
+  l157:;	  yypos= yypos157; yythunkpos= yythunkpos157;
+  }  yypos= yypos155; yythunkpos= yythunkpos155;
+  }  yyDo(yy_1_RightAlignWrap, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RightAlignWrap", yybuf+yypos));
+  return 1;
+  l152:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RightAlignWrap", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_CenterAlignWrap()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "CenterAlignWrap"));  if (!yymatchChar(':')) goto l158;
+  l159:;	
+  {  int yypos160= yypos, yythunkpos160= yythunkpos;  if (!yymatchChar('-')) goto l160;  goto l159;
+  l160:;	  yypos= yypos160; yythunkpos= yythunkpos160;
+  }  if (!yymatchChar('+')) goto l158;  if (!yymatchChar(':')) goto l158;
+  {  int yypos161= yypos, yythunkpos161= yythunkpos;
+  {  int yypos162= yypos, yythunkpos162= yythunkpos;  if (!yymatchChar('-')) goto l162;  goto l158;
+  l162:;	  yypos= yypos162; yythunkpos= yythunkpos162;
+  }
+  {  int yypos163= yypos, yythunkpos163= yythunkpos;  if (!yymatchChar(':')) goto l163;  goto l158;
+  l163:;	  yypos= yypos163; yythunkpos= yythunkpos163;
+  }  yypos= yypos161; yythunkpos= yythunkpos161;
+  }  yyDo(yy_1_CenterAlignWrap, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CenterAlignWrap", yybuf+yypos));
+  return 1;
+  l158:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CenterAlignWrap", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_LeftAlignWrap()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "LeftAlignWrap"));
+  {  int yypos165= yypos, yythunkpos165= yythunkpos;  if (!yymatchChar(':')) goto l165;  goto l166;
+  l165:;	  yypos= yypos165; yythunkpos= yythunkpos165;
+  }
+  l166:;	  if (!yymatchChar('-')) goto l164;
+  l167:;	
+  {  int yypos168= yypos, yythunkpos168= yythunkpos;  if (!yymatchChar('-')) goto l168;  goto l167;
+  l168:;	  yypos= yypos168; yythunkpos= yythunkpos168;
+  }  if (!yymatchChar('+')) goto l164;
+  {  int yypos169= yypos, yythunkpos169= yythunkpos;
+  {  int yypos170= yypos, yythunkpos170= yythunkpos;  if (!yymatchChar('-')) goto l170;  goto l164;
+  l170:;	  yypos= yypos170; yythunkpos= yythunkpos170;
+  }
+  {  int yypos171= yypos, yythunkpos171= yythunkpos;  if (!yymatchChar(':')) goto l171;  goto l164;
+  l171:;	  yypos= yypos171; yythunkpos= yythunkpos171;
+  }  yypos= yypos169; yythunkpos= yythunkpos169;
+  }  yyDo(yy_1_LeftAlignWrap, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LeftAlignWrap", yybuf+yypos));
+  return 1;
+  l164:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LeftAlignWrap", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AlignmentCell()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "AlignmentCell"));  /* Sp */
+  {
+  l173:;	
+  {  int yypos174= yypos, yythunkpos174= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos175= yypos, yythunkpos175= yythunkpos;  if (!yymatchChar(' ')) goto l176;  goto l175;
+  l176:;	  yypos= yypos175; yythunkpos= yythunkpos175;  if (!yymatchChar('\t')) goto l174;
+  }
+  l175:;	
+  }  goto l173;
+  l174:;	  yypos= yypos174; yythunkpos= yythunkpos174;
+  }
+  }
+  {  int yypos177= yypos, yythunkpos177= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l177;
+  }  goto l172;
+  l177:;	  yypos= yypos177; yythunkpos= yythunkpos177;
+  }
+  {  int yypos178= yypos, yythunkpos178= yythunkpos;  if (!yy_LeftAlignWrap()) goto l179;  goto l178;
+  l179:;	  yypos= yypos178; yythunkpos= yythunkpos178;  if (!yy_CenterAlignWrap()) goto l180;  goto l178;
+  l180:;	  yypos= yypos178; yythunkpos= yythunkpos178;  if (!yy_RightAlignWrap()) goto l181;  goto l178;
+  l181:;	  yypos= yypos178; yythunkpos= yythunkpos178;  if (!yy_LeftAlign()) goto l182;  goto l178;
+  l182:;	  yypos= yypos178; yythunkpos= yythunkpos178;  if (!yy_CenterAlign()) goto l183;  goto l178;
+  l183:;	  yypos= yypos178; yythunkpos= yythunkpos178;  if (!yy_RightAlign()) goto l172;
+  }
+  l178:;	  /* Sp */
+  {
+  l184:;	
+  {  int yypos185= yypos, yythunkpos185= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos186= yypos, yythunkpos186= yythunkpos;  if (!yymatchChar(' ')) goto l187;  goto l186;
+  l187:;	  yypos= yypos186; yythunkpos= yythunkpos186;  if (!yymatchChar('\t')) goto l185;
+  }
+  l186:;	
+  }  goto l184;
+  l185:;	  yypos= yypos185; yythunkpos= yythunkpos185;
+  }
+  }
+  {  int yypos188= yypos, yythunkpos188= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l188;
+  }  goto l189;
+  l188:;	  yypos= yypos188; yythunkpos= yythunkpos188;
+  }
+  l189:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "AlignmentCell", yybuf+yypos));
+  return 1;
+  l172:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AlignmentCell", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_CellStr()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "CellStr"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l190;
+  {  int yypos191= yypos, yythunkpos191= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l191;
+  }  goto l190;
+  l191:;	  yypos= yypos191; yythunkpos= yythunkpos191;
+  }  if (!yy_NormalChar()) goto l190;
+  l192:;	
+  {  int yypos193= yypos, yythunkpos193= yythunkpos;
+  {  int yypos194= yypos, yythunkpos194= yythunkpos;
+  {  int yypos196= yypos, yythunkpos196= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l196;
+  }  goto l195;
+  l196:;	  yypos= yypos196; yythunkpos= yythunkpos196;
+  }  if (!yy_NormalChar()) goto l195;  goto l194;
+  l195:;	  yypos= yypos194; yythunkpos= yythunkpos194;  if (!yymatchChar('_')) goto l193;
+  l197:;	
+  {  int yypos198= yypos, yythunkpos198= yythunkpos;  if (!yymatchChar('_')) goto l198;  goto l197;
+  l198:;	  yypos= yypos198; yythunkpos= yythunkpos198;
+  }
+  {  int yypos199= yypos, yythunkpos199= yythunkpos;  /* Alphanumeric */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l193;
+  }  yypos= yypos199; yythunkpos= yythunkpos199;
+  }
+  }
+  l194:;	  goto l192;
+  l193:;	  yypos= yypos193; yythunkpos= yythunkpos193;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l190;  yyDo(yy_1_CellStr, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CellStr", yybuf+yypos));
+  return 1;
+  l190:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CellStr", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_FullCell()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "FullCell"));  /* Sp */
+  {
+  l201:;	
+  {  int yypos202= yypos, yythunkpos202= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos203= yypos, yythunkpos203= yythunkpos;  if (!yymatchChar(' ')) goto l204;  goto l203;
+  l204:;	  yypos= yypos203; yythunkpos= yythunkpos203;  if (!yymatchChar('\t')) goto l202;
+  }
+  l203:;	
+  }  goto l201;
+  l202:;	  yypos= yypos202; yythunkpos= yythunkpos202;
+  }
+  }  /* StartList */
+  {
+  {  int yypos205= yypos, yythunkpos205= yythunkpos;  if (!yymatchDot()) goto l200;  yypos= yypos205; yythunkpos= yythunkpos205;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos208= yypos, yythunkpos208= yythunkpos;
+  {  int yypos210= yypos, yythunkpos210= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l210;
+  }  goto l209;
+  l210:;	  yypos= yypos210; yythunkpos= yythunkpos210;
+  }  if (!yy_CellStr()) goto l209;  goto l208;
+  l209:;	  yypos= yypos208; yythunkpos= yythunkpos208;
+  {  int yypos211= yypos, yythunkpos211= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l211;
+  }  goto l200;
+  l211:;	  yypos= yypos211; yythunkpos= yythunkpos211;
+  }
+  {  int yypos212= yypos, yythunkpos212= yythunkpos;  /* Endline */
+  {
+  {  int yypos213= yypos, yythunkpos213= yythunkpos;  if (!yy_LineBreak()) goto l214;  goto l213;
+  l214:;	  yypos= yypos213; yythunkpos= yythunkpos213;  if (!yy_TerminalEndline()) goto l215;  goto l213;
+  l215:;	  yypos= yypos213; yythunkpos= yythunkpos213;  if (!yy_NormalEndline()) goto l212;
+  }
+  l213:;	
+  }  goto l200;
+  l212:;	  yypos= yypos212; yythunkpos= yythunkpos212;
+  }
+  {  int yypos216= yypos, yythunkpos216= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l216;
+  }  goto l200;
+  l216:;	  yypos= yypos216; yythunkpos= yythunkpos216;
+  }
+  {  int yypos217= yypos, yythunkpos217= yythunkpos;  if (!yy_Str()) goto l217;  goto l200;
+  l217:;	  yypos= yypos217; yythunkpos= yythunkpos217;
+  }
+  {  int yypos218= yypos, yythunkpos218= yythunkpos;  /* Sp */
+  {
+  l219:;	
+  {  int yypos220= yypos, yythunkpos220= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos221= yypos, yythunkpos221= yythunkpos;  if (!yymatchChar(' ')) goto l222;  goto l221;
+  l222:;	  yypos= yypos221; yythunkpos= yythunkpos221;  if (!yymatchChar('\t')) goto l220;
+  }
+  l221:;	
+  }  goto l219;
+  l220:;	  yypos= yypos220; yythunkpos= yythunkpos220;
+  }
+  }
+  {  int yypos223= yypos, yythunkpos223= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l218;
+  }  yypos= yypos223; yythunkpos= yythunkpos223;
+  }  goto l200;
+  l218:;	  yypos= yypos218; yythunkpos= yythunkpos218;
+  }  if (!yy_Inline()) goto l200;
+  }
+  l208:;	  yyDo(yy_1_FullCell, yybegin, yyend);
+  l206:;	
+  {  int yypos207= yypos, yythunkpos207= yythunkpos;
+  {  int yypos224= yypos, yythunkpos224= yythunkpos;
+  {  int yypos226= yypos, yythunkpos226= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l226;
+  }  goto l225;
+  l226:;	  yypos= yypos226; yythunkpos= yythunkpos226;
+  }  if (!yy_CellStr()) goto l225;  goto l224;
+  l225:;	  yypos= yypos224; yythunkpos= yythunkpos224;
+  {  int yypos227= yypos, yythunkpos227= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l227;
+  }  goto l207;
+  l227:;	  yypos= yypos227; yythunkpos= yythunkpos227;
+  }
+  {  int yypos228= yypos, yythunkpos228= yythunkpos;  /* Endline */
+  {
+  {  int yypos229= yypos, yythunkpos229= yythunkpos;  if (!yy_LineBreak()) goto l230;  goto l229;
+  l230:;	  yypos= yypos229; yythunkpos= yythunkpos229;  if (!yy_TerminalEndline()) goto l231;  goto l229;
+  l231:;	  yypos= yypos229; yythunkpos= yythunkpos229;  if (!yy_NormalEndline()) goto l228;
+  }
+  l229:;	
+  }  goto l207;
+  l228:;	  yypos= yypos228; yythunkpos= yythunkpos228;
+  }
+  {  int yypos232= yypos, yythunkpos232= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l232;
+  }  goto l207;
+  l232:;	  yypos= yypos232; yythunkpos= yythunkpos232;
+  }
+  {  int yypos233= yypos, yythunkpos233= yythunkpos;  if (!yy_Str()) goto l233;  goto l207;
+  l233:;	  yypos= yypos233; yythunkpos= yythunkpos233;
+  }
+  {  int yypos234= yypos, yythunkpos234= yythunkpos;  /* Sp */
+  {
+  l235:;	
+  {  int yypos236= yypos, yythunkpos236= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos237= yypos, yythunkpos237= yythunkpos;  if (!yymatchChar(' ')) goto l238;  goto l237;
+  l238:;	  yypos= yypos237; yythunkpos= yythunkpos237;  if (!yymatchChar('\t')) goto l236;
+  }
+  l237:;	
+  }  goto l235;
+  l236:;	  yypos= yypos236; yythunkpos= yythunkpos236;
+  }
+  }
+  {  int yypos239= yypos, yythunkpos239= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l234;
+  }  yypos= yypos239; yythunkpos= yythunkpos239;
+  }  goto l207;
+  l234:;	  yypos= yypos234; yythunkpos= yythunkpos234;
+  }  if (!yy_Inline()) goto l207;
+  }
+  l224:;	  yyDo(yy_1_FullCell, yybegin, yyend);  goto l206;
+  l207:;	  yypos= yypos207; yythunkpos= yythunkpos207;
+  }  /* Sp */
+  {
+  l240:;	
+  {  int yypos241= yypos, yythunkpos241= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos242= yypos, yythunkpos242= yythunkpos;  if (!yymatchChar(' ')) goto l243;  goto l242;
+  l243:;	  yypos= yypos242; yythunkpos= yythunkpos242;  if (!yymatchChar('\t')) goto l241;
+  }
+  l242:;	
+  }  goto l240;
+  l241:;	  yypos= yypos241; yythunkpos= yythunkpos241;
+  }
+  }
+  {  int yypos244= yypos, yythunkpos244= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l244;
+  }  goto l245;
+  l244:;	  yypos= yypos244; yythunkpos= yythunkpos244;
+  }
+  l245:;	  yyDo(yy_2_FullCell, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "FullCell", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l200:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "FullCell", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_EmptyCell()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "EmptyCell"));  /* Sp */
+  {
+  l247:;	
+  {  int yypos248= yypos, yythunkpos248= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos249= yypos, yythunkpos249= yythunkpos;  if (!yymatchChar(' ')) goto l250;  goto l249;
+  l250:;	  yypos= yypos249; yythunkpos= yythunkpos249;  if (!yymatchChar('\t')) goto l248;
+  }
+  l249:;	
+  }  goto l247;
+  l248:;	  yypos= yypos248; yythunkpos= yythunkpos248;
+  }
+  }  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l246;
+  }  yyDo(yy_1_EmptyCell, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmptyCell", yybuf+yypos));
+  return 1;
+  l246:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmptyCell", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ExtendedCell()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "ExtendedCell"));
+  {  int yypos252= yypos, yythunkpos252= yythunkpos;  /* EmptyCell */
+  {  /* Sp */
+  {
+  l254:;	
+  {  int yypos255= yypos, yythunkpos255= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos256= yypos, yythunkpos256= yythunkpos;  if (!yymatchChar(' ')) goto l257;  goto l256;
+  l257:;	  yypos= yypos256; yythunkpos= yythunkpos256;  if (!yymatchChar('\t')) goto l255;
+  }
+  l256:;	
+  }  goto l254;
+  l255:;	  yypos= yypos255; yythunkpos= yythunkpos255;
+  }
+  }  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l253;
+  }  yyDo(yy_1_EmptyCell, yybegin, yyend);
+  }  goto l252;
+  l253:;	  yypos= yypos252; yythunkpos= yythunkpos252;  if (!yy_FullCell()) goto l251;
+  }
+  l252:;	  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l251;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l251;
+  }
+  l258:;	
+  {  int yypos259= yypos, yythunkpos259= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l259;
+  }  goto l258;
+  l259:;	  yypos= yypos259; yythunkpos= yythunkpos259;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l251;  yyDo(yy_1_ExtendedCell, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ExtendedCell", yybuf+yypos));
+  return 1;
+  l251:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ExtendedCell", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TableCell()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "TableCell"));
+  {  int yypos261= yypos, yythunkpos261= yythunkpos;  if (!yy_ExtendedCell()) goto l262;  goto l261;
+  l262:;	  yypos= yypos261; yythunkpos= yythunkpos261;  /* EmptyCell */
+  {  /* Sp */
+  {
+  l264:;	
+  {  int yypos265= yypos, yythunkpos265= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos266= yypos, yythunkpos266= yythunkpos;  if (!yymatchChar(' ')) goto l267;  goto l266;
+  l267:;	  yypos= yypos266; yythunkpos= yythunkpos266;  if (!yymatchChar('\t')) goto l265;
+  }
+  l266:;	
+  }  goto l264;
+  l265:;	  yypos= yypos265; yythunkpos= yythunkpos265;
+  }
+  }  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l263;
+  }  yyDo(yy_1_EmptyCell, yybegin, yyend);
+  }  goto l261;
+  l263:;	  yypos= yypos261; yythunkpos= yythunkpos261;  if (!yy_FullCell()) goto l260;
+  }
+  l261:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableCell", yybuf+yypos));
+  return 1;
+  l260:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableCell", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_CellDivider()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "CellDivider"));  if (!yymatchChar('|')) goto l268;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CellDivider", yybuf+yypos));
+  return 1;
+  l268:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CellDivider", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TableLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "TableLine"));
+  l270:;	
+  {  int yypos271= yypos, yythunkpos271= yythunkpos;
+  {  int yypos272= yypos, yythunkpos272= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l272;
+  }  goto l271;
+  l272:;	  yypos= yypos272; yythunkpos= yythunkpos272;
+  }
+  {  int yypos273= yypos, yythunkpos273= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l273;
+  }  goto l271;
+  l273:;	  yypos= yypos273; yythunkpos= yythunkpos273;
+  }  if (!yymatchDot()) goto l271;  goto l270;
+  l271:;	  yypos= yypos271; yythunkpos= yythunkpos271;
+  }  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l269;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableLine", yybuf+yypos));
+  return 1;
+  l269:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TableRow()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "TableRow"));  /* StartList */
+  {
+  {  int yypos275= yypos, yythunkpos275= yythunkpos;  if (!yymatchDot()) goto l274;  yypos= yypos275; yythunkpos= yythunkpos275;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos276= yypos, yythunkpos276= yythunkpos;  if (!yy_SeparatorLine()) goto l276;  goto l274;
+  l276:;	  yypos= yypos276; yythunkpos= yythunkpos276;
+  }
+  {  int yypos277= yypos, yythunkpos277= yythunkpos;  if (!yy_TableLine()) goto l274;  yypos= yypos277; yythunkpos= yythunkpos277;
+  }
+  {  int yypos278= yypos, yythunkpos278= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l278;
+  }  goto l279;
+  l278:;	  yypos= yypos278; yythunkpos= yythunkpos278;
+  }
+  l279:;	  /* TableCell */
+  {
+  {  int yypos282= yypos, yythunkpos282= yythunkpos;  if (!yy_ExtendedCell()) goto l283;  goto l282;
+  l283:;	  yypos= yypos282; yythunkpos= yythunkpos282;  /* EmptyCell */
+  {  /* Sp */
+  {
+  l285:;	
+  {  int yypos286= yypos, yythunkpos286= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos287= yypos, yythunkpos287= yythunkpos;  if (!yymatchChar(' ')) goto l288;  goto l287;
+  l288:;	  yypos= yypos287; yythunkpos= yythunkpos287;  if (!yymatchChar('\t')) goto l286;
+  }
+  l287:;	
+  }  goto l285;
+  l286:;	  yypos= yypos286; yythunkpos= yythunkpos286;
+  }
+  }  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l284;
+  }  yyDo(yy_1_EmptyCell, yybegin, yyend);
+  }  goto l282;
+  l284:;	  yypos= yypos282; yythunkpos= yythunkpos282;  if (!yy_FullCell()) goto l274;
+  }
+  l282:;	
+  }  yyDo(yy_1_TableRow, yybegin, yyend);
+  l280:;	
+  {  int yypos281= yypos, yythunkpos281= yythunkpos;  /* TableCell */
+  {
+  {  int yypos289= yypos, yythunkpos289= yythunkpos;  if (!yy_ExtendedCell()) goto l290;  goto l289;
+  l290:;	  yypos= yypos289; yythunkpos= yythunkpos289;  /* EmptyCell */
+  {  /* Sp */
+  {
+  l292:;	
+  {  int yypos293= yypos, yythunkpos293= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos294= yypos, yythunkpos294= yythunkpos;  if (!yymatchChar(' ')) goto l295;  goto l294;
+  l295:;	  yypos= yypos294; yythunkpos= yythunkpos294;  if (!yymatchChar('\t')) goto l293;
+  }
+  l294:;	
+  }  goto l292;
+  l293:;	  yypos= yypos293; yythunkpos= yythunkpos293;
+  }
+  }  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l291;
+  }  yyDo(yy_1_EmptyCell, yybegin, yyend);
+  }  goto l289;
+  l291:;	  yypos= yypos289; yythunkpos= yythunkpos289;  if (!yy_FullCell()) goto l281;
+  }
+  l289:;	
+  }  yyDo(yy_1_TableRow, yybegin, yyend);  goto l280;
+  l281:;	  yypos= yypos281; yythunkpos= yythunkpos281;
+  }  /* Sp */
+  {
+  l296:;	
+  {  int yypos297= yypos, yythunkpos297= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos298= yypos, yythunkpos298= yythunkpos;  if (!yymatchChar(' ')) goto l299;  goto l298;
+  l299:;	  yypos= yypos298; yythunkpos= yythunkpos298;  if (!yymatchChar('\t')) goto l297;
+  }
+  l298:;	
+  }  goto l296;
+  l297:;	  yypos= yypos297; yythunkpos= yythunkpos297;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l274;
+  }  yyDo(yy_2_TableRow, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableRow", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l274:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableRow", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Definition()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Definition"));  /* StartList */
+  {
+  {  int yypos301= yypos, yythunkpos301= yythunkpos;  if (!yymatchDot()) goto l300;  yypos= yypos301; yythunkpos= yythunkpos301;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);  /* StartList */
+  {
+  {  int yypos302= yypos, yythunkpos302= yythunkpos;  if (!yymatchDot()) goto l300;  yypos= yypos302; yythunkpos= yythunkpos302;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos303= yypos, yythunkpos303= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l305:;	
+  {  int yypos306= yypos, yythunkpos306= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos307= yypos, yythunkpos307= yythunkpos;  if (!yymatchChar(' ')) goto l308;  goto l307;
+  l308:;	  yypos= yypos307; yythunkpos= yythunkpos307;  if (!yymatchChar('\t')) goto l306;
+  }
+  l307:;	
+  }  goto l305;
+  l306:;	  yypos= yypos306; yythunkpos= yythunkpos306;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l303;
+  }
+  }  yyDo(yy_1_Definition, yybegin, yyend);  goto l304;
+  l303:;	  yypos= yypos303; yythunkpos= yythunkpos303;
+  }
+  l304:;	  if (!yymatchChar(':')) goto l300;  /* Sp */
+  {
+  l309:;	
+  {  int yypos310= yypos, yythunkpos310= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos311= yypos, yythunkpos311= yythunkpos;  if (!yymatchChar(' ')) goto l312;  goto l311;
+  l312:;	  yypos= yypos311; yythunkpos= yythunkpos311;  if (!yymatchChar('\t')) goto l310;
+  }
+  l311:;	
+  }  goto l309;
+  l310:;	  yypos= yypos310; yythunkpos= yythunkpos310;
+  }
+  }  if (!yy_RawLine()) goto l300;  yyDo(yy_2_Definition, yybegin, yyend);
+  l313:;	
+  {  int yypos314= yypos, yythunkpos314= yythunkpos;
+  {  int yypos315= yypos, yythunkpos315= yythunkpos;  if (!yymatchChar(':')) goto l315;  goto l314;
+  l315:;	  yypos= yypos315; yythunkpos= yythunkpos315;
+  }
+  {  int yypos316= yypos, yythunkpos316= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l317:;	
+  {  int yypos318= yypos, yythunkpos318= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos319= yypos, yythunkpos319= yythunkpos;  if (!yymatchChar(' ')) goto l320;  goto l319;
+  l320:;	  yypos= yypos319; yythunkpos= yythunkpos319;  if (!yymatchChar('\t')) goto l318;
+  }
+  l319:;	
+  }  goto l317;
+  l318:;	  yypos= yypos318; yythunkpos= yythunkpos318;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l316;
+  }
+  }  goto l314;
+  l316:;	  yypos= yypos316; yythunkpos= yythunkpos316;
+  }  if (!yy_RawLine()) goto l314;  yyDo(yy_3_Definition, yybegin, yyend);  goto l313;
+  l314:;	  yypos= yypos314; yythunkpos= yythunkpos314;
+  }
+  l321:;	
+  {  int yypos322= yypos, yythunkpos322= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l323:;	
+  {  int yypos324= yypos, yythunkpos324= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos325= yypos, yythunkpos325= yythunkpos;  if (!yymatchChar(' ')) goto l326;  goto l325;
+  l326:;	  yypos= yypos325; yythunkpos= yythunkpos325;  if (!yymatchChar('\t')) goto l324;
+  }
+  l325:;	
+  }  goto l323;
+  l324:;	  yypos= yypos324; yythunkpos= yythunkpos324;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l322;
+  }
+  }  yyDo(yy_4_Definition, yybegin, yyend);  /* IndentedLine */
+  {  /* Indent */
+  {
+  {  int yypos329= yypos, yythunkpos329= yythunkpos;  if (!yymatchChar('\t')) goto l330;  goto l329;
+  l330:;	  yypos= yypos329; yythunkpos= yythunkpos329;  if (!yymatchString("    ")) goto l322;
+  }
+  l329:;	
+  }  /* Line */
+  {  if (!yy_RawLine()) goto l322;  yyDo(yy_1_Line, yybegin, yyend);
+  }
+  }  yyDo(yy_5_Definition, yybegin, yyend);
+  l327:;	
+  {  int yypos328= yypos, yythunkpos328= yythunkpos;  /* IndentedLine */
+  {  /* Indent */
+  {
+  {  int yypos331= yypos, yythunkpos331= yythunkpos;  if (!yymatchChar('\t')) goto l332;  goto l331;
+  l332:;	  yypos= yypos331; yythunkpos= yythunkpos331;  if (!yymatchString("    ")) goto l328;
+  }
+  l331:;	
+  }  /* Line */
+  {  if (!yy_RawLine()) goto l328;  yyDo(yy_1_Line, yybegin, yyend);
+  }
+  }  yyDo(yy_5_Definition, yybegin, yyend);  goto l327;
+  l328:;	  yypos= yypos328; yythunkpos= yythunkpos328;
+  }  yyDo(yy_6_Definition, yybegin, yyend);  goto l321;
+  l322:;	  yypos= yypos322; yythunkpos= yythunkpos322;
+  }  yyDo(yy_7_Definition, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Definition", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l300:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Definition", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Term()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Term"));  /* StartList */
+  {
+  {  int yypos334= yypos, yythunkpos334= yythunkpos;  if (!yymatchDot()) goto l333;  yypos= yypos334; yythunkpos= yythunkpos334;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos335= yypos, yythunkpos335= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l336:;	
+  {  int yypos337= yypos, yythunkpos337= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos338= yypos, yythunkpos338= yythunkpos;  if (!yymatchChar(' ')) goto l339;  goto l338;
+  l339:;	  yypos= yypos338; yythunkpos= yythunkpos338;  if (!yymatchChar('\t')) goto l337;
+  }
+  l338:;	
+  }  goto l336;
+  l337:;	  yypos= yypos337; yythunkpos= yythunkpos337;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l335;
+  }
+  }  goto l333;
+  l335:;	  yypos= yypos335; yythunkpos= yythunkpos335;
+  }
+  {  int yypos340= yypos, yythunkpos340= yythunkpos;  if (!yymatchChar(':')) goto l340;  goto l333;
+  l340:;	  yypos= yypos340; yythunkpos= yythunkpos340;
+  }
+  {  int yypos343= yypos, yythunkpos343= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l343;
+  }  goto l333;
+  l343:;	  yypos= yypos343; yythunkpos= yythunkpos343;
+  }
+  {  int yypos344= yypos, yythunkpos344= yythunkpos;  /* Endline */
+  {
+  {  int yypos345= yypos, yythunkpos345= yythunkpos;  if (!yy_LineBreak()) goto l346;  goto l345;
+  l346:;	  yypos= yypos345; yythunkpos= yythunkpos345;  if (!yy_TerminalEndline()) goto l347;  goto l345;
+  l347:;	  yypos= yypos345; yythunkpos= yythunkpos345;  if (!yy_NormalEndline()) goto l344;
+  }
+  l345:;	
+  }  goto l333;
+  l344:;	  yypos= yypos344; yythunkpos= yythunkpos344;
+  }  if (!yy_Inline()) goto l333;  yyDo(yy_1_Term, yybegin, yyend);
+  l341:;	
+  {  int yypos342= yypos, yythunkpos342= yythunkpos;
+  {  int yypos348= yypos, yythunkpos348= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l348;
+  }  goto l342;
+  l348:;	  yypos= yypos348; yythunkpos= yythunkpos348;
+  }
+  {  int yypos349= yypos, yythunkpos349= yythunkpos;  /* Endline */
+  {
+  {  int yypos350= yypos, yythunkpos350= yythunkpos;  if (!yy_LineBreak()) goto l351;  goto l350;
+  l351:;	  yypos= yypos350; yythunkpos= yythunkpos350;  if (!yy_TerminalEndline()) goto l352;  goto l350;
+  l352:;	  yypos= yypos350; yythunkpos= yythunkpos350;  if (!yy_NormalEndline()) goto l349;
+  }
+  l350:;	
+  }  goto l342;
+  l349:;	  yypos= yypos349; yythunkpos= yythunkpos349;
+  }  if (!yy_Inline()) goto l342;  yyDo(yy_1_Term, yybegin, yyend);  goto l341;
+  l342:;	  yypos= yypos342; yythunkpos= yythunkpos342;
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l333;
+  }  yyDo(yy_2_Term, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Term", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l333:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Term", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TermLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "TermLine"));
+  {  int yypos354= yypos, yythunkpos354= yythunkpos;  if (!yymatchChar(':')) goto l354;  goto l353;
+  l354:;	  yypos= yypos354; yythunkpos= yythunkpos354;
+  }
+  {  int yypos355= yypos, yythunkpos355= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l356:;	
+  {  int yypos357= yypos, yythunkpos357= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos358= yypos, yythunkpos358= yythunkpos;  if (!yymatchChar(' ')) goto l359;  goto l358;
+  l359:;	  yypos= yypos358; yythunkpos= yythunkpos358;  if (!yymatchChar('\t')) goto l357;
+  }
+  l358:;	
+  }  goto l356;
+  l357:;	  yypos= yypos357; yythunkpos= yythunkpos357;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l355;
+  }
+  }  goto l353;
+  l355:;	  yypos= yypos355; yythunkpos= yythunkpos355;
+  }
+  l360:;	
+  {  int yypos361= yypos, yythunkpos361= yythunkpos;
+  {  int yypos362= yypos, yythunkpos362= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l362;
+  }  goto l361;
+  l362:;	  yypos= yypos362; yythunkpos= yythunkpos362;
+  }  if (!yymatchDot()) goto l361;  goto l360;
+  l361:;	  yypos= yypos361; yythunkpos= yythunkpos361;
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l353;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "TermLine", yybuf+yypos));
+  return 1;
+  l353:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TermLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SeparatorLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "SeparatorLine"));  /* StartList */
+  {
+  {  int yypos364= yypos, yythunkpos364= yythunkpos;  if (!yymatchDot()) goto l363;  yypos= yypos364; yythunkpos= yythunkpos364;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos365= yypos, yythunkpos365= yythunkpos;  if (!yy_TableLine()) goto l363;  yypos= yypos365; yythunkpos= yythunkpos365;
+  }
+  {  int yypos366= yypos, yythunkpos366= yythunkpos;  /* CellDivider */
+  {  if (!yymatchChar('|')) goto l366;
+  }  goto l367;
+  l366:;	  yypos= yypos366; yythunkpos= yythunkpos366;
+  }
+  l367:;	  if (!yy_AlignmentCell()) goto l363;  yyDo(yy_1_SeparatorLine, yybegin, yyend);
+  l368:;	
+  {  int yypos369= yypos, yythunkpos369= yythunkpos;  if (!yy_AlignmentCell()) goto l369;  yyDo(yy_1_SeparatorLine, yybegin, yyend);  goto l368;
+  l369:;	  yypos= yypos369; yythunkpos= yythunkpos369;
+  }  /* Sp */
+  {
+  l370:;	
+  {  int yypos371= yypos, yythunkpos371= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos372= yypos, yythunkpos372= yythunkpos;  if (!yymatchChar(' ')) goto l373;  goto l372;
+  l373:;	  yypos= yypos372; yythunkpos= yythunkpos372;  if (!yymatchChar('\t')) goto l371;
+  }
+  l372:;	
+  }  goto l370;
+  l371:;	  yypos= yypos371; yythunkpos= yythunkpos371;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l363;
+  }  yyDo(yy_2_SeparatorLine, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SeparatorLine", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l363:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SeparatorLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TableBody()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "TableBody"));  /* StartList */
+  {
+  {  int yypos375= yypos, yythunkpos375= yythunkpos;  if (!yymatchDot()) goto l374;  yypos= yypos375; yythunkpos= yythunkpos375;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  if (!yy_TableRow()) goto l374;  yyDo(yy_1_TableBody, yybegin, yyend);
+  l376:;	
+  {  int yypos377= yypos, yythunkpos377= yythunkpos;  if (!yy_TableRow()) goto l377;  yyDo(yy_1_TableBody, yybegin, yyend);  goto l376;
+  l377:;	  yypos= yypos377; yythunkpos= yythunkpos377;
+  }  yyDo(yy_2_TableBody, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableBody", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l374:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableBody", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TableCaption()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "TableCaption"));  /* StartList */
+  {
+  {  int yypos379= yypos, yythunkpos379= yythunkpos;  if (!yymatchDot()) goto l378;  yypos= yypos379; yythunkpos= yythunkpos379;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -3, 0);  if (!yy_Label()) goto l378;  yyDo(yySet, -2, 0);
+  {  int yypos380= yypos, yythunkpos380= yythunkpos;  if (!yy_Label()) goto l380;  yyDo(yySet, -1, 0);  yyDo(yy_1_TableCaption, yybegin, yyend);  goto l381;
+  l380:;	  yypos= yypos380; yythunkpos= yythunkpos380;
+  }
+  l381:;	  /* Sp */
+  {
+  l382:;	
+  {  int yypos383= yypos, yythunkpos383= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos384= yypos, yythunkpos384= yythunkpos;  if (!yymatchChar(' ')) goto l385;  goto l384;
+  l385:;	  yypos= yypos384; yythunkpos= yythunkpos384;  if (!yymatchChar('\t')) goto l383;
+  }
+  l384:;	
+  }  goto l382;
+  l383:;	  yypos= yypos383; yythunkpos= yythunkpos383;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l378;
+  }  yyDo(yy_2_TableCaption, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableCaption", yybuf+yypos));  yyDo(yyPop, 3, 0);
+  return 1;
+  l378:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableCaption", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLabels()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 4, 0);
+  yyprintf((stderr, "%s\n", "AutoLabels"));  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) && !extension(EXT_NO_LABELS))) goto l386;  /* StartList */
+  {
+  {  int yypos387= yypos, yythunkpos387= yythunkpos;  if (!yymatchDot()) goto l386;  yypos= yypos387; yythunkpos= yythunkpos387;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -4, 0);
+  l388:;	
+  {  int yypos389= yypos, yythunkpos389= yythunkpos;
+  {  int yypos390= yypos, yythunkpos390= yythunkpos;  /* Heading */
+  {
+  {  int yypos392= yypos, yythunkpos392= yythunkpos;  /* SetextHeading */
+  {
+  {  int yypos394= yypos, yythunkpos394= yythunkpos;  if (!yy_SetextHeading1()) goto l395;  goto l394;
+  l395:;	  yypos= yypos394; yythunkpos= yythunkpos394;  if (!yy_SetextHeading2()) goto l393;
+  }
+  l394:;	
+  }  goto l392;
+  l393:;	  yypos= yypos392; yythunkpos= yythunkpos392;  if (!yy_AtxHeading()) goto l391;
+  }
+  l392:;	
+  }  yyDo(yySet, -3, 0);  yyDo(yy_1_AutoLabels, yybegin, yyend);  goto l390;
+  l391:;	  yypos= yypos390; yythunkpos= yythunkpos390;  if (!yy_TableCaption()) goto l396;  yyDo(yySet, -2, 0);  yyDo(yy_2_AutoLabels, yybegin, yyend);  if (!yy_TableBody()) goto l396;  yyDo(yySet, -1, 0);  yyDo(yy_3_AutoLabels, yybegin, yyend);  goto l390;
+  l396:;	  yypos= yypos390; yythunkpos= yythunkpos390;
+  {  int yypos400= yypos, yythunkpos400= yythunkpos;  if (!yy_TableBody()) goto l401;  yyDo(yySet, -1, 0);  yyDo(yy_4_AutoLabels, yybegin, yyend);  goto l400;
+  l401:;	  yypos= yypos400; yythunkpos= yythunkpos400;  if (!yy_SeparatorLine()) goto l397;  yyDo(yySet, -1, 0);  yyDo(yy_5_AutoLabels, yybegin, yyend);
+  }
+  l400:;	
+  l398:;	
+  {  int yypos399= yypos, yythunkpos399= yythunkpos;
+  {  int yypos402= yypos, yythunkpos402= yythunkpos;  if (!yy_TableBody()) goto l403;  yyDo(yySet, -1, 0);  yyDo(yy_4_AutoLabels, yybegin, yyend);  goto l402;
+  l403:;	  yypos= yypos402; yythunkpos= yythunkpos402;  if (!yy_SeparatorLine()) goto l399;  yyDo(yySet, -1, 0);  yyDo(yy_5_AutoLabels, yybegin, yyend);
+  }
+  l402:;	  goto l398;
+  l399:;	  yypos= yypos399; yythunkpos= yythunkpos399;
+  }  if (!yy_TableCaption()) goto l397;  yyDo(yySet, -2, 0);  yyDo(yy_6_AutoLabels, yybegin, yyend);  goto l390;
+  l397:;	  yypos= yypos390; yythunkpos= yythunkpos390;  if (!yy_SkipBlock()) goto l389;
+  }
+  l390:;	  goto l388;
+  l389:;	  yypos= yypos389; yythunkpos= yythunkpos389;
+  }  yyDo(yy_7_AutoLabels, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLabels", yybuf+yypos));  yyDo(yyPop, 4, 0);
+  return 1;
+  l386:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLabels", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_RawCitationReference()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "RawCitationReference"));  if (!yymatchString("[#")) goto l404;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l404;
+  {  int yypos407= yypos, yythunkpos407= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l407;
+  }  goto l404;
+  l407:;	  yypos= yypos407; yythunkpos= yythunkpos407;
+  }
+  {  int yypos408= yypos, yythunkpos408= yythunkpos;  if (!yymatchChar(']')) goto l408;  goto l404;
+  l408:;	  yypos= yypos408; yythunkpos= yythunkpos408;
+  }  if (!yymatchDot()) goto l404;
+  l405:;	
+  {  int yypos406= yypos, yythunkpos406= yythunkpos;
+  {  int yypos409= yypos, yythunkpos409= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l409;
+  }  goto l406;
+  l409:;	  yypos= yypos409; yythunkpos= yythunkpos409;
+  }
+  {  int yypos410= yypos, yythunkpos410= yythunkpos;  if (!yymatchChar(']')) goto l410;  goto l406;
+  l410:;	  yypos= yypos410; yythunkpos= yythunkpos410;
+  }  if (!yymatchDot()) goto l406;  goto l405;
+  l406:;	  yypos= yypos406; yythunkpos= yythunkpos406;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l404;  if (!yymatchChar(']')) goto l404;  yyDo(yy_1_RawCitationReference, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawCitationReference", yybuf+yypos));
+  return 1;
+  l404:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawCitationReference", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_CitationReferenceSingle()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "CitationReferenceSingle"));
+  {  int yypos412= yypos, yythunkpos412= yythunkpos;  if (!yymatchString("[]")) goto l413;  if (!yy_Spnl()) goto l413;  if (!yy_RawCitationReference()) goto l413;  yyDo(yySet, -1, 0);  goto l412;
+  l413:;	  yypos= yypos412; yythunkpos= yythunkpos412;  if (!yy_RawCitationReference()) goto l411;  yyDo(yySet, -1, 0);  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l411;
+  {  int yypos414= yypos, yythunkpos414= yythunkpos;  if (!yy_Spnl()) goto l414;  if (!yymatchString("[]")) goto l414;  goto l415;
+  l414:;	  yypos= yypos414; yythunkpos= yythunkpos414;
+  }
+  l415:;	  yyText(yybegin, yyend);  if (!(YY_END)) goto l411;
+  }
+  l412:;	  yyDo(yy_1_CitationReferenceSingle, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CitationReferenceSingle", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l411:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CitationReferenceSingle", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_CitationReferenceDouble()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "CitationReferenceDouble"));
+  {  int yypos417= yypos, yythunkpos417= yythunkpos;  if (!yymatchString("[]")) goto l417;  goto l416;
+  l417:;	  yypos= yypos417; yythunkpos= yythunkpos417;
+  }  if (!yy_Label()) goto l416;  yyDo(yySet, -2, 0);  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l416;  if (!yy_Spnl()) goto l416;  yyText(yybegin, yyend);  if (!(YY_END)) goto l416;
+  {  int yypos418= yypos, yythunkpos418= yythunkpos;  if (!yymatchString("[]")) goto l418;  goto l416;
+  l418:;	  yypos= yypos418; yythunkpos= yythunkpos418;
+  }  if (!yy_RawCitationReference()) goto l416;  yyDo(yySet, -1, 0);  yyDo(yy_1_CitationReferenceDouble, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CitationReferenceDouble", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l416:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CitationReferenceDouble", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Notes()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Notes"));  /* StartList */
+  {
+  {  int yypos420= yypos, yythunkpos420= yythunkpos;  if (!yymatchDot()) goto l419;  yypos= yypos420; yythunkpos= yythunkpos420;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);
+  l421:;	
+  {  int yypos422= yypos, yythunkpos422= yythunkpos;
+  {  int yypos423= yypos, yythunkpos423= yythunkpos;
+  {  int yypos425= yypos, yythunkpos425= yythunkpos;  if (!yy_Glossary()) goto l426;  yyDo(yySet, -1, 0);  goto l425;
+  l426:;	  yypos= yypos425; yythunkpos= yythunkpos425;  if (!yy_Note()) goto l424;  yyDo(yySet, -1, 0);
+  }
+  l425:;	  yyDo(yy_1_Notes, yybegin, yyend);  goto l423;
+  l424:;	  yypos= yypos423; yythunkpos= yythunkpos423;  if (!yy_SkipBlock()) goto l422;
+  }
+  l423:;	  goto l421;
+  l422:;	  yypos= yypos422; yythunkpos= yythunkpos422;
+  }  yyDo(yy_2_Notes, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Notes", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l419:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Notes", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_InlineNote()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "InlineNote"));  yyText(yybegin, yyend);  if (!( extension(EXT_NOTES) )) goto l427;  if (!yymatchString("^[")) goto l427;  /* StartList */
+  {
+  {  int yypos428= yypos, yythunkpos428= yythunkpos;  if (!yymatchDot()) goto l427;  yypos= yypos428; yythunkpos= yythunkpos428;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos431= yypos, yythunkpos431= yythunkpos;  if (!yymatchChar(']')) goto l431;  goto l427;
+  l431:;	  yypos= yypos431; yythunkpos= yythunkpos431;
+  }  if (!yy_Inline()) goto l427;  yyDo(yy_1_InlineNote, yybegin, yyend);
+  l429:;	
+  {  int yypos430= yypos, yythunkpos430= yythunkpos;
+  {  int yypos432= yypos, yythunkpos432= yythunkpos;  if (!yymatchChar(']')) goto l432;  goto l430;
+  l432:;	  yypos= yypos432; yythunkpos= yythunkpos432;
+  }  if (!yy_Inline()) goto l430;  yyDo(yy_1_InlineNote, yybegin, yyend);  goto l429;
+  l430:;	  yypos= yypos430; yythunkpos= yythunkpos430;
+  }  if (!yymatchChar(']')) goto l427;  yyDo(yy_2_InlineNote, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "InlineNote", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l427:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "InlineNote", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_RawNoteBlock()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "RawNoteBlock"));  /* StartList */
+  {
+  {  int yypos434= yypos, yythunkpos434= yythunkpos;  if (!yymatchDot()) goto l433;  yypos= yypos434; yythunkpos= yythunkpos434;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos437= yypos, yythunkpos437= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l438:;	
+  {  int yypos439= yypos, yythunkpos439= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos440= yypos, yythunkpos440= yythunkpos;  if (!yymatchChar(' ')) goto l441;  goto l440;
+  l441:;	  yypos= yypos440; yythunkpos= yythunkpos440;  if (!yymatchChar('\t')) goto l439;
+  }
+  l440:;	
+  }  goto l438;
+  l439:;	  yypos= yypos439; yythunkpos= yythunkpos439;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l437;
+  }
+  }  goto l433;
+  l437:;	  yypos= yypos437; yythunkpos= yythunkpos437;
+  }  /* OptionallyIndentedLine */
+  {
+  {  int yypos442= yypos, yythunkpos442= yythunkpos;  /* Indent */
+  {
+  {  int yypos444= yypos, yythunkpos444= yythunkpos;  if (!yymatchChar('\t')) goto l445;  goto l444;
+  l445:;	  yypos= yypos444; yythunkpos= yythunkpos444;  if (!yymatchString("    ")) goto l442;
+  }
+  l444:;	
+  }  goto l443;
+  l442:;	  yypos= yypos442; yythunkpos= yythunkpos442;
+  }
+  l443:;	  /* Line */
+  {  if (!yy_RawLine()) goto l433;  yyDo(yy_1_Line, yybegin, yyend);
+  }
+  }  yyDo(yy_1_RawNoteBlock, yybegin, yyend);
+  l435:;	
+  {  int yypos436= yypos, yythunkpos436= yythunkpos;
+  {  int yypos446= yypos, yythunkpos446= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l447:;	
+  {  int yypos448= yypos, yythunkpos448= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos449= yypos, yythunkpos449= yythunkpos;  if (!yymatchChar(' ')) goto l450;  goto l449;
+  l450:;	  yypos= yypos449; yythunkpos= yythunkpos449;  if (!yymatchChar('\t')) goto l448;
+  }
+  l449:;	
+  }  goto l447;
+  l448:;	  yypos= yypos448; yythunkpos= yythunkpos448;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l446;
+  }
+  }  goto l436;
+  l446:;	  yypos= yypos446; yythunkpos= yythunkpos446;
+  }  /* OptionallyIndentedLine */
+  {
+  {  int yypos451= yypos, yythunkpos451= yythunkpos;  /* Indent */
+  {
+  {  int yypos453= yypos, yythunkpos453= yythunkpos;  if (!yymatchChar('\t')) goto l454;  goto l453;
+  l454:;	  yypos= yypos453; yythunkpos= yythunkpos453;  if (!yymatchString("    ")) goto l451;
+  }
+  l453:;	
+  }  goto l452;
+  l451:;	  yypos= yypos451; yythunkpos= yythunkpos451;
+  }
+  l452:;	  /* Line */
+  {  if (!yy_RawLine()) goto l436;  yyDo(yy_1_Line, yybegin, yyend);
+  }
+  }  yyDo(yy_1_RawNoteBlock, yybegin, yyend);  goto l435;
+  l436:;	  yypos= yypos436; yythunkpos= yythunkpos436;
+  }  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l433;
+  l455:;	
+  {  int yypos456= yypos, yythunkpos456= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l457:;	
+  {  int yypos458= yypos, yythunkpos458= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos459= yypos, yythunkpos459= yythunkpos;  if (!yymatchChar(' ')) goto l460;  goto l459;
+  l460:;	  yypos= yypos459; yythunkpos= yythunkpos459;  if (!yymatchChar('\t')) goto l458;
+  }
+  l459:;	
+  }  goto l457;
+  l458:;	  yypos= yypos458; yythunkpos= yythunkpos458;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l456;
+  }
+  }  goto l455;
+  l456:;	  yypos= yypos456; yythunkpos= yythunkpos456;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l433;  yyDo(yy_2_RawNoteBlock, yybegin, yyend);  yyDo(yy_3_RawNoteBlock, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawNoteBlock", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l433:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawNoteBlock", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_GlossarySortKey()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "GlossarySortKey"));  if (!yymatchChar('(')) goto l461;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l461;
+  l462:;	
+  {  int yypos463= yypos, yythunkpos463= yythunkpos;
+  {  int yypos464= yypos, yythunkpos464= yythunkpos;  if (!yymatchChar(')')) goto l464;  goto l463;
+  l464:;	  yypos= yypos464; yythunkpos= yythunkpos464;
+  }
+  {  int yypos465= yypos, yythunkpos465= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l465;
+  }  goto l463;
+  l465:;	  yypos= yypos465; yythunkpos= yythunkpos465;
+  }  if (!yymatchDot()) goto l463;  goto l462;
+  l463:;	  yypos= yypos463; yythunkpos= yythunkpos463;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l461;  if (!yymatchChar(')')) goto l461;  yyDo(yy_1_GlossarySortKey, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "GlossarySortKey", yybuf+yypos));
+  return 1;
+  l461:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "GlossarySortKey", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_GlossaryTerm()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "GlossaryTerm"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l466;
+  {  int yypos469= yypos, yythunkpos469= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l469;
+  }  goto l466;
+  l469:;	  yypos= yypos469; yythunkpos= yythunkpos469;
+  }
+  {  int yypos470= yypos, yythunkpos470= yythunkpos;  if (!yymatchChar('(')) goto l470;  goto l466;
+  l470:;	  yypos= yypos470; yythunkpos= yythunkpos470;
+  }  if (!yymatchDot()) goto l466;
+  l467:;	
+  {  int yypos468= yypos, yythunkpos468= yythunkpos;
+  {  int yypos471= yypos, yythunkpos471= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l471;
+  }  goto l468;
+  l471:;	  yypos= yypos471; yythunkpos= yythunkpos471;
+  }
+  {  int yypos472= yypos, yythunkpos472= yythunkpos;  if (!yymatchChar('(')) goto l472;  goto l468;
+  l472:;	  yypos= yypos472; yythunkpos= yythunkpos472;
+  }  if (!yymatchDot()) goto l468;  goto l467;
+  l468:;	  yypos= yypos468; yythunkpos= yythunkpos468;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l466;  yyDo(yy_1_GlossaryTerm, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "GlossaryTerm", yybuf+yypos));
+  return 1;
+  l466:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "GlossaryTerm", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_RawNoteReference()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "RawNoteReference"));
+  {  int yypos474= yypos, yythunkpos474= yythunkpos;  if (!yymatchString("[^")) goto l475;  goto l474;
+  l475:;	  yypos= yypos474; yythunkpos= yythunkpos474;  if (!yymatchString("[#")) goto l473;
+  }
+  l474:;	  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l473;
+  {  int yypos478= yypos, yythunkpos478= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l478;
+  }  goto l473;
+  l478:;	  yypos= yypos478; yythunkpos= yythunkpos478;
+  }
+  {  int yypos479= yypos, yythunkpos479= yythunkpos;  if (!yymatchChar(']')) goto l479;  goto l473;
+  l479:;	  yypos= yypos479; yythunkpos= yythunkpos479;
+  }  if (!yymatchDot()) goto l473;
+  l476:;	
+  {  int yypos477= yypos, yythunkpos477= yythunkpos;
+  {  int yypos480= yypos, yythunkpos480= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l480;
+  }  goto l477;
+  l480:;	  yypos= yypos480; yythunkpos= yythunkpos480;
+  }
+  {  int yypos481= yypos, yythunkpos481= yythunkpos;  if (!yymatchChar(']')) goto l481;  goto l477;
+  l481:;	  yypos= yypos481; yythunkpos= yythunkpos481;
+  }  if (!yymatchDot()) goto l477;  goto l476;
+  l477:;	  yypos= yypos477; yythunkpos= yythunkpos477;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l473;  if (!yymatchChar(']')) goto l473;  yyDo(yy_1_RawNoteReference, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawNoteReference", yybuf+yypos));
+  return 1;
+  l473:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawNoteReference", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoteEnd()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "DoubleQuoteEnd"));  if (!yymatchChar('"')) goto l482;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoteEnd", yybuf+yypos));
+  return 1;
+  l482:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoteEnd", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoteStart()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "DoubleQuoteStart"));  if (!yymatchChar('"')) goto l483;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoteStart", yybuf+yypos));
+  return 1;
+  l483:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoteStart", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoteEnd()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "SingleQuoteEnd"));  if (!yymatchChar('\'')) goto l484;
+  {  int yypos485= yypos, yythunkpos485= yythunkpos;  /* Alphanumeric */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l485;
+  }  goto l484;
+  l485:;	  yypos= yypos485; yythunkpos= yythunkpos485;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoteEnd", yybuf+yypos));
+  return 1;
+  l484:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoteEnd", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoteStart()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "SingleQuoteStart"));  if (!yymatchChar('\'')) goto l486;
+  {  int yypos487= yypos, yythunkpos487= yythunkpos;
+  {  int yypos488= yypos, yythunkpos488= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos490= yypos, yythunkpos490= yythunkpos;  if (!yymatchChar(' ')) goto l491;  goto l490;
+  l491:;	  yypos= yypos490; yythunkpos= yythunkpos490;  if (!yymatchChar('\t')) goto l489;
+  }
+  l490:;	
+  }  goto l488;
+  l489:;	  yypos= yypos488; yythunkpos= yythunkpos488;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l487;
+  }
+  }
+  l488:;	  goto l486;
+  l487:;	  yypos= yypos487; yythunkpos= yythunkpos487;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoteStart", yybuf+yypos));
+  return 1;
+  l486:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoteStart", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_EnDash()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "EnDash"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l492;
+  {  int yypos493= yypos, yythunkpos493= yythunkpos;  if (!yymatchString("--")) goto l494;  goto l493;
+  l494:;	  yypos= yypos493; yythunkpos= yythunkpos493;  if (!yymatchChar('-')) goto l492;
+  {  int yypos495= yypos, yythunkpos495= yythunkpos;  /* Digit */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l492;
+  }  yypos= yypos495; yythunkpos= yythunkpos495;
+  }
+  }
+  l493:;	  yyText(yybegin, yyend);  if (!(YY_END)) goto l492;  yyDo(yy_1_EnDash, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EnDash", yybuf+yypos));
+  return 1;
+  l492:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EnDash", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_EmDash()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "EmDash"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l496;  if (!yymatchString("---")) goto l496;  yyText(yybegin, yyend);  if (!(YY_END)) goto l496;  yyDo(yy_1_EmDash, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmDash", yybuf+yypos));
+  return 1;
+  l496:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmDash", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Apostrophe()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Apostrophe"));  if (!yymatchChar('\'')) goto l497;  yyDo(yy_1_Apostrophe, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Apostrophe", yybuf+yypos));
+  return 1;
+  l497:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Apostrophe", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoted()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "DoubleQuoted"));  /* DoubleQuoteStart */
+  {  if (!yymatchChar('"')) goto l498;
+  }  /* StartList */
+  {
+  {  int yypos499= yypos, yythunkpos499= yythunkpos;  if (!yymatchDot()) goto l498;  yypos= yypos499; yythunkpos= yythunkpos499;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);
+  {  int yypos502= yypos, yythunkpos502= yythunkpos;  /* DoubleQuoteEnd */
+  {  if (!yymatchChar('"')) goto l502;
+  }  goto l498;
+  l502:;	  yypos= yypos502; yythunkpos= yythunkpos502;
+  }  if (!yy_Inline()) goto l498;  yyDo(yySet, -1, 0);  yyDo(yy_1_DoubleQuoted, yybegin, yyend);
+  l500:;	
+  {  int yypos501= yypos, yythunkpos501= yythunkpos;
+  {  int yypos503= yypos, yythunkpos503= yythunkpos;  /* DoubleQuoteEnd */
+  {  if (!yymatchChar('"')) goto l503;
+  }  goto l501;
+  l503:;	  yypos= yypos503; yythunkpos= yythunkpos503;
+  }  if (!yy_Inline()) goto l501;  yyDo(yySet, -1, 0);  yyDo(yy_1_DoubleQuoted, yybegin, yyend);  goto l500;
+  l501:;	  yypos= yypos501; yythunkpos= yythunkpos501;
+  }  /* DoubleQuoteEnd */
+  {  if (!yymatchChar('"')) goto l498;
+  }  yyDo(yy_2_DoubleQuoted, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoted", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l498:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoted", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoted()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "SingleQuoted"));  if (!yy_SingleQuoteStart()) goto l504;  /* StartList */
+  {
+  {  int yypos505= yypos, yythunkpos505= yythunkpos;  if (!yymatchDot()) goto l504;  yypos= yypos505; yythunkpos= yythunkpos505;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);
+  {  int yypos508= yypos, yythunkpos508= yythunkpos;  /* SingleQuoteEnd */
+  {  if (!yymatchChar('\'')) goto l508;
+  {  int yypos509= yypos, yythunkpos509= yythunkpos;  /* Alphanumeric */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l509;
+  }  goto l508;
+  l509:;	  yypos= yypos509; yythunkpos= yythunkpos509;
+  }
+  }  goto l504;
+  l508:;	  yypos= yypos508; yythunkpos= yythunkpos508;
+  }  if (!yy_Inline()) goto l504;  yyDo(yySet, -1, 0);  yyDo(yy_1_SingleQuoted, yybegin, yyend);
+  l506:;	
+  {  int yypos507= yypos, yythunkpos507= yythunkpos;
+  {  int yypos510= yypos, yythunkpos510= yythunkpos;  /* SingleQuoteEnd */
+  {  if (!yymatchChar('\'')) goto l510;
+  {  int yypos511= yypos, yythunkpos511= yythunkpos;  /* Alphanumeric */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l511;
+  }  goto l510;
+  l511:;	  yypos= yypos511; yythunkpos= yythunkpos511;
+  }
+  }  goto l507;
+  l510:;	  yypos= yypos510; yythunkpos= yythunkpos510;
+  }  if (!yy_Inline()) goto l507;  yyDo(yySet, -1, 0);  yyDo(yy_1_SingleQuoted, yybegin, yyend);  goto l506;
+  l507:;	  yypos= yypos507; yythunkpos= yythunkpos507;
+  }  /* SingleQuoteEnd */
+  {  if (!yymatchChar('\'')) goto l504;
+  {  int yypos512= yypos, yythunkpos512= yythunkpos;  /* Alphanumeric */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l512;
+  }  goto l504;
+  l512:;	  yypos= yypos512; yythunkpos= yythunkpos512;
+  }
+  }  yyDo(yy_2_SingleQuoted, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoted", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l504:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoted", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Dash()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Dash"));
+  {  int yypos514= yypos, yythunkpos514= yythunkpos;  if (!yy_EmDash()) goto l515;  goto l514;
+  l515:;	  yypos= yypos514; yythunkpos= yythunkpos514;  if (!yy_EnDash()) goto l513;
+  }
+  l514:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Dash", yybuf+yypos));
+  return 1;
+  l513:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Dash", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Ellipsis()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Ellipsis"));
+  {  int yypos517= yypos, yythunkpos517= yythunkpos;  if (!yymatchString("...")) goto l518;  goto l517;
+  l518:;	  yypos= yypos517; yythunkpos= yythunkpos517;  if (!yymatchString(". . .")) goto l516;
+  }
+  l517:;	  yyDo(yy_1_Ellipsis, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ellipsis", yybuf+yypos));
+  return 1;
+  l516:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ellipsis", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Digit()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Digit"));  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l519;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Digit", yybuf+yypos));
+  return 1;
+  l519:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Digit", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_NonAlphanumeric()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "NonAlphanumeric"));  if (!yymatchClass((unsigned char *)"\377\377\377\377\377\377\000\374\001\000\000\370\001\000\000\370\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l520;
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonAlphanumeric", yybuf+yypos));
+  return 1;
+  l520:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NonAlphanumeric", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ExtendedSpecialChar()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "ExtendedSpecialChar"));
+  {  int yypos522= yypos, yythunkpos522= yythunkpos;  yyText(yybegin, yyend);  if (!( extension(EXT_SMART) )) goto l523;
+  {  int yypos524= yypos, yythunkpos524= yythunkpos;  if (!yymatchChar('.')) goto l525;  goto l524;
+  l525:;	  yypos= yypos524; yythunkpos= yythunkpos524;  if (!yymatchChar('-')) goto l526;  goto l524;
+  l526:;	  yypos= yypos524; yythunkpos= yythunkpos524;  if (!yymatchChar('\'')) goto l527;  goto l524;
+  l527:;	  yypos= yypos524; yythunkpos= yythunkpos524;  if (!yymatchChar('"')) goto l523;
+  }
+  l524:;	  goto l522;
+  l523:;	  yypos= yypos522; yythunkpos= yythunkpos522;  yyText(yybegin, yyend);  if (!( extension(EXT_NOTES) )) goto l521;  if (!yymatchChar('^')) goto l521;
+  }
+  l522:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "ExtendedSpecialChar", yybuf+yypos));
+  return 1;
+  l521:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ExtendedSpecialChar", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Quoted()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Quoted"));
+  {  int yypos529= yypos, yythunkpos529= yythunkpos;  if (!yymatchChar('"')) goto l530;
+  l531:;	
+  {  int yypos532= yypos, yythunkpos532= yythunkpos;
+  {  int yypos533= yypos, yythunkpos533= yythunkpos;  if (!yymatchChar('"')) goto l533;  goto l532;
+  l533:;	  yypos= yypos533; yythunkpos= yythunkpos533;
+  }  if (!yymatchDot()) goto l532;  goto l531;
+  l532:;	  yypos= yypos532; yythunkpos= yythunkpos532;
+  }  if (!yymatchChar('"')) goto l530;  goto l529;
+  l530:;	  yypos= yypos529; yythunkpos= yythunkpos529;  if (!yymatchChar('\'')) goto l528;
+  l534:;	
+  {  int yypos535= yypos, yythunkpos535= yythunkpos;
+  {  int yypos536= yypos, yythunkpos536= yythunkpos;  if (!yymatchChar('\'')) goto l536;  goto l535;
+  l536:;	  yypos= yypos536; yythunkpos= yythunkpos536;
+  }  if (!yymatchDot()) goto l535;  goto l534;
+  l535:;	  yypos= yypos535; yythunkpos= yythunkpos535;
+  }  if (!yymatchChar('\'')) goto l528;
+  }
+  l529:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Quoted", yybuf+yypos));
+  return 1;
+  l528:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Quoted", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlTag()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlTag"));  if (!yymatchChar('<')) goto l537;  if (!yy_Spnl()) goto l537;
+  {  int yypos538= yypos, yythunkpos538= yythunkpos;  if (!yymatchChar('/')) goto l538;  goto l539;
+  l538:;	  yypos= yypos538; yythunkpos= yythunkpos538;
+  }
+  l539:;	  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l537;
+  }
+  l540:;	
+  {  int yypos541= yypos, yythunkpos541= yythunkpos;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l541;
+  }  goto l540;
+  l541:;	  yypos= yypos541; yythunkpos= yythunkpos541;
+  }  if (!yy_Spnl()) goto l537;
+  l542:;	
+  {  int yypos543= yypos, yythunkpos543= yythunkpos;  if (!yy_HtmlAttribute()) goto l543;  goto l542;
+  l543:;	  yypos= yypos543; yythunkpos= yythunkpos543;
+  }
+  {  int yypos544= yypos, yythunkpos544= yythunkpos;  if (!yymatchChar('/')) goto l544;  goto l545;
+  l544:;	  yypos= yypos544; yythunkpos= yythunkpos544;
+  }
+  l545:;	  if (!yy_Spnl()) goto l537;  if (!yymatchChar('>')) goto l537;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlTag", yybuf+yypos));
+  return 1;
+  l537:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlTag", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Ticks5()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Ticks5"));  if (!yymatchString("`````")) goto l546;
+  {  int yypos547= yypos, yythunkpos547= yythunkpos;  if (!yymatchChar('`')) goto l547;  goto l546;
+  l547:;	  yypos= yypos547; yythunkpos= yythunkpos547;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks5", yybuf+yypos));
+  return 1;
+  l546:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks5", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Ticks4()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Ticks4"));  if (!yymatchString("````")) goto l548;
+  {  int yypos549= yypos, yythunkpos549= yythunkpos;  if (!yymatchChar('`')) goto l549;  goto l548;
+  l549:;	  yypos= yypos549; yythunkpos= yythunkpos549;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks4", yybuf+yypos));
+  return 1;
+  l548:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks4", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Ticks3()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Ticks3"));  if (!yymatchString("```")) goto l550;
+  {  int yypos551= yypos, yythunkpos551= yythunkpos;  if (!yymatchChar('`')) goto l551;  goto l550;
+  l551:;	  yypos= yypos551; yythunkpos= yythunkpos551;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks3", yybuf+yypos));
+  return 1;
+  l550:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks3", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Ticks2()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Ticks2"));  if (!yymatchString("``")) goto l552;
+  {  int yypos553= yypos, yythunkpos553= yythunkpos;  if (!yymatchChar('`')) goto l553;  goto l552;
+  l553:;	  yypos= yypos553; yythunkpos= yythunkpos553;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks2", yybuf+yypos));
+  return 1;
+  l552:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks2", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Ticks1()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Ticks1"));  if (!yymatchChar('`')) goto l554;
+  {  int yypos555= yypos, yythunkpos555= yythunkpos;  if (!yymatchChar('`')) goto l555;  goto l554;
+  l555:;	  yypos= yypos555; yythunkpos= yythunkpos555;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks1", yybuf+yypos));
+  return 1;
+  l554:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks1", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_References()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "References"));  /* StartList */
+  {
+  {  int yypos557= yypos, yythunkpos557= yythunkpos;  if (!yymatchDot()) goto l556;  yypos= yypos557; yythunkpos= yythunkpos557;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);
+  l558:;	
+  {  int yypos559= yypos, yythunkpos559= yythunkpos;
+  {  int yypos560= yypos, yythunkpos560= yythunkpos;  if (!yy_Reference()) goto l561;  yyDo(yySet, -1, 0);  yyDo(yy_1_References, yybegin, yyend);  goto l560;
+  l561:;	  yypos= yypos560; yythunkpos= yythunkpos560;  if (!yy_SkipBlock()) goto l559;
+  }
+  l560:;	  goto l558;
+  l559:;	  yypos= yypos559; yythunkpos= yythunkpos559;
+  }  yyDo(yy_2_References, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "References", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l556:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "References", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_EmptyTitle()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "EmptyTitle"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l562;  if (!yymatchString("")) goto l562;  yyText(yybegin, yyend);  if (!(YY_END)) goto l562;
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmptyTitle", yybuf+yypos));
+  return 1;
+  l562:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmptyTitle", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleParens()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleParens"));  if (!yy_Spnl()) goto l563;  if (!yymatchChar('(')) goto l563;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l563;
+  l564:;	
+  {  int yypos565= yypos, yythunkpos565= yythunkpos;
+  {  int yypos566= yypos, yythunkpos566= yythunkpos;
+  {  int yypos567= yypos, yythunkpos567= yythunkpos;  if (!yymatchChar(')')) goto l568;  /* Sp */
+  {
+  l569:;	
+  {  int yypos570= yypos, yythunkpos570= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos571= yypos, yythunkpos571= yythunkpos;  if (!yymatchChar(' ')) goto l572;  goto l571;
+  l572:;	  yypos= yypos571; yythunkpos= yythunkpos571;  if (!yymatchChar('\t')) goto l570;
+  }
+  l571:;	
+  }  goto l569;
+  l570:;	  yypos= yypos570; yythunkpos= yythunkpos570;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l568;
+  }  goto l567;
+  l568:;	  yypos= yypos567; yythunkpos= yythunkpos567;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l573;
+  }  goto l567;
+  l573:;	  yypos= yypos567; yythunkpos= yythunkpos567;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l566;  if (!yymatchChar(')')) goto l566;  /* Sp */
+  {
+  l574:;	
+  {  int yypos575= yypos, yythunkpos575= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos576= yypos, yythunkpos576= yythunkpos;  if (!yymatchChar(' ')) goto l577;  goto l576;
+  l577:;	  yypos= yypos576; yythunkpos= yythunkpos576;  if (!yymatchChar('\t')) goto l575;
+  }
+  l576:;	
+  }  goto l574;
+  l575:;	  yypos= yypos575; yythunkpos= yythunkpos575;
+  }
+  }  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l566;
+  }
+  l578:;	
+  {  int yypos579= yypos, yythunkpos579= yythunkpos;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l579;
+  }  goto l578;
+  l579:;	  yypos= yypos579; yythunkpos= yythunkpos579;
+  }  if (!yymatchChar('=')) goto l566;
+  }
+  l567:;	  goto l565;
+  l566:;	  yypos= yypos566; yythunkpos= yythunkpos566;
+  }  if (!yymatchDot()) goto l565;  goto l564;
+  l565:;	  yypos= yypos565; yythunkpos= yythunkpos565;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l563;  if (!yymatchChar(')')) goto l563;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleParens", yybuf+yypos));
+  return 1;
+  l563:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleParens", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleDouble()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleDouble"));  if (!yy_Spnl()) goto l580;  if (!yymatchChar('"')) goto l580;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l580;
+  l581:;	
+  {  int yypos582= yypos, yythunkpos582= yythunkpos;
+  {  int yypos583= yypos, yythunkpos583= yythunkpos;
+  {  int yypos584= yypos, yythunkpos584= yythunkpos;  if (!yymatchChar('"')) goto l585;  /* Sp */
+  {
+  l586:;	
+  {  int yypos587= yypos, yythunkpos587= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos588= yypos, yythunkpos588= yythunkpos;  if (!yymatchChar(' ')) goto l589;  goto l588;
+  l589:;	  yypos= yypos588; yythunkpos= yythunkpos588;  if (!yymatchChar('\t')) goto l587;
+  }
+  l588:;	
+  }  goto l586;
+  l587:;	  yypos= yypos587; yythunkpos= yythunkpos587;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l585;
+  }  goto l584;
+  l585:;	  yypos= yypos584; yythunkpos= yythunkpos584;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l590;
+  }  goto l584;
+  l590:;	  yypos= yypos584; yythunkpos= yythunkpos584;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l583;  if (!yymatchChar('"')) goto l583;  /* Sp */
+  {
+  l591:;	
+  {  int yypos592= yypos, yythunkpos592= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos593= yypos, yythunkpos593= yythunkpos;  if (!yymatchChar(' ')) goto l594;  goto l593;
+  l594:;	  yypos= yypos593; yythunkpos= yythunkpos593;  if (!yymatchChar('\t')) goto l592;
+  }
+  l593:;	
+  }  goto l591;
+  l592:;	  yypos= yypos592; yythunkpos= yythunkpos592;
+  }
+  }  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l583;
+  }
+  l595:;	
+  {  int yypos596= yypos, yythunkpos596= yythunkpos;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l596;
+  }  goto l595;
+  l596:;	  yypos= yypos596; yythunkpos= yythunkpos596;
+  }  if (!yymatchChar('=')) goto l583;
+  }
+  l584:;	  goto l582;
+  l583:;	  yypos= yypos583; yythunkpos= yythunkpos583;
+  }  if (!yymatchDot()) goto l582;  goto l581;
+  l582:;	  yypos= yypos582; yythunkpos= yythunkpos582;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l580;  if (!yymatchChar('"')) goto l580;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleDouble", yybuf+yypos));
+  return 1;
+  l580:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleDouble", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleSingle()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleSingle"));  if (!yy_Spnl()) goto l597;  if (!yymatchChar('\'')) goto l597;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l597;
+  l598:;	
+  {  int yypos599= yypos, yythunkpos599= yythunkpos;
+  {  int yypos600= yypos, yythunkpos600= yythunkpos;
+  {  int yypos601= yypos, yythunkpos601= yythunkpos;  if (!yymatchChar('\'')) goto l602;  /* Sp */
+  {
+  l603:;	
+  {  int yypos604= yypos, yythunkpos604= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos605= yypos, yythunkpos605= yythunkpos;  if (!yymatchChar(' ')) goto l606;  goto l605;
+  l606:;	  yypos= yypos605; yythunkpos= yythunkpos605;  if (!yymatchChar('\t')) goto l604;
+  }
+  l605:;	
+  }  goto l603;
+  l604:;	  yypos= yypos604; yythunkpos= yythunkpos604;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l602;
+  }  goto l601;
+  l602:;	  yypos= yypos601; yythunkpos= yythunkpos601;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l607;
+  }  goto l601;
+  l607:;	  yypos= yypos601; yythunkpos= yythunkpos601;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l600;  if (!yymatchChar('\'')) goto l600;  /* Sp */
+  {
+  l608:;	
+  {  int yypos609= yypos, yythunkpos609= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos610= yypos, yythunkpos610= yythunkpos;  if (!yymatchChar(' ')) goto l611;  goto l610;
+  l611:;	  yypos= yypos610; yythunkpos= yythunkpos610;  if (!yymatchChar('\t')) goto l609;
+  }
+  l610:;	
+  }  goto l608;
+  l609:;	  yypos= yypos609; yythunkpos= yythunkpos609;
+  }
+  }  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l600;
+  }
+  l612:;	
+  {  int yypos613= yypos, yythunkpos613= yythunkpos;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l613;
+  }  goto l612;
+  l613:;	  yypos= yypos613; yythunkpos= yythunkpos613;
+  }  if (!yymatchChar('=')) goto l600;
+  }
+  l601:;	  goto l599;
+  l600:;	  yypos= yypos600; yythunkpos= yythunkpos600;
+  }  if (!yymatchDot()) goto l599;  goto l598;
+  l599:;	  yypos= yypos599; yythunkpos= yythunkpos599;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l597;  if (!yymatchChar('\'')) goto l597;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleSingle", yybuf+yypos));
+  return 1;
+  l597:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleSingle", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_UnQuotedValue()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "UnQuotedValue"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l614;
+  {  int yypos617= yypos, yythunkpos617= yythunkpos;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l618;
+  }  goto l617;
+  l618:;	  yypos= yypos617; yythunkpos= yythunkpos617;  if (!yymatchChar('.')) goto l614;
+  }
+  l617:;	
+  l615:;	
+  {  int yypos616= yypos, yythunkpos616= yythunkpos;
+  {  int yypos619= yypos, yythunkpos619= yythunkpos;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l620;
+  }  goto l619;
+  l620:;	  yypos= yypos619; yythunkpos= yythunkpos619;  if (!yymatchChar('.')) goto l616;
+  }
+  l619:;	  goto l615;
+  l616:;	  yypos= yypos616; yythunkpos= yythunkpos616;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l614;
+  yyprintf((stderr, "  ok   %s @ %s\n", "UnQuotedValue", yybuf+yypos));
+  return 1;
+  l614:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "UnQuotedValue", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_QuotedValue()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "QuotedValue"));  if (!yymatchChar('"')) goto l621;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l621;
+  l622:;	
+  {  int yypos623= yypos, yythunkpos623= yythunkpos;
+  {  int yypos624= yypos, yythunkpos624= yythunkpos;  if (!yymatchChar('"')) goto l624;  goto l623;
+  l624:;	  yypos= yypos624; yythunkpos= yythunkpos624;
+  }  if (!yymatchDot()) goto l623;  goto l622;
+  l623:;	  yypos= yypos623; yythunkpos= yythunkpos623;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l621;  if (!yymatchChar('"')) goto l621;
+  yyprintf((stderr, "  ok   %s @ %s\n", "QuotedValue", yybuf+yypos));
+  return 1;
+  l621:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "QuotedValue", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AttrValue()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "AttrValue"));
+  {  int yypos626= yypos, yythunkpos626= yythunkpos;  if (!yy_QuotedValue()) goto l627;  goto l626;
+  l627:;	  yypos= yypos626; yythunkpos= yythunkpos626;  if (!yy_UnQuotedValue()) goto l625;
+  }
+  l626:;	  yyDo(yy_1_AttrValue, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AttrValue", yybuf+yypos));
+  return 1;
+  l625:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AttrValue", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AttrKey()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "AttrKey"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l628;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l628;
+  }
+  l629:;	
+  {  int yypos630= yypos, yythunkpos630= yythunkpos;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l630;
+  }  goto l629;
+  l630:;	  yypos= yypos630; yythunkpos= yythunkpos630;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l628;  yyDo(yy_1_AttrKey, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AttrKey", yybuf+yypos));
+  return 1;
+  l628:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AttrKey", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Attribute()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Attribute"));  if (!yy_Spnl()) goto l631;  if (!yy_AttrKey()) goto l631;  yyDo(yySet, -2, 0);  if (!yymatchChar('=')) goto l631;  if (!yy_AttrValue()) goto l631;  yyDo(yySet, -1, 0);  yyDo(yy_1_Attribute, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Attribute", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l631:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Attribute", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Attributes()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Attributes"));  /* StartList */
+  {
+  {  int yypos633= yypos, yythunkpos633= yythunkpos;  if (!yymatchDot()) goto l632;  yypos= yypos633; yythunkpos= yythunkpos633;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  if (!yy_Attribute()) goto l632;  yyDo(yy_1_Attributes, yybegin, yyend);
+  l634:;	
+  {  int yypos635= yypos, yythunkpos635= yythunkpos;  if (!yy_Attribute()) goto l635;  yyDo(yy_1_Attributes, yybegin, yyend);  goto l634;
+  l635:;	  yypos= yypos635; yythunkpos= yythunkpos635;
+  }  yyDo(yy_2_Attributes, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Attributes", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l632:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Attributes", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitle()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "RefTitle"));
+  {  int yypos637= yypos, yythunkpos637= yythunkpos;  if (!yy_RefTitleSingle()) goto l638;  goto l637;
+  l638:;	  yypos= yypos637; yythunkpos= yythunkpos637;  if (!yy_RefTitleDouble()) goto l639;  goto l637;
+  l639:;	  yypos= yypos637; yythunkpos= yythunkpos637;  if (!yy_RefTitleParens()) goto l640;  goto l637;
+  l640:;	  yypos= yypos637; yythunkpos= yythunkpos637;  /* EmptyTitle */
+  {  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l636;  if (!yymatchString("")) goto l636;  yyText(yybegin, yyend);  if (!(YY_END)) goto l636;
+  }
+  }
+  l637:;	  yyDo(yy_1_RefTitle, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitle", yybuf+yypos));
+  return 1;
+  l636:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitle", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_RefSrc()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "RefSrc"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l641;  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l641;
+  }
+  l642:;	
+  {  int yypos643= yypos, yythunkpos643= yythunkpos;  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l643;
+  }  goto l642;
+  l643:;	  yypos= yypos643; yythunkpos= yythunkpos643;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l641;  yyDo(yy_1_RefSrc, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefSrc", yybuf+yypos));
+  return 1;
+  l641:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefSrc", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLinkEmail()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "AutoLinkEmail"));  if (!yymatchChar('<')) goto l644;
+  {  int yypos645= yypos, yythunkpos645= yythunkpos;  if (!yymatchString("mailto:")) goto l645;  goto l646;
+  l645:;	  yypos= yypos645; yythunkpos= yythunkpos645;
+  }
+  l646:;	  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l644;  if (!yymatchClass((unsigned char *)"\000\000\000\000\062\350\377\003\376\377\377\207\376\377\377\107\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l644;
+  l647:;	
+  {  int yypos648= yypos, yythunkpos648= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\062\350\377\003\376\377\377\207\376\377\377\107\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l648;  goto l647;
+  l648:;	  yypos= yypos648; yythunkpos= yythunkpos648;
+  }  if (!yymatchChar('@')) goto l644;
+  {  int yypos651= yypos, yythunkpos651= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l651;
+  }  goto l644;
+  l651:;	  yypos= yypos651; yythunkpos= yythunkpos651;
+  }
+  {  int yypos652= yypos, yythunkpos652= yythunkpos;  if (!yymatchChar('>')) goto l652;  goto l644;
+  l652:;	  yypos= yypos652; yythunkpos= yythunkpos652;
+  }  if (!yymatchDot()) goto l644;
+  l649:;	
+  {  int yypos650= yypos, yythunkpos650= yythunkpos;
+  {  int yypos653= yypos, yythunkpos653= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l653;
+  }  goto l650;
+  l653:;	  yypos= yypos653; yythunkpos= yythunkpos653;
+  }
+  {  int yypos654= yypos, yythunkpos654= yythunkpos;  if (!yymatchChar('>')) goto l654;  goto l650;
+  l654:;	  yypos= yypos654; yythunkpos= yythunkpos654;
+  }  if (!yymatchDot()) goto l650;  goto l649;
+  l650:;	  yypos= yypos650; yythunkpos= yythunkpos650;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l644;  if (!yymatchChar('>')) goto l644;  yyDo(yy_1_AutoLinkEmail, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLinkEmail", yybuf+yypos));
+  return 1;
+  l644:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLinkEmail", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLinkUrl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "AutoLinkUrl"));  if (!yymatchChar('<')) goto l655;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l655;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l655;
+  l656:;	
+  {  int yypos657= yypos, yythunkpos657= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l657;  goto l656;
+  l657:;	  yypos= yypos657; yythunkpos= yythunkpos657;
+  }  if (!yymatchString("://")) goto l655;
+  {  int yypos660= yypos, yythunkpos660= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l660;
+  }  goto l655;
+  l660:;	  yypos= yypos660; yythunkpos= yythunkpos660;
+  }
+  {  int yypos661= yypos, yythunkpos661= yythunkpos;  if (!yymatchChar('>')) goto l661;  goto l655;
+  l661:;	  yypos= yypos661; yythunkpos= yythunkpos661;
+  }  if (!yymatchDot()) goto l655;
+  l658:;	
+  {  int yypos659= yypos, yythunkpos659= yythunkpos;
+  {  int yypos662= yypos, yythunkpos662= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l662;
+  }  goto l659;
+  l662:;	  yypos= yypos662; yythunkpos= yythunkpos662;
+  }
+  {  int yypos663= yypos, yythunkpos663= yythunkpos;  if (!yymatchChar('>')) goto l663;  goto l659;
+  l663:;	  yypos= yypos663; yythunkpos= yythunkpos663;
+  }  if (!yymatchDot()) goto l659;  goto l658;
+  l659:;	  yypos= yypos659; yythunkpos= yythunkpos659;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l655;  if (!yymatchChar('>')) goto l655;  yyDo(yy_1_AutoLinkUrl, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLinkUrl", yybuf+yypos));
+  return 1;
+  l655:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLinkUrl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TitleDouble()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "TitleDouble"));  if (!yymatchChar('"')) goto l664;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l664;
+  l665:;	
+  {  int yypos666= yypos, yythunkpos666= yythunkpos;
+  {  int yypos667= yypos, yythunkpos667= yythunkpos;  if (!yymatchChar('"')) goto l667;  /* Sp */
+  {
+  l668:;	
+  {  int yypos669= yypos, yythunkpos669= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos670= yypos, yythunkpos670= yythunkpos;  if (!yymatchChar(' ')) goto l671;  goto l670;
+  l671:;	  yypos= yypos670; yythunkpos= yythunkpos670;  if (!yymatchChar('\t')) goto l669;
+  }
+  l670:;	
+  }  goto l668;
+  l669:;	  yypos= yypos669; yythunkpos= yythunkpos669;
+  }
+  }
+  {  int yypos672= yypos, yythunkpos672= yythunkpos;  if (!yymatchChar(')')) goto l673;  goto l672;
+  l673:;	  yypos= yypos672; yythunkpos= yythunkpos672;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l667;
+  }
+  }
+  l672:;	  goto l666;
+  l667:;	  yypos= yypos667; yythunkpos= yythunkpos667;
+  }  if (!yymatchDot()) goto l666;  goto l665;
+  l666:;	  yypos= yypos666; yythunkpos= yythunkpos666;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l664;  if (!yymatchChar('"')) goto l664;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TitleDouble", yybuf+yypos));
+  return 1;
+  l664:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TitleDouble", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TitleSingle()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "TitleSingle"));  if (!yymatchChar('\'')) goto l674;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l674;
+  l675:;	
+  {  int yypos676= yypos, yythunkpos676= yythunkpos;
+  {  int yypos677= yypos, yythunkpos677= yythunkpos;  if (!yymatchChar('\'')) goto l677;  /* Sp */
+  {
+  l678:;	
+  {  int yypos679= yypos, yythunkpos679= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos680= yypos, yythunkpos680= yythunkpos;  if (!yymatchChar(' ')) goto l681;  goto l680;
+  l681:;	  yypos= yypos680; yythunkpos= yythunkpos680;  if (!yymatchChar('\t')) goto l679;
+  }
+  l680:;	
+  }  goto l678;
+  l679:;	  yypos= yypos679; yythunkpos= yythunkpos679;
+  }
+  }
+  {  int yypos682= yypos, yythunkpos682= yythunkpos;  if (!yymatchChar(')')) goto l683;  goto l682;
+  l683:;	  yypos= yypos682; yythunkpos= yythunkpos682;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l677;
+  }
+  }
+  l682:;	  goto l676;
+  l677:;	  yypos= yypos677; yythunkpos= yythunkpos677;
+  }  if (!yymatchDot()) goto l676;  goto l675;
+  l676:;	  yypos= yypos676; yythunkpos= yythunkpos676;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l674;  if (!yymatchChar('\'')) goto l674;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TitleSingle", yybuf+yypos));
+  return 1;
+  l674:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TitleSingle", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Nonspacechar()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Nonspacechar"));  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l684;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Nonspacechar", yybuf+yypos));
+  return 1;
+  l684:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Nonspacechar", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SourceContents()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "SourceContents"));
+  {  int yypos686= yypos, yythunkpos686= yythunkpos;
+  {  int yypos690= yypos, yythunkpos690= yythunkpos;
+  {  int yypos694= yypos, yythunkpos694= yythunkpos;  if (!yymatchChar('(')) goto l694;  goto l691;
+  l694:;	  yypos= yypos694; yythunkpos= yythunkpos694;
+  }
+  {  int yypos695= yypos, yythunkpos695= yythunkpos;  if (!yymatchChar(')')) goto l695;  goto l691;
+  l695:;	  yypos= yypos695; yythunkpos= yythunkpos695;
+  }
+  {  int yypos696= yypos, yythunkpos696= yythunkpos;  if (!yymatchChar('>')) goto l696;  goto l691;
+  l696:;	  yypos= yypos696; yythunkpos= yythunkpos696;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l691;
+  }
+  l692:;	
+  {  int yypos693= yypos, yythunkpos693= yythunkpos;
+  {  int yypos697= yypos, yythunkpos697= yythunkpos;  if (!yymatchChar('(')) goto l697;  goto l693;
+  l697:;	  yypos= yypos697; yythunkpos= yythunkpos697;
+  }
+  {  int yypos698= yypos, yythunkpos698= yythunkpos;  if (!yymatchChar(')')) goto l698;  goto l693;
+  l698:;	  yypos= yypos698; yythunkpos= yythunkpos698;
+  }
+  {  int yypos699= yypos, yythunkpos699= yythunkpos;  if (!yymatchChar('>')) goto l699;  goto l693;
+  l699:;	  yypos= yypos699; yythunkpos= yythunkpos699;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l693;
+  }  goto l692;
+  l693:;	  yypos= yypos693; yythunkpos= yythunkpos693;
+  }  goto l690;
+  l691:;	  yypos= yypos690; yythunkpos= yythunkpos690;  if (!yymatchChar('(')) goto l687;  if (!yy_SourceContents()) goto l687;  if (!yymatchChar(')')) goto l687;
+  }
+  l690:;	
+  l688:;	
+  {  int yypos689= yypos, yythunkpos689= yythunkpos;
+  {  int yypos700= yypos, yythunkpos700= yythunkpos;
+  {  int yypos704= yypos, yythunkpos704= yythunkpos;  if (!yymatchChar('(')) goto l704;  goto l701;
+  l704:;	  yypos= yypos704; yythunkpos= yythunkpos704;
+  }
+  {  int yypos705= yypos, yythunkpos705= yythunkpos;  if (!yymatchChar(')')) goto l705;  goto l701;
+  l705:;	  yypos= yypos705; yythunkpos= yythunkpos705;
+  }
+  {  int yypos706= yypos, yythunkpos706= yythunkpos;  if (!yymatchChar('>')) goto l706;  goto l701;
+  l706:;	  yypos= yypos706; yythunkpos= yythunkpos706;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l701;
+  }
+  l702:;	
+  {  int yypos703= yypos, yythunkpos703= yythunkpos;
+  {  int yypos707= yypos, yythunkpos707= yythunkpos;  if (!yymatchChar('(')) goto l707;  goto l703;
+  l707:;	  yypos= yypos707; yythunkpos= yythunkpos707;
+  }
+  {  int yypos708= yypos, yythunkpos708= yythunkpos;  if (!yymatchChar(')')) goto l708;  goto l703;
+  l708:;	  yypos= yypos708; yythunkpos= yythunkpos708;
+  }
+  {  int yypos709= yypos, yythunkpos709= yythunkpos;  if (!yymatchChar('>')) goto l709;  goto l703;
+  l709:;	  yypos= yypos709; yythunkpos= yythunkpos709;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l703;
+  }  goto l702;
+  l703:;	  yypos= yypos703; yythunkpos= yythunkpos703;
+  }  goto l700;
+  l701:;	  yypos= yypos700; yythunkpos= yythunkpos700;  if (!yymatchChar('(')) goto l689;  if (!yy_SourceContents()) goto l689;  if (!yymatchChar(')')) goto l689;
+  }
+  l700:;	  goto l688;
+  l689:;	  yypos= yypos689; yythunkpos= yythunkpos689;
+  }  goto l686;
+  l687:;	  yypos= yypos686; yythunkpos= yythunkpos686;  if (!yymatchString("")) goto l685;
+  }
+  l686:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SourceContents", yybuf+yypos));
+  return 1;
+  l685:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SourceContents", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Title()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Title"));
+  {  int yypos711= yypos, yythunkpos711= yythunkpos;  if (!yy_TitleSingle()) goto l712;  goto l711;
+  l712:;	  yypos= yypos711; yythunkpos= yythunkpos711;  if (!yy_TitleDouble()) goto l713;  goto l711;
+  l713:;	  yypos= yypos711; yythunkpos= yythunkpos711;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l710;  if (!yymatchString("")) goto l710;  yyText(yybegin, yyend);  if (!(YY_END)) goto l710;
+  }
+  l711:;	  yyDo(yy_1_Title, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Title", yybuf+yypos));
+  return 1;
+  l710:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Title", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Source()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Source"));
+  {  int yypos715= yypos, yythunkpos715= yythunkpos;  if (!yymatchChar('<')) goto l716;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l716;  if (!yy_SourceContents()) goto l716;  yyText(yybegin, yyend);  if (!(YY_END)) goto l716;  if (!yymatchChar('>')) goto l716;  goto l715;
+  l716:;	  yypos= yypos715; yythunkpos= yythunkpos715;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l714;  if (!yy_SourceContents()) goto l714;  yyText(yybegin, yyend);  if (!(YY_END)) goto l714;
+  }
+  l715:;	  yyDo(yy_1_Source, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Source", yybuf+yypos));
+  return 1;
+  l714:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Source", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Label()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Label"));  if (!yymatchChar('[')) goto l717;
+  {  int yypos718= yypos, yythunkpos718= yythunkpos;  if (!yymatchChar('[')) goto l718;  goto l717;
+  l718:;	  yypos= yypos718; yythunkpos= yythunkpos718;
+  }
+  {  int yypos719= yypos, yythunkpos719= yythunkpos;
+  {  int yypos721= yypos, yythunkpos721= yythunkpos;  if (!yymatchChar('^')) goto l721;  goto l720;
+  l721:;	  yypos= yypos721; yythunkpos= yythunkpos721;
+  }
+  {  int yypos722= yypos, yythunkpos722= yythunkpos;  if (!yymatchChar('#')) goto l722;  goto l720;
+  l722:;	  yypos= yypos722; yythunkpos= yythunkpos722;
+  }  yyText(yybegin, yyend);  if (!( extension(EXT_NOTES) )) goto l720;  goto l719;
+  l720:;	  yypos= yypos719; yythunkpos= yythunkpos719;
+  {  int yypos723= yypos, yythunkpos723= yythunkpos;  if (!yymatchDot()) goto l717;  yypos= yypos723; yythunkpos= yythunkpos723;
+  }  yyText(yybegin, yyend);  if (!( !extension(EXT_NOTES) )) goto l717;
+  }
+  l719:;	  /* StartList */
+  {
+  {  int yypos724= yypos, yythunkpos724= yythunkpos;  if (!yymatchDot()) goto l717;  yypos= yypos724; yythunkpos= yythunkpos724;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  l725:;	
+  {  int yypos726= yypos, yythunkpos726= yythunkpos;
+  {  int yypos727= yypos, yythunkpos727= yythunkpos;  if (!yymatchChar(']')) goto l727;  goto l726;
+  l727:;	  yypos= yypos727; yythunkpos= yythunkpos727;
+  }  if (!yy_Inline()) goto l726;  yyDo(yy_1_Label, yybegin, yyend);  goto l725;
+  l726:;	  yypos= yypos726; yythunkpos= yythunkpos726;
+  }  if (!yymatchChar(']')) goto l717;  yyDo(yy_2_Label, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Label", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l717:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Label", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLinkSingle()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ReferenceLinkSingle"));  if (!yy_Label()) goto l728;  yyDo(yySet, -1, 0);  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l728;
+  {  int yypos729= yypos, yythunkpos729= yythunkpos;  if (!yy_Spnl()) goto l729;  if (!yymatchString("[]")) goto l729;  goto l730;
+  l729:;	  yypos= yypos729; yythunkpos= yythunkpos729;
+  }
+  l730:;	  yyText(yybegin, yyend);  if (!(YY_END)) goto l728;  yyDo(yy_1_ReferenceLinkSingle, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLinkSingle", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l728:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLinkSingle", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLinkDouble()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "ReferenceLinkDouble"));  if (!yy_Label()) goto l731;  yyDo(yySet, -2, 0);  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l731;  if (!yy_Spnl()) goto l731;  yyText(yybegin, yyend);  if (!(YY_END)) goto l731;
+  {  int yypos732= yypos, yythunkpos732= yythunkpos;  if (!yymatchString("[]")) goto l732;  goto l731;
+  l732:;	  yypos= yypos732; yythunkpos= yythunkpos732;
+  }  if (!yy_Label()) goto l731;  yyDo(yySet, -1, 0);  yyDo(yy_1_ReferenceLinkDouble, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLinkDouble", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l731:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLinkDouble", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLink()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "AutoLink"));
+  {  int yypos734= yypos, yythunkpos734= yythunkpos;  if (!yy_AutoLinkUrl()) goto l735;  goto l734;
+  l735:;	  yypos= yypos734; yythunkpos= yythunkpos734;  if (!yy_AutoLinkEmail()) goto l733;
+  }
+  l734:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLink", yybuf+yypos));
+  return 1;
+  l733:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLink", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLink()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "ReferenceLink"));
+  {  int yypos737= yypos, yythunkpos737= yythunkpos;  if (!yy_ReferenceLinkDouble()) goto l738;  goto l737;
+  l738:;	  yypos= yypos737; yythunkpos= yythunkpos737;  if (!yy_ReferenceLinkSingle()) goto l736;
+  }
+  l737:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLink", yybuf+yypos));
+  return 1;
+  l736:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLink", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ExplicitLink()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "ExplicitLink"));  if (!yy_Label()) goto l739;  yyDo(yySet, -3, 0);  if (!yy_Spnl()) goto l739;  if (!yymatchChar('(')) goto l739;  /* Sp */
+  {
+  l740:;	
+  {  int yypos741= yypos, yythunkpos741= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos742= yypos, yythunkpos742= yythunkpos;  if (!yymatchChar(' ')) goto l743;  goto l742;
+  l743:;	  yypos= yypos742; yythunkpos= yythunkpos742;  if (!yymatchChar('\t')) goto l741;
+  }
+  l742:;	
+  }  goto l740;
+  l741:;	  yypos= yypos741; yythunkpos= yythunkpos741;
+  }
+  }  if (!yy_Source()) goto l739;  yyDo(yySet, -2, 0);  if (!yy_Spnl()) goto l739;  if (!yy_Title()) goto l739;  yyDo(yySet, -1, 0);  /* Sp */
+  {
+  l744:;	
+  {  int yypos745= yypos, yythunkpos745= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos746= yypos, yythunkpos746= yythunkpos;  if (!yymatchChar(' ')) goto l747;  goto l746;
+  l747:;	  yypos= yypos746; yythunkpos= yythunkpos746;  if (!yymatchChar('\t')) goto l745;
+  }
+  l746:;	
+  }  goto l744;
+  l745:;	  yypos= yypos745; yythunkpos= yythunkpos745;
+  }
+  }  if (!yymatchChar(')')) goto l739;  yyDo(yy_1_ExplicitLink, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ExplicitLink", yybuf+yypos));  yyDo(yyPop, 3, 0);
+  return 1;
+  l739:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ExplicitLink", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TwoUlClose()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "TwoUlClose"));
+  {  int yypos749= yypos, yythunkpos749= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos750= yypos, yythunkpos750= yythunkpos;  if (!yymatchChar(' ')) goto l751;  goto l750;
+  l751:;	  yypos= yypos750; yythunkpos= yythunkpos750;  if (!yymatchChar('\t')) goto l749;
+  }
+  l750:;	
+  }  goto l748;
+  l749:;	  yypos= yypos749; yythunkpos= yythunkpos749;
+  }
+  {  int yypos752= yypos, yythunkpos752= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l752;
+  }  goto l748;
+  l752:;	  yypos= yypos752; yythunkpos= yythunkpos752;
+  }  if (!yy_Inline()) goto l748;  yyDo(yySet, -1, 0);  if (!yymatchString("__")) goto l748;
+  {  int yypos753= yypos, yythunkpos753= yythunkpos;  /* Alphanumeric */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l753;
+  }  goto l748;
+  l753:;	  yypos= yypos753; yythunkpos= yythunkpos753;
+  }  yyDo(yy_1_TwoUlClose, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TwoUlClose", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l748:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TwoUlClose", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TwoUlOpen()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "TwoUlOpen"));
+  {  int yypos755= yypos, yythunkpos755= yythunkpos;  if (!yy_UlLine()) goto l755;  goto l754;
+  l755:;	  yypos= yypos755; yythunkpos= yythunkpos755;
+  }  if (!yymatchString("__")) goto l754;
+  {  int yypos756= yypos, yythunkpos756= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos757= yypos, yythunkpos757= yythunkpos;  if (!yymatchChar(' ')) goto l758;  goto l757;
+  l758:;	  yypos= yypos757; yythunkpos= yythunkpos757;  if (!yymatchChar('\t')) goto l756;
+  }
+  l757:;	
+  }  goto l754;
+  l756:;	  yypos= yypos756; yythunkpos= yythunkpos756;
+  }
+  {  int yypos759= yypos, yythunkpos759= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l759;
+  }  goto l754;
+  l759:;	  yypos= yypos759; yythunkpos= yythunkpos759;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "TwoUlOpen", yybuf+yypos));
+  return 1;
+  l754:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TwoUlOpen", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TwoStarClose()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "TwoStarClose"));
+  {  int yypos761= yypos, yythunkpos761= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos762= yypos, yythunkpos762= yythunkpos;  if (!yymatchChar(' ')) goto l763;  goto l762;
+  l763:;	  yypos= yypos762; yythunkpos= yythunkpos762;  if (!yymatchChar('\t')) goto l761;
+  }
+  l762:;	
+  }  goto l760;
+  l761:;	  yypos= yypos761; yythunkpos= yythunkpos761;
+  }
+  {  int yypos764= yypos, yythunkpos764= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l764;
+  }  goto l760;
+  l764:;	  yypos= yypos764; yythunkpos= yythunkpos764;
+  }  if (!yy_Inline()) goto l760;  yyDo(yySet, -1, 0);  if (!yymatchString("**")) goto l760;  yyDo(yy_1_TwoStarClose, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TwoStarClose", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l760:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TwoStarClose", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TwoStarOpen()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "TwoStarOpen"));
+  {  int yypos766= yypos, yythunkpos766= yythunkpos;  if (!yy_StarLine()) goto l766;  goto l765;
+  l766:;	  yypos= yypos766; yythunkpos= yythunkpos766;
+  }  if (!yymatchString("**")) goto l765;
+  {  int yypos767= yypos, yythunkpos767= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos768= yypos, yythunkpos768= yythunkpos;  if (!yymatchChar(' ')) goto l769;  goto l768;
+  l769:;	  yypos= yypos768; yythunkpos= yythunkpos768;  if (!yymatchChar('\t')) goto l767;
+  }
+  l768:;	
+  }  goto l765;
+  l767:;	  yypos= yypos767; yythunkpos= yythunkpos767;
+  }
+  {  int yypos770= yypos, yythunkpos770= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l770;
+  }  goto l765;
+  l770:;	  yypos= yypos770; yythunkpos= yythunkpos770;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "TwoStarOpen", yybuf+yypos));
+  return 1;
+  l765:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TwoStarOpen", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_StrongUl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "StrongUl"));  if (!yy_TwoUlOpen()) goto l771;  /* StartList */
+  {
+  {  int yypos772= yypos, yythunkpos772= yythunkpos;  if (!yymatchDot()) goto l771;  yypos= yypos772; yythunkpos= yythunkpos772;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  l773:;	
+  {  int yypos774= yypos, yythunkpos774= yythunkpos;
+  {  int yypos775= yypos, yythunkpos775= yythunkpos;  if (!yy_TwoUlClose()) goto l775;  goto l774;
+  l775:;	  yypos= yypos775; yythunkpos= yythunkpos775;
+  }  if (!yy_Inline()) goto l774;  yyDo(yy_1_StrongUl, yybegin, yyend);  goto l773;
+  l774:;	  yypos= yypos774; yythunkpos= yythunkpos774;
+  }  if (!yy_TwoUlClose()) goto l771;  yyDo(yy_2_StrongUl, yybegin, yyend);  yyDo(yy_3_StrongUl, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongUl", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l771:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongUl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_StrongStar()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "StrongStar"));  if (!yy_TwoStarOpen()) goto l776;  /* StartList */
+  {
+  {  int yypos777= yypos, yythunkpos777= yythunkpos;  if (!yymatchDot()) goto l776;  yypos= yypos777; yythunkpos= yythunkpos777;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  l778:;	
+  {  int yypos779= yypos, yythunkpos779= yythunkpos;
+  {  int yypos780= yypos, yythunkpos780= yythunkpos;  if (!yy_TwoStarClose()) goto l780;  goto l779;
+  l780:;	  yypos= yypos780; yythunkpos= yythunkpos780;
+  }  if (!yy_Inline()) goto l779;  yyDo(yy_1_StrongStar, yybegin, yyend);  goto l778;
+  l779:;	  yypos= yypos779; yythunkpos= yythunkpos779;
+  }  if (!yy_TwoStarClose()) goto l776;  yyDo(yy_2_StrongStar, yybegin, yyend);  yyDo(yy_3_StrongStar, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongStar", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l776:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongStar", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_OneUlClose()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OneUlClose"));
+  {  int yypos782= yypos, yythunkpos782= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos783= yypos, yythunkpos783= yythunkpos;  if (!yymatchChar(' ')) goto l784;  goto l783;
+  l784:;	  yypos= yypos783; yythunkpos= yythunkpos783;  if (!yymatchChar('\t')) goto l782;
+  }
+  l783:;	
+  }  goto l781;
+  l782:;	  yypos= yypos782; yythunkpos= yythunkpos782;
+  }
+  {  int yypos785= yypos, yythunkpos785= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l785;
+  }  goto l781;
+  l785:;	  yypos= yypos785; yythunkpos= yythunkpos785;
+  }  if (!yy_Inline()) goto l781;  yyDo(yySet, -1, 0);  if (!yymatchChar('_')) goto l781;
+  {  int yypos786= yypos, yythunkpos786= yythunkpos;  /* Alphanumeric */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l786;
+  }  goto l781;
+  l786:;	  yypos= yypos786; yythunkpos= yythunkpos786;
+  }  yyDo(yy_1_OneUlClose, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OneUlClose", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l781:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OneUlClose", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_OneUlOpen()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "OneUlOpen"));
+  {  int yypos788= yypos, yythunkpos788= yythunkpos;  if (!yy_UlLine()) goto l788;  goto l787;
+  l788:;	  yypos= yypos788; yythunkpos= yythunkpos788;
+  }  if (!yymatchChar('_')) goto l787;
+  {  int yypos789= yypos, yythunkpos789= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos790= yypos, yythunkpos790= yythunkpos;  if (!yymatchChar(' ')) goto l791;  goto l790;
+  l791:;	  yypos= yypos790; yythunkpos= yythunkpos790;  if (!yymatchChar('\t')) goto l789;
+  }
+  l790:;	
+  }  goto l787;
+  l789:;	  yypos= yypos789; yythunkpos= yythunkpos789;
+  }
+  {  int yypos792= yypos, yythunkpos792= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l792;
+  }  goto l787;
+  l792:;	  yypos= yypos792; yythunkpos= yythunkpos792;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "OneUlOpen", yybuf+yypos));
+  return 1;
+  l787:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OneUlOpen", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_OneStarClose()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OneStarClose"));
+  {  int yypos794= yypos, yythunkpos794= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos795= yypos, yythunkpos795= yythunkpos;  if (!yymatchChar(' ')) goto l796;  goto l795;
+  l796:;	  yypos= yypos795; yythunkpos= yythunkpos795;  if (!yymatchChar('\t')) goto l794;
+  }
+  l795:;	
+  }  goto l793;
+  l794:;	  yypos= yypos794; yythunkpos= yythunkpos794;
+  }
+  {  int yypos797= yypos, yythunkpos797= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l797;
+  }  goto l793;
+  l797:;	  yypos= yypos797; yythunkpos= yythunkpos797;
+  }  if (!yy_Inline()) goto l793;  yyDo(yySet, -1, 0);  if (!yymatchChar('*')) goto l793;  yyDo(yy_1_OneStarClose, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OneStarClose", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l793:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OneStarClose", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_OneStarOpen()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "OneStarOpen"));
+  {  int yypos799= yypos, yythunkpos799= yythunkpos;  if (!yy_StarLine()) goto l799;  goto l798;
+  l799:;	  yypos= yypos799; yythunkpos= yythunkpos799;
+  }  if (!yymatchChar('*')) goto l798;
+  {  int yypos800= yypos, yythunkpos800= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos801= yypos, yythunkpos801= yythunkpos;  if (!yymatchChar(' ')) goto l802;  goto l801;
+  l802:;	  yypos= yypos801; yythunkpos= yythunkpos801;  if (!yymatchChar('\t')) goto l800;
+  }
+  l801:;	
+  }  goto l798;
+  l800:;	  yypos= yypos800; yythunkpos= yythunkpos800;
+  }
+  {  int yypos803= yypos, yythunkpos803= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l803;
+  }  goto l798;
+  l803:;	  yypos= yypos803; yythunkpos= yythunkpos803;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "OneStarOpen", yybuf+yypos));
+  return 1;
+  l798:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OneStarOpen", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_EmphUl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "EmphUl"));  if (!yy_OneUlOpen()) goto l804;  /* StartList */
+  {
+  {  int yypos805= yypos, yythunkpos805= yythunkpos;  if (!yymatchDot()) goto l804;  yypos= yypos805; yythunkpos= yythunkpos805;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  l806:;	
+  {  int yypos807= yypos, yythunkpos807= yythunkpos;
+  {  int yypos808= yypos, yythunkpos808= yythunkpos;  if (!yy_OneUlClose()) goto l808;  goto l807;
+  l808:;	  yypos= yypos808; yythunkpos= yythunkpos808;
+  }  if (!yy_Inline()) goto l807;  yyDo(yy_1_EmphUl, yybegin, yyend);  goto l806;
+  l807:;	  yypos= yypos807; yythunkpos= yythunkpos807;
+  }  if (!yy_OneUlClose()) goto l804;  yyDo(yy_2_EmphUl, yybegin, yyend);  yyDo(yy_3_EmphUl, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphUl", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l804:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphUl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_EmphStar()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "EmphStar"));  if (!yy_OneStarOpen()) goto l809;  /* StartList */
+  {
+  {  int yypos810= yypos, yythunkpos810= yythunkpos;  if (!yymatchDot()) goto l809;  yypos= yypos810; yythunkpos= yythunkpos810;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  l811:;	
+  {  int yypos812= yypos, yythunkpos812= yythunkpos;
+  {  int yypos813= yypos, yythunkpos813= yythunkpos;  if (!yy_OneStarClose()) goto l813;  goto l812;
+  l813:;	  yypos= yypos813; yythunkpos= yythunkpos813;
+  }  if (!yy_Inline()) goto l812;  yyDo(yy_1_EmphStar, yybegin, yyend);  goto l811;
+  l812:;	  yypos= yypos812; yythunkpos= yythunkpos812;
+  }  if (!yy_OneStarClose()) goto l809;  yyDo(yy_2_EmphStar, yybegin, yyend);  yyDo(yy_3_EmphStar, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphStar", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l809:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphStar", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_StarLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "StarLine"));
+  {  int yypos815= yypos, yythunkpos815= yythunkpos;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l816;  if (!yymatchString("****")) goto l816;
+  l817:;	
+  {  int yypos818= yypos, yythunkpos818= yythunkpos;  if (!yymatchChar('*')) goto l818;  goto l817;
+  l818:;	  yypos= yypos818; yythunkpos= yythunkpos818;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l816;  goto l815;
+  l816:;	  yypos= yypos815; yythunkpos= yythunkpos815;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l814;  /* Spacechar */
+  {
+  {  int yypos819= yypos, yythunkpos819= yythunkpos;  if (!yymatchChar(' ')) goto l820;  goto l819;
+  l820:;	  yypos= yypos819; yythunkpos= yythunkpos819;  if (!yymatchChar('\t')) goto l814;
+  }
+  l819:;	
+  }  if (!yymatchChar('*')) goto l814;
+  l821:;	
+  {  int yypos822= yypos, yythunkpos822= yythunkpos;  if (!yymatchChar('*')) goto l822;  goto l821;
+  l822:;	  yypos= yypos822; yythunkpos= yythunkpos822;
+  }
+  {  int yypos823= yypos, yythunkpos823= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos824= yypos, yythunkpos824= yythunkpos;  if (!yymatchChar(' ')) goto l825;  goto l824;
+  l825:;	  yypos= yypos824; yythunkpos= yythunkpos824;  if (!yymatchChar('\t')) goto l814;
+  }
+  l824:;	
+  }  yypos= yypos823; yythunkpos= yythunkpos823;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l814;
+  }
+  l815:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StarLine", yybuf+yypos));
+  return 1;
+  l814:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StarLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_UlLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "UlLine"));
+  {  int yypos827= yypos, yythunkpos827= yythunkpos;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l828;  if (!yymatchString("____")) goto l828;
+  l829:;	
+  {  int yypos830= yypos, yythunkpos830= yythunkpos;  if (!yymatchChar('_')) goto l830;  goto l829;
+  l830:;	  yypos= yypos830; yythunkpos= yythunkpos830;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l828;  goto l827;
+  l828:;	  yypos= yypos827; yythunkpos= yythunkpos827;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l826;  /* Spacechar */
+  {
+  {  int yypos831= yypos, yythunkpos831= yythunkpos;  if (!yymatchChar(' ')) goto l832;  goto l831;
+  l832:;	  yypos= yypos831; yythunkpos= yythunkpos831;  if (!yymatchChar('\t')) goto l826;
+  }
+  l831:;	
+  }  if (!yymatchChar('_')) goto l826;
+  l833:;	
+  {  int yypos834= yypos, yythunkpos834= yythunkpos;  if (!yymatchChar('_')) goto l834;  goto l833;
+  l834:;	  yypos= yypos834; yythunkpos= yythunkpos834;
+  }
+  {  int yypos835= yypos, yythunkpos835= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos836= yypos, yythunkpos836= yythunkpos;  if (!yymatchChar(' ')) goto l837;  goto l836;
+  l837:;	  yypos= yypos836; yythunkpos= yythunkpos836;  if (!yymatchChar('\t')) goto l826;
+  }
+  l836:;	
+  }  yypos= yypos835; yythunkpos= yythunkpos835;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l826;
+  }
+  l827:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "UlLine", yybuf+yypos));
+  return 1;
+  l826:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "UlLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SpecialChar()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "SpecialChar"));
+  {  int yypos839= yypos, yythunkpos839= yythunkpos;  if (!yymatchChar('*')) goto l840;  goto l839;
+  l840:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar('_')) goto l841;  goto l839;
+  l841:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar('`')) goto l842;  goto l839;
+  l842:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar('&')) goto l843;  goto l839;
+  l843:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar('[')) goto l844;  goto l839;
+  l844:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar(']')) goto l845;  goto l839;
+  l845:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar('(')) goto l846;  goto l839;
+  l846:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar(')')) goto l847;  goto l839;
+  l847:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar('<')) goto l848;  goto l839;
+  l848:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar('!')) goto l849;  goto l839;
+  l849:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar('#')) goto l850;  goto l839;
+  l850:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar('\\')) goto l851;  goto l839;
+  l851:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar('\'')) goto l852;  goto l839;
+  l852:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yymatchChar('"')) goto l853;  goto l839;
+  l853:;	  yypos= yypos839; yythunkpos= yythunkpos839;  if (!yy_ExtendedSpecialChar()) goto l838;
+  }
+  l839:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SpecialChar", yybuf+yypos));
+  return 1;
+  l838:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SpecialChar", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Eof()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Eof"));
+  {  int yypos855= yypos, yythunkpos855= yythunkpos;  if (!yymatchDot()) goto l855;  goto l854;
+  l855:;	  yypos= yypos855; yythunkpos= yythunkpos855;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Eof", yybuf+yypos));
+  return 1;
+  l854:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Eof", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_NormalEndline()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "NormalEndline"));  /* Sp */
+  {
+  l857:;	
+  {  int yypos858= yypos, yythunkpos858= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos859= yypos, yythunkpos859= yythunkpos;  if (!yymatchChar(' ')) goto l860;  goto l859;
+  l860:;	  yypos= yypos859; yythunkpos= yythunkpos859;  if (!yymatchChar('\t')) goto l858;
+  }
+  l859:;	
+  }  goto l857;
+  l858:;	  yypos= yypos858; yythunkpos= yythunkpos858;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l856;
+  }
+  {  int yypos861= yypos, yythunkpos861= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l862:;	
+  {  int yypos863= yypos, yythunkpos863= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos864= yypos, yythunkpos864= yythunkpos;  if (!yymatchChar(' ')) goto l865;  goto l864;
+  l865:;	  yypos= yypos864; yythunkpos= yythunkpos864;  if (!yymatchChar('\t')) goto l863;
+  }
+  l864:;	
+  }  goto l862;
+  l863:;	  yypos= yypos863; yythunkpos= yythunkpos863;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l861;
+  }
+  }  goto l856;
+  l861:;	  yypos= yypos861; yythunkpos= yythunkpos861;
+  }
+  {  int yypos866= yypos, yythunkpos866= yythunkpos;  if (!yymatchChar('>')) goto l866;  goto l856;
+  l866:;	  yypos= yypos866; yythunkpos= yythunkpos866;
+  }
+  {  int yypos867= yypos, yythunkpos867= yythunkpos;  if (!yy_AtxStart()) goto l867;  goto l856;
+  l867:;	  yypos= yypos867; yythunkpos= yythunkpos867;
+  }
+  {  int yypos868= yypos, yythunkpos868= yythunkpos;  /* Line */
+  {  if (!yy_RawLine()) goto l868;  yyDo(yy_1_Line, yybegin, yyend);
+  }
+  {  int yypos869= yypos, yythunkpos869= yythunkpos;  if (!yymatchString("===")) goto l870;
+  l871:;	
+  {  int yypos872= yypos, yythunkpos872= yythunkpos;  if (!yymatchChar('=')) goto l872;  goto l871;
+  l872:;	  yypos= yypos872; yythunkpos= yythunkpos872;
+  }  goto l869;
+  l870:;	  yypos= yypos869; yythunkpos= yythunkpos869;  if (!yymatchString("---")) goto l868;
+  l873:;	
+  {  int yypos874= yypos, yythunkpos874= yythunkpos;  if (!yymatchChar('-')) goto l874;  goto l873;
+  l874:;	  yypos= yypos874; yythunkpos= yythunkpos874;
+  }
+  }
+  l869:;	  /* Newline */
+  {  if (!yymatchChar('\n')) goto l868;
+  }  goto l856;
+  l868:;	  yypos= yypos868; yythunkpos= yythunkpos868;
+  }  yyDo(yy_1_NormalEndline, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "NormalEndline", yybuf+yypos));
+  return 1;
+  l856:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NormalEndline", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_TerminalEndline()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "TerminalEndline"));  /* Sp */
+  {
+  l876:;	
+  {  int yypos877= yypos, yythunkpos877= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos878= yypos, yythunkpos878= yythunkpos;  if (!yymatchChar(' ')) goto l879;  goto l878;
+  l879:;	  yypos= yypos878; yythunkpos= yythunkpos878;  if (!yymatchChar('\t')) goto l877;
+  }
+  l878:;	
+  }  goto l876;
+  l877:;	  yypos= yypos877; yythunkpos= yythunkpos877;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l875;
+  }  /* Eof */
+  {
+  {  int yypos880= yypos, yythunkpos880= yythunkpos;  if (!yymatchDot()) goto l880;  goto l875;
+  l880:;	  yypos= yypos880; yythunkpos= yythunkpos880;
+  }
+  }  yyDo(yy_1_TerminalEndline, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TerminalEndline", yybuf+yypos));
+  return 1;
+  l875:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TerminalEndline", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_LineBreak()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "LineBreak"));  if (!yymatchString("  ")) goto l881;  if (!yy_NormalEndline()) goto l881;  yyDo(yySet, -1, 0);  yyDo(yy_1_LineBreak, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LineBreak", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l881:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LineBreak", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_CharEntity()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "CharEntity"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l882;  if (!yymatchChar('&')) goto l882;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l882;
+  l883:;	
+  {  int yypos884= yypos, yythunkpos884= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l884;  goto l883;
+  l884:;	  yypos= yypos884; yythunkpos= yythunkpos884;
+  }  if (!yymatchChar(';')) goto l882;  yyText(yybegin, yyend);  if (!(YY_END)) goto l882;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CharEntity", yybuf+yypos));
+  return 1;
+  l882:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CharEntity", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_DecEntity()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "DecEntity"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l885;  if (!yymatchChar('&')) goto l885;  if (!yymatchChar('#')) goto l885;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l885;
+  l886:;	
+  {  int yypos887= yypos, yythunkpos887= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l887;  goto l886;
+  l887:;	  yypos= yypos887; yythunkpos= yythunkpos887;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l885;  if (!yymatchChar(';')) goto l885;  yyText(yybegin, yyend);  if (!(YY_END)) goto l885;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DecEntity", yybuf+yypos));
+  return 1;
+  l885:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DecEntity", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_HexEntity()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HexEntity"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l888;  if (!yymatchChar('&')) goto l888;  if (!yymatchChar('#')) goto l888;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l888;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l888;
+  l889:;	
+  {  int yypos890= yypos, yythunkpos890= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l890;  goto l889;
+  l890:;	  yypos= yypos890; yythunkpos= yythunkpos890;
+  }  if (!yymatchChar(';')) goto l888;  yyText(yybegin, yyend);  if (!(YY_END)) goto l888;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HexEntity", yybuf+yypos));
+  return 1;
+  l888:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HexEntity", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AposChunk()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "AposChunk"));  yyText(yybegin, yyend);  if (!( extension(EXT_SMART) )) goto l891;  if (!yymatchChar('\'')) goto l891;
+  {  int yypos892= yypos, yythunkpos892= yythunkpos;  /* Alphanumeric */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l891;
+  }  yypos= yypos892; yythunkpos= yythunkpos892;
+  }  yyDo(yy_1_AposChunk, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AposChunk", yybuf+yypos));
+  return 1;
+  l891:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AposChunk", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Alphanumeric()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Alphanumeric"));  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l893;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Alphanumeric", yybuf+yypos));
+  return 1;
+  l893:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Alphanumeric", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_StrChunk()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "StrChunk"));
+  {  int yypos895= yypos, yythunkpos895= yythunkpos;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l896;
+  {  int yypos899= yypos, yythunkpos899= yythunkpos;  if (!yy_NormalChar()) goto l900;  goto l899;
+  l900:;	  yypos= yypos899; yythunkpos= yythunkpos899;  if (!yymatchChar('_')) goto l896;
+  l901:;	
+  {  int yypos902= yypos, yythunkpos902= yythunkpos;  if (!yymatchChar('_')) goto l902;  goto l901;
+  l902:;	  yypos= yypos902; yythunkpos= yythunkpos902;
+  }
+  {  int yypos903= yypos, yythunkpos903= yythunkpos;  /* Alphanumeric */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l896;
+  }  yypos= yypos903; yythunkpos= yythunkpos903;
+  }
+  }
+  l899:;	
+  l897:;	
+  {  int yypos898= yypos, yythunkpos898= yythunkpos;
+  {  int yypos904= yypos, yythunkpos904= yythunkpos;  if (!yy_NormalChar()) goto l905;  goto l904;
+  l905:;	  yypos= yypos904; yythunkpos= yythunkpos904;  if (!yymatchChar('_')) goto l898;
+  l906:;	
+  {  int yypos907= yypos, yythunkpos907= yythunkpos;  if (!yymatchChar('_')) goto l907;  goto l906;
+  l907:;	  yypos= yypos907; yythunkpos= yythunkpos907;
+  }
+  {  int yypos908= yypos, yythunkpos908= yythunkpos;  /* Alphanumeric */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l898;
+  }  yypos= yypos908; yythunkpos= yythunkpos908;
+  }
+  }
+  l904:;	  goto l897;
+  l898:;	  yypos= yypos898; yythunkpos= yythunkpos898;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l896;  yyDo(yy_1_StrChunk, yybegin, yyend);  goto l895;
+  l896:;	  yypos= yypos895; yythunkpos= yythunkpos895;  if (!yy_AposChunk()) goto l894;
+  }
+  l895:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrChunk", yybuf+yypos));
+  return 1;
+  l894:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrChunk", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_NormalChar()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "NormalChar"));
+  {  int yypos910= yypos, yythunkpos910= yythunkpos;
+  {  int yypos911= yypos, yythunkpos911= yythunkpos;  if (!yy_SpecialChar()) goto l912;  goto l911;
+  l912:;	  yypos= yypos911; yythunkpos= yythunkpos911;  /* Spacechar */
+  {
+  {  int yypos914= yypos, yythunkpos914= yythunkpos;  if (!yymatchChar(' ')) goto l915;  goto l914;
+  l915:;	  yypos= yypos914; yythunkpos= yythunkpos914;  if (!yymatchChar('\t')) goto l913;
+  }
+  l914:;	
+  }  goto l911;
+  l913:;	  yypos= yypos911; yythunkpos= yythunkpos911;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l910;
+  }
+  }
+  l911:;	  goto l909;
+  l910:;	  yypos= yypos910; yythunkpos= yythunkpos910;
+  }  if (!yymatchDot()) goto l909;
+  yyprintf((stderr, "  ok   %s @ %s\n", "NormalChar", yybuf+yypos));
+  return 1;
+  l909:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NormalChar", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Symbol()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Symbol"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l916;  if (!yy_SpecialChar()) goto l916;  yyText(yybegin, yyend);  if (!(YY_END)) goto l916;  yyDo(yy_1_Symbol, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Symbol", yybuf+yypos));
+  return 1;
+  l916:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Symbol", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Smart()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Smart"));  yyText(yybegin, yyend);  if (!( extension(EXT_SMART) )) goto l917;
+  {  int yypos918= yypos, yythunkpos918= yythunkpos;  if (!yy_Ellipsis()) goto l919;  goto l918;
+  l919:;	  yypos= yypos918; yythunkpos= yythunkpos918;  /* Dash */
+  {
+  {  int yypos921= yypos, yythunkpos921= yythunkpos;  if (!yy_EmDash()) goto l922;  goto l921;
+  l922:;	  yypos= yypos921; yythunkpos= yythunkpos921;  if (!yy_EnDash()) goto l920;
+  }
+  l921:;	
+  }  goto l918;
+  l920:;	  yypos= yypos918; yythunkpos= yythunkpos918;  if (!yy_SingleQuoted()) goto l923;  goto l918;
+  l923:;	  yypos= yypos918; yythunkpos= yythunkpos918;  if (!yy_DoubleQuoted()) goto l924;  goto l918;
+  l924:;	  yypos= yypos918; yythunkpos= yythunkpos918;  /* Apostrophe */
+  {  if (!yymatchChar('\'')) goto l917;  yyDo(yy_1_Apostrophe, yybegin, yyend);
+  }
+  }
+  l918:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Smart", yybuf+yypos));
+  return 1;
+  l917:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Smart", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_EscapedChar()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "EscapedChar"));  if (!yymatchChar('\\')) goto l925;
+  {  int yypos926= yypos, yythunkpos926= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l926;
+  }  goto l925;
+  l926:;	  yypos= yypos926; yythunkpos= yythunkpos926;
+  }  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l925;  if (!yymatchClass((unsigned char *)"\000\000\000\000\012\157\000\120\000\000\000\270\001\000\000\070\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l925;  yyText(yybegin, yyend);  if (!(YY_END)) goto l925;  yyDo(yy_1_EscapedChar, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EscapedChar", yybuf+yypos));
+  return 1;
+  l925:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EscapedChar", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Entity()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Entity"));
+  {  int yypos928= yypos, yythunkpos928= yythunkpos;  if (!yy_HexEntity()) goto l929;  goto l928;
+  l929:;	  yypos= yypos928; yythunkpos= yythunkpos928;  if (!yy_DecEntity()) goto l930;  goto l928;
+  l930:;	  yypos= yypos928; yythunkpos= yythunkpos928;  if (!yy_CharEntity()) goto l927;
+  }
+  l928:;	  yyDo(yy_1_Entity, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Entity", yybuf+yypos));
+  return 1;
+  l927:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Entity", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_RawHtml()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "RawHtml"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l931;
+  {  int yypos932= yypos, yythunkpos932= yythunkpos;  if (!yy_HtmlComment()) goto l933;  goto l932;
+  l933:;	  yypos= yypos932; yythunkpos= yythunkpos932;  if (!yy_HtmlBlockScript()) goto l934;  goto l932;
+  l934:;	  yypos= yypos932; yythunkpos= yythunkpos932;  if (!yy_HtmlTag()) goto l931;
+  }
+  l932:;	  yyText(yybegin, yyend);  if (!(YY_END)) goto l931;  yyDo(yy_1_RawHtml, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawHtml", yybuf+yypos));
+  return 1;
+  l931:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawHtml", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Code()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Code"));
+  {  int yypos936= yypos, yythunkpos936= yythunkpos;  /* Ticks1 */
+  {  if (!yymatchChar('`')) goto l937;
+  {  int yypos938= yypos, yythunkpos938= yythunkpos;  if (!yymatchChar('`')) goto l938;  goto l937;
+  l938:;	  yypos= yypos938; yythunkpos= yythunkpos938;
+  }
+  }  /* Sp */
+  {
+  l939:;	
+  {  int yypos940= yypos, yythunkpos940= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos941= yypos, yythunkpos941= yythunkpos;  if (!yymatchChar(' ')) goto l942;  goto l941;
+  l942:;	  yypos= yypos941; yythunkpos= yythunkpos941;  if (!yymatchChar('\t')) goto l940;
+  }
+  l941:;	
+  }  goto l939;
+  l940:;	  yypos= yypos940; yythunkpos= yythunkpos940;
+  }
+  }  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l937;
+  {  int yypos945= yypos, yythunkpos945= yythunkpos;
+  {  int yypos949= yypos, yythunkpos949= yythunkpos;  if (!yymatchChar('`')) goto l949;  goto l946;
+  l949:;	  yypos= yypos949; yythunkpos= yythunkpos949;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l946;
+  }
+  l947:;	
+  {  int yypos948= yypos, yythunkpos948= yythunkpos;
+  {  int yypos950= yypos, yythunkpos950= yythunkpos;  if (!yymatchChar('`')) goto l950;  goto l948;
+  l950:;	  yypos= yypos950; yythunkpos= yythunkpos950;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l948;
+  }  goto l947;
+  l948:;	  yypos= yypos948; yythunkpos= yythunkpos948;
+  }  goto l945;
+  l946:;	  yypos= yypos945; yythunkpos= yythunkpos945;
+  {  int yypos952= yypos, yythunkpos952= yythunkpos;  /* Ticks1 */
+  {  if (!yymatchChar('`')) goto l952;
+  {  int yypos953= yypos, yythunkpos953= yythunkpos;  if (!yymatchChar('`')) goto l953;  goto l952;
+  l953:;	  yypos= yypos953; yythunkpos= yythunkpos953;
+  }
+  }  goto l951;
+  l952:;	  yypos= yypos952; yythunkpos= yythunkpos952;
+  }  if (!yymatchChar('`')) goto l951;
+  l954:;	
+  {  int yypos955= yypos, yythunkpos955= yythunkpos;  if (!yymatchChar('`')) goto l955;  goto l954;
+  l955:;	  yypos= yypos955; yythunkpos= yythunkpos955;
+  }  goto l945;
+  l951:;	  yypos= yypos945; yythunkpos= yythunkpos945;
+  {  int yypos956= yypos, yythunkpos956= yythunkpos;  /* Sp */
+  {
+  l957:;	
+  {  int yypos958= yypos, yythunkpos958= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos959= yypos, yythunkpos959= yythunkpos;  if (!yymatchChar(' ')) goto l960;  goto l959;
+  l960:;	  yypos= yypos959; yythunkpos= yythunkpos959;  if (!yymatchChar('\t')) goto l958;
+  }
+  l959:;	
+  }  goto l957;
+  l958:;	  yypos= yypos958; yythunkpos= yythunkpos958;
+  }
+  }  /* Ticks1 */
+  {  if (!yymatchChar('`')) goto l956;
+  {  int yypos961= yypos, yythunkpos961= yythunkpos;  if (!yymatchChar('`')) goto l961;  goto l956;
+  l961:;	  yypos= yypos961; yythunkpos= yythunkpos961;
+  }
+  }  goto l937;
+  l956:;	  yypos= yypos956; yythunkpos= yythunkpos956;
+  }
+  {  int yypos962= yypos, yythunkpos962= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos964= yypos, yythunkpos964= yythunkpos;  if (!yymatchChar(' ')) goto l965;  goto l964;
+  l965:;	  yypos= yypos964; yythunkpos= yythunkpos964;  if (!yymatchChar('\t')) goto l963;
+  }
+  l964:;	
+  }  goto l962;
+  l963:;	  yypos= yypos962; yythunkpos= yythunkpos962;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l937;
+  }
+  {  int yypos966= yypos, yythunkpos966= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l967:;	
+  {  int yypos968= yypos, yythunkpos968= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos969= yypos, yythunkpos969= yythunkpos;  if (!yymatchChar(' ')) goto l970;  goto l969;
+  l970:;	  yypos= yypos969; yythunkpos= yythunkpos969;  if (!yymatchChar('\t')) goto l968;
+  }
+  l969:;	
+  }  goto l967;
+  l968:;	  yypos= yypos968; yythunkpos= yythunkpos968;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l966;
+  }
+  }  goto l937;
+  l966:;	  yypos= yypos966; yythunkpos= yythunkpos966;
+  }
+  }
+  l962:;	
+  }
+  l945:;	
+  l943:;	
+  {  int yypos944= yypos, yythunkpos944= yythunkpos;
+  {  int yypos971= yypos, yythunkpos971= yythunkpos;
+  {  int yypos975= yypos, yythunkpos975= yythunkpos;  if (!yymatchChar('`')) goto l975;  goto l972;
+  l975:;	  yypos= yypos975; yythunkpos= yythunkpos975;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l972;
+  }
+  l973:;	
+  {  int yypos974= yypos, yythunkpos974= yythunkpos;
+  {  int yypos976= yypos, yythunkpos976= yythunkpos;  if (!yymatchChar('`')) goto l976;  goto l974;
+  l976:;	  yypos= yypos976; yythunkpos= yythunkpos976;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l974;
+  }  goto l973;
+  l974:;	  yypos= yypos974; yythunkpos= yythunkpos974;
+  }  goto l971;
+  l972:;	  yypos= yypos971; yythunkpos= yythunkpos971;
+  {  int yypos978= yypos, yythunkpos978= yythunkpos;  /* Ticks1 */
+  {  if (!yymatchChar('`')) goto l978;
+  {  int yypos979= yypos, yythunkpos979= yythunkpos;  if (!yymatchChar('`')) goto l979;  goto l978;
+  l979:;	  yypos= yypos979; yythunkpos= yythunkpos979;
+  }
+  }  goto l977;
+  l978:;	  yypos= yypos978; yythunkpos= yythunkpos978;
+  }  if (!yymatchChar('`')) goto l977;
+  l980:;	
+  {  int yypos981= yypos, yythunkpos981= yythunkpos;  if (!yymatchChar('`')) goto l981;  goto l980;
+  l981:;	  yypos= yypos981; yythunkpos= yythunkpos981;
+  }  goto l971;
+  l977:;	  yypos= yypos971; yythunkpos= yythunkpos971;
+  {  int yypos982= yypos, yythunkpos982= yythunkpos;  /* Sp */
+  {
+  l983:;	
+  {  int yypos984= yypos, yythunkpos984= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos985= yypos, yythunkpos985= yythunkpos;  if (!yymatchChar(' ')) goto l986;  goto l985;
+  l986:;	  yypos= yypos985; yythunkpos= yythunkpos985;  if (!yymatchChar('\t')) goto l984;
+  }
+  l985:;	
+  }  goto l983;
+  l984:;	  yypos= yypos984; yythunkpos= yythunkpos984;
+  }
+  }  /* Ticks1 */
+  {  if (!yymatchChar('`')) goto l982;
+  {  int yypos987= yypos, yythunkpos987= yythunkpos;  if (!yymatchChar('`')) goto l987;  goto l982;
+  l987:;	  yypos= yypos987; yythunkpos= yythunkpos987;
+  }
+  }  goto l944;
+  l982:;	  yypos= yypos982; yythunkpos= yythunkpos982;
+  }
+  {  int yypos988= yypos, yythunkpos988= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos990= yypos, yythunkpos990= yythunkpos;  if (!yymatchChar(' ')) goto l991;  goto l990;
+  l991:;	  yypos= yypos990; yythunkpos= yythunkpos990;  if (!yymatchChar('\t')) goto l989;
+  }
+  l990:;	
+  }  goto l988;
+  l989:;	  yypos= yypos988; yythunkpos= yythunkpos988;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l944;
+  }
+  {  int yypos992= yypos, yythunkpos992= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l993:;	
+  {  int yypos994= yypos, yythunkpos994= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos995= yypos, yythunkpos995= yythunkpos;  if (!yymatchChar(' ')) goto l996;  goto l995;
+  l996:;	  yypos= yypos995; yythunkpos= yythunkpos995;  if (!yymatchChar('\t')) goto l994;
+  }
+  l995:;	
+  }  goto l993;
+  l994:;	  yypos= yypos994; yythunkpos= yythunkpos994;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l992;
+  }
+  }  goto l944;
+  l992:;	  yypos= yypos992; yythunkpos= yythunkpos992;
+  }
+  }
+  l988:;	
+  }
+  l971:;	  goto l943;
+  l944:;	  yypos= yypos944; yythunkpos= yythunkpos944;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l937;  /* Sp */
+  {
+  l997:;	
+  {  int yypos998= yypos, yythunkpos998= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos999= yypos, yythunkpos999= yythunkpos;  if (!yymatchChar(' ')) goto l1000;  goto l999;
+  l1000:;	  yypos= yypos999; yythunkpos= yythunkpos999;  if (!yymatchChar('\t')) goto l998;
+  }
+  l999:;	
+  }  goto l997;
+  l998:;	  yypos= yypos998; yythunkpos= yythunkpos998;
+  }
+  }  /* Ticks1 */
+  {  if (!yymatchChar('`')) goto l937;
+  {  int yypos1001= yypos, yythunkpos1001= yythunkpos;  if (!yymatchChar('`')) goto l1001;  goto l937;
+  l1001:;	  yypos= yypos1001; yythunkpos= yythunkpos1001;
+  }
+  }  goto l936;
+  l937:;	  yypos= yypos936; yythunkpos= yythunkpos936;  /* Ticks2 */
+  {  if (!yymatchString("``")) goto l1002;
+  {  int yypos1003= yypos, yythunkpos1003= yythunkpos;  if (!yymatchChar('`')) goto l1003;  goto l1002;
+  l1003:;	  yypos= yypos1003; yythunkpos= yythunkpos1003;
+  }
+  }  /* Sp */
+  {
+  l1004:;	
+  {  int yypos1005= yypos, yythunkpos1005= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1006= yypos, yythunkpos1006= yythunkpos;  if (!yymatchChar(' ')) goto l1007;  goto l1006;
+  l1007:;	  yypos= yypos1006; yythunkpos= yythunkpos1006;  if (!yymatchChar('\t')) goto l1005;
+  }
+  l1006:;	
+  }  goto l1004;
+  l1005:;	  yypos= yypos1005; yythunkpos= yythunkpos1005;
+  }
+  }  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l1002;
+  {  int yypos1010= yypos, yythunkpos1010= yythunkpos;
+  {  int yypos1014= yypos, yythunkpos1014= yythunkpos;  if (!yymatchChar('`')) goto l1014;  goto l1011;
+  l1014:;	  yypos= yypos1014; yythunkpos= yythunkpos1014;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1011;
+  }
+  l1012:;	
+  {  int yypos1013= yypos, yythunkpos1013= yythunkpos;
+  {  int yypos1015= yypos, yythunkpos1015= yythunkpos;  if (!yymatchChar('`')) goto l1015;  goto l1013;
+  l1015:;	  yypos= yypos1015; yythunkpos= yythunkpos1015;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1013;
+  }  goto l1012;
+  l1013:;	  yypos= yypos1013; yythunkpos= yythunkpos1013;
+  }  goto l1010;
+  l1011:;	  yypos= yypos1010; yythunkpos= yythunkpos1010;
+  {  int yypos1017= yypos, yythunkpos1017= yythunkpos;  /* Ticks2 */
+  {  if (!yymatchString("``")) goto l1017;
+  {  int yypos1018= yypos, yythunkpos1018= yythunkpos;  if (!yymatchChar('`')) goto l1018;  goto l1017;
+  l1018:;	  yypos= yypos1018; yythunkpos= yythunkpos1018;
+  }
+  }  goto l1016;
+  l1017:;	  yypos= yypos1017; yythunkpos= yythunkpos1017;
+  }  if (!yymatchChar('`')) goto l1016;
+  l1019:;	
+  {  int yypos1020= yypos, yythunkpos1020= yythunkpos;  if (!yymatchChar('`')) goto l1020;  goto l1019;
+  l1020:;	  yypos= yypos1020; yythunkpos= yythunkpos1020;
+  }  goto l1010;
+  l1016:;	  yypos= yypos1010; yythunkpos= yythunkpos1010;
+  {  int yypos1021= yypos, yythunkpos1021= yythunkpos;  /* Sp */
+  {
+  l1022:;	
+  {  int yypos1023= yypos, yythunkpos1023= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1024= yypos, yythunkpos1024= yythunkpos;  if (!yymatchChar(' ')) goto l1025;  goto l1024;
+  l1025:;	  yypos= yypos1024; yythunkpos= yythunkpos1024;  if (!yymatchChar('\t')) goto l1023;
+  }
+  l1024:;	
+  }  goto l1022;
+  l1023:;	  yypos= yypos1023; yythunkpos= yythunkpos1023;
+  }
+  }  /* Ticks2 */
+  {  if (!yymatchString("``")) goto l1021;
+  {  int yypos1026= yypos, yythunkpos1026= yythunkpos;  if (!yymatchChar('`')) goto l1026;  goto l1021;
+  l1026:;	  yypos= yypos1026; yythunkpos= yythunkpos1026;
+  }
+  }  goto l1002;
+  l1021:;	  yypos= yypos1021; yythunkpos= yythunkpos1021;
+  }
+  {  int yypos1027= yypos, yythunkpos1027= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1029= yypos, yythunkpos1029= yythunkpos;  if (!yymatchChar(' ')) goto l1030;  goto l1029;
+  l1030:;	  yypos= yypos1029; yythunkpos= yythunkpos1029;  if (!yymatchChar('\t')) goto l1028;
+  }
+  l1029:;	
+  }  goto l1027;
+  l1028:;	  yypos= yypos1027; yythunkpos= yythunkpos1027;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1002;
+  }
+  {  int yypos1031= yypos, yythunkpos1031= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l1032:;	
+  {  int yypos1033= yypos, yythunkpos1033= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1034= yypos, yythunkpos1034= yythunkpos;  if (!yymatchChar(' ')) goto l1035;  goto l1034;
+  l1035:;	  yypos= yypos1034; yythunkpos= yythunkpos1034;  if (!yymatchChar('\t')) goto l1033;
+  }
+  l1034:;	
+  }  goto l1032;
+  l1033:;	  yypos= yypos1033; yythunkpos= yythunkpos1033;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1031;
+  }
+  }  goto l1002;
+  l1031:;	  yypos= yypos1031; yythunkpos= yythunkpos1031;
+  }
+  }
+  l1027:;	
+  }
+  l1010:;	
+  l1008:;	
+  {  int yypos1009= yypos, yythunkpos1009= yythunkpos;
+  {  int yypos1036= yypos, yythunkpos1036= yythunkpos;
+  {  int yypos1040= yypos, yythunkpos1040= yythunkpos;  if (!yymatchChar('`')) goto l1040;  goto l1037;
+  l1040:;	  yypos= yypos1040; yythunkpos= yythunkpos1040;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1037;
+  }
+  l1038:;	
+  {  int yypos1039= yypos, yythunkpos1039= yythunkpos;
+  {  int yypos1041= yypos, yythunkpos1041= yythunkpos;  if (!yymatchChar('`')) goto l1041;  goto l1039;
+  l1041:;	  yypos= yypos1041; yythunkpos= yythunkpos1041;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1039;
+  }  goto l1038;
+  l1039:;	  yypos= yypos1039; yythunkpos= yythunkpos1039;
+  }  goto l1036;
+  l1037:;	  yypos= yypos1036; yythunkpos= yythunkpos1036;
+  {  int yypos1043= yypos, yythunkpos1043= yythunkpos;  /* Ticks2 */
+  {  if (!yymatchString("``")) goto l1043;
+  {  int yypos1044= yypos, yythunkpos1044= yythunkpos;  if (!yymatchChar('`')) goto l1044;  goto l1043;
+  l1044:;	  yypos= yypos1044; yythunkpos= yythunkpos1044;
+  }
+  }  goto l1042;
+  l1043:;	  yypos= yypos1043; yythunkpos= yythunkpos1043;
+  }  if (!yymatchChar('`')) goto l1042;
+  l1045:;	
+  {  int yypos1046= yypos, yythunkpos1046= yythunkpos;  if (!yymatchChar('`')) goto l1046;  goto l1045;
+  l1046:;	  yypos= yypos1046; yythunkpos= yythunkpos1046;
+  }  goto l1036;
+  l1042:;	  yypos= yypos1036; yythunkpos= yythunkpos1036;
+  {  int yypos1047= yypos, yythunkpos1047= yythunkpos;  /* Sp */
+  {
+  l1048:;	
+  {  int yypos1049= yypos, yythunkpos1049= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1050= yypos, yythunkpos1050= yythunkpos;  if (!yymatchChar(' ')) goto l1051;  goto l1050;
+  l1051:;	  yypos= yypos1050; yythunkpos= yythunkpos1050;  if (!yymatchChar('\t')) goto l1049;
+  }
+  l1050:;	
+  }  goto l1048;
+  l1049:;	  yypos= yypos1049; yythunkpos= yythunkpos1049;
+  }
+  }  /* Ticks2 */
+  {  if (!yymatchString("``")) goto l1047;
+  {  int yypos1052= yypos, yythunkpos1052= yythunkpos;  if (!yymatchChar('`')) goto l1052;  goto l1047;
+  l1052:;	  yypos= yypos1052; yythunkpos= yythunkpos1052;
+  }
+  }  goto l1009;
+  l1047:;	  yypos= yypos1047; yythunkpos= yythunkpos1047;
+  }
+  {  int yypos1053= yypos, yythunkpos1053= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1055= yypos, yythunkpos1055= yythunkpos;  if (!yymatchChar(' ')) goto l1056;  goto l1055;
+  l1056:;	  yypos= yypos1055; yythunkpos= yythunkpos1055;  if (!yymatchChar('\t')) goto l1054;
+  }
+  l1055:;	
+  }  goto l1053;
+  l1054:;	  yypos= yypos1053; yythunkpos= yythunkpos1053;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1009;
+  }
+  {  int yypos1057= yypos, yythunkpos1057= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l1058:;	
+  {  int yypos1059= yypos, yythunkpos1059= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1060= yypos, yythunkpos1060= yythunkpos;  if (!yymatchChar(' ')) goto l1061;  goto l1060;
+  l1061:;	  yypos= yypos1060; yythunkpos= yythunkpos1060;  if (!yymatchChar('\t')) goto l1059;
+  }
+  l1060:;	
+  }  goto l1058;
+  l1059:;	  yypos= yypos1059; yythunkpos= yythunkpos1059;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1057;
+  }
+  }  goto l1009;
+  l1057:;	  yypos= yypos1057; yythunkpos= yythunkpos1057;
+  }
+  }
+  l1053:;	
+  }
+  l1036:;	  goto l1008;
+  l1009:;	  yypos= yypos1009; yythunkpos= yythunkpos1009;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l1002;  /* Sp */
+  {
+  l1062:;	
+  {  int yypos1063= yypos, yythunkpos1063= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1064= yypos, yythunkpos1064= yythunkpos;  if (!yymatchChar(' ')) goto l1065;  goto l1064;
+  l1065:;	  yypos= yypos1064; yythunkpos= yythunkpos1064;  if (!yymatchChar('\t')) goto l1063;
+  }
+  l1064:;	
+  }  goto l1062;
+  l1063:;	  yypos= yypos1063; yythunkpos= yythunkpos1063;
+  }
+  }  /* Ticks2 */
+  {  if (!yymatchString("``")) goto l1002;
+  {  int yypos1066= yypos, yythunkpos1066= yythunkpos;  if (!yymatchChar('`')) goto l1066;  goto l1002;
+  l1066:;	  yypos= yypos1066; yythunkpos= yythunkpos1066;
+  }
+  }  goto l936;
+  l1002:;	  yypos= yypos936; yythunkpos= yythunkpos936;  /* Ticks3 */
+  {  if (!yymatchString("```")) goto l1067;
+  {  int yypos1068= yypos, yythunkpos1068= yythunkpos;  if (!yymatchChar('`')) goto l1068;  goto l1067;
+  l1068:;	  yypos= yypos1068; yythunkpos= yythunkpos1068;
+  }
+  }  /* Sp */
+  {
+  l1069:;	
+  {  int yypos1070= yypos, yythunkpos1070= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1071= yypos, yythunkpos1071= yythunkpos;  if (!yymatchChar(' ')) goto l1072;  goto l1071;
+  l1072:;	  yypos= yypos1071; yythunkpos= yythunkpos1071;  if (!yymatchChar('\t')) goto l1070;
+  }
+  l1071:;	
+  }  goto l1069;
+  l1070:;	  yypos= yypos1070; yythunkpos= yythunkpos1070;
+  }
+  }  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l1067;
+  {  int yypos1075= yypos, yythunkpos1075= yythunkpos;
+  {  int yypos1079= yypos, yythunkpos1079= yythunkpos;  if (!yymatchChar('`')) goto l1079;  goto l1076;
+  l1079:;	  yypos= yypos1079; yythunkpos= yythunkpos1079;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1076;
+  }
+  l1077:;	
+  {  int yypos1078= yypos, yythunkpos1078= yythunkpos;
+  {  int yypos1080= yypos, yythunkpos1080= yythunkpos;  if (!yymatchChar('`')) goto l1080;  goto l1078;
+  l1080:;	  yypos= yypos1080; yythunkpos= yythunkpos1080;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1078;
+  }  goto l1077;
+  l1078:;	  yypos= yypos1078; yythunkpos= yythunkpos1078;
+  }  goto l1075;
+  l1076:;	  yypos= yypos1075; yythunkpos= yythunkpos1075;
+  {  int yypos1082= yypos, yythunkpos1082= yythunkpos;  /* Ticks3 */
+  {  if (!yymatchString("```")) goto l1082;
+  {  int yypos1083= yypos, yythunkpos1083= yythunkpos;  if (!yymatchChar('`')) goto l1083;  goto l1082;
+  l1083:;	  yypos= yypos1083; yythunkpos= yythunkpos1083;
+  }
+  }  goto l1081;
+  l1082:;	  yypos= yypos1082; yythunkpos= yythunkpos1082;
+  }  if (!yymatchChar('`')) goto l1081;
+  l1084:;	
+  {  int yypos1085= yypos, yythunkpos1085= yythunkpos;  if (!yymatchChar('`')) goto l1085;  goto l1084;
+  l1085:;	  yypos= yypos1085; yythunkpos= yythunkpos1085;
+  }  goto l1075;
+  l1081:;	  yypos= yypos1075; yythunkpos= yythunkpos1075;
+  {  int yypos1086= yypos, yythunkpos1086= yythunkpos;  /* Sp */
+  {
+  l1087:;	
+  {  int yypos1088= yypos, yythunkpos1088= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1089= yypos, yythunkpos1089= yythunkpos;  if (!yymatchChar(' ')) goto l1090;  goto l1089;
+  l1090:;	  yypos= yypos1089; yythunkpos= yythunkpos1089;  if (!yymatchChar('\t')) goto l1088;
+  }
+  l1089:;	
+  }  goto l1087;
+  l1088:;	  yypos= yypos1088; yythunkpos= yythunkpos1088;
+  }
+  }  /* Ticks3 */
+  {  if (!yymatchString("```")) goto l1086;
+  {  int yypos1091= yypos, yythunkpos1091= yythunkpos;  if (!yymatchChar('`')) goto l1091;  goto l1086;
+  l1091:;	  yypos= yypos1091; yythunkpos= yythunkpos1091;
+  }
+  }  goto l1067;
+  l1086:;	  yypos= yypos1086; yythunkpos= yythunkpos1086;
+  }
+  {  int yypos1092= yypos, yythunkpos1092= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1094= yypos, yythunkpos1094= yythunkpos;  if (!yymatchChar(' ')) goto l1095;  goto l1094;
+  l1095:;	  yypos= yypos1094; yythunkpos= yythunkpos1094;  if (!yymatchChar('\t')) goto l1093;
+  }
+  l1094:;	
+  }  goto l1092;
+  l1093:;	  yypos= yypos1092; yythunkpos= yythunkpos1092;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1067;
+  }
+  {  int yypos1096= yypos, yythunkpos1096= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l1097:;	
+  {  int yypos1098= yypos, yythunkpos1098= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1099= yypos, yythunkpos1099= yythunkpos;  if (!yymatchChar(' ')) goto l1100;  goto l1099;
+  l1100:;	  yypos= yypos1099; yythunkpos= yythunkpos1099;  if (!yymatchChar('\t')) goto l1098;
+  }
+  l1099:;	
+  }  goto l1097;
+  l1098:;	  yypos= yypos1098; yythunkpos= yythunkpos1098;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1096;
+  }
+  }  goto l1067;
+  l1096:;	  yypos= yypos1096; yythunkpos= yythunkpos1096;
+  }
+  }
+  l1092:;	
+  }
+  l1075:;	
+  l1073:;	
+  {  int yypos1074= yypos, yythunkpos1074= yythunkpos;
+  {  int yypos1101= yypos, yythunkpos1101= yythunkpos;
+  {  int yypos1105= yypos, yythunkpos1105= yythunkpos;  if (!yymatchChar('`')) goto l1105;  goto l1102;
+  l1105:;	  yypos= yypos1105; yythunkpos= yythunkpos1105;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1102;
+  }
+  l1103:;	
+  {  int yypos1104= yypos, yythunkpos1104= yythunkpos;
+  {  int yypos1106= yypos, yythunkpos1106= yythunkpos;  if (!yymatchChar('`')) goto l1106;  goto l1104;
+  l1106:;	  yypos= yypos1106; yythunkpos= yythunkpos1106;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1104;
+  }  goto l1103;
+  l1104:;	  yypos= yypos1104; yythunkpos= yythunkpos1104;
+  }  goto l1101;
+  l1102:;	  yypos= yypos1101; yythunkpos= yythunkpos1101;
+  {  int yypos1108= yypos, yythunkpos1108= yythunkpos;  /* Ticks3 */
+  {  if (!yymatchString("```")) goto l1108;
+  {  int yypos1109= yypos, yythunkpos1109= yythunkpos;  if (!yymatchChar('`')) goto l1109;  goto l1108;
+  l1109:;	  yypos= yypos1109; yythunkpos= yythunkpos1109;
+  }
+  }  goto l1107;
+  l1108:;	  yypos= yypos1108; yythunkpos= yythunkpos1108;
+  }  if (!yymatchChar('`')) goto l1107;
+  l1110:;	
+  {  int yypos1111= yypos, yythunkpos1111= yythunkpos;  if (!yymatchChar('`')) goto l1111;  goto l1110;
+  l1111:;	  yypos= yypos1111; yythunkpos= yythunkpos1111;
+  }  goto l1101;
+  l1107:;	  yypos= yypos1101; yythunkpos= yythunkpos1101;
+  {  int yypos1112= yypos, yythunkpos1112= yythunkpos;  /* Sp */
+  {
+  l1113:;	
+  {  int yypos1114= yypos, yythunkpos1114= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1115= yypos, yythunkpos1115= yythunkpos;  if (!yymatchChar(' ')) goto l1116;  goto l1115;
+  l1116:;	  yypos= yypos1115; yythunkpos= yythunkpos1115;  if (!yymatchChar('\t')) goto l1114;
+  }
+  l1115:;	
+  }  goto l1113;
+  l1114:;	  yypos= yypos1114; yythunkpos= yythunkpos1114;
+  }
+  }  /* Ticks3 */
+  {  if (!yymatchString("```")) goto l1112;
+  {  int yypos1117= yypos, yythunkpos1117= yythunkpos;  if (!yymatchChar('`')) goto l1117;  goto l1112;
+  l1117:;	  yypos= yypos1117; yythunkpos= yythunkpos1117;
+  }
+  }  goto l1074;
+  l1112:;	  yypos= yypos1112; yythunkpos= yythunkpos1112;
+  }
+  {  int yypos1118= yypos, yythunkpos1118= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1120= yypos, yythunkpos1120= yythunkpos;  if (!yymatchChar(' ')) goto l1121;  goto l1120;
+  l1121:;	  yypos= yypos1120; yythunkpos= yythunkpos1120;  if (!yymatchChar('\t')) goto l1119;
+  }
+  l1120:;	
+  }  goto l1118;
+  l1119:;	  yypos= yypos1118; yythunkpos= yythunkpos1118;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1074;
+  }
+  {  int yypos1122= yypos, yythunkpos1122= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l1123:;	
+  {  int yypos1124= yypos, yythunkpos1124= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1125= yypos, yythunkpos1125= yythunkpos;  if (!yymatchChar(' ')) goto l1126;  goto l1125;
+  l1126:;	  yypos= yypos1125; yythunkpos= yythunkpos1125;  if (!yymatchChar('\t')) goto l1124;
+  }
+  l1125:;	
+  }  goto l1123;
+  l1124:;	  yypos= yypos1124; yythunkpos= yythunkpos1124;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1122;
+  }
+  }  goto l1074;
+  l1122:;	  yypos= yypos1122; yythunkpos= yythunkpos1122;
+  }
+  }
+  l1118:;	
+  }
+  l1101:;	  goto l1073;
+  l1074:;	  yypos= yypos1074; yythunkpos= yythunkpos1074;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l1067;  /* Sp */
+  {
+  l1127:;	
+  {  int yypos1128= yypos, yythunkpos1128= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1129= yypos, yythunkpos1129= yythunkpos;  if (!yymatchChar(' ')) goto l1130;  goto l1129;
+  l1130:;	  yypos= yypos1129; yythunkpos= yythunkpos1129;  if (!yymatchChar('\t')) goto l1128;
+  }
+  l1129:;	
+  }  goto l1127;
+  l1128:;	  yypos= yypos1128; yythunkpos= yythunkpos1128;
+  }
+  }  /* Ticks3 */
+  {  if (!yymatchString("```")) goto l1067;
+  {  int yypos1131= yypos, yythunkpos1131= yythunkpos;  if (!yymatchChar('`')) goto l1131;  goto l1067;
+  l1131:;	  yypos= yypos1131; yythunkpos= yythunkpos1131;
+  }
+  }  goto l936;
+  l1067:;	  yypos= yypos936; yythunkpos= yythunkpos936;  /* Ticks4 */
+  {  if (!yymatchString("````")) goto l1132;
+  {  int yypos1133= yypos, yythunkpos1133= yythunkpos;  if (!yymatchChar('`')) goto l1133;  goto l1132;
+  l1133:;	  yypos= yypos1133; yythunkpos= yythunkpos1133;
+  }
+  }  /* Sp */
+  {
+  l1134:;	
+  {  int yypos1135= yypos, yythunkpos1135= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1136= yypos, yythunkpos1136= yythunkpos;  if (!yymatchChar(' ')) goto l1137;  goto l1136;
+  l1137:;	  yypos= yypos1136; yythunkpos= yythunkpos1136;  if (!yymatchChar('\t')) goto l1135;
+  }
+  l1136:;	
+  }  goto l1134;
+  l1135:;	  yypos= yypos1135; yythunkpos= yythunkpos1135;
+  }
+  }  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l1132;
+  {  int yypos1140= yypos, yythunkpos1140= yythunkpos;
+  {  int yypos1144= yypos, yythunkpos1144= yythunkpos;  if (!yymatchChar('`')) goto l1144;  goto l1141;
+  l1144:;	  yypos= yypos1144; yythunkpos= yythunkpos1144;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1141;
+  }
+  l1142:;	
+  {  int yypos1143= yypos, yythunkpos1143= yythunkpos;
+  {  int yypos1145= yypos, yythunkpos1145= yythunkpos;  if (!yymatchChar('`')) goto l1145;  goto l1143;
+  l1145:;	  yypos= yypos1145; yythunkpos= yythunkpos1145;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1143;
+  }  goto l1142;
+  l1143:;	  yypos= yypos1143; yythunkpos= yythunkpos1143;
+  }  goto l1140;
+  l1141:;	  yypos= yypos1140; yythunkpos= yythunkpos1140;
+  {  int yypos1147= yypos, yythunkpos1147= yythunkpos;  /* Ticks4 */
+  {  if (!yymatchString("````")) goto l1147;
+  {  int yypos1148= yypos, yythunkpos1148= yythunkpos;  if (!yymatchChar('`')) goto l1148;  goto l1147;
+  l1148:;	  yypos= yypos1148; yythunkpos= yythunkpos1148;
+  }
+  }  goto l1146;
+  l1147:;	  yypos= yypos1147; yythunkpos= yythunkpos1147;
+  }  if (!yymatchChar('`')) goto l1146;
+  l1149:;	
+  {  int yypos1150= yypos, yythunkpos1150= yythunkpos;  if (!yymatchChar('`')) goto l1150;  goto l1149;
+  l1150:;	  yypos= yypos1150; yythunkpos= yythunkpos1150;
+  }  goto l1140;
+  l1146:;	  yypos= yypos1140; yythunkpos= yythunkpos1140;
+  {  int yypos1151= yypos, yythunkpos1151= yythunkpos;  /* Sp */
+  {
+  l1152:;	
+  {  int yypos1153= yypos, yythunkpos1153= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1154= yypos, yythunkpos1154= yythunkpos;  if (!yymatchChar(' ')) goto l1155;  goto l1154;
+  l1155:;	  yypos= yypos1154; yythunkpos= yythunkpos1154;  if (!yymatchChar('\t')) goto l1153;
+  }
+  l1154:;	
+  }  goto l1152;
+  l1153:;	  yypos= yypos1153; yythunkpos= yythunkpos1153;
+  }
+  }  /* Ticks4 */
+  {  if (!yymatchString("````")) goto l1151;
+  {  int yypos1156= yypos, yythunkpos1156= yythunkpos;  if (!yymatchChar('`')) goto l1156;  goto l1151;
+  l1156:;	  yypos= yypos1156; yythunkpos= yythunkpos1156;
+  }
+  }  goto l1132;
+  l1151:;	  yypos= yypos1151; yythunkpos= yythunkpos1151;
+  }
+  {  int yypos1157= yypos, yythunkpos1157= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1159= yypos, yythunkpos1159= yythunkpos;  if (!yymatchChar(' ')) goto l1160;  goto l1159;
+  l1160:;	  yypos= yypos1159; yythunkpos= yythunkpos1159;  if (!yymatchChar('\t')) goto l1158;
+  }
+  l1159:;	
+  }  goto l1157;
+  l1158:;	  yypos= yypos1157; yythunkpos= yythunkpos1157;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1132;
+  }
+  {  int yypos1161= yypos, yythunkpos1161= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l1162:;	
+  {  int yypos1163= yypos, yythunkpos1163= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1164= yypos, yythunkpos1164= yythunkpos;  if (!yymatchChar(' ')) goto l1165;  goto l1164;
+  l1165:;	  yypos= yypos1164; yythunkpos= yythunkpos1164;  if (!yymatchChar('\t')) goto l1163;
+  }
+  l1164:;	
+  }  goto l1162;
+  l1163:;	  yypos= yypos1163; yythunkpos= yythunkpos1163;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1161;
+  }
+  }  goto l1132;
+  l1161:;	  yypos= yypos1161; yythunkpos= yythunkpos1161;
+  }
+  }
+  l1157:;	
+  }
+  l1140:;	
+  l1138:;	
+  {  int yypos1139= yypos, yythunkpos1139= yythunkpos;
+  {  int yypos1166= yypos, yythunkpos1166= yythunkpos;
+  {  int yypos1170= yypos, yythunkpos1170= yythunkpos;  if (!yymatchChar('`')) goto l1170;  goto l1167;
+  l1170:;	  yypos= yypos1170; yythunkpos= yythunkpos1170;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1167;
+  }
+  l1168:;	
+  {  int yypos1169= yypos, yythunkpos1169= yythunkpos;
+  {  int yypos1171= yypos, yythunkpos1171= yythunkpos;  if (!yymatchChar('`')) goto l1171;  goto l1169;
+  l1171:;	  yypos= yypos1171; yythunkpos= yythunkpos1171;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1169;
+  }  goto l1168;
+  l1169:;	  yypos= yypos1169; yythunkpos= yythunkpos1169;
+  }  goto l1166;
+  l1167:;	  yypos= yypos1166; yythunkpos= yythunkpos1166;
+  {  int yypos1173= yypos, yythunkpos1173= yythunkpos;  /* Ticks4 */
+  {  if (!yymatchString("````")) goto l1173;
+  {  int yypos1174= yypos, yythunkpos1174= yythunkpos;  if (!yymatchChar('`')) goto l1174;  goto l1173;
+  l1174:;	  yypos= yypos1174; yythunkpos= yythunkpos1174;
+  }
+  }  goto l1172;
+  l1173:;	  yypos= yypos1173; yythunkpos= yythunkpos1173;
+  }  if (!yymatchChar('`')) goto l1172;
+  l1175:;	
+  {  int yypos1176= yypos, yythunkpos1176= yythunkpos;  if (!yymatchChar('`')) goto l1176;  goto l1175;
+  l1176:;	  yypos= yypos1176; yythunkpos= yythunkpos1176;
+  }  goto l1166;
+  l1172:;	  yypos= yypos1166; yythunkpos= yythunkpos1166;
+  {  int yypos1177= yypos, yythunkpos1177= yythunkpos;  /* Sp */
+  {
+  l1178:;	
+  {  int yypos1179= yypos, yythunkpos1179= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1180= yypos, yythunkpos1180= yythunkpos;  if (!yymatchChar(' ')) goto l1181;  goto l1180;
+  l1181:;	  yypos= yypos1180; yythunkpos= yythunkpos1180;  if (!yymatchChar('\t')) goto l1179;
+  }
+  l1180:;	
+  }  goto l1178;
+  l1179:;	  yypos= yypos1179; yythunkpos= yythunkpos1179;
+  }
+  }  /* Ticks4 */
+  {  if (!yymatchString("````")) goto l1177;
+  {  int yypos1182= yypos, yythunkpos1182= yythunkpos;  if (!yymatchChar('`')) goto l1182;  goto l1177;
+  l1182:;	  yypos= yypos1182; yythunkpos= yythunkpos1182;
+  }
+  }  goto l1139;
+  l1177:;	  yypos= yypos1177; yythunkpos= yythunkpos1177;
+  }
+  {  int yypos1183= yypos, yythunkpos1183= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1185= yypos, yythunkpos1185= yythunkpos;  if (!yymatchChar(' ')) goto l1186;  goto l1185;
+  l1186:;	  yypos= yypos1185; yythunkpos= yythunkpos1185;  if (!yymatchChar('\t')) goto l1184;
+  }
+  l1185:;	
+  }  goto l1183;
+  l1184:;	  yypos= yypos1183; yythunkpos= yythunkpos1183;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1139;
+  }
+  {  int yypos1187= yypos, yythunkpos1187= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l1188:;	
+  {  int yypos1189= yypos, yythunkpos1189= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1190= yypos, yythunkpos1190= yythunkpos;  if (!yymatchChar(' ')) goto l1191;  goto l1190;
+  l1191:;	  yypos= yypos1190; yythunkpos= yythunkpos1190;  if (!yymatchChar('\t')) goto l1189;
+  }
+  l1190:;	
+  }  goto l1188;
+  l1189:;	  yypos= yypos1189; yythunkpos= yythunkpos1189;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1187;
+  }
+  }  goto l1139;
+  l1187:;	  yypos= yypos1187; yythunkpos= yythunkpos1187;
+  }
+  }
+  l1183:;	
+  }
+  l1166:;	  goto l1138;
+  l1139:;	  yypos= yypos1139; yythunkpos= yythunkpos1139;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l1132;  /* Sp */
+  {
+  l1192:;	
+  {  int yypos1193= yypos, yythunkpos1193= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1194= yypos, yythunkpos1194= yythunkpos;  if (!yymatchChar(' ')) goto l1195;  goto l1194;
+  l1195:;	  yypos= yypos1194; yythunkpos= yythunkpos1194;  if (!yymatchChar('\t')) goto l1193;
+  }
+  l1194:;	
+  }  goto l1192;
+  l1193:;	  yypos= yypos1193; yythunkpos= yythunkpos1193;
+  }
+  }  /* Ticks4 */
+  {  if (!yymatchString("````")) goto l1132;
+  {  int yypos1196= yypos, yythunkpos1196= yythunkpos;  if (!yymatchChar('`')) goto l1196;  goto l1132;
+  l1196:;	  yypos= yypos1196; yythunkpos= yythunkpos1196;
+  }
+  }  goto l936;
+  l1132:;	  yypos= yypos936; yythunkpos= yythunkpos936;  /* Ticks5 */
+  {  if (!yymatchString("`````")) goto l935;
+  {  int yypos1197= yypos, yythunkpos1197= yythunkpos;  if (!yymatchChar('`')) goto l1197;  goto l935;
+  l1197:;	  yypos= yypos1197; yythunkpos= yythunkpos1197;
+  }
+  }  /* Sp */
+  {
+  l1198:;	
+  {  int yypos1199= yypos, yythunkpos1199= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1200= yypos, yythunkpos1200= yythunkpos;  if (!yymatchChar(' ')) goto l1201;  goto l1200;
+  l1201:;	  yypos= yypos1200; yythunkpos= yythunkpos1200;  if (!yymatchChar('\t')) goto l1199;
+  }
+  l1200:;	
+  }  goto l1198;
+  l1199:;	  yypos= yypos1199; yythunkpos= yythunkpos1199;
+  }
+  }  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l935;
+  {  int yypos1204= yypos, yythunkpos1204= yythunkpos;
+  {  int yypos1208= yypos, yythunkpos1208= yythunkpos;  if (!yymatchChar('`')) goto l1208;  goto l1205;
+  l1208:;	  yypos= yypos1208; yythunkpos= yythunkpos1208;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1205;
+  }
+  l1206:;	
+  {  int yypos1207= yypos, yythunkpos1207= yythunkpos;
+  {  int yypos1209= yypos, yythunkpos1209= yythunkpos;  if (!yymatchChar('`')) goto l1209;  goto l1207;
+  l1209:;	  yypos= yypos1209; yythunkpos= yythunkpos1209;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1207;
+  }  goto l1206;
+  l1207:;	  yypos= yypos1207; yythunkpos= yythunkpos1207;
+  }  goto l1204;
+  l1205:;	  yypos= yypos1204; yythunkpos= yythunkpos1204;
+  {  int yypos1211= yypos, yythunkpos1211= yythunkpos;  /* Ticks5 */
+  {  if (!yymatchString("`````")) goto l1211;
+  {  int yypos1212= yypos, yythunkpos1212= yythunkpos;  if (!yymatchChar('`')) goto l1212;  goto l1211;
+  l1212:;	  yypos= yypos1212; yythunkpos= yythunkpos1212;
+  }
+  }  goto l1210;
+  l1211:;	  yypos= yypos1211; yythunkpos= yythunkpos1211;
+  }  if (!yymatchChar('`')) goto l1210;
+  l1213:;	
+  {  int yypos1214= yypos, yythunkpos1214= yythunkpos;  if (!yymatchChar('`')) goto l1214;  goto l1213;
+  l1214:;	  yypos= yypos1214; yythunkpos= yythunkpos1214;
+  }  goto l1204;
+  l1210:;	  yypos= yypos1204; yythunkpos= yythunkpos1204;
+  {  int yypos1215= yypos, yythunkpos1215= yythunkpos;  /* Sp */
+  {
+  l1216:;	
+  {  int yypos1217= yypos, yythunkpos1217= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1218= yypos, yythunkpos1218= yythunkpos;  if (!yymatchChar(' ')) goto l1219;  goto l1218;
+  l1219:;	  yypos= yypos1218; yythunkpos= yythunkpos1218;  if (!yymatchChar('\t')) goto l1217;
+  }
+  l1218:;	
+  }  goto l1216;
+  l1217:;	  yypos= yypos1217; yythunkpos= yythunkpos1217;
+  }
+  }  /* Ticks5 */
+  {  if (!yymatchString("`````")) goto l1215;
+  {  int yypos1220= yypos, yythunkpos1220= yythunkpos;  if (!yymatchChar('`')) goto l1220;  goto l1215;
+  l1220:;	  yypos= yypos1220; yythunkpos= yythunkpos1220;
+  }
+  }  goto l935;
+  l1215:;	  yypos= yypos1215; yythunkpos= yythunkpos1215;
+  }
+  {  int yypos1221= yypos, yythunkpos1221= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1223= yypos, yythunkpos1223= yythunkpos;  if (!yymatchChar(' ')) goto l1224;  goto l1223;
+  l1224:;	  yypos= yypos1223; yythunkpos= yythunkpos1223;  if (!yymatchChar('\t')) goto l1222;
+  }
+  l1223:;	
+  }  goto l1221;
+  l1222:;	  yypos= yypos1221; yythunkpos= yythunkpos1221;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l935;
+  }
+  {  int yypos1225= yypos, yythunkpos1225= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l1226:;	
+  {  int yypos1227= yypos, yythunkpos1227= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1228= yypos, yythunkpos1228= yythunkpos;  if (!yymatchChar(' ')) goto l1229;  goto l1228;
+  l1229:;	  yypos= yypos1228; yythunkpos= yythunkpos1228;  if (!yymatchChar('\t')) goto l1227;
+  }
+  l1228:;	
+  }  goto l1226;
+  l1227:;	  yypos= yypos1227; yythunkpos= yythunkpos1227;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1225;
+  }
+  }  goto l935;
+  l1225:;	  yypos= yypos1225; yythunkpos= yythunkpos1225;
+  }
+  }
+  l1221:;	
+  }
+  l1204:;	
+  l1202:;	
+  {  int yypos1203= yypos, yythunkpos1203= yythunkpos;
+  {  int yypos1230= yypos, yythunkpos1230= yythunkpos;
+  {  int yypos1234= yypos, yythunkpos1234= yythunkpos;  if (!yymatchChar('`')) goto l1234;  goto l1231;
+  l1234:;	  yypos= yypos1234; yythunkpos= yythunkpos1234;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1231;
+  }
+  l1232:;	
+  {  int yypos1233= yypos, yythunkpos1233= yythunkpos;
+  {  int yypos1235= yypos, yythunkpos1235= yythunkpos;  if (!yymatchChar('`')) goto l1235;  goto l1233;
+  l1235:;	  yypos= yypos1235; yythunkpos= yythunkpos1235;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l1233;
+  }  goto l1232;
+  l1233:;	  yypos= yypos1233; yythunkpos= yythunkpos1233;
+  }  goto l1230;
+  l1231:;	  yypos= yypos1230; yythunkpos= yythunkpos1230;
+  {  int yypos1237= yypos, yythunkpos1237= yythunkpos;  /* Ticks5 */
+  {  if (!yymatchString("`````")) goto l1237;
+  {  int yypos1238= yypos, yythunkpos1238= yythunkpos;  if (!yymatchChar('`')) goto l1238;  goto l1237;
+  l1238:;	  yypos= yypos1238; yythunkpos= yythunkpos1238;
+  }
+  }  goto l1236;
+  l1237:;	  yypos= yypos1237; yythunkpos= yythunkpos1237;
+  }  if (!yymatchChar('`')) goto l1236;
+  l1239:;	
+  {  int yypos1240= yypos, yythunkpos1240= yythunkpos;  if (!yymatchChar('`')) goto l1240;  goto l1239;
+  l1240:;	  yypos= yypos1240; yythunkpos= yythunkpos1240;
+  }  goto l1230;
+  l1236:;	  yypos= yypos1230; yythunkpos= yythunkpos1230;
+  {  int yypos1241= yypos, yythunkpos1241= yythunkpos;  /* Sp */
+  {
+  l1242:;	
+  {  int yypos1243= yypos, yythunkpos1243= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1244= yypos, yythunkpos1244= yythunkpos;  if (!yymatchChar(' ')) goto l1245;  goto l1244;
+  l1245:;	  yypos= yypos1244; yythunkpos= yythunkpos1244;  if (!yymatchChar('\t')) goto l1243;
+  }
+  l1244:;	
+  }  goto l1242;
+  l1243:;	  yypos= yypos1243; yythunkpos= yythunkpos1243;
+  }
+  }  /* Ticks5 */
+  {  if (!yymatchString("`````")) goto l1241;
+  {  int yypos1246= yypos, yythunkpos1246= yythunkpos;  if (!yymatchChar('`')) goto l1246;  goto l1241;
+  l1246:;	  yypos= yypos1246; yythunkpos= yythunkpos1246;
+  }
+  }  goto l1203;
+  l1241:;	  yypos= yypos1241; yythunkpos= yythunkpos1241;
+  }
+  {  int yypos1247= yypos, yythunkpos1247= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1249= yypos, yythunkpos1249= yythunkpos;  if (!yymatchChar(' ')) goto l1250;  goto l1249;
+  l1250:;	  yypos= yypos1249; yythunkpos= yythunkpos1249;  if (!yymatchChar('\t')) goto l1248;
+  }
+  l1249:;	
+  }  goto l1247;
+  l1248:;	  yypos= yypos1247; yythunkpos= yythunkpos1247;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1203;
+  }
+  {  int yypos1251= yypos, yythunkpos1251= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l1252:;	
+  {  int yypos1253= yypos, yythunkpos1253= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1254= yypos, yythunkpos1254= yythunkpos;  if (!yymatchChar(' ')) goto l1255;  goto l1254;
+  l1255:;	  yypos= yypos1254; yythunkpos= yythunkpos1254;  if (!yymatchChar('\t')) goto l1253;
+  }
+  l1254:;	
+  }  goto l1252;
+  l1253:;	  yypos= yypos1253; yythunkpos= yythunkpos1253;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l1251;
+  }
+  }  goto l1203;
+  l1251:;	  yypos= yypos1251; yythunkpos= yythunkpos1251;
+  }
+  }
+  l1247:;	
+  }
+  l1230:;	  goto l1202;
+  l1203:;	  yypos= yypos1203; yythunkpos= yythunkpos1203;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l935;  /* Sp */
+  {
+  l1256:;	
+  {  int yypos1257= yypos, yythunkpos1257= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1258= yypos, yythunkpos1258= yythunkpos;  if (!yymatchChar(' ')) goto l1259;  goto l1258;
+  l1259:;	  yypos= yypos1258; yythunkpos= yythunkpos1258;  if (!yymatchChar('\t')) goto l1257;
+  }
+  l1258:;	
+  }  goto l1256;
+  l1257:;	  yypos= yypos1257; yythunkpos= yythunkpos1257;
+  }
+  }  /* Ticks5 */
+  {  if (!yymatchString("`````")) goto l935;
+  {  int yypos1260= yypos, yythunkpos1260= yythunkpos;  if (!yymatchChar('`')) goto l1260;  goto l935;
+  l1260:;	  yypos= yypos1260; yythunkpos= yythunkpos1260;
+  }
+  }
+  }
+  l936:;	  yyDo(yy_1_Code, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Code", yybuf+yypos));
+  return 1;
+  l935:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Code", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_NoteReference()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "NoteReference"));  yyText(yybegin, yyend);  if (!( extension(EXT_NOTES) )) goto l1261;  if (!yy_RawNoteReference()) goto l1261;  yyDo(yySet, -1, 0);  yyDo(yy_1_NoteReference, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "NoteReference", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l1261:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NoteReference", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Link()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Link"));
+  {  int yypos1263= yypos, yythunkpos1263= yythunkpos;  if (!yy_ExplicitLink()) goto l1264;  goto l1263;
+  l1264:;	  yypos= yypos1263; yythunkpos= yythunkpos1263;  /* ReferenceLink */
+  {
+  {  int yypos1266= yypos, yythunkpos1266= yythunkpos;  if (!yy_ReferenceLinkDouble()) goto l1267;  goto l1266;
+  l1267:;	  yypos= yypos1266; yythunkpos= yythunkpos1266;  if (!yy_ReferenceLinkSingle()) goto l1265;
+  }
+  l1266:;	
+  }  goto l1263;
+  l1265:;	  yypos= yypos1263; yythunkpos= yythunkpos1263;  /* AutoLink */
+  {
+  {  int yypos1268= yypos, yythunkpos1268= yythunkpos;  if (!yy_AutoLinkUrl()) goto l1269;  goto l1268;
+  l1269:;	  yypos= yypos1268; yythunkpos= yythunkpos1268;  if (!yy_AutoLinkEmail()) goto l1262;
+  }
+  l1268:;	
+  }
+  }
+  l1263:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Link", yybuf+yypos));
+  return 1;
+  l1262:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Link", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Image()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Image"));  if (!yymatchChar('!')) goto l1270;
+  {  int yypos1271= yypos, yythunkpos1271= yythunkpos;  if (!yy_ExplicitLink()) goto l1272;  goto l1271;
+  l1272:;	  yypos= yypos1271; yythunkpos= yythunkpos1271;  /* ReferenceLink */
+  {
+  {  int yypos1273= yypos, yythunkpos1273= yythunkpos;  if (!yy_ReferenceLinkDouble()) goto l1274;  goto l1273;
+  l1274:;	  yypos= yypos1273; yythunkpos= yythunkpos1273;  if (!yy_ReferenceLinkSingle()) goto l1270;
+  }
+  l1273:;	
+  }
+  }
+  l1271:;	  yyDo(yy_1_Image, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Image", yybuf+yypos));
+  return 1;
+  l1270:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Image", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_CitationReference()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "CitationReference"));
+  {  int yypos1276= yypos, yythunkpos1276= yythunkpos;  if (!yy_CitationReferenceDouble()) goto l1277;  goto l1276;
+  l1277:;	  yypos= yypos1276; yythunkpos= yythunkpos1276;  if (!yy_CitationReferenceSingle()) goto l1275;
+  }
+  l1276:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "CitationReference", yybuf+yypos));
+  return 1;
+  l1275:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CitationReference", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Emph()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Emph"));
+  {  int yypos1279= yypos, yythunkpos1279= yythunkpos;  if (!yy_EmphStar()) goto l1280;  goto l1279;
+  l1280:;	  yypos= yypos1279; yythunkpos= yythunkpos1279;  if (!yy_EmphUl()) goto l1278;
+  }
+  l1279:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Emph", yybuf+yypos));
+  return 1;
+  l1278:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Emph", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Strong()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Strong"));
+  {  int yypos1282= yypos, yythunkpos1282= yythunkpos;  if (!yy_StrongStar()) goto l1283;  goto l1282;
+  l1283:;	  yypos= yypos1282; yythunkpos= yythunkpos1282;  if (!yy_StrongUl()) goto l1281;
+  }
+  l1282:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Strong", yybuf+yypos));
+  return 1;
+  l1281:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Strong", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Space()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Space"));  /* Spacechar */
+  {
+  {  int yypos1287= yypos, yythunkpos1287= yythunkpos;  if (!yymatchChar(' ')) goto l1288;  goto l1287;
+  l1288:;	  yypos= yypos1287; yythunkpos= yythunkpos1287;  if (!yymatchChar('\t')) goto l1284;
+  }
+  l1287:;	
+  }
+  l1285:;	
+  {  int yypos1286= yypos, yythunkpos1286= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos1289= yypos, yythunkpos1289= yythunkpos;  if (!yymatchChar(' ')) goto l1290;  goto l1289;
+  l1290:;	  yypos= yypos1289; yythunkpos= yythunkpos1289;  if (!yymatchChar('\t')) goto l1286;
+  }
+  l1289:;	
+  }  goto l1285;
+  l1286:;	  yypos= yypos1286; yythunkpos= yythunkpos1286;
+  }  yyDo(yy_1_Space, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Space", yybuf+yypos));
+  return 1;
+  l1284:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Space", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_UlOrStarLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "UlOrStarLine"));
+  {  int yypos1292= yypos, yythunkpos1292= yythunkpos;  if (!yy_UlLine()) goto l1293;  goto l1292;
+  l1293:;	  yypos= yypos1292; yythunkpos= yythunkpos1292;  if (!yy_StarLine()) goto l1291;
+  }
+  l1292:;	  yyDo(yy_1_UlOrStarLine, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "UlOrStarLine", yybuf+yypos));
+  return 1;
+  l1291:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "UlOrStarLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_MathSpan()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "MathSpan"));  if (!yymatchChar('\\')) goto l1294;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l1294;
+  {  int yypos1295= yypos, yythunkpos1295= yythunkpos;  if (!yymatchString("\\[")) goto l1296;
+  l1297:;	
+  {  int yypos1298= yypos, yythunkpos1298= yythunkpos;
+  {  int yypos1299= yypos, yythunkpos1299= yythunkpos;  if (!yymatchString("\\\\]")) goto l1299;  goto l1298;
+  l1299:;	  yypos= yypos1299; yythunkpos= yythunkpos1299;
+  }  if (!yymatchDot()) goto l1298;  goto l1297;
+  l1298:;	  yypos= yypos1298; yythunkpos= yythunkpos1298;
+  }  if (!yymatchString("\\\\]")) goto l1296;  goto l1295;
+  l1296:;	  yypos= yypos1295; yythunkpos= yythunkpos1295;  if (!yymatchString("\\(")) goto l1294;
+  l1300:;	
+  {  int yypos1301= yypos, yythunkpos1301= yythunkpos;
+  {  int yypos1302= yypos, yythunkpos1302= yythunkpos;  if (!yymatchString("\\\\)")) goto l1302;  goto l1301;
+  l1302:;	  yypos= yypos1302; yythunkpos= yythunkpos1302;
+  }  if (!yymatchDot()) goto l1301;  goto l1300;
+  l1301:;	  yypos= yypos1301; yythunkpos= yythunkpos1301;
+  }  if (!yymatchString("\\\\)")) goto l1294;
+  }
+  l1295:;	  yyText(yybegin, yyend);  if (!(YY_END)) goto l1294;  yyDo(yy_1_MathSpan, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MathSpan", yybuf+yypos));
+  return 1;
+  l1294:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MathSpan", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Str()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Str"));  /* StartList */
+  {
+  {  int yypos1304= yypos, yythunkpos1304= yythunkpos;  if (!yymatchDot()) goto l1303;  yypos= yypos1304; yythunkpos= yythunkpos1304;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l1303;  if (!yy_NormalChar()) goto l1303;
+  l1305:;	
+  {  int yypos1306= yypos, yythunkpos1306= yythunkpos;  if (!yy_NormalChar()) goto l1306;  goto l1305;
+  l1306:;	  yypos= yypos1306; yythunkpos= yythunkpos1306;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l1303;  yyDo(yy_1_Str, yybegin, yyend);
+  l1307:;	
+  {  int yypos1308= yypos, yythunkpos1308= yythunkpos;  if (!yy_StrChunk()) goto l1308;  yyDo(yy_2_Str, yybegin, yyend);  goto l1307;
+  l1308:;	  yypos= yypos1308; yythunkpos= yythunkpos1308;
+  }  yyDo(yy_3_Str, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Str", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l1303:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Str", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_InStyleTags()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "InStyleTags"));  if (!yy_StyleOpen()) goto l1309;
+  l1310:;	
+  {  int yypos1311= yypos, yythunkpos1311= yythunkpos;
+  {  int yypos1312= yypos, yythunkpos1312= yythunkpos;  if (!yy_StyleClose()) goto l1312;  goto l1311;
+  l1312:;	  yypos= yypos1312; yythunkpos= yythunkpos1312;
+  }  if (!yymatchDot()) goto l1311;  goto l1310;
+  l1311:;	  yypos= yypos1311; yythunkpos= yythunkpos1311;
+  }  if (!yy_StyleClose()) goto l1309;
+  yyprintf((stderr, "  ok   %s @ %s\n", "InStyleTags", yybuf+yypos));
+  return 1;
+  l1309:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "InStyleTags", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_StyleClose()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "StyleClose"));  if (!yymatchChar('<')) goto l1313;  if (!yy_Spnl()) goto l1313;  if (!yymatchChar('/')) goto l1313;
+  {  int yypos1314= yypos, yythunkpos1314= yythunkpos;  if (!yymatchString("style")) goto l1315;  goto l1314;
+  l1315:;	  yypos= yypos1314; yythunkpos= yythunkpos1314;  if (!yymatchString("STYLE")) goto l1313;
+  }
+  l1314:;	  if (!yy_Spnl()) goto l1313;  if (!yymatchChar('>')) goto l1313;
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleClose", yybuf+yypos));
+  return 1;
+  l1313:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleClose", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_StyleOpen()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "StyleOpen"));  if (!yymatchChar('<')) goto l1316;  if (!yy_Spnl()) goto l1316;
+  {  int yypos1317= yypos, yythunkpos1317= yythunkpos;  if (!yymatchString("style")) goto l1318;  goto l1317;
+  l1318:;	  yypos= yypos1317; yythunkpos= yythunkpos1317;  if (!yymatchString("STYLE")) goto l1316;
+  }
+  l1317:;	  if (!yy_Spnl()) goto l1316;
+  l1319:;	
+  {  int yypos1320= yypos, yythunkpos1320= yythunkpos;  if (!yy_HtmlAttribute()) goto l1320;  goto l1319;
+  l1320:;	  yypos= yypos1320; yythunkpos= yythunkpos1320;
+  }  if (!yymatchChar('>')) goto l1316;
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleOpen", yybuf+yypos));
+  return 1;
+  l1316:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleOpen", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockType()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockType"));
+  {  int yypos1322= yypos, yythunkpos1322= yythunkpos;  if (!yymatchString("address")) goto l1323;  goto l1322;
+  l1323:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("blockquote")) goto l1324;  goto l1322;
+  l1324:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("center")) goto l1325;  goto l1322;
+  l1325:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("dir")) goto l1326;  goto l1322;
+  l1326:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("div")) goto l1327;  goto l1322;
+  l1327:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("dl")) goto l1328;  goto l1322;
+  l1328:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("fieldset")) goto l1329;  goto l1322;
+  l1329:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("form")) goto l1330;  goto l1322;
+  l1330:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("h1")) goto l1331;  goto l1322;
+  l1331:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("h2")) goto l1332;  goto l1322;
+  l1332:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("h3")) goto l1333;  goto l1322;
+  l1333:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("h4")) goto l1334;  goto l1322;
+  l1334:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("h5")) goto l1335;  goto l1322;
+  l1335:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("h6")) goto l1336;  goto l1322;
+  l1336:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("hr")) goto l1337;  goto l1322;
+  l1337:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("isindex")) goto l1338;  goto l1322;
+  l1338:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("menu")) goto l1339;  goto l1322;
+  l1339:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("noframes")) goto l1340;  goto l1322;
+  l1340:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("noscript")) goto l1341;  goto l1322;
+  l1341:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("ol")) goto l1342;  goto l1322;
+  l1342:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchChar('p')) goto l1343;  goto l1322;
+  l1343:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("pre")) goto l1344;  goto l1322;
+  l1344:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("table")) goto l1345;  goto l1322;
+  l1345:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("ul")) goto l1346;  goto l1322;
+  l1346:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("dd")) goto l1347;  goto l1322;
+  l1347:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("dt")) goto l1348;  goto l1322;
+  l1348:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("frameset")) goto l1349;  goto l1322;
+  l1349:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("li")) goto l1350;  goto l1322;
+  l1350:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("tbody")) goto l1351;  goto l1322;
+  l1351:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("td")) goto l1352;  goto l1322;
+  l1352:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("tfoot")) goto l1353;  goto l1322;
+  l1353:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("th")) goto l1354;  goto l1322;
+  l1354:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("thead")) goto l1355;  goto l1322;
+  l1355:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("tr")) goto l1356;  goto l1322;
+  l1356:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("script")) goto l1357;  goto l1322;
+  l1357:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("ADDRESS")) goto l1358;  goto l1322;
+  l1358:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("BLOCKQUOTE")) goto l1359;  goto l1322;
+  l1359:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("CENTER")) goto l1360;  goto l1322;
+  l1360:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("DIR")) goto l1361;  goto l1322;
+  l1361:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("DIV")) goto l1362;  goto l1322;
+  l1362:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("DL")) goto l1363;  goto l1322;
+  l1363:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("FIELDSET")) goto l1364;  goto l1322;
+  l1364:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("FORM")) goto l1365;  goto l1322;
+  l1365:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("H1")) goto l1366;  goto l1322;
+  l1366:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("H2")) goto l1367;  goto l1322;
+  l1367:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("H3")) goto l1368;  goto l1322;
+  l1368:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("H4")) goto l1369;  goto l1322;
+  l1369:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("H5")) goto l1370;  goto l1322;
+  l1370:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("H6")) goto l1371;  goto l1322;
+  l1371:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("HR")) goto l1372;  goto l1322;
+  l1372:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("ISINDEX")) goto l1373;  goto l1322;
+  l1373:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("MENU")) goto l1374;  goto l1322;
+  l1374:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("NOFRAMES")) goto l1375;  goto l1322;
+  l1375:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("NOSCRIPT")) goto l1376;  goto l1322;
+  l1376:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("OL")) goto l1377;  goto l1322;
+  l1377:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchChar('P')) goto l1378;  goto l1322;
+  l1378:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("PRE")) goto l1379;  goto l1322;
+  l1379:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("TABLE")) goto l1380;  goto l1322;
+  l1380:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("UL")) goto l1381;  goto l1322;
+  l1381:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("DD")) goto l1382;  goto l1322;
+  l1382:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("DT")) goto l1383;  goto l1322;
+  l1383:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("FRAMESET")) goto l1384;  goto l1322;
+  l1384:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("LI")) goto l1385;  goto l1322;
+  l1385:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("TBODY")) goto l1386;  goto l1322;
+  l1386:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("TD")) goto l1387;  goto l1322;
+  l1387:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("TFOOT")) goto l1388;  goto l1322;
+  l1388:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("TH")) goto l1389;  goto l1322;
+  l1389:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("THEAD")) goto l1390;  goto l1322;
+  l1390:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("TR")) goto l1391;  goto l1322;
+  l1391:;	  yypos= yypos1322; yythunkpos= yythunkpos1322;  if (!yymatchString("SCRIPT")) goto l1321;
+  }
+  l1322:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockType", yybuf+yypos));
+  return 1;
+  l1321:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockType", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockSelfClosing()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockSelfClosing"));  if (!yymatchChar('<')) goto l1392;  if (!yy_Spnl()) goto l1392;  if (!yy_HtmlBlockType()) goto l1392;  if (!yy_Spnl()) goto l1392;
+  l1393:;	
+  {  int yypos1394= yypos, yythunkpos1394= yythunkpos;  if (!yy_HtmlAttribute()) goto l1394;  goto l1393;
+  l1394:;	  yypos= yypos1394; yythunkpos= yythunkpos1394;
+  }  if (!yymatchChar('/')) goto l1392;  if (!yy_Spnl()) goto l1392;  if (!yymatchChar('>')) goto l1392;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockSelfClosing", yybuf+yypos));
+  return 1;
+  l1392:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockSelfClosing", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlComment()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlComment"));  if (!yymatchString("<!--")) goto l1395;
+  l1396:;	
+  {  int yypos1397= yypos, yythunkpos1397= yythunkpos;
+  {  int yypos1398= yypos, yythunkpos1398= yythunkpos;  if (!yymatchString("-->")) goto l1398;  goto l1397;
+  l1398:;	  yypos= yypos1398; yythunkpos= yythunkpos1398;
+  }  if (!yymatchDot()) goto l1397;  goto l1396;
+  l1397:;	  yypos= yypos1397; yythunkpos= yythunkpos1397;
+  }  if (!yymatchString("-->")) goto l1395;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlComment", yybuf+yypos));
+  return 1;
+  l1395:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlComment", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_MarkdownHtmlTagOpen()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "MarkdownHtmlTagOpen"));  /* StartList */
+  {
+  {  int yypos1400= yypos, yythunkpos1400= yythunkpos;  if (!yymatchDot()) goto l1399;  yypos= yypos1400; yythunkpos= yythunkpos1400;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  if (!yymatchChar('<')) goto l1399;  yyDo(yy_1_MarkdownHtmlTagOpen, yybegin, yyend);  if (!yy_Spnl()) goto l1399;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l1399;  if (!yy_HtmlBlockType()) goto l1399;  yyText(yybegin, yyend);  if (!(YY_END)) goto l1399;  yyDo(yy_2_MarkdownHtmlTagOpen, yybegin, yyend);  if (!yy_Spnl()) goto l1399;
+  l1401:;	
+  {  int yypos1402= yypos, yythunkpos1402= yythunkpos;
+  {  int yypos1403= yypos, yythunkpos1403= yythunkpos;  if (!yy_MarkdownHtmlAttribute()) goto l1403;  goto l1402;
+  l1403:;	  yypos= yypos1403; yythunkpos= yythunkpos1403;
+  }  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l1402;  if (!yy_HtmlAttribute()) goto l1402;  yyText(yybegin, yyend);  if (!(YY_END)) goto l1402;  yyDo(yy_3_MarkdownHtmlTagOpen, yybegin, yyend);  goto l1401;
+  l1402:;	  yypos= yypos1402; yythunkpos= yythunkpos1402;
+  }  if (!yy_MarkdownHtmlAttribute()) goto l1399;
+  l1404:;	
+  {  int yypos1405= yypos, yythunkpos1405= yythunkpos;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l1405;  if (!yy_HtmlAttribute()) goto l1405;  yyText(yybegin, yyend);  if (!(YY_END)) goto l1405;  yyDo(yy_4_MarkdownHtmlTagOpen, yybegin, yyend);  goto l1404;
+  l1405:;	  yypos= yypos1405; yythunkpos= yythunkpos1405;
+  }  if (!yymatchChar('>')) goto l1399;  yyDo(yy_5_MarkdownHtmlTagOpen, yybegin, yyend);  yyDo(yy_6_MarkdownHtmlTagOpen, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MarkdownHtmlTagOpen", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l1399:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MarkdownHtmlTagOpen", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockInTags()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockInTags"));
+  {  int yypos1407= yypos, yythunkpos1407= yythunkpos;  if (!yy_HtmlBlockAddress()) goto l1408;  goto l1407;
+  l1408:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockArticle()) goto l1409;  goto l1407;
+  l1409:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockAside()) goto l1410;  goto l1407;
+  l1410:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockCanvas()) goto l1411;  goto l1407;
+  l1411:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockBlockquote()) goto l1412;  goto l1407;
+  l1412:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockCenter()) goto l1413;  goto l1407;
+  l1413:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockDir()) goto l1414;  goto l1407;
+  l1414:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockDiv()) goto l1415;  goto l1407;
+  l1415:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockDl()) goto l1416;  goto l1407;
+  l1416:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockFieldset()) goto l1417;  goto l1407;
+  l1417:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockFigure()) goto l1418;  goto l1407;
+  l1418:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockFooter()) goto l1419;  goto l1407;
+  l1419:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockForm()) goto l1420;  goto l1407;
+  l1420:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockHeader()) goto l1421;  goto l1407;
+  l1421:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockHgroup()) goto l1422;  goto l1407;
+  l1422:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockH1()) goto l1423;  goto l1407;
+  l1423:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockH2()) goto l1424;  goto l1407;
+  l1424:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockH3()) goto l1425;  goto l1407;
+  l1425:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockH4()) goto l1426;  goto l1407;
+  l1426:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockH5()) goto l1427;  goto l1407;
+  l1427:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockH6()) goto l1428;  goto l1407;
+  l1428:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockMenu()) goto l1429;  goto l1407;
+  l1429:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockNoframes()) goto l1430;  goto l1407;
+  l1430:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockNoscript()) goto l1431;  goto l1407;
+  l1431:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockOl()) goto l1432;  goto l1407;
+  l1432:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockP()) goto l1433;  goto l1407;
+  l1433:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockPre()) goto l1434;  goto l1407;
+  l1434:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockProgress()) goto l1435;  goto l1407;
+  l1435:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockSection()) goto l1436;  goto l1407;
+  l1436:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockTable()) goto l1437;  goto l1407;
+  l1437:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockUl()) goto l1438;  goto l1407;
+  l1438:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockVideo()) goto l1439;  goto l1407;
+  l1439:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockDd()) goto l1440;  goto l1407;
+  l1440:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockDt()) goto l1441;  goto l1407;
+  l1441:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockFrameset()) goto l1442;  goto l1407;
+  l1442:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockLi()) goto l1443;  goto l1407;
+  l1443:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockTbody()) goto l1444;  goto l1407;
+  l1444:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockTd()) goto l1445;  goto l1407;
+  l1445:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockTfoot()) goto l1446;  goto l1407;
+  l1446:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockTh()) goto l1447;  goto l1407;
+  l1447:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockThead()) goto l1448;  goto l1407;
+  l1448:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockTr()) goto l1449;  goto l1407;
+  l1449:;	  yypos= yypos1407; yythunkpos= yythunkpos1407;  if (!yy_HtmlBlockScript()) goto l1406;
+  }
+  l1407:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockInTags", yybuf+yypos));
+  return 1;
+  l1406:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockInTags", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockScript()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockScript"));  if (!yy_HtmlBlockOpenScript()) goto l1450;
+  l1451:;	
+  {  int yypos1452= yypos, yythunkpos1452= yythunkpos;
+  {  int yypos1453= yypos, yythunkpos1453= yythunkpos;  if (!yy_HtmlBlockCloseScript()) goto l1453;  goto l1452;
+  l1453:;	  yypos= yypos1453; yythunkpos= yythunkpos1453;
+  }  if (!yymatchDot()) goto l1452;  goto l1451;
+  l1452:;	  yypos= yypos1452; yythunkpos= yythunkpos1452;
+  }  if (!yy_HtmlBlockCloseScript()) goto l1450;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockScript", yybuf+yypos));
+  return 1;
+  l1450:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockScript", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseScript()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseScript"));  if (!yymatchChar('<')) goto l1454;  if (!yy_Spnl()) goto l1454;  if (!yymatchChar('/')) goto l1454;
+  {  int yypos1455= yypos, yythunkpos1455= yythunkpos;  if (!yymatchString("script")) goto l1456;  goto l1455;
+  l1456:;	  yypos= yypos1455; yythunkpos= yythunkpos1455;  if (!yymatchString("SCRIPT")) goto l1454;
+  }
+  l1455:;	  if (!yy_Spnl()) goto l1454;  if (!yymatchChar('>')) goto l1454;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseScript", yybuf+yypos));
+  return 1;
+  l1454:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseScript", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenScript()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenScript"));  if (!yymatchChar('<')) goto l1457;  if (!yy_Spnl()) goto l1457;
+  {  int yypos1458= yypos, yythunkpos1458= yythunkpos;  if (!yymatchString("script")) goto l1459;  goto l1458;
+  l1459:;	  yypos= yypos1458; yythunkpos= yythunkpos1458;  if (!yymatchString("SCRIPT")) goto l1457;
+  }
+  l1458:;	  if (!yy_Spnl()) goto l1457;
+  l1460:;	
+  {  int yypos1461= yypos, yythunkpos1461= yythunkpos;  if (!yy_HtmlAttribute()) goto l1461;  goto l1460;
+  l1461:;	  yypos= yypos1461; yythunkpos= yythunkpos1461;
+  }  if (!yymatchChar('>')) goto l1457;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenScript", yybuf+yypos));
+  return 1;
+  l1457:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenScript", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockTr()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTr"));  if (!yy_HtmlBlockOpenTr()) goto l1462;
+  l1463:;	
+  {  int yypos1464= yypos, yythunkpos1464= yythunkpos;
+  {  int yypos1465= yypos, yythunkpos1465= yythunkpos;  if (!yy_HtmlBlockTr()) goto l1466;  goto l1465;
+  l1466:;	  yypos= yypos1465; yythunkpos= yythunkpos1465;
+  {  int yypos1467= yypos, yythunkpos1467= yythunkpos;  if (!yy_HtmlBlockCloseTr()) goto l1467;  goto l1464;
+  l1467:;	  yypos= yypos1467; yythunkpos= yythunkpos1467;
+  }  if (!yymatchDot()) goto l1464;
+  }
+  l1465:;	  goto l1463;
+  l1464:;	  yypos= yypos1464; yythunkpos= yythunkpos1464;
+  }  if (!yy_HtmlBlockCloseTr()) goto l1462;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTr", yybuf+yypos));
+  return 1;
+  l1462:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTr", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTr()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTr"));  if (!yymatchChar('<')) goto l1468;  if (!yy_Spnl()) goto l1468;  if (!yymatchChar('/')) goto l1468;
+  {  int yypos1469= yypos, yythunkpos1469= yythunkpos;  if (!yymatchString("tr")) goto l1470;  goto l1469;
+  l1470:;	  yypos= yypos1469; yythunkpos= yythunkpos1469;  if (!yymatchString("TR")) goto l1468;
+  }
+  l1469:;	  if (!yy_Spnl()) goto l1468;  if (!yymatchChar('>')) goto l1468;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTr", yybuf+yypos));
+  return 1;
+  l1468:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTr", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTr()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTr"));  if (!yymatchChar('<')) goto l1471;  if (!yy_Spnl()) goto l1471;
+  {  int yypos1472= yypos, yythunkpos1472= yythunkpos;  if (!yymatchString("tr")) goto l1473;  goto l1472;
+  l1473:;	  yypos= yypos1472; yythunkpos= yythunkpos1472;  if (!yymatchString("TR")) goto l1471;
+  }
+  l1472:;	  if (!yy_Spnl()) goto l1471;
+  l1474:;	
+  {  int yypos1475= yypos, yythunkpos1475= yythunkpos;  if (!yy_HtmlAttribute()) goto l1475;  goto l1474;
+  l1475:;	  yypos= yypos1475; yythunkpos= yythunkpos1475;
+  }  if (!yymatchChar('>')) goto l1471;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTr", yybuf+yypos));
+  return 1;
+  l1471:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTr", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockThead()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockThead"));  if (!yy_HtmlBlockOpenThead()) goto l1476;
+  l1477:;	
+  {  int yypos1478= yypos, yythunkpos1478= yythunkpos;
+  {  int yypos1479= yypos, yythunkpos1479= yythunkpos;  if (!yy_HtmlBlockThead()) goto l1480;  goto l1479;
+  l1480:;	  yypos= yypos1479; yythunkpos= yythunkpos1479;
+  {  int yypos1481= yypos, yythunkpos1481= yythunkpos;  if (!yy_HtmlBlockCloseThead()) goto l1481;  goto l1478;
+  l1481:;	  yypos= yypos1481; yythunkpos= yythunkpos1481;
+  }  if (!yymatchDot()) goto l1478;
+  }
+  l1479:;	  goto l1477;
+  l1478:;	  yypos= yypos1478; yythunkpos= yythunkpos1478;
+  }  if (!yy_HtmlBlockCloseThead()) goto l1476;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockThead", yybuf+yypos));
+  return 1;
+  l1476:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockThead", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseThead()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseThead"));  if (!yymatchChar('<')) goto l1482;  if (!yy_Spnl()) goto l1482;  if (!yymatchChar('/')) goto l1482;
+  {  int yypos1483= yypos, yythunkpos1483= yythunkpos;  if (!yymatchString("thead")) goto l1484;  goto l1483;
+  l1484:;	  yypos= yypos1483; yythunkpos= yythunkpos1483;  if (!yymatchString("THEAD")) goto l1482;
+  }
+  l1483:;	  if (!yy_Spnl()) goto l1482;  if (!yymatchChar('>')) goto l1482;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseThead", yybuf+yypos));
+  return 1;
+  l1482:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseThead", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenThead()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenThead"));  if (!yymatchChar('<')) goto l1485;  if (!yy_Spnl()) goto l1485;
+  {  int yypos1486= yypos, yythunkpos1486= yythunkpos;  if (!yymatchString("thead")) goto l1487;  goto l1486;
+  l1487:;	  yypos= yypos1486; yythunkpos= yythunkpos1486;  if (!yymatchString("THEAD")) goto l1485;
+  }
+  l1486:;	  if (!yy_Spnl()) goto l1485;
+  l1488:;	
+  {  int yypos1489= yypos, yythunkpos1489= yythunkpos;  if (!yy_HtmlAttribute()) goto l1489;  goto l1488;
+  l1489:;	  yypos= yypos1489; yythunkpos= yythunkpos1489;
+  }  if (!yymatchChar('>')) goto l1485;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenThead", yybuf+yypos));
+  return 1;
+  l1485:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenThead", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockTh()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTh"));  if (!yy_HtmlBlockOpenTh()) goto l1490;
+  l1491:;	
+  {  int yypos1492= yypos, yythunkpos1492= yythunkpos;
+  {  int yypos1493= yypos, yythunkpos1493= yythunkpos;  if (!yy_HtmlBlockTh()) goto l1494;  goto l1493;
+  l1494:;	  yypos= yypos1493; yythunkpos= yythunkpos1493;
+  {  int yypos1495= yypos, yythunkpos1495= yythunkpos;  if (!yy_HtmlBlockCloseTh()) goto l1495;  goto l1492;
+  l1495:;	  yypos= yypos1495; yythunkpos= yythunkpos1495;
+  }  if (!yymatchDot()) goto l1492;
+  }
+  l1493:;	  goto l1491;
+  l1492:;	  yypos= yypos1492; yythunkpos= yythunkpos1492;
+  }  if (!yy_HtmlBlockCloseTh()) goto l1490;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTh", yybuf+yypos));
+  return 1;
+  l1490:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTh", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTh()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTh"));  if (!yymatchChar('<')) goto l1496;  if (!yy_Spnl()) goto l1496;  if (!yymatchChar('/')) goto l1496;
+  {  int yypos1497= yypos, yythunkpos1497= yythunkpos;  if (!yymatchString("th")) goto l1498;  goto l1497;
+  l1498:;	  yypos= yypos1497; yythunkpos= yythunkpos1497;  if (!yymatchString("TH")) goto l1496;
+  }
+  l1497:;	  if (!yy_Spnl()) goto l1496;  if (!yymatchChar('>')) goto l1496;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTh", yybuf+yypos));
+  return 1;
+  l1496:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTh", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTh()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTh"));  if (!yymatchChar('<')) goto l1499;  if (!yy_Spnl()) goto l1499;
+  {  int yypos1500= yypos, yythunkpos1500= yythunkpos;  if (!yymatchString("th")) goto l1501;  goto l1500;
+  l1501:;	  yypos= yypos1500; yythunkpos= yythunkpos1500;  if (!yymatchString("TH")) goto l1499;
+  }
+  l1500:;	  if (!yy_Spnl()) goto l1499;
+  l1502:;	
+  {  int yypos1503= yypos, yythunkpos1503= yythunkpos;  if (!yy_HtmlAttribute()) goto l1503;  goto l1502;
+  l1503:;	  yypos= yypos1503; yythunkpos= yythunkpos1503;
+  }  if (!yymatchChar('>')) goto l1499;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTh", yybuf+yypos));
+  return 1;
+  l1499:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTh", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockTfoot()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTfoot"));  if (!yy_HtmlBlockOpenTfoot()) goto l1504;
+  l1505:;	
+  {  int yypos1506= yypos, yythunkpos1506= yythunkpos;
+  {  int yypos1507= yypos, yythunkpos1507= yythunkpos;  if (!yy_HtmlBlockTfoot()) goto l1508;  goto l1507;
+  l1508:;	  yypos= yypos1507; yythunkpos= yythunkpos1507;
+  {  int yypos1509= yypos, yythunkpos1509= yythunkpos;  if (!yy_HtmlBlockCloseTfoot()) goto l1509;  goto l1506;
+  l1509:;	  yypos= yypos1509; yythunkpos= yythunkpos1509;
+  }  if (!yymatchDot()) goto l1506;
+  }
+  l1507:;	  goto l1505;
+  l1506:;	  yypos= yypos1506; yythunkpos= yythunkpos1506;
+  }  if (!yy_HtmlBlockCloseTfoot()) goto l1504;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTfoot", yybuf+yypos));
+  return 1;
+  l1504:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTfoot", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTfoot()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTfoot"));  if (!yymatchChar('<')) goto l1510;  if (!yy_Spnl()) goto l1510;  if (!yymatchChar('/')) goto l1510;
+  {  int yypos1511= yypos, yythunkpos1511= yythunkpos;  if (!yymatchString("tfoot")) goto l1512;  goto l1511;
+  l1512:;	  yypos= yypos1511; yythunkpos= yythunkpos1511;  if (!yymatchString("TFOOT")) goto l1510;
+  }
+  l1511:;	  if (!yy_Spnl()) goto l1510;  if (!yymatchChar('>')) goto l1510;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTfoot", yybuf+yypos));
+  return 1;
+  l1510:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTfoot", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTfoot()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTfoot"));  if (!yymatchChar('<')) goto l1513;  if (!yy_Spnl()) goto l1513;
+  {  int yypos1514= yypos, yythunkpos1514= yythunkpos;  if (!yymatchString("tfoot")) goto l1515;  goto l1514;
+  l1515:;	  yypos= yypos1514; yythunkpos= yythunkpos1514;  if (!yymatchString("TFOOT")) goto l1513;
+  }
+  l1514:;	  if (!yy_Spnl()) goto l1513;
+  l1516:;	
+  {  int yypos1517= yypos, yythunkpos1517= yythunkpos;  if (!yy_HtmlAttribute()) goto l1517;  goto l1516;
+  l1517:;	  yypos= yypos1517; yythunkpos= yythunkpos1517;
+  }  if (!yymatchChar('>')) goto l1513;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTfoot", yybuf+yypos));
+  return 1;
+  l1513:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTfoot", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockTd()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTd"));  if (!yy_HtmlBlockOpenTd()) goto l1518;
+  l1519:;	
+  {  int yypos1520= yypos, yythunkpos1520= yythunkpos;
+  {  int yypos1521= yypos, yythunkpos1521= yythunkpos;  if (!yy_HtmlBlockTd()) goto l1522;  goto l1521;
+  l1522:;	  yypos= yypos1521; yythunkpos= yythunkpos1521;
+  {  int yypos1523= yypos, yythunkpos1523= yythunkpos;  if (!yy_HtmlBlockCloseTd()) goto l1523;  goto l1520;
+  l1523:;	  yypos= yypos1523; yythunkpos= yythunkpos1523;
+  }  if (!yymatchDot()) goto l1520;
+  }
+  l1521:;	  goto l1519;
+  l1520:;	  yypos= yypos1520; yythunkpos= yythunkpos1520;
+  }  if (!yy_HtmlBlockCloseTd()) goto l1518;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTd", yybuf+yypos));
+  return 1;
+  l1518:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTd", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTd()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTd"));  if (!yymatchChar('<')) goto l1524;  if (!yy_Spnl()) goto l1524;  if (!yymatchChar('/')) goto l1524;
+  {  int yypos1525= yypos, yythunkpos1525= yythunkpos;  if (!yymatchString("td")) goto l1526;  goto l1525;
+  l1526:;	  yypos= yypos1525; yythunkpos= yythunkpos1525;  if (!yymatchString("TD")) goto l1524;
+  }
+  l1525:;	  if (!yy_Spnl()) goto l1524;  if (!yymatchChar('>')) goto l1524;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTd", yybuf+yypos));
+  return 1;
+  l1524:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTd", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTd()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTd"));  if (!yymatchChar('<')) goto l1527;  if (!yy_Spnl()) goto l1527;
+  {  int yypos1528= yypos, yythunkpos1528= yythunkpos;  if (!yymatchString("td")) goto l1529;  goto l1528;
+  l1529:;	  yypos= yypos1528; yythunkpos= yythunkpos1528;  if (!yymatchString("TD")) goto l1527;
+  }
+  l1528:;	  if (!yy_Spnl()) goto l1527;
+  l1530:;	
+  {  int yypos1531= yypos, yythunkpos1531= yythunkpos;  if (!yy_HtmlAttribute()) goto l1531;  goto l1530;
+  l1531:;	  yypos= yypos1531; yythunkpos= yythunkpos1531;
+  }  if (!yymatchChar('>')) goto l1527;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTd", yybuf+yypos));
+  return 1;
+  l1527:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTd", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockTbody()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTbody"));  if (!yy_HtmlBlockOpenTbody()) goto l1532;
+  l1533:;	
+  {  int yypos1534= yypos, yythunkpos1534= yythunkpos;
+  {  int yypos1535= yypos, yythunkpos1535= yythunkpos;  if (!yy_HtmlBlockTbody()) goto l1536;  goto l1535;
+  l1536:;	  yypos= yypos1535; yythunkpos= yythunkpos1535;
+  {  int yypos1537= yypos, yythunkpos1537= yythunkpos;  if (!yy_HtmlBlockCloseTbody()) goto l1537;  goto l1534;
+  l1537:;	  yypos= yypos1537; yythunkpos= yythunkpos1537;
+  }  if (!yymatchDot()) goto l1534;
+  }
+  l1535:;	  goto l1533;
+  l1534:;	  yypos= yypos1534; yythunkpos= yythunkpos1534;
+  }  if (!yy_HtmlBlockCloseTbody()) goto l1532;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTbody", yybuf+yypos));
+  return 1;
+  l1532:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTbody", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTbody()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTbody"));  if (!yymatchChar('<')) goto l1538;  if (!yy_Spnl()) goto l1538;  if (!yymatchChar('/')) goto l1538;
+  {  int yypos1539= yypos, yythunkpos1539= yythunkpos;  if (!yymatchString("tbody")) goto l1540;  goto l1539;
+  l1540:;	  yypos= yypos1539; yythunkpos= yythunkpos1539;  if (!yymatchString("TBODY")) goto l1538;
+  }
+  l1539:;	  if (!yy_Spnl()) goto l1538;  if (!yymatchChar('>')) goto l1538;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTbody", yybuf+yypos));
+  return 1;
+  l1538:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTbody", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTbody()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTbody"));  if (!yymatchChar('<')) goto l1541;  if (!yy_Spnl()) goto l1541;
+  {  int yypos1542= yypos, yythunkpos1542= yythunkpos;  if (!yymatchString("tbody")) goto l1543;  goto l1542;
+  l1543:;	  yypos= yypos1542; yythunkpos= yythunkpos1542;  if (!yymatchString("TBODY")) goto l1541;
+  }
+  l1542:;	  if (!yy_Spnl()) goto l1541;
+  l1544:;	
+  {  int yypos1545= yypos, yythunkpos1545= yythunkpos;  if (!yy_HtmlAttribute()) goto l1545;  goto l1544;
+  l1545:;	  yypos= yypos1545; yythunkpos= yythunkpos1545;
+  }  if (!yymatchChar('>')) goto l1541;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTbody", yybuf+yypos));
+  return 1;
+  l1541:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTbody", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockLi()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockLi"));  if (!yy_HtmlBlockOpenLi()) goto l1546;
+  l1547:;	
+  {  int yypos1548= yypos, yythunkpos1548= yythunkpos;
+  {  int yypos1549= yypos, yythunkpos1549= yythunkpos;  if (!yy_HtmlBlockLi()) goto l1550;  goto l1549;
+  l1550:;	  yypos= yypos1549; yythunkpos= yythunkpos1549;
+  {  int yypos1551= yypos, yythunkpos1551= yythunkpos;  if (!yy_HtmlBlockCloseLi()) goto l1551;  goto l1548;
+  l1551:;	  yypos= yypos1551; yythunkpos= yythunkpos1551;
+  }  if (!yymatchDot()) goto l1548;
+  }
+  l1549:;	  goto l1547;
+  l1548:;	  yypos= yypos1548; yythunkpos= yythunkpos1548;
+  }  if (!yy_HtmlBlockCloseLi()) goto l1546;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockLi", yybuf+yypos));
+  return 1;
+  l1546:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockLi", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseLi()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseLi"));  if (!yymatchChar('<')) goto l1552;  if (!yy_Spnl()) goto l1552;  if (!yymatchChar('/')) goto l1552;
+  {  int yypos1553= yypos, yythunkpos1553= yythunkpos;  if (!yymatchString("li")) goto l1554;  goto l1553;
+  l1554:;	  yypos= yypos1553; yythunkpos= yythunkpos1553;  if (!yymatchString("LI")) goto l1552;
+  }
+  l1553:;	  if (!yy_Spnl()) goto l1552;  if (!yymatchChar('>')) goto l1552;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseLi", yybuf+yypos));
+  return 1;
+  l1552:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseLi", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenLi()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenLi"));  if (!yymatchChar('<')) goto l1555;  if (!yy_Spnl()) goto l1555;
+  {  int yypos1556= yypos, yythunkpos1556= yythunkpos;  if (!yymatchString("li")) goto l1557;  goto l1556;
+  l1557:;	  yypos= yypos1556; yythunkpos= yythunkpos1556;  if (!yymatchString("LI")) goto l1555;
+  }
+  l1556:;	  if (!yy_Spnl()) goto l1555;
+  l1558:;	
+  {  int yypos1559= yypos, yythunkpos1559= yythunkpos;  if (!yy_HtmlAttribute()) goto l1559;  goto l1558;
+  l1559:;	  yypos= yypos1559; yythunkpos= yythunkpos1559;
+  }  if (!yymatchChar('>')) goto l1555;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenLi", yybuf+yypos));
+  return 1;
+  l1555:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenLi", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockFrameset()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockFrameset"));  if (!yy_HtmlBlockOpenFrameset()) goto l1560;
+  l1561:;	
+  {  int yypos1562= yypos, yythunkpos1562= yythunkpos;
+  {  int yypos1563= yypos, yythunkpos1563= yythunkpos;  if (!yy_HtmlBlockFrameset()) goto l1564;  goto l1563;
+  l1564:;	  yypos= yypos1563; yythunkpos= yythunkpos1563;
+  {  int yypos1565= yypos, yythunkpos1565= yythunkpos;  if (!yy_HtmlBlockCloseFrameset()) goto l1565;  goto l1562;
+  l1565:;	  yypos= yypos1565; yythunkpos= yythunkpos1565;
+  }  if (!yymatchDot()) goto l1562;
+  }
+  l1563:;	  goto l1561;
+  l1562:;	  yypos= yypos1562; yythunkpos= yythunkpos1562;
+  }  if (!yy_HtmlBlockCloseFrameset()) goto l1560;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockFrameset", yybuf+yypos));
+  return 1;
+  l1560:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockFrameset", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseFrameset()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseFrameset"));  if (!yymatchChar('<')) goto l1566;  if (!yy_Spnl()) goto l1566;  if (!yymatchChar('/')) goto l1566;
+  {  int yypos1567= yypos, yythunkpos1567= yythunkpos;  if (!yymatchString("frameset")) goto l1568;  goto l1567;
+  l1568:;	  yypos= yypos1567; yythunkpos= yythunkpos1567;  if (!yymatchString("FRAMESET")) goto l1566;
+  }
+  l1567:;	  if (!yy_Spnl()) goto l1566;  if (!yymatchChar('>')) goto l1566;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseFrameset", yybuf+yypos));
+  return 1;
+  l1566:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseFrameset", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenFrameset()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenFrameset"));  if (!yymatchChar('<')) goto l1569;  if (!yy_Spnl()) goto l1569;
+  {  int yypos1570= yypos, yythunkpos1570= yythunkpos;  if (!yymatchString("frameset")) goto l1571;  goto l1570;
+  l1571:;	  yypos= yypos1570; yythunkpos= yythunkpos1570;  if (!yymatchString("FRAMESET")) goto l1569;
+  }
+  l1570:;	  if (!yy_Spnl()) goto l1569;
+  l1572:;	
+  {  int yypos1573= yypos, yythunkpos1573= yythunkpos;  if (!yy_HtmlAttribute()) goto l1573;  goto l1572;
+  l1573:;	  yypos= yypos1573; yythunkpos= yythunkpos1573;
+  }  if (!yymatchChar('>')) goto l1569;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenFrameset", yybuf+yypos));
+  return 1;
+  l1569:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenFrameset", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockDt()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockDt"));  if (!yy_HtmlBlockOpenDt()) goto l1574;
+  l1575:;	
+  {  int yypos1576= yypos, yythunkpos1576= yythunkpos;
+  {  int yypos1577= yypos, yythunkpos1577= yythunkpos;  if (!yy_HtmlBlockDt()) goto l1578;  goto l1577;
+  l1578:;	  yypos= yypos1577; yythunkpos= yythunkpos1577;
+  {  int yypos1579= yypos, yythunkpos1579= yythunkpos;  if (!yy_HtmlBlockCloseDt()) goto l1579;  goto l1576;
+  l1579:;	  yypos= yypos1579; yythunkpos= yythunkpos1579;
+  }  if (!yymatchDot()) goto l1576;
+  }
+  l1577:;	  goto l1575;
+  l1576:;	  yypos= yypos1576; yythunkpos= yythunkpos1576;
+  }  if (!yy_HtmlBlockCloseDt()) goto l1574;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockDt", yybuf+yypos));
+  return 1;
+  l1574:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockDt", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseDt()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseDt"));  if (!yymatchChar('<')) goto l1580;  if (!yy_Spnl()) goto l1580;  if (!yymatchChar('/')) goto l1580;
+  {  int yypos1581= yypos, yythunkpos1581= yythunkpos;  if (!yymatchString("dt")) goto l1582;  goto l1581;
+  l1582:;	  yypos= yypos1581; yythunkpos= yythunkpos1581;  if (!yymatchString("DT")) goto l1580;
+  }
+  l1581:;	  if (!yy_Spnl()) goto l1580;  if (!yymatchChar('>')) goto l1580;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseDt", yybuf+yypos));
+  return 1;
+  l1580:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseDt", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenDt()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenDt"));  if (!yymatchChar('<')) goto l1583;  if (!yy_Spnl()) goto l1583;
+  {  int yypos1584= yypos, yythunkpos1584= yythunkpos;  if (!yymatchString("dt")) goto l1585;  goto l1584;
+  l1585:;	  yypos= yypos1584; yythunkpos= yythunkpos1584;  if (!yymatchString("DT")) goto l1583;
+  }
+  l1584:;	  if (!yy_Spnl()) goto l1583;
+  l1586:;	
+  {  int yypos1587= yypos, yythunkpos1587= yythunkpos;  if (!yy_HtmlAttribute()) goto l1587;  goto l1586;
+  l1587:;	  yypos= yypos1587; yythunkpos= yythunkpos1587;
+  }  if (!yymatchChar('>')) goto l1583;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenDt", yybuf+yypos));
+  return 1;
+  l1583:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenDt", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockDd()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockDd"));  if (!yy_HtmlBlockOpenDd()) goto l1588;
+  l1589:;	
+  {  int yypos1590= yypos, yythunkpos1590= yythunkpos;
+  {  int yypos1591= yypos, yythunkpos1591= yythunkpos;  if (!yy_HtmlBlockDd()) goto l1592;  goto l1591;
+  l1592:;	  yypos= yypos1591; yythunkpos= yythunkpos1591;
+  {  int yypos1593= yypos, yythunkpos1593= yythunkpos;  if (!yy_HtmlBlockCloseDd()) goto l1593;  goto l1590;
+  l1593:;	  yypos= yypos1593; yythunkpos= yythunkpos1593;
+  }  if (!yymatchDot()) goto l1590;
+  }
+  l1591:;	  goto l1589;
+  l1590:;	  yypos= yypos1590; yythunkpos= yythunkpos1590;
+  }  if (!yy_HtmlBlockCloseDd()) goto l1588;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockDd", yybuf+yypos));
+  return 1;
+  l1588:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockDd", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseDd()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseDd"));  if (!yymatchChar('<')) goto l1594;  if (!yy_Spnl()) goto l1594;  if (!yymatchChar('/')) goto l1594;
+  {  int yypos1595= yypos, yythunkpos1595= yythunkpos;  if (!yymatchString("dd")) goto l1596;  goto l1595;
+  l1596:;	  yypos= yypos1595; yythunkpos= yythunkpos1595;  if (!yymatchString("DD")) goto l1594;
+  }
+  l1595:;	  if (!yy_Spnl()) goto l1594;  if (!yymatchChar('>')) goto l1594;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseDd", yybuf+yypos));
+  return 1;
+  l1594:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseDd", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenDd()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenDd"));  if (!yymatchChar('<')) goto l1597;  if (!yy_Spnl()) goto l1597;
+  {  int yypos1598= yypos, yythunkpos1598= yythunkpos;  if (!yymatchString("dd")) goto l1599;  goto l1598;
+  l1599:;	  yypos= yypos1598; yythunkpos= yythunkpos1598;  if (!yymatchString("DD")) goto l1597;
+  }
+  l1598:;	  if (!yy_Spnl()) goto l1597;
+  l1600:;	
+  {  int yypos1601= yypos, yythunkpos1601= yythunkpos;  if (!yy_HtmlAttribute()) goto l1601;  goto l1600;
+  l1601:;	  yypos= yypos1601; yythunkpos= yythunkpos1601;
+  }  if (!yymatchChar('>')) goto l1597;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenDd", yybuf+yypos));
+  return 1;
+  l1597:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenDd", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockVideo()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockVideo"));  if (!yy_HtmlBlockOpenVideo()) goto l1602;
+  l1603:;	
+  {  int yypos1604= yypos, yythunkpos1604= yythunkpos;
+  {  int yypos1605= yypos, yythunkpos1605= yythunkpos;  if (!yy_HtmlBlockVideo()) goto l1606;  goto l1605;
+  l1606:;	  yypos= yypos1605; yythunkpos= yythunkpos1605;
+  {  int yypos1607= yypos, yythunkpos1607= yythunkpos;  if (!yy_HtmlBlockCloseVideo()) goto l1607;  goto l1604;
+  l1607:;	  yypos= yypos1607; yythunkpos= yythunkpos1607;
+  }  if (!yymatchDot()) goto l1604;
+  }
+  l1605:;	  goto l1603;
+  l1604:;	  yypos= yypos1604; yythunkpos= yythunkpos1604;
+  }  if (!yy_HtmlBlockCloseVideo()) goto l1602;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockVideo", yybuf+yypos));
+  return 1;
+  l1602:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockVideo", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseVideo()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseVideo"));  if (!yymatchChar('<')) goto l1608;  if (!yy_Spnl()) goto l1608;  if (!yymatchChar('/')) goto l1608;
+  {  int yypos1609= yypos, yythunkpos1609= yythunkpos;  if (!yymatchString("video")) goto l1610;  goto l1609;
+  l1610:;	  yypos= yypos1609; yythunkpos= yythunkpos1609;  if (!yymatchString("VIDEO")) goto l1608;
+  }
+  l1609:;	  if (!yy_Spnl()) goto l1608;  if (!yymatchChar('>')) goto l1608;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseVideo", yybuf+yypos));
+  return 1;
+  l1608:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseVideo", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenVideo()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenVideo"));  if (!yymatchChar('<')) goto l1611;  if (!yy_Spnl()) goto l1611;
+  {  int yypos1612= yypos, yythunkpos1612= yythunkpos;  if (!yymatchString("video")) goto l1613;  goto l1612;
+  l1613:;	  yypos= yypos1612; yythunkpos= yythunkpos1612;  if (!yymatchString("VIDEO")) goto l1611;
+  }
+  l1612:;	  if (!yy_Spnl()) goto l1611;
+  l1614:;	
+  {  int yypos1615= yypos, yythunkpos1615= yythunkpos;  if (!yy_HtmlAttribute()) goto l1615;  goto l1614;
+  l1615:;	  yypos= yypos1615; yythunkpos= yythunkpos1615;
+  }  if (!yymatchChar('>')) goto l1611;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenVideo", yybuf+yypos));
+  return 1;
+  l1611:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenVideo", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockUl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockUl"));  if (!yy_HtmlBlockOpenUl()) goto l1616;
+  l1617:;	
+  {  int yypos1618= yypos, yythunkpos1618= yythunkpos;
+  {  int yypos1619= yypos, yythunkpos1619= yythunkpos;  if (!yy_HtmlBlockUl()) goto l1620;  goto l1619;
+  l1620:;	  yypos= yypos1619; yythunkpos= yythunkpos1619;
+  {  int yypos1621= yypos, yythunkpos1621= yythunkpos;  if (!yy_HtmlBlockCloseUl()) goto l1621;  goto l1618;
+  l1621:;	  yypos= yypos1621; yythunkpos= yythunkpos1621;
+  }  if (!yymatchDot()) goto l1618;
+  }
+  l1619:;	  goto l1617;
+  l1618:;	  yypos= yypos1618; yythunkpos= yythunkpos1618;
+  }  if (!yy_HtmlBlockCloseUl()) goto l1616;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockUl", yybuf+yypos));
+  return 1;
+  l1616:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockUl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseUl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseUl"));  if (!yymatchChar('<')) goto l1622;  if (!yy_Spnl()) goto l1622;  if (!yymatchChar('/')) goto l1622;
+  {  int yypos1623= yypos, yythunkpos1623= yythunkpos;  if (!yymatchString("ul")) goto l1624;  goto l1623;
+  l1624:;	  yypos= yypos1623; yythunkpos= yythunkpos1623;  if (!yymatchString("UL")) goto l1622;
+  }
+  l1623:;	  if (!yy_Spnl()) goto l1622;  if (!yymatchChar('>')) goto l1622;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseUl", yybuf+yypos));
+  return 1;
+  l1622:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseUl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenUl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenUl"));  if (!yymatchChar('<')) goto l1625;  if (!yy_Spnl()) goto l1625;
+  {  int yypos1626= yypos, yythunkpos1626= yythunkpos;  if (!yymatchString("ul")) goto l1627;  goto l1626;
+  l1627:;	  yypos= yypos1626; yythunkpos= yythunkpos1626;  if (!yymatchString("UL")) goto l1625;
+  }
+  l1626:;	  if (!yy_Spnl()) goto l1625;
+  l1628:;	
+  {  int yypos1629= yypos, yythunkpos1629= yythunkpos;  if (!yy_HtmlAttribute()) goto l1629;  goto l1628;
+  l1629:;	  yypos= yypos1629; yythunkpos= yythunkpos1629;
+  }  if (!yymatchChar('>')) goto l1625;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenUl", yybuf+yypos));
+  return 1;
+  l1625:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenUl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockTable()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTable"));  if (!yy_HtmlBlockOpenTable()) goto l1630;
+  l1631:;	
+  {  int yypos1632= yypos, yythunkpos1632= yythunkpos;
+  {  int yypos1633= yypos, yythunkpos1633= yythunkpos;  if (!yy_HtmlBlockTable()) goto l1634;  goto l1633;
+  l1634:;	  yypos= yypos1633; yythunkpos= yythunkpos1633;
+  {  int yypos1635= yypos, yythunkpos1635= yythunkpos;  if (!yy_HtmlBlockCloseTable()) goto l1635;  goto l1632;
+  l1635:;	  yypos= yypos1635; yythunkpos= yythunkpos1635;
+  }  if (!yymatchDot()) goto l1632;
+  }
+  l1633:;	  goto l1631;
+  l1632:;	  yypos= yypos1632; yythunkpos= yythunkpos1632;
+  }  if (!yy_HtmlBlockCloseTable()) goto l1630;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTable", yybuf+yypos));
+  return 1;
+  l1630:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTable", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseTable()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTable"));  if (!yymatchChar('<')) goto l1636;  if (!yy_Spnl()) goto l1636;  if (!yymatchChar('/')) goto l1636;
+  {  int yypos1637= yypos, yythunkpos1637= yythunkpos;  if (!yymatchString("table")) goto l1638;  goto l1637;
+  l1638:;	  yypos= yypos1637; yythunkpos= yythunkpos1637;  if (!yymatchString("TABLE")) goto l1636;
+  }
+  l1637:;	  if (!yy_Spnl()) goto l1636;  if (!yymatchChar('>')) goto l1636;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTable", yybuf+yypos));
+  return 1;
+  l1636:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTable", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenTable()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTable"));  if (!yymatchChar('<')) goto l1639;  if (!yy_Spnl()) goto l1639;
+  {  int yypos1640= yypos, yythunkpos1640= yythunkpos;  if (!yymatchString("table")) goto l1641;  goto l1640;
+  l1641:;	  yypos= yypos1640; yythunkpos= yythunkpos1640;  if (!yymatchString("TABLE")) goto l1639;
+  }
+  l1640:;	  if (!yy_Spnl()) goto l1639;
+  l1642:;	
+  {  int yypos1643= yypos, yythunkpos1643= yythunkpos;  if (!yy_HtmlAttribute()) goto l1643;  goto l1642;
+  l1643:;	  yypos= yypos1643; yythunkpos= yythunkpos1643;
+  }  if (!yymatchChar('>')) goto l1639;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTable", yybuf+yypos));
+  return 1;
+  l1639:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTable", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockSection()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockSection"));  if (!yy_HtmlBlockOpenSection()) goto l1644;
+  l1645:;	
+  {  int yypos1646= yypos, yythunkpos1646= yythunkpos;
+  {  int yypos1647= yypos, yythunkpos1647= yythunkpos;  if (!yy_HtmlBlockSection()) goto l1648;  goto l1647;
+  l1648:;	  yypos= yypos1647; yythunkpos= yythunkpos1647;
+  {  int yypos1649= yypos, yythunkpos1649= yythunkpos;  if (!yy_HtmlBlockCloseSection()) goto l1649;  goto l1646;
+  l1649:;	  yypos= yypos1649; yythunkpos= yythunkpos1649;
+  }  if (!yymatchDot()) goto l1646;
+  }
+  l1647:;	  goto l1645;
+  l1646:;	  yypos= yypos1646; yythunkpos= yythunkpos1646;
+  }  if (!yy_HtmlBlockCloseSection()) goto l1644;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockSection", yybuf+yypos));
+  return 1;
+  l1644:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockSection", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseSection()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseSection"));  if (!yymatchChar('<')) goto l1650;  if (!yy_Spnl()) goto l1650;  if (!yymatchChar('/')) goto l1650;
+  {  int yypos1651= yypos, yythunkpos1651= yythunkpos;  if (!yymatchString("section")) goto l1652;  goto l1651;
+  l1652:;	  yypos= yypos1651; yythunkpos= yythunkpos1651;  if (!yymatchString("SECTION")) goto l1650;
+  }
+  l1651:;	  if (!yy_Spnl()) goto l1650;  if (!yymatchChar('>')) goto l1650;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseSection", yybuf+yypos));
+  return 1;
+  l1650:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseSection", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenSection()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenSection"));  if (!yymatchChar('<')) goto l1653;  if (!yy_Spnl()) goto l1653;
+  {  int yypos1654= yypos, yythunkpos1654= yythunkpos;  if (!yymatchString("section")) goto l1655;  goto l1654;
+  l1655:;	  yypos= yypos1654; yythunkpos= yythunkpos1654;  if (!yymatchString("SECTION")) goto l1653;
+  }
+  l1654:;	  if (!yy_Spnl()) goto l1653;
+  l1656:;	
+  {  int yypos1657= yypos, yythunkpos1657= yythunkpos;  if (!yy_HtmlAttribute()) goto l1657;  goto l1656;
+  l1657:;	  yypos= yypos1657; yythunkpos= yythunkpos1657;
+  }  if (!yymatchChar('>')) goto l1653;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenSection", yybuf+yypos));
+  return 1;
+  l1653:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenSection", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockProgress()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockProgress"));  if (!yy_HtmlBlockOpenProgress()) goto l1658;
+  l1659:;	
+  {  int yypos1660= yypos, yythunkpos1660= yythunkpos;
+  {  int yypos1661= yypos, yythunkpos1661= yythunkpos;  if (!yy_HtmlBlockProgress()) goto l1662;  goto l1661;
+  l1662:;	  yypos= yypos1661; yythunkpos= yythunkpos1661;
+  {  int yypos1663= yypos, yythunkpos1663= yythunkpos;  if (!yy_HtmlBlockCloseProgress()) goto l1663;  goto l1660;
+  l1663:;	  yypos= yypos1663; yythunkpos= yythunkpos1663;
+  }  if (!yymatchDot()) goto l1660;
+  }
+  l1661:;	  goto l1659;
+  l1660:;	  yypos= yypos1660; yythunkpos= yythunkpos1660;
+  }  if (!yy_HtmlBlockCloseProgress()) goto l1658;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockProgress", yybuf+yypos));
+  return 1;
+  l1658:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockProgress", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseProgress()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseProgress"));  if (!yymatchChar('<')) goto l1664;  if (!yy_Spnl()) goto l1664;  if (!yymatchChar('/')) goto l1664;
+  {  int yypos1665= yypos, yythunkpos1665= yythunkpos;  if (!yymatchString("progress")) goto l1666;  goto l1665;
+  l1666:;	  yypos= yypos1665; yythunkpos= yythunkpos1665;  if (!yymatchString("PROGRESS")) goto l1664;
+  }
+  l1665:;	  if (!yy_Spnl()) goto l1664;  if (!yymatchChar('>')) goto l1664;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseProgress", yybuf+yypos));
+  return 1;
+  l1664:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseProgress", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenProgress()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenProgress"));  if (!yymatchChar('<')) goto l1667;  if (!yy_Spnl()) goto l1667;
+  {  int yypos1668= yypos, yythunkpos1668= yythunkpos;  if (!yymatchString("progress")) goto l1669;  goto l1668;
+  l1669:;	  yypos= yypos1668; yythunkpos= yythunkpos1668;  if (!yymatchString("PROGRESS")) goto l1667;
+  }
+  l1668:;	  if (!yy_Spnl()) goto l1667;
+  l1670:;	
+  {  int yypos1671= yypos, yythunkpos1671= yythunkpos;  if (!yy_HtmlAttribute()) goto l1671;  goto l1670;
+  l1671:;	  yypos= yypos1671; yythunkpos= yythunkpos1671;
+  }  if (!yymatchChar('>')) goto l1667;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenProgress", yybuf+yypos));
+  return 1;
+  l1667:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenProgress", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockPre()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockPre"));  if (!yy_HtmlBlockOpenPre()) goto l1672;
+  l1673:;	
+  {  int yypos1674= yypos, yythunkpos1674= yythunkpos;
+  {  int yypos1675= yypos, yythunkpos1675= yythunkpos;  if (!yy_HtmlBlockPre()) goto l1676;  goto l1675;
+  l1676:;	  yypos= yypos1675; yythunkpos= yythunkpos1675;
+  {  int yypos1677= yypos, yythunkpos1677= yythunkpos;  if (!yy_HtmlBlockClosePre()) goto l1677;  goto l1674;
+  l1677:;	  yypos= yypos1677; yythunkpos= yythunkpos1677;
+  }  if (!yymatchDot()) goto l1674;
+  }
+  l1675:;	  goto l1673;
+  l1674:;	  yypos= yypos1674; yythunkpos= yythunkpos1674;
+  }  if (!yy_HtmlBlockClosePre()) goto l1672;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockPre", yybuf+yypos));
+  return 1;
+  l1672:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockPre", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockClosePre()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockClosePre"));  if (!yymatchChar('<')) goto l1678;  if (!yy_Spnl()) goto l1678;  if (!yymatchChar('/')) goto l1678;
+  {  int yypos1679= yypos, yythunkpos1679= yythunkpos;  if (!yymatchString("pre")) goto l1680;  goto l1679;
+  l1680:;	  yypos= yypos1679; yythunkpos= yythunkpos1679;  if (!yymatchString("PRE")) goto l1678;
+  }
+  l1679:;	  if (!yy_Spnl()) goto l1678;  if (!yymatchChar('>')) goto l1678;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockClosePre", yybuf+yypos));
+  return 1;
+  l1678:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockClosePre", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenPre()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenPre"));  if (!yymatchChar('<')) goto l1681;  if (!yy_Spnl()) goto l1681;
+  {  int yypos1682= yypos, yythunkpos1682= yythunkpos;  if (!yymatchString("pre")) goto l1683;  goto l1682;
+  l1683:;	  yypos= yypos1682; yythunkpos= yythunkpos1682;  if (!yymatchString("PRE")) goto l1681;
+  }
+  l1682:;	  if (!yy_Spnl()) goto l1681;
+  l1684:;	
+  {  int yypos1685= yypos, yythunkpos1685= yythunkpos;  if (!yy_HtmlAttribute()) goto l1685;  goto l1684;
+  l1685:;	  yypos= yypos1685; yythunkpos= yythunkpos1685;
+  }  if (!yymatchChar('>')) goto l1681;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenPre", yybuf+yypos));
+  return 1;
+  l1681:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenPre", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockP()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockP"));  if (!yy_HtmlBlockOpenP()) goto l1686;
+  l1687:;	
+  {  int yypos1688= yypos, yythunkpos1688= yythunkpos;
+  {  int yypos1689= yypos, yythunkpos1689= yythunkpos;  if (!yy_HtmlBlockP()) goto l1690;  goto l1689;
+  l1690:;	  yypos= yypos1689; yythunkpos= yythunkpos1689;
+  {  int yypos1691= yypos, yythunkpos1691= yythunkpos;  if (!yy_HtmlBlockCloseP()) goto l1691;  goto l1688;
+  l1691:;	  yypos= yypos1691; yythunkpos= yythunkpos1691;
+  }  if (!yymatchDot()) goto l1688;
+  }
+  l1689:;	  goto l1687;
+  l1688:;	  yypos= yypos1688; yythunkpos= yythunkpos1688;
+  }  if (!yy_HtmlBlockCloseP()) goto l1686;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockP", yybuf+yypos));
+  return 1;
+  l1686:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockP", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseP()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseP"));  if (!yymatchChar('<')) goto l1692;  if (!yy_Spnl()) goto l1692;  if (!yymatchChar('/')) goto l1692;
+  {  int yypos1693= yypos, yythunkpos1693= yythunkpos;  if (!yymatchChar('p')) goto l1694;  goto l1693;
+  l1694:;	  yypos= yypos1693; yythunkpos= yythunkpos1693;  if (!yymatchChar('P')) goto l1692;
+  }
+  l1693:;	  if (!yy_Spnl()) goto l1692;  if (!yymatchChar('>')) goto l1692;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseP", yybuf+yypos));
+  return 1;
+  l1692:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseP", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenP()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenP"));  if (!yymatchChar('<')) goto l1695;  if (!yy_Spnl()) goto l1695;
+  {  int yypos1696= yypos, yythunkpos1696= yythunkpos;  if (!yymatchChar('p')) goto l1697;  goto l1696;
+  l1697:;	  yypos= yypos1696; yythunkpos= yythunkpos1696;  if (!yymatchChar('P')) goto l1695;
+  }
+  l1696:;	  if (!yy_Spnl()) goto l1695;
+  l1698:;	
+  {  int yypos1699= yypos, yythunkpos1699= yythunkpos;  if (!yy_HtmlAttribute()) goto l1699;  goto l1698;
+  l1699:;	  yypos= yypos1699; yythunkpos= yythunkpos1699;
+  }  if (!yymatchChar('>')) goto l1695;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenP", yybuf+yypos));
+  return 1;
+  l1695:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenP", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOl"));  if (!yy_HtmlBlockOpenOl()) goto l1700;
+  l1701:;	
+  {  int yypos1702= yypos, yythunkpos1702= yythunkpos;
+  {  int yypos1703= yypos, yythunkpos1703= yythunkpos;  if (!yy_HtmlBlockOl()) goto l1704;  goto l1703;
+  l1704:;	  yypos= yypos1703; yythunkpos= yythunkpos1703;
+  {  int yypos1705= yypos, yythunkpos1705= yythunkpos;  if (!yy_HtmlBlockCloseOl()) goto l1705;  goto l1702;
+  l1705:;	  yypos= yypos1705; yythunkpos= yythunkpos1705;
+  }  if (!yymatchDot()) goto l1702;
+  }
+  l1703:;	  goto l1701;
+  l1702:;	  yypos= yypos1702; yythunkpos= yythunkpos1702;
+  }  if (!yy_HtmlBlockCloseOl()) goto l1700;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOl", yybuf+yypos));
+  return 1;
+  l1700:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseOl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseOl"));  if (!yymatchChar('<')) goto l1706;  if (!yy_Spnl()) goto l1706;  if (!yymatchChar('/')) goto l1706;
+  {  int yypos1707= yypos, yythunkpos1707= yythunkpos;  if (!yymatchString("ol")) goto l1708;  goto l1707;
+  l1708:;	  yypos= yypos1707; yythunkpos= yythunkpos1707;  if (!yymatchString("OL")) goto l1706;
+  }
+  l1707:;	  if (!yy_Spnl()) goto l1706;  if (!yymatchChar('>')) goto l1706;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseOl", yybuf+yypos));
+  return 1;
+  l1706:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseOl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenOl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenOl"));  if (!yymatchChar('<')) goto l1709;  if (!yy_Spnl()) goto l1709;
+  {  int yypos1710= yypos, yythunkpos1710= yythunkpos;  if (!yymatchString("ol")) goto l1711;  goto l1710;
+  l1711:;	  yypos= yypos1710; yythunkpos= yythunkpos1710;  if (!yymatchString("OL")) goto l1709;
+  }
+  l1710:;	  if (!yy_Spnl()) goto l1709;
+  l1712:;	
+  {  int yypos1713= yypos, yythunkpos1713= yythunkpos;  if (!yy_HtmlAttribute()) goto l1713;  goto l1712;
+  l1713:;	  yypos= yypos1713; yythunkpos= yythunkpos1713;
+  }  if (!yymatchChar('>')) goto l1709;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenOl", yybuf+yypos));
+  return 1;
+  l1709:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenOl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockNoscript()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockNoscript"));  if (!yy_HtmlBlockOpenNoscript()) goto l1714;
+  l1715:;	
+  {  int yypos1716= yypos, yythunkpos1716= yythunkpos;
+  {  int yypos1717= yypos, yythunkpos1717= yythunkpos;  if (!yy_HtmlBlockNoscript()) goto l1718;  goto l1717;
+  l1718:;	  yypos= yypos1717; yythunkpos= yythunkpos1717;
+  {  int yypos1719= yypos, yythunkpos1719= yythunkpos;  if (!yy_HtmlBlockCloseNoscript()) goto l1719;  goto l1716;
+  l1719:;	  yypos= yypos1719; yythunkpos= yythunkpos1719;
+  }  if (!yymatchDot()) goto l1716;
+  }
+  l1717:;	  goto l1715;
+  l1716:;	  yypos= yypos1716; yythunkpos= yythunkpos1716;
+  }  if (!yy_HtmlBlockCloseNoscript()) goto l1714;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockNoscript", yybuf+yypos));
+  return 1;
+  l1714:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockNoscript", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseNoscript()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseNoscript"));  if (!yymatchChar('<')) goto l1720;  if (!yy_Spnl()) goto l1720;  if (!yymatchChar('/')) goto l1720;
+  {  int yypos1721= yypos, yythunkpos1721= yythunkpos;  if (!yymatchString("noscript")) goto l1722;  goto l1721;
+  l1722:;	  yypos= yypos1721; yythunkpos= yythunkpos1721;  if (!yymatchString("NOSCRIPT")) goto l1720;
+  }
+  l1721:;	  if (!yy_Spnl()) goto l1720;  if (!yymatchChar('>')) goto l1720;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseNoscript", yybuf+yypos));
+  return 1;
+  l1720:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseNoscript", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenNoscript()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenNoscript"));  if (!yymatchChar('<')) goto l1723;  if (!yy_Spnl()) goto l1723;
+  {  int yypos1724= yypos, yythunkpos1724= yythunkpos;  if (!yymatchString("noscript")) goto l1725;  goto l1724;
+  l1725:;	  yypos= yypos1724; yythunkpos= yythunkpos1724;  if (!yymatchString("NOSCRIPT")) goto l1723;
+  }
+  l1724:;	  if (!yy_Spnl()) goto l1723;
+  l1726:;	
+  {  int yypos1727= yypos, yythunkpos1727= yythunkpos;  if (!yy_HtmlAttribute()) goto l1727;  goto l1726;
+  l1727:;	  yypos= yypos1727; yythunkpos= yythunkpos1727;
+  }  if (!yymatchChar('>')) goto l1723;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenNoscript", yybuf+yypos));
+  return 1;
+  l1723:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenNoscript", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockNoframes()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockNoframes"));  if (!yy_HtmlBlockOpenNoframes()) goto l1728;
+  l1729:;	
+  {  int yypos1730= yypos, yythunkpos1730= yythunkpos;
+  {  int yypos1731= yypos, yythunkpos1731= yythunkpos;  if (!yy_HtmlBlockNoframes()) goto l1732;  goto l1731;
+  l1732:;	  yypos= yypos1731; yythunkpos= yythunkpos1731;
+  {  int yypos1733= yypos, yythunkpos1733= yythunkpos;  if (!yy_HtmlBlockCloseNoframes()) goto l1733;  goto l1730;
+  l1733:;	  yypos= yypos1733; yythunkpos= yythunkpos1733;
+  }  if (!yymatchDot()) goto l1730;
+  }
+  l1731:;	  goto l1729;
+  l1730:;	  yypos= yypos1730; yythunkpos= yythunkpos1730;
+  }  if (!yy_HtmlBlockCloseNoframes()) goto l1728;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockNoframes", yybuf+yypos));
+  return 1;
+  l1728:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockNoframes", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseNoframes()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseNoframes"));  if (!yymatchChar('<')) goto l1734;  if (!yy_Spnl()) goto l1734;  if (!yymatchChar('/')) goto l1734;
+  {  int yypos1735= yypos, yythunkpos1735= yythunkpos;  if (!yymatchString("noframes")) goto l1736;  goto l1735;
+  l1736:;	  yypos= yypos1735; yythunkpos= yythunkpos1735;  if (!yymatchString("NOFRAMES")) goto l1734;
+  }
+  l1735:;	  if (!yy_Spnl()) goto l1734;  if (!yymatchChar('>')) goto l1734;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseNoframes", yybuf+yypos));
+  return 1;
+  l1734:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseNoframes", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenNoframes()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenNoframes"));  if (!yymatchChar('<')) goto l1737;  if (!yy_Spnl()) goto l1737;
+  {  int yypos1738= yypos, yythunkpos1738= yythunkpos;  if (!yymatchString("noframes")) goto l1739;  goto l1738;
+  l1739:;	  yypos= yypos1738; yythunkpos= yythunkpos1738;  if (!yymatchString("NOFRAMES")) goto l1737;
+  }
+  l1738:;	  if (!yy_Spnl()) goto l1737;
+  l1740:;	
+  {  int yypos1741= yypos, yythunkpos1741= yythunkpos;  if (!yy_HtmlAttribute()) goto l1741;  goto l1740;
+  l1741:;	  yypos= yypos1741; yythunkpos= yythunkpos1741;
+  }  if (!yymatchChar('>')) goto l1737;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenNoframes", yybuf+yypos));
+  return 1;
+  l1737:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenNoframes", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockMenu()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockMenu"));  if (!yy_HtmlBlockOpenMenu()) goto l1742;
+  l1743:;	
+  {  int yypos1744= yypos, yythunkpos1744= yythunkpos;
+  {  int yypos1745= yypos, yythunkpos1745= yythunkpos;  if (!yy_HtmlBlockMenu()) goto l1746;  goto l1745;
+  l1746:;	  yypos= yypos1745; yythunkpos= yythunkpos1745;
+  {  int yypos1747= yypos, yythunkpos1747= yythunkpos;  if (!yy_HtmlBlockCloseMenu()) goto l1747;  goto l1744;
+  l1747:;	  yypos= yypos1747; yythunkpos= yythunkpos1747;
+  }  if (!yymatchDot()) goto l1744;
+  }
+  l1745:;	  goto l1743;
+  l1744:;	  yypos= yypos1744; yythunkpos= yythunkpos1744;
+  }  if (!yy_HtmlBlockCloseMenu()) goto l1742;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockMenu", yybuf+yypos));
+  return 1;
+  l1742:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockMenu", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseMenu()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseMenu"));  if (!yymatchChar('<')) goto l1748;  if (!yy_Spnl()) goto l1748;  if (!yymatchChar('/')) goto l1748;
+  {  int yypos1749= yypos, yythunkpos1749= yythunkpos;  if (!yymatchString("menu")) goto l1750;  goto l1749;
+  l1750:;	  yypos= yypos1749; yythunkpos= yythunkpos1749;  if (!yymatchString("MENU")) goto l1748;
+  }
+  l1749:;	  if (!yy_Spnl()) goto l1748;  if (!yymatchChar('>')) goto l1748;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseMenu", yybuf+yypos));
+  return 1;
+  l1748:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseMenu", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenMenu()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenMenu"));  if (!yymatchChar('<')) goto l1751;  if (!yy_Spnl()) goto l1751;
+  {  int yypos1752= yypos, yythunkpos1752= yythunkpos;  if (!yymatchString("menu")) goto l1753;  goto l1752;
+  l1753:;	  yypos= yypos1752; yythunkpos= yythunkpos1752;  if (!yymatchString("MENU")) goto l1751;
+  }
+  l1752:;	  if (!yy_Spnl()) goto l1751;
+  l1754:;	
+  {  int yypos1755= yypos, yythunkpos1755= yythunkpos;  if (!yy_HtmlAttribute()) goto l1755;  goto l1754;
+  l1755:;	  yypos= yypos1755; yythunkpos= yythunkpos1755;
+  }  if (!yymatchChar('>')) goto l1751;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenMenu", yybuf+yypos));
+  return 1;
+  l1751:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenMenu", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockH6()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH6"));  if (!yy_HtmlBlockOpenH6()) goto l1756;
+  l1757:;	
+  {  int yypos1758= yypos, yythunkpos1758= yythunkpos;
+  {  int yypos1759= yypos, yythunkpos1759= yythunkpos;  if (!yy_HtmlBlockH6()) goto l1760;  goto l1759;
+  l1760:;	  yypos= yypos1759; yythunkpos= yythunkpos1759;
+  {  int yypos1761= yypos, yythunkpos1761= yythunkpos;  if (!yy_HtmlBlockCloseH6()) goto l1761;  goto l1758;
+  l1761:;	  yypos= yypos1761; yythunkpos= yythunkpos1761;
+  }  if (!yymatchDot()) goto l1758;
+  }
+  l1759:;	  goto l1757;
+  l1758:;	  yypos= yypos1758; yythunkpos= yythunkpos1758;
+  }  if (!yy_HtmlBlockCloseH6()) goto l1756;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH6", yybuf+yypos));
+  return 1;
+  l1756:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH6", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH6()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH6"));  if (!yymatchChar('<')) goto l1762;  if (!yy_Spnl()) goto l1762;  if (!yymatchChar('/')) goto l1762;
+  {  int yypos1763= yypos, yythunkpos1763= yythunkpos;  if (!yymatchString("h6")) goto l1764;  goto l1763;
+  l1764:;	  yypos= yypos1763; yythunkpos= yythunkpos1763;  if (!yymatchString("H6")) goto l1762;
+  }
+  l1763:;	  if (!yy_Spnl()) goto l1762;  if (!yymatchChar('>')) goto l1762;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH6", yybuf+yypos));
+  return 1;
+  l1762:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH6", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH6()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH6"));  if (!yymatchChar('<')) goto l1765;  if (!yy_Spnl()) goto l1765;
+  {  int yypos1766= yypos, yythunkpos1766= yythunkpos;  if (!yymatchString("h6")) goto l1767;  goto l1766;
+  l1767:;	  yypos= yypos1766; yythunkpos= yythunkpos1766;  if (!yymatchString("H6")) goto l1765;
+  }
+  l1766:;	  if (!yy_Spnl()) goto l1765;
+  l1768:;	
+  {  int yypos1769= yypos, yythunkpos1769= yythunkpos;  if (!yy_HtmlAttribute()) goto l1769;  goto l1768;
+  l1769:;	  yypos= yypos1769; yythunkpos= yythunkpos1769;
+  }  if (!yymatchChar('>')) goto l1765;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH6", yybuf+yypos));
+  return 1;
+  l1765:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH6", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockH5()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH5"));  if (!yy_HtmlBlockOpenH5()) goto l1770;
+  l1771:;	
+  {  int yypos1772= yypos, yythunkpos1772= yythunkpos;
+  {  int yypos1773= yypos, yythunkpos1773= yythunkpos;  if (!yy_HtmlBlockH5()) goto l1774;  goto l1773;
+  l1774:;	  yypos= yypos1773; yythunkpos= yythunkpos1773;
+  {  int yypos1775= yypos, yythunkpos1775= yythunkpos;  if (!yy_HtmlBlockCloseH5()) goto l1775;  goto l1772;
+  l1775:;	  yypos= yypos1775; yythunkpos= yythunkpos1775;
+  }  if (!yymatchDot()) goto l1772;
+  }
+  l1773:;	  goto l1771;
+  l1772:;	  yypos= yypos1772; yythunkpos= yythunkpos1772;
+  }  if (!yy_HtmlBlockCloseH5()) goto l1770;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH5", yybuf+yypos));
+  return 1;
+  l1770:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH5", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH5()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH5"));  if (!yymatchChar('<')) goto l1776;  if (!yy_Spnl()) goto l1776;  if (!yymatchChar('/')) goto l1776;
+  {  int yypos1777= yypos, yythunkpos1777= yythunkpos;  if (!yymatchString("h5")) goto l1778;  goto l1777;
+  l1778:;	  yypos= yypos1777; yythunkpos= yythunkpos1777;  if (!yymatchString("H5")) goto l1776;
+  }
+  l1777:;	  if (!yy_Spnl()) goto l1776;  if (!yymatchChar('>')) goto l1776;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH5", yybuf+yypos));
+  return 1;
+  l1776:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH5", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH5()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH5"));  if (!yymatchChar('<')) goto l1779;  if (!yy_Spnl()) goto l1779;
+  {  int yypos1780= yypos, yythunkpos1780= yythunkpos;  if (!yymatchString("h5")) goto l1781;  goto l1780;
+  l1781:;	  yypos= yypos1780; yythunkpos= yythunkpos1780;  if (!yymatchString("H5")) goto l1779;
+  }
+  l1780:;	  if (!yy_Spnl()) goto l1779;
+  l1782:;	
+  {  int yypos1783= yypos, yythunkpos1783= yythunkpos;  if (!yy_HtmlAttribute()) goto l1783;  goto l1782;
+  l1783:;	  yypos= yypos1783; yythunkpos= yythunkpos1783;
+  }  if (!yymatchChar('>')) goto l1779;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH5", yybuf+yypos));
+  return 1;
+  l1779:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH5", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockH4()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH4"));  if (!yy_HtmlBlockOpenH4()) goto l1784;
+  l1785:;	
+  {  int yypos1786= yypos, yythunkpos1786= yythunkpos;
+  {  int yypos1787= yypos, yythunkpos1787= yythunkpos;  if (!yy_HtmlBlockH4()) goto l1788;  goto l1787;
+  l1788:;	  yypos= yypos1787; yythunkpos= yythunkpos1787;
+  {  int yypos1789= yypos, yythunkpos1789= yythunkpos;  if (!yy_HtmlBlockCloseH4()) goto l1789;  goto l1786;
+  l1789:;	  yypos= yypos1789; yythunkpos= yythunkpos1789;
+  }  if (!yymatchDot()) goto l1786;
+  }
+  l1787:;	  goto l1785;
+  l1786:;	  yypos= yypos1786; yythunkpos= yythunkpos1786;
+  }  if (!yy_HtmlBlockCloseH4()) goto l1784;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH4", yybuf+yypos));
+  return 1;
+  l1784:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH4", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH4()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH4"));  if (!yymatchChar('<')) goto l1790;  if (!yy_Spnl()) goto l1790;  if (!yymatchChar('/')) goto l1790;
+  {  int yypos1791= yypos, yythunkpos1791= yythunkpos;  if (!yymatchString("h4")) goto l1792;  goto l1791;
+  l1792:;	  yypos= yypos1791; yythunkpos= yythunkpos1791;  if (!yymatchString("H4")) goto l1790;
+  }
+  l1791:;	  if (!yy_Spnl()) goto l1790;  if (!yymatchChar('>')) goto l1790;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH4", yybuf+yypos));
+  return 1;
+  l1790:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH4", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH4()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH4"));  if (!yymatchChar('<')) goto l1793;  if (!yy_Spnl()) goto l1793;
+  {  int yypos1794= yypos, yythunkpos1794= yythunkpos;  if (!yymatchString("h4")) goto l1795;  goto l1794;
+  l1795:;	  yypos= yypos1794; yythunkpos= yythunkpos1794;  if (!yymatchString("H4")) goto l1793;
+  }
+  l1794:;	  if (!yy_Spnl()) goto l1793;
+  l1796:;	
+  {  int yypos1797= yypos, yythunkpos1797= yythunkpos;  if (!yy_HtmlAttribute()) goto l1797;  goto l1796;
+  l1797:;	  yypos= yypos1797; yythunkpos= yythunkpos1797;
+  }  if (!yymatchChar('>')) goto l1793;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH4", yybuf+yypos));
+  return 1;
+  l1793:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH4", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockH3()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH3"));  if (!yy_HtmlBlockOpenH3()) goto l1798;
+  l1799:;	
+  {  int yypos1800= yypos, yythunkpos1800= yythunkpos;
+  {  int yypos1801= yypos, yythunkpos1801= yythunkpos;  if (!yy_HtmlBlockH3()) goto l1802;  goto l1801;
+  l1802:;	  yypos= yypos1801; yythunkpos= yythunkpos1801;
+  {  int yypos1803= yypos, yythunkpos1803= yythunkpos;  if (!yy_HtmlBlockCloseH3()) goto l1803;  goto l1800;
+  l1803:;	  yypos= yypos1803; yythunkpos= yythunkpos1803;
+  }  if (!yymatchDot()) goto l1800;
+  }
+  l1801:;	  goto l1799;
+  l1800:;	  yypos= yypos1800; yythunkpos= yythunkpos1800;
+  }  if (!yy_HtmlBlockCloseH3()) goto l1798;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH3", yybuf+yypos));
+  return 1;
+  l1798:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH3", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH3()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH3"));  if (!yymatchChar('<')) goto l1804;  if (!yy_Spnl()) goto l1804;  if (!yymatchChar('/')) goto l1804;
+  {  int yypos1805= yypos, yythunkpos1805= yythunkpos;  if (!yymatchString("h3")) goto l1806;  goto l1805;
+  l1806:;	  yypos= yypos1805; yythunkpos= yythunkpos1805;  if (!yymatchString("H3")) goto l1804;
+  }
+  l1805:;	  if (!yy_Spnl()) goto l1804;  if (!yymatchChar('>')) goto l1804;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH3", yybuf+yypos));
+  return 1;
+  l1804:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH3", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH3()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH3"));  if (!yymatchChar('<')) goto l1807;  if (!yy_Spnl()) goto l1807;
+  {  int yypos1808= yypos, yythunkpos1808= yythunkpos;  if (!yymatchString("h3")) goto l1809;  goto l1808;
+  l1809:;	  yypos= yypos1808; yythunkpos= yythunkpos1808;  if (!yymatchString("H3")) goto l1807;
+  }
+  l1808:;	  if (!yy_Spnl()) goto l1807;
+  l1810:;	
+  {  int yypos1811= yypos, yythunkpos1811= yythunkpos;  if (!yy_HtmlAttribute()) goto l1811;  goto l1810;
+  l1811:;	  yypos= yypos1811; yythunkpos= yythunkpos1811;
+  }  if (!yymatchChar('>')) goto l1807;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH3", yybuf+yypos));
+  return 1;
+  l1807:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH3", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockH2()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH2"));  if (!yy_HtmlBlockOpenH2()) goto l1812;
+  l1813:;	
+  {  int yypos1814= yypos, yythunkpos1814= yythunkpos;
+  {  int yypos1815= yypos, yythunkpos1815= yythunkpos;  if (!yy_HtmlBlockH2()) goto l1816;  goto l1815;
+  l1816:;	  yypos= yypos1815; yythunkpos= yythunkpos1815;
+  {  int yypos1817= yypos, yythunkpos1817= yythunkpos;  if (!yy_HtmlBlockCloseH2()) goto l1817;  goto l1814;
+  l1817:;	  yypos= yypos1817; yythunkpos= yythunkpos1817;
+  }  if (!yymatchDot()) goto l1814;
+  }
+  l1815:;	  goto l1813;
+  l1814:;	  yypos= yypos1814; yythunkpos= yythunkpos1814;
+  }  if (!yy_HtmlBlockCloseH2()) goto l1812;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH2", yybuf+yypos));
+  return 1;
+  l1812:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH2", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH2()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH2"));  if (!yymatchChar('<')) goto l1818;  if (!yy_Spnl()) goto l1818;  if (!yymatchChar('/')) goto l1818;
+  {  int yypos1819= yypos, yythunkpos1819= yythunkpos;  if (!yymatchString("h2")) goto l1820;  goto l1819;
+  l1820:;	  yypos= yypos1819; yythunkpos= yythunkpos1819;  if (!yymatchString("H2")) goto l1818;
+  }
+  l1819:;	  if (!yy_Spnl()) goto l1818;  if (!yymatchChar('>')) goto l1818;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH2", yybuf+yypos));
+  return 1;
+  l1818:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH2", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH2()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH2"));  if (!yymatchChar('<')) goto l1821;  if (!yy_Spnl()) goto l1821;
+  {  int yypos1822= yypos, yythunkpos1822= yythunkpos;  if (!yymatchString("h2")) goto l1823;  goto l1822;
+  l1823:;	  yypos= yypos1822; yythunkpos= yythunkpos1822;  if (!yymatchString("H2")) goto l1821;
+  }
+  l1822:;	  if (!yy_Spnl()) goto l1821;
+  l1824:;	
+  {  int yypos1825= yypos, yythunkpos1825= yythunkpos;  if (!yy_HtmlAttribute()) goto l1825;  goto l1824;
+  l1825:;	  yypos= yypos1825; yythunkpos= yythunkpos1825;
+  }  if (!yymatchChar('>')) goto l1821;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH2", yybuf+yypos));
+  return 1;
+  l1821:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH2", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockH1()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH1"));  if (!yy_HtmlBlockOpenH1()) goto l1826;
+  l1827:;	
+  {  int yypos1828= yypos, yythunkpos1828= yythunkpos;
+  {  int yypos1829= yypos, yythunkpos1829= yythunkpos;  if (!yy_HtmlBlockH1()) goto l1830;  goto l1829;
+  l1830:;	  yypos= yypos1829; yythunkpos= yythunkpos1829;
+  {  int yypos1831= yypos, yythunkpos1831= yythunkpos;  if (!yy_HtmlBlockCloseH1()) goto l1831;  goto l1828;
+  l1831:;	  yypos= yypos1831; yythunkpos= yythunkpos1831;
+  }  if (!yymatchDot()) goto l1828;
+  }
+  l1829:;	  goto l1827;
+  l1828:;	  yypos= yypos1828; yythunkpos= yythunkpos1828;
+  }  if (!yy_HtmlBlockCloseH1()) goto l1826;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH1", yybuf+yypos));
+  return 1;
+  l1826:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH1", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseH1()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH1"));  if (!yymatchChar('<')) goto l1832;  if (!yy_Spnl()) goto l1832;  if (!yymatchChar('/')) goto l1832;
+  {  int yypos1833= yypos, yythunkpos1833= yythunkpos;  if (!yymatchString("h1")) goto l1834;  goto l1833;
+  l1834:;	  yypos= yypos1833; yythunkpos= yythunkpos1833;  if (!yymatchString("H1")) goto l1832;
+  }
+  l1833:;	  if (!yy_Spnl()) goto l1832;  if (!yymatchChar('>')) goto l1832;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH1", yybuf+yypos));
+  return 1;
+  l1832:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH1", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenH1()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH1"));  if (!yymatchChar('<')) goto l1835;  if (!yy_Spnl()) goto l1835;
+  {  int yypos1836= yypos, yythunkpos1836= yythunkpos;  if (!yymatchString("h1")) goto l1837;  goto l1836;
+  l1837:;	  yypos= yypos1836; yythunkpos= yythunkpos1836;  if (!yymatchString("H1")) goto l1835;
+  }
+  l1836:;	  if (!yy_Spnl()) goto l1835;
+  l1838:;	
+  {  int yypos1839= yypos, yythunkpos1839= yythunkpos;  if (!yy_HtmlAttribute()) goto l1839;  goto l1838;
+  l1839:;	  yypos= yypos1839; yythunkpos= yythunkpos1839;
+  }  if (!yymatchChar('>')) goto l1835;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH1", yybuf+yypos));
+  return 1;
+  l1835:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH1", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockHgroup()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockHgroup"));  if (!yy_HtmlBlockOpenHgroup()) goto l1840;
+  l1841:;	
+  {  int yypos1842= yypos, yythunkpos1842= yythunkpos;
+  {  int yypos1843= yypos, yythunkpos1843= yythunkpos;  if (!yy_HtmlBlockHgroup()) goto l1844;  goto l1843;
+  l1844:;	  yypos= yypos1843; yythunkpos= yythunkpos1843;
+  {  int yypos1845= yypos, yythunkpos1845= yythunkpos;  if (!yy_HtmlBlockCloseHgroup()) goto l1845;  goto l1842;
+  l1845:;	  yypos= yypos1845; yythunkpos= yythunkpos1845;
+  }  if (!yymatchDot()) goto l1842;
+  }
+  l1843:;	  goto l1841;
+  l1842:;	  yypos= yypos1842; yythunkpos= yythunkpos1842;
+  }  if (!yy_HtmlBlockCloseHgroup()) goto l1840;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockHgroup", yybuf+yypos));
+  return 1;
+  l1840:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockHgroup", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseHgroup()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseHgroup"));  if (!yymatchChar('<')) goto l1846;  if (!yy_Spnl()) goto l1846;  if (!yymatchChar('/')) goto l1846;
+  {  int yypos1847= yypos, yythunkpos1847= yythunkpos;  if (!yymatchString("hgroup")) goto l1848;  goto l1847;
+  l1848:;	  yypos= yypos1847; yythunkpos= yythunkpos1847;  if (!yymatchString("HGROUP")) goto l1846;
+  }
+  l1847:;	  if (!yy_Spnl()) goto l1846;  if (!yymatchChar('>')) goto l1846;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseHgroup", yybuf+yypos));
+  return 1;
+  l1846:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseHgroup", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenHgroup()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenHgroup"));  if (!yymatchChar('<')) goto l1849;  if (!yy_Spnl()) goto l1849;
+  {  int yypos1850= yypos, yythunkpos1850= yythunkpos;  if (!yymatchString("hgroup")) goto l1851;  goto l1850;
+  l1851:;	  yypos= yypos1850; yythunkpos= yythunkpos1850;  if (!yymatchString("HGROUP")) goto l1849;
+  }
+  l1850:;	  if (!yy_Spnl()) goto l1849;
+  l1852:;	
+  {  int yypos1853= yypos, yythunkpos1853= yythunkpos;  if (!yy_HtmlAttribute()) goto l1853;  goto l1852;
+  l1853:;	  yypos= yypos1853; yythunkpos= yythunkpos1853;
+  }  if (!yymatchChar('>')) goto l1849;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenHgroup", yybuf+yypos));
+  return 1;
+  l1849:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenHgroup", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockHeader()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockHeader"));  if (!yy_HtmlBlockOpenHeader()) goto l1854;
+  l1855:;	
+  {  int yypos1856= yypos, yythunkpos1856= yythunkpos;
+  {  int yypos1857= yypos, yythunkpos1857= yythunkpos;  if (!yy_HtmlBlockHeader()) goto l1858;  goto l1857;
+  l1858:;	  yypos= yypos1857; yythunkpos= yythunkpos1857;
+  {  int yypos1859= yypos, yythunkpos1859= yythunkpos;  if (!yy_HtmlBlockCloseHeader()) goto l1859;  goto l1856;
+  l1859:;	  yypos= yypos1859; yythunkpos= yythunkpos1859;
+  }  if (!yymatchDot()) goto l1856;
+  }
+  l1857:;	  goto l1855;
+  l1856:;	  yypos= yypos1856; yythunkpos= yythunkpos1856;
+  }  if (!yy_HtmlBlockCloseHeader()) goto l1854;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockHeader", yybuf+yypos));
+  return 1;
+  l1854:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockHeader", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseHeader()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseHeader"));  if (!yymatchChar('<')) goto l1860;  if (!yy_Spnl()) goto l1860;  if (!yymatchChar('/')) goto l1860;
+  {  int yypos1861= yypos, yythunkpos1861= yythunkpos;  if (!yymatchString("header")) goto l1862;  goto l1861;
+  l1862:;	  yypos= yypos1861; yythunkpos= yythunkpos1861;  if (!yymatchString("HEADER")) goto l1860;
+  }
+  l1861:;	  if (!yy_Spnl()) goto l1860;  if (!yymatchChar('>')) goto l1860;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseHeader", yybuf+yypos));
+  return 1;
+  l1860:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseHeader", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenHeader()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenHeader"));  if (!yymatchChar('<')) goto l1863;  if (!yy_Spnl()) goto l1863;
+  {  int yypos1864= yypos, yythunkpos1864= yythunkpos;  if (!yymatchString("header")) goto l1865;  goto l1864;
+  l1865:;	  yypos= yypos1864; yythunkpos= yythunkpos1864;  if (!yymatchString("HEADER")) goto l1863;
+  }
+  l1864:;	  if (!yy_Spnl()) goto l1863;
+  l1866:;	
+  {  int yypos1867= yypos, yythunkpos1867= yythunkpos;  if (!yy_HtmlAttribute()) goto l1867;  goto l1866;
+  l1867:;	  yypos= yypos1867; yythunkpos= yythunkpos1867;
+  }  if (!yymatchChar('>')) goto l1863;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenHeader", yybuf+yypos));
+  return 1;
+  l1863:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenHeader", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockForm()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockForm"));  if (!yy_HtmlBlockOpenForm()) goto l1868;
+  l1869:;	
+  {  int yypos1870= yypos, yythunkpos1870= yythunkpos;
+  {  int yypos1871= yypos, yythunkpos1871= yythunkpos;  if (!yy_HtmlBlockForm()) goto l1872;  goto l1871;
+  l1872:;	  yypos= yypos1871; yythunkpos= yythunkpos1871;
+  {  int yypos1873= yypos, yythunkpos1873= yythunkpos;  if (!yy_HtmlBlockCloseForm()) goto l1873;  goto l1870;
+  l1873:;	  yypos= yypos1873; yythunkpos= yythunkpos1873;
+  }  if (!yymatchDot()) goto l1870;
+  }
+  l1871:;	  goto l1869;
+  l1870:;	  yypos= yypos1870; yythunkpos= yythunkpos1870;
+  }  if (!yy_HtmlBlockCloseForm()) goto l1868;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockForm", yybuf+yypos));
+  return 1;
+  l1868:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockForm", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseForm()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseForm"));  if (!yymatchChar('<')) goto l1874;  if (!yy_Spnl()) goto l1874;  if (!yymatchChar('/')) goto l1874;
+  {  int yypos1875= yypos, yythunkpos1875= yythunkpos;  if (!yymatchString("form")) goto l1876;  goto l1875;
+  l1876:;	  yypos= yypos1875; yythunkpos= yythunkpos1875;  if (!yymatchString("FORM")) goto l1874;
+  }
+  l1875:;	  if (!yy_Spnl()) goto l1874;  if (!yymatchChar('>')) goto l1874;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseForm", yybuf+yypos));
+  return 1;
+  l1874:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseForm", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenForm()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenForm"));  if (!yymatchChar('<')) goto l1877;  if (!yy_Spnl()) goto l1877;
+  {  int yypos1878= yypos, yythunkpos1878= yythunkpos;  if (!yymatchString("form")) goto l1879;  goto l1878;
+  l1879:;	  yypos= yypos1878; yythunkpos= yythunkpos1878;  if (!yymatchString("FORM")) goto l1877;
+  }
+  l1878:;	  if (!yy_Spnl()) goto l1877;
+  l1880:;	
+  {  int yypos1881= yypos, yythunkpos1881= yythunkpos;  if (!yy_HtmlAttribute()) goto l1881;  goto l1880;
+  l1881:;	  yypos= yypos1881; yythunkpos= yythunkpos1881;
+  }  if (!yymatchChar('>')) goto l1877;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenForm", yybuf+yypos));
+  return 1;
+  l1877:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenForm", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockFooter()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockFooter"));  if (!yy_HtmlBlockOpenFooter()) goto l1882;
+  l1883:;	
+  {  int yypos1884= yypos, yythunkpos1884= yythunkpos;
+  {  int yypos1885= yypos, yythunkpos1885= yythunkpos;  if (!yy_HtmlBlockFooter()) goto l1886;  goto l1885;
+  l1886:;	  yypos= yypos1885; yythunkpos= yythunkpos1885;
+  {  int yypos1887= yypos, yythunkpos1887= yythunkpos;  if (!yy_HtmlBlockCloseFooter()) goto l1887;  goto l1884;
+  l1887:;	  yypos= yypos1887; yythunkpos= yythunkpos1887;
+  }  if (!yymatchDot()) goto l1884;
+  }
+  l1885:;	  goto l1883;
+  l1884:;	  yypos= yypos1884; yythunkpos= yythunkpos1884;
+  }  if (!yy_HtmlBlockCloseFooter()) goto l1882;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockFooter", yybuf+yypos));
+  return 1;
+  l1882:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockFooter", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseFooter()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseFooter"));  if (!yymatchChar('<')) goto l1888;  if (!yy_Spnl()) goto l1888;  if (!yymatchChar('/')) goto l1888;
+  {  int yypos1889= yypos, yythunkpos1889= yythunkpos;  if (!yymatchString("footer")) goto l1890;  goto l1889;
+  l1890:;	  yypos= yypos1889; yythunkpos= yythunkpos1889;  if (!yymatchString("FOOTER")) goto l1888;
+  }
+  l1889:;	  if (!yy_Spnl()) goto l1888;  if (!yymatchChar('>')) goto l1888;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseFooter", yybuf+yypos));
+  return 1;
+  l1888:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseFooter", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenFooter()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenFooter"));  if (!yymatchChar('<')) goto l1891;  if (!yy_Spnl()) goto l1891;
+  {  int yypos1892= yypos, yythunkpos1892= yythunkpos;  if (!yymatchString("footer")) goto l1893;  goto l1892;
+  l1893:;	  yypos= yypos1892; yythunkpos= yythunkpos1892;  if (!yymatchString("FOOTER")) goto l1891;
+  }
+  l1892:;	  if (!yy_Spnl()) goto l1891;
+  l1894:;	
+  {  int yypos1895= yypos, yythunkpos1895= yythunkpos;  if (!yy_HtmlAttribute()) goto l1895;  goto l1894;
+  l1895:;	  yypos= yypos1895; yythunkpos= yythunkpos1895;
+  }  if (!yymatchChar('>')) goto l1891;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenFooter", yybuf+yypos));
+  return 1;
+  l1891:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenFooter", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockFigure()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockFigure"));  if (!yy_HtmlBlockOpenFigure()) goto l1896;
+  l1897:;	
+  {  int yypos1898= yypos, yythunkpos1898= yythunkpos;
+  {  int yypos1899= yypos, yythunkpos1899= yythunkpos;  if (!yy_HtmlBlockFigure()) goto l1900;  goto l1899;
+  l1900:;	  yypos= yypos1899; yythunkpos= yythunkpos1899;
+  {  int yypos1901= yypos, yythunkpos1901= yythunkpos;  if (!yy_HtmlBlockCloseFigure()) goto l1901;  goto l1898;
+  l1901:;	  yypos= yypos1901; yythunkpos= yythunkpos1901;
+  }  if (!yymatchDot()) goto l1898;
+  }
+  l1899:;	  goto l1897;
+  l1898:;	  yypos= yypos1898; yythunkpos= yythunkpos1898;
+  }  if (!yy_HtmlBlockCloseFigure()) goto l1896;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockFigure", yybuf+yypos));
+  return 1;
+  l1896:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockFigure", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseFigure()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseFigure"));  if (!yymatchChar('<')) goto l1902;  if (!yy_Spnl()) goto l1902;  if (!yymatchChar('/')) goto l1902;
+  {  int yypos1903= yypos, yythunkpos1903= yythunkpos;  if (!yymatchString("figure")) goto l1904;  goto l1903;
+  l1904:;	  yypos= yypos1903; yythunkpos= yythunkpos1903;  if (!yymatchString("FIGURE")) goto l1902;
+  }
+  l1903:;	  if (!yy_Spnl()) goto l1902;  if (!yymatchChar('>')) goto l1902;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseFigure", yybuf+yypos));
+  return 1;
+  l1902:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseFigure", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenFigure()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenFigure"));  if (!yymatchChar('<')) goto l1905;  if (!yy_Spnl()) goto l1905;
+  {  int yypos1906= yypos, yythunkpos1906= yythunkpos;  if (!yymatchString("figure")) goto l1907;  goto l1906;
+  l1907:;	  yypos= yypos1906; yythunkpos= yythunkpos1906;  if (!yymatchString("FIGURE")) goto l1905;
+  }
+  l1906:;	  if (!yy_Spnl()) goto l1905;
+  l1908:;	
+  {  int yypos1909= yypos, yythunkpos1909= yythunkpos;  if (!yy_HtmlAttribute()) goto l1909;  goto l1908;
+  l1909:;	  yypos= yypos1909; yythunkpos= yythunkpos1909;
+  }  if (!yymatchChar('>')) goto l1905;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenFigure", yybuf+yypos));
+  return 1;
+  l1905:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenFigure", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockFieldset()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockFieldset"));  if (!yy_HtmlBlockOpenFieldset()) goto l1910;
+  l1911:;	
+  {  int yypos1912= yypos, yythunkpos1912= yythunkpos;
+  {  int yypos1913= yypos, yythunkpos1913= yythunkpos;  if (!yy_HtmlBlockFieldset()) goto l1914;  goto l1913;
+  l1914:;	  yypos= yypos1913; yythunkpos= yythunkpos1913;
+  {  int yypos1915= yypos, yythunkpos1915= yythunkpos;  if (!yy_HtmlBlockCloseFieldset()) goto l1915;  goto l1912;
+  l1915:;	  yypos= yypos1915; yythunkpos= yythunkpos1915;
+  }  if (!yymatchDot()) goto l1912;
+  }
+  l1913:;	  goto l1911;
+  l1912:;	  yypos= yypos1912; yythunkpos= yythunkpos1912;
+  }  if (!yy_HtmlBlockCloseFieldset()) goto l1910;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockFieldset", yybuf+yypos));
+  return 1;
+  l1910:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockFieldset", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseFieldset()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseFieldset"));  if (!yymatchChar('<')) goto l1916;  if (!yy_Spnl()) goto l1916;  if (!yymatchChar('/')) goto l1916;
+  {  int yypos1917= yypos, yythunkpos1917= yythunkpos;  if (!yymatchString("fieldset")) goto l1918;  goto l1917;
+  l1918:;	  yypos= yypos1917; yythunkpos= yythunkpos1917;  if (!yymatchString("FIELDSET")) goto l1916;
+  }
+  l1917:;	  if (!yy_Spnl()) goto l1916;  if (!yymatchChar('>')) goto l1916;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseFieldset", yybuf+yypos));
+  return 1;
+  l1916:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseFieldset", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenFieldset()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenFieldset"));  if (!yymatchChar('<')) goto l1919;  if (!yy_Spnl()) goto l1919;
+  {  int yypos1920= yypos, yythunkpos1920= yythunkpos;  if (!yymatchString("fieldset")) goto l1921;  goto l1920;
+  l1921:;	  yypos= yypos1920; yythunkpos= yythunkpos1920;  if (!yymatchString("FIELDSET")) goto l1919;
+  }
+  l1920:;	  if (!yy_Spnl()) goto l1919;
+  l1922:;	
+  {  int yypos1923= yypos, yythunkpos1923= yythunkpos;  if (!yy_HtmlAttribute()) goto l1923;  goto l1922;
+  l1923:;	  yypos= yypos1923; yythunkpos= yythunkpos1923;
+  }  if (!yymatchChar('>')) goto l1919;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenFieldset", yybuf+yypos));
+  return 1;
+  l1919:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenFieldset", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockDl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockDl"));  if (!yy_HtmlBlockOpenDl()) goto l1924;
+  l1925:;	
+  {  int yypos1926= yypos, yythunkpos1926= yythunkpos;
+  {  int yypos1927= yypos, yythunkpos1927= yythunkpos;  if (!yy_HtmlBlockDl()) goto l1928;  goto l1927;
+  l1928:;	  yypos= yypos1927; yythunkpos= yythunkpos1927;
+  {  int yypos1929= yypos, yythunkpos1929= yythunkpos;  if (!yy_HtmlBlockCloseDl()) goto l1929;  goto l1926;
+  l1929:;	  yypos= yypos1929; yythunkpos= yythunkpos1929;
+  }  if (!yymatchDot()) goto l1926;
+  }
+  l1927:;	  goto l1925;
+  l1926:;	  yypos= yypos1926; yythunkpos= yythunkpos1926;
+  }  if (!yy_HtmlBlockCloseDl()) goto l1924;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockDl", yybuf+yypos));
+  return 1;
+  l1924:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockDl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseDl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseDl"));  if (!yymatchChar('<')) goto l1930;  if (!yy_Spnl()) goto l1930;  if (!yymatchChar('/')) goto l1930;
+  {  int yypos1931= yypos, yythunkpos1931= yythunkpos;  if (!yymatchString("dl")) goto l1932;  goto l1931;
+  l1932:;	  yypos= yypos1931; yythunkpos= yythunkpos1931;  if (!yymatchString("DL")) goto l1930;
+  }
+  l1931:;	  if (!yy_Spnl()) goto l1930;  if (!yymatchChar('>')) goto l1930;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseDl", yybuf+yypos));
+  return 1;
+  l1930:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseDl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenDl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenDl"));  if (!yymatchChar('<')) goto l1933;  if (!yy_Spnl()) goto l1933;
+  {  int yypos1934= yypos, yythunkpos1934= yythunkpos;  if (!yymatchString("dl")) goto l1935;  goto l1934;
+  l1935:;	  yypos= yypos1934; yythunkpos= yythunkpos1934;  if (!yymatchString("DL")) goto l1933;
+  }
+  l1934:;	  if (!yy_Spnl()) goto l1933;
+  l1936:;	
+  {  int yypos1937= yypos, yythunkpos1937= yythunkpos;  if (!yy_HtmlAttribute()) goto l1937;  goto l1936;
+  l1937:;	  yypos= yypos1937; yythunkpos= yythunkpos1937;
+  }  if (!yymatchChar('>')) goto l1933;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenDl", yybuf+yypos));
+  return 1;
+  l1933:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenDl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockDiv()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockDiv"));  if (!yy_HtmlBlockOpenDiv()) goto l1938;
+  l1939:;	
+  {  int yypos1940= yypos, yythunkpos1940= yythunkpos;
+  {  int yypos1941= yypos, yythunkpos1941= yythunkpos;  if (!yy_HtmlBlockDiv()) goto l1942;  goto l1941;
+  l1942:;	  yypos= yypos1941; yythunkpos= yythunkpos1941;
+  {  int yypos1943= yypos, yythunkpos1943= yythunkpos;  if (!yy_HtmlBlockCloseDiv()) goto l1943;  goto l1940;
+  l1943:;	  yypos= yypos1943; yythunkpos= yythunkpos1943;
+  }  if (!yymatchDot()) goto l1940;
+  }
+  l1941:;	  goto l1939;
+  l1940:;	  yypos= yypos1940; yythunkpos= yythunkpos1940;
+  }  if (!yy_HtmlBlockCloseDiv()) goto l1938;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockDiv", yybuf+yypos));
+  return 1;
+  l1938:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockDiv", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseDiv()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseDiv"));  if (!yymatchChar('<')) goto l1944;  if (!yy_Spnl()) goto l1944;  if (!yymatchChar('/')) goto l1944;
+  {  int yypos1945= yypos, yythunkpos1945= yythunkpos;  if (!yymatchString("div")) goto l1946;  goto l1945;
+  l1946:;	  yypos= yypos1945; yythunkpos= yythunkpos1945;  if (!yymatchString("DIV")) goto l1944;
+  }
+  l1945:;	  if (!yy_Spnl()) goto l1944;  if (!yymatchChar('>')) goto l1944;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseDiv", yybuf+yypos));
+  return 1;
+  l1944:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseDiv", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockDir()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockDir"));  if (!yy_HtmlBlockOpenDir()) goto l1947;
+  l1948:;	
+  {  int yypos1949= yypos, yythunkpos1949= yythunkpos;
+  {  int yypos1950= yypos, yythunkpos1950= yythunkpos;  if (!yy_HtmlBlockDir()) goto l1951;  goto l1950;
+  l1951:;	  yypos= yypos1950; yythunkpos= yythunkpos1950;
+  {  int yypos1952= yypos, yythunkpos1952= yythunkpos;  if (!yy_HtmlBlockCloseDir()) goto l1952;  goto l1949;
+  l1952:;	  yypos= yypos1952; yythunkpos= yythunkpos1952;
+  }  if (!yymatchDot()) goto l1949;
+  }
+  l1950:;	  goto l1948;
+  l1949:;	  yypos= yypos1949; yythunkpos= yythunkpos1949;
+  }  if (!yy_HtmlBlockCloseDir()) goto l1947;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockDir", yybuf+yypos));
+  return 1;
+  l1947:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockDir", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseDir()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseDir"));  if (!yymatchChar('<')) goto l1953;  if (!yy_Spnl()) goto l1953;  if (!yymatchChar('/')) goto l1953;
+  {  int yypos1954= yypos, yythunkpos1954= yythunkpos;  if (!yymatchString("dir")) goto l1955;  goto l1954;
+  l1955:;	  yypos= yypos1954; yythunkpos= yythunkpos1954;  if (!yymatchString("DIR")) goto l1953;
+  }
+  l1954:;	  if (!yy_Spnl()) goto l1953;  if (!yymatchChar('>')) goto l1953;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseDir", yybuf+yypos));
+  return 1;
+  l1953:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseDir", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenDir()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenDir"));  if (!yymatchChar('<')) goto l1956;  if (!yy_Spnl()) goto l1956;
+  {  int yypos1957= yypos, yythunkpos1957= yythunkpos;  if (!yymatchString("dir")) goto l1958;  goto l1957;
+  l1958:;	  yypos= yypos1957; yythunkpos= yythunkpos1957;  if (!yymatchString("DIR")) goto l1956;
+  }
+  l1957:;	  if (!yy_Spnl()) goto l1956;
+  l1959:;	
+  {  int yypos1960= yypos, yythunkpos1960= yythunkpos;  if (!yy_HtmlAttribute()) goto l1960;  goto l1959;
+  l1960:;	  yypos= yypos1960; yythunkpos= yythunkpos1960;
+  }  if (!yymatchChar('>')) goto l1956;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenDir", yybuf+yypos));
+  return 1;
+  l1956:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenDir", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCenter()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCenter"));  if (!yy_HtmlBlockOpenCenter()) goto l1961;
+  l1962:;	
+  {  int yypos1963= yypos, yythunkpos1963= yythunkpos;
+  {  int yypos1964= yypos, yythunkpos1964= yythunkpos;  if (!yy_HtmlBlockCenter()) goto l1965;  goto l1964;
+  l1965:;	  yypos= yypos1964; yythunkpos= yythunkpos1964;
+  {  int yypos1966= yypos, yythunkpos1966= yythunkpos;  if (!yy_HtmlBlockCloseCenter()) goto l1966;  goto l1963;
+  l1966:;	  yypos= yypos1966; yythunkpos= yythunkpos1966;
+  }  if (!yymatchDot()) goto l1963;
+  }
+  l1964:;	  goto l1962;
+  l1963:;	  yypos= yypos1963; yythunkpos= yythunkpos1963;
+  }  if (!yy_HtmlBlockCloseCenter()) goto l1961;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCenter", yybuf+yypos));
+  return 1;
+  l1961:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCenter", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseCenter()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseCenter"));  if (!yymatchChar('<')) goto l1967;  if (!yy_Spnl()) goto l1967;  if (!yymatchChar('/')) goto l1967;
+  {  int yypos1968= yypos, yythunkpos1968= yythunkpos;  if (!yymatchString("center")) goto l1969;  goto l1968;
+  l1969:;	  yypos= yypos1968; yythunkpos= yythunkpos1968;  if (!yymatchString("CENTER")) goto l1967;
+  }
+  l1968:;	  if (!yy_Spnl()) goto l1967;  if (!yymatchChar('>')) goto l1967;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseCenter", yybuf+yypos));
+  return 1;
+  l1967:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseCenter", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenCenter()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenCenter"));  if (!yymatchChar('<')) goto l1970;  if (!yy_Spnl()) goto l1970;
+  {  int yypos1971= yypos, yythunkpos1971= yythunkpos;  if (!yymatchString("center")) goto l1972;  goto l1971;
+  l1972:;	  yypos= yypos1971; yythunkpos= yythunkpos1971;  if (!yymatchString("CENTER")) goto l1970;
+  }
+  l1971:;	  if (!yy_Spnl()) goto l1970;
+  l1973:;	
+  {  int yypos1974= yypos, yythunkpos1974= yythunkpos;  if (!yy_HtmlAttribute()) goto l1974;  goto l1973;
+  l1974:;	  yypos= yypos1974; yythunkpos= yythunkpos1974;
+  }  if (!yymatchChar('>')) goto l1970;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenCenter", yybuf+yypos));
+  return 1;
+  l1970:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenCenter", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCanvas()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCanvas"));  if (!yy_HtmlBlockOpenCanvas()) goto l1975;
+  l1976:;	
+  {  int yypos1977= yypos, yythunkpos1977= yythunkpos;
+  {  int yypos1978= yypos, yythunkpos1978= yythunkpos;  if (!yy_HtmlBlockCanvas()) goto l1979;  goto l1978;
+  l1979:;	  yypos= yypos1978; yythunkpos= yythunkpos1978;
+  {  int yypos1980= yypos, yythunkpos1980= yythunkpos;  if (!yy_HtmlBlockCloseCanvas()) goto l1980;  goto l1977;
+  l1980:;	  yypos= yypos1980; yythunkpos= yythunkpos1980;
+  }  if (!yymatchDot()) goto l1977;
+  }
+  l1978:;	  goto l1976;
+  l1977:;	  yypos= yypos1977; yythunkpos= yythunkpos1977;
+  }  if (!yy_HtmlBlockCloseCanvas()) goto l1975;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCanvas", yybuf+yypos));
+  return 1;
+  l1975:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCanvas", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseCanvas()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseCanvas"));  if (!yymatchChar('<')) goto l1981;  if (!yy_Spnl()) goto l1981;  if (!yymatchChar('/')) goto l1981;
+  {  int yypos1982= yypos, yythunkpos1982= yythunkpos;  if (!yymatchString("canvas")) goto l1983;  goto l1982;
+  l1983:;	  yypos= yypos1982; yythunkpos= yythunkpos1982;  if (!yymatchString("CANVAS")) goto l1981;
+  }
+  l1982:;	  if (!yy_Spnl()) goto l1981;  if (!yymatchChar('>')) goto l1981;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseCanvas", yybuf+yypos));
+  return 1;
+  l1981:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseCanvas", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenCanvas()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenCanvas"));  if (!yymatchChar('<')) goto l1984;  if (!yy_Spnl()) goto l1984;
+  {  int yypos1985= yypos, yythunkpos1985= yythunkpos;  if (!yymatchString("canvas")) goto l1986;  goto l1985;
+  l1986:;	  yypos= yypos1985; yythunkpos= yythunkpos1985;  if (!yymatchString("CANVAS")) goto l1984;
+  }
+  l1985:;	  if (!yy_Spnl()) goto l1984;
+  l1987:;	
+  {  int yypos1988= yypos, yythunkpos1988= yythunkpos;  if (!yy_HtmlAttribute()) goto l1988;  goto l1987;
+  l1988:;	  yypos= yypos1988; yythunkpos= yythunkpos1988;
+  }  if (!yymatchChar('>')) goto l1984;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenCanvas", yybuf+yypos));
+  return 1;
+  l1984:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenCanvas", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockBlockquote()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockBlockquote"));  if (!yy_HtmlBlockOpenBlockquote()) goto l1989;
+  l1990:;	
+  {  int yypos1991= yypos, yythunkpos1991= yythunkpos;
+  {  int yypos1992= yypos, yythunkpos1992= yythunkpos;  if (!yy_HtmlBlockBlockquote()) goto l1993;  goto l1992;
+  l1993:;	  yypos= yypos1992; yythunkpos= yythunkpos1992;
+  {  int yypos1994= yypos, yythunkpos1994= yythunkpos;  if (!yy_HtmlBlockCloseBlockquote()) goto l1994;  goto l1991;
+  l1994:;	  yypos= yypos1994; yythunkpos= yythunkpos1994;
+  }  if (!yymatchDot()) goto l1991;
+  }
+  l1992:;	  goto l1990;
+  l1991:;	  yypos= yypos1991; yythunkpos= yythunkpos1991;
+  }  if (!yy_HtmlBlockCloseBlockquote()) goto l1989;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockBlockquote", yybuf+yypos));
+  return 1;
+  l1989:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockBlockquote", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseBlockquote()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseBlockquote"));  if (!yymatchChar('<')) goto l1995;  if (!yy_Spnl()) goto l1995;  if (!yymatchChar('/')) goto l1995;
+  {  int yypos1996= yypos, yythunkpos1996= yythunkpos;  if (!yymatchString("blockquote")) goto l1997;  goto l1996;
+  l1997:;	  yypos= yypos1996; yythunkpos= yythunkpos1996;  if (!yymatchString("BLOCKQUOTE")) goto l1995;
+  }
+  l1996:;	  if (!yy_Spnl()) goto l1995;  if (!yymatchChar('>')) goto l1995;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseBlockquote", yybuf+yypos));
+  return 1;
+  l1995:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseBlockquote", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenBlockquote()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenBlockquote"));  if (!yymatchChar('<')) goto l1998;  if (!yy_Spnl()) goto l1998;
+  {  int yypos1999= yypos, yythunkpos1999= yythunkpos;  if (!yymatchString("blockquote")) goto l2000;  goto l1999;
+  l2000:;	  yypos= yypos1999; yythunkpos= yythunkpos1999;  if (!yymatchString("BLOCKQUOTE")) goto l1998;
+  }
+  l1999:;	  if (!yy_Spnl()) goto l1998;
+  l2001:;	
+  {  int yypos2002= yypos, yythunkpos2002= yythunkpos;  if (!yy_HtmlAttribute()) goto l2002;  goto l2001;
+  l2002:;	  yypos= yypos2002; yythunkpos= yythunkpos2002;
+  }  if (!yymatchChar('>')) goto l1998;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenBlockquote", yybuf+yypos));
+  return 1;
+  l1998:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenBlockquote", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockAside()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockAside"));  if (!yy_HtmlBlockOpenAside()) goto l2003;
+  l2004:;	
+  {  int yypos2005= yypos, yythunkpos2005= yythunkpos;
+  {  int yypos2006= yypos, yythunkpos2006= yythunkpos;  if (!yy_HtmlBlockAside()) goto l2007;  goto l2006;
+  l2007:;	  yypos= yypos2006; yythunkpos= yythunkpos2006;
+  {  int yypos2008= yypos, yythunkpos2008= yythunkpos;  if (!yy_HtmlBlockCloseAside()) goto l2008;  goto l2005;
+  l2008:;	  yypos= yypos2008; yythunkpos= yythunkpos2008;
+  }  if (!yymatchDot()) goto l2005;
+  }
+  l2006:;	  goto l2004;
+  l2005:;	  yypos= yypos2005; yythunkpos= yythunkpos2005;
+  }  if (!yy_HtmlBlockCloseAside()) goto l2003;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockAside", yybuf+yypos));
+  return 1;
+  l2003:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockAside", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseAside()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseAside"));  if (!yymatchChar('<')) goto l2009;  if (!yy_Spnl()) goto l2009;  if (!yymatchChar('/')) goto l2009;
+  {  int yypos2010= yypos, yythunkpos2010= yythunkpos;  if (!yymatchString("aside")) goto l2011;  goto l2010;
+  l2011:;	  yypos= yypos2010; yythunkpos= yythunkpos2010;  if (!yymatchString("ASIDE")) goto l2009;
+  }
+  l2010:;	  if (!yy_Spnl()) goto l2009;  if (!yymatchChar('>')) goto l2009;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseAside", yybuf+yypos));
+  return 1;
+  l2009:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseAside", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenAside()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenAside"));  if (!yymatchChar('<')) goto l2012;  if (!yy_Spnl()) goto l2012;
+  {  int yypos2013= yypos, yythunkpos2013= yythunkpos;  if (!yymatchString("aside")) goto l2014;  goto l2013;
+  l2014:;	  yypos= yypos2013; yythunkpos= yythunkpos2013;  if (!yymatchString("ASIDE")) goto l2012;
+  }
+  l2013:;	  if (!yy_Spnl()) goto l2012;
+  l2015:;	
+  {  int yypos2016= yypos, yythunkpos2016= yythunkpos;  if (!yy_HtmlAttribute()) goto l2016;  goto l2015;
+  l2016:;	  yypos= yypos2016; yythunkpos= yythunkpos2016;
+  }  if (!yymatchChar('>')) goto l2012;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenAside", yybuf+yypos));
+  return 1;
+  l2012:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenAside", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockArticle()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockArticle"));  if (!yy_HtmlBlockOpenArticle()) goto l2017;
+  l2018:;	
+  {  int yypos2019= yypos, yythunkpos2019= yythunkpos;
+  {  int yypos2020= yypos, yythunkpos2020= yythunkpos;  if (!yy_HtmlBlockArticle()) goto l2021;  goto l2020;
+  l2021:;	  yypos= yypos2020; yythunkpos= yythunkpos2020;
+  {  int yypos2022= yypos, yythunkpos2022= yythunkpos;  if (!yy_HtmlBlockCloseArticle()) goto l2022;  goto l2019;
+  l2022:;	  yypos= yypos2022; yythunkpos= yythunkpos2022;
+  }  if (!yymatchDot()) goto l2019;
+  }
+  l2020:;	  goto l2018;
+  l2019:;	  yypos= yypos2019; yythunkpos= yythunkpos2019;
+  }  if (!yy_HtmlBlockCloseArticle()) goto l2017;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockArticle", yybuf+yypos));
+  return 1;
+  l2017:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockArticle", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseArticle()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseArticle"));  if (!yymatchChar('<')) goto l2023;  if (!yy_Spnl()) goto l2023;  if (!yymatchChar('/')) goto l2023;
+  {  int yypos2024= yypos, yythunkpos2024= yythunkpos;  if (!yymatchString("article")) goto l2025;  goto l2024;
+  l2025:;	  yypos= yypos2024; yythunkpos= yythunkpos2024;  if (!yymatchString("ARTICLE")) goto l2023;
+  }
+  l2024:;	  if (!yy_Spnl()) goto l2023;  if (!yymatchChar('>')) goto l2023;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseArticle", yybuf+yypos));
+  return 1;
+  l2023:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseArticle", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenArticle()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenArticle"));  if (!yymatchChar('<')) goto l2026;  if (!yy_Spnl()) goto l2026;
+  {  int yypos2027= yypos, yythunkpos2027= yythunkpos;  if (!yymatchString("article")) goto l2028;  goto l2027;
+  l2028:;	  yypos= yypos2027; yythunkpos= yythunkpos2027;  if (!yymatchString("ARTICLE")) goto l2026;
+  }
+  l2027:;	  if (!yy_Spnl()) goto l2026;
+  l2029:;	
+  {  int yypos2030= yypos, yythunkpos2030= yythunkpos;  if (!yy_HtmlAttribute()) goto l2030;  goto l2029;
+  l2030:;	  yypos= yypos2030; yythunkpos= yythunkpos2030;
+  }  if (!yymatchChar('>')) goto l2026;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenArticle", yybuf+yypos));
+  return 1;
+  l2026:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenArticle", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockAddress()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockAddress"));  if (!yy_HtmlBlockOpenAddress()) goto l2031;
+  l2032:;	
+  {  int yypos2033= yypos, yythunkpos2033= yythunkpos;
+  {  int yypos2034= yypos, yythunkpos2034= yythunkpos;  if (!yy_HtmlBlockAddress()) goto l2035;  goto l2034;
+  l2035:;	  yypos= yypos2034; yythunkpos= yythunkpos2034;
+  {  int yypos2036= yypos, yythunkpos2036= yythunkpos;  if (!yy_HtmlBlockCloseAddress()) goto l2036;  goto l2033;
+  l2036:;	  yypos= yypos2036; yythunkpos= yythunkpos2036;
+  }  if (!yymatchDot()) goto l2033;
+  }
+  l2034:;	  goto l2032;
+  l2033:;	  yypos= yypos2033; yythunkpos= yythunkpos2033;
+  }  if (!yy_HtmlBlockCloseAddress()) goto l2031;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockAddress", yybuf+yypos));
+  return 1;
+  l2031:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockAddress", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockCloseAddress()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseAddress"));  if (!yymatchChar('<')) goto l2037;  if (!yy_Spnl()) goto l2037;  if (!yymatchChar('/')) goto l2037;
+  {  int yypos2038= yypos, yythunkpos2038= yythunkpos;  if (!yymatchString("address")) goto l2039;  goto l2038;
+  l2039:;	  yypos= yypos2038; yythunkpos= yythunkpos2038;  if (!yymatchString("ADDRESS")) goto l2037;
+  }
+  l2038:;	  if (!yy_Spnl()) goto l2037;  if (!yymatchChar('>')) goto l2037;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseAddress", yybuf+yypos));
+  return 1;
+  l2037:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseAddress", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlAttribute()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlAttribute"));
+  {  int yypos2043= yypos, yythunkpos2043= yythunkpos;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2044;
+  }  goto l2043;
+  l2044:;	  yypos= yypos2043; yythunkpos= yythunkpos2043;  if (!yymatchChar('-')) goto l2040;
+  }
+  l2043:;	
+  l2041:;	
+  {  int yypos2042= yypos, yythunkpos2042= yythunkpos;
+  {  int yypos2045= yypos, yythunkpos2045= yythunkpos;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2046;
+  }  goto l2045;
+  l2046:;	  yypos= yypos2045; yythunkpos= yythunkpos2045;  if (!yymatchChar('-')) goto l2042;
+  }
+  l2045:;	  goto l2041;
+  l2042:;	  yypos= yypos2042; yythunkpos= yythunkpos2042;
+  }  if (!yy_Spnl()) goto l2040;
+  {  int yypos2047= yypos, yythunkpos2047= yythunkpos;  if (!yymatchChar('=')) goto l2047;  if (!yy_Spnl()) goto l2047;
+  {  int yypos2049= yypos, yythunkpos2049= yythunkpos;  if (!yy_Quoted()) goto l2050;  goto l2049;
+  l2050:;	  yypos= yypos2049; yythunkpos= yythunkpos2049;
+  {  int yypos2053= yypos, yythunkpos2053= yythunkpos;  if (!yymatchChar('>')) goto l2053;  goto l2047;
+  l2053:;	  yypos= yypos2053; yythunkpos= yythunkpos2053;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l2047;
+  }
+  l2051:;	
+  {  int yypos2052= yypos, yythunkpos2052= yythunkpos;
+  {  int yypos2054= yypos, yythunkpos2054= yythunkpos;  if (!yymatchChar('>')) goto l2054;  goto l2052;
+  l2054:;	  yypos= yypos2054; yythunkpos= yythunkpos2054;
+  }  /* Nonspacechar */
+  {  if (!yymatchClass((unsigned char *)"\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l2052;
+  }  goto l2051;
+  l2052:;	  yypos= yypos2052; yythunkpos= yythunkpos2052;
+  }
+  }
+  l2049:;	  goto l2048;
+  l2047:;	  yypos= yypos2047; yythunkpos= yythunkpos2047;
+  }
+  l2048:;	  if (!yy_Spnl()) goto l2040;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlAttribute", yybuf+yypos));
+  return 1;
+  l2040:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlAttribute", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Spnl()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Spnl"));  /* Sp */
+  {
+  l2056:;	
+  {  int yypos2057= yypos, yythunkpos2057= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2058= yypos, yythunkpos2058= yythunkpos;  if (!yymatchChar(' ')) goto l2059;  goto l2058;
+  l2059:;	  yypos= yypos2058; yythunkpos= yythunkpos2058;  if (!yymatchChar('\t')) goto l2057;
+  }
+  l2058:;	
+  }  goto l2056;
+  l2057:;	  yypos= yypos2057; yythunkpos= yythunkpos2057;
+  }
+  }
+  {  int yypos2060= yypos, yythunkpos2060= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2060;
+  }  /* Sp */
+  {
+  l2062:;	
+  {  int yypos2063= yypos, yythunkpos2063= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2064= yypos, yythunkpos2064= yythunkpos;  if (!yymatchChar(' ')) goto l2065;  goto l2064;
+  l2065:;	  yypos= yypos2064; yythunkpos= yythunkpos2064;  if (!yymatchChar('\t')) goto l2063;
+  }
+  l2064:;	
+  }  goto l2062;
+  l2063:;	  yypos= yypos2063; yythunkpos= yythunkpos2063;
+  }
+  }  goto l2061;
+  l2060:;	  yypos= yypos2060; yythunkpos= yythunkpos2060;
+  }
+  l2061:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Spnl", yybuf+yypos));
+  return 1;
+  l2055:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Spnl", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenAddress()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenAddress"));  if (!yymatchChar('<')) goto l2066;  if (!yy_Spnl()) goto l2066;
+  {  int yypos2067= yypos, yythunkpos2067= yythunkpos;  if (!yymatchString("address")) goto l2068;  goto l2067;
+  l2068:;	  yypos= yypos2067; yythunkpos= yythunkpos2067;  if (!yymatchString("ADDRESS")) goto l2066;
+  }
+  l2067:;	  if (!yy_Spnl()) goto l2066;
+  l2069:;	
+  {  int yypos2070= yypos, yythunkpos2070= yythunkpos;  if (!yy_HtmlAttribute()) goto l2070;  goto l2069;
+  l2070:;	  yypos= yypos2070; yythunkpos= yythunkpos2070;
+  }  if (!yymatchChar('>')) goto l2066;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenAddress", yybuf+yypos));
+  return 1;
+  l2066:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenAddress", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_OptionallyIndentedLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "OptionallyIndentedLine"));
+  {  int yypos2072= yypos, yythunkpos2072= yythunkpos;  /* Indent */
+  {
+  {  int yypos2074= yypos, yythunkpos2074= yythunkpos;  if (!yymatchChar('\t')) goto l2075;  goto l2074;
+  l2075:;	  yypos= yypos2074; yythunkpos= yythunkpos2074;  if (!yymatchString("    ")) goto l2072;
+  }
+  l2074:;	
+  }  goto l2073;
+  l2072:;	  yypos= yypos2072; yythunkpos= yythunkpos2072;
+  }
+  l2073:;	  /* Line */
+  {  if (!yy_RawLine()) goto l2071;  yyDo(yy_1_Line, yybegin, yyend);
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "OptionallyIndentedLine", yybuf+yypos));
+  return 1;
+  l2071:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OptionallyIndentedLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Indent()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Indent"));
+  {  int yypos2077= yypos, yythunkpos2077= yythunkpos;  if (!yymatchChar('\t')) goto l2078;  goto l2077;
+  l2078:;	  yypos= yypos2077; yythunkpos= yythunkpos2077;  if (!yymatchString("    ")) goto l2076;
+  }
+  l2077:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Indent", yybuf+yypos));
+  return 1;
+  l2076:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Indent", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ListBlockLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "ListBlockLine"));
+  {  int yypos2080= yypos, yythunkpos2080= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2081:;	
+  {  int yypos2082= yypos, yythunkpos2082= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2083= yypos, yythunkpos2083= yythunkpos;  if (!yymatchChar(' ')) goto l2084;  goto l2083;
+  l2084:;	  yypos= yypos2083; yythunkpos= yythunkpos2083;  if (!yymatchChar('\t')) goto l2082;
+  }
+  l2083:;	
+  }  goto l2081;
+  l2082:;	  yypos= yypos2082; yythunkpos= yythunkpos2082;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2080;
+  }
+  }  goto l2079;
+  l2080:;	  yypos= yypos2080; yythunkpos= yythunkpos2080;
+  }
+  {  int yypos2085= yypos, yythunkpos2085= yythunkpos;
+  {  int yypos2086= yypos, yythunkpos2086= yythunkpos;  /* Indent */
+  {
+  {  int yypos2088= yypos, yythunkpos2088= yythunkpos;  if (!yymatchChar('\t')) goto l2089;  goto l2088;
+  l2089:;	  yypos= yypos2088; yythunkpos= yythunkpos2088;  if (!yymatchString("    ")) goto l2086;
+  }
+  l2088:;	
+  }  goto l2087;
+  l2086:;	  yypos= yypos2086; yythunkpos= yythunkpos2086;
+  }
+  l2087:;	
+  {  int yypos2090= yypos, yythunkpos2090= yythunkpos;  if (!yy_Bullet()) goto l2091;  goto l2090;
+  l2091:;	  yypos= yypos2090; yythunkpos= yythunkpos2090;  if (!yy_Enumerator()) goto l2085;
+  }
+  l2090:;	  goto l2079;
+  l2085:;	  yypos= yypos2085; yythunkpos= yythunkpos2085;
+  }
+  {  int yypos2092= yypos, yythunkpos2092= yythunkpos;  if (!yy_HorizontalRule()) goto l2092;  goto l2079;
+  l2092:;	  yypos= yypos2092; yythunkpos= yythunkpos2092;
+  }  /* OptionallyIndentedLine */
+  {
+  {  int yypos2093= yypos, yythunkpos2093= yythunkpos;  /* Indent */
+  {
+  {  int yypos2095= yypos, yythunkpos2095= yythunkpos;  if (!yymatchChar('\t')) goto l2096;  goto l2095;
+  l2096:;	  yypos= yypos2095; yythunkpos= yythunkpos2095;  if (!yymatchString("    ")) goto l2093;
+  }
+  l2095:;	
+  }  goto l2094;
+  l2093:;	  yypos= yypos2093; yythunkpos= yythunkpos2093;
+  }
+  l2094:;	  /* Line */
+  {  if (!yy_RawLine()) goto l2079;  yyDo(yy_1_Line, yybegin, yyend);
+  }
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListBlockLine", yybuf+yypos));
+  return 1;
+  l2079:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListBlockLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ListContinuationBlock()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListContinuationBlock"));  /* StartList */
+  {
+  {  int yypos2098= yypos, yythunkpos2098= yythunkpos;  if (!yymatchDot()) goto l2097;  yypos= yypos2098; yythunkpos= yythunkpos2098;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l2097;
+  l2099:;	
+  {  int yypos2100= yypos, yythunkpos2100= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2101:;	
+  {  int yypos2102= yypos, yythunkpos2102= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2103= yypos, yythunkpos2103= yythunkpos;  if (!yymatchChar(' ')) goto l2104;  goto l2103;
+  l2104:;	  yypos= yypos2103; yythunkpos= yythunkpos2103;  if (!yymatchChar('\t')) goto l2102;
+  }
+  l2103:;	
+  }  goto l2101;
+  l2102:;	  yypos= yypos2102; yythunkpos= yythunkpos2102;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2100;
+  }
+  }  goto l2099;
+  l2100:;	  yypos= yypos2100; yythunkpos= yythunkpos2100;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l2097;  yyDo(yy_1_ListContinuationBlock, yybegin, yyend);  /* Indent */
+  {
+  {  int yypos2107= yypos, yythunkpos2107= yythunkpos;  if (!yymatchChar('\t')) goto l2108;  goto l2107;
+  l2108:;	  yypos= yypos2107; yythunkpos= yythunkpos2107;  if (!yymatchString("    ")) goto l2097;
+  }
+  l2107:;	
+  }  if (!yy_ListBlock()) goto l2097;  yyDo(yy_2_ListContinuationBlock, yybegin, yyend);
+  l2105:;	
+  {  int yypos2106= yypos, yythunkpos2106= yythunkpos;  /* Indent */
+  {
+  {  int yypos2109= yypos, yythunkpos2109= yythunkpos;  if (!yymatchChar('\t')) goto l2110;  goto l2109;
+  l2110:;	  yypos= yypos2109; yythunkpos= yythunkpos2109;  if (!yymatchString("    ")) goto l2106;
+  }
+  l2109:;	
+  }  if (!yy_ListBlock()) goto l2106;  yyDo(yy_2_ListContinuationBlock, yybegin, yyend);  goto l2105;
+  l2106:;	  yypos= yypos2106; yythunkpos= yythunkpos2106;
+  }  yyDo(yy_3_ListContinuationBlock, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListContinuationBlock", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2097:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListContinuationBlock", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ListBlock()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListBlock"));  /* StartList */
+  {
+  {  int yypos2112= yypos, yythunkpos2112= yythunkpos;  if (!yymatchDot()) goto l2111;  yypos= yypos2112; yythunkpos= yythunkpos2112;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos2113= yypos, yythunkpos2113= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2114:;	
+  {  int yypos2115= yypos, yythunkpos2115= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2116= yypos, yythunkpos2116= yythunkpos;  if (!yymatchChar(' ')) goto l2117;  goto l2116;
+  l2117:;	  yypos= yypos2116; yythunkpos= yythunkpos2116;  if (!yymatchChar('\t')) goto l2115;
+  }
+  l2116:;	
+  }  goto l2114;
+  l2115:;	  yypos= yypos2115; yythunkpos= yythunkpos2115;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2113;
+  }
+  }  goto l2111;
+  l2113:;	  yypos= yypos2113; yythunkpos= yythunkpos2113;
+  }  /* Line */
+  {  if (!yy_RawLine()) goto l2111;  yyDo(yy_1_Line, yybegin, yyend);
+  }  yyDo(yy_1_ListBlock, yybegin, yyend);
+  l2118:;	
+  {  int yypos2119= yypos, yythunkpos2119= yythunkpos;  if (!yy_ListBlockLine()) goto l2119;  yyDo(yy_2_ListBlock, yybegin, yyend);  goto l2118;
+  l2119:;	  yypos= yypos2119; yythunkpos= yythunkpos2119;
+  }  yyDo(yy_3_ListBlock, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListBlock", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2111:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListBlock", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ListItem()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListItem"));
+  {  int yypos2121= yypos, yythunkpos2121= yythunkpos;  if (!yy_Bullet()) goto l2122;  goto l2121;
+  l2122:;	  yypos= yypos2121; yythunkpos= yythunkpos2121;  if (!yy_Enumerator()) goto l2120;
+  }
+  l2121:;	  /* StartList */
+  {
+  {  int yypos2123= yypos, yythunkpos2123= yythunkpos;  if (!yymatchDot()) goto l2120;  yypos= yypos2123; yythunkpos= yythunkpos2123;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  if (!yy_ListBlock()) goto l2120;  yyDo(yy_1_ListItem, yybegin, yyend);
+  l2124:;	
+  {  int yypos2125= yypos, yythunkpos2125= yythunkpos;  if (!yy_ListContinuationBlock()) goto l2125;  yyDo(yy_2_ListItem, yybegin, yyend);  goto l2124;
+  l2125:;	  yypos= yypos2125; yythunkpos= yythunkpos2125;
+  }  yyDo(yy_3_ListItem, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListItem", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2120:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListItem", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Enumerator()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Enumerator"));  if (!yy_NonindentSpace()) goto l2126;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2126;
+  l2127:;	
+  {  int yypos2128= yypos, yythunkpos2128= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2128;  goto l2127;
+  l2128:;	  yypos= yypos2128; yythunkpos= yythunkpos2128;
+  }  if (!yymatchChar('.')) goto l2126;  /* Spacechar */
+  {
+  {  int yypos2131= yypos, yythunkpos2131= yythunkpos;  if (!yymatchChar(' ')) goto l2132;  goto l2131;
+  l2132:;	  yypos= yypos2131; yythunkpos= yythunkpos2131;  if (!yymatchChar('\t')) goto l2126;
+  }
+  l2131:;	
+  }
+  l2129:;	
+  {  int yypos2130= yypos, yythunkpos2130= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2133= yypos, yythunkpos2133= yythunkpos;  if (!yymatchChar(' ')) goto l2134;  goto l2133;
+  l2134:;	  yypos= yypos2133; yythunkpos= yythunkpos2133;  if (!yymatchChar('\t')) goto l2130;
+  }
+  l2133:;	
+  }  goto l2129;
+  l2130:;	  yypos= yypos2130; yythunkpos= yythunkpos2130;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Enumerator", yybuf+yypos));
+  return 1;
+  l2126:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Enumerator", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ListItemTight()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListItemTight"));
+  {  int yypos2136= yypos, yythunkpos2136= yythunkpos;  if (!yy_Bullet()) goto l2137;  goto l2136;
+  l2137:;	  yypos= yypos2136; yythunkpos= yythunkpos2136;  if (!yy_Enumerator()) goto l2135;
+  }
+  l2136:;	  /* StartList */
+  {
+  {  int yypos2138= yypos, yythunkpos2138= yythunkpos;  if (!yymatchDot()) goto l2135;  yypos= yypos2138; yythunkpos= yythunkpos2138;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  if (!yy_ListBlock()) goto l2135;  yyDo(yy_1_ListItemTight, yybegin, yyend);
+  l2139:;	
+  {  int yypos2140= yypos, yythunkpos2140= yythunkpos;
+  {  int yypos2141= yypos, yythunkpos2141= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2142:;	
+  {  int yypos2143= yypos, yythunkpos2143= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2144= yypos, yythunkpos2144= yythunkpos;  if (!yymatchChar(' ')) goto l2145;  goto l2144;
+  l2145:;	  yypos= yypos2144; yythunkpos= yythunkpos2144;  if (!yymatchChar('\t')) goto l2143;
+  }
+  l2144:;	
+  }  goto l2142;
+  l2143:;	  yypos= yypos2143; yythunkpos= yythunkpos2143;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2141;
+  }
+  }  goto l2140;
+  l2141:;	  yypos= yypos2141; yythunkpos= yythunkpos2141;
+  }  if (!yy_ListContinuationBlock()) goto l2140;  yyDo(yy_2_ListItemTight, yybegin, yyend);  goto l2139;
+  l2140:;	  yypos= yypos2140; yythunkpos= yythunkpos2140;
+  }
+  {  int yypos2146= yypos, yythunkpos2146= yythunkpos;  if (!yy_ListContinuationBlock()) goto l2146;  goto l2135;
+  l2146:;	  yypos= yypos2146; yythunkpos= yythunkpos2146;
+  }  yyDo(yy_3_ListItemTight, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListItemTight", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2135:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListItemTight", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ListLoose()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "ListLoose"));  /* StartList */
+  {
+  {  int yypos2148= yypos, yythunkpos2148= yythunkpos;  if (!yymatchDot()) goto l2147;  yypos= yypos2148; yythunkpos= yythunkpos2148;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);  if (!yy_ListItem()) goto l2147;  yyDo(yySet, -1, 0);
+  l2151:;	
+  {  int yypos2152= yypos, yythunkpos2152= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2153:;	
+  {  int yypos2154= yypos, yythunkpos2154= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2155= yypos, yythunkpos2155= yythunkpos;  if (!yymatchChar(' ')) goto l2156;  goto l2155;
+  l2156:;	  yypos= yypos2155; yythunkpos= yythunkpos2155;  if (!yymatchChar('\t')) goto l2154;
+  }
+  l2155:;	
+  }  goto l2153;
+  l2154:;	  yypos= yypos2154; yythunkpos= yythunkpos2154;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2152;
+  }
+  }  goto l2151;
+  l2152:;	  yypos= yypos2152; yythunkpos= yythunkpos2152;
+  }  yyDo(yy_1_ListLoose, yybegin, yyend);
+  l2149:;	
+  {  int yypos2150= yypos, yythunkpos2150= yythunkpos;  if (!yy_ListItem()) goto l2150;  yyDo(yySet, -1, 0);
+  l2157:;	
+  {  int yypos2158= yypos, yythunkpos2158= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2159:;	
+  {  int yypos2160= yypos, yythunkpos2160= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2161= yypos, yythunkpos2161= yythunkpos;  if (!yymatchChar(' ')) goto l2162;  goto l2161;
+  l2162:;	  yypos= yypos2161; yythunkpos= yythunkpos2161;  if (!yymatchChar('\t')) goto l2160;
+  }
+  l2161:;	
+  }  goto l2159;
+  l2160:;	  yypos= yypos2160; yythunkpos= yythunkpos2160;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2158;
+  }
+  }  goto l2157;
+  l2158:;	  yypos= yypos2158; yythunkpos= yythunkpos2158;
+  }  yyDo(yy_1_ListLoose, yybegin, yyend);  goto l2149;
+  l2150:;	  yypos= yypos2150; yythunkpos= yythunkpos2150;
+  }  yyDo(yy_2_ListLoose, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListLoose", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l2147:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListLoose", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ListTight()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListTight"));  /* StartList */
+  {
+  {  int yypos2164= yypos, yythunkpos2164= yythunkpos;  if (!yymatchDot()) goto l2163;  yypos= yypos2164; yythunkpos= yythunkpos2164;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  if (!yy_ListItemTight()) goto l2163;  yyDo(yy_1_ListTight, yybegin, yyend);
+  l2165:;	
+  {  int yypos2166= yypos, yythunkpos2166= yythunkpos;  if (!yy_ListItemTight()) goto l2166;  yyDo(yy_1_ListTight, yybegin, yyend);  goto l2165;
+  l2166:;	  yypos= yypos2166; yythunkpos= yythunkpos2166;
+  }
+  l2167:;	
+  {  int yypos2168= yypos, yythunkpos2168= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2169:;	
+  {  int yypos2170= yypos, yythunkpos2170= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2171= yypos, yythunkpos2171= yythunkpos;  if (!yymatchChar(' ')) goto l2172;  goto l2171;
+  l2172:;	  yypos= yypos2171; yythunkpos= yythunkpos2171;  if (!yymatchChar('\t')) goto l2170;
+  }
+  l2171:;	
+  }  goto l2169;
+  l2170:;	  yypos= yypos2170; yythunkpos= yythunkpos2170;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2168;
+  }
+  }  goto l2167;
+  l2168:;	  yypos= yypos2168; yythunkpos= yythunkpos2168;
+  }
+  {  int yypos2173= yypos, yythunkpos2173= yythunkpos;
+  {  int yypos2174= yypos, yythunkpos2174= yythunkpos;  if (!yy_Bullet()) goto l2175;  goto l2174;
+  l2175:;	  yypos= yypos2174; yythunkpos= yythunkpos2174;  if (!yy_Enumerator()) goto l2173;
+  }
+  l2174:;	  goto l2163;
+  l2173:;	  yypos= yypos2173; yythunkpos= yythunkpos2173;
+  }  yyDo(yy_2_ListTight, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListTight", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2163:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListTight", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Spacechar()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Spacechar"));
+  {  int yypos2177= yypos, yythunkpos2177= yythunkpos;  if (!yymatchChar(' ')) goto l2178;  goto l2177;
+  l2178:;	  yypos= yypos2177; yythunkpos= yythunkpos2177;  if (!yymatchChar('\t')) goto l2176;
+  }
+  l2177:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Spacechar", yybuf+yypos));
+  return 1;
+  l2176:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Spacechar", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Bullet()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Bullet"));
+  {  int yypos2180= yypos, yythunkpos2180= yythunkpos;  if (!yy_HorizontalRule()) goto l2180;  goto l2179;
+  l2180:;	  yypos= yypos2180; yythunkpos= yythunkpos2180;
+  }  if (!yy_NonindentSpace()) goto l2179;
+  {  int yypos2181= yypos, yythunkpos2181= yythunkpos;  if (!yymatchChar('+')) goto l2182;  goto l2181;
+  l2182:;	  yypos= yypos2181; yythunkpos= yythunkpos2181;  if (!yymatchChar('*')) goto l2183;  goto l2181;
+  l2183:;	  yypos= yypos2181; yythunkpos= yythunkpos2181;  if (!yymatchChar('-')) goto l2179;
+  }
+  l2181:;	  /* Spacechar */
+  {
+  {  int yypos2186= yypos, yythunkpos2186= yythunkpos;  if (!yymatchChar(' ')) goto l2187;  goto l2186;
+  l2187:;	  yypos= yypos2186; yythunkpos= yythunkpos2186;  if (!yymatchChar('\t')) goto l2179;
+  }
+  l2186:;	
+  }
+  l2184:;	
+  {  int yypos2185= yypos, yythunkpos2185= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2188= yypos, yythunkpos2188= yythunkpos;  if (!yymatchChar(' ')) goto l2189;  goto l2188;
+  l2189:;	  yypos= yypos2188; yythunkpos= yythunkpos2188;  if (!yymatchChar('\t')) goto l2185;
+  }
+  l2188:;	
+  }  goto l2184;
+  l2185:;	  yypos= yypos2185; yythunkpos= yythunkpos2185;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Bullet", yybuf+yypos));
+  return 1;
+  l2179:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Bullet", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_VerbatimChunk()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "VerbatimChunk"));  /* StartList */
+  {
+  {  int yypos2191= yypos, yythunkpos2191= yythunkpos;  if (!yymatchDot()) goto l2190;  yypos= yypos2191; yythunkpos= yythunkpos2191;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  l2192:;	
+  {  int yypos2193= yypos, yythunkpos2193= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2194:;	
+  {  int yypos2195= yypos, yythunkpos2195= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2196= yypos, yythunkpos2196= yythunkpos;  if (!yymatchChar(' ')) goto l2197;  goto l2196;
+  l2197:;	  yypos= yypos2196; yythunkpos= yythunkpos2196;  if (!yymatchChar('\t')) goto l2195;
+  }
+  l2196:;	
+  }  goto l2194;
+  l2195:;	  yypos= yypos2195; yythunkpos= yythunkpos2195;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2193;
+  }
+  }  yyDo(yy_1_VerbatimChunk, yybegin, yyend);  goto l2192;
+  l2193:;	  yypos= yypos2193; yythunkpos= yythunkpos2193;
+  }  /* NonblankIndentedLine */
+  {
+  {  int yypos2200= yypos, yythunkpos2200= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2201:;	
+  {  int yypos2202= yypos, yythunkpos2202= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2203= yypos, yythunkpos2203= yythunkpos;  if (!yymatchChar(' ')) goto l2204;  goto l2203;
+  l2204:;	  yypos= yypos2203; yythunkpos= yythunkpos2203;  if (!yymatchChar('\t')) goto l2202;
+  }
+  l2203:;	
+  }  goto l2201;
+  l2202:;	  yypos= yypos2202; yythunkpos= yythunkpos2202;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2200;
+  }
+  }  goto l2190;
+  l2200:;	  yypos= yypos2200; yythunkpos= yythunkpos2200;
+  }  /* IndentedLine */
+  {  /* Indent */
+  {
+  {  int yypos2205= yypos, yythunkpos2205= yythunkpos;  if (!yymatchChar('\t')) goto l2206;  goto l2205;
+  l2206:;	  yypos= yypos2205; yythunkpos= yythunkpos2205;  if (!yymatchString("    ")) goto l2190;
+  }
+  l2205:;	
+  }  /* Line */
+  {  if (!yy_RawLine()) goto l2190;  yyDo(yy_1_Line, yybegin, yyend);
+  }
+  }
+  }  yyDo(yy_2_VerbatimChunk, yybegin, yyend);
+  l2198:;	
+  {  int yypos2199= yypos, yythunkpos2199= yythunkpos;  /* NonblankIndentedLine */
+  {
+  {  int yypos2207= yypos, yythunkpos2207= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2208:;	
+  {  int yypos2209= yypos, yythunkpos2209= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2210= yypos, yythunkpos2210= yythunkpos;  if (!yymatchChar(' ')) goto l2211;  goto l2210;
+  l2211:;	  yypos= yypos2210; yythunkpos= yythunkpos2210;  if (!yymatchChar('\t')) goto l2209;
+  }
+  l2210:;	
+  }  goto l2208;
+  l2209:;	  yypos= yypos2209; yythunkpos= yythunkpos2209;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2207;
+  }
+  }  goto l2199;
+  l2207:;	  yypos= yypos2207; yythunkpos= yythunkpos2207;
+  }  /* IndentedLine */
+  {  /* Indent */
+  {
+  {  int yypos2212= yypos, yythunkpos2212= yythunkpos;  if (!yymatchChar('\t')) goto l2213;  goto l2212;
+  l2213:;	  yypos= yypos2212; yythunkpos= yythunkpos2212;  if (!yymatchString("    ")) goto l2199;
+  }
+  l2212:;	
+  }  /* Line */
+  {  if (!yy_RawLine()) goto l2199;  yyDo(yy_1_Line, yybegin, yyend);
+  }
+  }
+  }  yyDo(yy_2_VerbatimChunk, yybegin, yyend);  goto l2198;
+  l2199:;	  yypos= yypos2199; yythunkpos= yythunkpos2199;
+  }  yyDo(yy_3_VerbatimChunk, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "VerbatimChunk", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2190:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "VerbatimChunk", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_IndentedLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "IndentedLine"));  /* Indent */
+  {
+  {  int yypos2215= yypos, yythunkpos2215= yythunkpos;  if (!yymatchChar('\t')) goto l2216;  goto l2215;
+  l2216:;	  yypos= yypos2215; yythunkpos= yythunkpos2215;  if (!yymatchString("    ")) goto l2214;
+  }
+  l2215:;	
+  }  /* Line */
+  {  if (!yy_RawLine()) goto l2214;  yyDo(yy_1_Line, yybegin, yyend);
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "IndentedLine", yybuf+yypos));
+  return 1;
+  l2214:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "IndentedLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_NonblankIndentedLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "NonblankIndentedLine"));
+  {  int yypos2218= yypos, yythunkpos2218= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2219:;	
+  {  int yypos2220= yypos, yythunkpos2220= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2221= yypos, yythunkpos2221= yythunkpos;  if (!yymatchChar(' ')) goto l2222;  goto l2221;
+  l2222:;	  yypos= yypos2221; yythunkpos= yythunkpos2221;  if (!yymatchChar('\t')) goto l2220;
+  }
+  l2221:;	
+  }  goto l2219;
+  l2220:;	  yypos= yypos2220; yythunkpos= yythunkpos2220;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2218;
+  }
+  }  goto l2217;
+  l2218:;	  yypos= yypos2218; yythunkpos= yythunkpos2218;
+  }  /* IndentedLine */
+  {  /* Indent */
+  {
+  {  int yypos2223= yypos, yythunkpos2223= yythunkpos;  if (!yymatchChar('\t')) goto l2224;  goto l2223;
+  l2224:;	  yypos= yypos2223; yythunkpos= yythunkpos2223;  if (!yymatchString("    ")) goto l2217;
+  }
+  l2223:;	
+  }  /* Line */
+  {  if (!yy_RawLine()) goto l2217;  yyDo(yy_1_Line, yybegin, yyend);
+  }
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonblankIndentedLine", yybuf+yypos));
+  return 1;
+  l2217:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NonblankIndentedLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Line()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Line"));  if (!yy_RawLine()) goto l2225;  yyDo(yy_1_Line, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Line", yybuf+yypos));
+  return 1;
+  l2225:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Line", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_BlockQuoteRaw()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "BlockQuoteRaw"));  /* StartList */
+  {
+  {  int yypos2227= yypos, yythunkpos2227= yythunkpos;  if (!yymatchDot()) goto l2226;  yypos= yypos2227; yythunkpos= yythunkpos2227;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  if (!yymatchChar('>')) goto l2226;
+  {  int yypos2230= yypos, yythunkpos2230= yythunkpos;  if (!yymatchChar(' ')) goto l2230;  goto l2231;
+  l2230:;	  yypos= yypos2230; yythunkpos= yythunkpos2230;
+  }
+  l2231:;	  /* Line */
+  {  if (!yy_RawLine()) goto l2226;  yyDo(yy_1_Line, yybegin, yyend);
+  }  yyDo(yy_1_BlockQuoteRaw, yybegin, yyend);
+  l2232:;	
+  {  int yypos2233= yypos, yythunkpos2233= yythunkpos;
+  {  int yypos2234= yypos, yythunkpos2234= yythunkpos;  if (!yymatchChar('>')) goto l2234;  goto l2233;
+  l2234:;	  yypos= yypos2234; yythunkpos= yythunkpos2234;
+  }
+  {  int yypos2235= yypos, yythunkpos2235= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2236:;	
+  {  int yypos2237= yypos, yythunkpos2237= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2238= yypos, yythunkpos2238= yythunkpos;  if (!yymatchChar(' ')) goto l2239;  goto l2238;
+  l2239:;	  yypos= yypos2238; yythunkpos= yythunkpos2238;  if (!yymatchChar('\t')) goto l2237;
+  }
+  l2238:;	
+  }  goto l2236;
+  l2237:;	  yypos= yypos2237; yythunkpos= yythunkpos2237;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2235;
+  }
+  }  goto l2233;
+  l2235:;	  yypos= yypos2235; yythunkpos= yythunkpos2235;
+  }  /* Line */
+  {  if (!yy_RawLine()) goto l2233;  yyDo(yy_1_Line, yybegin, yyend);
+  }  yyDo(yy_2_BlockQuoteRaw, yybegin, yyend);  goto l2232;
+  l2233:;	  yypos= yypos2233; yythunkpos= yythunkpos2233;
+  }
+  l2240:;	
+  {  int yypos2241= yypos, yythunkpos2241= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2242:;	
+  {  int yypos2243= yypos, yythunkpos2243= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2244= yypos, yythunkpos2244= yythunkpos;  if (!yymatchChar(' ')) goto l2245;  goto l2244;
+  l2245:;	  yypos= yypos2244; yythunkpos= yythunkpos2244;  if (!yymatchChar('\t')) goto l2243;
+  }
+  l2244:;	
+  }  goto l2242;
+  l2243:;	  yypos= yypos2243; yythunkpos= yythunkpos2243;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2241;
+  }
+  }  yyDo(yy_3_BlockQuoteRaw, yybegin, yyend);  goto l2240;
+  l2241:;	  yypos= yypos2241; yythunkpos= yythunkpos2241;
+  }
+  l2228:;	
+  {  int yypos2229= yypos, yythunkpos2229= yythunkpos;  if (!yymatchChar('>')) goto l2229;
+  {  int yypos2246= yypos, yythunkpos2246= yythunkpos;  if (!yymatchChar(' ')) goto l2246;  goto l2247;
+  l2246:;	  yypos= yypos2246; yythunkpos= yythunkpos2246;
+  }
+  l2247:;	  /* Line */
+  {  if (!yy_RawLine()) goto l2229;  yyDo(yy_1_Line, yybegin, yyend);
+  }  yyDo(yy_1_BlockQuoteRaw, yybegin, yyend);
+  l2248:;	
+  {  int yypos2249= yypos, yythunkpos2249= yythunkpos;
+  {  int yypos2250= yypos, yythunkpos2250= yythunkpos;  if (!yymatchChar('>')) goto l2250;  goto l2249;
+  l2250:;	  yypos= yypos2250; yythunkpos= yythunkpos2250;
+  }
+  {  int yypos2251= yypos, yythunkpos2251= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2252:;	
+  {  int yypos2253= yypos, yythunkpos2253= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2254= yypos, yythunkpos2254= yythunkpos;  if (!yymatchChar(' ')) goto l2255;  goto l2254;
+  l2255:;	  yypos= yypos2254; yythunkpos= yythunkpos2254;  if (!yymatchChar('\t')) goto l2253;
+  }
+  l2254:;	
+  }  goto l2252;
+  l2253:;	  yypos= yypos2253; yythunkpos= yythunkpos2253;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2251;
+  }
+  }  goto l2249;
+  l2251:;	  yypos= yypos2251; yythunkpos= yythunkpos2251;
+  }  /* Line */
+  {  if (!yy_RawLine()) goto l2249;  yyDo(yy_1_Line, yybegin, yyend);
+  }  yyDo(yy_2_BlockQuoteRaw, yybegin, yyend);  goto l2248;
+  l2249:;	  yypos= yypos2249; yythunkpos= yythunkpos2249;
+  }
+  l2256:;	
+  {  int yypos2257= yypos, yythunkpos2257= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2258:;	
+  {  int yypos2259= yypos, yythunkpos2259= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2260= yypos, yythunkpos2260= yythunkpos;  if (!yymatchChar(' ')) goto l2261;  goto l2260;
+  l2261:;	  yypos= yypos2260; yythunkpos= yythunkpos2260;  if (!yymatchChar('\t')) goto l2259;
+  }
+  l2260:;	
+  }  goto l2258;
+  l2259:;	  yypos= yypos2259; yythunkpos= yythunkpos2259;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2257;
+  }
+  }  yyDo(yy_3_BlockQuoteRaw, yybegin, yyend);  goto l2256;
+  l2257:;	  yypos= yypos2257; yythunkpos= yythunkpos2257;
+  }  goto l2228;
+  l2229:;	  yypos= yypos2229; yythunkpos= yythunkpos2229;
+  }  yyDo(yy_4_BlockQuoteRaw, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlockQuoteRaw", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2226:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlockQuoteRaw", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Endline()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Endline"));
+  {  int yypos2263= yypos, yythunkpos2263= yythunkpos;  if (!yy_LineBreak()) goto l2264;  goto l2263;
+  l2264:;	  yypos= yypos2263; yythunkpos= yythunkpos2263;  if (!yy_TerminalEndline()) goto l2265;  goto l2263;
+  l2265:;	  yypos= yypos2263; yythunkpos= yythunkpos2263;  if (!yy_NormalEndline()) goto l2262;
+  }
+  l2263:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Endline", yybuf+yypos));
+  return 1;
+  l2262:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Endline", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SetextBottom2()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "SetextBottom2"));  if (!yymatchString("---")) goto l2266;
+  l2267:;	
+  {  int yypos2268= yypos, yythunkpos2268= yythunkpos;  if (!yymatchChar('-')) goto l2268;  goto l2267;
+  l2268:;	  yypos= yypos2268; yythunkpos= yythunkpos2268;
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2266;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextBottom2", yybuf+yypos));
+  return 1;
+  l2266:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextBottom2", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SetextBottom1()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "SetextBottom1"));  if (!yymatchString("===")) goto l2269;
+  l2270:;	
+  {  int yypos2271= yypos, yythunkpos2271= yythunkpos;  if (!yymatchChar('=')) goto l2271;  goto l2270;
+  l2271:;	  yypos= yypos2271; yythunkpos= yythunkpos2271;
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2269;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextBottom1", yybuf+yypos));
+  return 1;
+  l2269:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextBottom1", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading2()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "SetextHeading2"));
+  {  int yypos2273= yypos, yythunkpos2273= yythunkpos;  if (!yy_RawLine()) goto l2272;  if (!yy_SetextBottom2()) goto l2272;  yypos= yypos2273; yythunkpos= yythunkpos2273;
+  }  /* StartList */
+  {
+  {  int yypos2274= yypos, yythunkpos2274= yythunkpos;  if (!yymatchDot()) goto l2272;  yypos= yypos2274; yythunkpos= yythunkpos2274;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);
+  {  int yypos2277= yypos, yythunkpos2277= yythunkpos;  /* Endline */
+  {
+  {  int yypos2278= yypos, yythunkpos2278= yythunkpos;  if (!yy_LineBreak()) goto l2279;  goto l2278;
+  l2279:;	  yypos= yypos2278; yythunkpos= yythunkpos2278;  if (!yy_TerminalEndline()) goto l2280;  goto l2278;
+  l2280:;	  yypos= yypos2278; yythunkpos= yythunkpos2278;  if (!yy_NormalEndline()) goto l2277;
+  }
+  l2278:;	
+  }  goto l2272;
+  l2277:;	  yypos= yypos2277; yythunkpos= yythunkpos2277;
+  }
+  {  int yypos2281= yypos, yythunkpos2281= yythunkpos;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2281;  /* Sp */
+  {
+  l2282:;	
+  {  int yypos2283= yypos, yythunkpos2283= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2284= yypos, yythunkpos2284= yythunkpos;  if (!yymatchChar(' ')) goto l2285;  goto l2284;
+  l2285:;	  yypos= yypos2284; yythunkpos= yythunkpos2284;  if (!yymatchChar('\t')) goto l2283;
+  }
+  l2284:;	
+  }  goto l2282;
+  l2283:;	  yypos= yypos2283; yythunkpos= yythunkpos2283;
+  }
+  }  if (!yy_AutoLabel()) goto l2281;  goto l2272;
+  l2281:;	  yypos= yypos2281; yythunkpos= yythunkpos2281;
+  }  if (!yy_Inline()) goto l2272;  yyDo(yy_1_SetextHeading2, yybegin, yyend);
+  l2275:;	
+  {  int yypos2276= yypos, yythunkpos2276= yythunkpos;
+  {  int yypos2286= yypos, yythunkpos2286= yythunkpos;  /* Endline */
+  {
+  {  int yypos2287= yypos, yythunkpos2287= yythunkpos;  if (!yy_LineBreak()) goto l2288;  goto l2287;
+  l2288:;	  yypos= yypos2287; yythunkpos= yythunkpos2287;  if (!yy_TerminalEndline()) goto l2289;  goto l2287;
+  l2289:;	  yypos= yypos2287; yythunkpos= yythunkpos2287;  if (!yy_NormalEndline()) goto l2286;
+  }
+  l2287:;	
+  }  goto l2276;
+  l2286:;	  yypos= yypos2286; yythunkpos= yythunkpos2286;
+  }
+  {  int yypos2290= yypos, yythunkpos2290= yythunkpos;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2290;  /* Sp */
+  {
+  l2291:;	
+  {  int yypos2292= yypos, yythunkpos2292= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2293= yypos, yythunkpos2293= yythunkpos;  if (!yymatchChar(' ')) goto l2294;  goto l2293;
+  l2294:;	  yypos= yypos2293; yythunkpos= yythunkpos2293;  if (!yymatchChar('\t')) goto l2292;
+  }
+  l2293:;	
+  }  goto l2291;
+  l2292:;	  yypos= yypos2292; yythunkpos= yythunkpos2292;
+  }
+  }  if (!yy_AutoLabel()) goto l2290;  goto l2276;
+  l2290:;	  yypos= yypos2290; yythunkpos= yythunkpos2290;
+  }  if (!yy_Inline()) goto l2276;  yyDo(yy_1_SetextHeading2, yybegin, yyend);  goto l2275;
+  l2276:;	  yypos= yypos2276; yythunkpos= yythunkpos2276;
+  }
+  {  int yypos2295= yypos, yythunkpos2295= yythunkpos;  /* Sp */
+  {
+  l2297:;	
+  {  int yypos2298= yypos, yythunkpos2298= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2299= yypos, yythunkpos2299= yythunkpos;  if (!yymatchChar(' ')) goto l2300;  goto l2299;
+  l2300:;	  yypos= yypos2299; yythunkpos= yythunkpos2299;  if (!yymatchChar('\t')) goto l2298;
+  }
+  l2299:;	
+  }  goto l2297;
+  l2298:;	  yypos= yypos2298; yythunkpos= yythunkpos2298;
+  }
+  }  if (!yy_AutoLabel()) goto l2295;  yyDo(yySet, -1, 0);  yyDo(yy_2_SetextHeading2, yybegin, yyend);
+  {  int yypos2301= yypos, yythunkpos2301= yythunkpos;  /* Sp */
+  {
+  l2303:;	
+  {  int yypos2304= yypos, yythunkpos2304= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2305= yypos, yythunkpos2305= yythunkpos;  if (!yymatchChar(' ')) goto l2306;  goto l2305;
+  l2306:;	  yypos= yypos2305; yythunkpos= yythunkpos2305;  if (!yymatchChar('\t')) goto l2304;
+  }
+  l2305:;	
+  }  goto l2303;
+  l2304:;	  yypos= yypos2304; yythunkpos= yythunkpos2304;
+  }
+  }  goto l2302;
+  l2301:;	  yypos= yypos2301; yythunkpos= yythunkpos2301;
+  }
+  l2302:;	  goto l2296;
+  l2295:;	  yypos= yypos2295; yythunkpos= yythunkpos2295;
+  }
+  l2296:;	
+  {  int yypos2307= yypos, yythunkpos2307= yythunkpos;  /* Sp */
+  {
+  l2309:;	
+  {  int yypos2310= yypos, yythunkpos2310= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2311= yypos, yythunkpos2311= yythunkpos;  if (!yymatchChar(' ')) goto l2312;  goto l2311;
+  l2312:;	  yypos= yypos2311; yythunkpos= yythunkpos2311;  if (!yymatchChar('\t')) goto l2310;
+  }
+  l2311:;	
+  }  goto l2309;
+  l2310:;	  yypos= yypos2310; yythunkpos= yythunkpos2310;
+  }
+  }  goto l2308;
+  l2307:;	  yypos= yypos2307; yythunkpos= yythunkpos2307;
+  }
+  l2308:;	  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2272;
+  }  if (!yy_SetextBottom2()) goto l2272;  yyDo(yy_3_SetextHeading2, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading2", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l2272:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading2", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading1()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "SetextHeading1"));
+  {  int yypos2314= yypos, yythunkpos2314= yythunkpos;  if (!yy_RawLine()) goto l2313;  if (!yy_SetextBottom1()) goto l2313;  yypos= yypos2314; yythunkpos= yythunkpos2314;
+  }  /* StartList */
+  {
+  {  int yypos2315= yypos, yythunkpos2315= yythunkpos;  if (!yymatchDot()) goto l2313;  yypos= yypos2315; yythunkpos= yythunkpos2315;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);
+  {  int yypos2318= yypos, yythunkpos2318= yythunkpos;  /* Endline */
+  {
+  {  int yypos2319= yypos, yythunkpos2319= yythunkpos;  if (!yy_LineBreak()) goto l2320;  goto l2319;
+  l2320:;	  yypos= yypos2319; yythunkpos= yythunkpos2319;  if (!yy_TerminalEndline()) goto l2321;  goto l2319;
+  l2321:;	  yypos= yypos2319; yythunkpos= yythunkpos2319;  if (!yy_NormalEndline()) goto l2318;
+  }
+  l2319:;	
+  }  goto l2313;
+  l2318:;	  yypos= yypos2318; yythunkpos= yythunkpos2318;
+  }
+  {  int yypos2322= yypos, yythunkpos2322= yythunkpos;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2322;  /* Sp */
+  {
+  l2323:;	
+  {  int yypos2324= yypos, yythunkpos2324= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2325= yypos, yythunkpos2325= yythunkpos;  if (!yymatchChar(' ')) goto l2326;  goto l2325;
+  l2326:;	  yypos= yypos2325; yythunkpos= yythunkpos2325;  if (!yymatchChar('\t')) goto l2324;
+  }
+  l2325:;	
+  }  goto l2323;
+  l2324:;	  yypos= yypos2324; yythunkpos= yythunkpos2324;
+  }
+  }  if (!yy_AutoLabel()) goto l2322;  goto l2313;
+  l2322:;	  yypos= yypos2322; yythunkpos= yythunkpos2322;
+  }  if (!yy_Inline()) goto l2313;  yyDo(yy_1_SetextHeading1, yybegin, yyend);
+  l2316:;	
+  {  int yypos2317= yypos, yythunkpos2317= yythunkpos;
+  {  int yypos2327= yypos, yythunkpos2327= yythunkpos;  /* Endline */
+  {
+  {  int yypos2328= yypos, yythunkpos2328= yythunkpos;  if (!yy_LineBreak()) goto l2329;  goto l2328;
+  l2329:;	  yypos= yypos2328; yythunkpos= yythunkpos2328;  if (!yy_TerminalEndline()) goto l2330;  goto l2328;
+  l2330:;	  yypos= yypos2328; yythunkpos= yythunkpos2328;  if (!yy_NormalEndline()) goto l2327;
+  }
+  l2328:;	
+  }  goto l2317;
+  l2327:;	  yypos= yypos2327; yythunkpos= yythunkpos2327;
+  }
+  {  int yypos2331= yypos, yythunkpos2331= yythunkpos;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2331;  /* Sp */
+  {
+  l2332:;	
+  {  int yypos2333= yypos, yythunkpos2333= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2334= yypos, yythunkpos2334= yythunkpos;  if (!yymatchChar(' ')) goto l2335;  goto l2334;
+  l2335:;	  yypos= yypos2334; yythunkpos= yythunkpos2334;  if (!yymatchChar('\t')) goto l2333;
+  }
+  l2334:;	
+  }  goto l2332;
+  l2333:;	  yypos= yypos2333; yythunkpos= yythunkpos2333;
+  }
+  }  if (!yy_AutoLabel()) goto l2331;  goto l2317;
+  l2331:;	  yypos= yypos2331; yythunkpos= yythunkpos2331;
+  }  if (!yy_Inline()) goto l2317;  yyDo(yy_1_SetextHeading1, yybegin, yyend);  goto l2316;
+  l2317:;	  yypos= yypos2317; yythunkpos= yythunkpos2317;
+  }
+  {  int yypos2336= yypos, yythunkpos2336= yythunkpos;  /* Sp */
+  {
+  l2338:;	
+  {  int yypos2339= yypos, yythunkpos2339= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2340= yypos, yythunkpos2340= yythunkpos;  if (!yymatchChar(' ')) goto l2341;  goto l2340;
+  l2341:;	  yypos= yypos2340; yythunkpos= yythunkpos2340;  if (!yymatchChar('\t')) goto l2339;
+  }
+  l2340:;	
+  }  goto l2338;
+  l2339:;	  yypos= yypos2339; yythunkpos= yythunkpos2339;
+  }
+  }  if (!yy_AutoLabel()) goto l2336;  yyDo(yySet, -1, 0);  yyDo(yy_2_SetextHeading1, yybegin, yyend);
+  {  int yypos2342= yypos, yythunkpos2342= yythunkpos;  /* Sp */
+  {
+  l2344:;	
+  {  int yypos2345= yypos, yythunkpos2345= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2346= yypos, yythunkpos2346= yythunkpos;  if (!yymatchChar(' ')) goto l2347;  goto l2346;
+  l2347:;	  yypos= yypos2346; yythunkpos= yythunkpos2346;  if (!yymatchChar('\t')) goto l2345;
+  }
+  l2346:;	
+  }  goto l2344;
+  l2345:;	  yypos= yypos2345; yythunkpos= yythunkpos2345;
+  }
+  }  goto l2343;
+  l2342:;	  yypos= yypos2342; yythunkpos= yythunkpos2342;
+  }
+  l2343:;	  goto l2337;
+  l2336:;	  yypos= yypos2336; yythunkpos= yythunkpos2336;
+  }
+  l2337:;	
+  {  int yypos2348= yypos, yythunkpos2348= yythunkpos;  /* Sp */
+  {
+  l2350:;	
+  {  int yypos2351= yypos, yythunkpos2351= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2352= yypos, yythunkpos2352= yythunkpos;  if (!yymatchChar(' ')) goto l2353;  goto l2352;
+  l2353:;	  yypos= yypos2352; yythunkpos= yythunkpos2352;  if (!yymatchChar('\t')) goto l2351;
+  }
+  l2352:;	
+  }  goto l2350;
+  l2351:;	  yypos= yypos2351; yythunkpos= yythunkpos2351;
+  }
+  }  goto l2349;
+  l2348:;	  yypos= yypos2348; yythunkpos= yythunkpos2348;
+  }
+  l2349:;	  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2313;
+  }  if (!yy_SetextBottom1()) goto l2313;  yyDo(yy_3_SetextHeading1, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading1", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l2313:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading1", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "SetextHeading"));
+  {  int yypos2355= yypos, yythunkpos2355= yythunkpos;  if (!yy_SetextHeading1()) goto l2356;  goto l2355;
+  l2356:;	  yypos= yypos2355; yythunkpos= yythunkpos2355;  if (!yy_SetextHeading2()) goto l2354;
+  }
+  l2355:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading", yybuf+yypos));
+  return 1;
+  l2354:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AtxHeading()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "AtxHeading"));  if (!yy_AtxStart()) goto l2357;  yyDo(yySet, -3, 0);
+  {  int yypos2358= yypos, yythunkpos2358= yythunkpos;  /* Sp */
+  {
+  l2360:;	
+  {  int yypos2361= yypos, yythunkpos2361= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2362= yypos, yythunkpos2362= yythunkpos;  if (!yymatchChar(' ')) goto l2363;  goto l2362;
+  l2363:;	  yypos= yypos2362; yythunkpos= yythunkpos2362;  if (!yymatchChar('\t')) goto l2361;
+  }
+  l2362:;	
+  }  goto l2360;
+  l2361:;	  yypos= yypos2361; yythunkpos= yythunkpos2361;
+  }
+  }  goto l2359;
+  l2358:;	  yypos= yypos2358; yythunkpos= yythunkpos2358;
+  }
+  l2359:;	  /* StartList */
+  {
+  {  int yypos2364= yypos, yythunkpos2364= yythunkpos;  if (!yymatchDot()) goto l2357;  yypos= yypos2364; yythunkpos= yythunkpos2364;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);  if (!yy_AtxInline()) goto l2357;  yyDo(yy_1_AtxHeading, yybegin, yyend);
+  l2365:;	
+  {  int yypos2366= yypos, yythunkpos2366= yythunkpos;  if (!yy_AtxInline()) goto l2366;  yyDo(yy_1_AtxHeading, yybegin, yyend);  goto l2365;
+  l2366:;	  yypos= yypos2366; yythunkpos= yythunkpos2366;
+  }
+  {  int yypos2367= yypos, yythunkpos2367= yythunkpos;
+  {  int yypos2369= yypos, yythunkpos2369= yythunkpos;  /* Sp */
+  {
+  l2371:;	
+  {  int yypos2372= yypos, yythunkpos2372= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2373= yypos, yythunkpos2373= yythunkpos;  if (!yymatchChar(' ')) goto l2374;  goto l2373;
+  l2374:;	  yypos= yypos2373; yythunkpos= yythunkpos2373;  if (!yymatchChar('\t')) goto l2372;
+  }
+  l2373:;	
+  }  goto l2371;
+  l2372:;	  yypos= yypos2372; yythunkpos= yythunkpos2372;
+  }
+  }  goto l2370;
+  l2369:;	  yypos= yypos2369; yythunkpos= yythunkpos2369;
+  }
+  l2370:;	  if (!yy_AutoLabel()) goto l2367;  yyDo(yySet, -1, 0);  yyDo(yy_2_AtxHeading, yybegin, yyend);  goto l2368;
+  l2367:;	  yypos= yypos2367; yythunkpos= yythunkpos2367;
+  }
+  l2368:;	
+  {  int yypos2375= yypos, yythunkpos2375= yythunkpos;
+  {  int yypos2377= yypos, yythunkpos2377= yythunkpos;  /* Sp */
+  {
+  l2379:;	
+  {  int yypos2380= yypos, yythunkpos2380= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2381= yypos, yythunkpos2381= yythunkpos;  if (!yymatchChar(' ')) goto l2382;  goto l2381;
+  l2382:;	  yypos= yypos2381; yythunkpos= yythunkpos2381;  if (!yymatchChar('\t')) goto l2380;
+  }
+  l2381:;	
+  }  goto l2379;
+  l2380:;	  yypos= yypos2380; yythunkpos= yythunkpos2380;
+  }
+  }  goto l2378;
+  l2377:;	  yypos= yypos2377; yythunkpos= yythunkpos2377;
+  }
+  l2378:;	
+  l2383:;	
+  {  int yypos2384= yypos, yythunkpos2384= yythunkpos;  if (!yymatchChar('#')) goto l2384;  goto l2383;
+  l2384:;	  yypos= yypos2384; yythunkpos= yythunkpos2384;
+  }  /* Sp */
+  {
+  l2385:;	
+  {  int yypos2386= yypos, yythunkpos2386= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2387= yypos, yythunkpos2387= yythunkpos;  if (!yymatchChar(' ')) goto l2388;  goto l2387;
+  l2388:;	  yypos= yypos2387; yythunkpos= yythunkpos2387;  if (!yymatchChar('\t')) goto l2386;
+  }
+  l2387:;	
+  }  goto l2385;
+  l2386:;	  yypos= yypos2386; yythunkpos= yythunkpos2386;
+  }
+  }  goto l2376;
+  l2375:;	  yypos= yypos2375; yythunkpos= yythunkpos2375;
+  }
+  l2376:;	  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2357;
+  }  yyDo(yy_3_AtxHeading, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxHeading", yybuf+yypos));  yyDo(yyPop, 3, 0);
+  return 1;
+  l2357:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxHeading", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AtxStart()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "AtxStart"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l2389;
+  {  int yypos2390= yypos, yythunkpos2390= yythunkpos;  if (!yymatchString("######")) goto l2391;  goto l2390;
+  l2391:;	  yypos= yypos2390; yythunkpos= yythunkpos2390;  if (!yymatchString("#####")) goto l2392;  goto l2390;
+  l2392:;	  yypos= yypos2390; yythunkpos= yythunkpos2390;  if (!yymatchString("####")) goto l2393;  goto l2390;
+  l2393:;	  yypos= yypos2390; yythunkpos= yythunkpos2390;  if (!yymatchString("###")) goto l2394;  goto l2390;
+  l2394:;	  yypos= yypos2390; yythunkpos= yythunkpos2390;  if (!yymatchString("##")) goto l2395;  goto l2390;
+  l2395:;	  yypos= yypos2390; yythunkpos= yythunkpos2390;  if (!yymatchChar('#')) goto l2389;
+  }
+  l2390:;	  yyText(yybegin, yyend);  if (!(YY_END)) goto l2389;  yyDo(yy_1_AtxStart, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxStart", yybuf+yypos));
+  return 1;
+  l2389:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxStart", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Inline()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Inline"));
+  {  int yypos2397= yypos, yythunkpos2397= yythunkpos;  if (!yy_Str()) goto l2398;  goto l2397;
+  l2398:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2399;  if (!yy_MathSpan()) goto l2399;  goto l2397;
+  l2399:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  /* Endline */
+  {
+  {  int yypos2401= yypos, yythunkpos2401= yythunkpos;  if (!yy_LineBreak()) goto l2402;  goto l2401;
+  l2402:;	  yypos= yypos2401; yythunkpos= yythunkpos2401;  if (!yy_TerminalEndline()) goto l2403;  goto l2401;
+  l2403:;	  yypos= yypos2401; yythunkpos= yythunkpos2401;  if (!yy_NormalEndline()) goto l2400;
+  }
+  l2401:;	
+  }  goto l2397;
+  l2400:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  if (!yy_UlOrStarLine()) goto l2404;  goto l2397;
+  l2404:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  /* Space */
+  {  /* Spacechar */
+  {
+  {  int yypos2408= yypos, yythunkpos2408= yythunkpos;  if (!yymatchChar(' ')) goto l2409;  goto l2408;
+  l2409:;	  yypos= yypos2408; yythunkpos= yythunkpos2408;  if (!yymatchChar('\t')) goto l2405;
+  }
+  l2408:;	
+  }
+  l2406:;	
+  {  int yypos2407= yypos, yythunkpos2407= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2410= yypos, yythunkpos2410= yythunkpos;  if (!yymatchChar(' ')) goto l2411;  goto l2410;
+  l2411:;	  yypos= yypos2410; yythunkpos= yythunkpos2410;  if (!yymatchChar('\t')) goto l2407;
+  }
+  l2410:;	
+  }  goto l2406;
+  l2407:;	  yypos= yypos2407; yythunkpos= yythunkpos2407;
+  }  yyDo(yy_1_Space, yybegin, yyend);
+  }  goto l2397;
+  l2405:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  /* Strong */
+  {
+  {  int yypos2413= yypos, yythunkpos2413= yythunkpos;  if (!yy_StrongStar()) goto l2414;  goto l2413;
+  l2414:;	  yypos= yypos2413; yythunkpos= yythunkpos2413;  if (!yy_StrongUl()) goto l2412;
+  }
+  l2413:;	
+  }  goto l2397;
+  l2412:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  /* Emph */
+  {
+  {  int yypos2416= yypos, yythunkpos2416= yythunkpos;  if (!yy_EmphStar()) goto l2417;  goto l2416;
+  l2417:;	  yypos= yypos2416; yythunkpos= yythunkpos2416;  if (!yy_EmphUl()) goto l2415;
+  }
+  l2416:;	
+  }  goto l2397;
+  l2415:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2418;  if (!yy_CitationReference()) goto l2418;  goto l2397;
+  l2418:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  if (!yy_Image()) goto l2419;  goto l2397;
+  l2419:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  /* Link */
+  {
+  {  int yypos2421= yypos, yythunkpos2421= yythunkpos;  if (!yy_ExplicitLink()) goto l2422;  goto l2421;
+  l2422:;	  yypos= yypos2421; yythunkpos= yythunkpos2421;  /* ReferenceLink */
+  {
+  {  int yypos2424= yypos, yythunkpos2424= yythunkpos;  if (!yy_ReferenceLinkDouble()) goto l2425;  goto l2424;
+  l2425:;	  yypos= yypos2424; yythunkpos= yythunkpos2424;  if (!yy_ReferenceLinkSingle()) goto l2423;
+  }
+  l2424:;	
+  }  goto l2421;
+  l2423:;	  yypos= yypos2421; yythunkpos= yythunkpos2421;  /* AutoLink */
+  {
+  {  int yypos2426= yypos, yythunkpos2426= yythunkpos;  if (!yy_AutoLinkUrl()) goto l2427;  goto l2426;
+  l2427:;	  yypos= yypos2426; yythunkpos= yythunkpos2426;  if (!yy_AutoLinkEmail()) goto l2420;
+  }
+  l2426:;	
+  }
+  }
+  l2421:;	
+  }  goto l2397;
+  l2420:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  if (!yy_NoteReference()) goto l2428;  goto l2397;
+  l2428:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  if (!yy_Code()) goto l2429;  goto l2397;
+  l2429:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  if (!yy_MarkdownHtmlTagOpen()) goto l2430;  goto l2397;
+  l2430:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  if (!yy_RawHtml()) goto l2431;  goto l2397;
+  l2431:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  if (!yy_Entity()) goto l2432;  goto l2397;
+  l2432:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  if (!yy_EscapedChar()) goto l2433;  goto l2397;
+  l2433:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  if (!yy_Smart()) goto l2434;  goto l2397;
+  l2434:;	  yypos= yypos2397; yythunkpos= yythunkpos2397;  if (!yy_Symbol()) goto l2396;
+  }
+  l2397:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Inline", yybuf+yypos));
+  return 1;
+  l2396:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Inline", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLabel()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "AutoLabel"));  if (!yymatchChar('[')) goto l2435;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l2435;
+  {  int yypos2436= yypos, yythunkpos2436= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2436;
+  }  goto l2435;
+  l2436:;	  yypos= yypos2436; yythunkpos= yythunkpos2436;
+  }
+  {  int yypos2437= yypos, yythunkpos2437= yythunkpos;  if (!yymatchChar('^')) goto l2437;  goto l2435;
+  l2437:;	  yypos= yypos2437; yythunkpos= yythunkpos2437;
+  }
+  {  int yypos2438= yypos, yythunkpos2438= yythunkpos;  if (!yymatchChar('#')) goto l2438;  goto l2435;
+  l2438:;	  yypos= yypos2438; yythunkpos= yythunkpos2438;
+  }  if (!yymatchDot()) goto l2435;
+  {  int yypos2441= yypos, yythunkpos2441= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2441;
+  }  goto l2435;
+  l2441:;	  yypos= yypos2441; yythunkpos= yythunkpos2441;
+  }
+  {  int yypos2442= yypos, yythunkpos2442= yythunkpos;  if (!yymatchChar(']')) goto l2442;  goto l2435;
+  l2442:;	  yypos= yypos2442; yythunkpos= yythunkpos2442;
+  }  if (!yymatchDot()) goto l2435;
+  l2439:;	
+  {  int yypos2440= yypos, yythunkpos2440= yythunkpos;
+  {  int yypos2443= yypos, yythunkpos2443= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2443;
+  }  goto l2440;
+  l2443:;	  yypos= yypos2443; yythunkpos= yythunkpos2443;
+  }
+  {  int yypos2444= yypos, yythunkpos2444= yythunkpos;  if (!yymatchChar(']')) goto l2444;  goto l2440;
+  l2444:;	  yypos= yypos2444; yythunkpos= yythunkpos2444;
+  }  if (!yymatchDot()) goto l2440;  goto l2439;
+  l2440:;	  yypos= yypos2440; yythunkpos= yythunkpos2440;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l2435;  if (!yymatchChar(']')) goto l2435;
+  {  int yypos2445= yypos, yythunkpos2445= yythunkpos;
+  {  int yypos2446= yypos, yythunkpos2446= yythunkpos;
+  {  int yypos2447= yypos, yythunkpos2447= yythunkpos;  /* Sp */
+  {
+  l2449:;	
+  {  int yypos2450= yypos, yythunkpos2450= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2451= yypos, yythunkpos2451= yythunkpos;  if (!yymatchChar(' ')) goto l2452;  goto l2451;
+  l2452:;	  yypos= yypos2451; yythunkpos= yythunkpos2451;  if (!yymatchChar('\t')) goto l2450;
+  }
+  l2451:;	
+  }  goto l2449;
+  l2450:;	  yypos= yypos2450; yythunkpos= yythunkpos2450;
+  }
+  }  goto l2448;
+  l2447:;	  yypos= yypos2447; yythunkpos= yythunkpos2447;
+  }
+  l2448:;	
+  {  int yypos2453= yypos, yythunkpos2453= yythunkpos;  if (!yymatchChar('(')) goto l2454;  goto l2453;
+  l2454:;	  yypos= yypos2453; yythunkpos= yythunkpos2453;  if (!yymatchChar('[')) goto l2446;
+  }
+  l2453:;	  goto l2435;
+  l2446:;	  yypos= yypos2446; yythunkpos= yythunkpos2446;
+  }  yypos= yypos2445; yythunkpos= yythunkpos2445;
+  }  yyDo(yy_1_AutoLabel, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLabel", yybuf+yypos));
+  return 1;
+  l2435:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLabel", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AtxInline()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "AtxInline"));
+  {  int yypos2456= yypos, yythunkpos2456= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2456;
+  }  goto l2455;
+  l2456:;	  yypos= yypos2456; yythunkpos= yythunkpos2456;
+  }
+  {  int yypos2457= yypos, yythunkpos2457= yythunkpos;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2457;  /* Sp */
+  {
+  l2458:;	
+  {  int yypos2459= yypos, yythunkpos2459= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2460= yypos, yythunkpos2460= yythunkpos;  if (!yymatchChar(' ')) goto l2461;  goto l2460;
+  l2461:;	  yypos= yypos2460; yythunkpos= yythunkpos2460;  if (!yymatchChar('\t')) goto l2459;
+  }
+  l2460:;	
+  }  goto l2458;
+  l2459:;	  yypos= yypos2459; yythunkpos= yythunkpos2459;
+  }
+  }  if (!yy_AutoLabel()) goto l2457;
+  {  int yypos2462= yypos, yythunkpos2462= yythunkpos;  /* Sp */
+  {
+  l2464:;	
+  {  int yypos2465= yypos, yythunkpos2465= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2466= yypos, yythunkpos2466= yythunkpos;  if (!yymatchChar(' ')) goto l2467;  goto l2466;
+  l2467:;	  yypos= yypos2466; yythunkpos= yythunkpos2466;  if (!yymatchChar('\t')) goto l2465;
+  }
+  l2466:;	
+  }  goto l2464;
+  l2465:;	  yypos= yypos2465; yythunkpos= yythunkpos2465;
+  }
+  }  goto l2463;
+  l2462:;	  yypos= yypos2462; yythunkpos= yythunkpos2462;
+  }
+  l2463:;	
+  l2468:;	
+  {  int yypos2469= yypos, yythunkpos2469= yythunkpos;  if (!yymatchChar('#')) goto l2469;  goto l2468;
+  l2469:;	  yypos= yypos2469; yythunkpos= yythunkpos2469;
+  }  /* Sp */
+  {
+  l2470:;	
+  {  int yypos2471= yypos, yythunkpos2471= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2472= yypos, yythunkpos2472= yythunkpos;  if (!yymatchChar(' ')) goto l2473;  goto l2472;
+  l2473:;	  yypos= yypos2472; yythunkpos= yythunkpos2472;  if (!yymatchChar('\t')) goto l2471;
+  }
+  l2472:;	
+  }  goto l2470;
+  l2471:;	  yypos= yypos2471; yythunkpos= yythunkpos2471;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2457;
+  }  goto l2455;
+  l2457:;	  yypos= yypos2457; yythunkpos= yythunkpos2457;
+  }
+  {  int yypos2474= yypos, yythunkpos2474= yythunkpos;
+  {  int yypos2475= yypos, yythunkpos2475= yythunkpos;  /* Sp */
+  {
+  l2477:;	
+  {  int yypos2478= yypos, yythunkpos2478= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2479= yypos, yythunkpos2479= yythunkpos;  if (!yymatchChar(' ')) goto l2480;  goto l2479;
+  l2480:;	  yypos= yypos2479; yythunkpos= yythunkpos2479;  if (!yymatchChar('\t')) goto l2478;
+  }
+  l2479:;	
+  }  goto l2477;
+  l2478:;	  yypos= yypos2478; yythunkpos= yythunkpos2478;
+  }
+  }  goto l2476;
+  l2475:;	  yypos= yypos2475; yythunkpos= yythunkpos2475;
+  }
+  l2476:;	
+  l2481:;	
+  {  int yypos2482= yypos, yythunkpos2482= yythunkpos;  if (!yymatchChar('#')) goto l2482;  goto l2481;
+  l2482:;	  yypos= yypos2482; yythunkpos= yythunkpos2482;
+  }  /* Sp */
+  {
+  l2483:;	
+  {  int yypos2484= yypos, yythunkpos2484= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2485= yypos, yythunkpos2485= yythunkpos;  if (!yymatchChar(' ')) goto l2486;  goto l2485;
+  l2486:;	  yypos= yypos2485; yythunkpos= yythunkpos2485;  if (!yymatchChar('\t')) goto l2484;
+  }
+  l2485:;	
+  }  goto l2483;
+  l2484:;	  yypos= yypos2484; yythunkpos= yythunkpos2484;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2474;
+  }  goto l2455;
+  l2474:;	  yypos= yypos2474; yythunkpos= yythunkpos2474;
+  }  if (!yy_Inline()) goto l2455;
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxInline", yybuf+yypos));
+  return 1;
+  l2455:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxInline", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Inlines()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "Inlines"));  /* StartList */
+  {
+  {  int yypos2488= yypos, yythunkpos2488= yythunkpos;  if (!yymatchDot()) goto l2487;  yypos= yypos2488; yythunkpos= yythunkpos2488;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -3, 0);
+  {  int yypos2491= yypos, yythunkpos2491= yythunkpos;
+  {  int yypos2493= yypos, yythunkpos2493= yythunkpos;  /* Endline */
+  {
+  {  int yypos2494= yypos, yythunkpos2494= yythunkpos;  if (!yy_LineBreak()) goto l2495;  goto l2494;
+  l2495:;	  yypos= yypos2494; yythunkpos= yythunkpos2494;  if (!yy_TerminalEndline()) goto l2496;  goto l2494;
+  l2496:;	  yypos= yypos2494; yythunkpos= yythunkpos2494;  if (!yy_NormalEndline()) goto l2493;
+  }
+  l2494:;	
+  }  goto l2492;
+  l2493:;	  yypos= yypos2493; yythunkpos= yythunkpos2493;
+  }  if (!yy_Inline()) goto l2492;  yyDo(yy_1_Inlines, yybegin, yyend);  goto l2491;
+  l2492:;	  yypos= yypos2491; yythunkpos= yythunkpos2491;  /* Endline */
+  {
+  {  int yypos2497= yypos, yythunkpos2497= yythunkpos;  if (!yy_LineBreak()) goto l2498;  goto l2497;
+  l2498:;	  yypos= yypos2497; yythunkpos= yythunkpos2497;  if (!yy_TerminalEndline()) goto l2499;  goto l2497;
+  l2499:;	  yypos= yypos2497; yythunkpos= yythunkpos2497;  if (!yy_NormalEndline()) goto l2487;
+  }
+  l2497:;	
+  }  yyDo(yySet, -2, 0);
+  {  int yypos2500= yypos, yythunkpos2500= yythunkpos;  if (!yy_Inline()) goto l2487;  yypos= yypos2500; yythunkpos= yythunkpos2500;
+  }  yyDo(yy_2_Inlines, yybegin, yyend);
+  }
+  l2491:;	
+  l2489:;	
+  {  int yypos2490= yypos, yythunkpos2490= yythunkpos;
+  {  int yypos2501= yypos, yythunkpos2501= yythunkpos;
+  {  int yypos2503= yypos, yythunkpos2503= yythunkpos;  /* Endline */
+  {
+  {  int yypos2504= yypos, yythunkpos2504= yythunkpos;  if (!yy_LineBreak()) goto l2505;  goto l2504;
+  l2505:;	  yypos= yypos2504; yythunkpos= yythunkpos2504;  if (!yy_TerminalEndline()) goto l2506;  goto l2504;
+  l2506:;	  yypos= yypos2504; yythunkpos= yythunkpos2504;  if (!yy_NormalEndline()) goto l2503;
+  }
+  l2504:;	
+  }  goto l2502;
+  l2503:;	  yypos= yypos2503; yythunkpos= yythunkpos2503;
+  }  if (!yy_Inline()) goto l2502;  yyDo(yy_1_Inlines, yybegin, yyend);  goto l2501;
+  l2502:;	  yypos= yypos2501; yythunkpos= yythunkpos2501;  /* Endline */
+  {
+  {  int yypos2507= yypos, yythunkpos2507= yythunkpos;  if (!yy_LineBreak()) goto l2508;  goto l2507;
+  l2508:;	  yypos= yypos2507; yythunkpos= yythunkpos2507;  if (!yy_TerminalEndline()) goto l2509;  goto l2507;
+  l2509:;	  yypos= yypos2507; yythunkpos= yythunkpos2507;  if (!yy_NormalEndline()) goto l2490;
+  }
+  l2507:;	
+  }  yyDo(yySet, -2, 0);
+  {  int yypos2510= yypos, yythunkpos2510= yythunkpos;  if (!yy_Inline()) goto l2490;  yypos= yypos2510; yythunkpos= yythunkpos2510;
+  }  yyDo(yy_2_Inlines, yybegin, yyend);
+  }
+  l2501:;	  goto l2489;
+  l2490:;	  yypos= yypos2490; yythunkpos= yythunkpos2490;
+  }
+  {  int yypos2511= yypos, yythunkpos2511= yythunkpos;  /* Endline */
+  {
+  {  int yypos2513= yypos, yythunkpos2513= yythunkpos;  if (!yy_LineBreak()) goto l2514;  goto l2513;
+  l2514:;	  yypos= yypos2513; yythunkpos= yythunkpos2513;  if (!yy_TerminalEndline()) goto l2515;  goto l2513;
+  l2515:;	  yypos= yypos2513; yythunkpos= yythunkpos2513;  if (!yy_NormalEndline()) goto l2511;
+  }
+  l2513:;	
+  }  yyDo(yySet, -1, 0);  yyDo(yy_3_Inlines, yybegin, yyend);  goto l2512;
+  l2511:;	  yypos= yypos2511; yythunkpos= yythunkpos2511;
+  }
+  l2512:;	  yyDo(yy_4_Inlines, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Inlines", yybuf+yypos));  yyDo(yyPop, 3, 0);
+  return 1;
+  l2487:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Inlines", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_NonindentSpace()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "NonindentSpace"));
+  {  int yypos2517= yypos, yythunkpos2517= yythunkpos;  if (!yymatchString("   ")) goto l2518;  goto l2517;
+  l2518:;	  yypos= yypos2517; yythunkpos= yythunkpos2517;  if (!yymatchString("  ")) goto l2519;  goto l2517;
+  l2519:;	  yypos= yypos2517; yythunkpos= yythunkpos2517;  if (!yymatchChar(' ')) goto l2520;  goto l2517;
+  l2520:;	  yypos= yypos2517; yythunkpos= yythunkpos2517;  if (!yymatchString("")) goto l2516;
+  }
+  l2517:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonindentSpace", yybuf+yypos));
+  return 1;
+  l2516:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NonindentSpace", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Heading()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Heading"));
+  {  int yypos2522= yypos, yythunkpos2522= yythunkpos;  /* SetextHeading */
+  {
+  {  int yypos2524= yypos, yythunkpos2524= yythunkpos;  if (!yy_SetextHeading1()) goto l2525;  goto l2524;
+  l2525:;	  yypos= yypos2524; yythunkpos= yythunkpos2524;  if (!yy_SetextHeading2()) goto l2523;
+  }
+  l2524:;	
+  }  goto l2522;
+  l2523:;	  yypos= yypos2522; yythunkpos= yythunkpos2522;  if (!yy_AtxHeading()) goto l2521;
+  }
+  l2522:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Heading", yybuf+yypos));
+  return 1;
+  l2521:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Heading", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_HeadingSectionBlock()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HeadingSectionBlock"));
+  l2527:;	
+  {  int yypos2528= yypos, yythunkpos2528= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2529:;	
+  {  int yypos2530= yypos, yythunkpos2530= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2531= yypos, yythunkpos2531= yythunkpos;  if (!yymatchChar(' ')) goto l2532;  goto l2531;
+  l2532:;	  yypos= yypos2531; yythunkpos= yythunkpos2531;  if (!yymatchChar('\t')) goto l2530;
+  }
+  l2531:;	
+  }  goto l2529;
+  l2530:;	  yypos= yypos2530; yythunkpos= yythunkpos2530;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2528;
+  }
+  }  goto l2527;
+  l2528:;	  yypos= yypos2528; yythunkpos= yythunkpos2528;
+  }
+  {  int yypos2533= yypos, yythunkpos2533= yythunkpos;  /* Heading */
+  {
+  {  int yypos2534= yypos, yythunkpos2534= yythunkpos;  /* SetextHeading */
+  {
+  {  int yypos2536= yypos, yythunkpos2536= yythunkpos;  if (!yy_SetextHeading1()) goto l2537;  goto l2536;
+  l2537:;	  yypos= yypos2536; yythunkpos= yythunkpos2536;  if (!yy_SetextHeading2()) goto l2535;
+  }
+  l2536:;	
+  }  goto l2534;
+  l2535:;	  yypos= yypos2534; yythunkpos= yythunkpos2534;  if (!yy_AtxHeading()) goto l2533;
+  }
+  l2534:;	
+  }  goto l2526;
+  l2533:;	  yypos= yypos2533; yythunkpos= yythunkpos2533;
+  }
+  {  int yypos2538= yypos, yythunkpos2538= yythunkpos;  if (!yy_BlockQuote()) goto l2539;  goto l2538;
+  l2539:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  if (!yy_Verbatim()) goto l2540;  goto l2538;
+  l2540:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2541;  if (!yy_DefinitionList()) goto l2541;  goto l2538;
+  l2541:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2542;  if (!yy_Glossary()) goto l2542;  goto l2538;
+  l2542:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  if (!yy_Note()) goto l2543;  goto l2538;
+  l2543:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  if (!yy_Reference()) goto l2544;  goto l2538;
+  l2544:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  if (!yy_HorizontalRule()) goto l2545;  goto l2538;
+  l2545:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  if (!yy_OrderedList()) goto l2546;  goto l2538;
+  l2546:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  if (!yy_BulletList()) goto l2547;  goto l2538;
+  l2547:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  if (!yy_HtmlBlock()) goto l2548;  goto l2538;
+  l2548:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  if (!yy_StyleBlock()) goto l2549;  goto l2538;
+  l2549:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2550;  if (!yy_Table()) goto l2550;  goto l2538;
+  l2550:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2551;  if (!yy_ImageBlock()) goto l2551;  goto l2538;
+  l2551:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;
+  {  int yypos2553= yypos, yythunkpos2553= yythunkpos;
+  {  int yypos2554= yypos, yythunkpos2554= yythunkpos;  /* Sp */
+  {
+  l2556:;	
+  {  int yypos2557= yypos, yythunkpos2557= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2558= yypos, yythunkpos2558= yythunkpos;  if (!yymatchChar(' ')) goto l2559;  goto l2558;
+  l2559:;	  yypos= yypos2558; yythunkpos= yythunkpos2558;  if (!yymatchChar('\t')) goto l2557;
+  }
+  l2558:;	
+  }  goto l2556;
+  l2557:;	  yypos= yypos2557; yythunkpos= yythunkpos2557;
+  }
+  }  goto l2555;
+  l2554:;	  yypos= yypos2554; yythunkpos= yythunkpos2554;
+  }
+  l2555:;	  if (!yy_HtmlBlockOpenDiv()) goto l2553;  goto l2552;
+  l2553:;	  yypos= yypos2553; yythunkpos= yythunkpos2553;
+  }  if (!yy_Para()) goto l2552;  goto l2538;
+  l2552:;	  yypos= yypos2538; yythunkpos= yythunkpos2538;  if (!yy_Plain()) goto l2526;
+  }
+  l2538:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "HeadingSectionBlock", yybuf+yypos));
+  return 1;
+  l2526:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HeadingSectionBlock", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Plain()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Plain"));  if (!yy_Inlines()) goto l2560;  yyDo(yySet, -1, 0);  yyDo(yy_1_Plain, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Plain", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2560:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Plain", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Para()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Para"));  if (!yy_NonindentSpace()) goto l2561;  if (!yy_Inlines()) goto l2561;  yyDo(yySet, -1, 0);  /* BlankLine */
+  {  /* Sp */
+  {
+  l2564:;	
+  {  int yypos2565= yypos, yythunkpos2565= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2566= yypos, yythunkpos2566= yythunkpos;  if (!yymatchChar(' ')) goto l2567;  goto l2566;
+  l2567:;	  yypos= yypos2566; yythunkpos= yythunkpos2566;  if (!yymatchChar('\t')) goto l2565;
+  }
+  l2566:;	
+  }  goto l2564;
+  l2565:;	  yypos= yypos2565; yythunkpos= yythunkpos2565;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2561;
+  }
+  }
+  l2562:;	
+  {  int yypos2563= yypos, yythunkpos2563= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2568:;	
+  {  int yypos2569= yypos, yythunkpos2569= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2570= yypos, yythunkpos2570= yythunkpos;  if (!yymatchChar(' ')) goto l2571;  goto l2570;
+  l2571:;	  yypos= yypos2570; yythunkpos= yythunkpos2570;  if (!yymatchChar('\t')) goto l2569;
+  }
+  l2570:;	
+  }  goto l2568;
+  l2569:;	  yypos= yypos2569; yythunkpos= yythunkpos2569;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2563;
+  }
+  }  goto l2562;
+  l2563:;	  yypos= yypos2563; yythunkpos= yythunkpos2563;
+  }  yyDo(yy_1_Para, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Para", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2561:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Para", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlockOpenDiv()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenDiv"));  if (!yymatchChar('<')) goto l2572;  if (!yy_Spnl()) goto l2572;
+  {  int yypos2573= yypos, yythunkpos2573= yythunkpos;  if (!yymatchString("div")) goto l2574;  goto l2573;
+  l2574:;	  yypos= yypos2573; yythunkpos= yythunkpos2573;  if (!yymatchString("DIV")) goto l2572;
+  }
+  l2573:;	  if (!yy_Spnl()) goto l2572;
+  l2575:;	
+  {  int yypos2576= yypos, yythunkpos2576= yythunkpos;  if (!yy_HtmlAttribute()) goto l2576;  goto l2575;
+  l2576:;	  yypos= yypos2576; yythunkpos= yythunkpos2576;
+  }  if (!yymatchChar('>')) goto l2572;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenDiv", yybuf+yypos));
+  return 1;
+  l2572:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenDiv", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_ImageBlock()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "ImageBlock"));  if (!yy_Image()) goto l2577;  /* Sp */
+  {
+  l2578:;	
+  {  int yypos2579= yypos, yythunkpos2579= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2580= yypos, yythunkpos2580= yythunkpos;  if (!yymatchChar(' ')) goto l2581;  goto l2580;
+  l2581:;	  yypos= yypos2580; yythunkpos= yythunkpos2580;  if (!yymatchChar('\t')) goto l2579;
+  }
+  l2580:;	
+  }  goto l2578;
+  l2579:;	  yypos= yypos2579; yythunkpos= yythunkpos2579;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2577;
+  }  /* BlankLine */
+  {  /* Sp */
+  {
+  l2584:;	
+  {  int yypos2585= yypos, yythunkpos2585= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2586= yypos, yythunkpos2586= yythunkpos;  if (!yymatchChar(' ')) goto l2587;  goto l2586;
+  l2587:;	  yypos= yypos2586; yythunkpos= yythunkpos2586;  if (!yymatchChar('\t')) goto l2585;
+  }
+  l2586:;	
+  }  goto l2584;
+  l2585:;	  yypos= yypos2585; yythunkpos= yythunkpos2585;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2577;
+  }
+  }
+  l2582:;	
+  {  int yypos2583= yypos, yythunkpos2583= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2588:;	
+  {  int yypos2589= yypos, yythunkpos2589= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2590= yypos, yythunkpos2590= yythunkpos;  if (!yymatchChar(' ')) goto l2591;  goto l2590;
+  l2591:;	  yypos= yypos2590; yythunkpos= yythunkpos2590;  if (!yymatchChar('\t')) goto l2589;
+  }
+  l2590:;	
+  }  goto l2588;
+  l2589:;	  yypos= yypos2589; yythunkpos= yythunkpos2589;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2583;
+  }
+  }  goto l2582;
+  l2583:;	  yypos= yypos2583; yythunkpos= yythunkpos2583;
+  }  yyDo(yy_1_ImageBlock, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ImageBlock", yybuf+yypos));
+  return 1;
+  l2577:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ImageBlock", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Table()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Table"));  /* StartList */
+  {
+  {  int yypos2593= yypos, yythunkpos2593= yythunkpos;  if (!yymatchDot()) goto l2592;  yypos= yypos2593; yythunkpos= yythunkpos2593;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);  /* StartList */
+  {
+  {  int yypos2594= yypos, yythunkpos2594= yythunkpos;  if (!yymatchDot()) goto l2592;  yypos= yypos2594; yythunkpos= yythunkpos2594;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos2595= yypos, yythunkpos2595= yythunkpos;  if (!yy_TableCaption()) goto l2595;  yyDo(yy_1_Table, yybegin, yyend);  goto l2596;
+  l2595:;	  yypos= yypos2595; yythunkpos= yythunkpos2595;
+  }
+  l2596:;	  if (!yy_TableBody()) goto l2592;  yyDo(yy_2_Table, yybegin, yyend);  if (!yy_SeparatorLine()) goto l2592;  yyDo(yy_3_Table, yybegin, yyend);  if (!yy_TableBody()) goto l2592;  yyDo(yy_4_Table, yybegin, yyend);
+  l2597:;	
+  {  int yypos2598= yypos, yythunkpos2598= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2599:;	
+  {  int yypos2600= yypos, yythunkpos2600= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2601= yypos, yythunkpos2601= yythunkpos;  if (!yymatchChar(' ')) goto l2602;  goto l2601;
+  l2602:;	  yypos= yypos2601; yythunkpos= yythunkpos2601;  if (!yymatchChar('\t')) goto l2600;
+  }
+  l2601:;	
+  }  goto l2599;
+  l2600:;	  yypos= yypos2600; yythunkpos= yythunkpos2600;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2598;
+  }
+  }
+  {  int yypos2603= yypos, yythunkpos2603= yythunkpos;  if (!yy_TableCaption()) goto l2603;  goto l2598;
+  l2603:;	  yypos= yypos2603; yythunkpos= yythunkpos2603;
+  }  if (!yy_TableBody()) goto l2598;  yyDo(yy_5_Table, yybegin, yyend);
+  {  int yypos2604= yypos, yythunkpos2604= yythunkpos;
+  {  int yypos2605= yypos, yythunkpos2605= yythunkpos;  if (!yy_TableCaption()) goto l2606;  goto l2605;
+  l2606:;	  yypos= yypos2605; yythunkpos= yythunkpos2605;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2607:;	
+  {  int yypos2608= yypos, yythunkpos2608= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2609= yypos, yythunkpos2609= yythunkpos;  if (!yymatchChar(' ')) goto l2610;  goto l2609;
+  l2610:;	  yypos= yypos2609; yythunkpos= yythunkpos2609;  if (!yymatchChar('\t')) goto l2608;
+  }
+  l2609:;	
+  }  goto l2607;
+  l2608:;	  yypos= yypos2608; yythunkpos= yythunkpos2608;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2598;
+  }
+  }
+  }
+  l2605:;	  yypos= yypos2604; yythunkpos= yythunkpos2604;
+  }  goto l2597;
+  l2598:;	  yypos= yypos2598; yythunkpos= yythunkpos2598;
+  }
+  {  int yypos2611= yypos, yythunkpos2611= yythunkpos;  if (!yy_TableCaption()) goto l2612;  yyDo(yy_6_Table, yybegin, yyend);
+  {  int yypos2613= yypos, yythunkpos2613= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2614:;	
+  {  int yypos2615= yypos, yythunkpos2615= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2616= yypos, yythunkpos2616= yythunkpos;  if (!yymatchChar(' ')) goto l2617;  goto l2616;
+  l2617:;	  yypos= yypos2616; yythunkpos= yythunkpos2616;  if (!yymatchChar('\t')) goto l2615;
+  }
+  l2616:;	
+  }  goto l2614;
+  l2615:;	  yypos= yypos2615; yythunkpos= yythunkpos2615;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2612;
+  }
+  }  yypos= yypos2613; yythunkpos= yythunkpos2613;
+  }  goto l2611;
+  l2612:;	  yypos= yypos2611; yythunkpos= yythunkpos2611;
+  {  int yypos2618= yypos, yythunkpos2618= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2619:;	
+  {  int yypos2620= yypos, yythunkpos2620= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2621= yypos, yythunkpos2621= yythunkpos;  if (!yymatchChar(' ')) goto l2622;  goto l2621;
+  l2622:;	  yypos= yypos2621; yythunkpos= yythunkpos2621;  if (!yymatchChar('\t')) goto l2620;
+  }
+  l2621:;	
+  }  goto l2619;
+  l2620:;	  yypos= yypos2620; yythunkpos= yythunkpos2620;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2592;
+  }
+  }  yypos= yypos2618; yythunkpos= yythunkpos2618;
+  }
+  }
+  l2611:;	  yyDo(yy_7_Table, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Table", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l2592:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Table", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_StyleBlock()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "StyleBlock"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l2623;  if (!yy_InStyleTags()) goto l2623;  yyText(yybegin, yyend);  if (!(YY_END)) goto l2623;
+  l2624:;	
+  {  int yypos2625= yypos, yythunkpos2625= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2626:;	
+  {  int yypos2627= yypos, yythunkpos2627= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2628= yypos, yythunkpos2628= yythunkpos;  if (!yymatchChar(' ')) goto l2629;  goto l2628;
+  l2629:;	  yypos= yypos2628; yythunkpos= yythunkpos2628;  if (!yymatchChar('\t')) goto l2627;
+  }
+  l2628:;	
+  }  goto l2626;
+  l2627:;	  yypos= yypos2627; yythunkpos= yythunkpos2627;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2625;
+  }
+  }  goto l2624;
+  l2625:;	  yypos= yypos2625; yythunkpos= yythunkpos2625;
+  }  yyDo(yy_1_StyleBlock, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleBlock", yybuf+yypos));
+  return 1;
+  l2623:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleBlock", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_HtmlBlock()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlock"));
+  {  int yypos2631= yypos, yythunkpos2631= yythunkpos;  if (!yy_MarkdownHtmlTagOpen()) goto l2631;  goto l2630;
+  l2631:;	  yypos= yypos2631; yythunkpos= yythunkpos2631;
+  }  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l2630;
+  {  int yypos2632= yypos, yythunkpos2632= yythunkpos;  if (!yy_HtmlBlockInTags()) goto l2633;  goto l2632;
+  l2633:;	  yypos= yypos2632; yythunkpos= yythunkpos2632;  if (!yy_HtmlComment()) goto l2634;  goto l2632;
+  l2634:;	  yypos= yypos2632; yythunkpos= yythunkpos2632;  if (!yy_HtmlBlockSelfClosing()) goto l2630;
+  }
+  l2632:;	  yyText(yybegin, yyend);  if (!(YY_END)) goto l2630;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2637:;	
+  {  int yypos2638= yypos, yythunkpos2638= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2639= yypos, yythunkpos2639= yythunkpos;  if (!yymatchChar(' ')) goto l2640;  goto l2639;
+  l2640:;	  yypos= yypos2639; yythunkpos= yythunkpos2639;  if (!yymatchChar('\t')) goto l2638;
+  }
+  l2639:;	
+  }  goto l2637;
+  l2638:;	  yypos= yypos2638; yythunkpos= yythunkpos2638;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2630;
+  }
+  }
+  l2635:;	
+  {  int yypos2636= yypos, yythunkpos2636= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2641:;	
+  {  int yypos2642= yypos, yythunkpos2642= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2643= yypos, yythunkpos2643= yythunkpos;  if (!yymatchChar(' ')) goto l2644;  goto l2643;
+  l2644:;	  yypos= yypos2643; yythunkpos= yythunkpos2643;  if (!yymatchChar('\t')) goto l2642;
+  }
+  l2643:;	
+  }  goto l2641;
+  l2642:;	  yypos= yypos2642; yythunkpos= yythunkpos2642;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2636;
+  }
+  }  goto l2635;
+  l2636:;	  yypos= yypos2636; yythunkpos= yythunkpos2636;
+  }  yyDo(yy_1_HtmlBlock, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlock", yybuf+yypos));
+  return 1;
+  l2630:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlock", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_BulletList()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "BulletList"));
+  {  int yypos2646= yypos, yythunkpos2646= yythunkpos;  if (!yy_Bullet()) goto l2645;  yypos= yypos2646; yythunkpos= yythunkpos2646;
+  }
+  {  int yypos2647= yypos, yythunkpos2647= yythunkpos;  if (!yy_ListTight()) goto l2648;  goto l2647;
+  l2648:;	  yypos= yypos2647; yythunkpos= yythunkpos2647;  if (!yy_ListLoose()) goto l2645;
+  }
+  l2647:;	  yyDo(yy_1_BulletList, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BulletList", yybuf+yypos));
+  return 1;
+  l2645:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BulletList", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_OrderedList()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "OrderedList"));
+  {  int yypos2650= yypos, yythunkpos2650= yythunkpos;  if (!yy_Enumerator()) goto l2649;  yypos= yypos2650; yythunkpos= yythunkpos2650;
+  }
+  {  int yypos2651= yypos, yythunkpos2651= yythunkpos;  if (!yy_ListTight()) goto l2652;  goto l2651;
+  l2652:;	  yypos= yypos2651; yythunkpos= yythunkpos2651;  if (!yy_ListLoose()) goto l2649;
+  }
+  l2651:;	  yyDo(yy_1_OrderedList, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OrderedList", yybuf+yypos));
+  return 1;
+  l2649:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OrderedList", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_HeadingSection()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "HeadingSection"));  /* StartList */
+  {
+  {  int yypos2654= yypos, yythunkpos2654= yythunkpos;  if (!yymatchDot()) goto l2653;  yypos= yypos2654; yythunkpos= yythunkpos2654;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  /* Heading */
+  {
+  {  int yypos2655= yypos, yythunkpos2655= yythunkpos;  /* SetextHeading */
+  {
+  {  int yypos2657= yypos, yythunkpos2657= yythunkpos;  if (!yy_SetextHeading1()) goto l2658;  goto l2657;
+  l2658:;	  yypos= yypos2657; yythunkpos= yythunkpos2657;  if (!yy_SetextHeading2()) goto l2656;
+  }
+  l2657:;	
+  }  goto l2655;
+  l2656:;	  yypos= yypos2655; yythunkpos= yythunkpos2655;  if (!yy_AtxHeading()) goto l2653;
+  }
+  l2655:;	
+  }  yyDo(yy_1_HeadingSection, yybegin, yyend);
+  l2659:;	
+  {  int yypos2660= yypos, yythunkpos2660= yythunkpos;  if (!yy_HeadingSectionBlock()) goto l2660;  yyDo(yy_2_HeadingSection, yybegin, yyend);  goto l2659;
+  l2660:;	  yypos= yypos2660; yythunkpos= yythunkpos2660;
+  }  yyDo(yy_3_HeadingSection, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "HeadingSection", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2653:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HeadingSection", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_HorizontalRule()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "HorizontalRule"));  if (!yy_NonindentSpace()) goto l2661;
+  {  int yypos2662= yypos, yythunkpos2662= yythunkpos;  if (!yymatchChar('*')) goto l2663;  /* Sp */
+  {
+  l2664:;	
+  {  int yypos2665= yypos, yythunkpos2665= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2666= yypos, yythunkpos2666= yythunkpos;  if (!yymatchChar(' ')) goto l2667;  goto l2666;
+  l2667:;	  yypos= yypos2666; yythunkpos= yythunkpos2666;  if (!yymatchChar('\t')) goto l2665;
+  }
+  l2666:;	
+  }  goto l2664;
+  l2665:;	  yypos= yypos2665; yythunkpos= yythunkpos2665;
+  }
+  }  if (!yymatchChar('*')) goto l2663;  /* Sp */
+  {
+  l2668:;	
+  {  int yypos2669= yypos, yythunkpos2669= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2670= yypos, yythunkpos2670= yythunkpos;  if (!yymatchChar(' ')) goto l2671;  goto l2670;
+  l2671:;	  yypos= yypos2670; yythunkpos= yythunkpos2670;  if (!yymatchChar('\t')) goto l2669;
+  }
+  l2670:;	
+  }  goto l2668;
+  l2669:;	  yypos= yypos2669; yythunkpos= yythunkpos2669;
+  }
+  }  if (!yymatchChar('*')) goto l2663;
+  l2672:;	
+  {  int yypos2673= yypos, yythunkpos2673= yythunkpos;  /* Sp */
+  {
+  l2674:;	
+  {  int yypos2675= yypos, yythunkpos2675= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2676= yypos, yythunkpos2676= yythunkpos;  if (!yymatchChar(' ')) goto l2677;  goto l2676;
+  l2677:;	  yypos= yypos2676; yythunkpos= yythunkpos2676;  if (!yymatchChar('\t')) goto l2675;
+  }
+  l2676:;	
+  }  goto l2674;
+  l2675:;	  yypos= yypos2675; yythunkpos= yythunkpos2675;
+  }
+  }  if (!yymatchChar('*')) goto l2673;  goto l2672;
+  l2673:;	  yypos= yypos2673; yythunkpos= yythunkpos2673;
+  }  goto l2662;
+  l2663:;	  yypos= yypos2662; yythunkpos= yythunkpos2662;  if (!yymatchChar('-')) goto l2678;  /* Sp */
+  {
+  l2679:;	
+  {  int yypos2680= yypos, yythunkpos2680= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2681= yypos, yythunkpos2681= yythunkpos;  if (!yymatchChar(' ')) goto l2682;  goto l2681;
+  l2682:;	  yypos= yypos2681; yythunkpos= yythunkpos2681;  if (!yymatchChar('\t')) goto l2680;
+  }
+  l2681:;	
+  }  goto l2679;
+  l2680:;	  yypos= yypos2680; yythunkpos= yythunkpos2680;
+  }
+  }  if (!yymatchChar('-')) goto l2678;  /* Sp */
+  {
+  l2683:;	
+  {  int yypos2684= yypos, yythunkpos2684= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2685= yypos, yythunkpos2685= yythunkpos;  if (!yymatchChar(' ')) goto l2686;  goto l2685;
+  l2686:;	  yypos= yypos2685; yythunkpos= yythunkpos2685;  if (!yymatchChar('\t')) goto l2684;
+  }
+  l2685:;	
+  }  goto l2683;
+  l2684:;	  yypos= yypos2684; yythunkpos= yythunkpos2684;
+  }
+  }  if (!yymatchChar('-')) goto l2678;
+  l2687:;	
+  {  int yypos2688= yypos, yythunkpos2688= yythunkpos;  /* Sp */
+  {
+  l2689:;	
+  {  int yypos2690= yypos, yythunkpos2690= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2691= yypos, yythunkpos2691= yythunkpos;  if (!yymatchChar(' ')) goto l2692;  goto l2691;
+  l2692:;	  yypos= yypos2691; yythunkpos= yythunkpos2691;  if (!yymatchChar('\t')) goto l2690;
+  }
+  l2691:;	
+  }  goto l2689;
+  l2690:;	  yypos= yypos2690; yythunkpos= yythunkpos2690;
+  }
+  }  if (!yymatchChar('-')) goto l2688;  goto l2687;
+  l2688:;	  yypos= yypos2688; yythunkpos= yythunkpos2688;
+  }  goto l2662;
+  l2678:;	  yypos= yypos2662; yythunkpos= yythunkpos2662;  if (!yymatchChar('_')) goto l2661;  /* Sp */
+  {
+  l2693:;	
+  {  int yypos2694= yypos, yythunkpos2694= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2695= yypos, yythunkpos2695= yythunkpos;  if (!yymatchChar(' ')) goto l2696;  goto l2695;
+  l2696:;	  yypos= yypos2695; yythunkpos= yythunkpos2695;  if (!yymatchChar('\t')) goto l2694;
+  }
+  l2695:;	
+  }  goto l2693;
+  l2694:;	  yypos= yypos2694; yythunkpos= yythunkpos2694;
+  }
+  }  if (!yymatchChar('_')) goto l2661;  /* Sp */
+  {
+  l2697:;	
+  {  int yypos2698= yypos, yythunkpos2698= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2699= yypos, yythunkpos2699= yythunkpos;  if (!yymatchChar(' ')) goto l2700;  goto l2699;
+  l2700:;	  yypos= yypos2699; yythunkpos= yythunkpos2699;  if (!yymatchChar('\t')) goto l2698;
+  }
+  l2699:;	
+  }  goto l2697;
+  l2698:;	  yypos= yypos2698; yythunkpos= yythunkpos2698;
+  }
+  }  if (!yymatchChar('_')) goto l2661;
+  l2701:;	
+  {  int yypos2702= yypos, yythunkpos2702= yythunkpos;  /* Sp */
+  {
+  l2703:;	
+  {  int yypos2704= yypos, yythunkpos2704= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2705= yypos, yythunkpos2705= yythunkpos;  if (!yymatchChar(' ')) goto l2706;  goto l2705;
+  l2706:;	  yypos= yypos2705; yythunkpos= yythunkpos2705;  if (!yymatchChar('\t')) goto l2704;
+  }
+  l2705:;	
+  }  goto l2703;
+  l2704:;	  yypos= yypos2704; yythunkpos= yythunkpos2704;
+  }
+  }  if (!yymatchChar('_')) goto l2702;  goto l2701;
+  l2702:;	  yypos= yypos2702; yythunkpos= yythunkpos2702;
+  }
+  }
+  l2662:;	  /* Sp */
+  {
+  l2707:;	
+  {  int yypos2708= yypos, yythunkpos2708= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2709= yypos, yythunkpos2709= yythunkpos;  if (!yymatchChar(' ')) goto l2710;  goto l2709;
+  l2710:;	  yypos= yypos2709; yythunkpos= yythunkpos2709;  if (!yymatchChar('\t')) goto l2708;
+  }
+  l2709:;	
+  }  goto l2707;
+  l2708:;	  yypos= yypos2708; yythunkpos= yythunkpos2708;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2661;
+  }  /* BlankLine */
+  {  /* Sp */
+  {
+  l2713:;	
+  {  int yypos2714= yypos, yythunkpos2714= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2715= yypos, yythunkpos2715= yythunkpos;  if (!yymatchChar(' ')) goto l2716;  goto l2715;
+  l2716:;	  yypos= yypos2715; yythunkpos= yythunkpos2715;  if (!yymatchChar('\t')) goto l2714;
+  }
+  l2715:;	
+  }  goto l2713;
+  l2714:;	  yypos= yypos2714; yythunkpos= yythunkpos2714;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2661;
+  }
+  }
+  l2711:;	
+  {  int yypos2712= yypos, yythunkpos2712= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2717:;	
+  {  int yypos2718= yypos, yythunkpos2718= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2719= yypos, yythunkpos2719= yythunkpos;  if (!yymatchChar(' ')) goto l2720;  goto l2719;
+  l2720:;	  yypos= yypos2719; yythunkpos= yythunkpos2719;  if (!yymatchChar('\t')) goto l2718;
+  }
+  l2719:;	
+  }  goto l2717;
+  l2718:;	  yypos= yypos2718; yythunkpos= yythunkpos2718;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2712;
+  }
+  }  goto l2711;
+  l2712:;	  yypos= yypos2712; yythunkpos= yythunkpos2712;
+  }  yyDo(yy_1_HorizontalRule, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "HorizontalRule", yybuf+yypos));
+  return 1;
+  l2661:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HorizontalRule", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Reference()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 4, 0);
+  yyprintf((stderr, "%s\n", "Reference"));  /* StartList */
+  {
+  {  int yypos2722= yypos, yythunkpos2722= yythunkpos;  if (!yymatchDot()) goto l2721;  yypos= yypos2722; yythunkpos= yythunkpos2722;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -4, 0);  if (!yy_NonindentSpace()) goto l2721;
+  {  int yypos2723= yypos, yythunkpos2723= yythunkpos;  if (!yymatchString("[]")) goto l2723;  goto l2721;
+  l2723:;	  yypos= yypos2723; yythunkpos= yythunkpos2723;
+  }  if (!yy_Label()) goto l2721;  yyDo(yySet, -3, 0);  if (!yymatchChar(':')) goto l2721;  if (!yy_Spnl()) goto l2721;  if (!yy_RefSrc()) goto l2721;  yyDo(yySet, -2, 0);  if (!yy_RefTitle()) goto l2721;  yyDo(yySet, -1, 0);
+  {  int yypos2724= yypos, yythunkpos2724= yythunkpos;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2724;
+  {  int yypos2726= yypos, yythunkpos2726= yythunkpos;  if (!yy_Attributes()) goto l2726;  yyDo(yy_1_Reference, yybegin, yyend);  goto l2727;
+  l2726:;	  yypos= yypos2726; yythunkpos= yythunkpos2726;
+  }
+  l2727:;	  goto l2725;
+  l2724:;	  yypos= yypos2724; yythunkpos= yythunkpos2724;
+  }
+  l2725:;	  /* BlankLine */
+  {  /* Sp */
+  {
+  l2730:;	
+  {  int yypos2731= yypos, yythunkpos2731= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2732= yypos, yythunkpos2732= yythunkpos;  if (!yymatchChar(' ')) goto l2733;  goto l2732;
+  l2733:;	  yypos= yypos2732; yythunkpos= yythunkpos2732;  if (!yymatchChar('\t')) goto l2731;
+  }
+  l2732:;	
+  }  goto l2730;
+  l2731:;	  yypos= yypos2731; yythunkpos= yythunkpos2731;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2721;
+  }
+  }
+  l2728:;	
+  {  int yypos2729= yypos, yythunkpos2729= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2734:;	
+  {  int yypos2735= yypos, yythunkpos2735= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2736= yypos, yythunkpos2736= yythunkpos;  if (!yymatchChar(' ')) goto l2737;  goto l2736;
+  l2737:;	  yypos= yypos2736; yythunkpos= yythunkpos2736;  if (!yymatchChar('\t')) goto l2735;
+  }
+  l2736:;	
+  }  goto l2734;
+  l2735:;	  yypos= yypos2735; yythunkpos= yythunkpos2735;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2729;
+  }
+  }  goto l2728;
+  l2729:;	  yypos= yypos2729; yythunkpos= yythunkpos2729;
+  }  yyDo(yy_2_Reference, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Reference", yybuf+yypos));  yyDo(yyPop, 4, 0);
+  return 1;
+  l2721:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Reference", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Note()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Note"));  yyText(yybegin, yyend);  if (!( extension(EXT_NOTES) )) goto l2738;  if (!yy_NonindentSpace()) goto l2738;  if (!yy_RawNoteReference()) goto l2738;  yyDo(yySet, -2, 0);  if (!yymatchChar(':')) goto l2738;  /* Sp */
+  {
+  l2739:;	
+  {  int yypos2740= yypos, yythunkpos2740= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2741= yypos, yythunkpos2741= yythunkpos;  if (!yymatchChar(' ')) goto l2742;  goto l2741;
+  l2742:;	  yypos= yypos2741; yythunkpos= yythunkpos2741;  if (!yymatchChar('\t')) goto l2740;
+  }
+  l2741:;	
+  }  goto l2739;
+  l2740:;	  yypos= yypos2740; yythunkpos= yythunkpos2740;
+  }
+  }  /* StartList */
+  {
+  {  int yypos2743= yypos, yythunkpos2743= yythunkpos;  if (!yymatchDot()) goto l2738;  yypos= yypos2743; yythunkpos= yythunkpos2743;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  if (!yy_RawNoteBlock()) goto l2738;  yyDo(yy_1_Note, yybegin, yyend);
+  l2744:;	
+  {  int yypos2745= yypos, yythunkpos2745= yythunkpos;
+  {  int yypos2746= yypos, yythunkpos2746= yythunkpos;  /* Indent */
+  {
+  {  int yypos2747= yypos, yythunkpos2747= yythunkpos;  if (!yymatchChar('\t')) goto l2748;  goto l2747;
+  l2748:;	  yypos= yypos2747; yythunkpos= yythunkpos2747;  if (!yymatchString("    ")) goto l2745;
+  }
+  l2747:;	
+  }  yypos= yypos2746; yythunkpos= yythunkpos2746;
+  }  if (!yy_RawNoteBlock()) goto l2745;  yyDo(yy_2_Note, yybegin, yyend);  goto l2744;
+  l2745:;	  yypos= yypos2745; yythunkpos= yythunkpos2745;
+  }  yyDo(yy_3_Note, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Note", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l2738:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Note", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) YY_COLD yy_Glossary()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Glossary"));  yyText(yybegin, yyend);  if (!( extension(EXT_NOTES) )) goto l2749;  /* StartList */
+  {
+  {  int yypos2750= yypos, yythunkpos2750= yythunkpos;  if (!yymatchDot()) goto l2749;  yypos= yypos2750; yythunkpos= yythunkpos2750;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);  if (!yy_NonindentSpace()) goto l2749;  if (!yy_RawNoteReference()) goto l2749;  yyDo(yySet, -1, 0);  if (!yymatchChar(':')) goto l2749;  /* Sp */
+  {
+  l2751:;	
+  {  int yypos2752= yypos, yythunkpos2752= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2753= yypos, yythunkpos2753= yythunkpos;  if (!yymatchChar(' ')) goto l2754;  goto l2753;
+  l2754:;	  yypos= yypos2753; yythunkpos= yythunkpos2753;  if (!yymatchChar('\t')) goto l2752;
+  }
+  l2753:;	
+  }  goto l2751;
+  l2752:;	  yypos= yypos2752; yythunkpos= yythunkpos2752;
+  }
+  }  if (!yymatchString("glossary:")) goto l2749;  /* Sp */
+  {
+  l2755:;	
+  {  int yypos2756= yypos, yythunkpos2756= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2757= yypos, yythunkpos2757= yythunkpos;  if (!yymatchChar(' ')) goto l2758;  goto l2757;
+  l2758:;	  yypos= yypos2757; yythunkpos= yythunkpos2757;  if (!yymatchChar('\t')) goto l2756;
+  }
+  l2757:;	
+  }  goto l2755;
+  l2756:;	  yypos= yypos2756; yythunkpos= yythunkpos2756;
+  }
+  }  if (!yy_GlossaryTerm()) goto l2749;  yyDo(yy_1_Glossary, yybegin, yyend);
+  {  int yypos2759= yypos, yythunkpos2759= yythunkpos;  if (!yy_GlossarySortKey()) goto l2759;  yyDo(yy_2_Glossary, yybegin, yyend);  goto l2760;
+  l2759:;	  yypos= yypos2759; yythunkpos= yythunkpos2759;
+  }
+  l2760:;	  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2749;
+  }  if (!yy_RawNoteBlock()) goto l2749;  yyDo(yy_3_Glossary, yybegin, yyend);
+  l2761:;	
+  {  int yypos2762= yypos, yythunkpos2762= yythunkpos;
+  {  int yypos2763= yypos, yythunkpos2763= yythunkpos;  /* Indent */
+  {
+  {  int yypos2764= yypos, yythunkpos2764= yythunkpos;  if (!yymatchChar('\t')) goto l2765;  goto l2764;
+  l2765:;	  yypos= yypos2764; yythunkpos= yythunkpos2764;  if (!yymatchString("    ")) goto l2762;
+  }
+  l2764:;	
+  }  yypos= yypos2763; yythunkpos= yythunkpos2763;
+  }  if (!yy_RawNoteBlock()) goto l2762;  yyDo(yy_4_Glossary, yybegin, yyend);  goto l2761;
+  l2762:;	  yypos= yypos2762; yythunkpos= yythunkpos2762;
+  }  yyDo(yy_5_Glossary, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Glossary", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l2749:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Glossary", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_DefinitionList()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "DefinitionList"));  /* StartList */
+  {
+  {  int yypos2767= yypos, yythunkpos2767= yythunkpos;  if (!yymatchDot()) goto l2766;  yypos= yypos2767; yythunkpos= yythunkpos2767;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos2768= yypos, yythunkpos2768= yythunkpos;  if (!yy_TermLine()) goto l2766;
+  l2769:;	
+  {  int yypos2770= yypos, yythunkpos2770= yythunkpos;  if (!yy_TermLine()) goto l2770;  goto l2769;
+  l2770:;	  yypos= yypos2770; yythunkpos= yythunkpos2770;
+  }  if (!yymatchChar(':')) goto l2766;  yypos= yypos2768; yythunkpos= yythunkpos2768;
+  }  if (!yy_Term()) goto l2766;  yyDo(yy_1_DefinitionList, yybegin, yyend);
+  l2773:;	
+  {  int yypos2774= yypos, yythunkpos2774= yythunkpos;  if (!yy_Term()) goto l2774;  yyDo(yy_1_DefinitionList, yybegin, yyend);  goto l2773;
+  l2774:;	  yypos= yypos2774; yythunkpos= yythunkpos2774;
+  }  if (!yy_Definition()) goto l2766;  yyDo(yy_2_DefinitionList, yybegin, yyend);
+  l2775:;	
+  {  int yypos2776= yypos, yythunkpos2776= yythunkpos;  if (!yy_Definition()) goto l2776;  yyDo(yy_2_DefinitionList, yybegin, yyend);  goto l2775;
+  l2776:;	  yypos= yypos2776; yythunkpos= yythunkpos2776;
+  }
+  l2777:;	
+  {  int yypos2778= yypos, yythunkpos2778= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2779:;	
+  {  int yypos2780= yypos, yythunkpos2780= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2781= yypos, yythunkpos2781= yythunkpos;  if (!yymatchChar(' ')) goto l2782;  goto l2781;
+  l2782:;	  yypos= yypos2781; yythunkpos= yythunkpos2781;  if (!yymatchChar('\t')) goto l2780;
+  }
+  l2781:;	
+  }  goto l2779;
+  l2780:;	  yypos= yypos2780; yythunkpos= yythunkpos2780;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2778;
+  }
+  }  goto l2777;
+  l2778:;	  yypos= yypos2778; yythunkpos= yythunkpos2778;
+  }
+  l2771:;	
+  {  int yypos2772= yypos, yythunkpos2772= yythunkpos;  if (!yy_Term()) goto l2772;  yyDo(yy_1_DefinitionList, yybegin, yyend);
+  l2783:;	
+  {  int yypos2784= yypos, yythunkpos2784= yythunkpos;  if (!yy_Term()) goto l2784;  yyDo(yy_1_DefinitionList, yybegin, yyend);  goto l2783;
+  l2784:;	  yypos= yypos2784; yythunkpos= yythunkpos2784;
+  }  if (!yy_Definition()) goto l2772;  yyDo(yy_2_DefinitionList, yybegin, yyend);
+  l2785:;	
+  {  int yypos2786= yypos, yythunkpos2786= yythunkpos;  if (!yy_Definition()) goto l2786;  yyDo(yy_2_DefinitionList, yybegin, yyend);  goto l2785;
+  l2786:;	  yypos= yypos2786; yythunkpos= yythunkpos2786;
+  }
+  l2787:;	
+  {  int yypos2788= yypos, yythunkpos2788= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2789:;	
+  {  int yypos2790= yypos, yythunkpos2790= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2791= yypos, yythunkpos2791= yythunkpos;  if (!yymatchChar(' ')) goto l2792;  goto l2791;
+  l2792:;	  yypos= yypos2791; yythunkpos= yythunkpos2791;  if (!yymatchChar('\t')) goto l2790;
+  }
+  l2791:;	
+  }  goto l2789;
+  l2790:;	  yypos= yypos2790; yythunkpos= yythunkpos2790;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2788;
+  }
+  }  goto l2787;
+  l2788:;	  yypos= yypos2788; yythunkpos= yythunkpos2788;
+  }  goto l2771;
+  l2772:;	  yypos= yypos2772; yythunkpos= yythunkpos2772;
+  }  yyDo(yy_3_DefinitionList, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DefinitionList", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2766:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DefinitionList", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Verbatim()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Verbatim"));  /* StartList */
+  {
+  {  int yypos2794= yypos, yythunkpos2794= yythunkpos;  if (!yymatchDot()) goto l2793;  yypos= yypos2794; yythunkpos= yythunkpos2794;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  if (!yy_VerbatimChunk()) goto l2793;  yyDo(yy_1_Verbatim, yybegin, yyend);
+  l2795:;	
+  {  int yypos2796= yypos, yythunkpos2796= yythunkpos;  if (!yy_VerbatimChunk()) goto l2796;  yyDo(yy_1_Verbatim, yybegin, yyend);  goto l2795;
+  l2796:;	  yypos= yypos2796; yythunkpos= yythunkpos2796;
+  }
+  l2797:;	
+  {  int yypos2798= yypos, yythunkpos2798= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2799:;	
+  {  int yypos2800= yypos, yythunkpos2800= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2801= yypos, yythunkpos2801= yythunkpos;  if (!yymatchChar(' ')) goto l2802;  goto l2801;
+  l2802:;	  yypos= yypos2801; yythunkpos= yythunkpos2801;  if (!yymatchChar('\t')) goto l2800;
+  }
+  l2801:;	
+  }  goto l2799;
+  l2800:;	  yypos= yypos2800; yythunkpos= yythunkpos2800;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2798;
+  }
+  }  goto l2797;
+  l2798:;	  yypos= yypos2798; yythunkpos= yythunkpos2798;
+  }  yyDo(yy_2_Verbatim, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Verbatim", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2793:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Verbatim", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_BlockQuote()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "BlockQuote"));  if (!yy_BlockQuoteRaw()) goto l2803;  yyDo(yySet, -1, 0);  yyDo(yy_1_BlockQuote, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlockQuote", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2803:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlockQuote", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_RawLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "RawLine"));
+  {  int yypos2805= yypos, yythunkpos2805= yythunkpos;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l2806;
+  l2807:;	
+  {  int yypos2808= yypos, yythunkpos2808= yythunkpos;  if (!yymatchClass((unsigned char *)"\377\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l2808;  goto l2807;
+  l2808:;	  yypos= yypos2808; yythunkpos= yythunkpos2808;
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2806;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l2806;  goto l2805;
+  l2806:;	  yypos= yypos2805; yythunkpos= yythunkpos2805;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l2804;  if (!yymatchDot()) goto l2804;
+  l2809:;	
+  {  int yypos2810= yypos, yythunkpos2810= yythunkpos;  if (!yymatchDot()) goto l2810;  goto l2809;
+  l2810:;	  yypos= yypos2810; yythunkpos= yythunkpos2810;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l2804;  /* Eof */
+  {
+  {  int yypos2811= yypos, yythunkpos2811= yythunkpos;  if (!yymatchDot()) goto l2811;  goto l2804;
+  l2811:;	  yypos= yypos2811; yythunkpos= yythunkpos2811;
+  }
+  }
+  }
+  l2805:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawLine", yybuf+yypos));
+  return 1;
+  l2804:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_BlankLine()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "BlankLine"));  /* Sp */
+  {
+  l2813:;	
+  {  int yypos2814= yypos, yythunkpos2814= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2815= yypos, yythunkpos2815= yythunkpos;  if (!yymatchChar(' ')) goto l2816;  goto l2815;
+  l2816:;	  yypos= yypos2815; yythunkpos= yythunkpos2815;  if (!yymatchChar('\t')) goto l2814;
+  }
+  l2815:;	
+  }  goto l2813;
+  l2814:;	  yypos= yypos2814; yythunkpos= yythunkpos2814;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2812;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlankLine", yybuf+yypos));
+  return 1;
+  l2812:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlankLine", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SingleLineMetaKeyValue()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "SingleLineMetaKeyValue"));  if (!yy_MetaDataKey()) goto l2817;  /* Sp */
+  {
+  l2818:;	
+  {  int yypos2819= yypos, yythunkpos2819= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2820= yypos, yythunkpos2820= yythunkpos;  if (!yymatchChar(' ')) goto l2821;  goto l2820;
+  l2821:;	  yypos= yypos2820; yythunkpos= yythunkpos2820;  if (!yymatchChar('\t')) goto l2819;
+  }
+  l2820:;	
+  }  goto l2818;
+  l2819:;	  yypos= yypos2819; yythunkpos= yythunkpos2819;
+  }
+  }  if (!yymatchChar(':')) goto l2817;  /* Sp */
+  {
+  l2822:;	
+  {  int yypos2823= yypos, yythunkpos2823= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2824= yypos, yythunkpos2824= yythunkpos;  if (!yymatchChar(' ')) goto l2825;  goto l2824;
+  l2825:;	  yypos= yypos2824; yythunkpos= yythunkpos2824;  if (!yymatchChar('\t')) goto l2823;
+  }
+  l2824:;	
+  }  goto l2822;
+  l2823:;	  yypos= yypos2823; yythunkpos= yythunkpos2823;
+  }
+  }
+  l2826:;	
+  {  int yypos2827= yypos, yythunkpos2827= yythunkpos;
+  {  int yypos2828= yypos, yythunkpos2828= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2828;
+  }  goto l2827;
+  l2828:;	  yypos= yypos2828; yythunkpos= yythunkpos2828;
+  }  if (!yymatchDot()) goto l2827;  goto l2826;
+  l2827:;	  yypos= yypos2827; yythunkpos= yythunkpos2827;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleLineMetaKeyValue", yybuf+yypos));
+  return 1;
+  l2817:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleLineMetaKeyValue", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_AlphanumericAscii()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "AlphanumericAscii"));  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2829;
+  yyprintf((stderr, "  ok   %s @ %s\n", "AlphanumericAscii", yybuf+yypos));
+  return 1;
+  l2829:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AlphanumericAscii", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_MetaDataValue()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "MetaDataValue"));  /* StartList */
+  {
+  {  int yypos2831= yypos, yythunkpos2831= yythunkpos;  if (!yymatchDot()) goto l2830;  yypos= yypos2831; yythunkpos= yythunkpos2831;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l2830;
+  l2832:;	
+  {  int yypos2833= yypos, yythunkpos2833= yythunkpos;
+  {  int yypos2834= yypos, yythunkpos2834= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2834;
+  }  goto l2833;
+  l2834:;	  yypos= yypos2834; yythunkpos= yythunkpos2834;
+  }  if (!yymatchDot()) goto l2833;  goto l2832;
+  l2833:;	  yypos= yypos2833; yythunkpos= yythunkpos2833;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l2830;  yyDo(yy_1_MetaDataValue, yybegin, yyend);
+  {  int yypos2835= yypos, yythunkpos2835= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2836;
+  }
+  {  int yypos2837= yypos, yythunkpos2837= yythunkpos;
+  {  int yypos2838= yypos, yythunkpos2838= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2839:;	
+  {  int yypos2840= yypos, yythunkpos2840= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2841= yypos, yythunkpos2841= yythunkpos;  if (!yymatchChar(' ')) goto l2842;  goto l2841;
+  l2842:;	  yypos= yypos2841; yythunkpos= yythunkpos2841;  if (!yymatchChar('\t')) goto l2840;
+  }
+  l2841:;	
+  }  goto l2839;
+  l2840:;	  yypos= yypos2840; yythunkpos= yythunkpos2840;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2838;
+  }
+  }  goto l2836;
+  l2838:;	  yypos= yypos2838; yythunkpos= yythunkpos2838;
+  }
+  {  int yypos2843= yypos, yythunkpos2843= yythunkpos;  if (!yy_SingleLineMetaKeyValue()) goto l2843;  goto l2836;
+  l2843:;	  yypos= yypos2843; yythunkpos= yythunkpos2843;
+  }  /* Sp */
+  {
+  l2844:;	
+  {  int yypos2845= yypos, yythunkpos2845= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2846= yypos, yythunkpos2846= yythunkpos;  if (!yymatchChar(' ')) goto l2847;  goto l2846;
+  l2847:;	  yypos= yypos2846; yythunkpos= yythunkpos2846;  if (!yymatchChar('\t')) goto l2845;
+  }
+  l2846:;	
+  }  goto l2844;
+  l2845:;	  yypos= yypos2845; yythunkpos= yythunkpos2845;
+  }
+  }  if (!yy_RawLine()) goto l2836;  yypos= yypos2837; yythunkpos= yythunkpos2837;
+  }  yyDo(yy_2_MetaDataValue, yybegin, yyend);  goto l2835;
+  l2836:;	  yypos= yypos2835; yythunkpos= yythunkpos2835;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2830;
+  }
+  }
+  l2835:;	
+  l2848:;	
+  {  int yypos2849= yypos, yythunkpos2849= yythunkpos;
+  {  int yypos2850= yypos, yythunkpos2850= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2851:;	
+  {  int yypos2852= yypos, yythunkpos2852= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2853= yypos, yythunkpos2853= yythunkpos;  if (!yymatchChar(' ')) goto l2854;  goto l2853;
+  l2854:;	  yypos= yypos2853; yythunkpos= yythunkpos2853;  if (!yymatchChar('\t')) goto l2852;
+  }
+  l2853:;	
+  }  goto l2851;
+  l2852:;	  yypos= yypos2852; yythunkpos= yythunkpos2852;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2850;
+  }
+  }  goto l2849;
+  l2850:;	  yypos= yypos2850; yythunkpos= yythunkpos2850;
+  }
+  {  int yypos2855= yypos, yythunkpos2855= yythunkpos;  if (!yy_SingleLineMetaKeyValue()) goto l2855;  goto l2849;
+  l2855:;	  yypos= yypos2855; yythunkpos= yythunkpos2855;
+  }  /* Sp */
+  {
+  l2856:;	
+  {  int yypos2857= yypos, yythunkpos2857= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2858= yypos, yythunkpos2858= yythunkpos;  if (!yymatchChar(' ')) goto l2859;  goto l2858;
+  l2859:;	  yypos= yypos2858; yythunkpos= yythunkpos2858;  if (!yymatchChar('\t')) goto l2857;
+  }
+  l2858:;	
+  }  goto l2856;
+  l2857:;	  yypos= yypos2857; yythunkpos= yythunkpos2857;
+  }
+  }  if (!yy_RawLine()) goto l2849;  yyDo(yy_3_MetaDataValue, yybegin, yyend);  goto l2848;
+  l2849:;	  yypos= yypos2849; yythunkpos= yythunkpos2849;
+  }  yyDo(yy_4_MetaDataValue, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaDataValue", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2830:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaDataValue", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_SkipBlock()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "SkipBlock"));
+  {  int yypos2861= yypos, yythunkpos2861= yythunkpos;  if (!yy_HtmlBlock()) goto l2862;  yyDo(yySet, -1, 0);  yyDo(yy_1_SkipBlock, yybegin, yyend);  goto l2861;
+  l2862:;	  yypos= yypos2861; yythunkpos= yythunkpos2861;
+  {  int yypos2866= yypos, yythunkpos2866= yythunkpos;  if (!yymatchChar('#')) goto l2866;  goto l2863;
+  l2866:;	  yypos= yypos2866; yythunkpos= yythunkpos2866;
+  }
+  {  int yypos2867= yypos, yythunkpos2867= yythunkpos;  if (!yy_SetextBottom1()) goto l2867;  goto l2863;
+  l2867:;	  yypos= yypos2867; yythunkpos= yythunkpos2867;
+  }
+  {  int yypos2868= yypos, yythunkpos2868= yythunkpos;  if (!yy_SetextBottom2()) goto l2868;  goto l2863;
+  l2868:;	  yypos= yypos2868; yythunkpos= yythunkpos2868;
+  }
+  {  int yypos2869= yypos, yythunkpos2869= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2870:;	
+  {  int yypos2871= yypos, yythunkpos2871= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2872= yypos, yythunkpos2872= yythunkpos;  if (!yymatchChar(' ')) goto l2873;  goto l2872;
+  l2873:;	  yypos= yypos2872; yythunkpos= yythunkpos2872;  if (!yymatchChar('\t')) goto l2871;
+  }
+  l2872:;	
+  }  goto l2870;
+  l2871:;	  yypos= yypos2871; yythunkpos= yythunkpos2871;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2869;
+  }
+  }  goto l2863;
+  l2869:;	  yypos= yypos2869; yythunkpos= yythunkpos2869;
+  }  if (!yy_RawLine()) goto l2863;
+  l2864:;	
+  {  int yypos2865= yypos, yythunkpos2865= yythunkpos;
+  {  int yypos2874= yypos, yythunkpos2874= yythunkpos;  if (!yymatchChar('#')) goto l2874;  goto l2865;
+  l2874:;	  yypos= yypos2874; yythunkpos= yythunkpos2874;
+  }
+  {  int yypos2875= yypos, yythunkpos2875= yythunkpos;  if (!yy_SetextBottom1()) goto l2875;  goto l2865;
+  l2875:;	  yypos= yypos2875; yythunkpos= yythunkpos2875;
+  }
+  {  int yypos2876= yypos, yythunkpos2876= yythunkpos;  if (!yy_SetextBottom2()) goto l2876;  goto l2865;
+  l2876:;	  yypos= yypos2876; yythunkpos= yythunkpos2876;
+  }
+  {  int yypos2877= yypos, yythunkpos2877= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2878:;	
+  {  int yypos2879= yypos, yythunkpos2879= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2880= yypos, yythunkpos2880= yythunkpos;  if (!yymatchChar(' ')) goto l2881;  goto l2880;
+  l2881:;	  yypos= yypos2880; yythunkpos= yythunkpos2880;  if (!yymatchChar('\t')) goto l2879;
+  }
+  l2880:;	
+  }  goto l2878;
+  l2879:;	  yypos= yypos2879; yythunkpos= yythunkpos2879;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2877;
+  }
+  }  goto l2865;
+  l2877:;	  yypos= yypos2877; yythunkpos= yythunkpos2877;
+  }  if (!yy_RawLine()) goto l2865;  goto l2864;
+  l2865:;	  yypos= yypos2865; yythunkpos= yythunkpos2865;
+  }
+  l2882:;	
+  {  int yypos2883= yypos, yythunkpos2883= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2884:;	
+  {  int yypos2885= yypos, yythunkpos2885= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2886= yypos, yythunkpos2886= yythunkpos;  if (!yymatchChar(' ')) goto l2887;  goto l2886;
+  l2887:;	  yypos= yypos2886; yythunkpos= yythunkpos2886;  if (!yymatchChar('\t')) goto l2885;
+  }
+  l2886:;	
+  }  goto l2884;
+  l2885:;	  yypos= yypos2885; yythunkpos= yythunkpos2885;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2883;
+  }
+  }  goto l2882;
+  l2883:;	  yypos= yypos2883; yythunkpos= yythunkpos2883;
+  }  goto l2861;
+  l2863:;	  yypos= yypos2861; yythunkpos= yythunkpos2861;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2891:;	
+  {  int yypos2892= yypos, yythunkpos2892= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2893= yypos, yythunkpos2893= yythunkpos;  if (!yymatchChar(' ')) goto l2894;  goto l2893;
+  l2894:;	  yypos= yypos2893; yythunkpos= yythunkpos2893;  if (!yymatchChar('\t')) goto l2892;
+  }
+  l2893:;	
+  }  goto l2891;
+  l2892:;	  yypos= yypos2892; yythunkpos= yythunkpos2892;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2888;
+  }
+  }
+  l2889:;	
+  {  int yypos2890= yypos, yythunkpos2890= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2895:;	
+  {  int yypos2896= yypos, yythunkpos2896= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2897= yypos, yythunkpos2897= yythunkpos;  if (!yymatchChar(' ')) goto l2898;  goto l2897;
+  l2898:;	  yypos= yypos2897; yythunkpos= yythunkpos2897;  if (!yymatchChar('\t')) goto l2896;
+  }
+  l2897:;	
+  }  goto l2895;
+  l2896:;	  yypos= yypos2896; yythunkpos= yythunkpos2896;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2890;
+  }
+  }  goto l2889;
+  l2890:;	  yypos= yypos2890; yythunkpos= yythunkpos2890;
+  }  goto l2861;
+  l2888:;	  yypos= yypos2861; yythunkpos= yythunkpos2861;  if (!yy_RawLine()) goto l2860;
+  }
+  l2861:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SkipBlock", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2860:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SkipBlock", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_MetaDataOnly()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "MetaDataOnly"));  /* StartList */
+  {
+  {  int yypos2900= yypos, yythunkpos2900= yythunkpos;  if (!yymatchDot()) goto l2899;  yypos= yypos2900; yythunkpos= yythunkpos2900;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);
+  {  int yypos2901= yypos, yythunkpos2901= yythunkpos;  if (!yy_MetaData()) goto l2901;  yyDo(yySet, -1, 0);  yyDo(yy_1_MetaDataOnly, yybegin, yyend);  goto l2902;
+  l2901:;	  yypos= yypos2901; yythunkpos= yythunkpos2901;
+  }
+  l2902:;	
+  l2903:;	
+  {  int yypos2904= yypos, yythunkpos2904= yythunkpos;  if (!yy_SkipBlock()) goto l2904;  goto l2903;
+  l2904:;	  yypos= yypos2904; yythunkpos= yythunkpos2904;
+  }  yyDo(yy_2_MetaDataOnly, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaDataOnly", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l2899:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaDataOnly", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_MetaDataKeyValue()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "MetaDataKeyValue"));  if (!yy_MetaDataKey()) goto l2905;  yyDo(yySet, -2, 0);  /* Sp */
+  {
+  l2906:;	
+  {  int yypos2907= yypos, yythunkpos2907= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2908= yypos, yythunkpos2908= yythunkpos;  if (!yymatchChar(' ')) goto l2909;  goto l2908;
+  l2909:;	  yypos= yypos2908; yythunkpos= yythunkpos2908;  if (!yymatchChar('\t')) goto l2907;
+  }
+  l2908:;	
+  }  goto l2906;
+  l2907:;	  yypos= yypos2907; yythunkpos= yythunkpos2907;
+  }
+  }  if (!yymatchChar(':')) goto l2905;  /* Sp */
+  {
+  l2910:;	
+  {  int yypos2911= yypos, yythunkpos2911= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2912= yypos, yythunkpos2912= yythunkpos;  if (!yymatchChar(' ')) goto l2913;  goto l2912;
+  l2913:;	  yypos= yypos2912; yythunkpos= yythunkpos2912;  if (!yymatchChar('\t')) goto l2911;
+  }
+  l2912:;	
+  }  goto l2910;
+  l2911:;	  yypos= yypos2911; yythunkpos= yythunkpos2911;
+  }
+  }  if (!yy_MetaDataValue()) goto l2905;  yyDo(yySet, -1, 0);  yyDo(yy_1_MetaDataKeyValue, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaDataKeyValue", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l2905:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaDataKeyValue", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_MetaData()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "MetaData"));  /* StartList */
+  {
+  {  int yypos2915= yypos, yythunkpos2915= yythunkpos;  if (!yymatchDot()) goto l2914;  yypos= yypos2915; yythunkpos= yythunkpos2915;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos2916= yypos, yythunkpos2916= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2916;
+  l2917:;	
+  {  int yypos2918= yypos, yythunkpos2918= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2918;  goto l2917;
+  l2918:;	  yypos= yypos2918; yythunkpos= yythunkpos2918;
+  }  if (!yymatchString("://")) goto l2916;  goto l2914;
+  l2916:;	  yypos= yypos2916; yythunkpos= yythunkpos2916;
+  }  if (!yy_MetaDataKeyValue()) goto l2914;  yyDo(yy_1_MetaData, yybegin, yyend);
+  l2919:;	
+  {  int yypos2920= yypos, yythunkpos2920= yythunkpos;  if (!yy_MetaDataKeyValue()) goto l2920;  yyDo(yy_1_MetaData, yybegin, yyend);  goto l2919;
+  l2920:;	  yypos= yypos2920; yythunkpos= yythunkpos2920;
+  }  yyDo(yy_2_MetaData, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaData", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2914:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaData", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Newline()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Newline"));  if (!yymatchChar('\n')) goto l2921;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Newline", yybuf+yypos));
+  return 1;
+  l2921:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Newline", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Sp()
+{
+  yyprintf((stderr, "%s\n", "Sp"));
+  l2923:;	
+  {  int yypos2924= yypos, yythunkpos2924= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2925= yypos, yythunkpos2925= yythunkpos;  if (!yymatchChar(' ')) goto l2926;  goto l2925;
+  l2926:;	  yypos= yypos2925; yythunkpos= yythunkpos2925;  if (!yymatchChar('\t')) goto l2924;
+  }
+  l2925:;	
+  }  goto l2923;
+  l2924:;	  yypos= yypos2924; yythunkpos= yythunkpos2924;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Sp", yybuf+yypos));
+  return 1;
+}
+YY_RULE(int) yy_MetaDataKey()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "MetaDataKey"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l2927;
+  {  int yypos2928= yypos, yythunkpos2928= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2928;
+  l2929:;	
+  {  int yypos2930= yypos, yythunkpos2930= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2930;  goto l2929;
+  l2930:;	  yypos= yypos2930; yythunkpos= yythunkpos2930;
+  }  if (!yymatchString("://")) goto l2928;  goto l2927;
+  l2928:;	  yypos= yypos2928; yythunkpos= yythunkpos2928;
+  }  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2927;
+  }
+  l2931:;	
+  {  int yypos2932= yypos, yythunkpos2932= yythunkpos;  /* Sp */
+  {
+  l2933:;	
+  {  int yypos2934= yypos, yythunkpos2934= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2935= yypos, yythunkpos2935= yythunkpos;  if (!yymatchChar(' ')) goto l2936;  goto l2935;
+  l2936:;	  yypos= yypos2935; yythunkpos= yythunkpos2935;  if (!yymatchChar('\t')) goto l2934;
+  }
+  l2935:;	
+  }  goto l2933;
+  l2934:;	  yypos= yypos2934; yythunkpos= yythunkpos2934;
+  }
+  }
+  {  int yypos2939= yypos, yythunkpos2939= yythunkpos;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2940;
+  }  goto l2939;
+  l2940:;	  yypos= yypos2939; yythunkpos= yythunkpos2939;  if (!yymatchChar('_')) goto l2941;  goto l2939;
+  l2941:;	  yypos= yypos2939; yythunkpos= yythunkpos2939;  if (!yymatchChar(' ')) goto l2942;  goto l2939;
+  l2942:;	  yypos= yypos2939; yythunkpos= yythunkpos2939;  if (!yymatchChar('-')) goto l2932;
+  }
+  l2939:;	
+  l2937:;	
+  {  int yypos2938= yypos, yythunkpos2938= yythunkpos;
+  {  int yypos2943= yypos, yythunkpos2943= yythunkpos;  /* AlphanumericAscii */
+  {  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l2944;
+  }  goto l2943;
+  l2944:;	  yypos= yypos2943; yythunkpos= yythunkpos2943;  if (!yymatchChar('_')) goto l2945;  goto l2943;
+  l2945:;	  yypos= yypos2943; yythunkpos= yythunkpos2943;  if (!yymatchChar(' ')) goto l2946;  goto l2943;
+  l2946:;	  yypos= yypos2943; yythunkpos= yythunkpos2943;  if (!yymatchChar('-')) goto l2938;
+  }
+  l2943:;	  goto l2937;
+  l2938:;	  yypos= yypos2938; yythunkpos= yythunkpos2938;
+  }  goto l2931;
+  l2932:;	  yypos= yypos2932; yythunkpos= yythunkpos2932;
+  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l2927;  yyDo(yy_1_MetaDataKey, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaDataKey", yybuf+yypos));
+  return 1;
+  l2927:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaDataKey", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_DocWithMetaData()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "DocWithMetaData"));
+  {  int yypos2948= yypos, yythunkpos2948= yythunkpos;  /* BOM */
+  {  if (!yymatchString("\357\273\277")) goto l2948;
+  }  goto l2949;
+  l2948:;	  yypos= yypos2948; yythunkpos= yythunkpos2948;
+  }
+  l2949:;	  /* StartList */
+  {
+  {  int yypos2950= yypos, yythunkpos2950= yythunkpos;  if (!yymatchDot()) goto l2947;  yypos= yypos2950; yythunkpos= yythunkpos2950;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -2, 0);  /* StartList */
+  {
+  {  int yypos2951= yypos, yythunkpos2951= yythunkpos;  if (!yymatchDot()) goto l2947;  yypos= yypos2951; yythunkpos= yythunkpos2951;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  {  int yypos2952= yypos, yythunkpos2952= yythunkpos;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2952;
+  {  int yypos2954= yypos, yythunkpos2954= yythunkpos;  if (!yy_MetaDataKey()) goto l2952;  /* Sp */
+  {
+  l2955:;	
+  {  int yypos2956= yypos, yythunkpos2956= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2957= yypos, yythunkpos2957= yythunkpos;  if (!yymatchChar(' ')) goto l2958;  goto l2957;
+  l2958:;	  yypos= yypos2957; yythunkpos= yythunkpos2957;  if (!yymatchChar('\t')) goto l2956;
+  }
+  l2957:;	
+  }  goto l2955;
+  l2956:;	  yypos= yypos2956; yythunkpos= yythunkpos2956;
+  }
+  }  if (!yymatchChar(':')) goto l2952;  /* Sp */
+  {
+  l2959:;	
+  {  int yypos2960= yypos, yythunkpos2960= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2961= yypos, yythunkpos2961= yythunkpos;  if (!yymatchChar(' ')) goto l2962;  goto l2961;
+  l2962:;	  yypos= yypos2961; yythunkpos= yythunkpos2961;  if (!yymatchChar('\t')) goto l2960;
+  }
+  l2961:;	
+  }  goto l2959;
+  l2960:;	  yypos= yypos2960; yythunkpos= yythunkpos2960;
+  }
+  }
+  {  int yypos2963= yypos, yythunkpos2963= yythunkpos;  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2963;
+  }  goto l2952;
+  l2963:;	  yypos= yypos2963; yythunkpos= yythunkpos2963;
+  }  yypos= yypos2954; yythunkpos= yythunkpos2954;
+  }  if (!yy_MetaData()) goto l2952;  yyDo(yy_1_DocWithMetaData, yybegin, yyend);  goto l2953;
+  l2952:;	  yypos= yypos2952; yythunkpos= yythunkpos2952;
+  }
+  l2953:;	
+  l2964:;	
+  {  int yypos2965= yypos, yythunkpos2965= yythunkpos;  if (!yy_Block()) goto l2965;  yyDo(yy_2_DocWithMetaData, yybegin, yyend);  goto l2964;
+  l2965:;	  yypos= yypos2965; yythunkpos= yythunkpos2965;
+  }  yyDo(yy_3_DocWithMetaData, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DocWithMetaData", yybuf+yypos));  yyDo(yyPop, 2, 0);
+  return 1;
+  l2947:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DocWithMetaData", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Block()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "Block"));
+  l2967:;	
+  {  int yypos2968= yypos, yythunkpos2968= yythunkpos;  /* BlankLine */
+  {  /* Sp */
+  {
+  l2969:;	
+  {  int yypos2970= yypos, yythunkpos2970= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2971= yypos, yythunkpos2971= yythunkpos;  if (!yymatchChar(' ')) goto l2972;  goto l2971;
+  l2972:;	  yypos= yypos2971; yythunkpos= yythunkpos2971;  if (!yymatchChar('\t')) goto l2970;
+  }
+  l2971:;	
+  }  goto l2969;
+  l2970:;	  yypos= yypos2970; yythunkpos= yythunkpos2970;
+  }
+  }  /* Newline */
+  {  if (!yymatchChar('\n')) goto l2968;
+  }
+  }  goto l2967;
+  l2968:;	  yypos= yypos2968; yythunkpos= yythunkpos2968;
+  }
+  {  int yypos2973= yypos, yythunkpos2973= yythunkpos;  if (!yy_BlockQuote()) goto l2974;  goto l2973;
+  l2974:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  if (!yy_Verbatim()) goto l2975;  goto l2973;
+  l2975:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2976;  if (!yy_DefinitionList()) goto l2976;  goto l2973;
+  l2976:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2977;  if (!yy_Glossary()) goto l2977;  goto l2973;
+  l2977:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  if (!yy_Note()) goto l2978;  goto l2973;
+  l2978:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  if (!yy_Reference()) goto l2979;  goto l2973;
+  l2979:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  if (!yy_HorizontalRule()) goto l2980;  goto l2973;
+  l2980:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  if (!yy_HeadingSection()) goto l2981;  goto l2973;
+  l2981:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  if (!yy_OrderedList()) goto l2982;  goto l2973;
+  l2982:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  if (!yy_BulletList()) goto l2983;  goto l2973;
+  l2983:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  if (!yy_HtmlBlock()) goto l2984;  goto l2973;
+  l2984:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  if (!yy_StyleBlock()) goto l2985;  goto l2973;
+  l2985:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2986;  if (!yy_Table()) goto l2986;  goto l2973;
+  l2986:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  yyText(yybegin, yyend);  if (!( !extension(EXT_COMPATIBILITY) )) goto l2987;  if (!yy_ImageBlock()) goto l2987;  goto l2973;
+  l2987:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;
+  {  int yypos2989= yypos, yythunkpos2989= yythunkpos;
+  {  int yypos2990= yypos, yythunkpos2990= yythunkpos;  /* Sp */
+  {
+  l2992:;	
+  {  int yypos2993= yypos, yythunkpos2993= yythunkpos;  /* Spacechar */
+  {
+  {  int yypos2994= yypos, yythunkpos2994= yythunkpos;  if (!yymatchChar(' ')) goto l2995;  goto l2994;
+  l2995:;	  yypos= yypos2994; yythunkpos= yythunkpos2994;  if (!yymatchChar('\t')) goto l2993;
+  }
+  l2994:;	
+  }  goto l2992;
+  l2993:;	  yypos= yypos2993; yythunkpos= yythunkpos2993;
+  }
+  }  goto l2991;
+  l2990:;	  yypos= yypos2990; yythunkpos= yythunkpos2990;
+  }
+  l2991:;	  if (!yy_HtmlBlockOpenDiv()) goto l2989;  goto l2988;
+  l2989:;	  yypos= yypos2989; yythunkpos= yythunkpos2989;
+  }  if (!yy_Para()) goto l2988;  goto l2973;
+  l2988:;	  yypos= yypos2973; yythunkpos= yythunkpos2973;  if (!yy_Plain()) goto l2966;
+  }
+  l2973:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Block", yybuf+yypos));
+  return 1;
+  l2966:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Block", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_StartList()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "StartList"));
+  {  int yypos2997= yypos, yythunkpos2997= yythunkpos;  if (!yymatchDot()) goto l2996;  yypos= yypos2997; yythunkpos= yythunkpos2997;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StartList", yybuf+yypos));
+  return 1;
+  l2996:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StartList", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_BOM()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;
+  yyprintf((stderr, "%s\n", "BOM"));  if (!yymatchString("\357\273\277")) goto l2998;
+  yyprintf((stderr, "  ok   %s @ %s\n", "BOM", yybuf+yypos));
+  return 1;
+  l2998:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BOM", yybuf+yypos));
+  return 0;
+}
+YY_RULE(int) yy_Doc()
+{  int yypos0= yypos, yythunkpos0= yythunkpos;  yyDo(yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Doc"));
+  {  int yypos3000= yypos, yythunkpos3000= yythunkpos;  /* BOM */
+  {  if (!yymatchString("\357\273\277")) goto l3000;
+  }  goto l3001;
+  l3000:;	  yypos= yypos3000; yythunkpos= yythunkpos3000;
+  }
+  l3001:;	  /* StartList */
+  {
+  {  int yypos3002= yypos, yythunkpos3002= yythunkpos;  if (!yymatchDot()) goto l2999;  yypos= yypos3002; yythunkpos= yythunkpos3002;
+  }  yyDo(yy_1_StartList, yybegin, yyend);
+  }  yyDo(yySet, -1, 0);
+  l3003:;	
+  {  int yypos3004= yypos, yythunkpos3004= yythunkpos;  if (!yy_Block()) goto l3004;  yyDo(yy_1_Doc, yybegin, yyend);  goto l3003;
+  l3004:;	  yypos= yypos3004; yythunkpos= yythunkpos3004;
+  }  yyDo(yy_2_Doc, yybegin, yyend);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Doc", yybuf+yypos));  yyDo(yyPop, 1, 0);
+  return 1;
+  l2999:;	  yypos= yypos0; yythunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Doc", yybuf+yypos));
+  return 0;
+}
+
+#ifndef YY_PART
+
+typedef int (*yyrule)();
+
+YY_PARSE(int) YYPARSEFROM(yyrule yystart)
+{
+  int yyok;
+  if (!yybuflen)
+    {
+      yybuflen= 1024;
+      yybuf= YY_MALLOC(yybuflen);
+      yytextlen= 1024;
+      yytext= YY_MALLOC(yytextlen);
+      yythunkslen= 32;
+      yythunks= YY_MALLOC(sizeof(yythunk) * yythunkslen);
+      yyvalslen= 32;
+      yyvals= YY_MALLOC(sizeof(YYSTYPE) * yyvalslen);
+      yybegin= yyend= yypos= yylimit= yythunkpos= 0;
+    }
+  yybegin= yyend= yypos;
+  yythunkpos= 0;
+  yyval= yyvals;
+  yyok= yystart();
+  if (yyok) yyDone();
+  yyCommit();
+  return yyok;
+  (void)yyrefill;
+  (void)yymatchDot;
+  (void)yymatchChar;
+  (void)yymatchString;
+  (void)yymatchClass;
+  (void)yyDo;
+  (void)yyText;
+  (void)yyDone;
+  (void)yyCommit;
+  (void)yyAccept;
+  (void)yyPush;
+  (void)yyPop;
+  (void)yySet;
+  (void)yytextmax;
+  (void)yy_EmptyCell;
+  (void)yy_TableCell;
+  (void)yy_CellDivider;
+  (void)yy_DoubleQuoteEnd;
+  (void)yy_DoubleQuoteStart;
+  (void)yy_SingleQuoteEnd;
+  (void)yy_Apostrophe;
+  (void)yy_Dash;
+  (void)yy_Digit;
+  (void)yy_NonAlphanumeric;
+  (void)yy_Ticks5;
+  (void)yy_Ticks4;
+  (void)yy_Ticks3;
+  (void)yy_Ticks2;
+  (void)yy_Ticks1;
+  (void)yy_EmptyTitle;
+  (void)yy_Nonspacechar;
+  (void)yy_AutoLink;
+  (void)yy_ReferenceLink;
+  (void)yy_Eof;
+  (void)yy_Alphanumeric;
+  (void)yy_Link;
+  (void)yy_Emph;
+  (void)yy_Strong;
+  (void)yy_Space;
+  (void)yy_OptionallyIndentedLine;
+  (void)yy_Indent;
+  (void)yy_Spacechar;
+  (void)yy_IndentedLine;
+  (void)yy_NonblankIndentedLine;
+  (void)yy_Line;
+  (void)yy_Endline;
+  (void)yy_SetextHeading;
+  (void)yy_Heading;
+  (void)yy_BlankLine;
+  (void)yy_AlphanumericAscii;
+  (void)yy_Newline;
+  (void)yy_Sp;
+  (void)yy_StartList;
+  (void)yy_BOM;
+}
+
+YY_PARSE(int) YYPARSE(void)
+{
+  return YYPARSEFROM(yy_Doc);
+}
+
+YY_PARSE(void) YYRELEASE(void)
+{
+  if (yybuflen)
+    {
+      YY_FREE(yybuf);
+      YY_FREE(yytext);
+      YY_FREE(yythunks);
+      YY_FREE(yyvals);
+      yybuf= yytext= 0;
+      yythunks= 0;
+      yyval= yyvals= 0;
+      yybuflen= yytextlen= yythunkslen= yyvalslen= 0;
+    }
+}
+
+#endif
+
+
+#include "parsing_functions.c"
+
+
@@ -0,0 +1,13242 @@
+/* A bytecode parser generated by peg 0.1.2 */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define YYRULECOUNT 336
+
+/**********************************************************************
+
+  markdown_parser.leg - markdown parser in C using a PEG grammar.
+  (c) 2008 John MacFarlane (jgm at berkeley dot edu).
+  
+  portions Copyright (c) 2010-2011 Fletcher T. Penney
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+ ***********************************************************************/
+
+#include <stdbool.h>
+#include <assert.h>
+#include "markdown_peg.h"
+#include "utility_functions.c"
+
+#define YY_DEBUG_OFF
+
+/**********************************************************************
+
+  PEG grammar and parser actions for markdown syntax.
+
+ ***********************************************************************/
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic ignored "-Wunused-label"
+#endif
+#ifndef YY_VARIABLE
+#define YY_VARIABLE(T)	static T
+#endif
+#ifndef YY_LOCAL
+#define YY_LOCAL(T)	static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T)	static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T)	static T
+#endif
+#ifndef YY_PARSE
+#define YY_PARSE(T)	T
+#endif
+#ifndef YYPARSE
+#define YYPARSE		yyparse
+#endif
+#ifndef YYPARSEFROM
+#define YYPARSEFROM	yyparsefrom
+#endif
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size)			\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#ifndef YY_MALLOC
+#define YY_MALLOC(N)		malloc(N)
+#endif
+#ifndef YY_REALLOC
+#define YY_REALLOC(P, N)	realloc(P, N)
+#endif
+#ifndef YY_FREE
+#define YY_FREE(P)		free(P)
+#endif
+#ifndef YYRELEASE
+#define YYRELEASE	yyrelease
+#endif
+#ifndef YY_ACTION_POS
+#define YY_ACTION_POS(POS)
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( yybegin= yypos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( yyend= yypos, 1)
+#endif
+#ifndef YY_LIKELY
+# ifdef __GNUC__
+#  define YY_LIKELY(X)		__builtin_expect(!!(X), 1)
+#  define YY_UNLIKELY(X)	__builtin_expect(!!(X), 0)
+# else
+#  define YY_LIKELY(X)		(X)
+#  define YY_UNLIKELY(X)	(X)
+# endif
+#endif
+#ifndef YY_HOT
+# ifdef __GNUC__
+#  define YY_HOT	__attribute__((hot))
+#  define YY_COLD	__attribute__((cold))
+# else
+#  define YY_HOT
+#  define YY_COLD
+# endif
+#endif
+#ifdef YY_DEBUG
+# define yyprintf(args)	fprintf args
+#else
+# define yyprintf(args)
+#endif
+#ifndef YYSTYPE
+#define YYSTYPE	int
+#endif
+
+#ifndef YY_PART
+
+typedef void (*yyaction)(char *yytext, int yyleng);
+typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;
+
+YY_VARIABLE(char *   ) yybuf= 0;
+YY_VARIABLE(int	     ) yybuflen= 0;
+YY_VARIABLE(int	     ) yypos= 0;
+YY_VARIABLE(int	     ) yylimit= 0;
+YY_VARIABLE(char *   ) yytext= 0;
+YY_VARIABLE(int	     ) yytextlen= 0;
+YY_VARIABLE(int	     ) yybegin= 0;
+YY_VARIABLE(int	     ) yyend= 0;
+YY_VARIABLE(int	     ) yytextmax= 0;
+YY_VARIABLE(yythunk *) yythunks= 0;
+YY_VARIABLE(int	     ) yythunkslen= 0;
+YY_VARIABLE(int      ) yythunkpos= 0;
+YY_VARIABLE(YYSTYPE  ) yy;
+YY_VARIABLE(YYSTYPE *) yyval= 0;
+YY_VARIABLE(YYSTYPE *) yyvals= 0;
+YY_VARIABLE(int      ) yyvalslen= 0;
+
+YY_LOCAL(int) yyrefill(void)
+{
+  int yyn;
+  while (yybuflen - yypos < 512)
+    {
+      yybuflen *= 2;
+      yybuf= YY_REALLOC(yybuf, yybuflen);
+    }
+  YY_INPUT((yybuf + yypos), yyn, (yybuflen - yypos));
+  if (!yyn) return 0;
+  yylimit += yyn;
+  return 1;
+}
+
+YY_LOCAL(int) yymatchDot(void)
+{
+  if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;
+  ++yypos;
+  return 1;
+}
+
+YY_LOCAL(int) yymatchChar(int c)
+{
+  if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;
+  if (yybuf[yypos] == c)
+    {
+      ++yypos;
+      yyprintf((stderr, "  ok   yymatchChar(%c) @ %s\n", c, yybuf+yypos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchChar(%c) @ %s\n", c, yybuf+yypos));
+  return 0;
+}
+
+YY_LOCAL(int) yymatchString(char *s)
+{
+  int yysav= yypos;
+  while (*s)
+    {
+      if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;
+      if (yybuf[yypos] != *s)
+        {
+          yypos= yysav;
+          return 0;
+        }
+      ++s;
+      ++yypos;
+    }
+  return 1;
+}
+
+YY_LOCAL(int) yymatchClass(unsigned char *bits)
+{
+  int c;
+  if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;
+  c= (unsigned char)yybuf[yypos];
+  if (bits[c >> 3] & (1 << (c & 7)))
+    {
+      ++yypos;
+      yyprintf((stderr, "  ok   yymatchClass @ %s\n", yybuf+yypos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchClass @ %s\n", yybuf+yypos));
+  return 0;
+}
+
+YY_LOCAL(void) yyDo(yyaction action, int begin, int end)
+{
+  while (YY_UNLIKELY(yythunkpos >= yythunkslen))
+    {
+      yythunkslen *= 2;
+      yythunks= YY_REALLOC(yythunks, sizeof(yythunk) * yythunkslen);
+    }
+  yythunks[yythunkpos].begin=  begin;
+  yythunks[yythunkpos].end=    end;
+  yythunks[yythunkpos].action= action;
+  ++yythunkpos;
+}
+
+YY_LOCAL(int) yyText(int begin, int end)
+{
+  int yyleng= end - begin;
+  if (yyleng <= 0)
+    yyleng= 0;
+  else
+    {
+      while (yytextlen < (yyleng + 1))
+	{
+	  yytextlen *= 2;
+	  yytext= YY_REALLOC(yytext, yytextlen);
+	}
+      memcpy(yytext, yybuf + begin, yyleng);
+    }
+  yytext[yyleng]= '\0';
+  return yyleng;
+}
+
+YY_LOCAL(void) yyDone(void)
+{
+  int pos;
+  for (pos= 0;  pos < yythunkpos;  ++pos)
+    {
+      yythunk *thunk= &yythunks[pos];
+      int yyleng= thunk->end ? yyText(thunk->begin, thunk->end) : thunk->begin;
+      yyprintf((stderr, "DO [%d] %p %s\n", pos, thunk->action, yytext));
+      YY_ACTION_POS(thunk->begin);
+      thunk->action(yytext, yyleng);
+    }
+  yythunkpos= 0;
+}
+
+YY_LOCAL(void) yyCommit()
+{
+  if ((yylimit -= yypos))
+    {
+      memmove(yybuf, yybuf + yypos, yylimit);
+    }
+  yybegin -= yypos;
+  yyend -= yypos;
+  yypos= yythunkpos= 0;
+}
+
+YY_LOCAL(int) yyAccept(int tp0)
+{
+  if (tp0)
+    {
+      fprintf(stderr, "accept denied at %d\n", tp0);
+      return 0;
+    }
+  else
+    {
+      yyDone();
+      yyCommit();
+    }
+  return 1;
+}
+
+YY_LOCAL(void) yyPush(char *text, int count)
+{
+  yyval += count;
+  while (yyval - yyvals >= yyvalslen)
+    {
+      int yyoff= yyval - yyvals;
+      yyvalslen *= 2;
+      yyvals= YY_REALLOC(yyvals, sizeof(YYSTYPE) * yyvalslen);
+      yyval= yyvals + yyoff;
+    }
+}
+YY_LOCAL(void) yyPop(char *text, int count)	{ yyval -= count; }
+YY_LOCAL(void) yySet(char *text, int count)	{ yyval[count]= yy; }
+
+#endif /* YY_PART */
+
+#define	YYACCEPT	yyAccept(yythunkpos0)
+
+YY_RULE(int) yy_MarkdownHtmlAttribute(); /* 336 */
+YY_RULE(int) yy_OPMLSetextHeading2(); /* 335 */
+YY_RULE(int) yy_OPMLSetextHeading1(); /* 334 */
+YY_RULE(int) yy_OPMLSetextHeading(); /* 333 */
+YY_RULE(int) yy_OPMLAtxHeading(); /* 332 */
+YY_RULE(int) yy_OPMLSectionBlock(); /* 331 */
+YY_RULE(int) yy_OPMLHeading(); /* 330 */
+YY_RULE(int) yy_OPMLPlain(); /* 329 */
+YY_RULE(int) yy_OPMLHeadingSection(); /* 328 */
+YY_RULE(int) yy_OPMLBlock(); /* 327 */
+YY_RULE(int) yy_DocForOPML(); /* 326 */
+YY_RULE(int) yy_RightAlign(); /* 325 */
+YY_RULE(int) yy_CenterAlign(); /* 324 */
+YY_RULE(int) yy_LeftAlign(); /* 323 */
+YY_RULE(int) yy_RightAlignWrap(); /* 322 */
+YY_RULE(int) yy_CenterAlignWrap(); /* 321 */
+YY_RULE(int) yy_LeftAlignWrap(); /* 320 */
+YY_RULE(int) yy_AlignmentCell(); /* 319 */
+YY_RULE(int) yy_CellStr(); /* 318 */
+YY_RULE(int) yy_FullCell(); /* 317 */
+YY_RULE(int) yy_EmptyCell(); /* 316 */
+YY_RULE(int) yy_ExtendedCell(); /* 315 */
+YY_RULE(int) yy_TableCell(); /* 314 */
+YY_RULE(int) yy_CellDivider(); /* 313 */
+YY_RULE(int) yy_TableLine(); /* 312 */
+YY_RULE(int) yy_TableRow(); /* 311 */
+YY_RULE(int) yy_Definition(); /* 310 */
+YY_RULE(int) yy_Term(); /* 309 */
+YY_RULE(int) yy_TermLine(); /* 308 */
+YY_RULE(int) yy_SeparatorLine(); /* 307 */
+YY_RULE(int) yy_TableBody(); /* 306 */
+YY_RULE(int) yy_TableCaption(); /* 305 */
+YY_RULE(int) yy_AutoLabels(); /* 304 */
+YY_RULE(int) yy_RawCitationReference(); /* 303 */
+YY_RULE(int) yy_CitationReferenceSingle(); /* 302 */
+YY_RULE(int) yy_CitationReferenceDouble(); /* 301 */
+YY_RULE(int) yy_Notes(); /* 300 */
+YY_RULE(int) yy_InlineNote(); /* 299 */
+YY_RULE(int) yy_RawNoteBlock(); /* 298 */
+YY_RULE(int) yy_GlossarySortKey(); /* 297 */
+YY_RULE(int) yy_GlossaryTerm(); /* 296 */
+YY_RULE(int) yy_RawNoteReference(); /* 295 */
+YY_RULE(int) yy_DoubleQuoteEnd(); /* 294 */
+YY_RULE(int) yy_DoubleQuoteStart(); /* 293 */
+YY_RULE(int) yy_SingleQuoteEnd(); /* 292 */
+YY_RULE(int) yy_SingleQuoteStart(); /* 291 */
+YY_RULE(int) yy_EnDash(); /* 290 */
+YY_RULE(int) yy_EmDash(); /* 289 */
+YY_RULE(int) yy_Apostrophe(); /* 288 */
+YY_RULE(int) yy_DoubleQuoted(); /* 287 */
+YY_RULE(int) yy_SingleQuoted(); /* 286 */
+YY_RULE(int) yy_Dash(); /* 285 */
+YY_RULE(int) yy_Ellipsis(); /* 284 */
+YY_RULE(int) yy_Digit(); /* 283 */
+YY_RULE(int) yy_NonAlphanumeric(); /* 282 */
+YY_RULE(int) yy_ExtendedSpecialChar(); /* 281 */
+YY_RULE(int) yy_Quoted(); /* 280 */
+YY_RULE(int) yy_HtmlTag(); /* 279 */
+YY_RULE(int) yy_Ticks5(); /* 278 */
+YY_RULE(int) yy_Ticks4(); /* 277 */
+YY_RULE(int) yy_Ticks3(); /* 276 */
+YY_RULE(int) yy_Ticks2(); /* 275 */
+YY_RULE(int) yy_Ticks1(); /* 274 */
+YY_RULE(int) yy_References(); /* 273 */
+YY_RULE(int) yy_EmptyTitle(); /* 272 */
+YY_RULE(int) yy_RefTitleParens(); /* 271 */
+YY_RULE(int) yy_RefTitleDouble(); /* 270 */
+YY_RULE(int) yy_RefTitleSingle(); /* 269 */
+YY_RULE(int) yy_UnQuotedValue(); /* 268 */
+YY_RULE(int) yy_QuotedValue(); /* 267 */
+YY_RULE(int) yy_AttrValue(); /* 266 */
+YY_RULE(int) yy_AttrKey(); /* 265 */
+YY_RULE(int) yy_Attribute(); /* 264 */
+YY_RULE(int) yy_Attributes(); /* 263 */
+YY_RULE(int) yy_RefTitle(); /* 262 */
+YY_RULE(int) yy_RefSrc(); /* 261 */
+YY_RULE(int) yy_AutoLinkEmail(); /* 260 */
+YY_RULE(int) yy_AutoLinkUrl(); /* 259 */
+YY_RULE(int) yy_TitleDouble(); /* 258 */
+YY_RULE(int) yy_TitleSingle(); /* 257 */
+YY_RULE(int) yy_Nonspacechar(); /* 256 */
+YY_RULE(int) yy_SourceContents(); /* 255 */
+YY_RULE(int) yy_Title(); /* 254 */
+YY_RULE(int) yy_Source(); /* 253 */
+YY_RULE(int) yy_Label(); /* 252 */
+YY_RULE(int) yy_ReferenceLinkSingle(); /* 251 */
+YY_RULE(int) yy_ReferenceLinkDouble(); /* 250 */
+YY_RULE(int) yy_AutoLink(); /* 249 */
+YY_RULE(int) yy_ReferenceLink(); /* 248 */
+YY_RULE(int) yy_ExplicitLink(); /* 247 */
+YY_RULE(int) yy_TwoUlClose(); /* 246 */
+YY_RULE(int) yy_TwoUlOpen(); /* 245 */
+YY_RULE(int) yy_TwoStarClose(); /* 244 */
+YY_RULE(int) yy_TwoStarOpen(); /* 243 */
+YY_RULE(int) yy_StrongUl(); /* 242 */
+YY_RULE(int) yy_StrongStar(); /* 241 */
+YY_RULE(int) yy_OneUlClose(); /* 240 */
+YY_RULE(int) yy_OneUlOpen(); /* 239 */
+YY_RULE(int) yy_OneStarClose(); /* 238 */
+YY_RULE(int) yy_OneStarOpen(); /* 237 */
+YY_RULE(int) yy_EmphUl(); /* 236 */
+YY_RULE(int) yy_EmphStar(); /* 235 */
+YY_RULE(int) yy_StarLine(); /* 234 */
+YY_RULE(int) yy_UlLine(); /* 233 */
+YY_RULE(int) yy_SpecialChar(); /* 232 */
+YY_RULE(int) yy_Eof(); /* 231 */
+YY_RULE(int) yy_NormalEndline(); /* 230 */
+YY_RULE(int) yy_TerminalEndline(); /* 229 */
+YY_RULE(int) yy_LineBreak(); /* 228 */
+YY_RULE(int) yy_CharEntity(); /* 227 */
+YY_RULE(int) yy_DecEntity(); /* 226 */
+YY_RULE(int) yy_HexEntity(); /* 225 */
+YY_RULE(int) yy_AposChunk(); /* 224 */
+YY_RULE(int) yy_Alphanumeric(); /* 223 */
+YY_RULE(int) yy_StrChunk(); /* 222 */
+YY_RULE(int) yy_NormalChar(); /* 221 */
+YY_RULE(int) yy_Symbol(); /* 220 */
+YY_RULE(int) yy_Smart(); /* 219 */
+YY_RULE(int) yy_EscapedChar(); /* 218 */
+YY_RULE(int) yy_Entity(); /* 217 */
+YY_RULE(int) yy_RawHtml(); /* 216 */
+YY_RULE(int) yy_Code(); /* 215 */
+YY_RULE(int) yy_NoteReference(); /* 214 */
+YY_RULE(int) yy_Link(); /* 213 */
+YY_RULE(int) yy_Image(); /* 212 */
+YY_RULE(int) yy_CitationReference(); /* 211 */
+YY_RULE(int) yy_Emph(); /* 210 */
+YY_RULE(int) yy_Strong(); /* 209 */
+YY_RULE(int) yy_Space(); /* 208 */
+YY_RULE(int) yy_UlOrStarLine(); /* 207 */
+YY_RULE(int) yy_MathSpan(); /* 206 */
+YY_RULE(int) yy_Str(); /* 205 */
+YY_RULE(int) yy_InStyleTags(); /* 204 */
+YY_RULE(int) yy_StyleClose(); /* 203 */
+YY_RULE(int) yy_StyleOpen(); /* 202 */
+YY_RULE(int) yy_HtmlBlockType(); /* 201 */
+YY_RULE(int) yy_HtmlBlockSelfClosing(); /* 200 */
+YY_RULE(int) yy_HtmlComment(); /* 199 */
+YY_RULE(int) yy_MarkdownHtmlTagOpen(); /* 198 */
+YY_RULE(int) yy_HtmlBlockInTags(); /* 197 */
+YY_RULE(int) yy_HtmlBlockScript(); /* 196 */
+YY_RULE(int) yy_HtmlBlockCloseScript(); /* 195 */
+YY_RULE(int) yy_HtmlBlockOpenScript(); /* 194 */
+YY_RULE(int) yy_HtmlBlockTr(); /* 193 */
+YY_RULE(int) yy_HtmlBlockCloseTr(); /* 192 */
+YY_RULE(int) yy_HtmlBlockOpenTr(); /* 191 */
+YY_RULE(int) yy_HtmlBlockThead(); /* 190 */
+YY_RULE(int) yy_HtmlBlockCloseThead(); /* 189 */
+YY_RULE(int) yy_HtmlBlockOpenThead(); /* 188 */
+YY_RULE(int) yy_HtmlBlockTh(); /* 187 */
+YY_RULE(int) yy_HtmlBlockCloseTh(); /* 186 */
+YY_RULE(int) yy_HtmlBlockOpenTh(); /* 185 */
+YY_RULE(int) yy_HtmlBlockTfoot(); /* 184 */
+YY_RULE(int) yy_HtmlBlockCloseTfoot(); /* 183 */
+YY_RULE(int) yy_HtmlBlockOpenTfoot(); /* 182 */
+YY_RULE(int) yy_HtmlBlockTd(); /* 181 */
+YY_RULE(int) yy_HtmlBlockCloseTd(); /* 180 */
+YY_RULE(int) yy_HtmlBlockOpenTd(); /* 179 */
+YY_RULE(int) yy_HtmlBlockTbody(); /* 178 */
+YY_RULE(int) yy_HtmlBlockCloseTbody(); /* 177 */
+YY_RULE(int) yy_HtmlBlockOpenTbody(); /* 176 */
+YY_RULE(int) yy_HtmlBlockLi(); /* 175 */
+YY_RULE(int) yy_HtmlBlockCloseLi(); /* 174 */
+YY_RULE(int) yy_HtmlBlockOpenLi(); /* 173 */
+YY_RULE(int) yy_HtmlBlockFrameset(); /* 172 */
+YY_RULE(int) yy_HtmlBlockCloseFrameset(); /* 171 */
+YY_RULE(int) yy_HtmlBlockOpenFrameset(); /* 170 */
+YY_RULE(int) yy_HtmlBlockDt(); /* 169 */
+YY_RULE(int) yy_HtmlBlockCloseDt(); /* 168 */
+YY_RULE(int) yy_HtmlBlockOpenDt(); /* 167 */
+YY_RULE(int) yy_HtmlBlockDd(); /* 166 */
+YY_RULE(int) yy_HtmlBlockCloseDd(); /* 165 */
+YY_RULE(int) yy_HtmlBlockOpenDd(); /* 164 */
+YY_RULE(int) yy_HtmlBlockVideo(); /* 163 */
+YY_RULE(int) yy_HtmlBlockCloseVideo(); /* 162 */
+YY_RULE(int) yy_HtmlBlockOpenVideo(); /* 161 */
+YY_RULE(int) yy_HtmlBlockUl(); /* 160 */
+YY_RULE(int) yy_HtmlBlockCloseUl(); /* 159 */
+YY_RULE(int) yy_HtmlBlockOpenUl(); /* 158 */
+YY_RULE(int) yy_HtmlBlockTable(); /* 157 */
+YY_RULE(int) yy_HtmlBlockCloseTable(); /* 156 */
+YY_RULE(int) yy_HtmlBlockOpenTable(); /* 155 */
+YY_RULE(int) yy_HtmlBlockSection(); /* 154 */
+YY_RULE(int) yy_HtmlBlockCloseSection(); /* 153 */
+YY_RULE(int) yy_HtmlBlockOpenSection(); /* 152 */
+YY_RULE(int) yy_HtmlBlockProgress(); /* 151 */
+YY_RULE(int) yy_HtmlBlockCloseProgress(); /* 150 */
+YY_RULE(int) yy_HtmlBlockOpenProgress(); /* 149 */
+YY_RULE(int) yy_HtmlBlockPre(); /* 148 */
+YY_RULE(int) yy_HtmlBlockClosePre(); /* 147 */
+YY_RULE(int) yy_HtmlBlockOpenPre(); /* 146 */
+YY_RULE(int) yy_HtmlBlockP(); /* 145 */
+YY_RULE(int) yy_HtmlBlockCloseP(); /* 144 */
+YY_RULE(int) yy_HtmlBlockOpenP(); /* 143 */
+YY_RULE(int) yy_HtmlBlockOl(); /* 142 */
+YY_RULE(int) yy_HtmlBlockCloseOl(); /* 141 */
+YY_RULE(int) yy_HtmlBlockOpenOl(); /* 140 */
+YY_RULE(int) yy_HtmlBlockNoscript(); /* 139 */
+YY_RULE(int) yy_HtmlBlockCloseNoscript(); /* 138 */
+YY_RULE(int) yy_HtmlBlockOpenNoscript(); /* 137 */
+YY_RULE(int) yy_HtmlBlockNoframes(); /* 136 */
+YY_RULE(int) yy_HtmlBlockCloseNoframes(); /* 135 */
+YY_RULE(int) yy_HtmlBlockOpenNoframes(); /* 134 */
+YY_RULE(int) yy_HtmlBlockMenu(); /* 133 */
+YY_RULE(int) yy_HtmlBlockCloseMenu(); /* 132 */
+YY_RULE(int) yy_HtmlBlockOpenMenu(); /* 131 */
+YY_RULE(int) yy_HtmlBlockH6(); /* 130 */
+YY_RULE(int) yy_HtmlBlockCloseH6(); /* 129 */
+YY_RULE(int) yy_HtmlBlockOpenH6(); /* 128 */
+YY_RULE(int) yy_HtmlBlockH5(); /* 127 */
+YY_RULE(int) yy_HtmlBlockCloseH5(); /* 126 */
+YY_RULE(int) yy_HtmlBlockOpenH5(); /* 125 */
+YY_RULE(int) yy_HtmlBlockH4(); /* 124 */
+YY_RULE(int) yy_HtmlBlockCloseH4(); /* 123 */
+YY_RULE(int) yy_HtmlBlockOpenH4(); /* 122 */
+YY_RULE(int) yy_HtmlBlockH3(); /* 121 */
+YY_RULE(int) yy_HtmlBlockCloseH3(); /* 120 */
+YY_RULE(int) yy_HtmlBlockOpenH3(); /* 119 */
+YY_RULE(int) yy_HtmlBlockH2(); /* 118 */
+YY_RULE(int) yy_HtmlBlockCloseH2(); /* 117 */
+YY_RULE(int) yy_HtmlBlockOpenH2(); /* 116 */
+YY_RULE(int) yy_HtmlBlockH1(); /* 115 */
+YY_RULE(int) yy_HtmlBlockCloseH1(); /* 114 */
+YY_RULE(int) yy_HtmlBlockOpenH1(); /* 113 */
+YY_RULE(int) yy_HtmlBlockHgroup(); /* 112 */
+YY_RULE(int) yy_HtmlBlockCloseHgroup(); /* 111 */
+YY_RULE(int) yy_HtmlBlockOpenHgroup(); /* 110 */
+YY_RULE(int) yy_HtmlBlockHeader(); /* 109 */
+YY_RULE(int) yy_HtmlBlockCloseHeader(); /* 108 */
+YY_RULE(int) yy_HtmlBlockOpenHeader(); /* 107 */
+YY_RULE(int) yy_HtmlBlockForm(); /* 106 */
+YY_RULE(int) yy_HtmlBlockCloseForm(); /* 105 */
+YY_RULE(int) yy_HtmlBlockOpenForm(); /* 104 */
+YY_RULE(int) yy_HtmlBlockFooter(); /* 103 */
+YY_RULE(int) yy_HtmlBlockCloseFooter(); /* 102 */
+YY_RULE(int) yy_HtmlBlockOpenFooter(); /* 101 */
+YY_RULE(int) yy_HtmlBlockFigure(); /* 100 */
+YY_RULE(int) yy_HtmlBlockCloseFigure(); /* 99 */
+YY_RULE(int) yy_HtmlBlockOpenFigure(); /* 98 */
+YY_RULE(int) yy_HtmlBlockFieldset(); /* 97 */
+YY_RULE(int) yy_HtmlBlockCloseFieldset(); /* 96 */
+YY_RULE(int) yy_HtmlBlockOpenFieldset(); /* 95 */
+YY_RULE(int) yy_HtmlBlockDl(); /* 94 */
+YY_RULE(int) yy_HtmlBlockCloseDl(); /* 93 */
+YY_RULE(int) yy_HtmlBlockOpenDl(); /* 92 */
+YY_RULE(int) yy_HtmlBlockDiv(); /* 91 */
+YY_RULE(int) yy_HtmlBlockCloseDiv(); /* 90 */
+YY_RULE(int) yy_HtmlBlockDir(); /* 89 */
+YY_RULE(int) yy_HtmlBlockCloseDir(); /* 88 */
+YY_RULE(int) yy_HtmlBlockOpenDir(); /* 87 */
+YY_RULE(int) yy_HtmlBlockCenter(); /* 86 */
+YY_RULE(int) yy_HtmlBlockCloseCenter(); /* 85 */
+YY_RULE(int) yy_HtmlBlockOpenCenter(); /* 84 */
+YY_RULE(int) yy_HtmlBlockCanvas(); /* 83 */
+YY_RULE(int) yy_HtmlBlockCloseCanvas(); /* 82 */
+YY_RULE(int) yy_HtmlBlockOpenCanvas(); /* 81 */
+YY_RULE(int) yy_HtmlBlockBlockquote(); /* 80 */
+YY_RULE(int) yy_HtmlBlockCloseBlockquote(); /* 79 */
+YY_RULE(int) yy_HtmlBlockOpenBlockquote(); /* 78 */
+YY_RULE(int) yy_HtmlBlockAside(); /* 77 */
+YY_RULE(int) yy_HtmlBlockCloseAside(); /* 76 */
+YY_RULE(int) yy_HtmlBlockOpenAside(); /* 75 */
+YY_RULE(int) yy_HtmlBlockArticle(); /* 74 */
+YY_RULE(int) yy_HtmlBlockCloseArticle(); /* 73 */
+YY_RULE(int) yy_HtmlBlockOpenArticle(); /* 72 */
+YY_RULE(int) yy_HtmlBlockAddress(); /* 71 */
+YY_RULE(int) yy_HtmlBlockCloseAddress(); /* 70 */
+YY_RULE(int) yy_HtmlAttribute(); /* 69 */
+YY_RULE(int) yy_Spnl(); /* 68 */
+YY_RULE(int) yy_HtmlBlockOpenAddress(); /* 67 */
+YY_RULE(int) yy_OptionallyIndentedLine(); /* 66 */
+YY_RULE(int) yy_Indent(); /* 65 */
+YY_RULE(int) yy_ListBlockLine(); /* 64 */
+YY_RULE(int) yy_ListContinuationBlock(); /* 63 */
+YY_RULE(int) yy_ListBlock(); /* 62 */
+YY_RULE(int) yy_ListItem(); /* 61 */
+YY_RULE(int) yy_Enumerator(); /* 60 */
+YY_RULE(int) yy_ListItemTight(); /* 59 */
+YY_RULE(int) yy_ListLoose(); /* 58 */
+YY_RULE(int) yy_ListTight(); /* 57 */
+YY_RULE(int) yy_Spacechar(); /* 56 */
+YY_RULE(int) yy_Bullet(); /* 55 */
+YY_RULE(int) yy_VerbatimChunk(); /* 54 */
+YY_RULE(int) yy_IndentedLine(); /* 53 */
+YY_RULE(int) yy_NonblankIndentedLine(); /* 52 */
+YY_RULE(int) yy_Line(); /* 51 */
+YY_RULE(int) yy_BlockQuoteRaw(); /* 50 */
+YY_RULE(int) yy_Endline(); /* 49 */
+YY_RULE(int) yy_SetextBottom2(); /* 48 */
+YY_RULE(int) yy_SetextBottom1(); /* 47 */
+YY_RULE(int) yy_SetextHeading2(); /* 46 */
+YY_RULE(int) yy_SetextHeading1(); /* 45 */
+YY_RULE(int) yy_SetextHeading(); /* 44 */
+YY_RULE(int) yy_AtxHeading(); /* 43 */
+YY_RULE(int) yy_AtxStart(); /* 42 */
+YY_RULE(int) yy_Inline(); /* 41 */
+YY_RULE(int) yy_AutoLabel(); /* 40 */
+YY_RULE(int) yy_AtxInline(); /* 39 */
+YY_RULE(int) yy_Inlines(); /* 38 */
+YY_RULE(int) yy_NonindentSpace(); /* 37 */
+YY_RULE(int) yy_Heading(); /* 36 */
+YY_RULE(int) yy_HeadingSectionBlock(); /* 35 */
+YY_RULE(int) yy_Plain(); /* 34 */
+YY_RULE(int) yy_Para(); /* 33 */
+YY_RULE(int) yy_HtmlBlockOpenDiv(); /* 32 */
+YY_RULE(int) yy_ImageBlock(); /* 31 */
+YY_RULE(int) yy_Table(); /* 30 */
+YY_RULE(int) yy_StyleBlock(); /* 29 */
+YY_RULE(int) yy_HtmlBlock(); /* 28 */
+YY_RULE(int) yy_BulletList(); /* 27 */
+YY_RULE(int) yy_OrderedList(); /* 26 */
+YY_RULE(int) yy_HeadingSection(); /* 25 */
+YY_RULE(int) yy_HorizontalRule(); /* 24 */
+YY_RULE(int) yy_Reference(); /* 23 */
+YY_RULE(int) yy_Note(); /* 22 */
+YY_RULE(int) yy_Glossary(); /* 21 */
+YY_RULE(int) yy_DefinitionList(); /* 20 */
+YY_RULE(int) yy_Verbatim(); /* 19 */
+YY_RULE(int) yy_BlockQuote(); /* 18 */
+YY_RULE(int) yy_RawLine(); /* 17 */
+YY_RULE(int) yy_BlankLine(); /* 16 */
+YY_RULE(int) yy_SingleLineMetaKeyValue(); /* 15 */
+YY_RULE(int) yy_AlphanumericAscii(); /* 14 */
+YY_RULE(int) yy_MetaDataValue(); /* 13 */
+YY_RULE(int) yy_SkipBlock(); /* 12 */
+YY_RULE(int) yy_MetaDataOnly(); /* 11 */
+YY_RULE(int) yy_MetaDataKeyValue(); /* 10 */
+YY_RULE(int) yy_MetaData(); /* 9 */
+YY_RULE(int) yy_Newline(); /* 8 */
+YY_RULE(int) yy_Sp(); /* 7 */
+YY_RULE(int) yy_MetaDataKey(); /* 6 */
+YY_RULE(int) yy_DocWithMetaData(); /* 5 */
+YY_RULE(int) yy_Block(); /* 4 */
+YY_RULE(int) yy_StartList(); /* 3 */
+YY_RULE(int) yy_BOM(); /* 2 */
+YY_RULE(int) yy_Doc(); /* 1 */
+
+YY_ACTION(void) yy_6_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_6_MarkdownHtmlTagOpen\n"));
+  
+                yy = mk_str_from_list(a,false);
+                yy->key = HTML;
+            ;
+#undef a
+}
+YY_ACTION(void) yy_5_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_5_MarkdownHtmlTagOpen\n"));
+   a = add_last(mk_token('>'), a);;
+#undef a
+}
+YY_ACTION(void) yy_4_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_4_MarkdownHtmlTagOpen\n"));
+  a = add_last(mk_token(' '), a);
+                a = add_last(mk_str(yytext), a);;
+#undef a
+}
+YY_ACTION(void) yy_3_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_MarkdownHtmlTagOpen\n"));
+  a = add_last(mk_token(' '), a);
+                a = add_last(mk_str(yytext), a);;
+#undef a
+}
+YY_ACTION(void) yy_2_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_MarkdownHtmlTagOpen\n"));
+  a = add_last(mk_str(yytext), a);;
+#undef a
+}
+YY_ACTION(void) yy_1_MarkdownHtmlTagOpen(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_MarkdownHtmlTagOpen\n"));
+  a = add_last(mk_token('<'), a);;
+#undef a
+}
+YY_ACTION(void) yy_2_OPMLPlain(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_OPMLPlain\n"));
+   yy = mk_list(PLAIN, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OPMLPlain(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_OPMLPlain\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OPMLSetextHeading2(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_OPMLSetextHeading2\n"));
+  
+		yy = mk_str(yytext);
+		yy->key = H2;
+	;
+}
+YY_ACTION(void) yy_1_OPMLSetextHeading1(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_OPMLSetextHeading1\n"));
+  
+		yy = mk_str(yytext);
+		yy->key = H1;
+	;
+}
+YY_ACTION(void) yy_1_OPMLAtxHeading(char *yytext, int yyleng)
+{
+#define s yyval[-1]
+  yyprintf((stderr, "do yy_1_OPMLAtxHeading\n"));
+  
+        yy = mk_str(yytext);
+        yy->key = s->key;
+        g_free(s);
+    ;
+#undef s
+}
+YY_ACTION(void) yy_3_OPMLHeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_OPMLHeadingSection\n"));
+   yy = mk_list(HEADINGSECTION, a);;
+#undef a
+}
+YY_ACTION(void) yy_2_OPMLHeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_OPMLHeadingSection\n"));
+  a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OPMLHeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_OPMLHeadingSection\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_DocForOPML(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_DocForOPML\n"));
+   parse_result = close_list(a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_DocForOPML(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_DocForOPML\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_DocForOPML(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_DocForOPML\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_MathSpan(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_MathSpan\n"));
+  
+    /* Basically, these delimiters indicate math in LaTeX syntax, and the
+       delimiters are compatible with MathJax and LaTeX
+       ASCIIMathML is *not* supported */
+    yy = mk_str(yytext);
+    yy->key = MATHSPAN;
+;
+}
+YY_ACTION(void) yy_1_AutoLabel(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AutoLabel\n"));
+   
+    char *label = label_from_string(yytext,0);
+    yy = mk_str(label);
+    yy->key = AUTOLABEL;
+    g_free(label);
+;
+}
+YY_ACTION(void) yy_2_TableCaption(char *yytext, int yyleng)
+{
+#define c yyval[-1]
+#define a yyval[-2]
+#define b yyval[-3]
+  yyprintf((stderr, "do yy_2_TableCaption\n"));
+  
+    yy = a;
+    yy->key = TABLECAPTION;
+    if ( (b != NULL) && (b->key == TABLELABEL) ) {
+        b->next = yy->children;
+        yy->children = b;
+    }
+;
+#undef c
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_TableCaption(char *yytext, int yyleng)
+{
+#define c yyval[-1]
+#define a yyval[-2]
+#define b yyval[-3]
+  yyprintf((stderr, "do yy_1_TableCaption\n"));
+   b = c; b->key = TABLELABEL;;
+#undef c
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_RightAlign(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RightAlign\n"));
+   yy = mk_token('r');;
+}
+YY_ACTION(void) yy_1_RightAlignWrap(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RightAlignWrap\n"));
+   yy = mk_token('R');;
+}
+YY_ACTION(void) yy_1_CenterAlign(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_CenterAlign\n"));
+   yy = mk_token('c');;
+}
+YY_ACTION(void) yy_1_CenterAlignWrap(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_CenterAlignWrap\n"));
+   yy = mk_token('C');;
+}
+YY_ACTION(void) yy_1_LeftAlign(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_LeftAlign\n"));
+   yy = mk_token('l');;
+}
+YY_ACTION(void) yy_1_LeftAlignWrap(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_LeftAlignWrap\n"));
+   yy = mk_token('L');;
+}
+YY_ACTION(void) yy_2_SeparatorLine(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_SeparatorLine\n"));
+  
+        yy = mk_str_from_list(a,false);
+        yy->key = TABLESEPARATOR;
+    ;
+#undef a
+}
+YY_ACTION(void) yy_1_SeparatorLine(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_SeparatorLine\n"));
+   a = add_last(yy, a);;
+#undef a
+}
+YY_ACTION(void) yy_1_EmptyCell(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_EmptyCell\n"));
+   yy = mk_element(TABLECELL);;
+}
+YY_ACTION(void) yy_2_FullCell(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_FullCell\n"));
+   yy = mk_list(TABLECELL,a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_FullCell(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_FullCell\n"));
+   a = add_last(yy, a);
+#undef a
+}
+YY_ACTION(void) yy_1_CellStr(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_CellStr\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_ExtendedCell(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_ExtendedCell\n"));
+  
+        element *span;
+        span = mk_str(yytext);
+        span->key = CELLSPAN;
+        span->next = yy->children;
+        yy->children = span;
+    ;
+}
+YY_ACTION(void) yy_2_TableRow(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_TableRow\n"));
+   yy = mk_list(TABLEROW, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_TableRow(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_TableRow\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_TableBody(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_TableBody\n"));
+   yy = mk_list(TABLEBODY, a);;
+#undef a
+}
+YY_ACTION(void) yy_1_TableBody(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_TableBody\n"));
+  a = add_last(yy, a);;
+#undef a
+}
+YY_ACTION(void) yy_7_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_7_Table\n"));
+  
+        if (b != NULL) { a = add_first(b, a); };
+        yy = mk_list(TABLE, a);
+    ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_6_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_6_Table\n"));
+   b = add_last(yy, b);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_5_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_5_Table\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_4_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_4_Table\n"));
+   a = add_last(yy, a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_Table\n"));
+   a = add_first(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_Table\n"));
+   yy->key = TABLEHEAD; a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Table(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_Table\n"));
+   b = add_last(yy, b);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_7_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_7_Definition\n"));
+   if (b != NULL) { a = add_last(b, a);}
+                element *raw = mk_str_from_list(a, false);
+                raw->key = RAW;
+                yy = mk_list(DEFINITION, add_last(raw, NULL));
+            ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_6_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_6_Definition\n"));
+   a = add_last(mk_token('\n'), a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_5_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_5_Definition\n"));
+   a = add_last(mk_str(yytext), a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_4_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_4_Definition\n"));
+  a = add_last(mk_token('\n'), a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_Definition\n"));
+   a = add_last(mk_str(yytext), a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_Definition\n"));
+   a = add_last(mk_str(yytext), a);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Definition(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_Definition\n"));
+   b = add_last(mk_token('\n'), b); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Term(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Term\n"));
+  
+            yy = mk_list(TERM,a);
+        ;
+#undef a
+}
+YY_ACTION(void) yy_1_Term(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Term\n"));
+  a = add_last(yy, a);;
+#undef a
+}
+YY_ACTION(void) yy_3_DefinitionList(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_DefinitionList\n"));
+   yy = mk_list(LIST, a);
+                    yy->key = DEFLIST;
+                ;
+#undef a
+}
+YY_ACTION(void) yy_2_DefinitionList(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_DefinitionList\n"));
+   a = add_last(yy, a);;
+#undef a
+}
+YY_ACTION(void) yy_1_DefinitionList(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_DefinitionList\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_7_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_7_AutoLabels\n"));
+   labels = close_list(a); ;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_6_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_6_AutoLabels\n"));
+  
+                GString *label = g_string_new("");
+                char *lab;
+                if (c->children->key == TABLELABEL) {
+                    print_raw_element_list(label, c->children->children);
+                } else {
+                    print_raw_element_list(label, c->children);
+                }
+                lab = label_from_string(label->str,0);
+                a = add_last(mk_str(lab), a);
+                g_free(lab);
+                g_string_free(label,true);
+                free_element_list(c);;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_5_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_5_AutoLabels\n"));
+   free_element_list(d); ;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_4_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_4_AutoLabels\n"));
+   free_element_list(d); ;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_3_AutoLabels\n"));
+   free_element_list(d); ;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_2_AutoLabels\n"));
+  
+                GString *label = g_string_new("");
+                char *lab;
+                if (c->children->key == TABLELABEL) {
+                    print_raw_element_list(label, c->children->children);
+                } else {
+                    print_raw_element_list(label, c->children);
+                }
+                lab = label_from_string(label->str,0);
+                a = add_last(mk_str(lab), a);
+                g_free(lab);
+                g_string_free(label,true);
+                free_element_list(c);;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_AutoLabels(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define b yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_1_AutoLabels\n"));
+   
+                GString *label = g_string_new("");
+                char *lab;
+                print_raw_element_list(label, b->children);
+                if (b->children->key == AUTOLABEL) {
+                    lab = label_from_string(b->children->contents.str,0);
+                } else {
+                    lab = label_from_string(label->str,0);
+                }
+                a = add_last(mk_str(lab), a);
+                g_free(lab);
+                g_string_free(label,true);
+                /* footnotes in the heading borrow their text from the notes */
+                detach_shared_notes(b);
+                free_element_list(b);
+            ;
+#undef d
+#undef c
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_RawCitationReference(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RawCitationReference\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_CitationReferenceSingle(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+  yyprintf((stderr, "do yy_1_CitationReferenceSingle\n"));
+     element *match;
+                    if (find_note(&match, ref->contents.str) ||
+                        (match = bibliography_note(ref->contents.str)) != NULL) {
+                        yy = mk_element(CITATION);
+                        assert(match->children != NULL);
+                        yy->children = match->children;
+                        yy->contents.str = g_strdup(ref->contents.str);
+                    } else {
+                        char *s;
+                        s = g_malloc(strlen(ref->contents.str) + 4);
+                        sprintf(s, "[#%s]", ref->contents.str);
+                        yy = mk_str(s);
+                        yy->key = CITATION;
+                        g_free(s);
+                    }
+                    free_element(ref);
+                ;
+#undef ref
+}
+YY_ACTION(void) yy_1_CitationReferenceDouble(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define b yyval[-2]
+  yyprintf((stderr, "do yy_1_CitationReferenceDouble\n"));
+     element *match;
+                    if (find_note(&match, ref->contents.str) ||
+                        (match = bibliography_note(ref->contents.str)) != NULL) {
+                        /* This citation is specified within the document,
+                           or in the shared bibliography */
+                        yy = mk_element(CITATION);
+                        assert(match->children != NULL);
+                        b->next = match->children;
+                        b->key = LOCATOR;
+                        yy->children = b;
+                        yy->contents.str = g_strdup(ref->contents.str);
+                    } else {
+                        /* Citation not specified - likely bibtex citation */
+                        /* TODO: fix this - need to print label as well */
+                        char *s;
+                        s = g_malloc(strlen(ref->contents.str) + 4);
+                        sprintf(s, "[#%s]", ref->contents.str);
+                        yy = mk_str(s);
+                        yy->key = CITATION;
+                        b->key = LOCATOR;
+                        yy->children = b;
+                        g_free(s);
+                    }
+                    GString *label = g_string_new("");
+                    char *lab;
+                    print_raw_element_list(label, b->children);
+                    lab = label_from_string(label->str,0);
+                    if (strcmp(lab,"notcited") == 0 ) {
+                        yy->key = NOCITATION;
+                    }
+                    g_string_free(label, true);
+                    g_free(lab);
+                    free_element(ref);
+                ;
+#undef ref
+#undef b
+}
+YY_ACTION(void) yy_3_RawNoteBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_RawNoteBlock\n"));
+     yy = mk_str_from_list(a, true);
+                    yy->key = RAW;
+                ;
+#undef a
+}
+YY_ACTION(void) yy_2_RawNoteBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_RawNoteBlock\n"));
+   a = add_last(mk_str(yytext), a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_RawNoteBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_RawNoteBlock\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_Notes(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_Notes\n"));
+   notes = close_list(a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Notes(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_Notes\n"));
+   a = add_last(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_InlineNote(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_InlineNote\n"));
+   yy = mk_list(NOTE, a);
+                  yy->contents.str = 0; ;
+#undef a
+}
+YY_ACTION(void) yy_1_InlineNote(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_InlineNote\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_Note(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+#define ref yyval[-2]
+  yyprintf((stderr, "do yy_3_Note\n"));
+     element *label;
+                    label = mk_str(ref->contents.str);
+                    label->key = NOTELABEL;
+                    a = add_last(label, a);
+                    yy = mk_list(NOTE, a);
+                    yy->contents.str = g_strdup(ref->contents.str);
+                    free_element(ref);
+                ;
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_2_Note(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+#define ref yyval[-2]
+  yyprintf((stderr, "do yy_2_Note\n"));
+   a = add_last(yy, a); ;
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_1_Note(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+#define ref yyval[-2]
+  yyprintf((stderr, "do yy_1_Note\n"));
+   a = add_last(yy, a); ;
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_1_GlossarySortKey(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_GlossarySortKey\n"));
+   yy = mk_str(yytext);
+        yy->key = GLOSSARYSORTKEY; ;
+}
+YY_ACTION(void) yy_1_GlossaryTerm(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_GlossaryTerm\n"));
+   
+        yy = mk_list(LIST, NULL);
+        yy->contents.str = 0;
+        yy->children = mk_str(yytext);
+        yy->key = GLOSSARYTERM;
+    ;
+}
+YY_ACTION(void) yy_5_Glossary(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_5_Glossary\n"));
+   yy = mk_list(GLOSSARY, a);
+                yy->contents.str = g_strdup(ref->contents.str);
+                free_element(ref);
+            ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_4_Glossary(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_4_Glossary\n"));
+   a = add_last(yy, a); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_3_Glossary(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_Glossary\n"));
+   a = add_last(yy, a); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_2_Glossary(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_Glossary\n"));
+   a = add_last(yy, a); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_1_Glossary(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_Glossary\n"));
+   a = add_last(yy, a); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_1_RawNoteReference(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RawNoteReference\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_NoteReference(char *yytext, int yyleng)
+{
+#define ref yyval[-1]
+  yyprintf((stderr, "do yy_1_NoteReference\n"));
+     element *match;
+                    if (find_note(&match, ref->contents.str)) {
+                        yy = mk_element(NOTE);
+                        assert(match->children != NULL);
+                        yy->children = match->children;
+                        yy->contents.str = 0;
+                    } else {
+                        char *s;
+                        s = g_malloc(strlen(ref->contents.str) + 4);
+                        sprintf(s, "[^%s]", ref->contents.str);
+                        yy = mk_str(s);
+                        g_free(s);
+                    }
+                    free_element(ref);
+                ;
+#undef ref
+}
+YY_ACTION(void) yy_2_DoubleQuoted(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_DoubleQuoted\n"));
+   yy = mk_list(DOUBLEQUOTED, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_DoubleQuoted(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_DoubleQuoted\n"));
+   a = add_last(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_SingleQuoted(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_SingleQuoted\n"));
+   yy = mk_list(SINGLEQUOTED, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_SingleQuoted(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_SingleQuoted\n"));
+   a = add_last(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_EmDash(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_EmDash\n"));
+   yy = mk_element(EMDASH);
+            yy->contents.str  = g_strdup(yytext);
+         ;
+}
+YY_ACTION(void) yy_1_EnDash(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_EnDash\n"));
+   yy = mk_element(ENDASH); 
+            yy->contents.str  = g_strdup(yytext);
+         ;
+}
+YY_ACTION(void) yy_1_Ellipsis(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Ellipsis\n"));
+   yy = mk_element(ELLIPSIS); ;
+}
+YY_ACTION(void) yy_1_Apostrophe(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Apostrophe\n"));
+   yy = mk_element(APOSTROPHE); ;
+}
+YY_ACTION(void) yy_1_SkipBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_SkipBlock\n"));
+   free_element_list(a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Line(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Line\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_StartList(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_StartList\n"));
+   yy = NULL; ;
+}
+YY_ACTION(void) yy_1_RawHtml(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RawHtml\n"));
+     if (extension(EXT_FILTER_HTML)) {
+                    yy = mk_list(LIST, NULL);
+                } else {
+                    yy = mk_str(yytext);
+                    yy->key = HTML;
+                }
+            ;
+}
+YY_ACTION(void) yy_1_Code(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Code\n"));
+   yy = mk_str(yytext); yy->key = CODE; ;
+}
+YY_ACTION(void) yy_2_References(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_References\n"));
+   references = close_list(a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_References(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_References\n"));
+   a = add_last(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_RefTitle(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RefTitle\n"));
+   yy = mk_str(yytext); 
+                yy->key = RAW;;
+}
+YY_ACTION(void) yy_1_RefSrc(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_RefSrc\n"));
+   yy = mk_str(yytext); 
+           yy->key = HTML; ;
+}
+YY_ACTION(void) yy_2_Label(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Label\n"));
+   yy = mk_list(LIST, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Label(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Label\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_AttrValue(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AttrValue\n"));
+   yy = mk_str(yytext);
+            yy->key = ATTRVALUE;
+        ;
+}
+YY_ACTION(void) yy_1_AttrKey(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AttrKey\n"));
+  
+            char *lab;
+            lab = label_from_string(yytext,0);
+            yy = mk_str(lab);
+            yy->key = ATTRKEY;
+            g_free(lab);
+        ;
+}
+YY_ACTION(void) yy_1_Attribute(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_Attribute\n"));
+   
+        yy = a;
+        yy->children = b;
+    ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Attributes(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Attributes\n"));
+   yy = mk_list(LIST,a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Attributes(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Attributes\n"));
+   a =add_last(yy, a);;
+#undef a
+}
+YY_ACTION(void) yy_2_Reference(char *yytext, int yyleng)
+{
+#define t yyval[-1]
+#define s yyval[-2]
+#define l yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_2_Reference\n"));
+   
+            char *label;
+            GString *text = g_string_new("");
+            print_raw_element_list(text, l->children);
+            label = label_from_string(text->str,0);
+            if (a == NULL) {
+                yy = mk_link(l->children, s->contents.str,
+                    t->contents.str, a, label);
+            } else {
+                yy = mk_link(l->children, s->contents.str,
+                    t->contents.str, a->children, label);
+            }
+            free_element(s);
+            free_element(t);
+            g_free(l);
+            g_free(a);
+            g_free(label);
+            g_string_free(text, TRUE);
+            yy->key = REFERENCE;
+        ;
+#undef t
+#undef s
+#undef l
+#undef a
+}
+YY_ACTION(void) yy_1_Reference(char *yytext, int yyleng)
+{
+#define t yyval[-1]
+#define s yyval[-2]
+#define l yyval[-3]
+#define a yyval[-4]
+  yyprintf((stderr, "do yy_1_Reference\n"));
+   a = yy; ;
+#undef t
+#undef s
+#undef l
+#undef a
+}
+YY_ACTION(void) yy_1_AutoLinkEmail(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AutoLinkEmail\n"));
+     char *mailto = g_malloc(strlen(yytext) + 8);
+                    sprintf(mailto, "mailto:%s", yytext);
+                    yy = mk_link(mk_str(yytext), mailto, "", NULL, "");
+                    g_free(mailto);
+                ;
+}
+YY_ACTION(void) yy_1_AutoLinkUrl(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AutoLinkUrl\n"));
+     yy = mk_link(mk_str(yytext), yytext, "", NULL, ""); ;
+}
+YY_ACTION(void) yy_1_Title(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Title\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_Source(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Source\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_ExplicitLink(char *yytext, int yyleng)
+{
+#define t yyval[-1]
+#define s yyval[-2]
+#define l yyval[-3]
+  yyprintf((stderr, "do yy_1_ExplicitLink\n"));
+  
+                    yy = mk_link(l->children, s->contents.str, t->contents.str, NULL, "");
+                    free_element(s);
+                    free_element(t);
+                    g_free(l);
+                ;
+#undef t
+#undef s
+#undef l
+}
+YY_ACTION(void) yy_1_ReferenceLinkSingle(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ReferenceLinkSingle\n"));
+     link match;
+                           if (find_reference(&match, a->children)) {
+                               yy = mk_link(a->children, match.url, match.title, match.attr, match.identifier);
+                               g_free(a);
+                           } else if ( !extension(EXT_COMPATIBILITY) && 
+                            find_label(&match, a->children)) {
+                                GString *text = g_string_new("");
+                                print_raw_element_list(text, a->children);
+                                char *lab = label_from_string(text->str,0);
+                                GString *label = g_string_new(lab);
+                                g_string_prepend(label,"#");
+                                yy = mk_link(a->children, label->str, "", NULL, lab);
+                                g_string_free(text, TRUE);
+                                g_string_free(label, TRUE);
+                                g_free(lab);
+                                g_free(a);
+                           } else {
+                               element *result;
+                               result = mk_element(LIST);
+                               result->children = cons(mk_token('['), cons(a, cons(mk_token(']'), mk_str(yytext))));
+                               yy = result;
+                           }
+                       ;
+#undef a
+}
+YY_ACTION(void) yy_1_ReferenceLinkDouble(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_ReferenceLinkDouble\n"));
+     link match;
+                           if (find_reference(&match, b->children)) {
+                               yy = mk_link(a->children, match.url, match.title, match.attr, match.identifier);
+                               g_free(a);
+                               free_element_list(b);
+                           } else if ( !extension(EXT_COMPATIBILITY) && 
+                            find_label(&match, b->children)) {
+                                GString *text = g_string_new("");
+                                print_raw_element_list(text, b->children);
+                                char *lab = label_from_string(text->str,0);
+                                GString *label = g_string_new(lab);
+                                g_string_prepend(label,"#");
+                                yy = mk_link(a->children, label->str, "", NULL, lab);
+                                g_free(lab);
+                                g_string_free(text, TRUE);
+                                g_string_free(label, TRUE);
+                                g_free(a);
+                                free_element_list(b);
+                            } else {
+                               element *result;
+                               result = mk_element(LIST);
+                               result->children = cons(mk_token('['), cons(a, cons(mk_token(']'), cons(mk_token('['), cons(b, mk_token(']'))))));
+                               yy = result;
+                           }
+                       ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Image(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Image\n"));
+   if (yy->key == LINK) {
+              yy->key = IMAGE;
+          } else {
+              element *result;
+              result = yy;
+              yy->children = cons(mk_token('!'), result->children);
+          } ;
+}
+YY_ACTION(void) yy_1_ImageBlock(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_ImageBlock\n"));
+   if (yy->key == IMAGE) yy->key = IMAGEBLOCK; ;
+}
+YY_ACTION(void) yy_3_StrongUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_StrongUl\n"));
+   yy = mk_list(STRONG, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_StrongUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_StrongUl\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_StrongUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_StrongUl\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_TwoUlClose(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_TwoUlClose\n"));
+   yy = a; ;
+#undef a
+}
+YY_ACTION(void) yy_3_StrongStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_StrongStar\n"));
+   yy = mk_list(STRONG, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_StrongStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_StrongStar\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_StrongStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_StrongStar\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_TwoStarClose(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_TwoStarClose\n"));
+   yy = a; ;
+#undef a
+}
+YY_ACTION(void) yy_3_EmphUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_EmphUl\n"));
+   yy = mk_list(EMPH, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_EmphUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_EmphUl\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_EmphUl(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_EmphUl\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OneUlClose(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_OneUlClose\n"));
+   yy = a; ;
+#undef a
+}
+YY_ACTION(void) yy_3_EmphStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_EmphStar\n"));
+   yy = mk_list(EMPH, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_EmphStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_EmphStar\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_EmphStar(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_EmphStar\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OneStarClose(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_OneStarClose\n"));
+   yy = a; ;
+#undef a
+}
+YY_ACTION(void) yy_1_UlOrStarLine(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_UlOrStarLine\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_Symbol(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Symbol\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_LineBreak(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_LineBreak\n"));
+   free_element_list(a);
+              yy = mk_element(LINEBREAK); ;
+#undef a
+}
+YY_ACTION(void) yy_1_TerminalEndline(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_TerminalEndline\n"));
+   yy = NULL; ;
+}
+YY_ACTION(void) yy_1_NormalEndline(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_NormalEndline\n"));
+   yy = mk_token('\n');
+                    yy->key = SPACE; ;
+}
+YY_ACTION(void) yy_1_Entity(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Entity\n"));
+   yy = mk_str(yytext); yy->key = HTML; ;
+}
+YY_ACTION(void) yy_1_EscapedChar(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_EscapedChar\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_1_AposChunk(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AposChunk\n"));
+   yy = mk_element(APOSTROPHE); ;
+}
+YY_ACTION(void) yy_1_StrChunk(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_StrChunk\n"));
+   yy = mk_str(yytext); ;
+}
+YY_ACTION(void) yy_3_Str(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_Str\n"));
+   if (a->next == a) { yy = close_list(a); } else { yy = mk_list(LIST, a); } ;
+#undef a
+}
+YY_ACTION(void) yy_2_Str(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Str\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Str(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Str\n"));
+   a = add_last(mk_str(yytext), a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Space(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_Space\n"));
+   yy = mk_token(' ');
+          yy->key = SPACE; ;
+}
+YY_ACTION(void) yy_4_Inlines(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define a yyval[-3]
+  yyprintf((stderr, "do yy_4_Inlines\n"));
+   yy = mk_list(LIST, a); ;
+#undef d
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_3_Inlines(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define a yyval[-3]
+  yyprintf((stderr, "do yy_3_Inlines\n"));
+   free_element_list(d); ;
+#undef d
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_2_Inlines(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define a yyval[-3]
+  yyprintf((stderr, "do yy_2_Inlines\n"));
+   a = add_last(c, a); ;
+#undef d
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_1_Inlines(char *yytext, int yyleng)
+{
+#define d yyval[-1]
+#define c yyval[-2]
+#define a yyval[-3]
+  yyprintf((stderr, "do yy_1_Inlines\n"));
+   a = add_last(yy, a); ;
+#undef d
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_1_StyleBlock(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_StyleBlock\n"));
+     if (extension(EXT_FILTER_STYLES)) {
+                        yy = mk_list(LIST, NULL);
+                    } else {
+                        yy = mk_str(yytext);
+                        yy->key = HTMLBLOCK;
+                    }
+                ;
+}
+YY_ACTION(void) yy_1_HtmlBlock(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_HtmlBlock\n"));
+     if (extension(EXT_FILTER_HTML)) {
+                    yy = mk_list(LIST, NULL);
+                } else {
+                    yy = mk_str(yytext);
+                    if ( extension(EXT_PROCESS_HTML)) yy->key = RAW;
+                        else yy->key = HTMLBLOCK;
+                }
+            ;
+}
+YY_ACTION(void) yy_1_OrderedList(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_OrderedList\n"));
+   yy->key = ORDEREDLIST; ;
+}
+YY_ACTION(void) yy_3_ListContinuationBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_ListContinuationBlock\n"));
+    yy = mk_str_from_list(a, false); ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListContinuationBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_ListContinuationBlock\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListContinuationBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ListContinuationBlock\n"));
+     if (strlen(yytext) == 0)
+                                   a = add_last(mk_token('\001'), a); /* block separator */
+                              else
+                                   a = add_last(mk_str(yytext), a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_ListBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_ListBlock\n"));
+   yy = mk_str_from_list(a, false); ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_ListBlock\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListBlock(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ListBlock\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_ListItemTight(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_ListItemTight\n"));
+    element *raw;
+               raw = mk_str_from_list(a, false);
+               raw->key = RAW;
+               yy = mk_element(LISTITEM);
+               yy->children = raw;
+            ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListItemTight(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_ListItemTight\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListItemTight(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ListItemTight\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_ListItem(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_ListItem\n"));
+    element *raw;
+               raw = mk_str_from_list(a, false);
+               raw->key = RAW;
+               yy = mk_element(LISTITEM);
+               yy->children = raw;
+            ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListItem(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_ListItem\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListItem(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ListItem\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListLoose(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_ListLoose\n"));
+   yy = mk_list(LIST, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_ListLoose(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_ListLoose\n"));
+     element *li;
+                  li = b->children;
+                  li->contents.str = g_realloc(li->contents.str, strlen(li->contents.str) + 3);
+                  strcat(li->contents.str, "\n\n");  /* In loose list, \n\n added to end of each element */
+                  a = add_last(b, a);
+              ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_ListTight(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_ListTight\n"));
+   yy = mk_list(LIST, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListTight(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_ListTight\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_BulletList(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_BulletList\n"));
+   yy->key = BULLETLIST; ;
+}
+YY_ACTION(void) yy_1_HorizontalRule(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_HorizontalRule\n"));
+   yy = mk_element(HRULE); ;
+}
+YY_ACTION(void) yy_2_Verbatim(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Verbatim\n"));
+   yy = mk_str_from_list(a, false);
+                 yy->key = VERBATIM; ;
+#undef a
+}
+YY_ACTION(void) yy_1_Verbatim(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Verbatim\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_VerbatimChunk(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_VerbatimChunk\n"));
+   yy = mk_str_from_list(a, false); ;
+#undef a
+}
+YY_ACTION(void) yy_2_VerbatimChunk(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_VerbatimChunk\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_VerbatimChunk(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_VerbatimChunk\n"));
+   a = add_last(mk_token('\n'), a); ;
+#undef a
+}
+YY_ACTION(void) yy_4_BlockQuoteRaw(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_4_BlockQuoteRaw\n"));
+     yy = mk_str_from_list(a, true);
+                     yy->key = RAW;
+                 ;
+#undef a
+}
+YY_ACTION(void) yy_3_BlockQuoteRaw(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_BlockQuoteRaw\n"));
+   a = add_last(mk_token('\n'), a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_BlockQuoteRaw(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_BlockQuoteRaw\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_BlockQuoteRaw(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_BlockQuoteRaw\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_BlockQuote(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_BlockQuote\n"));
+    yy = mk_element(BLOCKQUOTE);
+                yy->children = a;
+             ;
+#undef a
+}
+YY_ACTION(void) yy_3_HeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_HeadingSection\n"));
+   yy = mk_list(HEADINGSECTION, a);;
+#undef a
+}
+YY_ACTION(void) yy_2_HeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_HeadingSection\n"));
+  a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_HeadingSection(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_HeadingSection\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_SetextHeading2(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_SetextHeading2\n"));
+   yy = mk_list(H2, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_SetextHeading2(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_SetextHeading2\n"));
+   a = add_first(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_SetextHeading2(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_SetextHeading2\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_SetextHeading1(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_SetextHeading1\n"));
+   yy = mk_list(H1, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_SetextHeading1(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_SetextHeading1\n"));
+   a = add_first(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_SetextHeading1(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_SetextHeading1\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_AtxHeading(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+#define s yyval[-3]
+  yyprintf((stderr, "do yy_3_AtxHeading\n"));
+   yy = mk_list(s->key,a);
+            g_free(s); ;
+#undef b
+#undef a
+#undef s
+}
+YY_ACTION(void) yy_2_AtxHeading(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+#define s yyval[-3]
+  yyprintf((stderr, "do yy_2_AtxHeading\n"));
+   a = add_first(b, a); ;
+#undef b
+#undef a
+#undef s
+}
+YY_ACTION(void) yy_1_AtxHeading(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+#define s yyval[-3]
+  yyprintf((stderr, "do yy_1_AtxHeading\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+#undef s
+}
+YY_ACTION(void) yy_1_AtxStart(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_AtxStart\n"));
+   yy = mk_element(H1 + (strlen(yytext) - 1)); ;
+}
+YY_ACTION(void) yy_1_Plain(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Plain\n"));
+   yy = a; yy->key = PLAIN; ;
+#undef a
+}
+YY_ACTION(void) yy_1_Para(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Para\n"));
+   yy = a; yy->key = PARA; ;
+#undef a
+}
+YY_ACTION(void) yy_4_MetaDataValue(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_4_MetaDataValue\n"));
+   yy = mk_str_from_list(a,false);
+                    trim_trailing_whitespace(yy->contents.str);
+                    yy->key = METAVALUE;
+                ;
+#undef a
+}
+YY_ACTION(void) yy_3_MetaDataValue(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_3_MetaDataValue\n"));
+   a = add_last(mk_str(yytext), a);;
+#undef a
+}
+YY_ACTION(void) yy_2_MetaDataValue(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_MetaDataValue\n"));
+   a = add_last(mk_token('\n'), a);;
+#undef a
+}
+YY_ACTION(void) yy_1_MetaDataValue(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_MetaDataValue\n"));
+   a = add_last(mk_str(yytext), a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_MetaDataKey(char *yytext, int yyleng)
+{
+  yyprintf((stderr, "do yy_1_MetaDataKey\n"));
+  
+    char *label = label_from_string(yytext,0);
+    yy = mk_str(label);
+    g_free(label);
+    yy->key = METAKEY;
+;
+}
+YY_ACTION(void) yy_1_MetaDataKeyValue(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_MetaDataKeyValue\n"));
+   yy = a;
+                yy->children = b;
+            ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_MetaDataOnly(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_MetaDataOnly\n"));
+   parse_result = mk_list(LIST,a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_MetaDataOnly(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_MetaDataOnly\n"));
+   a = add_last(b, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_MetaData(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_MetaData\n"));
+   yy = mk_list(LIST, a);
+                yy->key = METADATA;
+            ;
+#undef a
+}
+YY_ACTION(void) yy_1_MetaData(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_MetaData\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+YY_ACTION(void) yy_3_DocWithMetaData(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_3_DocWithMetaData\n"));
+   if (b != NULL) a = add_last(b, a);
+        parse_result = close_list(a);
+    ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_DocWithMetaData(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_2_DocWithMetaData\n"));
+   a = add_last(yy, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_DocWithMetaData(char *yytext, int yyleng)
+{
+#define b yyval[-1]
+#define a yyval[-2]
+  yyprintf((stderr, "do yy_1_DocWithMetaData\n"));
+   a = add_last(yy, a); b = mk_element(FOOTER);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Doc(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_2_Doc\n"));
+   parse_result = close_list(a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Doc(char *yytext, int yyleng)
+{
+#define a yyval[-1]
+  yyprintf((stderr, "do yy_1_Doc\n"));
+   a = add_last(yy, a); ;
+#undef a
+}
+
+typedef unsigned short yyword;
+
+enum { yyop_ENTER, yyop_RETURN, yyop_FAIL, yyop_CALL, yyop_JUMP, yyop_SAVE, yyop_RESTORE, yyop_DOT, yyop_CHAR, yyop_STRING, yyop_CLASS, yyop_TEST, yyop_SPAN, yyop_SCAN, yyop_ACTION, yyop_PREDICATE, yyop_BEGIN, yyop_END, yyop_PUSH, yyop_POP, yyop_SET };
+
+#ifdef YY_DEBUG
+static const char *yyrulenames[]= {
+  0,
+  "Doc",
+  "BOM",
+  "StartList",
+  "Block",
+  "DocWithMetaData",
+  "MetaDataKey",
+  "Sp",
+  "Newline",
+  "MetaData",
+  "MetaDataKeyValue",
+  "MetaDataOnly",
+  "SkipBlock",
+  "MetaDataValue",
+  "AlphanumericAscii",
+  "SingleLineMetaKeyValue",
+  "BlankLine",
+  "RawLine",
+  "BlockQuote",
+  "Verbatim",
+  "DefinitionList",
+  "Glossary",
+  "Note",
+  "Reference",
+  "HorizontalRule",
+  "HeadingSection",
+  "OrderedList",
+  "BulletList",
+  "HtmlBlock",
+  "StyleBlock",
+  "Table",
+  "ImageBlock",
+  "HtmlBlockOpenDiv",
+  "Para",
+  "Plain",
+  "HeadingSectionBlock",
+  "Heading",
+  "NonindentSpace",
+  "Inlines",
+  "AtxInline",
+  "AutoLabel",
+  "Inline",
+  "AtxStart",
+  "AtxHeading",
+  "SetextHeading",
+  "SetextHeading1",
+  "SetextHeading2",
+  "SetextBottom1",
+  "SetextBottom2",
+  "Endline",
+  "BlockQuoteRaw",
+  "Line",
+  "NonblankIndentedLine",
+  "IndentedLine",
+  "VerbatimChunk",
+  "Bullet",
+  "Spacechar",
+  "ListTight",
+  "ListLoose",
+  "ListItemTight",
+  "Enumerator",
+  "ListItem",
+  "ListBlock",
+  "ListContinuationBlock",
+  "ListBlockLine",
+  "Indent",
+  "OptionallyIndentedLine",
+  "HtmlBlockOpenAddress",
+  "Spnl",
+  "HtmlAttribute",
+  "HtmlBlockCloseAddress",
+  "HtmlBlockAddress",
+  "HtmlBlockOpenArticle",
+  "HtmlBlockCloseArticle",
+  "HtmlBlockArticle",
+  "HtmlBlockOpenAside",
+  "HtmlBlockCloseAside",
+  "HtmlBlockAside",
+  "HtmlBlockOpenBlockquote",
+  "HtmlBlockCloseBlockquote",
+  "HtmlBlockBlockquote",
+  "HtmlBlockOpenCanvas",
+  "HtmlBlockCloseCanvas",
+  "HtmlBlockCanvas",
+  "HtmlBlockOpenCenter",
+  "HtmlBlockCloseCenter",
+  "HtmlBlockCenter",
+  "HtmlBlockOpenDir",
+  "HtmlBlockCloseDir",
+  "HtmlBlockDir",
+  "HtmlBlockCloseDiv",
+  "HtmlBlockDiv",
+  "HtmlBlockOpenDl",
+  "HtmlBlockCloseDl",
+  "HtmlBlockDl",
+  "HtmlBlockOpenFieldset",
+  "HtmlBlockCloseFieldset",
+  "HtmlBlockFieldset",
+  "HtmlBlockOpenFigure",
+  "HtmlBlockCloseFigure",
+  "HtmlBlockFigure",
+  "HtmlBlockOpenFooter",
+  "HtmlBlockCloseFooter",
+  "HtmlBlockFooter",
+  "HtmlBlockOpenForm",
+  "HtmlBlockCloseForm",
+  "HtmlBlockForm",
+  "HtmlBlockOpenHeader",
+  "HtmlBlockCloseHeader",
+  "HtmlBlockHeader",
+  "HtmlBlockOpenHgroup",
+  "HtmlBlockCloseHgroup",
+  "HtmlBlockHgroup",
+  "HtmlBlockOpenH1",
+  "HtmlBlockCloseH1",
+  "HtmlBlockH1",
+  "HtmlBlockOpenH2",
+  "HtmlBlockCloseH2",
+  "HtmlBlockH2",
+  "HtmlBlockOpenH3",
+  "HtmlBlockCloseH3",
+  "HtmlBlockH3",
+  "HtmlBlockOpenH4",
+  "HtmlBlockCloseH4",
+  "HtmlBlockH4",
+  "HtmlBlockOpenH5",
+  "HtmlBlockCloseH5",
+  "HtmlBlockH5",
+  "HtmlBlockOpenH6",
+  "HtmlBlockCloseH6",
+  "HtmlBlockH6",
+  "HtmlBlockOpenMenu",
+  "HtmlBlockCloseMenu",
+  "HtmlBlockMenu",
+  "HtmlBlockOpenNoframes",
+  "HtmlBlockCloseNoframes",
+  "HtmlBlockNoframes",
+  "HtmlBlockOpenNoscript",
+  "HtmlBlockCloseNoscript",
+  "HtmlBlockNoscript",
+  "HtmlBlockOpenOl",
+  "HtmlBlockCloseOl",
+  "HtmlBlockOl",
+  "HtmlBlockOpenP",
+  "HtmlBlockCloseP",
+  "HtmlBlockP",
+  "HtmlBlockOpenPre",
+  "HtmlBlockClosePre",
+  "HtmlBlockPre",
+  "HtmlBlockOpenProgress",
+  "HtmlBlockCloseProgress",
+  "HtmlBlockProgress",
+  "HtmlBlockOpenSection",
+  "HtmlBlockCloseSection",
+  "HtmlBlockSection",
+  "HtmlBlockOpenTable",
+  "HtmlBlockCloseTable",
+  "HtmlBlockTable",
+  "HtmlBlockOpenUl",
+  "HtmlBlockCloseUl",
+  "HtmlBlockUl",
+  "HtmlBlockOpenVideo",
+  "HtmlBlockCloseVideo",
+  "HtmlBlockVideo",
+  "HtmlBlockOpenDd",
+  "HtmlBlockCloseDd",
+  "HtmlBlockDd",
+  "HtmlBlockOpenDt",
+  "HtmlBlockCloseDt",
+  "HtmlBlockDt",
+  "HtmlBlockOpenFrameset",
+  "HtmlBlockCloseFrameset",
+  "HtmlBlockFrameset",
+  "HtmlBlockOpenLi",
+  "HtmlBlockCloseLi",
+  "HtmlBlockLi",
+  "HtmlBlockOpenTbody",
+  "HtmlBlockCloseTbody",
+  "HtmlBlockTbody",
+  "HtmlBlockOpenTd",
+  "HtmlBlockCloseTd",
+  "HtmlBlockTd",
+  "HtmlBlockOpenTfoot",
+  "HtmlBlockCloseTfoot",
+  "HtmlBlockTfoot",
+  "HtmlBlockOpenTh",
+  "HtmlBlockCloseTh",
+  "HtmlBlockTh",
+  "HtmlBlockOpenThead",
+  "HtmlBlockCloseThead",
+  "HtmlBlockThead",
+  "HtmlBlockOpenTr",
+  "HtmlBlockCloseTr",
+  "HtmlBlockTr",
+  "HtmlBlockOpenScript",
+  "HtmlBlockCloseScript",
+  "HtmlBlockScript",
+  "HtmlBlockInTags",
+  "MarkdownHtmlTagOpen",
+  "HtmlComment",
+  "HtmlBlockSelfClosing",
+  "HtmlBlockType",
+  "StyleOpen",
+  "StyleClose",
+  "InStyleTags",
+  "Str",
+  "MathSpan",
+  "UlOrStarLine",
+  "Space",
+  "Strong",
+  "Emph",
+  "CitationReference",
+  "Image",
+  "Link",
+  "NoteReference",
+  "Code",
+  "RawHtml",
+  "Entity",
+  "EscapedChar",
+  "Smart",
+  "Symbol",
+  "NormalChar",
+  "StrChunk",
+  "Alphanumeric",
+  "AposChunk",
+  "HexEntity",
+  "DecEntity",
+  "CharEntity",
+  "LineBreak",
+  "TerminalEndline",
+  "NormalEndline",
+  "Eof",
+  "SpecialChar",
+  "UlLine",
+  "StarLine",
+  "EmphStar",
+  "EmphUl",
+  "OneStarOpen",
+  "OneStarClose",
+  "OneUlOpen",
+  "OneUlClose",
+  "StrongStar",
+  "StrongUl",
+  "TwoStarOpen",
+  "TwoStarClose",
+  "TwoUlOpen",
+  "TwoUlClose",
+  "ExplicitLink",
+  "ReferenceLink",
+  "AutoLink",
+  "ReferenceLinkDouble",
+  "ReferenceLinkSingle",
+  "Label",
+  "Source",
+  "Title",
+  "SourceContents",
+  "Nonspacechar",
+  "TitleSingle",
+  "TitleDouble",
+  "AutoLinkUrl",
+  "AutoLinkEmail",
+  "RefSrc",
+  "RefTitle",
+  "Attributes",
+  "Attribute",
+  "AttrKey",
+  "AttrValue",
+  "QuotedValue",
+  "UnQuotedValue",
+  "RefTitleSingle",
+  "RefTitleDouble",
+  "RefTitleParens",
+  "EmptyTitle",
+  "References",
+  "Ticks1",
+  "Ticks2",
+  "Ticks3",
+  "Ticks4",
+  "Ticks5",
+  "HtmlTag",
+  "Quoted",
+  "ExtendedSpecialChar",
+  "NonAlphanumeric",
+  "Digit",
+  "Ellipsis",
+  "Dash",
+  "SingleQuoted",
+  "DoubleQuoted",
+  "Apostrophe",
+  "EmDash",
+  "EnDash",
+  "SingleQuoteStart",
+  "SingleQuoteEnd",
+  "DoubleQuoteStart",
+  "DoubleQuoteEnd",
+  "RawNoteReference",
+  "GlossaryTerm",
+  "GlossarySortKey",
+  "RawNoteBlock",
+  "InlineNote",
+  "Notes",
+  "CitationReferenceDouble",
+  "CitationReferenceSingle",
+  "RawCitationReference",
+  "AutoLabels",
+  "TableCaption",
+  "TableBody",
+  "SeparatorLine",
+  "TermLine",
+  "Term",
+  "Definition",
+  "TableRow",
+  "TableLine",
+  "CellDivider",
+  "TableCell",
+  "ExtendedCell",
+  "EmptyCell",
+  "FullCell",
+  "CellStr",
+  "AlignmentCell",
+  "LeftAlignWrap",
+  "CenterAlignWrap",
+  "RightAlignWrap",
+  "LeftAlign",
+  "CenterAlign",
+  "RightAlign",
+  "DocForOPML",
+  "OPMLBlock",
+  "OPMLHeadingSection",
+  "OPMLPlain",
+  "OPMLHeading",
+  "OPMLSectionBlock",
+  "OPMLAtxHeading",
+  "OPMLSetextHeading",
+  "OPMLSetextHeading1",
+  "OPMLSetextHeading2",
+  "MarkdownHtmlAttribute",
+};
+#endif
+
+YY_ACTION(int) yypredicate0(void)	{ return ( !extension(EXT_COMPATIBILITY) && !extension(EXT_NO_LABELS)); }
+YY_ACTION(int) yypredicate1(void)	{ return ( extension(EXT_NOTES) ); }
+YY_ACTION(int) yypredicate2(void)	{ return ( extension(EXT_SMART) ); }
+YY_ACTION(int) yypredicate3(void)	{ return ( extension(EXT_NOTES) ); }
+YY_ACTION(int) yypredicate4(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate5(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate6(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate7(void)	{ return ( extension(EXT_NOTES) ); }
+YY_ACTION(int) yypredicate8(void)	{ return ( !extension(EXT_NOTES) ); }
+YY_ACTION(int) yypredicate9(void)	{ return ( extension(EXT_SMART) ); }
+YY_ACTION(int) yypredicate10(void)	{ return ( extension(EXT_SMART) ); }
+YY_ACTION(int) yypredicate11(void)	{ return ( extension(EXT_NOTES) ); }
+YY_ACTION(int) yypredicate12(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate13(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate14(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate15(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate16(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate17(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate18(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate19(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate20(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate21(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate22(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate23(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate24(void)	{ return ( extension(EXT_NOTES) ); }
+YY_ACTION(int) yypredicate25(void)	{ return ( extension(EXT_NOTES) ); }
+YY_ACTION(int) yypredicate26(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate27(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate28(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate29(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+YY_ACTION(int) yypredicate30(void)	{ return ( !extension(EXT_COMPATIBILITY) ); }
+
+static int (*const yypredicates[])(void)= { yypredicate0, yypredicate1, yypredicate2, yypredicate3, yypredicate4, yypredicate5, yypredicate6, yypredicate7, yypredicate8, yypredicate9, yypredicate10, yypredicate11, yypredicate12, yypredicate13, yypredicate14, yypredicate15, yypredicate16, yypredicate17, yypredicate18, yypredicate19, yypredicate20, yypredicate21, yypredicate22, yypredicate23, yypredicate24, yypredicate25, yypredicate26, yypredicate27, yypredicate28, yypredicate29, yypredicate30 };
+
+static const yyaction yyactions[]= {
+  yy_6_MarkdownHtmlTagOpen,
+  yy_5_MarkdownHtmlTagOpen,
+  yy_4_MarkdownHtmlTagOpen,
+  yy_3_MarkdownHtmlTagOpen,
+  yy_2_MarkdownHtmlTagOpen,
+  yy_1_MarkdownHtmlTagOpen,
+  yy_2_OPMLPlain,
+  yy_1_OPMLPlain,
+  yy_1_OPMLSetextHeading2,
+  yy_1_OPMLSetextHeading1,
+  yy_1_OPMLAtxHeading,
+  yy_3_OPMLHeadingSection,
+  yy_2_OPMLHeadingSection,
+  yy_1_OPMLHeadingSection,
+  yy_3_DocForOPML,
+  yy_2_DocForOPML,
+  yy_1_DocForOPML,
+  yy_1_MathSpan,
+  yy_1_AutoLabel,
+  yy_2_TableCaption,
+  yy_1_TableCaption,
+  yy_1_RightAlign,
+  yy_1_RightAlignWrap,
+  yy_1_CenterAlign,
+  yy_1_CenterAlignWrap,
+  yy_1_LeftAlign,
+  yy_1_LeftAlignWrap,
+  yy_2_SeparatorLine,
+  yy_1_SeparatorLine,
+  yy_1_EmptyCell,
+  yy_2_FullCell,
+  yy_1_FullCell,
+  yy_1_CellStr,
+  yy_1_ExtendedCell,
+  yy_2_TableRow,
+  yy_1_TableRow,
+  yy_2_TableBody,
+  yy_1_TableBody,
+  yy_7_Table,
+  yy_6_Table,
+  yy_5_Table,
+  yy_4_Table,
+  yy_3_Table,
+  yy_2_Table,
+  yy_1_Table,
+  yy_7_Definition,
+  yy_6_Definition,
+  yy_5_Definition,
+  yy_4_Definition,
+  yy_3_Definition,
+  yy_2_Definition,
+  yy_1_Definition,
+  yy_2_Term,
+  yy_1_Term,
+  yy_3_DefinitionList,
+  yy_2_DefinitionList,
+  yy_1_DefinitionList,
+  yy_7_AutoLabels,
+  yy_6_AutoLabels,
+  yy_5_AutoLabels,
+  yy_4_AutoLabels,
+  yy_3_AutoLabels,
+  yy_2_AutoLabels,
+  yy_1_AutoLabels,
+  yy_1_RawCitationReference,
+  yy_1_CitationReferenceSingle,
+  yy_1_CitationReferenceDouble,
+  yy_3_RawNoteBlock,
+  yy_2_RawNoteBlock,
+  yy_1_RawNoteBlock,
+  yy_2_Notes,
+  yy_1_Notes,
+  yy_2_InlineNote,
+  yy_1_InlineNote,
+  yy_3_Note,
+  yy_2_Note,
+  yy_1_Note,
+  yy_1_GlossarySortKey,
+  yy_1_GlossaryTerm,
+  yy_5_Glossary,
+  yy_4_Glossary,
+  yy_3_Glossary,
+  yy_2_Glossary,
+  yy_1_Glossary,
+  yy_1_RawNoteReference,
+  yy_1_NoteReference,
+  yy_2_DoubleQuoted,
+  yy_1_DoubleQuoted,
+  yy_2_SingleQuoted,
+  yy_1_SingleQuoted,
+  yy_1_EmDash,
+  yy_1_EnDash,
+  yy_1_Ellipsis,
+  yy_1_Apostrophe,
+  yy_1_SkipBlock,
+  yy_1_Line,
+  yy_1_StartList,
+  yy_1_RawHtml,
+  yy_1_Code,
+  yy_2_References,
+  yy_1_References,
+  yy_1_RefTitle,
+  yy_1_RefSrc,
+  yy_2_Label,
+  yy_1_Label,
+  yy_1_AttrValue,
+  yy_1_AttrKey,
+  yy_1_Attribute,
+  yy_2_Attributes,
+  yy_1_Attributes,
+  yy_2_Reference,
+  yy_1_Reference,
+  yy_1_AutoLinkEmail,
+  yy_1_AutoLinkUrl,
+  yy_1_Title,
+  yy_1_Source,
+  yy_1_ExplicitLink,
+  yy_1_ReferenceLinkSingle,
+  yy_1_ReferenceLinkDouble,
+  yy_1_Image,
+  yy_1_ImageBlock,
+  yy_3_StrongUl,
+  yy_2_StrongUl,
+  yy_1_StrongUl,
+  yy_1_TwoUlClose,
+  yy_3_StrongStar,
+  yy_2_StrongStar,
+  yy_1_StrongStar,
+  yy_1_TwoStarClose,
+  yy_3_EmphUl,
+  yy_2_EmphUl,
+  yy_1_EmphUl,
+  yy_1_OneUlClose,
+  yy_3_EmphStar,
+  yy_2_EmphStar,
+  yy_1_EmphStar,
+  yy_1_OneStarClose,
+  yy_1_UlOrStarLine,
+  yy_1_Symbol,
+  yy_1_LineBreak,
+  yy_1_TerminalEndline,
+  yy_1_NormalEndline,
+  yy_1_Entity,
+  yy_1_EscapedChar,
+  yy_1_AposChunk,
+  yy_1_StrChunk,
+  yy_3_Str,
+  yy_2_Str,
+  yy_1_Str,
+  yy_1_Space,
+  yy_4_Inlines,
+  yy_3_Inlines,
+  yy_2_Inlines,
+  yy_1_Inlines,
+  yy_1_StyleBlock,
+  yy_1_HtmlBlock,
+  yy_1_OrderedList,
+  yy_3_ListContinuationBlock,
+  yy_2_ListContinuationBlock,
+  yy_1_ListContinuationBlock,
+  yy_3_ListBlock,
+  yy_2_ListBlock,
+  yy_1_ListBlock,
+  yy_3_ListItemTight,
+  yy_2_ListItemTight,
+  yy_1_ListItemTight,
+  yy_3_ListItem,
+  yy_2_ListItem,
+  yy_1_ListItem,
+  yy_2_ListLoose,
+  yy_1_ListLoose,
+  yy_2_ListTight,
+  yy_1_ListTight,
+  yy_1_BulletList,
+  yy_1_HorizontalRule,
+  yy_2_Verbatim,
+  yy_1_Verbatim,
+  yy_3_VerbatimChunk,
+  yy_2_VerbatimChunk,
+  yy_1_VerbatimChunk,
+  yy_4_BlockQuoteRaw,
+  yy_3_BlockQuoteRaw,
+  yy_2_BlockQuoteRaw,
+  yy_1_BlockQuoteRaw,
+  yy_1_BlockQuote,
+  yy_3_HeadingSection,
+  yy_2_HeadingSection,
+  yy_1_HeadingSection,
+  yy_3_SetextHeading2,
+  yy_2_SetextHeading2,
+  yy_1_SetextHeading2,
+  yy_3_SetextHeading1,
+  yy_2_SetextHeading1,
+  yy_1_SetextHeading1,
+  yy_3_AtxHeading,
+  yy_2_AtxHeading,
+  yy_1_AtxHeading,
+  yy_1_AtxStart,
+  yy_1_Plain,
+  yy_1_Para,
+  yy_4_MetaDataValue,
+  yy_3_MetaDataValue,
+  yy_2_MetaDataValue,
+  yy_1_MetaDataValue,
+  yy_1_MetaDataKey,
+  yy_1_MetaDataKeyValue,
+  yy_2_MetaDataOnly,
+  yy_1_MetaDataOnly,
+  yy_2_MetaData,
+  yy_1_MetaData,
+  yy_3_DocWithMetaData,
+  yy_2_DocWithMetaData,
+  yy_1_DocWithMetaData,
+  yy_2_Doc,
+  yy_1_Doc,
+  0
+};
+
+static const unsigned char yyclasses[][32]= {
+  "\000\000\000\000\000\000\000\000\000\040\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\006\000\000\005\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\377\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\002\000\000\011\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\006\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\040\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\002\000\000\001\040\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\006\000\000\001\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\002\000\000\001\040\000\004\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\006\000\000\001\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\001\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\377\377\377\377\377\377\000\374\001\000\000\370\001\000\000\370\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\204\140\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\204\140\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\204\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\377\377\377\377\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\377\377\377\377\177\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\000\000\000\000\000\040\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\006\000\000\001\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\006\000\000\201\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\100\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\004\100\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\006\000\000\001\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\377\371\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\000\000\000\000\062\350\377\003\376\377\377\207\376\377\377\107\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\004\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\002\000\000\001\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\002\000\000\001\000\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\316\147\000\020\000\000\000\370\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\012\157\000\120\000\000\000\270\001\000\000\070\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\377\371\377\377\376\377\377\377\377\377\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\000\000\000\000\000\000\000\020\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\004\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\002\000\000\001\004\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\136\363\071\000\136\363\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\001\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\377\371\377\377\376\377\377\277\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\000\000\000\000\001\054\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\001\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\001\054\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\054\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\100\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\002\000\000\001\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\001\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\001\044\000\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\002\000\000\001\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\000\002\000\000\001\040\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\001\040\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\200\000\000",
+  ""
+};
+
+static const char yyliterals[]= "markdownMARKDOWN:++:    [#[]^[[^-----.... . .`````mailto:://__**"
+  "****____===&#\134[\134\134]\134(\134\134)styleSTYLEaddressblockquotecenterdirdivdl"
+  "fieldsetformh1h2h3h4h5h6hrisindexmenunoframesnoscriptolpretableu"
+  "ldtframesetlitbodytdtfootththeadtrADDRESSBLOCKQUOTECENTERDIRDIVD"
+  "LFIELDSETFORMH1H2H3H4H5H6HRISINDEXMENUNOFRAMESNOSCRIPTOLPRETABLE"
+  "ULDTFRAMESETLITBODYTDTFOOTTHTHEADTR<!---->videoVIDEOsectionSECTI"
+  "ONprogressPROGRESShgroupHGROUPheaderHEADERfooterFOOTERfigureFIGU"
+  "REcanvasCANVASasideASIDEarticleARTICLE######glossary:\357\273\277";
+
+static const yyword yycode[]= {
+  /* 0: MarkdownHtmlAttribute */
+  yyop_ENTER, 336, 2,
+  yyop_TEST, 0, 67,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_STRING, 0, 8, 18,
+  yyop_JUMP, 22,
+  yyop_RESTORE, 1,
+  yyop_STRING, 8, 8, 65,
+  yyop_CALL, 14909, 65,
+  yyop_CHAR, 61, 65,
+  yyop_CALL, 14909, 65,
+  yyop_SAVE, 1,
+  yyop_CHAR, 34, 43,
+  yyop_CALL, 14909, 41,
+  yyop_JUMP, 43,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 49, 65,
+  yyop_TEST, 1, 61,
+  yyop_SAVE, 1,
+  yyop_CALL, 14909, 61,
+  yyop_CHAR, 34, 59,
+  yyop_JUMP, 61,
+  yyop_RESTORE, 1,
+  yyop_CALL, 14909, 65,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 68: OPMLSetextHeading2 */
+  yyop_ENTER, 335, 1,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 90,
+  yyop_SPAN, 2,
+  yyop_END, 88,
+  yyop_CHAR, 10, 88,
+  yyop_CALL, 16094, 88,
+  yyop_ACTION, 8,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 91: OPMLSetextHeading1 */
+  yyop_ENTER, 334, 1,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 113,
+  yyop_SPAN, 2,
+  yyop_END, 111,
+  yyop_CHAR, 10, 111,
+  yyop_CALL, 16112, 111,
+  yyop_ACTION, 9,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 114: OPMLSetextHeading */
+  yyop_ENTER, 333, 2,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 91, 128,
+  yyop_JUMP, 131,
+  yyop_RESTORE, 1,
+  yyop_CALL, 68, 132,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 135: OPMLAtxHeading */
+  yyop_ENTER, 332, 4,
+  yyop_TEST, 3, 268,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 16321, 158,
+  yyop_JUMP, 161,
+  yyop_RESTORE, 3,
+  yyop_CALL, 16130, 163,
+  yyop_JUMP, 171,
+  yyop_RESTORE, 2,
+  yyop_TEST, 3, 266,
+  yyop_CALL, 16533, 266,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16635, 266,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_JUMP, 186,
+  yyop_RESTORE, 1,
+  yyop_BEGIN, 266,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 10, 199,
+  yyop_JUMP, 224,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_JUMP, 209,
+  yyop_RESTORE, 3,
+  yyop_SPAN, 3,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 218,
+  yyop_JUMP, 224,
+  yyop_RESTORE, 2,
+  yyop_DOT, 224,
+  yyop_JUMP, 188,
+  yyop_RESTORE, 1,
+  yyop_END, 266,
+  yyop_TEST, 5, 250,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_JUMP, 241,
+  yyop_RESTORE, 2,
+  yyop_CHAR, 35, 248,
+  yyop_SPAN, 3,
+  yyop_JUMP, 250,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_JUMP, 258,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 10, 266,
+  yyop_ACTION, 10,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 269: OPMLSectionBlock */
+  yyop_ENTER, 331, 2,
+  yyop_SAVE, 0,
+  yyop_TEST, 6, 288,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 286,
+  yyop_JUMP, 274,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 304, 297,
+  yyop_JUMP, 301,
+  yyop_RESTORE, 1,
+  yyop_CALL, 330, 301,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 304: OPMLHeading */
+  yyop_ENTER, 330, 2,
+  yyop_SAVE, 0,
+  yyop_TEST, 3, 321,
+  yyop_SAVE, 1,
+  yyop_CALL, 135, 321,
+  yyop_JUMP, 326,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 114, 327,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 330: OPMLPlain */
+  yyop_ENTER, 329, 5,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 454,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 356,
+  yyop_JUMP, 454,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 16321, 371,
+  yyop_JUMP, 374,
+  yyop_RESTORE, 3,
+  yyop_CALL, 16130, 376,
+  yyop_JUMP, 384,
+  yyop_RESTORE, 2,
+  yyop_TEST, 3, 386,
+  yyop_CALL, 16533, 386,
+  yyop_JUMP, 454,
+  yyop_RESTORE, 1,
+  yyop_CALL, 18952, 454,
+  yyop_ACTION, 95,
+  yyop_ACTION, 7,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 406,
+  yyop_JUMP, 447,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_SAVE, 4,
+  yyop_CALL, 16321, 421,
+  yyop_JUMP, 424,
+  yyop_RESTORE, 4,
+  yyop_CALL, 16130, 426,
+  yyop_JUMP, 434,
+  yyop_RESTORE, 3,
+  yyop_TEST, 3, 436,
+  yyop_CALL, 16533, 436,
+  yyop_JUMP, 447,
+  yyop_RESTORE, 2,
+  yyop_CALL, 18952, 447,
+  yyop_ACTION, 95,
+  yyop_ACTION, 7,
+  yyop_JUMP, 395,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 6,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 457: OPMLHeadingSection */
+  yyop_ENTER, 328, 2,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 495,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_CALL, 304, 495,
+  yyop_ACTION, 13,
+  yyop_SAVE, 1,
+  yyop_CALL, 269, 490,
+  yyop_ACTION, 12,
+  yyop_JUMP, 479,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 11,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 498: OPMLBlock */
+  yyop_ENTER, 327, 2,
+  yyop_SAVE, 0,
+  yyop_TEST, 6, 517,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 515,
+  yyop_JUMP, 503,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 457, 526,
+  yyop_JUMP, 529,
+  yyop_RESTORE, 1,
+  yyop_CALL, 330, 530,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 533: DocForOPML */
+  yyop_ENTER, 326, 4,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_SAVE, 1,
+  yyop_DOT, 627,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_SAVE, 1,
+  yyop_DOT, 627,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_TEST, 7, 597,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CALL, 19485, 595,
+  yyop_SPAN, 4,
+  yyop_CHAR, 58, 595,
+  yyop_SPAN, 4,
+  yyop_SAVE, 3,
+  yyop_CHAR, 10, 586,
+  yyop_JUMP, 595,
+  yyop_RESTORE, 3,
+  yyop_RESTORE, 2,
+  yyop_CALL, 19405, 595,
+  yyop_ACTION, 16,
+  yyop_JUMP, 597,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 498, 608,
+  yyop_ACTION, 15,
+  yyop_JUMP, 597,
+  yyop_RESTORE, 1,
+  yyop_TEST, 6, 622,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 620,
+  yyop_JUMP, 608,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 14,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 630: RightAlign */
+  yyop_ENTER, 325, 3,
+  yyop_TEST, 8, 673,
+  yyop_SAVE, 0,
+  yyop_CHAR, 45, 673,
+  yyop_SPAN, 8,
+  yyop_CHAR, 58, 671,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 45, 657,
+  yyop_JUMP, 671,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 58, 666,
+  yyop_JUMP, 671,
+  yyop_RESTORE, 2,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 21,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 674: CenterAlign */
+  yyop_ENTER, 324, 3,
+  yyop_SAVE, 0,
+  yyop_CHAR, 58, 714,
+  yyop_SPAN, 8,
+  yyop_CHAR, 58, 712,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 45, 698,
+  yyop_JUMP, 712,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 58, 707,
+  yyop_JUMP, 712,
+  yyop_RESTORE, 2,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 23,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 715: LeftAlign */
+  yyop_ENTER, 323, 3,
+  yyop_TEST, 9, 764,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CHAR, 58, 732,
+  yyop_JUMP, 732,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 45, 762,
+  yyop_SPAN, 8,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 45, 748,
+  yyop_JUMP, 762,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 58, 757,
+  yyop_JUMP, 762,
+  yyop_RESTORE, 2,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 25,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 765: RightAlignWrap */
+  yyop_ENTER, 322, 3,
+  yyop_TEST, 8, 809,
+  yyop_SAVE, 0,
+  yyop_CHAR, 45, 809,
+  yyop_SPAN, 8,
+  yyop_STRING, 16, 2, 807,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 45, 793,
+  yyop_JUMP, 807,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 58, 802,
+  yyop_JUMP, 807,
+  yyop_RESTORE, 2,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 22,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 810: CenterAlignWrap */
+  yyop_ENTER, 321, 3,
+  yyop_SAVE, 0,
+  yyop_CHAR, 58, 851,
+  yyop_SPAN, 8,
+  yyop_STRING, 18, 2, 849,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 45, 835,
+  yyop_JUMP, 849,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 58, 844,
+  yyop_JUMP, 849,
+  yyop_RESTORE, 2,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 24,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 852: LeftAlignWrap */
+  yyop_ENTER, 320, 3,
+  yyop_TEST, 9, 904,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CHAR, 58, 869,
+  yyop_JUMP, 869,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 45, 902,
+  yyop_SPAN, 8,
+  yyop_CHAR, 43, 902,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 45, 888,
+  yyop_JUMP, 902,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 58, 897,
+  yyop_JUMP, 902,
+  yyop_RESTORE, 2,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 26,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 905: AlignmentCell */
+  yyop_ENTER, 319, 2,
+  yyop_TEST, 10, 998,
+  yyop_SAVE, 0,
+  yyop_SPAN, 4,
+  yyop_SAVE, 1,
+  yyop_CHAR, 124, 924,
+  yyop_JUMP, 996,
+  yyop_RESTORE, 1,
+  yyop_TEST, 9, 936,
+  yyop_SAVE, 1,
+  yyop_CALL, 852, 936,
+  yyop_JUMP, 984,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 11, 948,
+  yyop_CALL, 810, 948,
+  yyop_JUMP, 984,
+  yyop_RESTORE, 1,
+  yyop_TEST, 8, 958,
+  yyop_CALL, 765, 958,
+  yyop_JUMP, 984,
+  yyop_RESTORE, 1,
+  yyop_TEST, 9, 968,
+  yyop_CALL, 715, 968,
+  yyop_JUMP, 984,
+  yyop_RESTORE, 1,
+  yyop_TEST, 11, 978,
+  yyop_CALL, 674, 978,
+  yyop_JUMP, 984,
+  yyop_RESTORE, 1,
+  yyop_TEST, 8, 996,
+  yyop_CALL, 630, 996,
+  yyop_SPAN, 4,
+  yyop_SAVE, 1,
+  yyop_CHAR, 124, 995,
+  yyop_JUMP, 995,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 999: CellStr */
+  yyop_ENTER, 318, 4,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 1064,
+  yyop_SAVE, 1,
+  yyop_CHAR, 124, 1015,
+  yyop_JUMP, 1062,
+  yyop_RESTORE, 1,
+  yyop_CALL, 6074, 1062,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 124, 1031,
+  yyop_JUMP, 1036,
+  yyop_RESTORE, 3,
+  yyop_CALL, 6074, 1036,
+  yyop_JUMP, 1053,
+  yyop_RESTORE, 2,
+  yyop_TEST, 12, 1055,
+  yyop_CHAR, 95, 1055,
+  yyop_SPAN, 12,
+  yyop_SAVE, 3,
+  yyop_CLASS, 13, 1055,
+  yyop_RESTORE, 3,
+  yyop_JUMP, 1018,
+  yyop_RESTORE, 1,
+  yyop_END, 1062,
+  yyop_ACTION, 32,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1065: FullCell */
+  yyop_ENTER, 317, 5,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SPAN, 4,
+  yyop_SAVE, 1,
+  yyop_DOT, 1308,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 124, 1095,
+  yyop_JUMP, 1100,
+  yyop_RESTORE, 2,
+  yyop_CALL, 999, 1100,
+  yyop_JUMP, 1183,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 10, 1111,
+  yyop_JUMP, 1308,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 14, 1125,
+  yyop_SAVE, 3,
+  yyop_CALL, 5842, 1125,
+  yyop_JUMP, 1143,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 6, 1137,
+  yyop_CALL, 5815, 1137,
+  yyop_JUMP, 1143,
+  yyop_RESTORE, 3,
+  yyop_TEST, 6, 1145,
+  yyop_CALL, 5735, 1145,
+  yyop_JUMP, 1308,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 124, 1156,
+  yyop_JUMP, 1308,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CALL, 7873, 1165,
+  yyop_JUMP, 1308,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_SAVE, 3,
+  yyop_CHAR, 124, 1178,
+  yyop_RESTORE, 3,
+  yyop_JUMP, 1308,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 1308,
+  yyop_ACTION, 31,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 124, 1198,
+  yyop_JUMP, 1203,
+  yyop_RESTORE, 3,
+  yyop_CALL, 999, 1203,
+  yyop_JUMP, 1286,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 10, 1214,
+  yyop_JUMP, 1290,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 14, 1228,
+  yyop_SAVE, 4,
+  yyop_CALL, 5842, 1228,
+  yyop_JUMP, 1246,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 4,
+  yyop_TEST, 6, 1240,
+  yyop_CALL, 5815, 1240,
+  yyop_JUMP, 1246,
+  yyop_RESTORE, 4,
+  yyop_TEST, 6, 1248,
+  yyop_CALL, 5735, 1248,
+  yyop_JUMP, 1290,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CHAR, 124, 1259,
+  yyop_JUMP, 1290,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CALL, 7873, 1268,
+  yyop_JUMP, 1290,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_SAVE, 4,
+  yyop_CHAR, 124, 1281,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 1290,
+  yyop_RESTORE, 3,
+  yyop_CALL, 16698, 1290,
+  yyop_ACTION, 31,
+  yyop_JUMP, 1185,
+  yyop_RESTORE, 1,
+  yyop_SPAN, 4,
+  yyop_SAVE, 1,
+  yyop_CHAR, 124, 1303,
+  yyop_JUMP, 1303,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 30,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1311: EmptyCell */
+  yyop_ENTER, 316, 1,
+  yyop_TEST, 15, 1329,
+  yyop_SAVE, 0,
+  yyop_SPAN, 4,
+  yyop_CHAR, 124, 1327,
+  yyop_ACTION, 29,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1330: ExtendedCell */
+  yyop_ENTER, 315, 2,
+  yyop_SAVE, 0,
+  yyop_TEST, 15, 1351,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 124, 1349,
+  yyop_ACTION, 29,
+  yyop_JUMP, 1356,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 1065, 1368,
+  yyop_BEGIN, 1368,
+  yyop_CHAR, 124, 1368,
+  yyop_SPAN, 16,
+  yyop_END, 1368,
+  yyop_ACTION, 33,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1371: TableCell */
+  yyop_ENTER, 314, 2,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 1330, 1385,
+  yyop_JUMP, 1402,
+  yyop_RESTORE, 1,
+  yyop_TEST, 15, 1399,
+  yyop_SPAN, 4,
+  yyop_CHAR, 124, 1397,
+  yyop_ACTION, 29,
+  yyop_JUMP, 1402,
+  yyop_RESTORE, 1,
+  yyop_CALL, 1065, 1403,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1406: CellDivider */
+  yyop_ENTER, 313, 1,
+  yyop_SAVE, 0,
+  yyop_CHAR, 124, 1417,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1418: TableLine */
+  yyop_ENTER, 312, 3,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 10, 1434,
+  yyop_JUMP, 1447,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 124, 1443,
+  yyop_JUMP, 1447,
+  yyop_RESTORE, 2,
+  yyop_DOT, 1447,
+  yyop_JUMP, 1423,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 124, 1453,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1456: TableRow */
+  yyop_ENTER, 311, 3,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 1570,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 1923, 1482,
+  yyop_JUMP, 1570,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 1418, 1570,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 124, 1498,
+  yyop_JUMP, 1498,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 1330, 1507,
+  yyop_JUMP, 1524,
+  yyop_RESTORE, 1,
+  yyop_TEST, 15, 1521,
+  yyop_SPAN, 4,
+  yyop_CHAR, 124, 1519,
+  yyop_ACTION, 29,
+  yyop_JUMP, 1524,
+  yyop_RESTORE, 1,
+  yyop_CALL, 1065, 1570,
+  yyop_ACTION, 35,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CALL, 1330, 1537,
+  yyop_JUMP, 1554,
+  yyop_RESTORE, 2,
+  yyop_TEST, 15, 1551,
+  yyop_SPAN, 4,
+  yyop_CHAR, 124, 1549,
+  yyop_ACTION, 29,
+  yyop_JUMP, 1554,
+  yyop_RESTORE, 2,
+  yyop_CALL, 1065, 1558,
+  yyop_ACTION, 35,
+  yyop_JUMP, 1526,
+  yyop_RESTORE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 1570,
+  yyop_ACTION, 34,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1573: Definition */
+  yyop_ENTER, 310, 4,
+  yyop_TEST, 17, 1734,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_SAVE, 1,
+  yyop_DOT, 1732,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_SAVE, 1,
+  yyop_DOT, 1732,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_TEST, 6, 1619,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 1617,
+  yyop_ACTION, 51,
+  yyop_JUMP, 1619,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 58, 1732,
+  yyop_SPAN, 4,
+  yyop_CALL, 18952, 1732,
+  yyop_ACTION, 50,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 58, 1640,
+  yyop_JUMP, 1658,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 1649,
+  yyop_JUMP, 1658,
+  yyop_RESTORE, 2,
+  yyop_CALL, 18952, 1658,
+  yyop_ACTION, 49,
+  yyop_JUMP, 1629,
+  yyop_RESTORE, 1,
+  yyop_TEST, 6, 1727,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 1725,
+  yyop_ACTION, 48,
+  yyop_SAVE, 2,
+  yyop_CHAR, 9, 1681,
+  yyop_JUMP, 1685,
+  yyop_RESTORE, 2,
+  yyop_STRING, 20, 4, 1725,
+  yyop_CALL, 18952, 1725,
+  yyop_ACTION, 95,
+  yyop_ACTION, 47,
+  yyop_TEST, 4, 1721,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 9, 1706,
+  yyop_JUMP, 1710,
+  yyop_RESTORE, 3,
+  yyop_STRING, 20, 4, 1719,
+  yyop_CALL, 18952, 1719,
+  yyop_ACTION, 95,
+  yyop_ACTION, 47,
+  yyop_JUMP, 1692,
+  yyop_RESTORE, 2,
+  yyop_ACTION, 46,
+  yyop_JUMP, 1660,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 45,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1735: Term */
+  yyop_ENTER, 309, 4,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 1886,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 1761,
+  yyop_JUMP, 1886,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 58, 1772,
+  yyop_JUMP, 1886,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 1781,
+  yyop_JUMP, 1886,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 14, 1795,
+  yyop_SAVE, 2,
+  yyop_CALL, 5842, 1795,
+  yyop_JUMP, 1813,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 6, 1807,
+  yyop_CALL, 5815, 1807,
+  yyop_JUMP, 1813,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 1815,
+  yyop_CALL, 5735, 1815,
+  yyop_JUMP, 1886,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16698, 1886,
+  yyop_ACTION, 53,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 10, 1833,
+  yyop_JUMP, 1876,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 14, 1847,
+  yyop_SAVE, 3,
+  yyop_CALL, 5842, 1847,
+  yyop_JUMP, 1865,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 6, 1859,
+  yyop_CALL, 5815, 1859,
+  yyop_JUMP, 1865,
+  yyop_RESTORE, 3,
+  yyop_TEST, 6, 1867,
+  yyop_CALL, 5735, 1867,
+  yyop_JUMP, 1876,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 1876,
+  yyop_ACTION, 53,
+  yyop_JUMP, 1822,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 10, 1886,
+  yyop_ACTION, 52,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1889: TermLine */
+  yyop_ENTER, 308, 2,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CHAR, 58, 1903,
+  yyop_JUMP, 1920,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 1912,
+  yyop_JUMP, 1920,
+  yyop_RESTORE, 1,
+  yyop_SPAN, 2,
+  yyop_CHAR, 10, 1920,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1923: SeparatorLine */
+  yyop_ENTER, 307, 2,
+  yyop_TEST, 18, 1990,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 1988,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 1418, 1988,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 124, 1959,
+  yyop_JUMP, 1959,
+  yyop_RESTORE, 1,
+  yyop_CALL, 905, 1988,
+  yyop_ACTION, 28,
+  yyop_TEST, 10, 1978,
+  yyop_SAVE, 1,
+  yyop_CALL, 905, 1978,
+  yyop_ACTION, 28,
+  yyop_JUMP, 1964,
+  yyop_RESTORE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 1988,
+  yyop_ACTION, 27,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 1991: TableBody */
+  yyop_ENTER, 306, 2,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 2029,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_CALL, 1456, 2029,
+  yyop_ACTION, 37,
+  yyop_SAVE, 1,
+  yyop_CALL, 1456, 2024,
+  yyop_ACTION, 37,
+  yyop_JUMP, 2013,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 36,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2032: TableCaption */
+  yyop_ENTER, 305, 2,
+  yyop_TEST, 19, 2085,
+  yyop_SAVE, 0,
+  yyop_PUSH, 3,
+  yyop_SAVE, 1,
+  yyop_DOT, 2083,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 3,
+  yyop_CALL, 4615, 2083,
+  yyop_SET, 2,
+  yyop_TEST, 19, 2073,
+  yyop_SAVE, 1,
+  yyop_CALL, 4615, 2073,
+  yyop_SET, 1,
+  yyop_ACTION, 20,
+  yyop_JUMP, 2073,
+  yyop_RESTORE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 2083,
+  yyop_ACTION, 19,
+  yyop_POP, 3,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2086: AutoLabels */
+  yyop_ENTER, 304, 5,
+  yyop_SAVE, 0,
+  yyop_PUSH, 4,
+  yyop_PREDICATE, 0, 2238,
+  yyop_SAVE, 1,
+  yyop_DOT, 2238,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 4,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_SAVE, 4,
+  yyop_CALL, 16321, 2121,
+  yyop_JUMP, 2124,
+  yyop_RESTORE, 4,
+  yyop_CALL, 16130, 2126,
+  yyop_JUMP, 2134,
+  yyop_RESTORE, 3,
+  yyop_TEST, 3, 2140,
+  yyop_CALL, 16533, 2140,
+  yyop_SET, 3,
+  yyop_ACTION, 63,
+  yyop_JUMP, 2229,
+  yyop_RESTORE, 2,
+  yyop_TEST, 19, 2163,
+  yyop_CALL, 2032, 2163,
+  yyop_SET, 2,
+  yyop_ACTION, 62,
+  yyop_CALL, 1991, 2161,
+  yyop_SET, 1,
+  yyop_ACTION, 61,
+  yyop_JUMP, 2229,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 1991, 2176,
+  yyop_SET, 1,
+  yyop_ACTION, 60,
+  yyop_JUMP, 2186,
+  yyop_RESTORE, 3,
+  yyop_TEST, 18, 2224,
+  yyop_CALL, 1923, 2224,
+  yyop_SET, 1,
+  yyop_ACTION, 59,
+  yyop_SAVE, 3,
+  yyop_SAVE, 4,
+  yyop_CALL, 1991, 2201,
+  yyop_SET, 1,
+  yyop_ACTION, 60,
+  yyop_JUMP, 2211,
+  yyop_RESTORE, 4,
+  yyop_TEST, 18, 2213,
+  yyop_CALL, 1923, 2213,
+  yyop_SET, 1,
+  yyop_ACTION, 59,
+  yyop_JUMP, 2186,
+  yyop_RESTORE, 3,
+  yyop_CALL, 2032, 2224,
+  yyop_SET, 2,
+  yyop_ACTION, 58,
+  yyop_JUMP, 2229,
+  yyop_RESTORE, 2,
+  yyop_CALL, 19154, 2231,
+  yyop_JUMP, 2106,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 57,
+  yyop_POP, 4,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2241: RawCitationReference */
+  yyop_ENTER, 303, 3,
+  yyop_SAVE, 0,
+  yyop_STRING, 24, 2, 2308,
+  yyop_BEGIN, 2306,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 2261,
+  yyop_JUMP, 2306,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 93, 2270,
+  yyop_JUMP, 2306,
+  yyop_RESTORE, 1,
+  yyop_DOT, 2306,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 10, 2283,
+  yyop_JUMP, 2296,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 93, 2292,
+  yyop_JUMP, 2296,
+  yyop_RESTORE, 2,
+  yyop_DOT, 2296,
+  yyop_JUMP, 2272,
+  yyop_RESTORE, 1,
+  yyop_END, 2306,
+  yyop_CHAR, 93, 2306,
+  yyop_ACTION, 64,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2309: CitationReferenceSingle */
+  yyop_ENTER, 302, 3,
+  yyop_TEST, 19, 2372,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_STRING, 26, 2, 2337,
+  yyop_CALL, 14909, 2335,
+  yyop_CALL, 2241, 2335,
+  yyop_SET, 1,
+  yyop_JUMP, 2365,
+  yyop_RESTORE, 1,
+  yyop_TEST, 19, 2370,
+  yyop_CALL, 2241, 2370,
+  yyop_SET, 1,
+  yyop_BEGIN, 2370,
+  yyop_TEST, 20, 2363,
+  yyop_SAVE, 2,
+  yyop_CALL, 14909, 2363,
+  yyop_STRING, 26, 2, 2361,
+  yyop_JUMP, 2363,
+  yyop_RESTORE, 2,
+  yyop_END, 2370,
+  yyop_ACTION, 65,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2373: CitationReferenceDouble */
+  yyop_ENTER, 301, 2,
+  yyop_TEST, 19, 2427,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_SAVE, 1,
+  yyop_STRING, 26, 2, 2393,
+  yyop_JUMP, 2425,
+  yyop_RESTORE, 1,
+  yyop_CALL, 4615, 2425,
+  yyop_SET, 2,
+  yyop_BEGIN, 2425,
+  yyop_CALL, 14909, 2425,
+  yyop_END, 2425,
+  yyop_SAVE, 1,
+  yyop_STRING, 26, 2, 2415,
+  yyop_JUMP, 2425,
+  yyop_RESTORE, 1,
+  yyop_CALL, 2241, 2425,
+  yyop_SET, 1,
+  yyop_ACTION, 66,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2428: Notes */
+  yyop_ENTER, 300, 4,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_SAVE, 1,
+  yyop_DOT, 2496,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_SAVE, 1,
+  yyop_TEST, 21, 2482,
+  yyop_SAVE, 2,
+  yyop_TEST, 21, 2466,
+  yyop_SAVE, 3,
+  yyop_CALL, 18615, 2466,
+  yyop_SET, 1,
+  yyop_JUMP, 2476,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 21, 2480,
+  yyop_CALL, 18538, 2480,
+  yyop_SET, 1,
+  yyop_ACTION, 71,
+  yyop_JUMP, 2487,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CALL, 19154, 2489,
+  yyop_JUMP, 2445,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 70,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2499: InlineNote */
+  yyop_ENTER, 299, 3,
+  yyop_TEST, 22, 2570,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_PREDICATE, 1, 2568,
+  yyop_STRING, 28, 2, 2568,
+  yyop_SAVE, 1,
+  yyop_DOT, 2568,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 93, 2535,
+  yyop_JUMP, 2568,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16698, 2568,
+  yyop_ACTION, 73,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 93, 2551,
+  yyop_JUMP, 2558,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 2558,
+  yyop_ACTION, 73,
+  yyop_JUMP, 2540,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 93, 2568,
+  yyop_ACTION, 72,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2571: RawNoteBlock */
+  yyop_ENTER, 298, 4,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 2699,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 2597,
+  yyop_JUMP, 2699,
+  yyop_RESTORE, 1,
+  yyop_TEST, 4, 2621,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 9, 2613,
+  yyop_JUMP, 2617,
+  yyop_RESTORE, 2,
+  yyop_STRING, 20, 4, 2619,
+  yyop_JUMP, 2621,
+  yyop_RESTORE, 1,
+  yyop_CALL, 18952, 2699,
+  yyop_ACTION, 95,
+  yyop_ACTION, 69,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 2639,
+  yyop_JUMP, 2672,
+  yyop_RESTORE, 2,
+  yyop_TEST, 4, 2663,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 9, 2655,
+  yyop_JUMP, 2659,
+  yyop_RESTORE, 3,
+  yyop_STRING, 20, 4, 2661,
+  yyop_JUMP, 2663,
+  yyop_RESTORE, 2,
+  yyop_CALL, 18952, 2672,
+  yyop_ACTION, 95,
+  yyop_ACTION, 69,
+  yyop_JUMP, 2628,
+  yyop_RESTORE, 1,
+  yyop_BEGIN, 2699,
+  yyop_TEST, 6, 2690,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 2688,
+  yyop_JUMP, 2676,
+  yyop_RESTORE, 1,
+  yyop_END, 2699,
+  yyop_ACTION, 68,
+  yyop_ACTION, 67,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2702: GlossarySortKey */
+  yyop_ENTER, 297, 3,
+  yyop_SAVE, 0,
+  yyop_CHAR, 40, 2748,
+  yyop_BEGIN, 2746,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 41, 2723,
+  yyop_JUMP, 2736,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 10, 2732,
+  yyop_JUMP, 2736,
+  yyop_RESTORE, 2,
+  yyop_DOT, 2736,
+  yyop_JUMP, 2712,
+  yyop_RESTORE, 1,
+  yyop_END, 2746,
+  yyop_CHAR, 41, 2746,
+  yyop_ACTION, 77,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2749: GlossaryTerm */
+  yyop_ENTER, 296, 3,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 2809,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 2765,
+  yyop_JUMP, 2807,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 40, 2774,
+  yyop_JUMP, 2807,
+  yyop_RESTORE, 1,
+  yyop_DOT, 2807,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 10, 2787,
+  yyop_JUMP, 2800,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 40, 2796,
+  yyop_JUMP, 2800,
+  yyop_RESTORE, 2,
+  yyop_DOT, 2800,
+  yyop_JUMP, 2776,
+  yyop_RESTORE, 1,
+  yyop_END, 2807,
+  yyop_ACTION, 78,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2810: RawNoteReference */
+  yyop_ENTER, 295, 3,
+  yyop_TEST, 19, 2890,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_STRING, 30, 2, 2828,
+  yyop_JUMP, 2832,
+  yyop_RESTORE, 1,
+  yyop_STRING, 24, 2, 2888,
+  yyop_BEGIN, 2888,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 2843,
+  yyop_JUMP, 2888,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 93, 2852,
+  yyop_JUMP, 2888,
+  yyop_RESTORE, 1,
+  yyop_DOT, 2888,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 10, 2865,
+  yyop_JUMP, 2878,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 93, 2874,
+  yyop_JUMP, 2878,
+  yyop_RESTORE, 2,
+  yyop_DOT, 2878,
+  yyop_JUMP, 2854,
+  yyop_RESTORE, 1,
+  yyop_END, 2888,
+  yyop_CHAR, 93, 2888,
+  yyop_ACTION, 84,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2891: DoubleQuoteEnd */
+  yyop_ENTER, 294, 1,
+  yyop_SAVE, 0,
+  yyop_CHAR, 34, 2902,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2903: DoubleQuoteStart */
+  yyop_ENTER, 293, 1,
+  yyop_SAVE, 0,
+  yyop_CHAR, 34, 2914,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2915: SingleQuoteEnd */
+  yyop_ENTER, 292, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 39, 2935,
+  yyop_SAVE, 1,
+  yyop_CLASS, 13, 2932,
+  yyop_JUMP, 2933,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2936: SingleQuoteStart */
+  yyop_ENTER, 291, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 39, 2956,
+  yyop_SAVE, 1,
+  yyop_CLASS, 6, 2953,
+  yyop_JUMP, 2954,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2957: EnDash */
+  yyop_ENTER, 290, 3,
+  yyop_TEST, 8, 2994,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 2994,
+  yyop_SAVE, 1,
+  yyop_STRING, 32, 2, 2977,
+  yyop_JUMP, 2987,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 45, 2992,
+  yyop_SAVE, 2,
+  yyop_CLASS, 23, 2992,
+  yyop_RESTORE, 2,
+  yyop_END, 2992,
+  yyop_ACTION, 91,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 2995: EmDash */
+  yyop_ENTER, 289, 1,
+  yyop_TEST, 8, 3016,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 3016,
+  yyop_STRING, 34, 3, 3016,
+  yyop_END, 3014,
+  yyop_ACTION, 90,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3017: Apostrophe */
+  yyop_ENTER, 288, 1,
+  yyop_SAVE, 0,
+  yyop_CHAR, 39, 3030,
+  yyop_ACTION, 93,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3031: DoubleQuoted */
+  yyop_ENTER, 287, 3,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_CHAR, 34, 3097,
+  yyop_SAVE, 1,
+  yyop_DOT, 3097,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_SAVE, 1,
+  yyop_CHAR, 34, 3060,
+  yyop_JUMP, 3097,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16698, 3097,
+  yyop_SET, 1,
+  yyop_ACTION, 87,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 34, 3078,
+  yyop_JUMP, 3087,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 3087,
+  yyop_SET, 1,
+  yyop_ACTION, 87,
+  yyop_JUMP, 3067,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 34, 3097,
+  yyop_ACTION, 86,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3100: SingleQuoted */
+  yyop_ENTER, 286, 4,
+  yyop_TEST, 24, 3198,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_CALL, 2936, 3196,
+  yyop_SAVE, 1,
+  yyop_DOT, 3196,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_SAVE, 1,
+  yyop_CHAR, 39, 3141,
+  yyop_SAVE, 2,
+  yyop_CLASS, 13, 3137,
+  yyop_JUMP, 3139,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 3196,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16698, 3196,
+  yyop_SET, 1,
+  yyop_ACTION, 89,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 39, 3168,
+  yyop_SAVE, 3,
+  yyop_CLASS, 13, 3164,
+  yyop_JUMP, 3166,
+  yyop_RESTORE, 3,
+  yyop_JUMP, 3177,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 3177,
+  yyop_SET, 1,
+  yyop_ACTION, 89,
+  yyop_JUMP, 3148,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 39, 3196,
+  yyop_SAVE, 1,
+  yyop_CLASS, 13, 3191,
+  yyop_JUMP, 3196,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 88,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3199: Dash */
+  yyop_ENTER, 285, 2,
+  yyop_TEST, 8, 3230,
+  yyop_SAVE, 0,
+  yyop_TEST, 8, 3219,
+  yyop_SAVE, 1,
+  yyop_CALL, 2995, 3219,
+  yyop_JUMP, 3227,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 8, 3228,
+  yyop_CALL, 2957, 3228,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3231: Ellipsis */
+  yyop_ENTER, 284, 2,
+  yyop_TEST, 25, 3258,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_STRING, 37, 3, 3249,
+  yyop_JUMP, 3253,
+  yyop_RESTORE, 1,
+  yyop_STRING, 40, 5, 3256,
+  yyop_ACTION, 92,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3259: Digit */
+  yyop_ENTER, 283, 1,
+  yyop_SAVE, 0,
+  yyop_CLASS, 23, 3270,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3271: NonAlphanumeric */
+  yyop_ENTER, 282, 1,
+  yyop_SAVE, 0,
+  yyop_CLASS, 26, 3282,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3283: ExtendedSpecialChar */
+  yyop_ENTER, 281, 2,
+  yyop_TEST, 27, 3320,
+  yyop_SAVE, 0,
+  yyop_TEST, 28, 3306,
+  yyop_SAVE, 1,
+  yyop_PREDICATE, 2, 3306,
+  yyop_CLASS, 28, 3306,
+  yyop_JUMP, 3317,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 22, 3318,
+  yyop_PREDICATE, 3, 3318,
+  yyop_CHAR, 94, 3318,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3321: Quoted */
+  yyop_ENTER, 280, 2,
+  yyop_TEST, 29, 3354,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CHAR, 34, 3343,
+  yyop_SPAN, 30,
+  yyop_CHAR, 34, 3341,
+  yyop_JUMP, 3351,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 39, 3352,
+  yyop_SPAN, 31,
+  yyop_CHAR, 39, 3352,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3355: HtmlTag */
+  yyop_ENTER, 279, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 3413,
+  yyop_CALL, 14909, 3411,
+  yyop_SAVE, 1,
+  yyop_CHAR, 47, 3375,
+  yyop_JUMP, 3375,
+  yyop_RESTORE, 1,
+  yyop_CLASS, 7, 3411,
+  yyop_SPAN, 7,
+  yyop_CALL, 14909, 3411,
+  yyop_TEST, 32, 3395,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 3395,
+  yyop_JUMP, 3383,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 47, 3404,
+  yyop_JUMP, 3404,
+  yyop_RESTORE, 1,
+  yyop_CALL, 14909, 3411,
+  yyop_CHAR, 62, 3411,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3414: Ticks5 */
+  yyop_ENTER, 278, 2,
+  yyop_SAVE, 0,
+  yyop_STRING, 45, 5, 3435,
+  yyop_SAVE, 1,
+  yyop_CHAR, 96, 3432,
+  yyop_JUMP, 3433,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3436: Ticks4 */
+  yyop_ENTER, 277, 2,
+  yyop_SAVE, 0,
+  yyop_STRING, 45, 4, 3457,
+  yyop_SAVE, 1,
+  yyop_CHAR, 96, 3454,
+  yyop_JUMP, 3455,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3458: Ticks3 */
+  yyop_ENTER, 276, 2,
+  yyop_SAVE, 0,
+  yyop_STRING, 45, 3, 3479,
+  yyop_SAVE, 1,
+  yyop_CHAR, 96, 3476,
+  yyop_JUMP, 3477,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3480: Ticks2 */
+  yyop_ENTER, 275, 2,
+  yyop_SAVE, 0,
+  yyop_STRING, 45, 2, 3501,
+  yyop_SAVE, 1,
+  yyop_CHAR, 96, 3498,
+  yyop_JUMP, 3499,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3502: Ticks1 */
+  yyop_ENTER, 274, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 96, 3522,
+  yyop_SAVE, 1,
+  yyop_CHAR, 96, 3519,
+  yyop_JUMP, 3520,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3523: References */
+  yyop_ENTER, 273, 3,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_SAVE, 1,
+  yyop_DOT, 3572,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_SAVE, 1,
+  yyop_TEST, 21, 3558,
+  yyop_SAVE, 2,
+  yyop_CALL, 18434, 3558,
+  yyop_SET, 1,
+  yyop_ACTION, 100,
+  yyop_JUMP, 3563,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CALL, 19154, 3565,
+  yyop_JUMP, 3540,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 99,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3575: EmptyTitle */
+  yyop_ENTER, 272, 1,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 3587,
+  yyop_END, 3587,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3588: RefTitleParens */
+  yyop_ENTER, 271, 4,
+  yyop_TEST, 33, 3666,
+  yyop_SAVE, 0,
+  yyop_CALL, 14909, 3666,
+  yyop_CHAR, 40, 3664,
+  yyop_BEGIN, 3664,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 41, 3622,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 3620,
+  yyop_JUMP, 3648,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 10, 3629,
+  yyop_JUMP, 3648,
+  yyop_RESTORE, 3,
+  yyop_TEST, 34, 3650,
+  yyop_PREDICATE, 4, 3650,
+  yyop_CHAR, 41, 3650,
+  yyop_SPAN, 4,
+  yyop_CLASS, 7, 3650,
+  yyop_SPAN, 7,
+  yyop_CHAR, 61, 3650,
+  yyop_JUMP, 3656,
+  yyop_RESTORE, 2,
+  yyop_DOT, 3656,
+  yyop_JUMP, 3604,
+  yyop_RESTORE, 1,
+  yyop_END, 3664,
+  yyop_CHAR, 41, 3664,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3667: RefTitleDouble */
+  yyop_ENTER, 270, 4,
+  yyop_TEST, 1, 3745,
+  yyop_SAVE, 0,
+  yyop_CALL, 14909, 3745,
+  yyop_CHAR, 34, 3743,
+  yyop_BEGIN, 3743,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 34, 3701,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 3699,
+  yyop_JUMP, 3727,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 10, 3708,
+  yyop_JUMP, 3727,
+  yyop_RESTORE, 3,
+  yyop_TEST, 35, 3729,
+  yyop_PREDICATE, 5, 3729,
+  yyop_CHAR, 34, 3729,
+  yyop_SPAN, 4,
+  yyop_CLASS, 7, 3729,
+  yyop_SPAN, 7,
+  yyop_CHAR, 61, 3729,
+  yyop_JUMP, 3735,
+  yyop_RESTORE, 2,
+  yyop_DOT, 3735,
+  yyop_JUMP, 3683,
+  yyop_RESTORE, 1,
+  yyop_END, 3743,
+  yyop_CHAR, 34, 3743,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3746: RefTitleSingle */
+  yyop_ENTER, 269, 4,
+  yyop_TEST, 36, 3824,
+  yyop_SAVE, 0,
+  yyop_CALL, 14909, 3824,
+  yyop_CHAR, 39, 3822,
+  yyop_BEGIN, 3822,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 39, 3780,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 3778,
+  yyop_JUMP, 3806,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 10, 3787,
+  yyop_JUMP, 3806,
+  yyop_RESTORE, 3,
+  yyop_TEST, 24, 3808,
+  yyop_PREDICATE, 6, 3808,
+  yyop_CHAR, 39, 3808,
+  yyop_SPAN, 4,
+  yyop_CLASS, 7, 3808,
+  yyop_SPAN, 7,
+  yyop_CHAR, 61, 3808,
+  yyop_JUMP, 3814,
+  yyop_RESTORE, 2,
+  yyop_DOT, 3814,
+  yyop_JUMP, 3762,
+  yyop_RESTORE, 1,
+  yyop_END, 3822,
+  yyop_CHAR, 39, 3822,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3825: UnQuotedValue */
+  yyop_ENTER, 268, 1,
+  yyop_TEST, 37, 3845,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 3845,
+  yyop_CLASS, 37, 3845,
+  yyop_SPAN, 37,
+  yyop_END, 3843,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3846: QuotedValue */
+  yyop_ENTER, 267, 1,
+  yyop_SAVE, 0,
+  yyop_CHAR, 34, 3866,
+  yyop_BEGIN, 3864,
+  yyop_SPAN, 30,
+  yyop_END, 3864,
+  yyop_CHAR, 34, 3864,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3867: AttrValue */
+  yyop_ENTER, 266, 2,
+  yyop_TEST, 38, 3900,
+  yyop_SAVE, 0,
+  yyop_TEST, 35, 3887,
+  yyop_SAVE, 1,
+  yyop_CALL, 3846, 3887,
+  yyop_JUMP, 3895,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 37, 3898,
+  yyop_CALL, 3825, 3898,
+  yyop_ACTION, 105,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3901: AttrKey */
+  yyop_ENTER, 265, 1,
+  yyop_TEST, 7, 3923,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 3923,
+  yyop_CLASS, 7, 3923,
+  yyop_SPAN, 7,
+  yyop_END, 3921,
+  yyop_ACTION, 106,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3924: Attribute */
+  yyop_ENTER, 264, 1,
+  yyop_TEST, 39, 3957,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_CALL, 14909, 3955,
+  yyop_CALL, 3901, 3955,
+  yyop_SET, 2,
+  yyop_CHAR, 61, 3955,
+  yyop_CALL, 3867, 3955,
+  yyop_SET, 1,
+  yyop_ACTION, 107,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 3958: Attributes */
+  yyop_ENTER, 263, 2,
+  yyop_TEST, 39, 4004,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 4002,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_CALL, 3924, 4002,
+  yyop_ACTION, 109,
+  yyop_TEST, 39, 3997,
+  yyop_SAVE, 1,
+  yyop_CALL, 3924, 3997,
+  yyop_ACTION, 109,
+  yyop_JUMP, 3983,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 108,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4005: RefTitle */
+  yyop_ENTER, 262, 2,
+  yyop_SAVE, 0,
+  yyop_TEST, 36, 4022,
+  yyop_SAVE, 1,
+  yyop_CALL, 3746, 4022,
+  yyop_JUMP, 4048,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 1, 4034,
+  yyop_CALL, 3667, 4034,
+  yyop_JUMP, 4048,
+  yyop_RESTORE, 1,
+  yyop_TEST, 33, 4044,
+  yyop_CALL, 3588, 4044,
+  yyop_JUMP, 4048,
+  yyop_RESTORE, 1,
+  yyop_BEGIN, 4051,
+  yyop_END, 4051,
+  yyop_ACTION, 101,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4054: RefSrc */
+  yyop_ENTER, 261, 1,
+  yyop_TEST, 40, 4076,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 4076,
+  yyop_CLASS, 40, 4076,
+  yyop_SPAN, 40,
+  yyop_END, 4074,
+  yyop_ACTION, 102,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4077: AutoLinkEmail */
+  yyop_ENTER, 260, 3,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 4161,
+  yyop_SAVE, 1,
+  yyop_STRING, 50, 7, 4095,
+  yyop_JUMP, 4095,
+  yyop_RESTORE, 1,
+  yyop_BEGIN, 4159,
+  yyop_CLASS, 41, 4159,
+  yyop_SPAN, 41,
+  yyop_CHAR, 64, 4159,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 4114,
+  yyop_JUMP, 4159,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 62, 4123,
+  yyop_JUMP, 4159,
+  yyop_RESTORE, 1,
+  yyop_DOT, 4159,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 10, 4136,
+  yyop_JUMP, 4149,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 62, 4145,
+  yyop_JUMP, 4149,
+  yyop_RESTORE, 2,
+  yyop_DOT, 4149,
+  yyop_JUMP, 4125,
+  yyop_RESTORE, 1,
+  yyop_END, 4159,
+  yyop_CHAR, 62, 4159,
+  yyop_ACTION, 112,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4162: AutoLinkUrl */
+  yyop_ENTER, 259, 3,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 4237,
+  yyop_BEGIN, 4235,
+  yyop_CLASS, 42, 4235,
+  yyop_SPAN, 42,
+  yyop_STRING, 57, 3, 4235,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 4190,
+  yyop_JUMP, 4235,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 62, 4199,
+  yyop_JUMP, 4235,
+  yyop_RESTORE, 1,
+  yyop_DOT, 4235,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 10, 4212,
+  yyop_JUMP, 4225,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 62, 4221,
+  yyop_JUMP, 4225,
+  yyop_RESTORE, 2,
+  yyop_DOT, 4225,
+  yyop_JUMP, 4201,
+  yyop_RESTORE, 1,
+  yyop_END, 4235,
+  yyop_CHAR, 62, 4235,
+  yyop_ACTION, 113,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4238: TitleDouble */
+  yyop_ENTER, 258, 3,
+  yyop_SAVE, 0,
+  yyop_CHAR, 34, 4278,
+  yyop_BEGIN, 4276,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 34, 4264,
+  yyop_SPAN, 4,
+  yyop_CLASS, 43, 4262,
+  yyop_JUMP, 4268,
+  yyop_RESTORE, 2,
+  yyop_DOT, 4268,
+  yyop_JUMP, 4248,
+  yyop_RESTORE, 1,
+  yyop_END, 4276,
+  yyop_CHAR, 34, 4276,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4279: TitleSingle */
+  yyop_ENTER, 257, 3,
+  yyop_SAVE, 0,
+  yyop_CHAR, 39, 4319,
+  yyop_BEGIN, 4317,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 39, 4305,
+  yyop_SPAN, 4,
+  yyop_CLASS, 43, 4303,
+  yyop_JUMP, 4309,
+  yyop_RESTORE, 2,
+  yyop_DOT, 4309,
+  yyop_JUMP, 4289,
+  yyop_RESTORE, 1,
+  yyop_END, 4317,
+  yyop_CHAR, 39, 4317,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4320: Nonspacechar */
+  yyop_ENTER, 256, 1,
+  yyop_SAVE, 0,
+  yyop_CLASS, 40, 4331,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4332: SourceContents */
+  yyop_ENTER, 255, 6,
+  yyop_SAVE, 0,
+  yyop_TEST, 40, 4533,
+  yyop_SAVE, 1,
+  yyop_TEST, 40, 4420,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 40, 4356,
+  yyop_JUMP, 4418,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CHAR, 41, 4365,
+  yyop_JUMP, 4418,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CHAR, 62, 4374,
+  yyop_JUMP, 4418,
+  yyop_RESTORE, 3,
+  yyop_CLASS, 40, 4418,
+  yyop_TEST, 40, 4416,
+  yyop_SAVE, 3,
+  yyop_SAVE, 4,
+  yyop_CHAR, 40, 4391,
+  yyop_JUMP, 4414,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 4,
+  yyop_CHAR, 41, 4400,
+  yyop_JUMP, 4414,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 4,
+  yyop_CHAR, 62, 4409,
+  yyop_JUMP, 4414,
+  yyop_RESTORE, 4,
+  yyop_CLASS, 40, 4414,
+  yyop_JUMP, 4377,
+  yyop_RESTORE, 3,
+  yyop_JUMP, 4431,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 40, 4531,
+  yyop_CALL, 4332, 4531,
+  yyop_CHAR, 41, 4531,
+  yyop_TEST, 40, 4529,
+  yyop_SAVE, 2,
+  yyop_TEST, 40, 4514,
+  yyop_SAVE, 3,
+  yyop_SAVE, 4,
+  yyop_CHAR, 40, 4450,
+  yyop_JUMP, 4512,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 4,
+  yyop_CHAR, 41, 4459,
+  yyop_JUMP, 4512,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 4,
+  yyop_CHAR, 62, 4468,
+  yyop_JUMP, 4512,
+  yyop_RESTORE, 4,
+  yyop_CLASS, 40, 4512,
+  yyop_TEST, 40, 4510,
+  yyop_SAVE, 4,
+  yyop_SAVE, 5,
+  yyop_CHAR, 40, 4485,
+  yyop_JUMP, 4508,
+  yyop_RESTORE, 5,
+  yyop_SAVE, 5,
+  yyop_CHAR, 41, 4494,
+  yyop_JUMP, 4508,
+  yyop_RESTORE, 5,
+  yyop_SAVE, 5,
+  yyop_CHAR, 62, 4503,
+  yyop_JUMP, 4508,
+  yyop_RESTORE, 5,
+  yyop_CLASS, 40, 4508,
+  yyop_JUMP, 4471,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 4525,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CHAR, 40, 4527,
+  yyop_CALL, 4332, 4527,
+  yyop_CHAR, 41, 4527,
+  yyop_JUMP, 4431,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 4535,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4539: Title */
+  yyop_ENTER, 254, 2,
+  yyop_SAVE, 0,
+  yyop_TEST, 24, 4556,
+  yyop_SAVE, 1,
+  yyop_CALL, 4279, 4556,
+  yyop_JUMP, 4572,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 35, 4568,
+  yyop_CALL, 4238, 4568,
+  yyop_JUMP, 4572,
+  yyop_RESTORE, 1,
+  yyop_BEGIN, 4575,
+  yyop_END, 4575,
+  yyop_ACTION, 114,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4578: Source */
+  yyop_ENTER, 253, 2,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CHAR, 60, 4602,
+  yyop_BEGIN, 4600,
+  yyop_CALL, 4332, 4600,
+  yyop_END, 4600,
+  yyop_CHAR, 62, 4600,
+  yyop_JUMP, 4609,
+  yyop_RESTORE, 1,
+  yyop_BEGIN, 4612,
+  yyop_CALL, 4332, 4612,
+  yyop_END, 4612,
+  yyop_ACTION, 115,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4615: Label */
+  yyop_ENTER, 252, 3,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_CHAR, 91, 4708,
+  yyop_SAVE, 1,
+  yyop_CHAR, 91, 4634,
+  yyop_JUMP, 4708,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 94, 4645,
+  yyop_JUMP, 4659,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 35, 4654,
+  yyop_JUMP, 4659,
+  yyop_RESTORE, 2,
+  yyop_PREDICATE, 7, 4659,
+  yyop_JUMP, 4670,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 2,
+  yyop_DOT, 4708,
+  yyop_RESTORE, 2,
+  yyop_PREDICATE, 8, 4708,
+  yyop_SAVE, 1,
+  yyop_DOT, 4708,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 93, 4691,
+  yyop_JUMP, 4698,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 4698,
+  yyop_ACTION, 104,
+  yyop_JUMP, 4680,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 93, 4708,
+  yyop_ACTION, 103,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4711: ReferenceLinkSingle */
+  yyop_ENTER, 251, 2,
+  yyop_TEST, 19, 4753,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_CALL, 4615, 4751,
+  yyop_SET, 1,
+  yyop_BEGIN, 4751,
+  yyop_TEST, 20, 4744,
+  yyop_SAVE, 1,
+  yyop_CALL, 14909, 4744,
+  yyop_STRING, 26, 2, 4742,
+  yyop_JUMP, 4744,
+  yyop_RESTORE, 1,
+  yyop_END, 4751,
+  yyop_ACTION, 117,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4754: ReferenceLinkDouble */
+  yyop_ENTER, 250, 2,
+  yyop_TEST, 19, 4798,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_CALL, 4615, 4796,
+  yyop_SET, 2,
+  yyop_BEGIN, 4796,
+  yyop_CALL, 14909, 4796,
+  yyop_END, 4796,
+  yyop_SAVE, 1,
+  yyop_STRING, 26, 2, 4786,
+  yyop_JUMP, 4796,
+  yyop_RESTORE, 1,
+  yyop_CALL, 4615, 4796,
+  yyop_SET, 1,
+  yyop_ACTION, 118,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4799: AutoLink */
+  yyop_ENTER, 249, 2,
+  yyop_TEST, 44, 4830,
+  yyop_SAVE, 0,
+  yyop_TEST, 44, 4819,
+  yyop_SAVE, 1,
+  yyop_CALL, 4162, 4819,
+  yyop_JUMP, 4827,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 4828,
+  yyop_CALL, 4077, 4828,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4831: ReferenceLink */
+  yyop_ENTER, 248, 2,
+  yyop_TEST, 19, 4862,
+  yyop_SAVE, 0,
+  yyop_TEST, 19, 4851,
+  yyop_SAVE, 1,
+  yyop_CALL, 4754, 4851,
+  yyop_JUMP, 4859,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 19, 4860,
+  yyop_CALL, 4711, 4860,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4863: ExplicitLink */
+  yyop_ENTER, 247, 1,
+  yyop_TEST, 19, 4911,
+  yyop_SAVE, 0,
+  yyop_PUSH, 3,
+  yyop_CALL, 4615, 4909,
+  yyop_SET, 3,
+  yyop_CALL, 14909, 4909,
+  yyop_CHAR, 40, 4909,
+  yyop_SPAN, 4,
+  yyop_CALL, 4578, 4909,
+  yyop_SET, 2,
+  yyop_CALL, 14909, 4909,
+  yyop_CALL, 4539, 4909,
+  yyop_SET, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 41, 4909,
+  yyop_ACTION, 116,
+  yyop_POP, 3,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4912: TwoUlClose */
+  yyop_ENTER, 246, 2,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_CLASS, 4, 4928,
+  yyop_JUMP, 4960,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 4937,
+  yyop_JUMP, 4960,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16698, 4960,
+  yyop_SET, 1,
+  yyop_STRING, 60, 2, 4960,
+  yyop_SAVE, 1,
+  yyop_CLASS, 13, 4955,
+  yyop_JUMP, 4960,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 124,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 4963: TwoUlOpen */
+  yyop_ENTER, 245, 2,
+  yyop_TEST, 12, 5005,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 5545, 4980,
+  yyop_JUMP, 5003,
+  yyop_RESTORE, 1,
+  yyop_STRING, 60, 2, 5003,
+  yyop_SAVE, 1,
+  yyop_CLASS, 4, 4993,
+  yyop_JUMP, 5003,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 5002,
+  yyop_JUMP, 5003,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5006: TwoStarClose */
+  yyop_ENTER, 244, 2,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_CLASS, 4, 5022,
+  yyop_JUMP, 5045,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 5031,
+  yyop_JUMP, 5045,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16698, 5045,
+  yyop_SET, 1,
+  yyop_STRING, 62, 2, 5045,
+  yyop_ACTION, 128,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5048: TwoStarOpen */
+  yyop_ENTER, 243, 2,
+  yyop_TEST, 45, 5090,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 5490, 5065,
+  yyop_JUMP, 5088,
+  yyop_RESTORE, 1,
+  yyop_STRING, 62, 2, 5088,
+  yyop_SAVE, 1,
+  yyop_CLASS, 4, 5078,
+  yyop_JUMP, 5088,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 5087,
+  yyop_JUMP, 5088,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5091: StrongUl */
+  yyop_ENTER, 242, 3,
+  yyop_TEST, 12, 5146,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_CALL, 4963, 5144,
+  yyop_SAVE, 1,
+  yyop_DOT, 5144,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CALL, 4912, 5125,
+  yyop_JUMP, 5132,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 5132,
+  yyop_ACTION, 123,
+  yyop_JUMP, 5114,
+  yyop_RESTORE, 1,
+  yyop_CALL, 4912, 5144,
+  yyop_ACTION, 122,
+  yyop_ACTION, 121,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5147: StrongStar */
+  yyop_ENTER, 241, 3,
+  yyop_TEST, 45, 5202,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_CALL, 5048, 5200,
+  yyop_SAVE, 1,
+  yyop_DOT, 5200,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CALL, 5006, 5181,
+  yyop_JUMP, 5188,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 5188,
+  yyop_ACTION, 127,
+  yyop_JUMP, 5170,
+  yyop_RESTORE, 1,
+  yyop_CALL, 5006, 5200,
+  yyop_ACTION, 126,
+  yyop_ACTION, 125,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5203: OneUlClose */
+  yyop_ENTER, 240, 2,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_CLASS, 4, 5219,
+  yyop_JUMP, 5250,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 5228,
+  yyop_JUMP, 5250,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16698, 5250,
+  yyop_SET, 1,
+  yyop_CHAR, 95, 5250,
+  yyop_SAVE, 1,
+  yyop_CLASS, 13, 5245,
+  yyop_JUMP, 5250,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 132,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5253: OneUlOpen */
+  yyop_ENTER, 239, 2,
+  yyop_TEST, 12, 5294,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 5545, 5270,
+  yyop_JUMP, 5292,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 95, 5292,
+  yyop_SAVE, 1,
+  yyop_CLASS, 4, 5282,
+  yyop_JUMP, 5292,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 5291,
+  yyop_JUMP, 5292,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5295: OneStarClose */
+  yyop_ENTER, 238, 2,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_CLASS, 4, 5311,
+  yyop_JUMP, 5333,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 5320,
+  yyop_JUMP, 5333,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16698, 5333,
+  yyop_SET, 1,
+  yyop_CHAR, 42, 5333,
+  yyop_ACTION, 136,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5336: OneStarOpen */
+  yyop_ENTER, 237, 2,
+  yyop_TEST, 45, 5377,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 5490, 5353,
+  yyop_JUMP, 5375,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 42, 5375,
+  yyop_SAVE, 1,
+  yyop_CLASS, 4, 5365,
+  yyop_JUMP, 5375,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 5374,
+  yyop_JUMP, 5375,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5378: EmphUl */
+  yyop_ENTER, 236, 3,
+  yyop_TEST, 12, 5433,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_CALL, 5253, 5431,
+  yyop_SAVE, 1,
+  yyop_DOT, 5431,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CALL, 5203, 5412,
+  yyop_JUMP, 5419,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 5419,
+  yyop_ACTION, 131,
+  yyop_JUMP, 5401,
+  yyop_RESTORE, 1,
+  yyop_CALL, 5203, 5431,
+  yyop_ACTION, 130,
+  yyop_ACTION, 129,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5434: EmphStar */
+  yyop_ENTER, 235, 3,
+  yyop_TEST, 45, 5489,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_CALL, 5336, 5487,
+  yyop_SAVE, 1,
+  yyop_DOT, 5487,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CALL, 5295, 5468,
+  yyop_JUMP, 5475,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 5475,
+  yyop_ACTION, 135,
+  yyop_JUMP, 5457,
+  yyop_RESTORE, 1,
+  yyop_CALL, 5295, 5487,
+  yyop_ACTION, 134,
+  yyop_ACTION, 133,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5490: StarLine */
+  yyop_ENTER, 234, 3,
+  yyop_TEST, 46, 5544,
+  yyop_SAVE, 0,
+  yyop_TEST, 45, 5517,
+  yyop_SAVE, 1,
+  yyop_BEGIN, 5517,
+  yyop_STRING, 64, 4, 5517,
+  yyop_SPAN, 45,
+  yyop_END, 5515,
+  yyop_JUMP, 5541,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 4, 5542,
+  yyop_BEGIN, 5542,
+  yyop_CLASS, 4, 5542,
+  yyop_CHAR, 42, 5542,
+  yyop_SPAN, 45,
+  yyop_SAVE, 2,
+  yyop_CLASS, 4, 5542,
+  yyop_RESTORE, 2,
+  yyop_END, 5542,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5545: UlLine */
+  yyop_ENTER, 233, 3,
+  yyop_TEST, 47, 5599,
+  yyop_SAVE, 0,
+  yyop_TEST, 12, 5572,
+  yyop_SAVE, 1,
+  yyop_BEGIN, 5572,
+  yyop_STRING, 68, 4, 5572,
+  yyop_SPAN, 12,
+  yyop_END, 5570,
+  yyop_JUMP, 5596,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 4, 5597,
+  yyop_BEGIN, 5597,
+  yyop_CLASS, 4, 5597,
+  yyop_CHAR, 95, 5597,
+  yyop_SPAN, 12,
+  yyop_SAVE, 2,
+  yyop_CLASS, 4, 5597,
+  yyop_RESTORE, 2,
+  yyop_END, 5597,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5600: SpecialChar */
+  yyop_ENTER, 232, 2,
+  yyop_TEST, 48, 5717,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CHAR, 42, 5617,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 95, 5624,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 96, 5631,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 38, 5638,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 91, 5645,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 93, 5652,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 40, 5659,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 41, 5666,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 60, 5673,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 33, 5680,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 35, 5687,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 92, 5694,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 39, 5701,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 34, 5708,
+  yyop_JUMP, 5714,
+  yyop_RESTORE, 1,
+  yyop_TEST, 27, 5715,
+  yyop_CALL, 3283, 5715,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5718: Eof */
+  yyop_ENTER, 231, 2,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_DOT, 5731,
+  yyop_JUMP, 5732,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5735: NormalEndline */
+  yyop_ENTER, 230, 3,
+  yyop_TEST, 6, 5814,
+  yyop_SAVE, 0,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 5812,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 5757,
+  yyop_JUMP, 5812,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 62, 5768,
+  yyop_JUMP, 5812,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 16635, 5777,
+  yyop_JUMP, 5812,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 18952, 5809,
+  yyop_ACTION, 95,
+  yyop_SAVE, 2,
+  yyop_STRING, 72, 3, 5796,
+  yyop_SPAN, 49,
+  yyop_JUMP, 5802,
+  yyop_RESTORE, 2,
+  yyop_STRING, 32, 3, 5807,
+  yyop_SPAN, 8,
+  yyop_CHAR, 10, 5807,
+  yyop_JUMP, 5812,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 141,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5815: TerminalEndline */
+  yyop_ENTER, 229, 2,
+  yyop_TEST, 6, 5841,
+  yyop_SAVE, 0,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 5839,
+  yyop_SAVE, 1,
+  yyop_DOT, 5836,
+  yyop_JUMP, 5839,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 140,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5842: LineBreak */
+  yyop_ENTER, 228, 1,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_STRING, 20, 2, 5863,
+  yyop_CALL, 5735, 5863,
+  yyop_SET, 1,
+  yyop_ACTION, 139,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5866: CharEntity */
+  yyop_ENTER, 227, 1,
+  yyop_TEST, 50, 5892,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 5892,
+  yyop_CHAR, 38, 5892,
+  yyop_CLASS, 7, 5890,
+  yyop_SPAN, 7,
+  yyop_CHAR, 59, 5890,
+  yyop_END, 5890,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5893: DecEntity */
+  yyop_ENTER, 226, 1,
+  yyop_TEST, 50, 5922,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 5922,
+  yyop_STRING, 75, 2, 5922,
+  yyop_CLASS, 23, 5920,
+  yyop_SPAN, 23,
+  yyop_END, 5920,
+  yyop_CHAR, 59, 5920,
+  yyop_END, 5920,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5923: HexEntity */
+  yyop_ENTER, 225, 1,
+  yyop_TEST, 50, 5953,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 5953,
+  yyop_STRING, 75, 2, 5953,
+  yyop_CLASS, 51, 5951,
+  yyop_CLASS, 52, 5951,
+  yyop_SPAN, 52,
+  yyop_CHAR, 59, 5951,
+  yyop_END, 5951,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5954: AposChunk */
+  yyop_ENTER, 224, 2,
+  yyop_TEST, 24, 5980,
+  yyop_SAVE, 0,
+  yyop_PREDICATE, 9, 5980,
+  yyop_CHAR, 39, 5980,
+  yyop_SAVE, 1,
+  yyop_CLASS, 13, 5978,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 144,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5981: Alphanumeric */
+  yyop_ENTER, 223, 1,
+  yyop_SAVE, 0,
+  yyop_CLASS, 13, 5992,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 5993: StrChunk */
+  yyop_ENTER, 222, 5,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_BEGIN, 6064,
+  yyop_SAVE, 2,
+  yyop_CALL, 6074, 6011,
+  yyop_JUMP, 6026,
+  yyop_RESTORE, 2,
+  yyop_TEST, 12, 6062,
+  yyop_CHAR, 95, 6062,
+  yyop_SPAN, 12,
+  yyop_SAVE, 3,
+  yyop_CLASS, 13, 6062,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 6074, 6037,
+  yyop_JUMP, 6052,
+  yyop_RESTORE, 3,
+  yyop_TEST, 12, 6054,
+  yyop_CHAR, 95, 6054,
+  yyop_SPAN, 12,
+  yyop_SAVE, 4,
+  yyop_CLASS, 13, 6054,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 6026,
+  yyop_RESTORE, 2,
+  yyop_END, 6062,
+  yyop_ACTION, 145,
+  yyop_JUMP, 6070,
+  yyop_RESTORE, 1,
+  yyop_TEST, 24, 6071,
+  yyop_CALL, 5954, 6071,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 6074: NormalChar */
+  yyop_ENTER, 221, 3,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_TEST, 48, 6093,
+  yyop_SAVE, 2,
+  yyop_CALL, 5600, 6093,
+  yyop_JUMP, 6105,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CLASS, 4, 6102,
+  yyop_JUMP, 6105,
+  yyop_RESTORE, 2,
+  yyop_CHAR, 10, 6107,
+  yyop_JUMP, 6112,
+  yyop_RESTORE, 1,
+  yyop_DOT, 6112,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 6115: Symbol */
+  yyop_ENTER, 220, 1,
+  yyop_TEST, 48, 6135,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 6135,
+  yyop_CALL, 5600, 6135,
+  yyop_END, 6133,
+  yyop_ACTION, 138,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 6136: Smart */
+  yyop_ENTER, 219, 3,
+  yyop_TEST, 28, 6219,
+  yyop_SAVE, 0,
+  yyop_PREDICATE, 10, 6219,
+  yyop_TEST, 25, 6159,
+  yyop_SAVE, 1,
+  yyop_CALL, 3231, 6159,
+  yyop_JUMP, 6216,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 8, 6188,
+  yyop_TEST, 8, 6176,
+  yyop_SAVE, 2,
+  yyop_CALL, 2995, 6176,
+  yyop_JUMP, 6184,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 8, 6186,
+  yyop_CALL, 2957, 6186,
+  yyop_JUMP, 6216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 24, 6198,
+  yyop_CALL, 3100, 6198,
+  yyop_JUMP, 6216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 35, 6208,
+  yyop_CALL, 3031, 6208,
+  yyop_JUMP, 6216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 24, 6217,
+  yyop_CHAR, 39, 6217,
+  yyop_ACTION, 93,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 6220: EscapedChar */
+  yyop_ENTER, 218, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 92, 6249,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 6237,
+  yyop_JUMP, 6247,
+  yyop_RESTORE, 1,
+  yyop_BEGIN, 6247,
+  yyop_CLASS, 53, 6247,
+  yyop_END, 6247,
+  yyop_ACTION, 143,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 6250: Entity */
+  yyop_ENTER, 217, 2,
+  yyop_TEST, 50, 6293,
+  yyop_SAVE, 0,
+  yyop_TEST, 50, 6270,
+  yyop_SAVE, 1,
+  yyop_CALL, 5923, 6270,
+  yyop_JUMP, 6288,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 50, 6282,
+  yyop_CALL, 5893, 6282,
+  yyop_JUMP, 6288,
+  yyop_RESTORE, 1,
+  yyop_TEST, 50, 6291,
+  yyop_CALL, 5866, 6291,
+  yyop_ACTION, 142,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 6294: RawHtml */
+  yyop_ENTER, 216, 2,
+  yyop_TEST, 44, 6341,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 6341,
+  yyop_TEST, 44, 6316,
+  yyop_SAVE, 1,
+  yyop_CALL, 8657, 6316,
+  yyop_JUMP, 6334,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 6328,
+  yyop_CALL, 9220, 6328,
+  yyop_JUMP, 6334,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 6339,
+  yyop_CALL, 3355, 6339,
+  yyop_END, 6339,
+  yyop_ACTION, 97,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 6342: Code */
+  yyop_ENTER, 215, 6,
+  yyop_TEST, 54, 7524,
+  yyop_SAVE, 0,
+  yyop_TEST, 54, 6581,
+  yyop_SAVE, 1,
+  yyop_CHAR, 96, 6581,
+  yyop_SAVE, 2,
+  yyop_CHAR, 96, 6367,
+  yyop_JUMP, 6579,
+  yyop_RESTORE, 2,
+  yyop_SPAN, 4,
+  yyop_BEGIN, 6579,
+  yyop_TEST, 40, 6385,
+  yyop_SAVE, 2,
+  yyop_CLASS, 55, 6385,
+  yyop_SPAN, 55,
+  yyop_JUMP, 6463,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 54, 6417,
+  yyop_SAVE, 3,
+  yyop_CHAR, 96, 6408,
+  yyop_SAVE, 4,
+  yyop_CHAR, 96, 6404,
+  yyop_JUMP, 6406,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 6415,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 96, 6415,
+  yyop_SPAN, 54,
+  yyop_JUMP, 6463,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 6579,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_CHAR, 96, 6438,
+  yyop_SAVE, 4,
+  yyop_CHAR, 96, 6436,
+  yyop_JUMP, 6438,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 6579,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CLASS, 4, 6449,
+  yyop_JUMP, 6463,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 10, 6579,
+  yyop_SAVE, 4,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 6461,
+  yyop_JUMP, 6579,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 2,
+  yyop_TEST, 40, 6479,
+  yyop_SAVE, 3,
+  yyop_CLASS, 55, 6479,
+  yyop_SPAN, 55,
+  yyop_JUMP, 6557,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 54, 6511,
+  yyop_SAVE, 4,
+  yyop_CHAR, 96, 6502,
+  yyop_SAVE, 5,
+  yyop_CHAR, 96, 6498,
+  yyop_JUMP, 6500,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 6509,
+  yyop_RESTORE, 4,
+  yyop_CHAR, 96, 6509,
+  yyop_SPAN, 54,
+  yyop_JUMP, 6557,
+  yyop_RESTORE, 3,
+  yyop_TEST, 6, 6559,
+  yyop_SAVE, 4,
+  yyop_SPAN, 4,
+  yyop_CHAR, 96, 6532,
+  yyop_SAVE, 5,
+  yyop_CHAR, 96, 6530,
+  yyop_JUMP, 6532,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 6559,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 4,
+  yyop_CLASS, 4, 6543,
+  yyop_JUMP, 6557,
+  yyop_RESTORE, 4,
+  yyop_CHAR, 10, 6559,
+  yyop_SAVE, 5,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 6555,
+  yyop_JUMP, 6559,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 6463,
+  yyop_RESTORE, 2,
+  yyop_END, 6579,
+  yyop_SPAN, 4,
+  yyop_CHAR, 96, 6579,
+  yyop_SAVE, 2,
+  yyop_CHAR, 96, 6577,
+  yyop_JUMP, 6579,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 7519,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 54, 6818,
+  yyop_STRING, 45, 2, 6818,
+  yyop_SAVE, 2,
+  yyop_CHAR, 96, 6599,
+  yyop_JUMP, 6816,
+  yyop_RESTORE, 2,
+  yyop_SPAN, 4,
+  yyop_BEGIN, 6816,
+  yyop_TEST, 40, 6617,
+  yyop_SAVE, 2,
+  yyop_CLASS, 55, 6617,
+  yyop_SPAN, 55,
+  yyop_JUMP, 6697,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 54, 6650,
+  yyop_SAVE, 3,
+  yyop_STRING, 45, 2, 6641,
+  yyop_SAVE, 4,
+  yyop_CHAR, 96, 6637,
+  yyop_JUMP, 6639,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 6648,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 96, 6648,
+  yyop_SPAN, 54,
+  yyop_JUMP, 6697,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 6816,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 2, 6672,
+  yyop_SAVE, 4,
+  yyop_CHAR, 96, 6670,
+  yyop_JUMP, 6672,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 6816,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CLASS, 4, 6683,
+  yyop_JUMP, 6697,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 10, 6816,
+  yyop_SAVE, 4,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 6695,
+  yyop_JUMP, 6816,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 2,
+  yyop_TEST, 40, 6713,
+  yyop_SAVE, 3,
+  yyop_CLASS, 55, 6713,
+  yyop_SPAN, 55,
+  yyop_JUMP, 6793,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 54, 6746,
+  yyop_SAVE, 4,
+  yyop_STRING, 45, 2, 6737,
+  yyop_SAVE, 5,
+  yyop_CHAR, 96, 6733,
+  yyop_JUMP, 6735,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 6744,
+  yyop_RESTORE, 4,
+  yyop_CHAR, 96, 6744,
+  yyop_SPAN, 54,
+  yyop_JUMP, 6793,
+  yyop_RESTORE, 3,
+  yyop_TEST, 6, 6795,
+  yyop_SAVE, 4,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 2, 6768,
+  yyop_SAVE, 5,
+  yyop_CHAR, 96, 6766,
+  yyop_JUMP, 6768,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 6795,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 4,
+  yyop_CLASS, 4, 6779,
+  yyop_JUMP, 6793,
+  yyop_RESTORE, 4,
+  yyop_CHAR, 10, 6795,
+  yyop_SAVE, 5,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 6791,
+  yyop_JUMP, 6795,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 6697,
+  yyop_RESTORE, 2,
+  yyop_END, 6816,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 2, 6816,
+  yyop_SAVE, 2,
+  yyop_CHAR, 96, 6814,
+  yyop_JUMP, 6816,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 7519,
+  yyop_RESTORE, 1,
+  yyop_TEST, 54, 7053,
+  yyop_STRING, 45, 3, 7053,
+  yyop_SAVE, 2,
+  yyop_CHAR, 96, 6834,
+  yyop_JUMP, 7051,
+  yyop_RESTORE, 2,
+  yyop_SPAN, 4,
+  yyop_BEGIN, 7051,
+  yyop_TEST, 40, 6852,
+  yyop_SAVE, 2,
+  yyop_CLASS, 55, 6852,
+  yyop_SPAN, 55,
+  yyop_JUMP, 6932,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 54, 6885,
+  yyop_SAVE, 3,
+  yyop_STRING, 45, 3, 6876,
+  yyop_SAVE, 4,
+  yyop_CHAR, 96, 6872,
+  yyop_JUMP, 6874,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 6883,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 96, 6883,
+  yyop_SPAN, 54,
+  yyop_JUMP, 6932,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 7051,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 3, 6907,
+  yyop_SAVE, 4,
+  yyop_CHAR, 96, 6905,
+  yyop_JUMP, 6907,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 7051,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CLASS, 4, 6918,
+  yyop_JUMP, 6932,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 10, 7051,
+  yyop_SAVE, 4,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 6930,
+  yyop_JUMP, 7051,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 2,
+  yyop_TEST, 40, 6948,
+  yyop_SAVE, 3,
+  yyop_CLASS, 55, 6948,
+  yyop_SPAN, 55,
+  yyop_JUMP, 7028,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 54, 6981,
+  yyop_SAVE, 4,
+  yyop_STRING, 45, 3, 6972,
+  yyop_SAVE, 5,
+  yyop_CHAR, 96, 6968,
+  yyop_JUMP, 6970,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 6979,
+  yyop_RESTORE, 4,
+  yyop_CHAR, 96, 6979,
+  yyop_SPAN, 54,
+  yyop_JUMP, 7028,
+  yyop_RESTORE, 3,
+  yyop_TEST, 6, 7030,
+  yyop_SAVE, 4,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 3, 7003,
+  yyop_SAVE, 5,
+  yyop_CHAR, 96, 7001,
+  yyop_JUMP, 7003,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 7030,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 4,
+  yyop_CLASS, 4, 7014,
+  yyop_JUMP, 7028,
+  yyop_RESTORE, 4,
+  yyop_CHAR, 10, 7030,
+  yyop_SAVE, 5,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 7026,
+  yyop_JUMP, 7030,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 6932,
+  yyop_RESTORE, 2,
+  yyop_END, 7051,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 3, 7051,
+  yyop_SAVE, 2,
+  yyop_CHAR, 96, 7049,
+  yyop_JUMP, 7051,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 7519,
+  yyop_RESTORE, 1,
+  yyop_TEST, 54, 7288,
+  yyop_STRING, 45, 4, 7288,
+  yyop_SAVE, 2,
+  yyop_CHAR, 96, 7069,
+  yyop_JUMP, 7286,
+  yyop_RESTORE, 2,
+  yyop_SPAN, 4,
+  yyop_BEGIN, 7286,
+  yyop_TEST, 40, 7087,
+  yyop_SAVE, 2,
+  yyop_CLASS, 55, 7087,
+  yyop_SPAN, 55,
+  yyop_JUMP, 7167,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 54, 7120,
+  yyop_SAVE, 3,
+  yyop_STRING, 45, 4, 7111,
+  yyop_SAVE, 4,
+  yyop_CHAR, 96, 7107,
+  yyop_JUMP, 7109,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 7118,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 96, 7118,
+  yyop_SPAN, 54,
+  yyop_JUMP, 7167,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 7286,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 4, 7142,
+  yyop_SAVE, 4,
+  yyop_CHAR, 96, 7140,
+  yyop_JUMP, 7142,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 7286,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CLASS, 4, 7153,
+  yyop_JUMP, 7167,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 10, 7286,
+  yyop_SAVE, 4,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 7165,
+  yyop_JUMP, 7286,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 2,
+  yyop_TEST, 40, 7183,
+  yyop_SAVE, 3,
+  yyop_CLASS, 55, 7183,
+  yyop_SPAN, 55,
+  yyop_JUMP, 7263,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 54, 7216,
+  yyop_SAVE, 4,
+  yyop_STRING, 45, 4, 7207,
+  yyop_SAVE, 5,
+  yyop_CHAR, 96, 7203,
+  yyop_JUMP, 7205,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 7214,
+  yyop_RESTORE, 4,
+  yyop_CHAR, 96, 7214,
+  yyop_SPAN, 54,
+  yyop_JUMP, 7263,
+  yyop_RESTORE, 3,
+  yyop_TEST, 6, 7265,
+  yyop_SAVE, 4,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 4, 7238,
+  yyop_SAVE, 5,
+  yyop_CHAR, 96, 7236,
+  yyop_JUMP, 7238,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 7265,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 4,
+  yyop_CLASS, 4, 7249,
+  yyop_JUMP, 7263,
+  yyop_RESTORE, 4,
+  yyop_CHAR, 10, 7265,
+  yyop_SAVE, 5,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 7261,
+  yyop_JUMP, 7265,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 7167,
+  yyop_RESTORE, 2,
+  yyop_END, 7286,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 4, 7286,
+  yyop_SAVE, 2,
+  yyop_CHAR, 96, 7284,
+  yyop_JUMP, 7286,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 7519,
+  yyop_RESTORE, 1,
+  yyop_TEST, 54, 7522,
+  yyop_STRING, 45, 5, 7522,
+  yyop_SAVE, 2,
+  yyop_CHAR, 96, 7304,
+  yyop_JUMP, 7522,
+  yyop_RESTORE, 2,
+  yyop_SPAN, 4,
+  yyop_BEGIN, 7522,
+  yyop_TEST, 40, 7322,
+  yyop_SAVE, 2,
+  yyop_CLASS, 55, 7322,
+  yyop_SPAN, 55,
+  yyop_JUMP, 7402,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 54, 7355,
+  yyop_SAVE, 3,
+  yyop_STRING, 45, 5, 7346,
+  yyop_SAVE, 4,
+  yyop_CHAR, 96, 7342,
+  yyop_JUMP, 7344,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 7353,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 96, 7353,
+  yyop_SPAN, 54,
+  yyop_JUMP, 7402,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 7522,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 5, 7377,
+  yyop_SAVE, 4,
+  yyop_CHAR, 96, 7375,
+  yyop_JUMP, 7377,
+  yyop_RESTORE, 4,
+  yyop_JUMP, 7522,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CLASS, 4, 7388,
+  yyop_JUMP, 7402,
+  yyop_RESTORE, 3,
+  yyop_CHAR, 10, 7522,
+  yyop_SAVE, 4,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 7400,
+  yyop_JUMP, 7522,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 2,
+  yyop_TEST, 40, 7418,
+  yyop_SAVE, 3,
+  yyop_CLASS, 55, 7418,
+  yyop_SPAN, 55,
+  yyop_JUMP, 7498,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 54, 7451,
+  yyop_SAVE, 4,
+  yyop_STRING, 45, 5, 7442,
+  yyop_SAVE, 5,
+  yyop_CHAR, 96, 7438,
+  yyop_JUMP, 7440,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 7449,
+  yyop_RESTORE, 4,
+  yyop_CHAR, 96, 7449,
+  yyop_SPAN, 54,
+  yyop_JUMP, 7498,
+  yyop_RESTORE, 3,
+  yyop_TEST, 6, 7500,
+  yyop_SAVE, 4,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 5, 7473,
+  yyop_SAVE, 5,
+  yyop_CHAR, 96, 7471,
+  yyop_JUMP, 7473,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 7500,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 4,
+  yyop_CLASS, 4, 7484,
+  yyop_JUMP, 7498,
+  yyop_RESTORE, 4,
+  yyop_CHAR, 10, 7500,
+  yyop_SAVE, 5,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 7496,
+  yyop_JUMP, 7500,
+  yyop_RESTORE, 5,
+  yyop_JUMP, 7402,
+  yyop_RESTORE, 2,
+  yyop_END, 7522,
+  yyop_SPAN, 4,
+  yyop_STRING, 45, 5, 7522,
+  yyop_SAVE, 2,
+  yyop_CHAR, 96, 7519,
+  yyop_JUMP, 7522,
+  yyop_RESTORE, 2,
+  yyop_ACTION, 98,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7525: NoteReference */
+  yyop_ENTER, 214, 1,
+  yyop_TEST, 19, 7550,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_PREDICATE, 11, 7548,
+  yyop_CALL, 2810, 7548,
+  yyop_SET, 1,
+  yyop_ACTION, 85,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7551: Link */
+  yyop_ENTER, 213, 3,
+  yyop_TEST, 56, 7626,
+  yyop_SAVE, 0,
+  yyop_TEST, 19, 7571,
+  yyop_SAVE, 1,
+  yyop_CALL, 4863, 7571,
+  yyop_JUMP, 7623,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 19, 7600,
+  yyop_TEST, 19, 7588,
+  yyop_SAVE, 2,
+  yyop_CALL, 4754, 7588,
+  yyop_JUMP, 7596,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 19, 7598,
+  yyop_CALL, 4711, 7598,
+  yyop_JUMP, 7623,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 7624,
+  yyop_TEST, 44, 7615,
+  yyop_SAVE, 2,
+  yyop_CALL, 4162, 7615,
+  yyop_JUMP, 7623,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 44, 7624,
+  yyop_CALL, 4077, 7624,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7627: Image */
+  yyop_ENTER, 212, 3,
+  yyop_SAVE, 0,
+  yyop_CHAR, 33, 7677,
+  yyop_TEST, 19, 7647,
+  yyop_SAVE, 1,
+  yyop_CALL, 4863, 7647,
+  yyop_JUMP, 7672,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 19, 7675,
+  yyop_TEST, 19, 7664,
+  yyop_SAVE, 2,
+  yyop_CALL, 4754, 7664,
+  yyop_JUMP, 7672,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 19, 7675,
+  yyop_CALL, 4711, 7675,
+  yyop_ACTION, 119,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7678: CitationReference */
+  yyop_ENTER, 211, 2,
+  yyop_TEST, 19, 7709,
+  yyop_SAVE, 0,
+  yyop_TEST, 19, 7698,
+  yyop_SAVE, 1,
+  yyop_CALL, 2373, 7698,
+  yyop_JUMP, 7706,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 19, 7707,
+  yyop_CALL, 2309, 7707,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7710: Emph */
+  yyop_ENTER, 210, 2,
+  yyop_TEST, 57, 7741,
+  yyop_SAVE, 0,
+  yyop_TEST, 45, 7730,
+  yyop_SAVE, 1,
+  yyop_CALL, 5434, 7730,
+  yyop_JUMP, 7738,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 12, 7739,
+  yyop_CALL, 5378, 7739,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7742: Strong */
+  yyop_ENTER, 209, 2,
+  yyop_TEST, 57, 7773,
+  yyop_SAVE, 0,
+  yyop_TEST, 45, 7762,
+  yyop_SAVE, 1,
+  yyop_CALL, 5147, 7762,
+  yyop_JUMP, 7770,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 12, 7771,
+  yyop_CALL, 5091, 7771,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7774: Space */
+  yyop_ENTER, 208, 1,
+  yyop_TEST, 4, 7792,
+  yyop_SAVE, 0,
+  yyop_CLASS, 4, 7792,
+  yyop_SPAN, 4,
+  yyop_ACTION, 149,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7793: UlOrStarLine */
+  yyop_ENTER, 207, 2,
+  yyop_TEST, 58, 7826,
+  yyop_SAVE, 0,
+  yyop_TEST, 47, 7813,
+  yyop_SAVE, 1,
+  yyop_CALL, 5545, 7813,
+  yyop_JUMP, 7821,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 46, 7824,
+  yyop_CALL, 5490, 7824,
+  yyop_ACTION, 137,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7827: MathSpan */
+  yyop_ENTER, 206, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 92, 7872,
+  yyop_BEGIN, 7870,
+  yyop_SAVE, 1,
+  yyop_STRING, 77, 2, 7854,
+  yyop_SCAN, 79, 3,
+  yyop_STRING, 79, 3, 7852,
+  yyop_JUMP, 7865,
+  yyop_RESTORE, 1,
+  yyop_STRING, 82, 2, 7870,
+  yyop_SCAN, 84, 3,
+  yyop_STRING, 84, 3, 7870,
+  yyop_END, 7870,
+  yyop_ACTION, 17,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7873: Str */
+  yyop_ENTER, 205, 2,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 7924,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_BEGIN, 7924,
+  yyop_CALL, 6074, 7924,
+  yyop_SAVE, 1,
+  yyop_CALL, 6074, 7904,
+  yyop_JUMP, 7895,
+  yyop_RESTORE, 1,
+  yyop_END, 7924,
+  yyop_ACTION, 148,
+  yyop_SAVE, 1,
+  yyop_CALL, 5993, 7919,
+  yyop_ACTION, 147,
+  yyop_JUMP, 7908,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 146,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7927: InStyleTags */
+  yyop_ENTER, 204, 3,
+  yyop_TEST, 44, 7961,
+  yyop_SAVE, 0,
+  yyop_CALL, 8000, 7961,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CALL, 7962, 7949,
+  yyop_JUMP, 7953,
+  yyop_RESTORE, 2,
+  yyop_DOT, 7953,
+  yyop_JUMP, 7938,
+  yyop_RESTORE, 1,
+  yyop_CALL, 7962, 7959,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 7962: StyleClose */
+  yyop_ENTER, 203, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 7999,
+  yyop_CALL, 14909, 7997,
+  yyop_CHAR, 47, 7997,
+  yyop_SAVE, 1,
+  yyop_STRING, 87, 5, 7986,
+  yyop_JUMP, 7990,
+  yyop_RESTORE, 1,
+  yyop_STRING, 92, 5, 7997,
+  yyop_CALL, 14909, 7997,
+  yyop_CHAR, 62, 7997,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 8000: StyleOpen */
+  yyop_ENTER, 202, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 8046,
+  yyop_CALL, 14909, 8044,
+  yyop_SAVE, 1,
+  yyop_STRING, 87, 5, 8021,
+  yyop_JUMP, 8025,
+  yyop_RESTORE, 1,
+  yyop_STRING, 92, 5, 8044,
+  yyop_CALL, 14909, 8044,
+  yyop_TEST, 32, 8040,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 8040,
+  yyop_JUMP, 8028,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 8044,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 8047: HtmlBlockType */
+  yyop_ENTER, 201, 2,
+  yyop_TEST, 59, 8614,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_STRING, 97, 7, 8065,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 104, 10, 8073,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 114, 6, 8081,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 120, 3, 8089,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 123, 3, 8097,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 126, 2, 8105,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 128, 8, 8113,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 136, 4, 8121,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 140, 2, 8129,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 142, 2, 8137,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 144, 2, 8145,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 146, 2, 8153,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 148, 2, 8161,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 150, 2, 8169,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 152, 2, 8177,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 154, 7, 8185,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 161, 4, 8193,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 165, 8, 8201,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 173, 8, 8209,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 181, 2, 8217,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 112, 8224,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 183, 3, 8232,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 186, 5, 8240,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 191, 2, 8248,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 98, 2, 8256,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 193, 2, 8264,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 195, 8, 8272,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 203, 2, 8280,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 205, 5, 8288,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 210, 2, 8296,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 212, 5, 8304,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 217, 2, 8312,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 219, 5, 8320,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 224, 2, 8328,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 175, 6, 8336,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 226, 7, 8344,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 233, 10, 8352,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 243, 6, 8360,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 249, 3, 8368,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 252, 3, 8376,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 255, 2, 8384,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 257, 8, 8392,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 265, 4, 8400,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 269, 2, 8408,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 271, 2, 8416,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 273, 2, 8424,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 275, 2, 8432,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 277, 2, 8440,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 279, 2, 8448,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 281, 2, 8456,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 283, 7, 8464,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 290, 4, 8472,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 294, 8, 8480,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 302, 8, 8488,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 310, 2, 8496,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 80, 8503,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 312, 3, 8511,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 315, 5, 8519,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 320, 2, 8527,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 227, 2, 8535,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 322, 2, 8543,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 324, 8, 8551,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 332, 2, 8559,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 334, 5, 8567,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 339, 2, 8575,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 341, 5, 8583,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 346, 2, 8591,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 348, 5, 8599,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 353, 2, 8607,
+  yyop_JUMP, 8611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 304, 6, 8612,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 8615: HtmlBlockSelfClosing */
+  yyop_ENTER, 200, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 8656,
+  yyop_CALL, 14909, 8654,
+  yyop_CALL, 8047, 8654,
+  yyop_CALL, 14909, 8654,
+  yyop_TEST, 32, 8644,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 8644,
+  yyop_JUMP, 8632,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 47, 8654,
+  yyop_CALL, 14909, 8654,
+  yyop_CHAR, 62, 8654,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 8657: HtmlComment */
+  yyop_ENTER, 199, 1,
+  yyop_SAVE, 0,
+  yyop_STRING, 355, 4, 8676,
+  yyop_SCAN, 359, 3,
+  yyop_STRING, 359, 3, 8674,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 8677: MarkdownHtmlTagOpen */
+  yyop_ENTER, 198, 3,
+  yyop_TEST, 44, 8777,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 8775,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_CHAR, 60, 8775,
+  yyop_ACTION, 5,
+  yyop_CALL, 14909, 8775,
+  yyop_BEGIN, 8775,
+  yyop_CALL, 8047, 8775,
+  yyop_END, 8775,
+  yyop_ACTION, 4,
+  yyop_CALL, 14909, 8775,
+  yyop_TEST, 32, 8744,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CALL, 0, 8731,
+  yyop_JUMP, 8742,
+  yyop_RESTORE, 2,
+  yyop_BEGIN, 8742,
+  yyop_CALL, 14852, 8742,
+  yyop_END, 8742,
+  yyop_ACTION, 3,
+  yyop_JUMP, 8717,
+  yyop_RESTORE, 1,
+  yyop_CALL, 0, 8775,
+  yyop_TEST, 32, 8765,
+  yyop_SAVE, 1,
+  yyop_BEGIN, 8765,
+  yyop_CALL, 14852, 8765,
+  yyop_END, 8763,
+  yyop_ACTION, 2,
+  yyop_JUMP, 8747,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 8775,
+  yyop_ACTION, 1,
+  yyop_ACTION, 0,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 8778: HtmlBlockInTags */
+  yyop_ENTER, 197, 2,
+  yyop_TEST, 44, 9219,
+  yyop_SAVE, 0,
+  yyop_TEST, 44, 8798,
+  yyop_SAVE, 1,
+  yyop_CALL, 14765, 8798,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 8810,
+  yyop_CALL, 14631, 8810,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8820,
+  yyop_CALL, 14497, 8820,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8830,
+  yyop_CALL, 14229, 8830,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8840,
+  yyop_CALL, 14363, 8840,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8850,
+  yyop_CALL, 14095, 8850,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8860,
+  yyop_CALL, 13961, 8860,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8870,
+  yyop_CALL, 13874, 8870,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8880,
+  yyop_CALL, 13740, 8880,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8890,
+  yyop_CALL, 13606, 8890,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8900,
+  yyop_CALL, 13472, 8900,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8910,
+  yyop_CALL, 13338, 8910,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8920,
+  yyop_CALL, 13204, 8920,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8930,
+  yyop_CALL, 13070, 8930,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8940,
+  yyop_CALL, 12936, 8940,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8950,
+  yyop_CALL, 12802, 8950,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8960,
+  yyop_CALL, 12668, 8960,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8970,
+  yyop_CALL, 12534, 8970,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8980,
+  yyop_CALL, 12400, 8980,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 8990,
+  yyop_CALL, 12266, 8990,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9000,
+  yyop_CALL, 12132, 9000,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9010,
+  yyop_CALL, 11998, 9010,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9020,
+  yyop_CALL, 11864, 9020,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9030,
+  yyop_CALL, 11730, 9030,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9040,
+  yyop_CALL, 11596, 9040,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9050,
+  yyop_CALL, 11484, 9050,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9060,
+  yyop_CALL, 11350, 9060,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9070,
+  yyop_CALL, 11216, 9070,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9080,
+  yyop_CALL, 11082, 9080,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9090,
+  yyop_CALL, 10948, 9090,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9100,
+  yyop_CALL, 10814, 9100,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9110,
+  yyop_CALL, 10680, 9110,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9120,
+  yyop_CALL, 10546, 9120,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9130,
+  yyop_CALL, 10412, 9130,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9140,
+  yyop_CALL, 10278, 9140,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9150,
+  yyop_CALL, 10144, 9150,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9160,
+  yyop_CALL, 10010, 9160,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9170,
+  yyop_CALL, 9876, 9170,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9180,
+  yyop_CALL, 9742, 9180,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9190,
+  yyop_CALL, 9608, 9190,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9200,
+  yyop_CALL, 9474, 9200,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9210,
+  yyop_CALL, 9340, 9210,
+  yyop_JUMP, 9216,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 9217,
+  yyop_CALL, 9220, 9217,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9220: HtmlBlockScript */
+  yyop_ENTER, 196, 3,
+  yyop_TEST, 44, 9254,
+  yyop_SAVE, 0,
+  yyop_CALL, 9293, 9254,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CALL, 9255, 9242,
+  yyop_JUMP, 9246,
+  yyop_RESTORE, 2,
+  yyop_DOT, 9246,
+  yyop_JUMP, 9231,
+  yyop_RESTORE, 1,
+  yyop_CALL, 9255, 9252,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9255: HtmlBlockCloseScript */
+  yyop_ENTER, 195, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 9292,
+  yyop_CALL, 14909, 9290,
+  yyop_CHAR, 47, 9290,
+  yyop_SAVE, 1,
+  yyop_STRING, 175, 6, 9279,
+  yyop_JUMP, 9283,
+  yyop_RESTORE, 1,
+  yyop_STRING, 304, 6, 9290,
+  yyop_CALL, 14909, 9290,
+  yyop_CHAR, 62, 9290,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9293: HtmlBlockOpenScript */
+  yyop_ENTER, 194, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 9339,
+  yyop_CALL, 14909, 9337,
+  yyop_SAVE, 1,
+  yyop_STRING, 175, 6, 9314,
+  yyop_JUMP, 9318,
+  yyop_RESTORE, 1,
+  yyop_STRING, 304, 6, 9337,
+  yyop_CALL, 14909, 9337,
+  yyop_TEST, 32, 9333,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 9333,
+  yyop_JUMP, 9321,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 9337,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9340: HtmlBlockTr */
+  yyop_ENTER, 193, 4,
+  yyop_TEST, 44, 9388,
+  yyop_SAVE, 0,
+  yyop_CALL, 9427, 9388,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 9365,
+  yyop_SAVE, 2,
+  yyop_CALL, 9340, 9365,
+  yyop_JUMP, 9378,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 9389, 9376,
+  yyop_JUMP, 9380,
+  yyop_RESTORE, 3,
+  yyop_DOT, 9380,
+  yyop_JUMP, 9351,
+  yyop_RESTORE, 1,
+  yyop_CALL, 9389, 9386,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9389: HtmlBlockCloseTr */
+  yyop_ENTER, 192, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 9426,
+  yyop_CALL, 14909, 9424,
+  yyop_CHAR, 47, 9424,
+  yyop_SAVE, 1,
+  yyop_STRING, 224, 2, 9413,
+  yyop_JUMP, 9417,
+  yyop_RESTORE, 1,
+  yyop_STRING, 353, 2, 9424,
+  yyop_CALL, 14909, 9424,
+  yyop_CHAR, 62, 9424,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9427: HtmlBlockOpenTr */
+  yyop_ENTER, 191, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 9473,
+  yyop_CALL, 14909, 9471,
+  yyop_SAVE, 1,
+  yyop_STRING, 224, 2, 9448,
+  yyop_JUMP, 9452,
+  yyop_RESTORE, 1,
+  yyop_STRING, 353, 2, 9471,
+  yyop_CALL, 14909, 9471,
+  yyop_TEST, 32, 9467,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 9467,
+  yyop_JUMP, 9455,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 9471,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9474: HtmlBlockThead */
+  yyop_ENTER, 190, 4,
+  yyop_TEST, 44, 9522,
+  yyop_SAVE, 0,
+  yyop_CALL, 9561, 9522,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 9499,
+  yyop_SAVE, 2,
+  yyop_CALL, 9474, 9499,
+  yyop_JUMP, 9512,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 9523, 9510,
+  yyop_JUMP, 9514,
+  yyop_RESTORE, 3,
+  yyop_DOT, 9514,
+  yyop_JUMP, 9485,
+  yyop_RESTORE, 1,
+  yyop_CALL, 9523, 9520,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9523: HtmlBlockCloseThead */
+  yyop_ENTER, 189, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 9560,
+  yyop_CALL, 14909, 9558,
+  yyop_CHAR, 47, 9558,
+  yyop_SAVE, 1,
+  yyop_STRING, 219, 5, 9547,
+  yyop_JUMP, 9551,
+  yyop_RESTORE, 1,
+  yyop_STRING, 348, 5, 9558,
+  yyop_CALL, 14909, 9558,
+  yyop_CHAR, 62, 9558,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9561: HtmlBlockOpenThead */
+  yyop_ENTER, 188, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 9607,
+  yyop_CALL, 14909, 9605,
+  yyop_SAVE, 1,
+  yyop_STRING, 219, 5, 9582,
+  yyop_JUMP, 9586,
+  yyop_RESTORE, 1,
+  yyop_STRING, 348, 5, 9605,
+  yyop_CALL, 14909, 9605,
+  yyop_TEST, 32, 9601,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 9601,
+  yyop_JUMP, 9589,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 9605,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9608: HtmlBlockTh */
+  yyop_ENTER, 187, 4,
+  yyop_TEST, 44, 9656,
+  yyop_SAVE, 0,
+  yyop_CALL, 9695, 9656,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 9633,
+  yyop_SAVE, 2,
+  yyop_CALL, 9608, 9633,
+  yyop_JUMP, 9646,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 9657, 9644,
+  yyop_JUMP, 9648,
+  yyop_RESTORE, 3,
+  yyop_DOT, 9648,
+  yyop_JUMP, 9619,
+  yyop_RESTORE, 1,
+  yyop_CALL, 9657, 9654,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9657: HtmlBlockCloseTh */
+  yyop_ENTER, 186, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 9694,
+  yyop_CALL, 14909, 9692,
+  yyop_CHAR, 47, 9692,
+  yyop_SAVE, 1,
+  yyop_STRING, 217, 2, 9681,
+  yyop_JUMP, 9685,
+  yyop_RESTORE, 1,
+  yyop_STRING, 346, 2, 9692,
+  yyop_CALL, 14909, 9692,
+  yyop_CHAR, 62, 9692,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9695: HtmlBlockOpenTh */
+  yyop_ENTER, 185, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 9741,
+  yyop_CALL, 14909, 9739,
+  yyop_SAVE, 1,
+  yyop_STRING, 217, 2, 9716,
+  yyop_JUMP, 9720,
+  yyop_RESTORE, 1,
+  yyop_STRING, 346, 2, 9739,
+  yyop_CALL, 14909, 9739,
+  yyop_TEST, 32, 9735,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 9735,
+  yyop_JUMP, 9723,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 9739,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9742: HtmlBlockTfoot */
+  yyop_ENTER, 184, 4,
+  yyop_TEST, 44, 9790,
+  yyop_SAVE, 0,
+  yyop_CALL, 9829, 9790,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 9767,
+  yyop_SAVE, 2,
+  yyop_CALL, 9742, 9767,
+  yyop_JUMP, 9780,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 9791, 9778,
+  yyop_JUMP, 9782,
+  yyop_RESTORE, 3,
+  yyop_DOT, 9782,
+  yyop_JUMP, 9753,
+  yyop_RESTORE, 1,
+  yyop_CALL, 9791, 9788,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9791: HtmlBlockCloseTfoot */
+  yyop_ENTER, 183, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 9828,
+  yyop_CALL, 14909, 9826,
+  yyop_CHAR, 47, 9826,
+  yyop_SAVE, 1,
+  yyop_STRING, 212, 5, 9815,
+  yyop_JUMP, 9819,
+  yyop_RESTORE, 1,
+  yyop_STRING, 341, 5, 9826,
+  yyop_CALL, 14909, 9826,
+  yyop_CHAR, 62, 9826,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9829: HtmlBlockOpenTfoot */
+  yyop_ENTER, 182, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 9875,
+  yyop_CALL, 14909, 9873,
+  yyop_SAVE, 1,
+  yyop_STRING, 212, 5, 9850,
+  yyop_JUMP, 9854,
+  yyop_RESTORE, 1,
+  yyop_STRING, 341, 5, 9873,
+  yyop_CALL, 14909, 9873,
+  yyop_TEST, 32, 9869,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 9869,
+  yyop_JUMP, 9857,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 9873,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9876: HtmlBlockTd */
+  yyop_ENTER, 181, 4,
+  yyop_TEST, 44, 9924,
+  yyop_SAVE, 0,
+  yyop_CALL, 9963, 9924,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 9901,
+  yyop_SAVE, 2,
+  yyop_CALL, 9876, 9901,
+  yyop_JUMP, 9914,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 9925, 9912,
+  yyop_JUMP, 9916,
+  yyop_RESTORE, 3,
+  yyop_DOT, 9916,
+  yyop_JUMP, 9887,
+  yyop_RESTORE, 1,
+  yyop_CALL, 9925, 9922,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9925: HtmlBlockCloseTd */
+  yyop_ENTER, 180, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 9962,
+  yyop_CALL, 14909, 9960,
+  yyop_CHAR, 47, 9960,
+  yyop_SAVE, 1,
+  yyop_STRING, 210, 2, 9949,
+  yyop_JUMP, 9953,
+  yyop_RESTORE, 1,
+  yyop_STRING, 339, 2, 9960,
+  yyop_CALL, 14909, 9960,
+  yyop_CHAR, 62, 9960,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 9963: HtmlBlockOpenTd */
+  yyop_ENTER, 179, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10009,
+  yyop_CALL, 14909, 10007,
+  yyop_SAVE, 1,
+  yyop_STRING, 210, 2, 9984,
+  yyop_JUMP, 9988,
+  yyop_RESTORE, 1,
+  yyop_STRING, 339, 2, 10007,
+  yyop_CALL, 14909, 10007,
+  yyop_TEST, 32, 10003,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 10003,
+  yyop_JUMP, 9991,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 10007,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10010: HtmlBlockTbody */
+  yyop_ENTER, 178, 4,
+  yyop_TEST, 44, 10058,
+  yyop_SAVE, 0,
+  yyop_CALL, 10097, 10058,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 10035,
+  yyop_SAVE, 2,
+  yyop_CALL, 10010, 10035,
+  yyop_JUMP, 10048,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 10059, 10046,
+  yyop_JUMP, 10050,
+  yyop_RESTORE, 3,
+  yyop_DOT, 10050,
+  yyop_JUMP, 10021,
+  yyop_RESTORE, 1,
+  yyop_CALL, 10059, 10056,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10059: HtmlBlockCloseTbody */
+  yyop_ENTER, 177, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10096,
+  yyop_CALL, 14909, 10094,
+  yyop_CHAR, 47, 10094,
+  yyop_SAVE, 1,
+  yyop_STRING, 205, 5, 10083,
+  yyop_JUMP, 10087,
+  yyop_RESTORE, 1,
+  yyop_STRING, 334, 5, 10094,
+  yyop_CALL, 14909, 10094,
+  yyop_CHAR, 62, 10094,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10097: HtmlBlockOpenTbody */
+  yyop_ENTER, 176, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10143,
+  yyop_CALL, 14909, 10141,
+  yyop_SAVE, 1,
+  yyop_STRING, 205, 5, 10118,
+  yyop_JUMP, 10122,
+  yyop_RESTORE, 1,
+  yyop_STRING, 334, 5, 10141,
+  yyop_CALL, 14909, 10141,
+  yyop_TEST, 32, 10137,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 10137,
+  yyop_JUMP, 10125,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 10141,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10144: HtmlBlockLi */
+  yyop_ENTER, 175, 4,
+  yyop_TEST, 44, 10192,
+  yyop_SAVE, 0,
+  yyop_CALL, 10231, 10192,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 10169,
+  yyop_SAVE, 2,
+  yyop_CALL, 10144, 10169,
+  yyop_JUMP, 10182,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 10193, 10180,
+  yyop_JUMP, 10184,
+  yyop_RESTORE, 3,
+  yyop_DOT, 10184,
+  yyop_JUMP, 10155,
+  yyop_RESTORE, 1,
+  yyop_CALL, 10193, 10190,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10193: HtmlBlockCloseLi */
+  yyop_ENTER, 174, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10230,
+  yyop_CALL, 14909, 10228,
+  yyop_CHAR, 47, 10228,
+  yyop_SAVE, 1,
+  yyop_STRING, 203, 2, 10217,
+  yyop_JUMP, 10221,
+  yyop_RESTORE, 1,
+  yyop_STRING, 332, 2, 10228,
+  yyop_CALL, 14909, 10228,
+  yyop_CHAR, 62, 10228,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10231: HtmlBlockOpenLi */
+  yyop_ENTER, 173, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10277,
+  yyop_CALL, 14909, 10275,
+  yyop_SAVE, 1,
+  yyop_STRING, 203, 2, 10252,
+  yyop_JUMP, 10256,
+  yyop_RESTORE, 1,
+  yyop_STRING, 332, 2, 10275,
+  yyop_CALL, 14909, 10275,
+  yyop_TEST, 32, 10271,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 10271,
+  yyop_JUMP, 10259,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 10275,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10278: HtmlBlockFrameset */
+  yyop_ENTER, 172, 4,
+  yyop_TEST, 44, 10326,
+  yyop_SAVE, 0,
+  yyop_CALL, 10365, 10326,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 10303,
+  yyop_SAVE, 2,
+  yyop_CALL, 10278, 10303,
+  yyop_JUMP, 10316,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 10327, 10314,
+  yyop_JUMP, 10318,
+  yyop_RESTORE, 3,
+  yyop_DOT, 10318,
+  yyop_JUMP, 10289,
+  yyop_RESTORE, 1,
+  yyop_CALL, 10327, 10324,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10327: HtmlBlockCloseFrameset */
+  yyop_ENTER, 171, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10364,
+  yyop_CALL, 14909, 10362,
+  yyop_CHAR, 47, 10362,
+  yyop_SAVE, 1,
+  yyop_STRING, 195, 8, 10351,
+  yyop_JUMP, 10355,
+  yyop_RESTORE, 1,
+  yyop_STRING, 324, 8, 10362,
+  yyop_CALL, 14909, 10362,
+  yyop_CHAR, 62, 10362,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10365: HtmlBlockOpenFrameset */
+  yyop_ENTER, 170, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10411,
+  yyop_CALL, 14909, 10409,
+  yyop_SAVE, 1,
+  yyop_STRING, 195, 8, 10386,
+  yyop_JUMP, 10390,
+  yyop_RESTORE, 1,
+  yyop_STRING, 324, 8, 10409,
+  yyop_CALL, 14909, 10409,
+  yyop_TEST, 32, 10405,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 10405,
+  yyop_JUMP, 10393,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 10409,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10412: HtmlBlockDt */
+  yyop_ENTER, 169, 4,
+  yyop_TEST, 44, 10460,
+  yyop_SAVE, 0,
+  yyop_CALL, 10499, 10460,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 10437,
+  yyop_SAVE, 2,
+  yyop_CALL, 10412, 10437,
+  yyop_JUMP, 10450,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 10461, 10448,
+  yyop_JUMP, 10452,
+  yyop_RESTORE, 3,
+  yyop_DOT, 10452,
+  yyop_JUMP, 10423,
+  yyop_RESTORE, 1,
+  yyop_CALL, 10461, 10458,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10461: HtmlBlockCloseDt */
+  yyop_ENTER, 168, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10498,
+  yyop_CALL, 14909, 10496,
+  yyop_CHAR, 47, 10496,
+  yyop_SAVE, 1,
+  yyop_STRING, 193, 2, 10485,
+  yyop_JUMP, 10489,
+  yyop_RESTORE, 1,
+  yyop_STRING, 322, 2, 10496,
+  yyop_CALL, 14909, 10496,
+  yyop_CHAR, 62, 10496,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10499: HtmlBlockOpenDt */
+  yyop_ENTER, 167, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10545,
+  yyop_CALL, 14909, 10543,
+  yyop_SAVE, 1,
+  yyop_STRING, 193, 2, 10520,
+  yyop_JUMP, 10524,
+  yyop_RESTORE, 1,
+  yyop_STRING, 322, 2, 10543,
+  yyop_CALL, 14909, 10543,
+  yyop_TEST, 32, 10539,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 10539,
+  yyop_JUMP, 10527,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 10543,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10546: HtmlBlockDd */
+  yyop_ENTER, 166, 4,
+  yyop_TEST, 44, 10594,
+  yyop_SAVE, 0,
+  yyop_CALL, 10633, 10594,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 10571,
+  yyop_SAVE, 2,
+  yyop_CALL, 10546, 10571,
+  yyop_JUMP, 10584,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 10595, 10582,
+  yyop_JUMP, 10586,
+  yyop_RESTORE, 3,
+  yyop_DOT, 10586,
+  yyop_JUMP, 10557,
+  yyop_RESTORE, 1,
+  yyop_CALL, 10595, 10592,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10595: HtmlBlockCloseDd */
+  yyop_ENTER, 165, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10632,
+  yyop_CALL, 14909, 10630,
+  yyop_CHAR, 47, 10630,
+  yyop_SAVE, 1,
+  yyop_STRING, 98, 2, 10619,
+  yyop_JUMP, 10623,
+  yyop_RESTORE, 1,
+  yyop_STRING, 227, 2, 10630,
+  yyop_CALL, 14909, 10630,
+  yyop_CHAR, 62, 10630,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10633: HtmlBlockOpenDd */
+  yyop_ENTER, 164, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10679,
+  yyop_CALL, 14909, 10677,
+  yyop_SAVE, 1,
+  yyop_STRING, 98, 2, 10654,
+  yyop_JUMP, 10658,
+  yyop_RESTORE, 1,
+  yyop_STRING, 227, 2, 10677,
+  yyop_CALL, 14909, 10677,
+  yyop_TEST, 32, 10673,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 10673,
+  yyop_JUMP, 10661,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 10677,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10680: HtmlBlockVideo */
+  yyop_ENTER, 163, 4,
+  yyop_TEST, 44, 10728,
+  yyop_SAVE, 0,
+  yyop_CALL, 10767, 10728,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 10705,
+  yyop_SAVE, 2,
+  yyop_CALL, 10680, 10705,
+  yyop_JUMP, 10718,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 10729, 10716,
+  yyop_JUMP, 10720,
+  yyop_RESTORE, 3,
+  yyop_DOT, 10720,
+  yyop_JUMP, 10691,
+  yyop_RESTORE, 1,
+  yyop_CALL, 10729, 10726,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10729: HtmlBlockCloseVideo */
+  yyop_ENTER, 162, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10766,
+  yyop_CALL, 14909, 10764,
+  yyop_CHAR, 47, 10764,
+  yyop_SAVE, 1,
+  yyop_STRING, 362, 5, 10753,
+  yyop_JUMP, 10757,
+  yyop_RESTORE, 1,
+  yyop_STRING, 367, 5, 10764,
+  yyop_CALL, 14909, 10764,
+  yyop_CHAR, 62, 10764,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10767: HtmlBlockOpenVideo */
+  yyop_ENTER, 161, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10813,
+  yyop_CALL, 14909, 10811,
+  yyop_SAVE, 1,
+  yyop_STRING, 362, 5, 10788,
+  yyop_JUMP, 10792,
+  yyop_RESTORE, 1,
+  yyop_STRING, 367, 5, 10811,
+  yyop_CALL, 14909, 10811,
+  yyop_TEST, 32, 10807,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 10807,
+  yyop_JUMP, 10795,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 10811,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10814: HtmlBlockUl */
+  yyop_ENTER, 160, 4,
+  yyop_TEST, 44, 10862,
+  yyop_SAVE, 0,
+  yyop_CALL, 10901, 10862,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 10839,
+  yyop_SAVE, 2,
+  yyop_CALL, 10814, 10839,
+  yyop_JUMP, 10852,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 10863, 10850,
+  yyop_JUMP, 10854,
+  yyop_RESTORE, 3,
+  yyop_DOT, 10854,
+  yyop_JUMP, 10825,
+  yyop_RESTORE, 1,
+  yyop_CALL, 10863, 10860,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10863: HtmlBlockCloseUl */
+  yyop_ENTER, 159, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10900,
+  yyop_CALL, 14909, 10898,
+  yyop_CHAR, 47, 10898,
+  yyop_SAVE, 1,
+  yyop_STRING, 191, 2, 10887,
+  yyop_JUMP, 10891,
+  yyop_RESTORE, 1,
+  yyop_STRING, 320, 2, 10898,
+  yyop_CALL, 14909, 10898,
+  yyop_CHAR, 62, 10898,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10901: HtmlBlockOpenUl */
+  yyop_ENTER, 158, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 10947,
+  yyop_CALL, 14909, 10945,
+  yyop_SAVE, 1,
+  yyop_STRING, 191, 2, 10922,
+  yyop_JUMP, 10926,
+  yyop_RESTORE, 1,
+  yyop_STRING, 320, 2, 10945,
+  yyop_CALL, 14909, 10945,
+  yyop_TEST, 32, 10941,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 10941,
+  yyop_JUMP, 10929,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 10945,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10948: HtmlBlockTable */
+  yyop_ENTER, 157, 4,
+  yyop_TEST, 44, 10996,
+  yyop_SAVE, 0,
+  yyop_CALL, 11035, 10996,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 10973,
+  yyop_SAVE, 2,
+  yyop_CALL, 10948, 10973,
+  yyop_JUMP, 10986,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 10997, 10984,
+  yyop_JUMP, 10988,
+  yyop_RESTORE, 3,
+  yyop_DOT, 10988,
+  yyop_JUMP, 10959,
+  yyop_RESTORE, 1,
+  yyop_CALL, 10997, 10994,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 10997: HtmlBlockCloseTable */
+  yyop_ENTER, 156, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11034,
+  yyop_CALL, 14909, 11032,
+  yyop_CHAR, 47, 11032,
+  yyop_SAVE, 1,
+  yyop_STRING, 186, 5, 11021,
+  yyop_JUMP, 11025,
+  yyop_RESTORE, 1,
+  yyop_STRING, 315, 5, 11032,
+  yyop_CALL, 14909, 11032,
+  yyop_CHAR, 62, 11032,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11035: HtmlBlockOpenTable */
+  yyop_ENTER, 155, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11081,
+  yyop_CALL, 14909, 11079,
+  yyop_SAVE, 1,
+  yyop_STRING, 186, 5, 11056,
+  yyop_JUMP, 11060,
+  yyop_RESTORE, 1,
+  yyop_STRING, 315, 5, 11079,
+  yyop_CALL, 14909, 11079,
+  yyop_TEST, 32, 11075,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 11075,
+  yyop_JUMP, 11063,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 11079,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11082: HtmlBlockSection */
+  yyop_ENTER, 154, 4,
+  yyop_TEST, 44, 11130,
+  yyop_SAVE, 0,
+  yyop_CALL, 11169, 11130,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 11107,
+  yyop_SAVE, 2,
+  yyop_CALL, 11082, 11107,
+  yyop_JUMP, 11120,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 11131, 11118,
+  yyop_JUMP, 11122,
+  yyop_RESTORE, 3,
+  yyop_DOT, 11122,
+  yyop_JUMP, 11093,
+  yyop_RESTORE, 1,
+  yyop_CALL, 11131, 11128,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11131: HtmlBlockCloseSection */
+  yyop_ENTER, 153, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11168,
+  yyop_CALL, 14909, 11166,
+  yyop_CHAR, 47, 11166,
+  yyop_SAVE, 1,
+  yyop_STRING, 372, 7, 11155,
+  yyop_JUMP, 11159,
+  yyop_RESTORE, 1,
+  yyop_STRING, 379, 7, 11166,
+  yyop_CALL, 14909, 11166,
+  yyop_CHAR, 62, 11166,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11169: HtmlBlockOpenSection */
+  yyop_ENTER, 152, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11215,
+  yyop_CALL, 14909, 11213,
+  yyop_SAVE, 1,
+  yyop_STRING, 372, 7, 11190,
+  yyop_JUMP, 11194,
+  yyop_RESTORE, 1,
+  yyop_STRING, 379, 7, 11213,
+  yyop_CALL, 14909, 11213,
+  yyop_TEST, 32, 11209,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 11209,
+  yyop_JUMP, 11197,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 11213,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11216: HtmlBlockProgress */
+  yyop_ENTER, 151, 4,
+  yyop_TEST, 44, 11264,
+  yyop_SAVE, 0,
+  yyop_CALL, 11303, 11264,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 11241,
+  yyop_SAVE, 2,
+  yyop_CALL, 11216, 11241,
+  yyop_JUMP, 11254,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 11265, 11252,
+  yyop_JUMP, 11256,
+  yyop_RESTORE, 3,
+  yyop_DOT, 11256,
+  yyop_JUMP, 11227,
+  yyop_RESTORE, 1,
+  yyop_CALL, 11265, 11262,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11265: HtmlBlockCloseProgress */
+  yyop_ENTER, 150, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11302,
+  yyop_CALL, 14909, 11300,
+  yyop_CHAR, 47, 11300,
+  yyop_SAVE, 1,
+  yyop_STRING, 386, 8, 11289,
+  yyop_JUMP, 11293,
+  yyop_RESTORE, 1,
+  yyop_STRING, 394, 8, 11300,
+  yyop_CALL, 14909, 11300,
+  yyop_CHAR, 62, 11300,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11303: HtmlBlockOpenProgress */
+  yyop_ENTER, 149, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11349,
+  yyop_CALL, 14909, 11347,
+  yyop_SAVE, 1,
+  yyop_STRING, 386, 8, 11324,
+  yyop_JUMP, 11328,
+  yyop_RESTORE, 1,
+  yyop_STRING, 394, 8, 11347,
+  yyop_CALL, 14909, 11347,
+  yyop_TEST, 32, 11343,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 11343,
+  yyop_JUMP, 11331,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 11347,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11350: HtmlBlockPre */
+  yyop_ENTER, 148, 4,
+  yyop_TEST, 44, 11398,
+  yyop_SAVE, 0,
+  yyop_CALL, 11437, 11398,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 11375,
+  yyop_SAVE, 2,
+  yyop_CALL, 11350, 11375,
+  yyop_JUMP, 11388,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 11399, 11386,
+  yyop_JUMP, 11390,
+  yyop_RESTORE, 3,
+  yyop_DOT, 11390,
+  yyop_JUMP, 11361,
+  yyop_RESTORE, 1,
+  yyop_CALL, 11399, 11396,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11399: HtmlBlockClosePre */
+  yyop_ENTER, 147, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11436,
+  yyop_CALL, 14909, 11434,
+  yyop_CHAR, 47, 11434,
+  yyop_SAVE, 1,
+  yyop_STRING, 183, 3, 11423,
+  yyop_JUMP, 11427,
+  yyop_RESTORE, 1,
+  yyop_STRING, 312, 3, 11434,
+  yyop_CALL, 14909, 11434,
+  yyop_CHAR, 62, 11434,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11437: HtmlBlockOpenPre */
+  yyop_ENTER, 146, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11483,
+  yyop_CALL, 14909, 11481,
+  yyop_SAVE, 1,
+  yyop_STRING, 183, 3, 11458,
+  yyop_JUMP, 11462,
+  yyop_RESTORE, 1,
+  yyop_STRING, 312, 3, 11481,
+  yyop_CALL, 14909, 11481,
+  yyop_TEST, 32, 11477,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 11477,
+  yyop_JUMP, 11465,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 11481,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11484: HtmlBlockP */
+  yyop_ENTER, 145, 4,
+  yyop_TEST, 44, 11532,
+  yyop_SAVE, 0,
+  yyop_CALL, 11560, 11532,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 11509,
+  yyop_SAVE, 2,
+  yyop_CALL, 11484, 11509,
+  yyop_JUMP, 11522,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 11533, 11520,
+  yyop_JUMP, 11524,
+  yyop_RESTORE, 3,
+  yyop_DOT, 11524,
+  yyop_JUMP, 11495,
+  yyop_RESTORE, 1,
+  yyop_CALL, 11533, 11530,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11533: HtmlBlockCloseP */
+  yyop_ENTER, 144, 1,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11559,
+  yyop_CALL, 14909, 11557,
+  yyop_CHAR, 47, 11557,
+  yyop_CLASS, 60, 11557,
+  yyop_CALL, 14909, 11557,
+  yyop_CHAR, 62, 11557,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11560: HtmlBlockOpenP */
+  yyop_ENTER, 143, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11595,
+  yyop_CALL, 14909, 11593,
+  yyop_CLASS, 60, 11593,
+  yyop_CALL, 14909, 11593,
+  yyop_TEST, 32, 11589,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 11589,
+  yyop_JUMP, 11577,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 11593,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11596: HtmlBlockOl */
+  yyop_ENTER, 142, 4,
+  yyop_TEST, 44, 11644,
+  yyop_SAVE, 0,
+  yyop_CALL, 11683, 11644,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 11621,
+  yyop_SAVE, 2,
+  yyop_CALL, 11596, 11621,
+  yyop_JUMP, 11634,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 11645, 11632,
+  yyop_JUMP, 11636,
+  yyop_RESTORE, 3,
+  yyop_DOT, 11636,
+  yyop_JUMP, 11607,
+  yyop_RESTORE, 1,
+  yyop_CALL, 11645, 11642,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11645: HtmlBlockCloseOl */
+  yyop_ENTER, 141, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11682,
+  yyop_CALL, 14909, 11680,
+  yyop_CHAR, 47, 11680,
+  yyop_SAVE, 1,
+  yyop_STRING, 181, 2, 11669,
+  yyop_JUMP, 11673,
+  yyop_RESTORE, 1,
+  yyop_STRING, 310, 2, 11680,
+  yyop_CALL, 14909, 11680,
+  yyop_CHAR, 62, 11680,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11683: HtmlBlockOpenOl */
+  yyop_ENTER, 140, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11729,
+  yyop_CALL, 14909, 11727,
+  yyop_SAVE, 1,
+  yyop_STRING, 181, 2, 11704,
+  yyop_JUMP, 11708,
+  yyop_RESTORE, 1,
+  yyop_STRING, 310, 2, 11727,
+  yyop_CALL, 14909, 11727,
+  yyop_TEST, 32, 11723,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 11723,
+  yyop_JUMP, 11711,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 11727,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11730: HtmlBlockNoscript */
+  yyop_ENTER, 139, 4,
+  yyop_TEST, 44, 11778,
+  yyop_SAVE, 0,
+  yyop_CALL, 11817, 11778,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 11755,
+  yyop_SAVE, 2,
+  yyop_CALL, 11730, 11755,
+  yyop_JUMP, 11768,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 11779, 11766,
+  yyop_JUMP, 11770,
+  yyop_RESTORE, 3,
+  yyop_DOT, 11770,
+  yyop_JUMP, 11741,
+  yyop_RESTORE, 1,
+  yyop_CALL, 11779, 11776,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11779: HtmlBlockCloseNoscript */
+  yyop_ENTER, 138, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11816,
+  yyop_CALL, 14909, 11814,
+  yyop_CHAR, 47, 11814,
+  yyop_SAVE, 1,
+  yyop_STRING, 173, 8, 11803,
+  yyop_JUMP, 11807,
+  yyop_RESTORE, 1,
+  yyop_STRING, 302, 8, 11814,
+  yyop_CALL, 14909, 11814,
+  yyop_CHAR, 62, 11814,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11817: HtmlBlockOpenNoscript */
+  yyop_ENTER, 137, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11863,
+  yyop_CALL, 14909, 11861,
+  yyop_SAVE, 1,
+  yyop_STRING, 173, 8, 11838,
+  yyop_JUMP, 11842,
+  yyop_RESTORE, 1,
+  yyop_STRING, 302, 8, 11861,
+  yyop_CALL, 14909, 11861,
+  yyop_TEST, 32, 11857,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 11857,
+  yyop_JUMP, 11845,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 11861,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11864: HtmlBlockNoframes */
+  yyop_ENTER, 136, 4,
+  yyop_TEST, 44, 11912,
+  yyop_SAVE, 0,
+  yyop_CALL, 11951, 11912,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 11889,
+  yyop_SAVE, 2,
+  yyop_CALL, 11864, 11889,
+  yyop_JUMP, 11902,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 11913, 11900,
+  yyop_JUMP, 11904,
+  yyop_RESTORE, 3,
+  yyop_DOT, 11904,
+  yyop_JUMP, 11875,
+  yyop_RESTORE, 1,
+  yyop_CALL, 11913, 11910,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11913: HtmlBlockCloseNoframes */
+  yyop_ENTER, 135, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11950,
+  yyop_CALL, 14909, 11948,
+  yyop_CHAR, 47, 11948,
+  yyop_SAVE, 1,
+  yyop_STRING, 165, 8, 11937,
+  yyop_JUMP, 11941,
+  yyop_RESTORE, 1,
+  yyop_STRING, 294, 8, 11948,
+  yyop_CALL, 14909, 11948,
+  yyop_CHAR, 62, 11948,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11951: HtmlBlockOpenNoframes */
+  yyop_ENTER, 134, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 11997,
+  yyop_CALL, 14909, 11995,
+  yyop_SAVE, 1,
+  yyop_STRING, 165, 8, 11972,
+  yyop_JUMP, 11976,
+  yyop_RESTORE, 1,
+  yyop_STRING, 294, 8, 11995,
+  yyop_CALL, 14909, 11995,
+  yyop_TEST, 32, 11991,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 11991,
+  yyop_JUMP, 11979,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 11995,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 11998: HtmlBlockMenu */
+  yyop_ENTER, 133, 4,
+  yyop_TEST, 44, 12046,
+  yyop_SAVE, 0,
+  yyop_CALL, 12085, 12046,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 12023,
+  yyop_SAVE, 2,
+  yyop_CALL, 11998, 12023,
+  yyop_JUMP, 12036,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 12047, 12034,
+  yyop_JUMP, 12038,
+  yyop_RESTORE, 3,
+  yyop_DOT, 12038,
+  yyop_JUMP, 12009,
+  yyop_RESTORE, 1,
+  yyop_CALL, 12047, 12044,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12047: HtmlBlockCloseMenu */
+  yyop_ENTER, 132, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12084,
+  yyop_CALL, 14909, 12082,
+  yyop_CHAR, 47, 12082,
+  yyop_SAVE, 1,
+  yyop_STRING, 161, 4, 12071,
+  yyop_JUMP, 12075,
+  yyop_RESTORE, 1,
+  yyop_STRING, 290, 4, 12082,
+  yyop_CALL, 14909, 12082,
+  yyop_CHAR, 62, 12082,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12085: HtmlBlockOpenMenu */
+  yyop_ENTER, 131, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12131,
+  yyop_CALL, 14909, 12129,
+  yyop_SAVE, 1,
+  yyop_STRING, 161, 4, 12106,
+  yyop_JUMP, 12110,
+  yyop_RESTORE, 1,
+  yyop_STRING, 290, 4, 12129,
+  yyop_CALL, 14909, 12129,
+  yyop_TEST, 32, 12125,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 12125,
+  yyop_JUMP, 12113,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 12129,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12132: HtmlBlockH6 */
+  yyop_ENTER, 130, 4,
+  yyop_TEST, 44, 12180,
+  yyop_SAVE, 0,
+  yyop_CALL, 12219, 12180,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 12157,
+  yyop_SAVE, 2,
+  yyop_CALL, 12132, 12157,
+  yyop_JUMP, 12170,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 12181, 12168,
+  yyop_JUMP, 12172,
+  yyop_RESTORE, 3,
+  yyop_DOT, 12172,
+  yyop_JUMP, 12143,
+  yyop_RESTORE, 1,
+  yyop_CALL, 12181, 12178,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12181: HtmlBlockCloseH6 */
+  yyop_ENTER, 129, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12218,
+  yyop_CALL, 14909, 12216,
+  yyop_CHAR, 47, 12216,
+  yyop_SAVE, 1,
+  yyop_STRING, 150, 2, 12205,
+  yyop_JUMP, 12209,
+  yyop_RESTORE, 1,
+  yyop_STRING, 279, 2, 12216,
+  yyop_CALL, 14909, 12216,
+  yyop_CHAR, 62, 12216,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12219: HtmlBlockOpenH6 */
+  yyop_ENTER, 128, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12265,
+  yyop_CALL, 14909, 12263,
+  yyop_SAVE, 1,
+  yyop_STRING, 150, 2, 12240,
+  yyop_JUMP, 12244,
+  yyop_RESTORE, 1,
+  yyop_STRING, 279, 2, 12263,
+  yyop_CALL, 14909, 12263,
+  yyop_TEST, 32, 12259,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 12259,
+  yyop_JUMP, 12247,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 12263,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12266: HtmlBlockH5 */
+  yyop_ENTER, 127, 4,
+  yyop_TEST, 44, 12314,
+  yyop_SAVE, 0,
+  yyop_CALL, 12353, 12314,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 12291,
+  yyop_SAVE, 2,
+  yyop_CALL, 12266, 12291,
+  yyop_JUMP, 12304,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 12315, 12302,
+  yyop_JUMP, 12306,
+  yyop_RESTORE, 3,
+  yyop_DOT, 12306,
+  yyop_JUMP, 12277,
+  yyop_RESTORE, 1,
+  yyop_CALL, 12315, 12312,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12315: HtmlBlockCloseH5 */
+  yyop_ENTER, 126, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12352,
+  yyop_CALL, 14909, 12350,
+  yyop_CHAR, 47, 12350,
+  yyop_SAVE, 1,
+  yyop_STRING, 148, 2, 12339,
+  yyop_JUMP, 12343,
+  yyop_RESTORE, 1,
+  yyop_STRING, 277, 2, 12350,
+  yyop_CALL, 14909, 12350,
+  yyop_CHAR, 62, 12350,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12353: HtmlBlockOpenH5 */
+  yyop_ENTER, 125, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12399,
+  yyop_CALL, 14909, 12397,
+  yyop_SAVE, 1,
+  yyop_STRING, 148, 2, 12374,
+  yyop_JUMP, 12378,
+  yyop_RESTORE, 1,
+  yyop_STRING, 277, 2, 12397,
+  yyop_CALL, 14909, 12397,
+  yyop_TEST, 32, 12393,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 12393,
+  yyop_JUMP, 12381,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 12397,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12400: HtmlBlockH4 */
+  yyop_ENTER, 124, 4,
+  yyop_TEST, 44, 12448,
+  yyop_SAVE, 0,
+  yyop_CALL, 12487, 12448,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 12425,
+  yyop_SAVE, 2,
+  yyop_CALL, 12400, 12425,
+  yyop_JUMP, 12438,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 12449, 12436,
+  yyop_JUMP, 12440,
+  yyop_RESTORE, 3,
+  yyop_DOT, 12440,
+  yyop_JUMP, 12411,
+  yyop_RESTORE, 1,
+  yyop_CALL, 12449, 12446,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12449: HtmlBlockCloseH4 */
+  yyop_ENTER, 123, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12486,
+  yyop_CALL, 14909, 12484,
+  yyop_CHAR, 47, 12484,
+  yyop_SAVE, 1,
+  yyop_STRING, 146, 2, 12473,
+  yyop_JUMP, 12477,
+  yyop_RESTORE, 1,
+  yyop_STRING, 275, 2, 12484,
+  yyop_CALL, 14909, 12484,
+  yyop_CHAR, 62, 12484,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12487: HtmlBlockOpenH4 */
+  yyop_ENTER, 122, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12533,
+  yyop_CALL, 14909, 12531,
+  yyop_SAVE, 1,
+  yyop_STRING, 146, 2, 12508,
+  yyop_JUMP, 12512,
+  yyop_RESTORE, 1,
+  yyop_STRING, 275, 2, 12531,
+  yyop_CALL, 14909, 12531,
+  yyop_TEST, 32, 12527,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 12527,
+  yyop_JUMP, 12515,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 12531,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12534: HtmlBlockH3 */
+  yyop_ENTER, 121, 4,
+  yyop_TEST, 44, 12582,
+  yyop_SAVE, 0,
+  yyop_CALL, 12621, 12582,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 12559,
+  yyop_SAVE, 2,
+  yyop_CALL, 12534, 12559,
+  yyop_JUMP, 12572,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 12583, 12570,
+  yyop_JUMP, 12574,
+  yyop_RESTORE, 3,
+  yyop_DOT, 12574,
+  yyop_JUMP, 12545,
+  yyop_RESTORE, 1,
+  yyop_CALL, 12583, 12580,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12583: HtmlBlockCloseH3 */
+  yyop_ENTER, 120, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12620,
+  yyop_CALL, 14909, 12618,
+  yyop_CHAR, 47, 12618,
+  yyop_SAVE, 1,
+  yyop_STRING, 144, 2, 12607,
+  yyop_JUMP, 12611,
+  yyop_RESTORE, 1,
+  yyop_STRING, 273, 2, 12618,
+  yyop_CALL, 14909, 12618,
+  yyop_CHAR, 62, 12618,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12621: HtmlBlockOpenH3 */
+  yyop_ENTER, 119, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12667,
+  yyop_CALL, 14909, 12665,
+  yyop_SAVE, 1,
+  yyop_STRING, 144, 2, 12642,
+  yyop_JUMP, 12646,
+  yyop_RESTORE, 1,
+  yyop_STRING, 273, 2, 12665,
+  yyop_CALL, 14909, 12665,
+  yyop_TEST, 32, 12661,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 12661,
+  yyop_JUMP, 12649,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 12665,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12668: HtmlBlockH2 */
+  yyop_ENTER, 118, 4,
+  yyop_TEST, 44, 12716,
+  yyop_SAVE, 0,
+  yyop_CALL, 12755, 12716,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 12693,
+  yyop_SAVE, 2,
+  yyop_CALL, 12668, 12693,
+  yyop_JUMP, 12706,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 12717, 12704,
+  yyop_JUMP, 12708,
+  yyop_RESTORE, 3,
+  yyop_DOT, 12708,
+  yyop_JUMP, 12679,
+  yyop_RESTORE, 1,
+  yyop_CALL, 12717, 12714,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12717: HtmlBlockCloseH2 */
+  yyop_ENTER, 117, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12754,
+  yyop_CALL, 14909, 12752,
+  yyop_CHAR, 47, 12752,
+  yyop_SAVE, 1,
+  yyop_STRING, 142, 2, 12741,
+  yyop_JUMP, 12745,
+  yyop_RESTORE, 1,
+  yyop_STRING, 271, 2, 12752,
+  yyop_CALL, 14909, 12752,
+  yyop_CHAR, 62, 12752,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12755: HtmlBlockOpenH2 */
+  yyop_ENTER, 116, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12801,
+  yyop_CALL, 14909, 12799,
+  yyop_SAVE, 1,
+  yyop_STRING, 142, 2, 12776,
+  yyop_JUMP, 12780,
+  yyop_RESTORE, 1,
+  yyop_STRING, 271, 2, 12799,
+  yyop_CALL, 14909, 12799,
+  yyop_TEST, 32, 12795,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 12795,
+  yyop_JUMP, 12783,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 12799,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12802: HtmlBlockH1 */
+  yyop_ENTER, 115, 4,
+  yyop_TEST, 44, 12850,
+  yyop_SAVE, 0,
+  yyop_CALL, 12889, 12850,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 12827,
+  yyop_SAVE, 2,
+  yyop_CALL, 12802, 12827,
+  yyop_JUMP, 12840,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 12851, 12838,
+  yyop_JUMP, 12842,
+  yyop_RESTORE, 3,
+  yyop_DOT, 12842,
+  yyop_JUMP, 12813,
+  yyop_RESTORE, 1,
+  yyop_CALL, 12851, 12848,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12851: HtmlBlockCloseH1 */
+  yyop_ENTER, 114, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12888,
+  yyop_CALL, 14909, 12886,
+  yyop_CHAR, 47, 12886,
+  yyop_SAVE, 1,
+  yyop_STRING, 140, 2, 12875,
+  yyop_JUMP, 12879,
+  yyop_RESTORE, 1,
+  yyop_STRING, 269, 2, 12886,
+  yyop_CALL, 14909, 12886,
+  yyop_CHAR, 62, 12886,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12889: HtmlBlockOpenH1 */
+  yyop_ENTER, 113, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 12935,
+  yyop_CALL, 14909, 12933,
+  yyop_SAVE, 1,
+  yyop_STRING, 140, 2, 12910,
+  yyop_JUMP, 12914,
+  yyop_RESTORE, 1,
+  yyop_STRING, 269, 2, 12933,
+  yyop_CALL, 14909, 12933,
+  yyop_TEST, 32, 12929,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 12929,
+  yyop_JUMP, 12917,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 12933,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12936: HtmlBlockHgroup */
+  yyop_ENTER, 112, 4,
+  yyop_TEST, 44, 12984,
+  yyop_SAVE, 0,
+  yyop_CALL, 13023, 12984,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 12961,
+  yyop_SAVE, 2,
+  yyop_CALL, 12936, 12961,
+  yyop_JUMP, 12974,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 12985, 12972,
+  yyop_JUMP, 12976,
+  yyop_RESTORE, 3,
+  yyop_DOT, 12976,
+  yyop_JUMP, 12947,
+  yyop_RESTORE, 1,
+  yyop_CALL, 12985, 12982,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 12985: HtmlBlockCloseHgroup */
+  yyop_ENTER, 111, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13022,
+  yyop_CALL, 14909, 13020,
+  yyop_CHAR, 47, 13020,
+  yyop_SAVE, 1,
+  yyop_STRING, 402, 6, 13009,
+  yyop_JUMP, 13013,
+  yyop_RESTORE, 1,
+  yyop_STRING, 408, 6, 13020,
+  yyop_CALL, 14909, 13020,
+  yyop_CHAR, 62, 13020,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13023: HtmlBlockOpenHgroup */
+  yyop_ENTER, 110, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13069,
+  yyop_CALL, 14909, 13067,
+  yyop_SAVE, 1,
+  yyop_STRING, 402, 6, 13044,
+  yyop_JUMP, 13048,
+  yyop_RESTORE, 1,
+  yyop_STRING, 408, 6, 13067,
+  yyop_CALL, 14909, 13067,
+  yyop_TEST, 32, 13063,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 13063,
+  yyop_JUMP, 13051,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 13067,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13070: HtmlBlockHeader */
+  yyop_ENTER, 109, 4,
+  yyop_TEST, 44, 13118,
+  yyop_SAVE, 0,
+  yyop_CALL, 13157, 13118,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 13095,
+  yyop_SAVE, 2,
+  yyop_CALL, 13070, 13095,
+  yyop_JUMP, 13108,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 13119, 13106,
+  yyop_JUMP, 13110,
+  yyop_RESTORE, 3,
+  yyop_DOT, 13110,
+  yyop_JUMP, 13081,
+  yyop_RESTORE, 1,
+  yyop_CALL, 13119, 13116,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13119: HtmlBlockCloseHeader */
+  yyop_ENTER, 108, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13156,
+  yyop_CALL, 14909, 13154,
+  yyop_CHAR, 47, 13154,
+  yyop_SAVE, 1,
+  yyop_STRING, 414, 6, 13143,
+  yyop_JUMP, 13147,
+  yyop_RESTORE, 1,
+  yyop_STRING, 420, 6, 13154,
+  yyop_CALL, 14909, 13154,
+  yyop_CHAR, 62, 13154,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13157: HtmlBlockOpenHeader */
+  yyop_ENTER, 107, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13203,
+  yyop_CALL, 14909, 13201,
+  yyop_SAVE, 1,
+  yyop_STRING, 414, 6, 13178,
+  yyop_JUMP, 13182,
+  yyop_RESTORE, 1,
+  yyop_STRING, 420, 6, 13201,
+  yyop_CALL, 14909, 13201,
+  yyop_TEST, 32, 13197,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 13197,
+  yyop_JUMP, 13185,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 13201,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13204: HtmlBlockForm */
+  yyop_ENTER, 106, 4,
+  yyop_TEST, 44, 13252,
+  yyop_SAVE, 0,
+  yyop_CALL, 13291, 13252,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 13229,
+  yyop_SAVE, 2,
+  yyop_CALL, 13204, 13229,
+  yyop_JUMP, 13242,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 13253, 13240,
+  yyop_JUMP, 13244,
+  yyop_RESTORE, 3,
+  yyop_DOT, 13244,
+  yyop_JUMP, 13215,
+  yyop_RESTORE, 1,
+  yyop_CALL, 13253, 13250,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13253: HtmlBlockCloseForm */
+  yyop_ENTER, 105, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13290,
+  yyop_CALL, 14909, 13288,
+  yyop_CHAR, 47, 13288,
+  yyop_SAVE, 1,
+  yyop_STRING, 136, 4, 13277,
+  yyop_JUMP, 13281,
+  yyop_RESTORE, 1,
+  yyop_STRING, 265, 4, 13288,
+  yyop_CALL, 14909, 13288,
+  yyop_CHAR, 62, 13288,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13291: HtmlBlockOpenForm */
+  yyop_ENTER, 104, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13337,
+  yyop_CALL, 14909, 13335,
+  yyop_SAVE, 1,
+  yyop_STRING, 136, 4, 13312,
+  yyop_JUMP, 13316,
+  yyop_RESTORE, 1,
+  yyop_STRING, 265, 4, 13335,
+  yyop_CALL, 14909, 13335,
+  yyop_TEST, 32, 13331,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 13331,
+  yyop_JUMP, 13319,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 13335,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13338: HtmlBlockFooter */
+  yyop_ENTER, 103, 4,
+  yyop_TEST, 44, 13386,
+  yyop_SAVE, 0,
+  yyop_CALL, 13425, 13386,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 13363,
+  yyop_SAVE, 2,
+  yyop_CALL, 13338, 13363,
+  yyop_JUMP, 13376,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 13387, 13374,
+  yyop_JUMP, 13378,
+  yyop_RESTORE, 3,
+  yyop_DOT, 13378,
+  yyop_JUMP, 13349,
+  yyop_RESTORE, 1,
+  yyop_CALL, 13387, 13384,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13387: HtmlBlockCloseFooter */
+  yyop_ENTER, 102, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13424,
+  yyop_CALL, 14909, 13422,
+  yyop_CHAR, 47, 13422,
+  yyop_SAVE, 1,
+  yyop_STRING, 426, 6, 13411,
+  yyop_JUMP, 13415,
+  yyop_RESTORE, 1,
+  yyop_STRING, 432, 6, 13422,
+  yyop_CALL, 14909, 13422,
+  yyop_CHAR, 62, 13422,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13425: HtmlBlockOpenFooter */
+  yyop_ENTER, 101, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13471,
+  yyop_CALL, 14909, 13469,
+  yyop_SAVE, 1,
+  yyop_STRING, 426, 6, 13446,
+  yyop_JUMP, 13450,
+  yyop_RESTORE, 1,
+  yyop_STRING, 432, 6, 13469,
+  yyop_CALL, 14909, 13469,
+  yyop_TEST, 32, 13465,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 13465,
+  yyop_JUMP, 13453,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 13469,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13472: HtmlBlockFigure */
+  yyop_ENTER, 100, 4,
+  yyop_TEST, 44, 13520,
+  yyop_SAVE, 0,
+  yyop_CALL, 13559, 13520,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 13497,
+  yyop_SAVE, 2,
+  yyop_CALL, 13472, 13497,
+  yyop_JUMP, 13510,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 13521, 13508,
+  yyop_JUMP, 13512,
+  yyop_RESTORE, 3,
+  yyop_DOT, 13512,
+  yyop_JUMP, 13483,
+  yyop_RESTORE, 1,
+  yyop_CALL, 13521, 13518,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13521: HtmlBlockCloseFigure */
+  yyop_ENTER, 99, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13558,
+  yyop_CALL, 14909, 13556,
+  yyop_CHAR, 47, 13556,
+  yyop_SAVE, 1,
+  yyop_STRING, 438, 6, 13545,
+  yyop_JUMP, 13549,
+  yyop_RESTORE, 1,
+  yyop_STRING, 444, 6, 13556,
+  yyop_CALL, 14909, 13556,
+  yyop_CHAR, 62, 13556,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13559: HtmlBlockOpenFigure */
+  yyop_ENTER, 98, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13605,
+  yyop_CALL, 14909, 13603,
+  yyop_SAVE, 1,
+  yyop_STRING, 438, 6, 13580,
+  yyop_JUMP, 13584,
+  yyop_RESTORE, 1,
+  yyop_STRING, 444, 6, 13603,
+  yyop_CALL, 14909, 13603,
+  yyop_TEST, 32, 13599,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 13599,
+  yyop_JUMP, 13587,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 13603,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13606: HtmlBlockFieldset */
+  yyop_ENTER, 97, 4,
+  yyop_TEST, 44, 13654,
+  yyop_SAVE, 0,
+  yyop_CALL, 13693, 13654,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 13631,
+  yyop_SAVE, 2,
+  yyop_CALL, 13606, 13631,
+  yyop_JUMP, 13644,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 13655, 13642,
+  yyop_JUMP, 13646,
+  yyop_RESTORE, 3,
+  yyop_DOT, 13646,
+  yyop_JUMP, 13617,
+  yyop_RESTORE, 1,
+  yyop_CALL, 13655, 13652,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13655: HtmlBlockCloseFieldset */
+  yyop_ENTER, 96, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13692,
+  yyop_CALL, 14909, 13690,
+  yyop_CHAR, 47, 13690,
+  yyop_SAVE, 1,
+  yyop_STRING, 128, 8, 13679,
+  yyop_JUMP, 13683,
+  yyop_RESTORE, 1,
+  yyop_STRING, 257, 8, 13690,
+  yyop_CALL, 14909, 13690,
+  yyop_CHAR, 62, 13690,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13693: HtmlBlockOpenFieldset */
+  yyop_ENTER, 95, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13739,
+  yyop_CALL, 14909, 13737,
+  yyop_SAVE, 1,
+  yyop_STRING, 128, 8, 13714,
+  yyop_JUMP, 13718,
+  yyop_RESTORE, 1,
+  yyop_STRING, 257, 8, 13737,
+  yyop_CALL, 14909, 13737,
+  yyop_TEST, 32, 13733,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 13733,
+  yyop_JUMP, 13721,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 13737,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13740: HtmlBlockDl */
+  yyop_ENTER, 94, 4,
+  yyop_TEST, 44, 13788,
+  yyop_SAVE, 0,
+  yyop_CALL, 13827, 13788,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 13765,
+  yyop_SAVE, 2,
+  yyop_CALL, 13740, 13765,
+  yyop_JUMP, 13778,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 13789, 13776,
+  yyop_JUMP, 13780,
+  yyop_RESTORE, 3,
+  yyop_DOT, 13780,
+  yyop_JUMP, 13751,
+  yyop_RESTORE, 1,
+  yyop_CALL, 13789, 13786,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13789: HtmlBlockCloseDl */
+  yyop_ENTER, 93, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13826,
+  yyop_CALL, 14909, 13824,
+  yyop_CHAR, 47, 13824,
+  yyop_SAVE, 1,
+  yyop_STRING, 126, 2, 13813,
+  yyop_JUMP, 13817,
+  yyop_RESTORE, 1,
+  yyop_STRING, 255, 2, 13824,
+  yyop_CALL, 14909, 13824,
+  yyop_CHAR, 62, 13824,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13827: HtmlBlockOpenDl */
+  yyop_ENTER, 92, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13873,
+  yyop_CALL, 14909, 13871,
+  yyop_SAVE, 1,
+  yyop_STRING, 126, 2, 13848,
+  yyop_JUMP, 13852,
+  yyop_RESTORE, 1,
+  yyop_STRING, 255, 2, 13871,
+  yyop_CALL, 14909, 13871,
+  yyop_TEST, 32, 13867,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 13867,
+  yyop_JUMP, 13855,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 13871,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13874: HtmlBlockDiv */
+  yyop_ENTER, 91, 4,
+  yyop_TEST, 44, 13922,
+  yyop_SAVE, 0,
+  yyop_CALL, 17807, 13922,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 13899,
+  yyop_SAVE, 2,
+  yyop_CALL, 13874, 13899,
+  yyop_JUMP, 13912,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 13923, 13910,
+  yyop_JUMP, 13914,
+  yyop_RESTORE, 3,
+  yyop_DOT, 13914,
+  yyop_JUMP, 13885,
+  yyop_RESTORE, 1,
+  yyop_CALL, 13923, 13920,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13923: HtmlBlockCloseDiv */
+  yyop_ENTER, 90, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 13960,
+  yyop_CALL, 14909, 13958,
+  yyop_CHAR, 47, 13958,
+  yyop_SAVE, 1,
+  yyop_STRING, 123, 3, 13947,
+  yyop_JUMP, 13951,
+  yyop_RESTORE, 1,
+  yyop_STRING, 252, 3, 13958,
+  yyop_CALL, 14909, 13958,
+  yyop_CHAR, 62, 13958,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 13961: HtmlBlockDir */
+  yyop_ENTER, 89, 4,
+  yyop_TEST, 44, 14009,
+  yyop_SAVE, 0,
+  yyop_CALL, 14048, 14009,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 13986,
+  yyop_SAVE, 2,
+  yyop_CALL, 13961, 13986,
+  yyop_JUMP, 13999,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 14010, 13997,
+  yyop_JUMP, 14001,
+  yyop_RESTORE, 3,
+  yyop_DOT, 14001,
+  yyop_JUMP, 13972,
+  yyop_RESTORE, 1,
+  yyop_CALL, 14010, 14007,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14010: HtmlBlockCloseDir */
+  yyop_ENTER, 88, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14047,
+  yyop_CALL, 14909, 14045,
+  yyop_CHAR, 47, 14045,
+  yyop_SAVE, 1,
+  yyop_STRING, 120, 3, 14034,
+  yyop_JUMP, 14038,
+  yyop_RESTORE, 1,
+  yyop_STRING, 249, 3, 14045,
+  yyop_CALL, 14909, 14045,
+  yyop_CHAR, 62, 14045,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14048: HtmlBlockOpenDir */
+  yyop_ENTER, 87, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14094,
+  yyop_CALL, 14909, 14092,
+  yyop_SAVE, 1,
+  yyop_STRING, 120, 3, 14069,
+  yyop_JUMP, 14073,
+  yyop_RESTORE, 1,
+  yyop_STRING, 249, 3, 14092,
+  yyop_CALL, 14909, 14092,
+  yyop_TEST, 32, 14088,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 14088,
+  yyop_JUMP, 14076,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 14092,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14095: HtmlBlockCenter */
+  yyop_ENTER, 86, 4,
+  yyop_TEST, 44, 14143,
+  yyop_SAVE, 0,
+  yyop_CALL, 14182, 14143,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 14120,
+  yyop_SAVE, 2,
+  yyop_CALL, 14095, 14120,
+  yyop_JUMP, 14133,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 14144, 14131,
+  yyop_JUMP, 14135,
+  yyop_RESTORE, 3,
+  yyop_DOT, 14135,
+  yyop_JUMP, 14106,
+  yyop_RESTORE, 1,
+  yyop_CALL, 14144, 14141,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14144: HtmlBlockCloseCenter */
+  yyop_ENTER, 85, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14181,
+  yyop_CALL, 14909, 14179,
+  yyop_CHAR, 47, 14179,
+  yyop_SAVE, 1,
+  yyop_STRING, 114, 6, 14168,
+  yyop_JUMP, 14172,
+  yyop_RESTORE, 1,
+  yyop_STRING, 243, 6, 14179,
+  yyop_CALL, 14909, 14179,
+  yyop_CHAR, 62, 14179,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14182: HtmlBlockOpenCenter */
+  yyop_ENTER, 84, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14228,
+  yyop_CALL, 14909, 14226,
+  yyop_SAVE, 1,
+  yyop_STRING, 114, 6, 14203,
+  yyop_JUMP, 14207,
+  yyop_RESTORE, 1,
+  yyop_STRING, 243, 6, 14226,
+  yyop_CALL, 14909, 14226,
+  yyop_TEST, 32, 14222,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 14222,
+  yyop_JUMP, 14210,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 14226,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14229: HtmlBlockCanvas */
+  yyop_ENTER, 83, 4,
+  yyop_TEST, 44, 14277,
+  yyop_SAVE, 0,
+  yyop_CALL, 14316, 14277,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 14254,
+  yyop_SAVE, 2,
+  yyop_CALL, 14229, 14254,
+  yyop_JUMP, 14267,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 14278, 14265,
+  yyop_JUMP, 14269,
+  yyop_RESTORE, 3,
+  yyop_DOT, 14269,
+  yyop_JUMP, 14240,
+  yyop_RESTORE, 1,
+  yyop_CALL, 14278, 14275,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14278: HtmlBlockCloseCanvas */
+  yyop_ENTER, 82, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14315,
+  yyop_CALL, 14909, 14313,
+  yyop_CHAR, 47, 14313,
+  yyop_SAVE, 1,
+  yyop_STRING, 450, 6, 14302,
+  yyop_JUMP, 14306,
+  yyop_RESTORE, 1,
+  yyop_STRING, 456, 6, 14313,
+  yyop_CALL, 14909, 14313,
+  yyop_CHAR, 62, 14313,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14316: HtmlBlockOpenCanvas */
+  yyop_ENTER, 81, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14362,
+  yyop_CALL, 14909, 14360,
+  yyop_SAVE, 1,
+  yyop_STRING, 450, 6, 14337,
+  yyop_JUMP, 14341,
+  yyop_RESTORE, 1,
+  yyop_STRING, 456, 6, 14360,
+  yyop_CALL, 14909, 14360,
+  yyop_TEST, 32, 14356,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 14356,
+  yyop_JUMP, 14344,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 14360,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14363: HtmlBlockBlockquote */
+  yyop_ENTER, 80, 4,
+  yyop_TEST, 44, 14411,
+  yyop_SAVE, 0,
+  yyop_CALL, 14450, 14411,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 14388,
+  yyop_SAVE, 2,
+  yyop_CALL, 14363, 14388,
+  yyop_JUMP, 14401,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 14412, 14399,
+  yyop_JUMP, 14403,
+  yyop_RESTORE, 3,
+  yyop_DOT, 14403,
+  yyop_JUMP, 14374,
+  yyop_RESTORE, 1,
+  yyop_CALL, 14412, 14409,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14412: HtmlBlockCloseBlockquote */
+  yyop_ENTER, 79, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14449,
+  yyop_CALL, 14909, 14447,
+  yyop_CHAR, 47, 14447,
+  yyop_SAVE, 1,
+  yyop_STRING, 104, 10, 14436,
+  yyop_JUMP, 14440,
+  yyop_RESTORE, 1,
+  yyop_STRING, 233, 10, 14447,
+  yyop_CALL, 14909, 14447,
+  yyop_CHAR, 62, 14447,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14450: HtmlBlockOpenBlockquote */
+  yyop_ENTER, 78, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14496,
+  yyop_CALL, 14909, 14494,
+  yyop_SAVE, 1,
+  yyop_STRING, 104, 10, 14471,
+  yyop_JUMP, 14475,
+  yyop_RESTORE, 1,
+  yyop_STRING, 233, 10, 14494,
+  yyop_CALL, 14909, 14494,
+  yyop_TEST, 32, 14490,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 14490,
+  yyop_JUMP, 14478,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 14494,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14497: HtmlBlockAside */
+  yyop_ENTER, 77, 4,
+  yyop_TEST, 44, 14545,
+  yyop_SAVE, 0,
+  yyop_CALL, 14584, 14545,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 14522,
+  yyop_SAVE, 2,
+  yyop_CALL, 14497, 14522,
+  yyop_JUMP, 14535,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 14546, 14533,
+  yyop_JUMP, 14537,
+  yyop_RESTORE, 3,
+  yyop_DOT, 14537,
+  yyop_JUMP, 14508,
+  yyop_RESTORE, 1,
+  yyop_CALL, 14546, 14543,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14546: HtmlBlockCloseAside */
+  yyop_ENTER, 76, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14583,
+  yyop_CALL, 14909, 14581,
+  yyop_CHAR, 47, 14581,
+  yyop_SAVE, 1,
+  yyop_STRING, 462, 5, 14570,
+  yyop_JUMP, 14574,
+  yyop_RESTORE, 1,
+  yyop_STRING, 467, 5, 14581,
+  yyop_CALL, 14909, 14581,
+  yyop_CHAR, 62, 14581,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14584: HtmlBlockOpenAside */
+  yyop_ENTER, 75, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14630,
+  yyop_CALL, 14909, 14628,
+  yyop_SAVE, 1,
+  yyop_STRING, 462, 5, 14605,
+  yyop_JUMP, 14609,
+  yyop_RESTORE, 1,
+  yyop_STRING, 467, 5, 14628,
+  yyop_CALL, 14909, 14628,
+  yyop_TEST, 32, 14624,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 14624,
+  yyop_JUMP, 14612,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 14628,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14631: HtmlBlockArticle */
+  yyop_ENTER, 74, 4,
+  yyop_TEST, 44, 14679,
+  yyop_SAVE, 0,
+  yyop_CALL, 14718, 14679,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 14656,
+  yyop_SAVE, 2,
+  yyop_CALL, 14631, 14656,
+  yyop_JUMP, 14669,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 14680, 14667,
+  yyop_JUMP, 14671,
+  yyop_RESTORE, 3,
+  yyop_DOT, 14671,
+  yyop_JUMP, 14642,
+  yyop_RESTORE, 1,
+  yyop_CALL, 14680, 14677,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14680: HtmlBlockCloseArticle */
+  yyop_ENTER, 73, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14717,
+  yyop_CALL, 14909, 14715,
+  yyop_CHAR, 47, 14715,
+  yyop_SAVE, 1,
+  yyop_STRING, 472, 7, 14704,
+  yyop_JUMP, 14708,
+  yyop_RESTORE, 1,
+  yyop_STRING, 479, 7, 14715,
+  yyop_CALL, 14909, 14715,
+  yyop_CHAR, 62, 14715,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14718: HtmlBlockOpenArticle */
+  yyop_ENTER, 72, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14764,
+  yyop_CALL, 14909, 14762,
+  yyop_SAVE, 1,
+  yyop_STRING, 472, 7, 14739,
+  yyop_JUMP, 14743,
+  yyop_RESTORE, 1,
+  yyop_STRING, 479, 7, 14762,
+  yyop_CALL, 14909, 14762,
+  yyop_TEST, 32, 14758,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 14758,
+  yyop_JUMP, 14746,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 14762,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14765: HtmlBlockAddress */
+  yyop_ENTER, 71, 4,
+  yyop_TEST, 44, 14813,
+  yyop_SAVE, 0,
+  yyop_CALL, 14931, 14813,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 14790,
+  yyop_SAVE, 2,
+  yyop_CALL, 14765, 14790,
+  yyop_JUMP, 14803,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 14814, 14801,
+  yyop_JUMP, 14805,
+  yyop_RESTORE, 3,
+  yyop_DOT, 14805,
+  yyop_JUMP, 14776,
+  yyop_RESTORE, 1,
+  yyop_CALL, 14814, 14811,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14814: HtmlBlockCloseAddress */
+  yyop_ENTER, 70, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14851,
+  yyop_CALL, 14909, 14849,
+  yyop_CHAR, 47, 14849,
+  yyop_SAVE, 1,
+  yyop_STRING, 97, 7, 14838,
+  yyop_JUMP, 14842,
+  yyop_RESTORE, 1,
+  yyop_STRING, 226, 7, 14849,
+  yyop_CALL, 14909, 14849,
+  yyop_CHAR, 62, 14849,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14852: HtmlAttribute */
+  yyop_ENTER, 69, 3,
+  yyop_TEST, 32, 14908,
+  yyop_SAVE, 0,
+  yyop_CLASS, 32, 14908,
+  yyop_SPAN, 32,
+  yyop_CALL, 14909, 14906,
+  yyop_SAVE, 1,
+  yyop_CHAR, 61, 14902,
+  yyop_CALL, 14909, 14900,
+  yyop_TEST, 29, 14888,
+  yyop_SAVE, 2,
+  yyop_CALL, 3321, 14888,
+  yyop_JUMP, 14898,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 40, 14900,
+  yyop_CLASS, 61, 14900,
+  yyop_SPAN, 61,
+  yyop_JUMP, 14902,
+  yyop_RESTORE, 1,
+  yyop_CALL, 14909, 14906,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14909: Spnl */
+  yyop_ENTER, 68, 2,
+  yyop_SAVE, 0,
+  yyop_SPAN, 4,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 14927,
+  yyop_SPAN, 4,
+  yyop_JUMP, 14927,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14931: HtmlBlockOpenAddress */
+  yyop_ENTER, 67, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 14977,
+  yyop_CALL, 14909, 14975,
+  yyop_SAVE, 1,
+  yyop_STRING, 97, 7, 14952,
+  yyop_JUMP, 14956,
+  yyop_RESTORE, 1,
+  yyop_STRING, 226, 7, 14975,
+  yyop_CALL, 14909, 14975,
+  yyop_TEST, 32, 14971,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 14971,
+  yyop_JUMP, 14959,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 14975,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 14978: OptionallyIndentedLine */
+  yyop_ENTER, 66, 3,
+  yyop_SAVE, 0,
+  yyop_TEST, 4, 15005,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 9, 14997,
+  yyop_JUMP, 15001,
+  yyop_RESTORE, 2,
+  yyop_STRING, 20, 4, 15003,
+  yyop_JUMP, 15005,
+  yyop_RESTORE, 1,
+  yyop_CALL, 18952, 15011,
+  yyop_ACTION, 95,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15014: Indent */
+  yyop_ENTER, 65, 2,
+  yyop_TEST, 4, 15038,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CHAR, 9, 15031,
+  yyop_JUMP, 15035,
+  yyop_RESTORE, 1,
+  yyop_STRING, 20, 4, 15036,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15039: ListBlockLine */
+  yyop_ENTER, 64, 4,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15053,
+  yyop_JUMP, 15140,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 4, 15079,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 9, 15071,
+  yyop_JUMP, 15075,
+  yyop_RESTORE, 3,
+  yyop_STRING, 20, 4, 15077,
+  yyop_JUMP, 15079,
+  yyop_RESTORE, 2,
+  yyop_TEST, 62, 15091,
+  yyop_SAVE, 2,
+  yyop_CALL, 15650, 15091,
+  yyop_JUMP, 15099,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 63, 15101,
+  yyop_CALL, 15357, 15101,
+  yyop_JUMP, 15140,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 18302, 15112,
+  yyop_JUMP, 15140,
+  yyop_RESTORE, 1,
+  yyop_TEST, 4, 15134,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 9, 15126,
+  yyop_JUMP, 15130,
+  yyop_RESTORE, 2,
+  yyop_STRING, 20, 4, 15132,
+  yyop_JUMP, 15134,
+  yyop_RESTORE, 1,
+  yyop_CALL, 18952, 15140,
+  yyop_ACTION, 95,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15143: ListContinuationBlock */
+  yyop_ENTER, 63, 3,
+  yyop_TEST, 6, 15235,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 15233,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_BEGIN, 15233,
+  yyop_TEST, 6, 15179,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15177,
+  yyop_JUMP, 15165,
+  yyop_RESTORE, 1,
+  yyop_END, 15233,
+  yyop_ACTION, 159,
+  yyop_SAVE, 1,
+  yyop_CHAR, 9, 15192,
+  yyop_JUMP, 15196,
+  yyop_RESTORE, 1,
+  yyop_STRING, 20, 4, 15233,
+  yyop_CALL, 15236, 15233,
+  yyop_ACTION, 158,
+  yyop_TEST, 4, 15228,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 9, 15215,
+  yyop_JUMP, 15219,
+  yyop_RESTORE, 2,
+  yyop_STRING, 20, 4, 15226,
+  yyop_CALL, 15236, 15226,
+  yyop_ACTION, 158,
+  yyop_JUMP, 15201,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 157,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15236: ListBlock */
+  yyop_ENTER, 62, 2,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 15287,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15262,
+  yyop_JUMP, 15287,
+  yyop_RESTORE, 1,
+  yyop_CALL, 18952, 15287,
+  yyop_ACTION, 95,
+  yyop_ACTION, 162,
+  yyop_SAVE, 1,
+  yyop_CALL, 15039, 15282,
+  yyop_ACTION, 161,
+  yyop_JUMP, 15271,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 160,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15290: ListItem */
+  yyop_ENTER, 61, 2,
+  yyop_TEST, 64, 15356,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_TEST, 62, 15312,
+  yyop_SAVE, 1,
+  yyop_CALL, 15650, 15312,
+  yyop_JUMP, 15320,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 63, 15354,
+  yyop_CALL, 15357, 15354,
+  yyop_SAVE, 1,
+  yyop_DOT, 15354,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_CALL, 15236, 15354,
+  yyop_ACTION, 168,
+  yyop_TEST, 6, 15349,
+  yyop_SAVE, 1,
+  yyop_CALL, 15143, 15349,
+  yyop_ACTION, 167,
+  yyop_JUMP, 15335,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 166,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15357: Enumerator */
+  yyop_ENTER, 60, 1,
+  yyop_TEST, 63, 15384,
+  yyop_SAVE, 0,
+  yyop_CALL, 17458, 15384,
+  yyop_CLASS, 23, 15382,
+  yyop_SPAN, 23,
+  yyop_CHAR, 46, 15382,
+  yyop_CLASS, 4, 15382,
+  yyop_SPAN, 4,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15385: ListItemTight */
+  yyop_ENTER, 59, 3,
+  yyop_TEST, 64, 15471,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_TEST, 62, 15407,
+  yyop_SAVE, 1,
+  yyop_CALL, 15650, 15407,
+  yyop_JUMP, 15415,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 63, 15469,
+  yyop_CALL, 15357, 15469,
+  yyop_SAVE, 1,
+  yyop_DOT, 15469,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_CALL, 15236, 15469,
+  yyop_ACTION, 165,
+  yyop_TEST, 6, 15455,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15444,
+  yyop_JUMP, 15453,
+  yyop_RESTORE, 2,
+  yyop_CALL, 15143, 15453,
+  yyop_ACTION, 164,
+  yyop_JUMP, 15430,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 15143, 15464,
+  yyop_JUMP, 15469,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 163,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15472: ListLoose */
+  yyop_ENTER, 58, 3,
+  yyop_TEST, 64, 15550,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_SAVE, 1,
+  yyop_DOT, 15548,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_CALL, 15290, 15548,
+  yyop_SET, 1,
+  yyop_TEST, 6, 15511,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15509,
+  yyop_JUMP, 15497,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 170,
+  yyop_TEST, 64, 15543,
+  yyop_SAVE, 1,
+  yyop_CALL, 15290, 15543,
+  yyop_SET, 1,
+  yyop_TEST, 6, 15537,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15535,
+  yyop_JUMP, 15523,
+  yyop_RESTORE, 2,
+  yyop_ACTION, 170,
+  yyop_JUMP, 15513,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 169,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15551: ListTight */
+  yyop_ENTER, 57, 3,
+  yyop_TEST, 64, 15637,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 15635,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_CALL, 15385, 15635,
+  yyop_ACTION, 172,
+  yyop_TEST, 64, 15590,
+  yyop_SAVE, 1,
+  yyop_CALL, 15385, 15590,
+  yyop_ACTION, 172,
+  yyop_JUMP, 15576,
+  yyop_RESTORE, 1,
+  yyop_TEST, 6, 15604,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15602,
+  yyop_JUMP, 15590,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 62, 15618,
+  yyop_SAVE, 2,
+  yyop_CALL, 15650, 15618,
+  yyop_JUMP, 15626,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 63, 15628,
+  yyop_CALL, 15357, 15628,
+  yyop_JUMP, 15635,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 171,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15638: Spacechar */
+  yyop_ENTER, 56, 1,
+  yyop_SAVE, 0,
+  yyop_CLASS, 4, 15649,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15650: Bullet */
+  yyop_ENTER, 55, 2,
+  yyop_TEST, 62, 15681,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 18302, 15667,
+  yyop_JUMP, 15679,
+  yyop_RESTORE, 1,
+  yyop_CALL, 17458, 15679,
+  yyop_CLASS, 65, 15679,
+  yyop_CLASS, 4, 15679,
+  yyop_SPAN, 4,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15682: VerbatimChunk */
+  yyop_ENTER, 54, 3,
+  yyop_TEST, 6, 15796,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 15794,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_TEST, 6, 15718,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15716,
+  yyop_ACTION, 179,
+  yyop_JUMP, 15702,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15727,
+  yyop_JUMP, 15794,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 9, 15738,
+  yyop_JUMP, 15742,
+  yyop_RESTORE, 1,
+  yyop_STRING, 20, 4, 15794,
+  yyop_CALL, 18952, 15794,
+  yyop_ACTION, 95,
+  yyop_ACTION, 178,
+  yyop_TEST, 4, 15789,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15763,
+  yyop_JUMP, 15787,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 9, 15774,
+  yyop_JUMP, 15778,
+  yyop_RESTORE, 2,
+  yyop_STRING, 20, 4, 15787,
+  yyop_CALL, 18952, 15787,
+  yyop_ACTION, 95,
+  yyop_ACTION, 178,
+  yyop_JUMP, 15749,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 177,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15797: IndentedLine */
+  yyop_ENTER, 53, 2,
+  yyop_TEST, 4, 15826,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CHAR, 9, 15814,
+  yyop_JUMP, 15818,
+  yyop_RESTORE, 1,
+  yyop_STRING, 20, 4, 15824,
+  yyop_CALL, 18952, 15824,
+  yyop_ACTION, 95,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15827: NonblankIndentedLine */
+  yyop_ENTER, 52, 2,
+  yyop_TEST, 4, 15867,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15844,
+  yyop_JUMP, 15865,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 9, 15855,
+  yyop_JUMP, 15859,
+  yyop_RESTORE, 1,
+  yyop_STRING, 20, 4, 15865,
+  yyop_CALL, 18952, 15865,
+  yyop_ACTION, 95,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15868: Line */
+  yyop_ENTER, 51, 1,
+  yyop_SAVE, 0,
+  yyop_CALL, 18952, 15881,
+  yyop_ACTION, 95,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 15882: BlockQuoteRaw */
+  yyop_ENTER, 50, 4,
+  yyop_TEST, 66, 16051,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 16049,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_CHAR, 62, 16049,
+  yyop_SAVE, 1,
+  yyop_CHAR, 32, 15914,
+  yyop_JUMP, 15914,
+  yyop_RESTORE, 1,
+  yyop_CALL, 18952, 16049,
+  yyop_ACTION, 95,
+  yyop_ACTION, 183,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 62, 15932,
+  yyop_JUMP, 15952,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15941,
+  yyop_JUMP, 15952,
+  yyop_RESTORE, 2,
+  yyop_CALL, 18952, 15952,
+  yyop_ACTION, 95,
+  yyop_ACTION, 182,
+  yyop_JUMP, 15921,
+  yyop_RESTORE, 1,
+  yyop_TEST, 6, 15970,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 15968,
+  yyop_ACTION, 181,
+  yyop_JUMP, 15954,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 62, 16044,
+  yyop_SAVE, 2,
+  yyop_CHAR, 32, 15984,
+  yyop_JUMP, 15984,
+  yyop_RESTORE, 2,
+  yyop_CALL, 18952, 16042,
+  yyop_ACTION, 95,
+  yyop_ACTION, 183,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 62, 16002,
+  yyop_JUMP, 16022,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 16011,
+  yyop_JUMP, 16022,
+  yyop_RESTORE, 3,
+  yyop_CALL, 18952, 16022,
+  yyop_ACTION, 95,
+  yyop_ACTION, 182,
+  yyop_JUMP, 15991,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 16040,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 16038,
+  yyop_ACTION, 181,
+  yyop_JUMP, 16024,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 15970,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 180,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 16052: Endline */
+  yyop_ENTER, 49, 2,
+  yyop_TEST, 6, 16093,
+  yyop_SAVE, 0,
+  yyop_TEST, 14, 16072,
+  yyop_SAVE, 1,
+  yyop_CALL, 5842, 16072,
+  yyop_JUMP, 16090,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 6, 16084,
+  yyop_CALL, 5815, 16084,
+  yyop_JUMP, 16090,
+  yyop_RESTORE, 1,
+  yyop_TEST, 6, 16091,
+  yyop_CALL, 5735, 16091,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 16094: SetextBottom2 */
+  yyop_ENTER, 48, 1,
+  yyop_SAVE, 0,
+  yyop_STRING, 32, 3, 16111,
+  yyop_SPAN, 8,
+  yyop_CHAR, 10, 16109,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 16112: SetextBottom1 */
+  yyop_ENTER, 47, 1,
+  yyop_SAVE, 0,
+  yyop_STRING, 72, 3, 16129,
+  yyop_SPAN, 49,
+  yyop_CHAR, 10, 16127,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 16130: SetextHeading2 */
+  yyop_ENTER, 46, 4,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_SAVE, 1,
+  yyop_CALL, 18952, 16318,
+  yyop_CALL, 16094, 16318,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 16318,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_SAVE, 1,
+  yyop_TEST, 14, 16171,
+  yyop_SAVE, 2,
+  yyop_CALL, 5842, 16171,
+  yyop_JUMP, 16189,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 6, 16183,
+  yyop_CALL, 5815, 16183,
+  yyop_JUMP, 16189,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 16191,
+  yyop_CALL, 5735, 16191,
+  yyop_JUMP, 16318,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_PREDICATE, 12, 16207,
+  yyop_SPAN, 4,
+  yyop_CALL, 17014, 16205,
+  yyop_JUMP, 16318,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16698, 16318,
+  yyop_ACTION, 190,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_TEST, 14, 16228,
+  yyop_SAVE, 3,
+  yyop_CALL, 5842, 16228,
+  yyop_JUMP, 16246,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 6, 16240,
+  yyop_CALL, 5815, 16240,
+  yyop_JUMP, 16246,
+  yyop_RESTORE, 3,
+  yyop_TEST, 6, 16248,
+  yyop_CALL, 5735, 16248,
+  yyop_JUMP, 16271,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_PREDICATE, 13, 16264,
+  yyop_SPAN, 4,
+  yyop_CALL, 17014, 16262,
+  yyop_JUMP, 16271,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 16271,
+  yyop_ACTION, 190,
+  yyop_JUMP, 16212,
+  yyop_RESTORE, 1,
+  yyop_TEST, 67, 16299,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CALL, 17014, 16297,
+  yyop_SET, 1,
+  yyop_ACTION, 189,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_JUMP, 16295,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 16299,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_JUMP, 16307,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 10, 16318,
+  yyop_CALL, 16094, 16318,
+  yyop_ACTION, 188,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 16321: SetextHeading1 */
+  yyop_ENTER, 45, 4,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_SAVE, 1,
+  yyop_CALL, 18952, 16509,
+  yyop_CALL, 16112, 16509,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 16509,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_SAVE, 1,
+  yyop_TEST, 14, 16362,
+  yyop_SAVE, 2,
+  yyop_CALL, 5842, 16362,
+  yyop_JUMP, 16380,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 6, 16374,
+  yyop_CALL, 5815, 16374,
+  yyop_JUMP, 16380,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 16382,
+  yyop_CALL, 5735, 16382,
+  yyop_JUMP, 16509,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_PREDICATE, 14, 16398,
+  yyop_SPAN, 4,
+  yyop_CALL, 17014, 16396,
+  yyop_JUMP, 16509,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16698, 16509,
+  yyop_ACTION, 193,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_TEST, 14, 16419,
+  yyop_SAVE, 3,
+  yyop_CALL, 5842, 16419,
+  yyop_JUMP, 16437,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 6, 16431,
+  yyop_CALL, 5815, 16431,
+  yyop_JUMP, 16437,
+  yyop_RESTORE, 3,
+  yyop_TEST, 6, 16439,
+  yyop_CALL, 5735, 16439,
+  yyop_JUMP, 16462,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_PREDICATE, 15, 16455,
+  yyop_SPAN, 4,
+  yyop_CALL, 17014, 16453,
+  yyop_JUMP, 16462,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 16462,
+  yyop_ACTION, 193,
+  yyop_JUMP, 16403,
+  yyop_RESTORE, 1,
+  yyop_TEST, 67, 16490,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CALL, 17014, 16488,
+  yyop_SET, 1,
+  yyop_ACTION, 192,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_JUMP, 16486,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 16490,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_JUMP, 16498,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 10, 16509,
+  yyop_CALL, 16112, 16509,
+  yyop_ACTION, 191,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 16512: SetextHeading */
+  yyop_ENTER, 44, 2,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 16321, 16526,
+  yyop_JUMP, 16529,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16130, 16530,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 16533: AtxHeading */
+  yyop_ENTER, 43, 3,
+  yyop_TEST, 3, 16634,
+  yyop_SAVE, 0,
+  yyop_PUSH, 3,
+  yyop_CALL, 16635, 16632,
+  yyop_SET, 3,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_JUMP, 16556,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 16632,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_CALL, 17131, 16632,
+  yyop_ACTION, 196,
+  yyop_SAVE, 1,
+  yyop_CALL, 17131, 16582,
+  yyop_ACTION, 196,
+  yyop_JUMP, 16571,
+  yyop_RESTORE, 1,
+  yyop_TEST, 67, 16606,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_JUMP, 16595,
+  yyop_RESTORE, 2,
+  yyop_CALL, 17014, 16604,
+  yyop_SET, 1,
+  yyop_ACTION, 195,
+  yyop_JUMP, 16606,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_JUMP, 16616,
+  yyop_RESTORE, 2,
+  yyop_SPAN, 3,
+  yyop_SPAN, 4,
+  yyop_JUMP, 16624,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 10, 16632,
+  yyop_ACTION, 194,
+  yyop_POP, 3,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 16635: AtxStart */
+  yyop_ENTER, 42, 2,
+  yyop_TEST, 3, 16697,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 16697,
+  yyop_SAVE, 1,
+  yyop_STRING, 486, 6, 16655,
+  yyop_JUMP, 16690,
+  yyop_RESTORE, 1,
+  yyop_STRING, 486, 5, 16663,
+  yyop_JUMP, 16690,
+  yyop_RESTORE, 1,
+  yyop_STRING, 486, 4, 16671,
+  yyop_JUMP, 16690,
+  yyop_RESTORE, 1,
+  yyop_STRING, 486, 3, 16679,
+  yyop_JUMP, 16690,
+  yyop_RESTORE, 1,
+  yyop_STRING, 486, 2, 16687,
+  yyop_JUMP, 16690,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 35, 16695,
+  yyop_END, 16695,
+  yyop_ACTION, 197,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 16698: Inline */
+  yyop_ENTER, 41, 4,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 7873, 16712,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 68, 16725,
+  yyop_PREDICATE, 16, 16725,
+  yyop_CALL, 7827, 16725,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 6, 16762,
+  yyop_TEST, 14, 16740,
+  yyop_SAVE, 2,
+  yyop_CALL, 5842, 16740,
+  yyop_JUMP, 16758,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 6, 16752,
+  yyop_CALL, 5815, 16752,
+  yyop_JUMP, 16758,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 16760,
+  yyop_CALL, 5735, 16760,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 58, 16772,
+  yyop_CALL, 7793, 16772,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 4, 16786,
+  yyop_CLASS, 4, 16786,
+  yyop_SPAN, 4,
+  yyop_ACTION, 149,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 57, 16813,
+  yyop_TEST, 45, 16801,
+  yyop_SAVE, 2,
+  yyop_CALL, 5147, 16801,
+  yyop_JUMP, 16809,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 12, 16811,
+  yyop_CALL, 5091, 16811,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 57, 16840,
+  yyop_TEST, 45, 16828,
+  yyop_SAVE, 2,
+  yyop_CALL, 5434, 16828,
+  yyop_JUMP, 16836,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 12, 16838,
+  yyop_CALL, 5378, 16838,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 19, 16853,
+  yyop_PREDICATE, 17, 16853,
+  yyop_CALL, 7678, 16853,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 69, 16863,
+  yyop_CALL, 7627, 16863,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 56, 16934,
+  yyop_TEST, 19, 16878,
+  yyop_SAVE, 2,
+  yyop_CALL, 4863, 16878,
+  yyop_JUMP, 16930,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 19, 16907,
+  yyop_TEST, 19, 16895,
+  yyop_SAVE, 3,
+  yyop_CALL, 4754, 16895,
+  yyop_JUMP, 16903,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 19, 16905,
+  yyop_CALL, 4711, 16905,
+  yyop_JUMP, 16930,
+  yyop_RESTORE, 2,
+  yyop_TEST, 44, 16932,
+  yyop_TEST, 44, 16922,
+  yyop_SAVE, 3,
+  yyop_CALL, 4162, 16922,
+  yyop_JUMP, 16930,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 44, 16932,
+  yyop_CALL, 4077, 16932,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 19, 16944,
+  yyop_CALL, 7525, 16944,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 54, 16954,
+  yyop_CALL, 6342, 16954,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 16964,
+  yyop_CALL, 8677, 16964,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 16974,
+  yyop_CALL, 6294, 16974,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 50, 16984,
+  yyop_CALL, 6250, 16984,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 68, 16994,
+  yyop_CALL, 6220, 16994,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 28, 17004,
+  yyop_CALL, 6136, 17004,
+  yyop_JUMP, 17010,
+  yyop_RESTORE, 1,
+  yyop_TEST, 48, 17011,
+  yyop_CALL, 6115, 17011,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 17014: AutoLabel */
+  yyop_ENTER, 40, 4,
+  yyop_SAVE, 0,
+  yyop_CHAR, 91, 17130,
+  yyop_BEGIN, 17128,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 17033,
+  yyop_JUMP, 17128,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 94, 17042,
+  yyop_JUMP, 17128,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 35, 17051,
+  yyop_JUMP, 17128,
+  yyop_RESTORE, 1,
+  yyop_DOT, 17128,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 17062,
+  yyop_JUMP, 17128,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CHAR, 93, 17071,
+  yyop_JUMP, 17128,
+  yyop_RESTORE, 1,
+  yyop_DOT, 17128,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 10, 17084,
+  yyop_JUMP, 17097,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CHAR, 93, 17093,
+  yyop_JUMP, 17097,
+  yyop_RESTORE, 2,
+  yyop_DOT, 17097,
+  yyop_JUMP, 17073,
+  yyop_RESTORE, 1,
+  yyop_END, 17128,
+  yyop_CHAR, 93, 17128,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_JUMP, 17116,
+  yyop_RESTORE, 3,
+  yyop_CLASS, 70, 17121,
+  yyop_JUMP, 17128,
+  yyop_RESTORE, 2,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 18,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 17131: AtxInline */
+  yyop_ENTER, 39, 3,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 17145,
+  yyop_JUMP, 17199,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_PREDICATE, 18, 17174,
+  yyop_SPAN, 4,
+  yyop_CALL, 17014, 17172,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_JUMP, 17163,
+  yyop_RESTORE, 2,
+  yyop_SPAN, 3,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 17172,
+  yyop_JUMP, 17199,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_JUMP, 17184,
+  yyop_RESTORE, 2,
+  yyop_SPAN, 3,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 17193,
+  yyop_JUMP, 17199,
+  yyop_RESTORE, 1,
+  yyop_CALL, 16698, 17199,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 17202: Inlines */
+  yyop_ENTER, 38, 5,
+  yyop_SAVE, 0,
+  yyop_PUSH, 3,
+  yyop_SAVE, 1,
+  yyop_DOT, 17455,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 3,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_TEST, 14, 17235,
+  yyop_SAVE, 3,
+  yyop_CALL, 5842, 17235,
+  yyop_JUMP, 17253,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 6, 17247,
+  yyop_CALL, 5815, 17247,
+  yyop_JUMP, 17253,
+  yyop_RESTORE, 3,
+  yyop_TEST, 6, 17255,
+  yyop_CALL, 5735, 17255,
+  yyop_JUMP, 17264,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16698, 17264,
+  yyop_ACTION, 153,
+  yyop_JUMP, 17310,
+  yyop_RESTORE, 1,
+  yyop_TEST, 6, 17455,
+  yyop_TEST, 14, 17281,
+  yyop_SAVE, 2,
+  yyop_CALL, 5842, 17281,
+  yyop_JUMP, 17299,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 6, 17293,
+  yyop_CALL, 5815, 17293,
+  yyop_JUMP, 17299,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 17455,
+  yyop_CALL, 5735, 17455,
+  yyop_SET, 2,
+  yyop_SAVE, 2,
+  yyop_CALL, 16698, 17455,
+  yyop_RESTORE, 2,
+  yyop_ACTION, 152,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_TEST, 14, 17328,
+  yyop_SAVE, 4,
+  yyop_CALL, 5842, 17328,
+  yyop_JUMP, 17346,
+  yyop_RESTORE, 4,
+  yyop_SAVE, 4,
+  yyop_TEST, 6, 17340,
+  yyop_CALL, 5815, 17340,
+  yyop_JUMP, 17346,
+  yyop_RESTORE, 4,
+  yyop_TEST, 6, 17348,
+  yyop_CALL, 5735, 17348,
+  yyop_JUMP, 17357,
+  yyop_RESTORE, 3,
+  yyop_CALL, 16698, 17357,
+  yyop_ACTION, 153,
+  yyop_JUMP, 17403,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 17405,
+  yyop_TEST, 14, 17374,
+  yyop_SAVE, 3,
+  yyop_CALL, 5842, 17374,
+  yyop_JUMP, 17392,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 6, 17386,
+  yyop_CALL, 5815, 17386,
+  yyop_JUMP, 17392,
+  yyop_RESTORE, 3,
+  yyop_TEST, 6, 17405,
+  yyop_CALL, 5735, 17405,
+  yyop_SET, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 16698, 17405,
+  yyop_RESTORE, 3,
+  yyop_ACTION, 152,
+  yyop_JUMP, 17310,
+  yyop_RESTORE, 1,
+  yyop_TEST, 6, 17450,
+  yyop_SAVE, 1,
+  yyop_TEST, 14, 17424,
+  yyop_SAVE, 2,
+  yyop_CALL, 5842, 17424,
+  yyop_JUMP, 17442,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_TEST, 6, 17436,
+  yyop_CALL, 5815, 17436,
+  yyop_JUMP, 17442,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 17448,
+  yyop_CALL, 5735, 17448,
+  yyop_SET, 1,
+  yyop_ACTION, 151,
+  yyop_JUMP, 17450,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 150,
+  yyop_POP, 3,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 17458: NonindentSpace */
+  yyop_ENTER, 37, 2,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_STRING, 20, 3, 17473,
+  yyop_JUMP, 17488,
+  yyop_RESTORE, 1,
+  yyop_STRING, 20, 2, 17481,
+  yyop_JUMP, 17488,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 32, 17488,
+  yyop_JUMP, 17488,
+  yyop_RESTORE, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 17492: Heading */
+  yyop_ENTER, 36, 3,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CALL, 16321, 17508,
+  yyop_JUMP, 17511,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16130, 17513,
+  yyop_JUMP, 17521,
+  yyop_RESTORE, 1,
+  yyop_TEST, 3, 17522,
+  yyop_CALL, 16533, 17522,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 17525: HeadingSectionBlock */
+  yyop_ENTER, 35, 4,
+  yyop_SAVE, 0,
+  yyop_TEST, 6, 17544,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 17542,
+  yyop_JUMP, 17530,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CALL, 16321, 17557,
+  yyop_JUMP, 17560,
+  yyop_RESTORE, 3,
+  yyop_CALL, 16130, 17562,
+  yyop_JUMP, 17570,
+  yyop_RESTORE, 2,
+  yyop_TEST, 3, 17572,
+  yyop_CALL, 16533, 17572,
+  yyop_JUMP, 17742,
+  yyop_RESTORE, 1,
+  yyop_TEST, 66, 17586,
+  yyop_SAVE, 1,
+  yyop_CALL, 18929, 17586,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 6, 17598,
+  yyop_CALL, 18868, 17598,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_PREDICATE, 19, 17608,
+  yyop_CALL, 18720, 17608,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_TEST, 21, 17621,
+  yyop_PREDICATE, 20, 17621,
+  yyop_CALL, 18615, 17621,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_TEST, 21, 17631,
+  yyop_CALL, 18538, 17631,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_TEST, 21, 17641,
+  yyop_CALL, 18434, 17641,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_TEST, 71, 17651,
+  yyop_CALL, 18302, 17651,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_TEST, 64, 17661,
+  yyop_CALL, 18199, 17661,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_TEST, 64, 17671,
+  yyop_CALL, 18158, 17671,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 17681,
+  yyop_CALL, 18082, 17681,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 17691,
+  yyop_CALL, 18047, 17691,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_PREDICATE, 21, 17701,
+  yyop_CALL, 17895, 17701,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_TEST, 69, 17714,
+  yyop_PREDICATE, 22, 17714,
+  yyop_CALL, 17854, 17714,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_JUMP, 17724,
+  yyop_RESTORE, 3,
+  yyop_CALL, 17807, 17729,
+  yyop_JUMP, 17736,
+  yyop_RESTORE, 2,
+  yyop_CALL, 17765, 17736,
+  yyop_JUMP, 17741,
+  yyop_RESTORE, 1,
+  yyop_CALL, 17745, 17742,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 17745: Plain */
+  yyop_ENTER, 34, 1,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_CALL, 17202, 17762,
+  yyop_SET, 1,
+  yyop_ACTION, 198,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 17765: Para */
+  yyop_ENTER, 33, 2,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_CALL, 17458, 17804,
+  yyop_CALL, 17202, 17804,
+  yyop_SET, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 17804,
+  yyop_TEST, 6, 17799,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 17797,
+  yyop_JUMP, 17785,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 199,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 17807: HtmlBlockOpenDiv */
+  yyop_ENTER, 32, 2,
+  yyop_SAVE, 0,
+  yyop_CHAR, 60, 17853,
+  yyop_CALL, 14909, 17851,
+  yyop_SAVE, 1,
+  yyop_STRING, 123, 3, 17828,
+  yyop_JUMP, 17832,
+  yyop_RESTORE, 1,
+  yyop_STRING, 252, 3, 17851,
+  yyop_CALL, 14909, 17851,
+  yyop_TEST, 32, 17847,
+  yyop_SAVE, 1,
+  yyop_CALL, 14852, 17847,
+  yyop_JUMP, 17835,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 62, 17851,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 17854: ImageBlock */
+  yyop_ENTER, 31, 2,
+  yyop_TEST, 69, 17894,
+  yyop_SAVE, 0,
+  yyop_CALL, 7627, 17894,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 17892,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 17892,
+  yyop_TEST, 6, 17889,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 17887,
+  yyop_JUMP, 17875,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 120,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 17895: Table */
+  yyop_ENTER, 30, 4,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_SAVE, 1,
+  yyop_DOT, 18044,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_SAVE, 1,
+  yyop_DOT, 18044,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_TEST, 19, 17936,
+  yyop_SAVE, 1,
+  yyop_CALL, 2032, 17936,
+  yyop_ACTION, 44,
+  yyop_JUMP, 17936,
+  yyop_RESTORE, 1,
+  yyop_CALL, 1991, 18044,
+  yyop_ACTION, 43,
+  yyop_CALL, 1923, 18044,
+  yyop_ACTION, 42,
+  yyop_CALL, 1991, 18044,
+  yyop_ACTION, 41,
+  yyop_TEST, 6, 18005,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18003,
+  yyop_SAVE, 2,
+  yyop_CALL, 2032, 17970,
+  yyop_JUMP, 18003,
+  yyop_RESTORE, 2,
+  yyop_CALL, 1991, 18003,
+  yyop_ACTION, 40,
+  yyop_SAVE, 2,
+  yyop_TEST, 19, 17989,
+  yyop_SAVE, 3,
+  yyop_CALL, 2032, 17989,
+  yyop_JUMP, 17999,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_TEST, 6, 18003,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18003,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 17951,
+  yyop_RESTORE, 1,
+  yyop_TEST, 19, 18028,
+  yyop_SAVE, 1,
+  yyop_CALL, 2032, 18028,
+  yyop_ACTION, 39,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18026,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 18039,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18044,
+  yyop_RESTORE, 2,
+  yyop_ACTION, 38,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18047: StyleBlock */
+  yyop_ENTER, 29, 2,
+  yyop_TEST, 44, 18081,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 18081,
+  yyop_CALL, 7927, 18081,
+  yyop_END, 18079,
+  yyop_TEST, 6, 18076,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18074,
+  yyop_JUMP, 18062,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 154,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18082: HtmlBlock */
+  yyop_ENTER, 28, 2,
+  yyop_TEST, 44, 18157,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 8677, 18099,
+  yyop_JUMP, 18155,
+  yyop_RESTORE, 1,
+  yyop_BEGIN, 18155,
+  yyop_TEST, 44, 18113,
+  yyop_SAVE, 1,
+  yyop_CALL, 8778, 18113,
+  yyop_JUMP, 18131,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 44, 18125,
+  yyop_CALL, 8657, 18125,
+  yyop_JUMP, 18131,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 18155,
+  yyop_CALL, 8615, 18155,
+  yyop_END, 18155,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18155,
+  yyop_TEST, 6, 18152,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18150,
+  yyop_JUMP, 18138,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 155,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18158: BulletList */
+  yyop_ENTER, 27, 2,
+  yyop_TEST, 64, 18198,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 15650, 18196,
+  yyop_RESTORE, 1,
+  yyop_TEST, 64, 18185,
+  yyop_SAVE, 1,
+  yyop_CALL, 15551, 18185,
+  yyop_JUMP, 18193,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 64, 18196,
+  yyop_CALL, 15472, 18196,
+  yyop_ACTION, 173,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18199: OrderedList */
+  yyop_ENTER, 26, 2,
+  yyop_TEST, 64, 18239,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_CALL, 15357, 18237,
+  yyop_RESTORE, 1,
+  yyop_TEST, 64, 18226,
+  yyop_SAVE, 1,
+  yyop_CALL, 15551, 18226,
+  yyop_JUMP, 18234,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 64, 18237,
+  yyop_CALL, 15472, 18237,
+  yyop_ACTION, 156,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18240: HeadingSection */
+  yyop_ENTER, 25, 3,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 18299,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CALL, 16321, 18268,
+  yyop_JUMP, 18271,
+  yyop_RESTORE, 2,
+  yyop_CALL, 16130, 18273,
+  yyop_JUMP, 18281,
+  yyop_RESTORE, 1,
+  yyop_TEST, 3, 18299,
+  yyop_CALL, 16533, 18299,
+  yyop_ACTION, 187,
+  yyop_SAVE, 1,
+  yyop_CALL, 17525, 18294,
+  yyop_ACTION, 186,
+  yyop_JUMP, 18283,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 185,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18302: HorizontalRule */
+  yyop_ENTER, 24, 3,
+  yyop_TEST, 71, 18433,
+  yyop_SAVE, 0,
+  yyop_CALL, 17458, 18433,
+  yyop_SAVE, 1,
+  yyop_CHAR, 42, 18346,
+  yyop_SPAN, 4,
+  yyop_CHAR, 42, 18344,
+  yyop_SPAN, 4,
+  yyop_CHAR, 42, 18344,
+  yyop_TEST, 46, 18342,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 42, 18340,
+  yyop_JUMP, 18328,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 18404,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 45, 18377,
+  yyop_SPAN, 4,
+  yyop_CHAR, 45, 18375,
+  yyop_SPAN, 4,
+  yyop_CHAR, 45, 18375,
+  yyop_TEST, 72, 18373,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 45, 18371,
+  yyop_JUMP, 18359,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 18404,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 95, 18431,
+  yyop_SPAN, 4,
+  yyop_CHAR, 95, 18431,
+  yyop_SPAN, 4,
+  yyop_CHAR, 95, 18431,
+  yyop_TEST, 47, 18404,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 95, 18402,
+  yyop_JUMP, 18390,
+  yyop_RESTORE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18431,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18431,
+  yyop_TEST, 6, 18428,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18426,
+  yyop_JUMP, 18414,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 174,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18434: Reference */
+  yyop_ENTER, 23, 3,
+  yyop_TEST, 21, 18537,
+  yyop_SAVE, 0,
+  yyop_PUSH, 4,
+  yyop_SAVE, 1,
+  yyop_DOT, 18535,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 4,
+  yyop_CALL, 17458, 18535,
+  yyop_SAVE, 1,
+  yyop_STRING, 26, 2, 18467,
+  yyop_JUMP, 18535,
+  yyop_RESTORE, 1,
+  yyop_CALL, 4615, 18535,
+  yyop_SET, 3,
+  yyop_CHAR, 58, 18535,
+  yyop_CALL, 14909, 18535,
+  yyop_CALL, 4054, 18535,
+  yyop_SET, 2,
+  yyop_CALL, 4005, 18535,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_PREDICATE, 23, 18511,
+  yyop_TEST, 39, 18507,
+  yyop_SAVE, 2,
+  yyop_CALL, 3958, 18507,
+  yyop_ACTION, 111,
+  yyop_JUMP, 18507,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 18511,
+  yyop_RESTORE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18535,
+  yyop_TEST, 6, 18530,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18528,
+  yyop_JUMP, 18516,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 110,
+  yyop_POP, 4,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18538: Note */
+  yyop_ENTER, 22, 4,
+  yyop_TEST, 21, 18614,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_PREDICATE, 24, 18612,
+  yyop_CALL, 17458, 18612,
+  yyop_CALL, 2810, 18612,
+  yyop_SET, 2,
+  yyop_CHAR, 58, 18612,
+  yyop_SPAN, 4,
+  yyop_SAVE, 1,
+  yyop_DOT, 18612,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_CALL, 2571, 18612,
+  yyop_ACTION, 76,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 9, 18592,
+  yyop_JUMP, 18596,
+  yyop_RESTORE, 3,
+  yyop_STRING, 20, 4, 18605,
+  yyop_RESTORE, 2,
+  yyop_CALL, 2571, 18605,
+  yyop_ACTION, 75,
+  yyop_JUMP, 18579,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 74,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18615: Glossary */
+  yyop_ENTER, 21, 4,
+  yyop_TEST, 21, 18719,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_PREDICATE, 25, 18717,
+  yyop_SAVE, 1,
+  yyop_DOT, 18717,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_CALL, 17458, 18717,
+  yyop_CALL, 2810, 18717,
+  yyop_SET, 1,
+  yyop_CHAR, 58, 18717,
+  yyop_SPAN, 4,
+  yyop_STRING, 492, 9, 18717,
+  yyop_SPAN, 4,
+  yyop_CALL, 2749, 18717,
+  yyop_ACTION, 83,
+  yyop_TEST, 73, 18676,
+  yyop_SAVE, 1,
+  yyop_CALL, 2702, 18676,
+  yyop_ACTION, 82,
+  yyop_JUMP, 18676,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 10, 18717,
+  yyop_CALL, 2571, 18717,
+  yyop_ACTION, 81,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 9, 18697,
+  yyop_JUMP, 18701,
+  yyop_RESTORE, 3,
+  yyop_STRING, 20, 4, 18710,
+  yyop_RESTORE, 2,
+  yyop_CALL, 2571, 18710,
+  yyop_ACTION, 80,
+  yyop_JUMP, 18684,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 79,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18720: DefinitionList */
+  yyop_ENTER, 20, 3,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 18865,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 1889, 18865,
+  yyop_SAVE, 2,
+  yyop_CALL, 1889, 18751,
+  yyop_JUMP, 18742,
+  yyop_RESTORE, 2,
+  yyop_CHAR, 58, 18865,
+  yyop_RESTORE, 1,
+  yyop_CALL, 1735, 18865,
+  yyop_ACTION, 56,
+  yyop_SAVE, 1,
+  yyop_CALL, 1735, 18772,
+  yyop_ACTION, 56,
+  yyop_JUMP, 18761,
+  yyop_RESTORE, 1,
+  yyop_CALL, 1573, 18865,
+  yyop_ACTION, 55,
+  yyop_TEST, 17, 18791,
+  yyop_SAVE, 1,
+  yyop_CALL, 1573, 18791,
+  yyop_ACTION, 55,
+  yyop_JUMP, 18777,
+  yyop_RESTORE, 1,
+  yyop_TEST, 6, 18805,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18803,
+  yyop_JUMP, 18791,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 1735, 18860,
+  yyop_ACTION, 56,
+  yyop_SAVE, 2,
+  yyop_CALL, 1735, 18823,
+  yyop_ACTION, 56,
+  yyop_JUMP, 18812,
+  yyop_RESTORE, 2,
+  yyop_CALL, 1573, 18858,
+  yyop_ACTION, 55,
+  yyop_TEST, 17, 18842,
+  yyop_SAVE, 2,
+  yyop_CALL, 1573, 18842,
+  yyop_ACTION, 55,
+  yyop_JUMP, 18828,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 18856,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18854,
+  yyop_JUMP, 18842,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 18805,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 54,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18868: Verbatim */
+  yyop_ENTER, 19, 2,
+  yyop_TEST, 6, 18928,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 18926,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_CALL, 15682, 18926,
+  yyop_ACTION, 176,
+  yyop_TEST, 6, 18907,
+  yyop_SAVE, 1,
+  yyop_CALL, 15682, 18907,
+  yyop_ACTION, 176,
+  yyop_JUMP, 18893,
+  yyop_RESTORE, 1,
+  yyop_TEST, 6, 18921,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 18919,
+  yyop_JUMP, 18907,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 175,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18929: BlockQuote */
+  yyop_ENTER, 18, 1,
+  yyop_TEST, 66, 18951,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_CALL, 15882, 18949,
+  yyop_SET, 1,
+  yyop_ACTION, 184,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18952: RawLine */
+  yyop_ENTER, 17, 3,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_BEGIN, 18972,
+  yyop_SPAN, 2,
+  yyop_CHAR, 10, 18970,
+  yyop_END, 18970,
+  yyop_JUMP, 18988,
+  yyop_RESTORE, 1,
+  yyop_BEGIN, 18989,
+  yyop_DOT, 18989,
+  yyop_SPAN, 74,
+  yyop_END, 18989,
+  yyop_SAVE, 2,
+  yyop_DOT, 18988,
+  yyop_JUMP, 18989,
+  yyop_RESTORE, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 18992: BlankLine */
+  yyop_ENTER, 16, 1,
+  yyop_TEST, 6, 19008,
+  yyop_SAVE, 0,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 19006,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19009: SingleLineMetaKeyValue */
+  yyop_ENTER, 15, 1,
+  yyop_TEST, 7, 19032,
+  yyop_SAVE, 0,
+  yyop_CALL, 19485, 19032,
+  yyop_SPAN, 4,
+  yyop_CHAR, 58, 19030,
+  yyop_SPAN, 4,
+  yyop_SPAN, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19033: AlphanumericAscii */
+  yyop_ENTER, 14, 1,
+  yyop_SAVE, 0,
+  yyop_CLASS, 7, 19044,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19045: MetaDataValue */
+  yyop_ENTER, 13, 4,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 19151,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_BEGIN, 19151,
+  yyop_SPAN, 2,
+  yyop_END, 19151,
+  yyop_ACTION, 203,
+  yyop_SAVE, 1,
+  yyop_CHAR, 10, 19110,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 19086,
+  yyop_JUMP, 19108,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CALL, 19009, 19097,
+  yyop_JUMP, 19108,
+  yyop_RESTORE, 3,
+  yyop_SPAN, 4,
+  yyop_CALL, 18952, 19108,
+  yyop_RESTORE, 2,
+  yyop_ACTION, 202,
+  yyop_JUMP, 19113,
+  yyop_RESTORE, 1,
+  yyop_CHAR, 10, 19151,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 19124,
+  yyop_JUMP, 19144,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CALL, 19009, 19135,
+  yyop_JUMP, 19144,
+  yyop_RESTORE, 2,
+  yyop_SPAN, 4,
+  yyop_CALL, 18952, 19144,
+  yyop_ACTION, 201,
+  yyop_JUMP, 19113,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 200,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19154: SkipBlock */
+  yyop_ENTER, 12, 4,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_TEST, 44, 19177,
+  yyop_SAVE, 1,
+  yyop_CALL, 18082, 19177,
+  yyop_SET, 1,
+  yyop_ACTION, 94,
+  yyop_JUMP, 19314,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_SAVE, 2,
+  yyop_CHAR, 35, 19188,
+  yyop_JUMP, 19283,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CALL, 16112, 19197,
+  yyop_JUMP, 19283,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_CALL, 16094, 19206,
+  yyop_JUMP, 19283,
+  yyop_RESTORE, 2,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 19215,
+  yyop_JUMP, 19283,
+  yyop_RESTORE, 2,
+  yyop_CALL, 18952, 19283,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_CHAR, 35, 19231,
+  yyop_JUMP, 19265,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CALL, 16112, 19240,
+  yyop_JUMP, 19265,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_CALL, 16094, 19249,
+  yyop_JUMP, 19265,
+  yyop_RESTORE, 3,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 19258,
+  yyop_JUMP, 19265,
+  yyop_RESTORE, 3,
+  yyop_CALL, 18952, 19265,
+  yyop_JUMP, 19220,
+  yyop_RESTORE, 2,
+  yyop_TEST, 6, 19281,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 19279,
+  yyop_JUMP, 19267,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 19314,
+  yyop_RESTORE, 1,
+  yyop_TEST, 6, 19311,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 19309,
+  yyop_TEST, 6, 19307,
+  yyop_SAVE, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 19305,
+  yyop_JUMP, 19293,
+  yyop_RESTORE, 2,
+  yyop_JUMP, 19314,
+  yyop_RESTORE, 1,
+  yyop_CALL, 18952, 19317,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19320: MetaDataOnly */
+  yyop_ENTER, 11, 2,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_SAVE, 1,
+  yyop_DOT, 19367,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_TEST, 7, 19353,
+  yyop_SAVE, 1,
+  yyop_CALL, 19405, 19353,
+  yyop_SET, 1,
+  yyop_ACTION, 207,
+  yyop_JUMP, 19353,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 19154, 19362,
+  yyop_JUMP, 19353,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 206,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19370: MetaDataKeyValue */
+  yyop_ENTER, 10, 1,
+  yyop_TEST, 7, 19404,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_CALL, 19485, 19402,
+  yyop_SET, 2,
+  yyop_SPAN, 4,
+  yyop_CHAR, 58, 19402,
+  yyop_SPAN, 4,
+  yyop_CALL, 19045, 19402,
+  yyop_SET, 1,
+  yyop_ACTION, 205,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19405: MetaData */
+  yyop_ENTER, 9, 2,
+  yyop_TEST, 7, 19466,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 19464,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_CLASS, 42, 19440,
+  yyop_SPAN, 42,
+  yyop_STRING, 57, 3, 19438,
+  yyop_JUMP, 19464,
+  yyop_RESTORE, 1,
+  yyop_CALL, 19370, 19464,
+  yyop_ACTION, 209,
+  yyop_TEST, 7, 19459,
+  yyop_SAVE, 1,
+  yyop_CALL, 19370, 19459,
+  yyop_ACTION, 209,
+  yyop_JUMP, 19445,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 208,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19467: Newline */
+  yyop_ENTER, 8, 1,
+  yyop_SAVE, 0,
+  yyop_CHAR, 10, 19478,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19479: Sp */
+  yyop_ENTER, 7, 1,
+  yyop_SPAN, 4,
+  yyop_RETURN,
+  /* 19485: MetaDataKey */
+  yyop_ENTER, 6, 2,
+  yyop_TEST, 7, 19536,
+  yyop_SAVE, 0,
+  yyop_BEGIN, 19536,
+  yyop_SAVE, 1,
+  yyop_CLASS, 42, 19510,
+  yyop_SPAN, 42,
+  yyop_STRING, 57, 3, 19508,
+  yyop_JUMP, 19534,
+  yyop_RESTORE, 1,
+  yyop_CLASS, 7, 19534,
+  yyop_TEST, 75, 19529,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CLASS, 76, 19527,
+  yyop_SPAN, 76,
+  yyop_JUMP, 19513,
+  yyop_RESTORE, 1,
+  yyop_END, 19534,
+  yyop_ACTION, 204,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19537: DocWithMetaData */
+  yyop_ENTER, 5, 4,
+  yyop_SAVE, 0,
+  yyop_PUSH, 2,
+  yyop_TEST, 77, 19557,
+  yyop_SAVE, 1,
+  yyop_STRING, 501, 3, 19557,
+  yyop_JUMP, 19557,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 19633,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 2,
+  yyop_SAVE, 1,
+  yyop_DOT, 19633,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_TEST, 7, 19617,
+  yyop_SAVE, 1,
+  yyop_PREDICATE, 26, 19617,
+  yyop_SAVE, 2,
+  yyop_CALL, 19485, 19615,
+  yyop_SPAN, 4,
+  yyop_CHAR, 58, 19615,
+  yyop_SPAN, 4,
+  yyop_SAVE, 3,
+  yyop_CHAR, 10, 19606,
+  yyop_JUMP, 19615,
+  yyop_RESTORE, 3,
+  yyop_RESTORE, 2,
+  yyop_CALL, 19405, 19615,
+  yyop_ACTION, 212,
+  yyop_JUMP, 19617,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 19636, 19628,
+  yyop_ACTION, 211,
+  yyop_JUMP, 19617,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 210,
+  yyop_POP, 2,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19636: Block */
+  yyop_ENTER, 4, 4,
+  yyop_SAVE, 0,
+  yyop_TEST, 6, 19655,
+  yyop_SAVE, 1,
+  yyop_SPAN, 4,
+  yyop_CHAR, 10, 19653,
+  yyop_JUMP, 19641,
+  yyop_RESTORE, 1,
+  yyop_TEST, 66, 19667,
+  yyop_SAVE, 1,
+  yyop_CALL, 18929, 19667,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_TEST, 6, 19679,
+  yyop_CALL, 18868, 19679,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_PREDICATE, 27, 19689,
+  yyop_CALL, 18720, 19689,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_TEST, 21, 19702,
+  yyop_PREDICATE, 28, 19702,
+  yyop_CALL, 18615, 19702,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_TEST, 21, 19712,
+  yyop_CALL, 18538, 19712,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_TEST, 21, 19722,
+  yyop_CALL, 18434, 19722,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_TEST, 71, 19732,
+  yyop_CALL, 18302, 19732,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_CALL, 18240, 19739,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_TEST, 64, 19749,
+  yyop_CALL, 18199, 19749,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_TEST, 64, 19759,
+  yyop_CALL, 18158, 19759,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 19769,
+  yyop_CALL, 18082, 19769,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_TEST, 44, 19779,
+  yyop_CALL, 18047, 19779,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_PREDICATE, 29, 19789,
+  yyop_CALL, 17895, 19789,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_TEST, 69, 19802,
+  yyop_PREDICATE, 30, 19802,
+  yyop_CALL, 17854, 19802,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 2,
+  yyop_SAVE, 3,
+  yyop_SPAN, 4,
+  yyop_JUMP, 19812,
+  yyop_RESTORE, 3,
+  yyop_CALL, 17807, 19817,
+  yyop_JUMP, 19824,
+  yyop_RESTORE, 2,
+  yyop_CALL, 17765, 19824,
+  yyop_JUMP, 19829,
+  yyop_RESTORE, 1,
+  yyop_CALL, 17745, 19830,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19833: StartList */
+  yyop_ENTER, 3, 2,
+  yyop_SAVE, 0,
+  yyop_SAVE, 1,
+  yyop_DOT, 19847,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19850: BOM */
+  yyop_ENTER, 2, 1,
+  yyop_SAVE, 0,
+  yyop_STRING, 501, 3, 19862,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+  /* 19863: Doc */
+  yyop_ENTER, 1, 2,
+  yyop_SAVE, 0,
+  yyop_PUSH, 1,
+  yyop_TEST, 77, 19883,
+  yyop_SAVE, 1,
+  yyop_STRING, 501, 3, 19883,
+  yyop_JUMP, 19883,
+  yyop_RESTORE, 1,
+  yyop_SAVE, 1,
+  yyop_DOT, 19909,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 96,
+  yyop_SET, 1,
+  yyop_SAVE, 1,
+  yyop_CALL, 19636, 19904,
+  yyop_ACTION, 214,
+  yyop_JUMP, 19893,
+  yyop_RESTORE, 1,
+  yyop_ACTION, 213,
+  yyop_POP, 1,
+  yyop_RETURN,
+  yyop_RESTORE, 0,
+  yyop_FAIL,
+};
+
+
+/* yyvm runs the bytecode of the rule at 'yyentry', returning 1 if it
+ * matched.  Calls between rules use yystack rather than the C stack:
+ * each pushes the address to return to, the address to go to if the rule
+ * fails and the caller's frame, after which come the callee's save slots,
+ * each a (yypos, yythunkpos) pair. */
+
+#if defined(__GNUC__) && !defined(YY_SWITCH)
+# define YY_THREADED	1
+# define YY_OP(OP)	yyl_##OP
+# define YY_NEXT	goto *yyops[*yyc]
+#else
+# define YY_OP(OP)	case yyop_##OP
+# define YY_NEXT	goto yynext
+#endif
+#define YY_MORE		(YY_LIKELY(yypos < yylimit) || yyrefill())
+#define YY_GOTO(N)	(yyc= yycode + (N))
+#define YY_IN(BITS, C)	((BITS)[(C) >> 3] & (1 << ((C) & 7)))
+
+YY_VARIABLE(int *    ) yystack= 0;
+YY_VARIABLE(int      ) yystacklen= 0;
+YY_VARIABLE(int      ) yystackpos= 0;
+
+YY_LOCAL(int) yyvm(int yyentry)
+{
+#ifdef YY_THREADED
+  static const void *yyops[]= {
+    &&yyl_ENTER,
+    &&yyl_RETURN,
+    &&yyl_FAIL,
+    &&yyl_CALL,
+    &&yyl_JUMP,
+    &&yyl_SAVE,
+    &&yyl_RESTORE,
+    &&yyl_DOT,
+    &&yyl_CHAR,
+    &&yyl_STRING,
+    &&yyl_CLASS,
+    &&yyl_TEST,
+    &&yyl_SPAN,
+    &&yyl_SCAN,
+    &&yyl_ACTION,
+    &&yyl_PREDICATE,
+    &&yyl_BEGIN,
+    &&yyl_END,
+    &&yyl_PUSH,
+    &&yyl_POP,
+    &&yyl_SET,
+  };
+#endif
+  const yyword *yyc= yycode + yyentry;
+  int		 yybase= yystackpos, yysp, yyfp, yyret, yyok;
+  int		*yyst;
+
+  if (!yystacklen)
+    {
+      yystacklen= 1024;
+      yystack= YY_MALLOC(sizeof(int) * yystacklen);
+    }
+  while (yybase + 3 > yystacklen)
+    {
+      yystacklen *= 2;
+      yystack= YY_REALLOC(yystack, sizeof(int) * yystacklen);
+    }
+  yyst= yystack;
+  yyst[yybase]= yyst[yybase + 1]= yyst[yybase + 2]= 0;
+  yysp= yyfp= yybase + 3;	/* a frame with nowhere to return to */
+#ifdef YY_THREADED
+  YY_NEXT;
+#else
+ yynext:
+  switch (*yyc)
+    {
+#endif
+    YY_OP(ENTER):		/* rule slots */
+      yyprintf((stderr, "%s\n", yyrulenames[yyc[1]]));
+      if (YY_UNLIKELY(yysp + 2 * yyc[2] + 3 > yystacklen))
+	{
+	  while (yysp + 2 * yyc[2] + 3 > yystacklen)
+	    yystacklen *= 2;
+	  yystack= yyst= YY_REALLOC(yystack, sizeof(int) * yystacklen);
+	}
+      yysp += 2 * yyc[2];
+      yyc += 3;
+      YY_NEXT;
+
+    YY_OP(RETURN):
+      yyok= 1;
+      yyret= yyst[yyfp - 3];
+      goto yyreturn;
+
+    YY_OP(FAIL):
+      yyok= 0;
+      yyret= yyst[yyfp - 2];
+    yyreturn:
+      yysp= yyfp - 3;
+      yyfp= yyst[yysp + 2];
+      if (yysp == yybase)
+	return yyok;
+      YY_GOTO(yyret);
+      YY_NEXT;
+
+    YY_OP(CALL):		/* address ko */
+      yyst[yysp]= yyc + 3 - yycode;
+      yyst[yysp + 1]= yyc[2];
+      yyst[yysp + 2]= yyfp;
+      yyfp= yysp += 3;
+      YY_GOTO(yyc[1]);
+      YY_NEXT;
+
+    YY_OP(JUMP):		/* address */
+      YY_GOTO(yyc[1]);
+      YY_NEXT;
+
+    YY_OP(SAVE):		/* slot */
+      yyst[yyfp + 2 * yyc[1]]= yypos;
+      yyst[yyfp + 2 * yyc[1] + 1]= yythunkpos;
+      yyc += 2;
+      YY_NEXT;
+
+    YY_OP(RESTORE):		/* slot */
+      yypos= yyst[yyfp + 2 * yyc[1]];
+      yythunkpos= yyst[yyfp + 2 * yyc[1] + 1];
+      yyc += 2;
+      YY_NEXT;
+
+    YY_OP(DOT):			/* ko */
+      if (YY_MORE)
+	{
+	  ++yypos;
+	  yyc += 2;
+	}
+      else
+	YY_GOTO(yyc[1]);
+      YY_NEXT;
+
+    YY_OP(CHAR):		/* character ko */
+      if (YY_MORE && (unsigned char)yybuf[yypos] == yyc[1])
+	{
+	  ++yypos;
+	  yyc += 3;
+	}
+      else
+	YY_GOTO(yyc[2]);
+      YY_NEXT;
+
+    YY_OP(STRING):		/* offset length ko */
+      {
+	const char *s= yyliterals + yyc[1];
+	int	    n= yyc[2], yysav= yypos;
+	while (n && YY_MORE && yybuf[yypos] == *s)
+	  ++yypos, ++s, --n;
+	if (n)
+	  {
+	    yypos= yysav;
+	    YY_GOTO(yyc[3]);
+	  }
+	else
+	  yyc += 4;
+      }
+      YY_NEXT;
+
+    YY_OP(CLASS):		/* class ko */
+      if (YY_MORE && YY_IN(yyclasses[yyc[1]], (unsigned char)yybuf[yypos]))
+	{
+	  ++yypos;
+	  yyc += 3;
+	}
+      else
+	YY_GOTO(yyc[2]);
+      YY_NEXT;
+
+    YY_OP(TEST):		/* class ko */
+      if (YY_MORE && YY_IN(yyclasses[yyc[1]], (unsigned char)yybuf[yypos]))
+	yyc += 3;
+      else
+	YY_GOTO(yyc[2]);
+      YY_NEXT;
+
+    YY_OP(SPAN):		/* class: as many characters of it as there are */
+      {
+	const unsigned char *bits= yyclasses[yyc[1]];
+	while (YY_MORE && YY_IN(bits, (unsigned char)yybuf[yypos]))
+	  ++yypos;
+	yyc += 2;
+      }
+      YY_NEXT;
+
+    YY_OP(SCAN):		/* offset length: characters up to the string */
+      for (;;)
+	{
+	  const char *s= yyliterals + yyc[1];
+	  int	      n= yyc[2], yysav= yypos;
+	  while (n && YY_MORE && yybuf[yypos] == *s)
+	    ++yypos, ++s, --n;
+	  yypos= yysav;
+	  if (!n || !YY_MORE)
+	    break;
+	  ++yypos;
+	}
+      yyc += 3;
+      YY_NEXT;
+
+    YY_OP(ACTION):		/* action */
+      yyDo(yyactions[yyc[1]], yybegin, yyend);
+      yyc += 2;
+      YY_NEXT;
+
+    YY_OP(PREDICATE):		/* predicate ko */
+      yystackpos= yysp;		/* in case it parses something itself */
+      yyText(yybegin, yyend);
+      yyok= yypredicates[yyc[1]]();
+      yystackpos= yybase;
+      yyst= yystack;
+      if (yyok)
+	yyc += 3;
+      else
+	YY_GOTO(yyc[2]);
+      YY_NEXT;
+
+    YY_OP(BEGIN):		/* ko */
+      if (YY_BEGIN)
+	yyc += 2;
+      else
+	YY_GOTO(yyc[1]);
+      YY_NEXT;
+
+    YY_OP(END):			/* ko */
+      if (YY_END)
+	yyc += 2;
+      else
+	YY_GOTO(yyc[1]);
+      YY_NEXT;
+
+    YY_OP(PUSH):		/* count */
+      yyDo(yyPush, yyc[1], 0);
+      yyc += 2;
+      YY_NEXT;
+
+    YY_OP(POP):			/* count */
+      yyDo(yyPop, yyc[1], 0);
+      yyc += 2;
+      YY_NEXT;
+
+    YY_OP(SET):			/* -offset */
+      yyDo(yySet, -yyc[1], 0);
+      yyc += 2;
+      YY_NEXT;
+#ifndef YY_THREADED
+    }
+  return 0;
+#endif
+}
+
+YY_RULE(int) yy_Doc()	{ return yyvm(19863); }
+YY_RULE(int) yy_BOM()	{ return yyvm(19850); }
+YY_RULE(int) yy_StartList()	{ return yyvm(19833); }
+YY_RULE(int) yy_Block()	{ return yyvm(19636); }
+YY_RULE(int) yy_DocWithMetaData()	{ return yyvm(19537); }
+YY_RULE(int) yy_MetaDataKey()	{ return yyvm(19485); }
+YY_RULE(int) yy_Sp()	{ return yyvm(19479); }
+YY_RULE(int) yy_Newline()	{ return yyvm(19467); }
+YY_RULE(int) yy_MetaData()	{ return yyvm(19405); }
+YY_RULE(int) yy_MetaDataKeyValue()	{ return yyvm(19370); }
+YY_RULE(int) yy_MetaDataOnly()	{ return yyvm(19320); }
+YY_RULE(int) yy_SkipBlock()	{ return yyvm(19154); }
+YY_RULE(int) yy_MetaDataValue()	{ return yyvm(19045); }
+YY_RULE(int) yy_AlphanumericAscii()	{ return yyvm(19033); }
+YY_RULE(int) yy_SingleLineMetaKeyValue()	{ return yyvm(19009); }
+YY_RULE(int) yy_BlankLine()	{ return yyvm(18992); }
+YY_RULE(int) yy_RawLine()	{ return yyvm(18952); }
+YY_RULE(int) yy_BlockQuote()	{ return yyvm(18929); }
+YY_RULE(int) yy_Verbatim()	{ return yyvm(18868); }
+YY_RULE(int) yy_DefinitionList()	{ return yyvm(18720); }
+YY_RULE(int) yy_Glossary()	{ return yyvm(18615); }
+YY_RULE(int) yy_Note()	{ return yyvm(18538); }
+YY_RULE(int) yy_Reference()	{ return yyvm(18434); }
+YY_RULE(int) yy_HorizontalRule()	{ return yyvm(18302); }
+YY_RULE(int) yy_HeadingSection()	{ return yyvm(18240); }
+YY_RULE(int) yy_OrderedList()	{ return yyvm(18199); }
+YY_RULE(int) yy_BulletList()	{ return yyvm(18158); }
+YY_RULE(int) yy_HtmlBlock()	{ return yyvm(18082); }
+YY_RULE(int) yy_StyleBlock()	{ return yyvm(18047); }
+YY_RULE(int) yy_Table()	{ return yyvm(17895); }
+YY_RULE(int) yy_ImageBlock()	{ return yyvm(17854); }
+YY_RULE(int) yy_HtmlBlockOpenDiv()	{ return yyvm(17807); }
+YY_RULE(int) yy_Para()	{ return yyvm(17765); }
+YY_RULE(int) yy_Plain()	{ return yyvm(17745); }
+YY_RULE(int) yy_HeadingSectionBlock()	{ return yyvm(17525); }
+YY_RULE(int) yy_Heading()	{ return yyvm(17492); }
+YY_RULE(int) yy_NonindentSpace()	{ return yyvm(17458); }
+YY_RULE(int) yy_Inlines()	{ return yyvm(17202); }
+YY_RULE(int) yy_AtxInline()	{ return yyvm(17131); }
+YY_RULE(int) yy_AutoLabel()	{ return yyvm(17014); }
+YY_RULE(int) yy_Inline()	{ return yyvm(16698); }
+YY_RULE(int) yy_AtxStart()	{ return yyvm(16635); }
+YY_RULE(int) yy_AtxHeading()	{ return yyvm(16533); }
+YY_RULE(int) yy_SetextHeading()	{ return yyvm(16512); }
+YY_RULE(int) yy_SetextHeading1()	{ return yyvm(16321); }
+YY_RULE(int) yy_SetextHeading2()	{ return yyvm(16130); }
+YY_RULE(int) yy_SetextBottom1()	{ return yyvm(16112); }
+YY_RULE(int) yy_SetextBottom2()	{ return yyvm(16094); }
+YY_RULE(int) yy_Endline()	{ return yyvm(16052); }
+YY_RULE(int) yy_BlockQuoteRaw()	{ return yyvm(15882); }
+YY_RULE(int) yy_Line()	{ return yyvm(15868); }
+YY_RULE(int) yy_NonblankIndentedLine()	{ return yyvm(15827); }
+YY_RULE(int) yy_IndentedLine()	{ return yyvm(15797); }
+YY_RULE(int) yy_VerbatimChunk()	{ return yyvm(15682); }
+YY_RULE(int) yy_Bullet()	{ return yyvm(15650); }
+YY_RULE(int) yy_Spacechar()	{ return yyvm(15638); }
+YY_RULE(int) yy_ListTight()	{ return yyvm(15551); }
+YY_RULE(int) yy_ListLoose()	{ return yyvm(15472); }
+YY_RULE(int) yy_ListItemTight()	{ return yyvm(15385); }
+YY_RULE(int) yy_Enumerator()	{ return yyvm(15357); }
+YY_RULE(int) yy_ListItem()	{ return yyvm(15290); }
+YY_RULE(int) yy_ListBlock()	{ return yyvm(15236); }
+YY_RULE(int) yy_ListContinuationBlock()	{ return yyvm(15143); }
+YY_RULE(int) yy_ListBlockLine()	{ return yyvm(15039); }
+YY_RULE(int) yy_Indent()	{ return yyvm(15014); }
+YY_RULE(int) yy_OptionallyIndentedLine()	{ return yyvm(14978); }
+YY_RULE(int) yy_HtmlBlockOpenAddress()	{ return yyvm(14931); }
+YY_RULE(int) yy_Spnl()	{ return yyvm(14909); }
+YY_RULE(int) yy_HtmlAttribute()	{ return yyvm(14852); }
+YY_RULE(int) yy_HtmlBlockCloseAddress()	{ return yyvm(14814); }
+YY_RULE(int) yy_HtmlBlockAddress()	{ return yyvm(14765); }
+YY_RULE(int) yy_HtmlBlockOpenArticle()	{ return yyvm(14718); }
+YY_RULE(int) yy_HtmlBlockCloseArticle()	{ return yyvm(14680); }
+YY_RULE(int) yy_HtmlBlockArticle()	{ return yyvm(14631); }
+YY_RULE(int) yy_HtmlBlockOpenAside()	{ return yyvm(14584); }
+YY_RULE(int) yy_HtmlBlockCloseAside()	{ return yyvm(14546); }
+YY_RULE(int) yy_HtmlBlockAside()	{ return yyvm(14497); }
+YY_RULE(int) yy_HtmlBlockOpenBlockquote()	{ return yyvm(14450); }
+YY_RULE(int) yy_HtmlBlockCloseBlockquote()	{ return yyvm(14412); }
+YY_RULE(int) yy_HtmlBlockBlockquote()	{ return yyvm(14363); }
+YY_RULE(int) yy_HtmlBlockOpenCanvas()	{ return yyvm(14316); }
+YY_RULE(int) yy_HtmlBlockCloseCanvas()	{ return yyvm(14278); }
+YY_RULE(int) yy_HtmlBlockCanvas()	{ return yyvm(14229); }
+YY_RULE(int) yy_HtmlBlockOpenCenter()	{ return yyvm(14182); }
+YY_RULE(int) yy_HtmlBlockCloseCenter()	{ return yyvm(14144); }
+YY_RULE(int) yy_HtmlBlockCenter()	{ return yyvm(14095); }
+YY_RULE(int) yy_HtmlBlockOpenDir()	{ return yyvm(14048); }
+YY_RULE(int) yy_HtmlBlockCloseDir()	{ return yyvm(14010); }
+YY_RULE(int) yy_HtmlBlockDir()	{ return yyvm(13961); }
+YY_RULE(int) yy_HtmlBlockCloseDiv()	{ return yyvm(13923); }
+YY_RULE(int) yy_HtmlBlockDiv()	{ return yyvm(13874); }
+YY_RULE(int) yy_HtmlBlockOpenDl()	{ return yyvm(13827); }
+YY_RULE(int) yy_HtmlBlockCloseDl()	{ return yyvm(13789); }
+YY_RULE(int) yy_HtmlBlockDl()	{ return yyvm(13740); }
+YY_RULE(int) yy_HtmlBlockOpenFieldset()	{ return yyvm(13693); }
+YY_RULE(int) yy_HtmlBlockCloseFieldset()	{ return yyvm(13655); }
+YY_RULE(int) yy_HtmlBlockFieldset()	{ return yyvm(13606); }
+YY_RULE(int) yy_HtmlBlockOpenFigure()	{ return yyvm(13559); }
+YY_RULE(int) yy_HtmlBlockCloseFigure()	{ return yyvm(13521); }
+YY_RULE(int) yy_HtmlBlockFigure()	{ return yyvm(13472); }
+YY_RULE(int) yy_HtmlBlockOpenFooter()	{ return yyvm(13425); }
+YY_RULE(int) yy_HtmlBlockCloseFooter()	{ return yyvm(13387); }
+YY_RULE(int) yy_HtmlBlockFooter()	{ return yyvm(13338); }
+YY_RULE(int) yy_HtmlBlockOpenForm()	{ return yyvm(13291); }
+YY_RULE(int) yy_HtmlBlockCloseForm()	{ return yyvm(13253); }
+YY_RULE(int) yy_HtmlBlockForm()	{ return yyvm(13204); }
+YY_RULE(int) yy_HtmlBlockOpenHeader()	{ return yyvm(13157); }
+YY_RULE(int) yy_HtmlBlockCloseHeader()	{ return yyvm(13119); }
+YY_RULE(int) yy_HtmlBlockHeader()	{ return yyvm(13070); }
+YY_RULE(int) yy_HtmlBlockOpenHgroup()	{ return yyvm(13023); }
+YY_RULE(int) yy_HtmlBlockCloseHgroup()	{ return yyvm(12985); }
+YY_RULE(int) yy_HtmlBlockHgroup()	{ return yyvm(12936); }
+YY_RULE(int) yy_HtmlBlockOpenH1()	{ return yyvm(12889); }
+YY_RULE(int) yy_HtmlBlockCloseH1()	{ return yyvm(12851); }
+YY_RULE(int) yy_HtmlBlockH1()	{ return yyvm(12802); }
+YY_RULE(int) yy_HtmlBlockOpenH2()	{ return yyvm(12755); }
+YY_RULE(int) yy_HtmlBlockCloseH2()	{ return yyvm(12717); }
+YY_RULE(int) yy_HtmlBlockH2()	{ return yyvm(12668); }
+YY_RULE(int) yy_HtmlBlockOpenH3()	{ return yyvm(12621); }
+YY_RULE(int) yy_HtmlBlockCloseH3()	{ return yyvm(12583); }
+YY_RULE(int) yy_HtmlBlockH3()	{ return yyvm(12534); }
+YY_RULE(int) yy_HtmlBlockOpenH4()	{ return yyvm(12487); }
+YY_RULE(int) yy_HtmlBlockCloseH4()	{ return yyvm(12449); }
+YY_RULE(int) yy_HtmlBlockH4()	{ return yyvm(12400); }
+YY_RULE(int) yy_HtmlBlockOpenH5()	{ return yyvm(12353); }
+YY_RULE(int) yy_HtmlBlockCloseH5()	{ return yyvm(12315); }
+YY_RULE(int) yy_HtmlBlockH5()	{ return yyvm(12266); }
+YY_RULE(int) yy_HtmlBlockOpenH6()	{ return yyvm(12219); }
+YY_RULE(int) yy_HtmlBlockCloseH6()	{ return yyvm(12181); }
+YY_RULE(int) yy_HtmlBlockH6()	{ return yyvm(12132); }
+YY_RULE(int) yy_HtmlBlockOpenMenu()	{ return yyvm(12085); }
+YY_RULE(int) yy_HtmlBlockCloseMenu()	{ return yyvm(12047); }
+YY_RULE(int) yy_HtmlBlockMenu()	{ return yyvm(11998); }
+YY_RULE(int) yy_HtmlBlockOpenNoframes()	{ return yyvm(11951); }
+YY_RULE(int) yy_HtmlBlockCloseNoframes()	{ return yyvm(11913); }
+YY_RULE(int) yy_HtmlBlockNoframes()	{ return yyvm(11864); }
+YY_RULE(int) yy_HtmlBlockOpenNoscript()	{ return yyvm(11817); }
+YY_RULE(int) yy_HtmlBlockCloseNoscript()	{ return yyvm(11779); }
+YY_RULE(int) yy_HtmlBlockNoscript()	{ return yyvm(11730); }
+YY_RULE(int) yy_HtmlBlockOpenOl()	{ return yyvm(11683); }
+YY_RULE(int) yy_HtmlBlockCloseOl()	{ return yyvm(11645); }
+YY_RULE(int) yy_HtmlBlockOl()	{ return yyvm(11596); }
+YY_RULE(int) yy_HtmlBlockOpenP()	{ return yyvm(11560); }
+YY_RULE(int) yy_HtmlBlockCloseP()	{ return yyvm(11533); }
+YY_RULE(int) yy_HtmlBlockP()	{ return yyvm(11484); }
+YY_RULE(int) yy_HtmlBlockOpenPre()	{ return yyvm(11437); }
+YY_RULE(int) yy_HtmlBlockClosePre()	{ return yyvm(11399); }
+YY_RULE(int) yy_HtmlBlockPre()	{ return yyvm(11350); }
+YY_RULE(int) yy_HtmlBlockOpenProgress()	{ return yyvm(11303); }
+YY_RULE(int) yy_HtmlBlockCloseProgress()	{ return yyvm(11265); }
+YY_RULE(int) yy_HtmlBlockProgress()	{ return yyvm(11216); }
+YY_RULE(int) yy_HtmlBlockOpenSection()	{ return yyvm(11169); }
+YY_RULE(int) yy_HtmlBlockCloseSection()	{ return yyvm(11131); }
+YY_RULE(int) yy_HtmlBlockSection()	{ return yyvm(11082); }
+YY_RULE(int) yy_HtmlBlockOpenTable()	{ return yyvm(11035); }
+YY_RULE(int) yy_HtmlBlockCloseTable()	{ return yyvm(10997); }
+YY_RULE(int) yy_HtmlBlockTable()	{ return yyvm(10948); }
+YY_RULE(int) yy_HtmlBlockOpenUl()	{ return yyvm(10901); }
+YY_RULE(int) yy_HtmlBlockCloseUl()	{ return yyvm(10863); }
+YY_RULE(int) yy_HtmlBlockUl()	{ return yyvm(10814); }
+YY_RULE(int) yy_HtmlBlockOpenVideo()	{ return yyvm(10767); }
+YY_RULE(int) yy_HtmlBlockCloseVideo()	{ return yyvm(10729); }
+YY_RULE(int) yy_HtmlBlockVideo()	{ return yyvm(10680); }
+YY_RULE(int) yy_HtmlBlockOpenDd()	{ return yyvm(10633); }
+YY_RULE(int) yy_HtmlBlockCloseDd()	{ return yyvm(10595); }
+YY_RULE(int) yy_HtmlBlockDd()	{ return yyvm(10546); }
+YY_RULE(int) yy_HtmlBlockOpenDt()	{ return yyvm(10499); }
+YY_RULE(int) yy_HtmlBlockCloseDt()	{ return yyvm(10461); }
+YY_RULE(int) yy_HtmlBlockDt()	{ return yyvm(10412); }
+YY_RULE(int) yy_HtmlBlockOpenFrameset()	{ return yyvm(10365); }
+YY_RULE(int) yy_HtmlBlockCloseFrameset()	{ return yyvm(10327); }
+YY_RULE(int) yy_HtmlBlockFrameset()	{ return yyvm(10278); }
+YY_RULE(int) yy_HtmlBlockOpenLi()	{ return yyvm(10231); }
+YY_RULE(int) yy_HtmlBlockCloseLi()	{ return yyvm(10193); }
+YY_RULE(int) yy_HtmlBlockLi()	{ return yyvm(10144); }
+YY_RULE(int) yy_HtmlBlockOpenTbody()	{ return yyvm(10097); }
+YY_RULE(int) yy_HtmlBlockCloseTbody()	{ return yyvm(10059); }
+YY_RULE(int) yy_HtmlBlockTbody()	{ return yyvm(10010); }
+YY_RULE(int) yy_HtmlBlockOpenTd()	{ return yyvm(9963); }
+YY_RULE(int) yy_HtmlBlockCloseTd()	{ return yyvm(9925); }
+YY_RULE(int) yy_HtmlBlockTd()	{ return yyvm(9876); }
+YY_RULE(int) yy_HtmlBlockOpenTfoot()	{ return yyvm(9829); }
+YY_RULE(int) yy_HtmlBlockCloseTfoot()	{ return yyvm(9791); }
+YY_RULE(int) yy_HtmlBlockTfoot()	{ return yyvm(9742); }
+YY_RULE(int) yy_HtmlBlockOpenTh()	{ return yyvm(9695); }
+YY_RULE(int) yy_HtmlBlockCloseTh()	{ return yyvm(9657); }
+YY_RULE(int) yy_HtmlBlockTh()	{ return yyvm(9608); }
+YY_RULE(int) yy_HtmlBlockOpenThead()	{ return yyvm(9561); }
+YY_RULE(int) yy_HtmlBlockCloseThead()	{ return yyvm(9523); }
+YY_RULE(int) yy_HtmlBlockThead()	{ return yyvm(9474); }
+YY_RULE(int) yy_HtmlBlockOpenTr()	{ return yyvm(9427); }
+YY_RULE(int) yy_HtmlBlockCloseTr()	{ return yyvm(9389); }
+YY_RULE(int) yy_HtmlBlockTr()	{ return yyvm(9340); }
+YY_RULE(int) yy_HtmlBlockOpenScript()	{ return yyvm(9293); }
+YY_RULE(int) yy_HtmlBlockCloseScript()	{ return yyvm(9255); }
+YY_RULE(int) yy_HtmlBlockScript()	{ return yyvm(9220); }
+YY_RULE(int) yy_HtmlBlockInTags()	{ return yyvm(8778); }
+YY_RULE(int) yy_MarkdownHtmlTagOpen()	{ return yyvm(8677); }
+YY_RULE(int) yy_HtmlComment()	{ return yyvm(8657); }
+YY_RULE(int) yy_HtmlBlockSelfClosing()	{ return yyvm(8615); }
+YY_RULE(int) yy_HtmlBlockType()	{ return yyvm(8047); }
+YY_RULE(int) yy_StyleOpen()	{ return yyvm(8000); }
+YY_RULE(int) yy_StyleClose()	{ return yyvm(7962); }
+YY_RULE(int) yy_InStyleTags()	{ return yyvm(7927); }
+YY_RULE(int) yy_Str()	{ return yyvm(7873); }
+YY_RULE(int) yy_MathSpan()	{ return yyvm(7827); }
+YY_RULE(int) yy_UlOrStarLine()	{ return yyvm(7793); }
+YY_RULE(int) yy_Space()	{ return yyvm(7774); }
+YY_RULE(int) yy_Strong()	{ return yyvm(7742); }
+YY_RULE(int) yy_Emph()	{ return yyvm(7710); }
+YY_RULE(int) yy_CitationReference()	{ return yyvm(7678); }
+YY_RULE(int) yy_Image()	{ return yyvm(7627); }
+YY_RULE(int) yy_Link()	{ return yyvm(7551); }
+YY_RULE(int) yy_NoteReference()	{ return yyvm(7525); }
+YY_RULE(int) yy_Code()	{ return yyvm(6342); }
+YY_RULE(int) yy_RawHtml()	{ return yyvm(6294); }
+YY_RULE(int) yy_Entity()	{ return yyvm(6250); }
+YY_RULE(int) yy_EscapedChar()	{ return yyvm(6220); }
+YY_RULE(int) yy_Smart()	{ return yyvm(6136); }
+YY_RULE(int) yy_Symbol()	{ return yyvm(6115); }
+YY_RULE(int) yy_NormalChar()	{ return yyvm(6074); }
+YY_RULE(int) yy_StrChunk()	{ return yyvm(5993); }
+YY_RULE(int) yy_Alphanumeric()	{ return yyvm(5981); }
+YY_RULE(int) yy_AposChunk()	{ return yyvm(5954); }
+YY_RULE(int) yy_HexEntity()	{ return yyvm(5923); }
+YY_RULE(int) yy_DecEntity()	{ return yyvm(5893); }
+YY_RULE(int) yy_CharEntity()	{ return yyvm(5866); }
+YY_RULE(int) yy_LineBreak()	{ return yyvm(5842); }
+YY_RULE(int) yy_TerminalEndline()	{ return yyvm(5815); }
+YY_RULE(int) yy_NormalEndline()	{ return yyvm(5735); }
+YY_RULE(int) yy_Eof()	{ return yyvm(5718); }
+YY_RULE(int) yy_SpecialChar()	{ return yyvm(5600); }
+YY_RULE(int) yy_UlLine()	{ return yyvm(5545); }
+YY_RULE(int) yy_StarLine()	{ return yyvm(5490); }
+YY_RULE(int) yy_EmphStar()	{ return yyvm(5434); }
+YY_RULE(int) yy_EmphUl()	{ return yyvm(5378); }
+YY_RULE(int) yy_OneStarOpen()	{ return yyvm(5336); }
+YY_RULE(int) yy_OneStarClose()	{ return yyvm(5295); }
+YY_RULE(int) yy_OneUlOpen()	{ return yyvm(5253); }
+YY_RULE(int) yy_OneUlClose()	{ return yyvm(5203); }
+YY_RULE(int) yy_StrongStar()	{ return yyvm(5147); }
+YY_RULE(int) yy_StrongUl()	{ return yyvm(5091); }
+YY_RULE(int) yy_TwoStarOpen()	{ return yyvm(5048); }
+YY_RULE(int) yy_TwoStarClose()	{ return yyvm(5006); }
+YY_RULE(int) yy_TwoUlOpen()	{ return yyvm(4963); }
+YY_RULE(int) yy_TwoUlClose()	{ return yyvm(4912); }
+YY_RULE(int) yy_ExplicitLink()	{ return yyvm(4863); }
+YY_RULE(int) yy_ReferenceLink()	{ return yyvm(4831); }
+YY_RULE(int) yy_AutoLink()	{ return yyvm(4799); }
+YY_RULE(int) yy_ReferenceLinkDouble()	{ return yyvm(4754); }
+YY_RULE(int) yy_ReferenceLinkSingle()	{ return yyvm(4711); }
+YY_RULE(int) yy_Label()	{ return yyvm(4615); }
+YY_RULE(int) yy_Source()	{ return yyvm(4578); }
+YY_RULE(int) yy_Title()	{ return yyvm(4539); }
+YY_RULE(int) yy_SourceContents()	{ return yyvm(4332); }
+YY_RULE(int) yy_Nonspacechar()	{ return yyvm(4320); }
+YY_RULE(int) yy_TitleSingle()	{ return yyvm(4279); }
+YY_RULE(int) yy_TitleDouble()	{ return yyvm(4238); }
+YY_RULE(int) yy_AutoLinkUrl()	{ return yyvm(4162); }
+YY_RULE(int) yy_AutoLinkEmail()	{ return yyvm(4077); }
+YY_RULE(int) yy_RefSrc()	{ return yyvm(4054); }
+YY_RULE(int) yy_RefTitle()	{ return yyvm(4005); }
+YY_RULE(int) yy_Attributes()	{ return yyvm(3958); }
+YY_RULE(int) yy_Attribute()	{ return yyvm(3924); }
+YY_RULE(int) yy_AttrKey()	{ return yyvm(3901); }
+YY_RULE(int) yy_AttrValue()	{ return yyvm(3867); }
+YY_RULE(int) yy_QuotedValue()	{ return yyvm(3846); }
+YY_RULE(int) yy_UnQuotedValue()	{ return yyvm(3825); }
+YY_RULE(int) yy_RefTitleSingle()	{ return yyvm(3746); }
+YY_RULE(int) yy_RefTitleDouble()	{ return yyvm(3667); }
+YY_RULE(int) yy_RefTitleParens()	{ return yyvm(3588); }
+YY_RULE(int) yy_EmptyTitle()	{ return yyvm(3575); }
+YY_RULE(int) yy_References()	{ return yyvm(3523); }
+YY_RULE(int) yy_Ticks1()	{ return yyvm(3502); }
+YY_RULE(int) yy_Ticks2()	{ return yyvm(3480); }
+YY_RULE(int) yy_Ticks3()	{ return yyvm(3458); }
+YY_RULE(int) yy_Ticks4()	{ return yyvm(3436); }
+YY_RULE(int) yy_Ticks5()	{ return yyvm(3414); }
+YY_RULE(int) yy_HtmlTag()	{ return yyvm(3355); }
+YY_RULE(int) yy_Quoted()	{ return yyvm(3321); }
+YY_RULE(int) yy_ExtendedSpecialChar()	{ return yyvm(3283); }
+YY_RULE(int) yy_NonAlphanumeric()	{ return yyvm(3271); }
+YY_RULE(int) yy_Digit()	{ return yyvm(3259); }
+YY_RULE(int) yy_Ellipsis()	{ return yyvm(3231); }
+YY_RULE(int) yy_Dash()	{ return yyvm(3199); }
+YY_RULE(int) yy_SingleQuoted()	{ return yyvm(3100); }
+YY_RULE(int) yy_DoubleQuoted()	{ return yyvm(3031); }
+YY_RULE(int) yy_Apostrophe()	{ return yyvm(3017); }
+YY_RULE(int) yy_EmDash()	{ return yyvm(2995); }
+YY_RULE(int) yy_EnDash()	{ return yyvm(2957); }
+YY_RULE(int) yy_SingleQuoteStart()	{ return yyvm(2936); }
+YY_RULE(int) yy_SingleQuoteEnd()	{ return yyvm(2915); }
+YY_RULE(int) yy_DoubleQuoteStart()	{ return yyvm(2903); }
+YY_RULE(int) yy_DoubleQuoteEnd()	{ return yyvm(2891); }
+YY_RULE(int) yy_RawNoteReference()	{ return yyvm(2810); }
+YY_RULE(int) yy_GlossaryTerm()	{ return yyvm(2749); }
+YY_RULE(int) yy_GlossarySortKey()	{ return yyvm(2702); }
+YY_RULE(int) yy_RawNoteBlock()	{ return yyvm(2571); }
+YY_RULE(int) yy_InlineNote()	{ return yyvm(2499); }
+YY_RULE(int) yy_Notes()	{ return yyvm(2428); }
+YY_RULE(int) yy_CitationReferenceDouble()	{ return yyvm(2373); }
+YY_RULE(int) yy_CitationReferenceSingle()	{ return yyvm(2309); }
+YY_RULE(int) yy_RawCitationReference()	{ return yyvm(2241); }
+YY_RULE(int) yy_AutoLabels()	{ return yyvm(2086); }
+YY_RULE(int) yy_TableCaption()	{ return yyvm(2032); }
+YY_RULE(int) yy_TableBody()	{ return yyvm(1991); }
+YY_RULE(int) yy_SeparatorLine()	{ return yyvm(1923); }
+YY_RULE(int) yy_TermLine()	{ return yyvm(1889); }
+YY_RULE(int) yy_Term()	{ return yyvm(1735); }
+YY_RULE(int) yy_Definition()	{ return yyvm(1573); }
+YY_RULE(int) yy_TableRow()	{ return yyvm(1456); }
+YY_RULE(int) yy_TableLine()	{ return yyvm(1418); }
+YY_RULE(int) yy_CellDivider()	{ return yyvm(1406); }
+YY_RULE(int) yy_TableCell()	{ return yyvm(1371); }
+YY_RULE(int) yy_ExtendedCell()	{ return yyvm(1330); }
+YY_RULE(int) yy_EmptyCell()	{ return yyvm(1311); }
+YY_RULE(int) yy_FullCell()	{ return yyvm(1065); }
+YY_RULE(int) yy_CellStr()	{ return yyvm(999); }
+YY_RULE(int) yy_AlignmentCell()	{ return yyvm(905); }
+YY_RULE(int) yy_LeftAlignWrap()	{ return yyvm(852); }
+YY_RULE(int) yy_CenterAlignWrap()	{ return yyvm(810); }
+YY_RULE(int) yy_RightAlignWrap()	{ return yyvm(765); }
+YY_RULE(int) yy_LeftAlign()	{ return yyvm(715); }
+YY_RULE(int) yy_CenterAlign()	{ return yyvm(674); }
+YY_RULE(int) yy_RightAlign()	{ return yyvm(630); }
+YY_RULE(int) yy_DocForOPML()	{ return yyvm(533); }
+YY_RULE(int) yy_OPMLBlock()	{ return yyvm(498); }
+YY_RULE(int) yy_OPMLHeadingSection()	{ return yyvm(457); }
+YY_RULE(int) yy_OPMLPlain()	{ return yyvm(330); }
+YY_RULE(int) yy_OPMLHeading()	{ return yyvm(304); }
+YY_RULE(int) yy_OPMLSectionBlock()	{ return yyvm(269); }
+YY_RULE(int) yy_OPMLAtxHeading()	{ return yyvm(135); }
+YY_RULE(int) yy_OPMLSetextHeading()	{ return yyvm(114); }
+YY_RULE(int) yy_OPMLSetextHeading1()	{ return yyvm(91); }
+YY_RULE(int) yy_OPMLSetextHeading2()	{ return yyvm(68); }
+YY_RULE(int) yy_MarkdownHtmlAttribute()	{ return yyvm(0); }
+
+
+#ifndef YY_PART
+
+typedef int (*yyrule)();
+
+YY_PARSE(int) YYPARSEFROM(yyrule yystart)
+{
+  int yyok;
+  if (!yybuflen)
+    {
+      yybuflen= 1024;
+      yybuf= YY_MALLOC(yybuflen);
+      yytextlen= 1024;
+      yytext= YY_MALLOC(yytextlen);
+      yythunkslen= 32;
+      yythunks= YY_MALLOC(sizeof(yythunk) * yythunkslen);
+      yyvalslen= 32;
+      yyvals= YY_MALLOC(sizeof(YYSTYPE) * yyvalslen);
+      yybegin= yyend= yypos= yylimit= yythunkpos= 0;
+    }
+  yybegin= yyend= yypos;
+  yythunkpos= 0;
+  yyval= yyvals;
+  yyok= yystart();
+  if (yyok) yyDone();
+  yyCommit();
+  return yyok;
+  (void)yyrefill;
+  (void)yymatchDot;
+  (void)yymatchChar;
+  (void)yymatchString;
+  (void)yymatchClass;
+  (void)yyDo;
+  (void)yyText;
+  (void)yyDone;
+  (void)yyCommit;
+  (void)yyAccept;
+  (void)yyPush;
+  (void)yyPop;
+  (void)yySet;
+  (void)yytextmax;
+  (void)yy_MarkdownHtmlAttribute;
+  (void)yy_OPMLSetextHeading2;
+  (void)yy_OPMLSetextHeading1;
+  (void)yy_OPMLSetextHeading;
+  (void)yy_OPMLAtxHeading;
+  (void)yy_OPMLSectionBlock;
+  (void)yy_OPMLHeading;
+  (void)yy_OPMLPlain;
+  (void)yy_OPMLHeadingSection;
+  (void)yy_OPMLBlock;
+  (void)yy_DocForOPML;
+  (void)yy_RightAlign;
+  (void)yy_CenterAlign;
+  (void)yy_LeftAlign;
+  (void)yy_RightAlignWrap;
+  (void)yy_CenterAlignWrap;
+  (void)yy_LeftAlignWrap;
+  (void)yy_AlignmentCell;
+  (void)yy_CellStr;
+  (void)yy_FullCell;
+  (void)yy_EmptyCell;
+  (void)yy_ExtendedCell;
+  (void)yy_TableCell;
+  (void)yy_CellDivider;
+  (void)yy_TableLine;
+  (void)yy_TableRow;
+  (void)yy_Definition;
+  (void)yy_Term;
+  (void)yy_TermLine;
+  (void)yy_SeparatorLine;
+  (void)yy_TableBody;
+  (void)yy_TableCaption;
+  (void)yy_AutoLabels;
+  (void)yy_RawCitationReference;
+  (void)yy_CitationReferenceSingle;
+  (void)yy_CitationReferenceDouble;
+  (void)yy_Notes;
+  (void)yy_InlineNote;
+  (void)yy_RawNoteBlock;
+  (void)yy_GlossarySortKey;
+  (void)yy_GlossaryTerm;
+  (void)yy_RawNoteReference;
+  (void)yy_DoubleQuoteEnd;
+  (void)yy_DoubleQuoteStart;
+  (void)yy_SingleQuoteEnd;
+  (void)yy_SingleQuoteStart;
+  (void)yy_EnDash;
+  (void)yy_EmDash;
+  (void)yy_Apostrophe;
+  (void)yy_DoubleQuoted;
+  (void)yy_SingleQuoted;
+  (void)yy_Dash;
+  (void)yy_Ellipsis;
+  (void)yy_Digit;
+  (void)yy_NonAlphanumeric;
+  (void)yy_ExtendedSpecialChar;
+  (void)yy_Quoted;
+  (void)yy_HtmlTag;
+  (void)yy_Ticks5;
+  (void)yy_Ticks4;
+  (void)yy_Ticks3;
+  (void)yy_Ticks2;
+  (void)yy_Ticks1;
+  (void)yy_References;
+  (void)yy_EmptyTitle;
+  (void)yy_RefTitleParens;
+  (void)yy_RefTitleDouble;
+  (void)yy_RefTitleSingle;
+  (void)yy_UnQuotedValue;
+  (void)yy_QuotedValue;
+  (void)yy_AttrValue;
+  (void)yy_AttrKey;
+  (void)yy_Attribute;
+  (void)yy_Attributes;
+  (void)yy_RefTitle;
+  (void)yy_RefSrc;
+  (void)yy_AutoLinkEmail;
+  (void)yy_AutoLinkUrl;
+  (void)yy_TitleDouble;
+  (void)yy_TitleSingle;
+  (void)yy_Nonspacechar;
+  (void)yy_SourceContents;
+  (void)yy_Title;
+  (void)yy_Source;
+  (void)yy_Label;
+  (void)yy_ReferenceLinkSingle;
+  (void)yy_ReferenceLinkDouble;
+  (void)yy_AutoLink;
+  (void)yy_ReferenceLink;
+  (void)yy_ExplicitLink;
+  (void)yy_TwoUlClose;
+  (void)yy_TwoUlOpen;
+  (void)yy_TwoStarClose;
+  (void)yy_TwoStarOpen;
+  (void)yy_StrongUl;
+  (void)yy_StrongStar;
+  (void)yy_OneUlClose;
+  (void)yy_OneUlOpen;
+  (void)yy_OneStarClose;
+  (void)yy_OneStarOpen;
+  (void)yy_EmphUl;
+  (void)yy_EmphStar;
+  (void)yy_StarLine;
+  (void)yy_UlLine;
+  (void)yy_SpecialChar;
+  (void)yy_Eof;
+  (void)yy_NormalEndline;
+  (void)yy_TerminalEndline;
+  (void)yy_LineBreak;
+  (void)yy_CharEntity;
+  (void)yy_DecEntity;
+  (void)yy_HexEntity;
+  (void)yy_AposChunk;
+  (void)yy_Alphanumeric;
+  (void)yy_StrChunk;
+  (void)yy_NormalChar;
+  (void)yy_Symbol;
+  (void)yy_Smart;
+  (void)yy_EscapedChar;
+  (void)yy_Entity;
+  (void)yy_RawHtml;
+  (void)yy_Code;
+  (void)yy_NoteReference;
+  (void)yy_Link;
+  (void)yy_Image;
+  (void)yy_CitationReference;
+  (void)yy_Emph;
+  (void)yy_Strong;
+  (void)yy_Space;
+  (void)yy_UlOrStarLine;
+  (void)yy_MathSpan;
+  (void)yy_Str;
+  (void)yy_InStyleTags;
+  (void)yy_StyleClose;
+  (void)yy_StyleOpen;
+  (void)yy_HtmlBlockType;
+  (void)yy_HtmlBlockSelfClosing;
+  (void)yy_HtmlComment;
+  (void)yy_MarkdownHtmlTagOpen;
+  (void)yy_HtmlBlockInTags;
+  (void)yy_HtmlBlockScript;
+  (void)yy_HtmlBlockCloseScript;
+  (void)yy_HtmlBlockOpenScript;
+  (void)yy_HtmlBlockTr;
+  (void)yy_HtmlBlockCloseTr;
+  (void)yy_HtmlBlockOpenTr;
+  (void)yy_HtmlBlockThead;
+  (void)yy_HtmlBlockCloseThead;
+  (void)yy_HtmlBlockOpenThead;
+  (void)yy_HtmlBlockTh;
+  (void)yy_HtmlBlockCloseTh;
+  (void)yy_HtmlBlockOpenTh;
+  (void)yy_HtmlBlockTfoot;
+  (void)yy_HtmlBlockCloseTfoot;
+  (void)yy_HtmlBlockOpenTfoot;
+  (void)yy_HtmlBlockTd;
+  (void)yy_HtmlBlockCloseTd;
+  (void)yy_HtmlBlockOpenTd;
+  (void)yy_HtmlBlockTbody;
+  (void)yy_HtmlBlockCloseTbody;
+  (void)yy_HtmlBlockOpenTbody;
+  (void)yy_HtmlBlockLi;
+  (void)yy_HtmlBlockCloseLi;
+  (void)yy_HtmlBlockOpenLi;
+  (void)yy_HtmlBlockFrameset;
+  (void)yy_HtmlBlockCloseFrameset;
+  (void)yy_HtmlBlockOpenFrameset;
+  (void)yy_HtmlBlockDt;
+  (void)yy_HtmlBlockCloseDt;
+  (void)yy_HtmlBlockOpenDt;
+  (void)yy_HtmlBlockDd;
+  (void)yy_HtmlBlockCloseDd;
+  (void)yy_HtmlBlockOpenDd;
+  (void)yy_HtmlBlockVideo;
+  (void)yy_HtmlBlockCloseVideo;
+  (void)yy_HtmlBlockOpenVideo;
+  (void)yy_HtmlBlockUl;
+  (void)yy_HtmlBlockCloseUl;
+  (void)yy_HtmlBlockOpenUl;
+  (void)yy_HtmlBlockTable;
+  (void)yy_HtmlBlockCloseTable;
+  (void)yy_HtmlBlockOpenTable;
+  (void)yy_HtmlBlockSection;
+  (void)yy_HtmlBlockCloseSection;
+  (void)yy_HtmlBlockOpenSection;
+  (void)yy_HtmlBlockProgress;
+  (void)yy_HtmlBlockCloseProgress;
+  (void)yy_HtmlBlockOpenProgress;
+  (void)yy_HtmlBlockPre;
+  (void)yy_HtmlBlockClosePre;
+  (void)yy_HtmlBlockOpenPre;
+  (void)yy_HtmlBlockP;
+  (void)yy_HtmlBlockCloseP;
+  (void)yy_HtmlBlockOpenP;
+  (void)yy_HtmlBlockOl;
+  (void)yy_HtmlBlockCloseOl;
+  (void)yy_HtmlBlockOpenOl;
+  (void)yy_HtmlBlockNoscript;
+  (void)yy_HtmlBlockCloseNoscript;
+  (void)yy_HtmlBlockOpenNoscript;
+  (void)yy_HtmlBlockNoframes;
+  (void)yy_HtmlBlockCloseNoframes;
+  (void)yy_HtmlBlockOpenNoframes;
+  (void)yy_HtmlBlockMenu;
+  (void)yy_HtmlBlockCloseMenu;
+  (void)yy_HtmlBlockOpenMenu;
+  (void)yy_HtmlBlockH6;
+  (void)yy_HtmlBlockCloseH6;
+  (void)yy_HtmlBlockOpenH6;
+  (void)yy_HtmlBlockH5;
+  (void)yy_HtmlBlockCloseH5;
+  (void)yy_HtmlBlockOpenH5;
+  (void)yy_HtmlBlockH4;
+  (void)yy_HtmlBlockCloseH4;
+  (void)yy_HtmlBlockOpenH4;
+  (void)yy_HtmlBlockH3;
+  (void)yy_HtmlBlockCloseH3;
+  (void)yy_HtmlBlockOpenH3;
+  (void)yy_HtmlBlockH2;
+  (void)yy_HtmlBlockCloseH2;
+  (void)yy_HtmlBlockOpenH2;
+  (void)yy_HtmlBlockH1;
+  (void)yy_HtmlBlockCloseH1;
+  (void)yy_HtmlBlockOpenH1;
+  (void)yy_HtmlBlockHgroup;
+  (void)yy_HtmlBlockCloseHgroup;
+  (void)yy_HtmlBlockOpenHgroup;
+  (void)yy_HtmlBlockHeader;
+  (void)yy_HtmlBlockCloseHeader;
+  (void)yy_HtmlBlockOpenHeader;
+  (void)yy_HtmlBlockForm;
+  (void)yy_HtmlBlockCloseForm;
+  (void)yy_HtmlBlockOpenForm;
+  (void)yy_HtmlBlockFooter;
+  (void)yy_HtmlBlockCloseFooter;
+  (void)yy_HtmlBlockOpenFooter;
+  (void)yy_HtmlBlockFigure;
+  (void)yy_HtmlBlockCloseFigure;
+  (void)yy_HtmlBlockOpenFigure;
+  (void)yy_HtmlBlockFieldset;
+  (void)yy_HtmlBlockCloseFieldset;
+  (void)yy_HtmlBlockOpenFieldset;
+  (void)yy_HtmlBlockDl;
+  (void)yy_HtmlBlockCloseDl;
+  (void)yy_HtmlBlockOpenDl;
+  (void)yy_HtmlBlockDiv;
+  (void)yy_HtmlBlockCloseDiv;
+  (void)yy_HtmlBlockDir;
+  (void)yy_HtmlBlockCloseDir;
+  (void)yy_HtmlBlockOpenDir;
+  (void)yy_HtmlBlockCenter;
+  (void)yy_HtmlBlockCloseCenter;
+  (void)yy_HtmlBlockOpenCenter;
+  (void)yy_HtmlBlockCanvas;
+  (void)yy_HtmlBlockCloseCanvas;
+  (void)yy_HtmlBlockOpenCanvas;
+  (void)yy_HtmlBlockBlockquote;
+  (void)yy_HtmlBlockCloseBlockquote;
+  (void)yy_HtmlBlockOpenBlockquote;
+  (void)yy_HtmlBlockAside;
+  (void)yy_HtmlBlockCloseAside;
+  (void)yy_HtmlBlockOpenAside;
+  (void)yy_HtmlBlockArticle;
+  (void)yy_HtmlBlockCloseArticle;
+  (void)yy_HtmlBlockOpenArticle;
+  (void)yy_HtmlBlockAddress;
+  (void)yy_HtmlBlockCloseAddress;
+  (void)yy_HtmlAttribute;
+  (void)yy_Spnl;
+  (void)yy_HtmlBlockOpenAddress;
+  (void)yy_OptionallyIndentedLine;
+  (void)yy_Indent;
+  (void)yy_ListBlockLine;
+  (void)yy_ListContinuationBlock;
+  (void)yy_ListBlock;
+  (void)yy_ListItem;
+  (void)yy_Enumerator;
+  (void)yy_ListItemTight;
+  (void)yy_ListLoose;
+  (void)yy_ListTight;
+  (void)yy_Spacechar;
+  (void)yy_Bullet;
+  (void)yy_VerbatimChunk;
+  (void)yy_IndentedLine;
+  (void)yy_NonblankIndentedLine;
+  (void)yy_Line;
+  (void)yy_BlockQuoteRaw;
+  (void)yy_Endline;
+  (void)yy_SetextBottom2;
+  (void)yy_SetextBottom1;
+  (void)yy_SetextHeading2;
+  (void)yy_SetextHeading1;
+  (void)yy_SetextHeading;
+  (void)yy_AtxHeading;
+  (void)yy_AtxStart;
+  (void)yy_Inline;
+  (void)yy_AutoLabel;
+  (void)yy_AtxInline;
+  (void)yy_Inlines;
+  (void)yy_NonindentSpace;
+  (void)yy_Heading;
+  (void)yy_HeadingSectionBlock;
+  (void)yy_Plain;
+  (void)yy_Para;
+  (void)yy_HtmlBlockOpenDiv;
+  (void)yy_ImageBlock;
+  (void)yy_Table;
+  (void)yy_StyleBlock;
+  (void)yy_HtmlBlock;
+  (void)yy_BulletList;
+  (void)yy_OrderedList;
+  (void)yy_HeadingSection;
+  (void)yy_HorizontalRule;
+  (void)yy_Reference;
+  (void)yy_Note;
+  (void)yy_Glossary;
+  (void)yy_DefinitionList;
+  (void)yy_Verbatim;
+  (void)yy_BlockQuote;
+  (void)yy_RawLine;
+  (void)yy_BlankLine;
+  (void)yy_SingleLineMetaKeyValue;
+  (void)yy_AlphanumericAscii;
+  (void)yy_MetaDataValue;
+  (void)yy_SkipBlock;
+  (void)yy_MetaDataOnly;
+  (void)yy_MetaDataKeyValue;
+  (void)yy_MetaData;
+  (void)yy_Newline;
+  (void)yy_Sp;
+  (void)yy_MetaDataKey;
+  (void)yy_DocWithMetaData;
+  (void)yy_Block;
+  (void)yy_StartList;
+  (void)yy_BOM;
+  (void)yy_Doc;
+}
+
+YY_PARSE(int) YYPARSE(void)
+{
+  return YYPARSEFROM(yy_Doc);
+}
+
+YY_PARSE(void) YYRELEASE(void)
+{
+  if (yybuflen)
+    {
+      YY_FREE(yybuf);
+      YY_FREE(yytext);
+      YY_FREE(yythunks);
+      YY_FREE(yyvals);
+      yybuf= yytext= 0;
+      yythunks= 0;
+      yyval= yyvals= 0;
+      yybuflen= yytextlen= yythunkslen= yyvalslen= 0;
+    }
+  if (yystacklen)
+    {
+      YY_FREE(yystack);
+      yystack= 0;
+      yystacklen= 0;
+    }
+}
+
+#endif
+
+
+#include "parsing_functions.c"
+
+
@@ -117,6 +117,8 @@ struct Element {
     union Contents    contents;
     struct Element    *children;
     struct Element    *next;
+    int               pos;          /* roughly where in the text it was
+                                       parsed; see set_raw_block_pos() */
 };
 
 
@@ -128,9 +130,25 @@ element * parse_notes(char *string, int extensions, element *reference_list);
 element * parse_labels(char *string, int extensions, element *reference_list, element *note_list);
 
 element * parse_markdown(char *string, int extensions, element *reference_list, element *note_list, element *label_list);
+element * parse_markdown_range(char *string, size_t length, int extensions, element *reference_list, element *note_list, element *label_list);
 element * parse_markdown_with_metadata(char *string, int extensions, element *reference_list, element *note_list, element *label_list);
 void free_element_list(element * elt);
 void free_element(element *elt);
+void detach_shared_notes(element *list);
+void free_note_list(element *notes);
+void release_parser_buffers(void);
+void set_raw_block_pos(int pos);
+
+extern const markdown_reference_index *shared_references;
+markdown_reference_index * build_reference_index(element *references);
+void free_reference_index(markdown_reference_index *index);
+link * lookup_shared_reference(element *label);
+
+extern const markdown_bibliography *shared_bibliography;
+const char * lookup_bibliography(const char *key);
+element * bibliography_note(char *key);
+void free_bibliography_notes(void);
+void parser_buffer_sizes(markdown_parser_buffers *sizes);
 void print_element_list(GString *out, element *elt, int format, int exts);
 
 
@@ -140,3 +158,33 @@ char * extract_metadata_value(char *text, int extensions, char *key);
 char * metavalue_for_key(char *key, element *list);
 
 element * parse_markdown_for_opml(char *string, int extensions);
+
+/* Byte loops with SIMD variants, chosen when the program is loaded; see
+ * kernels.c */
+enum kernel_levels {
+    KERNEL_GENERIC,
+    KERNEL_SSE2,
+    KERNEL_AVX2,
+    KERNEL_AVX512,
+    KERNEL_LEVELS
+};
+
+extern size_t (*plain_run)(const unsigned char *s, size_t len);
+extern size_t (*html_run)(const char *s, size_t len);
+
+int best_kernel_level(void);
+void set_kernel_level(int level);
+int kernel_level(void);
+const char * kernel_level_name(int level);
+
+/* JSON read in place; see json.c */
+typedef struct {
+    const char *start;
+    const char *end;
+} json_span;
+
+const char * json_skip_space(const char *c);
+const char * json_skip_string(const char *c);
+const char * json_skip_value(const char *c);
+bool json_decode_string(GString *out, json_span value);
+void json_append_string(GString *out, const char *s, size_t length);
@@ -18,7 +18,7 @@
 void print_odf_header(GString *out){
     
     /* Insert required XML header */
-    g_string_append_printf(out,
+    append_literal(out,
 "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" \
 "<office:document xmlns:office=\"urn:oasis:names:tc:opendocument:xmlns:office:1.0\"\n" \
 "     xmlns:style=\"urn:oasis:names:tc:opendocument:xmlns:style:1.0\"\n" \
@@ -57,7 +57,7 @@ void print_odf_header(GString *out){
 "     office:mimetype=\"application/vnd.oasis.opendocument.text\">\n");
     
     /* Font Declarations */
-    g_string_append_printf(out, "<office:font-face-decls>\n" \
+    append_literal(out, "<office:font-face-decls>\n" \
     "   <style:font-face style:name=\"Courier New\" svg:font-family=\"'Courier New'\"\n" \
     "                    style:font-adornments=\"Regular\"\n" \
     "                    style:font-family-generic=\"modern\"\n" \
@@ -65,7 +65,7 @@ void print_odf_header(GString *out){
     "</office:font-face-decls>\n");
     
     /* Append basic style information */
-    g_string_append_printf(out, "<office:styles>\n" \
+    append_literal(out, "<office:styles>\n" \
     "<style:style style:name=\"Standard\" style:family=\"paragraph\" style:class=\"text\">\n" \
     "      <style:paragraph-properties fo:margin-top=\"0in\" fo:margin-bottom=\"0.15in\"" \
     "     fo:text-align=\"justify\" style:justify-single-word=\"false\"/>\n" \
@@ -137,7 +137,7 @@ void print_odf_header(GString *out){
     "</office:styles>\n");
 
     /* Automatic style information */
-    g_string_append_printf(out, "<office:automatic-styles>" \
+    append_literal(out, "<office:automatic-styles>" \
     "   <style:style style:name=\"MMD-Italic\" style:family=\"text\">\n" \
     "      <style:text-properties fo:font-style=\"italic\" style:font-style-asian=\"italic\"\n" \
     "                             style:font-style-complex=\"italic\"/>\n" \
@@ -178,6 +178,6 @@ void print_odf_header(GString *out){
 }
 
 void print_odf_footer(GString *out) {
-    g_string_append_printf(out, "</office:text>\n</office:body>\n</office:document>");
+    append_literal(out, "</office:text>\n</office:body>\n</office:document>");
 }
 
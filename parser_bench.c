@@ -0,0 +1,78 @@
+/**********************************************************************
+
+  parser_bench.c - parse throughput of the markdown parser.
+
+  Converts each file repeatedly to HTML and reports, in MB of input per
+  second, how fast the parse phases went (the passes for references,
+  notes, labels, the document and raw blocks) and how fast the whole
+  conversion went.  "make parser-bench" builds it twice, once with the
+  parser leg writes as C and once with the bytecode one (leg -b).
+
+  Usage: parser_bench [-n ROUNDS] FILE...
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+ ***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "markdown_peg.h"
+#include "harness.h"
+
+typedef struct {
+    double started;
+    double parsing;     /* seconds spent in the parse phases */
+} phase_times;
+
+static void time_phase(int phase, int begin, void *user) {
+    phase_times *times = user;
+
+    if (phase < PHASE_REFERENCES || phase > PHASE_RAW_BLOCKS)
+        return;
+    if (begin)
+        times->started = harness_seconds();
+    else
+        times->parsing += harness_seconds() - times->started;
+}
+
+int main(int argc, char *argv[]) {
+    phase_times times = { 0, 0 };
+    const char *name = strrchr(argv[0], '/') ? strrchr(argv[0], '/') + 1 : argv[0];
+    int rounds = 20;
+    int i, r, files = 0;
+    double bytes = 0, start, elapsed;
+    char *text, *out;
+    size_t length;
+
+    if (argc > 2 && strcmp(argv[1], "-n") == 0) {
+        rounds = atoi(argv[2]);
+        argc -= 2;
+        argv += 2;
+    }
+    markdown_set_trace_hook(time_phase, &times);
+
+    start = harness_seconds();
+    for (i = 1; i < argc; i++) {
+        if ((text = harness_read_file(argv[i], &length)) == NULL) {
+            perror(argv[i]);
+            return 1;
+        }
+        for (r = 0; r < rounds; r++) {
+            out = markdown_to_string(text, 0, HTML_FORMAT);
+            markdown_free(out);
+        }
+        bytes += (double)length * rounds;
+        files++;
+        free(text);
+    }
+    elapsed = harness_seconds() - start;
+
+    printf("%-22s %d files, %.1f MB: parse %.1f MB/s, whole conversion %.1f MB/s\n",
+        name, files, bytes / 1e6,
+        times.parsing > 0 ? bytes / 1e6 / times.parsing : 0,
+        elapsed > 0 ? bytes / 1e6 / elapsed : 0);
+    return 0;
+}
@@ -3,6 +3,25 @@
 
 int yyparse(void);
 
+MD_THREAD_LOCAL int syntax_extensions;  /* Syntax extensions selected. */
+
+/* Reference index shared, read-only, by every conversion */
+const markdown_reference_index *shared_references = NULL;
+
+/* An index of parsed references, hashed on the label in the form that
+ * reference_key() gives it.  Open addressing; size is a power of two. */
+typedef struct {
+    unsigned long hash;
+    char *key;
+    link *link;
+} reference_slot;
+
+struct markdown_reference_index {
+    element *references;    /* the references themselves, owned */
+    reference_slot *slots;
+    size_t size;
+};
+
 static void free_element_contents(element elt);
 
 /* free_element_list - free list of elements recursively */
@@ -15,7 +34,7 @@ void free_element_list(element * elt) {
             free_element_list(elt->children);
             elt->children = NULL;
         }
-        free(elt);
+        g_free(elt);
         elt = next;
     }
 }
@@ -33,29 +52,42 @@ static void free_element_contents(element elt) {
       case NOTE:
       case AUTOLABEL:
       case CITATION:
+      case NOCITATION:
       case TERM:
       case METAKEY:
       case METAVALUE:
       case TABLESEPARATOR:
+      case CELLSPAN:
       case ATTRKEY:
+      case ATTRVALUE:
+      case MATHSPAN:
+      case GLOSSARYSORTKEY:
       case GLOSSARY:
       case GLOSSARYTERM:
       case NOTELABEL:
-        free(elt.contents.str);
+      case LIST:
+      case EMDASH:
+      case ENDASH:
+      case H1: case H2: case H3: case H4: case H5: case H6:
+        if (!is_token(elt.contents.str))
+            g_free(elt.contents.str);
         elt.contents.str = NULL;
         break;
       case LINK:
       case IMAGE:
+      case IMAGEBLOCK:
       case REFERENCE:
-        free(elt.contents.link->url);
+        g_free(elt.contents.link->url);
         elt.contents.link->url = NULL;
-        free(elt.contents.link->title);
+        g_free(elt.contents.link->title);
         elt.contents.link->title = NULL;
         free_element_list(elt.contents.link->label);
-        free(elt.contents.link->identifier);
+        g_free(elt.contents.link->identifier);
         elt.contents.link->identifier = NULL;
-/*        free_element_list(elt.contents.link->attr);*/
-        free(elt.contents.link);
+        /* Links only borrow the attributes of the reference they matched */
+        if (elt.key == REFERENCE)
+            free_element_list(elt.contents.link->attr);
+        g_free(elt.contents.link);
         elt.contents.link = NULL;
         break;
       default:
@@ -63,10 +95,247 @@ static void free_element_contents(element elt) {
     }
 }
 
+/* release_parser_buffers - free the parser's internal buffers.  They are
+ * allocated again on the next parse. */
+void release_parser_buffers(void) {
+    yyrelease();
+}
+
+/* set_raw_block_pos - give elements parsed from now on the position 'pos',
+ * that of the raw block being re-parsed; -1 goes back to their own.  The
+ * text of a raw block is rearranged, so positions within it would not
+ * correspond to the document. */
+void set_raw_block_pos(int pos) {
+    raw_block_pos = pos;
+}
+
+/* parser_buffer_sizes - report the current capacities, in bytes, of the
+ * buffers the parser keeps between runs. */
+void parser_buffer_sizes(markdown_parser_buffers *sizes) {
+    sizes->input = yybuflen;
+    sizes->text = yytextlen;
+    sizes->thunks = sizeof(yythunk) * yythunkslen;
+    sizes->values = sizeof(YYSTYPE) * yyvalslen;
+}
+
+/* detach_shared_notes - note and citation references share their children
+ * with the entries of the notes list, which owns them.  Cut those links in
+ * 'list' so it can be freed without touching the notes. */
+void detach_shared_notes(element *list) {
+    element *cur;
+    for (cur = list; cur != NULL; cur = cur->next) {
+        switch (cur->key) {
+        case NOTE:
+            if (cur->contents.str == NULL) {
+                cur->children = NULL;
+                continue;
+            }
+            break;
+        case CITATION:
+        case NOCITATION:
+            /* "[#key]" marks a citation with no matching note */
+            if (cur->contents.str != NULL && strncmp(cur->contents.str, "[#", 2) != 0) {
+                if (cur->children != NULL && cur->children->key == LOCATOR) {
+                    cur->children->next = NULL;
+                    detach_shared_notes(cur->children->children);
+                } else {
+                    cur->children = NULL;
+                }
+                continue;
+            }
+            break;
+        case LINK:
+        case IMAGE:
+        case IMAGEBLOCK:
+            detach_shared_notes(cur->contents.link->label);
+            break;
+        default:
+            break;
+        }
+        detach_shared_notes(cur->children);
+    }
+}
+
+/* free_note_list - free the notes list, together with the note bodies
+ * that references borrowed from it.  A note's own children are never
+ * references, though printers may relabel the first of them. */
+void free_note_list(element *notes) {
+    element *note, *child;
+    for (note = notes; note != NULL; note = note->next)
+        for (child = note->children; child != NULL; child = child->next)
+            detach_shared_notes(child->children);
+    free_element_list(notes);
+}
+
+/* reference_key - append to 'key' a string that two labels share exactly
+ * when match_inlines() would match them.  Returns false for labels that
+ * never match (those with links or images in them). */
+static bool reference_key(GString *key, element *label) {
+    char *c;
+    for (; label != NULL; label = label->next) {
+        switch (label->key) {
+        case SPACE:
+        case LINEBREAK:
+        case ELLIPSIS:
+        case EMDASH:
+        case ENDASH:
+        case APOSTROPHE:
+            g_string_append_printf(key, "%d;", label->key);
+            break;
+        case CODE:
+        case STR:
+        case HTML:
+            g_string_append_printf(key, "%d:%d:", label->key, (int)strlen(label->contents.str));
+            for (c = label->contents.str; *c != '\0'; c++)
+                g_string_append_c(key, tolower((unsigned char)*c));
+            break;
+        case EMPH:
+        case STRONG:
+        case LIST:
+        case SINGLEQUOTED:
+        case DOUBLEQUOTED:
+            g_string_append_printf(key, "%d(", label->key);
+            if (!reference_key(key, label->children))
+                return false;
+            g_string_append_c(key, ')');
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+/* hash_key - FNV-1a hash of a reference key */
+static unsigned long hash_key(const char *key) {
+    unsigned long hash = 2166136261UL;
+    for (; *key != '\0'; key++)
+        hash = (hash ^ (unsigned char)*key) * 16777619UL;
+    return hash;
+}
+
+/* build_reference_index - index the list of references, taking ownership
+ * of it.  Where labels repeat, the first definition wins, as it does in
+ * find_reference(). */
+markdown_reference_index * build_reference_index(element *references) {
+    markdown_reference_index *index;
+    element *cur;
+    GString *key;
+    size_t count = 0;
+    size_t i;
+    unsigned long hash;
+
+    for (cur = references; cur != NULL; cur = cur->next)
+        count++;
+    index = g_malloc(sizeof(markdown_reference_index));
+    index->references = references;
+    for (index->size = 16; index->size < 2 * count; index->size *= 2)
+        ;
+    index->slots = g_malloc(index->size * sizeof(reference_slot));
+    memset(index->slots, 0, index->size * sizeof(reference_slot));
+
+    for (cur = references; cur != NULL; cur = cur->next) {
+        key = g_string_new("");
+        if (!reference_key(key, cur->contents.link->label)) {
+            g_string_free(key, TRUE);
+            continue;
+        }
+        hash = hash_key(key->str);
+        for (i = hash & (index->size - 1); index->slots[i].key != NULL; i = (i + 1) & (index->size - 1))
+            if (index->slots[i].hash == hash && strcmp(index->slots[i].key, key->str) == 0)
+                break;
+        if (index->slots[i].key != NULL) {
+            g_string_free(key, TRUE);
+            continue;
+        }
+        index->slots[i].hash = hash;
+        index->slots[i].key = g_string_free(key, FALSE);
+        index->slots[i].link = cur->contents.link;
+    }
+    return index;
+}
+
+/* free_reference_index - free the index and the references in it */
+void free_reference_index(markdown_reference_index *index) {
+    size_t i;
+    if (index == NULL)
+        return;
+    for (i = 0; i < index->size; i++)
+        g_free(index->slots[i].key);
+    g_free(index->slots);
+    free_element_list(index->references);
+    g_free(index);
+}
+
+/* lookup_shared_reference - return the link in the shared reference index
+ * whose label matches 'label', or NULL. */
+link * lookup_shared_reference(element *label) {
+    const markdown_reference_index *index = shared_references;
+    GString *key;
+    unsigned long hash;
+    size_t i;
+    link *found = NULL;
+
+    if (index == NULL)
+        return NULL;
+    key = g_string_new("");
+    if (reference_key(key, label)) {
+        hash = hash_key(key->str);
+        for (i = hash & (index->size - 1); index->slots[i].key != NULL; i = (i + 1) & (index->size - 1)) {
+            if (index->slots[i].hash == hash && strcmp(index->slots[i].key, key->str) == 0) {
+                found = index->slots[i].link;
+                break;
+            }
+        }
+    }
+    g_string_free(key, TRUE);
+    return found;
+}
+
+/* Notes made from the shared bibliography for the conversion in progress */
+static MD_THREAD_LOCAL element *bibliography_notes = NULL;
+
+/* bibliography_note - the note for citations of 'key', which the document
+ * does not define, made from its entry in the shared bibliography, or NULL
+ * if it has none.  Like a note in the document, it is made once and its
+ * body shared by every citation of it. */
+element * bibliography_note(char *key) {
+    element *note, *body, *label;
+    const char *text;
+    size_t length;
+
+    for (note = bibliography_notes; note != NULL; note = note->next)
+        if (strcmp(note->contents.str, key) == 0)
+            return note;
+    if ((text = lookup_bibliography(key)) == NULL)
+        return NULL;
+    length = strlen(text);
+    body = mk_element(RAW);
+    body->contents.str = g_malloc(length + 3);
+    memcpy(body->contents.str, text, length);
+    strcpy(body->contents.str + length, "\n\n");
+    label = mk_str(key);
+    label->key = NOTELABEL;
+    body->next = label;
+    note = mk_element(NOTE);
+    note->children = body;
+    note->contents.str = g_strdup(key);
+    note->next = bibliography_notes;
+    bibliography_notes = note;
+    return note;
+}
+
+/* free_bibliography_notes - free the notes made for the conversion that
+ * has ended, with the bodies its citations borrowed */
+void free_bibliography_notes(void) {
+    free_note_list(bibliography_notes);
+    bibliography_notes = NULL;
+}
+
 /* free_element - free element and contents */
 void free_element(element *elt) {
     free_element_contents(*elt);
-    free(elt);
+    g_free(elt);
 }
 
 element * parse_references(char *string, int extensions) {
@@ -133,6 +402,20 @@ element * parse_markdown(char *string, int extensions, element *reference_list,
 
 }
 
+/* parse_markdown_range - parse the 'length' bytes at 'string' as markdown,
+ * leaving them as they are; they need not be NUL-terminated. */
+element * parse_markdown_range(char *string, size_t length, int extensions, element *reference_list, element *note_list, element *label_list) {
+
+    char *oldcharbuf_end = charbuf_end;
+    element *result;
+
+    charbuf_end = string + length;
+    result = parse_markdown(string, extensions, reference_list, note_list, label_list);
+    charbuf_end = oldcharbuf_end;
+    return result;
+
+}
+
 element * parse_markdown_with_metadata(char *string, int extensions, element *reference_list, element *note_list, element *label_list) {
 
     char *oldcharbuf;
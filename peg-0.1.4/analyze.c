@@ -0,0 +1,539 @@
+/* analyze.c - a report on a grammar, for whoever is tuning it.
+ *
+ * leg --analyze prints, instead of a parser:
+ *
+ *  - for every rule, whether it can match the empty string and the set
+ *    of characters a match can start with (its FIRST set);
+ *  - choices with alternatives whose FIRST sets overlap, so that the
+ *    later ones are tried only after the earlier ones have read some
+ *    input and failed;
+ *  - lookaheads (&e, !e) with a repetition in them, which can read any
+ *    amount of input only to throw the position away;
+ *  - rules that nothing in the grammar calls;
+ *  - sequences where something that builds a semantic value (an action,
+ *    or a rule with actions in it) is followed by something that can
+ *    fail, so that the value is built and then discarded.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the same license as the rest of peg.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tree.h"
+
+typedef struct
+{
+  unsigned char	bits[32];
+} CharSet;
+
+static int	*nullable;	/* indexed by rule id */
+static int	*fallible;
+static int	*builds;
+static CharSet	*first;
+
+static void CharSet_add(CharSet *set, int c)		{ set->bits[c >> 3] |= 1 << (c & 7); }
+static int  CharSet_has(CharSet *set, int c)		{ return set->bits[c >> 3] & (1 << (c & 7)); }
+
+static int CharSet_union(CharSet *set, CharSet *other)
+{
+  int i, changed= 0;
+  for (i= 0;  i < 32;  ++i)
+    if (other->bits[i] & ~set->bits[i])
+      {
+	set->bits[i] |= other->bits[i];
+	changed= 1;
+      }
+  return changed;
+}
+
+static int CharSet_intersect(CharSet *set, CharSet *a, CharSet *b)
+{
+  int i, any= 0;
+  for (i= 0;  i < 32;  ++i)
+    any |= (set->bits[i]= a->bits[i] & b->bits[i]);
+  return any;
+}
+
+static void printChar(FILE *stream, int c)
+{
+  switch (c)
+    {
+    case '\n':	fprintf(stream, "\\n");		return;
+    case '\t':	fprintf(stream, "\\t");		return;
+    case '\r':	fprintf(stream, "\\r");		return;
+    case '\\':
+    case ']':
+    case '-':
+    case '^':	fprintf(stream, "\\%c", c);	return;
+    }
+  if (c >= ' ' && c < 0177)
+    fputc(c, stream);
+  else
+    fprintf(stream, "\\%03o", c);
+}
+
+/* Print a set the way a character class is written, or "." for any
+ * character at all. */
+static void CharSet_print(FILE *stream, CharSet *set)
+{
+  int c, end;
+
+  for (c= 1;  c < 256 && CharSet_has(set, c);  ++c)
+    ;
+  if (256 == c)
+    {
+      fprintf(stream, ".");
+      return;
+    }
+  fprintf(stream, "[");
+  for (c= 0;  c < 256;  c= end)
+    {
+      if (!CharSet_has(set, c))
+	{
+	  end= c + 1;
+	  continue;
+	}
+      for (end= c + 1;  end < 256 && CharSet_has(set, end);  ++end)
+	;
+      printChar(stream, c);
+      if (end - c > 2)
+	fprintf(stream, "-");
+      if (end - c > 1)
+	printChar(stream, end - 1);
+    }
+  fprintf(stream, "]");
+}
+
+/* The first character of a literal, or -1 if it is empty. */
+static int literalFirst(char *value)
+{
+  unsigned char *text= (unsigned char *)value;
+  return *text ? classChar(&text) : -1;
+}
+
+static int Node_nullable(Node *node)
+{
+  switch (node->type)
+    {
+    case Name:		return node->name.rule->rule.expression && nullable[node->name.rule->rule.id];
+    case Dot:
+    case Class:		return 0;
+    case Character:
+    case String:	return -1 == literalFirst(node->string.value);
+    case Alternate:
+      for (node= node->alternate.first;  node;  node= node->alternate.next)
+	if (Node_nullable(node))
+	  return 1;
+      return 0;
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	if (!Node_nullable(node))
+	  return 0;
+      return 1;
+    case Plus:		return Node_nullable(node->plus.element);
+    default:		return 1;	/* actions, predicates, lookaheads, ?, * */
+    }
+}
+
+/* True if 'node' can fail to match, as opposed to matching nothing. */
+static int Node_fallible(Node *node)
+{
+  switch (node->type)
+    {
+    case Name:		return !node->name.rule->rule.expression || fallible[node->name.rule->rule.id];
+    case Character:
+    case String:	return -1 != literalFirst(node->string.value);
+    case Action:
+    case Query:
+    case Star:		return 0;
+    case Alternate:
+      for (node= node->alternate.first;  node;  node= node->alternate.next)
+	if (!Node_fallible(node))
+	  return 0;
+      return 1;
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	if (Node_fallible(node))
+	  return 1;
+      return 0;
+    case Plus:		return Node_fallible(node->plus.element);
+    default:		return 1;	/* ., classes, predicates, lookaheads */
+    }
+}
+
+/* True if matching 'node' schedules any actions. */
+static int Node_builds(Node *node)
+{
+  switch (node->type)
+    {
+    case Name:		return node->name.rule->rule.expression && builds[node->name.rule->rule.id];
+    case Action:	return 1;
+    case Alternate:
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	if (Node_builds(node))
+	  return 1;
+      return 0;
+    case Query:
+    case Star:
+    case Plus:		return Node_builds(node->query.element);
+    default:		return 0;	/* lookaheads run no actions */
+    }
+}
+
+static void Node_first(Node *node, CharSet *set)
+{
+  int c;
+
+  switch (node->type)
+    {
+    case Name:
+      if (node->name.rule->rule.expression)
+	CharSet_union(set, &first[node->name.rule->rule.id]);
+      break;
+    case Dot:
+      for (c= 0;  c < 256;  ++c)
+	CharSet_add(set, c);
+      break;
+    case Character:
+    case String:
+      if (-1 != (c= literalFirst(node->string.value)))
+	CharSet_add(set, c);
+      break;
+    case Class:
+      {
+	CharSet bits;
+	charClassBits(bits.bits, node->cclass.value);
+	CharSet_union(set, &bits);
+      }
+      break;
+    case Alternate:
+      for (node= node->alternate.first;  node;  node= node->alternate.next)
+	Node_first(node, set);
+      break;
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	{
+	  Node_first(node, set);
+	  if (!Node_nullable(node))
+	    break;
+	}
+      break;
+    case Query:
+    case Star:
+    case Plus:
+      Node_first(node->query.element, set);
+      break;
+    default:			/* actions, predicates, lookaheads */
+      break;
+    }
+}
+
+/* Work out the properties of every rule, each from those of the rules
+ * it calls, until none changes. */
+static void solve(void)
+{
+  Node *n;
+  int   changed, value;
+
+  nullable= calloc(ruleCount + 1, sizeof(int));
+  fallible= calloc(ruleCount + 1, sizeof(int));
+  builds= calloc(ruleCount + 1, sizeof(int));
+  first= calloc(ruleCount + 1, sizeof(CharSet));
+  do
+    {
+      changed= 0;
+      for (n= rules;  n;  n= n->rule.next)
+	if (n->rule.expression)
+	  {
+	    CharSet set;
+	    if ((value= Node_nullable(n->rule.expression)) != nullable[n->rule.id])
+	      nullable[n->rule.id]= value, changed= 1;
+	    if ((value= Node_fallible(n->rule.expression)) != fallible[n->rule.id])
+	      fallible[n->rule.id]= value, changed= 1;
+	    if ((value= Node_builds(n->rule.expression)) != builds[n->rule.id])
+	      builds[n->rule.id]= value, changed= 1;
+	    memset(&set, 0, sizeof(set));
+	    Node_first(n->rule.expression, &set);
+	    changed |= CharSet_union(&first[n->rule.id], &set);
+	  }
+    }
+  while (changed);
+}
+
+/* The characters a match of 'node' must start with, left in 'bits'; false
+ * if it can match the empty string, so that there are none it must. */
+int Node_firstChars(Node *node, unsigned char bits[32])
+{
+  CharSet set;
+
+  if (!first)
+    solve();
+  if (Node_nullable(node))
+    return 0;
+  memset(&set, 0, sizeof(set));
+  Node_first(node, &set);
+  memcpy(bits, set.bits, 32);
+  return 1;
+}
+
+static int hasRepetition(Node *node)
+{
+  switch (node->type)
+    {
+    case Star:
+    case Plus:		return 1;
+    case Alternate:
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	if (hasRepetition(node))
+	  return 1;
+      return 0;
+    case PeekFor:
+    case PeekNot:
+    case Query:		return hasRepetition(node->query.element);
+    default:		return 0;
+    }
+}
+
+/* Print 'node' as Node_print does, but with actions and predicates
+ * elided; their code would swamp the report. */
+static void Node_brief(FILE *stream, Node *node)
+{
+  switch (node->type)
+    {
+    case Name:		fprintf(stream, " %s", node->name.rule->rule.name);	break;
+    case Dot:		fprintf(stream, " .");					break;
+    case Character:	fprintf(stream, " '%s'", node->character.value);	break;
+    case String:	fprintf(stream, " \"%s\"", node->string.value);		break;
+    case Class:		fprintf(stream, " [%s]", node->cclass.value);		break;
+    case Action:	fprintf(stream, " {}");					break;
+    case Predicate:	fprintf(stream, " &{}");				break;
+    case Alternate:
+      fprintf(stream, " (");
+      for (node= node->alternate.first;  node;  node= node->alternate.next)
+	{
+	  Node_brief(stream, node);
+	  if (node->alternate.next)
+	    fprintf(stream, " |");
+	}
+      fprintf(stream, " )");
+      break;
+    case Sequence:
+      fprintf(stream, " (");
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	Node_brief(stream, node);
+      fprintf(stream, " )");
+      break;
+    case PeekFor:	fprintf(stream, " &");  Node_brief(stream, node->peekFor.element);	break;
+    case PeekNot:	fprintf(stream, " !");  Node_brief(stream, node->peekNot.element);	break;
+    case Query:		Node_brief(stream, node->query.element);  fprintf(stream, "?");	break;
+    case Star:		Node_brief(stream, node->star.element);  fprintf(stream, "*");	break;
+    case Plus:		Node_brief(stream, node->plus.element);  fprintf(stream, "+");	break;
+    }
+}
+
+static int findings;
+
+#define MAX_PAIRS 8	/* overlapping pairs listed for each choice */
+
+/* Report choices with overlapping alternatives within 'node', one line
+ * each: the pairs of alternatives (numbered from 1) whose FIRST sets
+ * meet, and the characters they meet on. */
+static void overlaps(Node *rule, Node *node)
+{
+  Node	  *a, *b;
+  int	   i, j, count, pairs= 0;
+  CharSet  fa, fb, both, all;
+
+  switch (node->type)
+    {
+    case Alternate:
+      memset(&all, 0, sizeof(all));
+      for (a= node->alternate.first, i= 1;  a;  a= a->alternate.next, ++i)
+	{
+	  memset(&fa, 0, sizeof(fa));
+	  Node_first(a, &fa);
+	  for (b= a->alternate.next, j= i + 1;  b;  b= b->alternate.next, ++j)
+	    {
+	      memset(&fb, 0, sizeof(fb));
+	      Node_first(b, &fb);
+	      if (CharSet_intersect(&both, &fa, &fb))
+		{
+		  if (!pairs)
+		    fprintf(output, "  %-24s", rule->rule.name);
+		  if (++pairs <= MAX_PAIRS)
+		    fprintf(output, " %d/%d", i, j);
+		  CharSet_union(&all, &both);
+		}
+	    }
+	}
+      count= i - 1;
+      if (pairs)
+	{
+	  if (pairs > MAX_PAIRS)
+	    fprintf(output, " ...");
+	  fprintf(output, " (%d of %d pairs) on ", pairs, count * (count - 1) / 2);
+	  CharSet_print(output, &all);
+	  fprintf(output, "\n");
+	  ++findings;
+	}
+      for (a= node->alternate.first;  a;  a= a->alternate.next)
+	overlaps(rule, a);
+      break;
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	overlaps(rule, node);
+      break;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:
+      overlaps(rule, node->query.element);
+      break;
+    }
+}
+
+/* Report lookaheads within 'node' that contain repetitions */
+static void lookaheads(Node *rule, Node *node)
+{
+  switch (node->type)
+    {
+    case PeekFor:
+    case PeekNot:
+      if (hasRepetition(node->query.element))
+	{
+	  fprintf(output, "  %-24s ", rule->rule.name);
+	  Node_brief(output, node);
+	  fprintf(output, "\n");
+	  ++findings;
+	  return;
+	}
+      lookaheads(rule, node->query.element);
+      break;
+    case Alternate:
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	lookaheads(rule, node);
+      break;
+    case Query:
+    case Star:
+    case Plus:
+      lookaheads(rule, node->query.element);
+      break;
+    }
+}
+
+/* Report sequences within 'node' that can fail after building values */
+static void discards(Node *rule, Node *node)
+{
+  Node *n, *last= 0;
+  int   building= 0;
+
+  switch (node->type)
+    {
+    case Sequence:
+      for (n= node->sequence.first;  n;  n= n->sequence.next)
+	{
+	  if (building && Node_fallible(n))
+	    last= n;
+	  if (Node_builds(n))
+	    building= 1;
+	  discards(rule, n);
+	}
+      if (last)
+	{
+	  fprintf(output, "  %-24s values from", rule->rule.name);
+	  for (n= node->sequence.first;  n != last;  n= n->sequence.next)
+	    if (Node_builds(n))
+	      Node_brief(output, n);
+	  fprintf(output, " are lost if");
+	  Node_brief(output, last);
+	  fprintf(output, " fails\n");
+	  ++findings;
+	}
+      break;
+    case Alternate:
+      for (n= node->alternate.first;  n;  n= n->alternate.next)
+	discards(rule, n);
+      break;
+    case Query:
+    case Star:
+    case Plus:
+      discards(rule, node->query.element);
+      break;
+    }
+}
+
+static void section(char *title)
+{
+  fprintf(output, "\n%s\n", title);
+  findings= 0;
+}
+
+static void none(void)
+{
+  if (!findings)
+    fprintf(output, "  (none)\n");
+}
+
+void Rule_analyze(Node *node)
+{
+  Node **order= calloc(ruleCount + 1, sizeof(Node *));
+  Node  *n;
+  int    i, count= 0;
+
+  solve();
+
+  /* the rule list is newest first; report in grammar order */
+  for (n= node;  n;  n= n->rule.next)
+    order[count++]= n;
+
+  fprintf(output, "%-26s %-6s %s\n", "rule", "empty", "first");
+  for (i= count - 1;  i >= 0;  --i)
+    {
+      n= order[i];
+      fprintf(output, "%-26s ", n->rule.name);
+      if (!n->rule.expression)
+	{
+	  fprintf(output, "(not defined)\n");
+	  continue;
+	}
+      fprintf(output, "%-6s ", nullable[n->rule.id] ? "yes" : "no");
+      CharSet_print(output, &first[n->rule.id]);
+      fprintf(output, "\n");
+    }
+
+  section("Choices whose alternatives start alike (later ones are tried after earlier ones fail):");
+  for (i= count - 1;  i >= 0;  --i)
+    if (order[i]->rule.expression)
+      overlaps(order[i], order[i]->rule.expression);
+  none();
+
+  section("Lookaheads with repetitions (may scan far ahead, then back up):");
+  for (i= count - 1;  i >= 0;  --i)
+    if (order[i]->rule.expression)
+      lookaheads(order[i], order[i]->rule.expression);
+  none();
+
+  section("Rules not called from the grammar (maybe entry points for yyparsefrom):");
+  for (i= count - 1;  i >= 0;  --i)
+    if (!(RuleUsed & order[i]->rule.flags) && order[i] != start)
+      {
+	fprintf(output, "  %s\n", order[i]->rule.name);
+	++findings;
+      }
+  none();
+
+  section("Sequences that can fail after building values:");
+  for (i= count - 1;  i >= 0;  --i)
+    if (order[i]->rule.expression)
+      discards(order[i], order[i]->rule.expression);
+  none();
+
+  free(order);
+}
@@ -24,6 +24,11 @@
 #include "version.h"
 #include "tree.h"
 
+int inlineLimit= 0;	/* inline rules of at most this many nodes (0: none) */
+int bytecode= 0;	/* compile the rules to bytecode (bytecode.c), not C */
+
+static int inlinedCalls= 0;
+
 static int yyl(void)
 {
   static int prev= 0;
@@ -35,13 +40,40 @@ static void charClassClear(unsigned char bits[], int c)	{ bits[c >> 3] &= ~(1 <<
 
 typedef void (*setter)(unsigned char bits[], int c);
 
-static char *makeCharClass(unsigned char *cclass)
+/* Read one character of a class, decoding escapes, including the octal
+ * ones that the grammar accepts. */
+int classChar(unsigned char **cclass)
+{
+  int c= *(*cclass)++;
+
+  if ('\\' != c || !**cclass)
+    return c;
+  switch (c= *(*cclass)++)
+    {
+    case 'a':  return '\a';	/* bel */
+    case 'b':  return '\b';	/* bs */
+    case 'e':  return '\e';	/* esc */
+    case 'f':  return '\f';	/* ff */
+    case 'n':  return '\n';	/* nl */
+    case 'r':  return '\r';	/* cr */
+    case 't':  return '\t';	/* ht */
+    case 'v':  return '\v';	/* vt */
+    }
+  if (c >= '0' && c <= '7')
+    {
+      int i;
+      c -= '0';
+      for (i= 1;  i < 3 && **cclass >= '0' && **cclass <= '7';  ++i)
+	c= c * 8 + *(*cclass)++ - '0';
+    }
+  return c;
+}
+
+/* Set in 'bits' the characters that the class 'cclass' matches. */
+void charClassBits(unsigned char bits[32], unsigned char *cclass)
 {
-  unsigned char	 bits[32];
   setter	 set;
   int		 c, prev= -1;
-  static char	 string[256];
-  char		*ptr;
 
   if ('^' == *cclass)
     {
@@ -54,34 +86,28 @@ static char *makeCharClass(unsigned char *cclass)
       memset(bits, 0, 32);
       set= charClassSet;
     }
-  while ((c= *cclass++))
+  while (*cclass)
     {
-      if ('-' == c && *cclass && prev >= 0)
+      if ('-' == *cclass && cclass[1] && prev >= 0)
 	{
-	  for (c= *cclass++;  prev <= c;  ++prev)
+	  ++cclass;
+	  for (c= classChar(&cclass);  prev <= c;  ++prev)
 	    set(bits, prev);
 	  prev= -1;
 	}
-      else if ('\\' == c && *cclass)
-	{
-	  switch (c= *cclass++)
-	    {
-	    case 'a':  c= '\a'; break;	/* bel */
-	    case 'b':  c= '\b'; break;	/* bs */
-	    case 'e':  c= '\e'; break;	/* esc */
-	    case 'f':  c= '\f'; break;	/* ff */
-	    case 'n':  c= '\n'; break;	/* nl */
-	    case 'r':  c= '\r'; break;	/* cr */
-	    case 't':  c= '\t'; break;	/* ht */
-	    case 'v':  c= '\v'; break;	/* vt */
-	    default:		break;
-	    }
-	  set(bits, prev= c);
-	}
       else
-	set(bits, prev= c);
+	set(bits, prev= classChar(&cclass));
     }
+}
 
+static char *makeCharClass(unsigned char *cclass)
+{
+  unsigned char	 bits[32];
+  int		 c;
+  static char	 string[256];
+  char		*ptr;
+
+  charClassBits(bits, cclass);
   ptr= string;
   for (c= 0;  c < 32;  ++c)
     ptr += sprintf(ptr, "\\%03o", bits[c]);
@@ -111,7 +137,18 @@ static void Node_compile_c_ko(Node *node, int ko)
       break;
 
     case Name:
-      fprintf(output, "  if (!yy_%s()) goto l%d;", node->name.rule->rule.name, ko);
+      if (RuleInline & node->name.rule->rule.flags)
+	{
+	  /* A failing rule restores the input position itself, but every
+	   * ko label does so too, so the body can go straight there. */
+	  fprintf(output, "  /* %s */", node->name.rule->rule.name);
+	  begin();
+	  Node_compile_c_ko(node->name.rule->rule.expression, ko);
+	  end();
+	  ++inlinedCalls;
+	}
+      else
+	fprintf(output, "  if (!yy_%s()) goto l%d;", node->name.rule->rule.name, ko);
       if (node->name.variable)
 	fprintf(output, "  yyDo(yySet, %d, 0);", node->name.variable->variable.offset);
       break;
@@ -271,6 +308,16 @@ static void undefineVariables(Node *node)
 }
 
 
+/* Rules marked with -H are grouped with the other hot code and those
+ * marked with -C are kept out of its way. */
+static char *placement(Node *rule)
+{
+  if (bytecode) return "";
+  if (RuleHot  & rule->rule.flags) return " YY_HOT";
+  if (RuleCold & rule->rule.flags) return " YY_COLD";
+  return "";
+}
+
 static void Rule_compile_c2(Node *node)
 {
   assert(node);
@@ -287,7 +334,7 @@ static void Rule_compile_c2(Node *node)
 
       safe= ((Query == node->rule.expression->type) || (Star == node->rule.expression->type));
 
-      fprintf(output, "\nYY_RULE(int) yy_%s()\n{", node->rule.name);
+      fprintf(output, "\nYY_RULE(int)%s yy_%s()\n{", placement(node), node->rule.name);
       if (!safe) save(0);
       if (node->rule.variables)
 	fprintf(output, "  yyDo(yyPush, %d, 0);", countVariables(node->rule.variables));
@@ -347,12 +394,45 @@ static char *preamble= "\
     yyprintf((stderr, \"<%c>\", yyc));			\\\n\
   }\n\
 #endif\n\
+#ifndef YY_MALLOC\n\
+#define YY_MALLOC(N)		malloc(N)\n\
+#endif\n\
+#ifndef YY_REALLOC\n\
+#define YY_REALLOC(P, N)	realloc(P, N)\n\
+#endif\n\
+#ifndef YY_FREE\n\
+#define YY_FREE(P)		free(P)\n\
+#endif\n\
+#ifndef YYRELEASE\n\
+#define YYRELEASE	yyrelease\n\
+#endif\n\
+#ifndef YY_ACTION_POS\n\
+#define YY_ACTION_POS(POS)\n\
+#endif\n\
 #ifndef YY_BEGIN\n\
 #define YY_BEGIN	( yybegin= yypos, 1)\n\
 #endif\n\
 #ifndef YY_END\n\
 #define YY_END		( yyend= yypos, 1)\n\
 #endif\n\
+#ifndef YY_LIKELY\n\
+# ifdef __GNUC__\n\
+#  define YY_LIKELY(X)		__builtin_expect(!!(X), 1)\n\
+#  define YY_UNLIKELY(X)	__builtin_expect(!!(X), 0)\n\
+# else\n\
+#  define YY_LIKELY(X)		(X)\n\
+#  define YY_UNLIKELY(X)	(X)\n\
+# endif\n\
+#endif\n\
+#ifndef YY_HOT\n\
+# ifdef __GNUC__\n\
+#  define YY_HOT	__attribute__((hot))\n\
+#  define YY_COLD	__attribute__((cold))\n\
+# else\n\
+#  define YY_HOT\n\
+#  define YY_COLD\n\
+# endif\n\
+#endif\n\
 #ifdef YY_DEBUG\n\
 # define yyprintf(args)	fprintf args\n\
 #else\n\
@@ -390,7 +470,7 @@ YY_LOCAL(int) yyrefill(void)\n\
   while (yybuflen - yypos < 512)\n\
     {\n\
       yybuflen *= 2;\n\
-      yybuf= realloc(yybuf, yybuflen);\n\
+      yybuf= YY_REALLOC(yybuf, yybuflen);\n\
     }\n\
   YY_INPUT((yybuf + yypos), yyn, (yybuflen - yypos));\n\
   if (!yyn) return 0;\n\
@@ -400,14 +480,14 @@ YY_LOCAL(int) yyrefill(void)\n\
 \n\
 YY_LOCAL(int) yymatchDot(void)\n\
 {\n\
-  if (yypos >= yylimit && !yyrefill()) return 0;\n\
+  if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;\n\
   ++yypos;\n\
   return 1;\n\
 }\n\
 \n\
 YY_LOCAL(int) yymatchChar(int c)\n\
 {\n\
-  if (yypos >= yylimit && !yyrefill()) return 0;\n\
+  if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;\n\
   if (yybuf[yypos] == c)\n\
     {\n\
       ++yypos;\n\
@@ -423,7 +503,7 @@ YY_LOCAL(int) yymatchString(char *s)\n\
   int yysav= yypos;\n\
   while (*s)\n\
     {\n\
-      if (yypos >= yylimit && !yyrefill()) return 0;\n\
+      if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;\n\
       if (yybuf[yypos] != *s)\n\
         {\n\
           yypos= yysav;\n\
@@ -438,8 +518,8 @@ YY_LOCAL(int) yymatchString(char *s)\n\
 YY_LOCAL(int) yymatchClass(unsigned char *bits)\n\
 {\n\
   int c;\n\
-  if (yypos >= yylimit && !yyrefill()) return 0;\n\
-  c= yybuf[yypos];\n\
+  if (YY_UNLIKELY(yypos >= yylimit) && !yyrefill()) return 0;\n\
+  c= (unsigned char)yybuf[yypos];\n\
   if (bits[c >> 3] & (1 << (c & 7)))\n\
     {\n\
       ++yypos;\n\
@@ -452,10 +532,10 @@ YY_LOCAL(int) yymatchClass(unsigned char *bits)\n\
 \n\
 YY_LOCAL(void) yyDo(yyaction action, int begin, int end)\n\
 {\n\
-  while (yythunkpos >= yythunkslen)\n\
+  while (YY_UNLIKELY(yythunkpos >= yythunkslen))\n\
     {\n\
       yythunkslen *= 2;\n\
-      yythunks= realloc(yythunks, sizeof(yythunk) * yythunkslen);\n\
+      yythunks= YY_REALLOC(yythunks, sizeof(yythunk) * yythunkslen);\n\
     }\n\
   yythunks[yythunkpos].begin=  begin;\n\
   yythunks[yythunkpos].end=    end;\n\
@@ -473,7 +553,7 @@ YY_LOCAL(int) yyText(int begin, int end)\n\
       while (yytextlen < (yyleng - 1))\n\
 	{\n\
 	  yytextlen *= 2;\n\
-	  yytext= realloc(yytext, yytextlen);\n\
+	  yytext= YY_REALLOC(yytext, yytextlen);\n\
 	}\n\
       memcpy(yytext, yybuf + begin, yyleng);\n\
     }\n\
@@ -489,6 +569,7 @@ YY_LOCAL(void) yyDone(void)\n\
       yythunk *thunk= &yythunks[pos];\n\
       int yyleng= thunk->end ? yyText(thunk->begin, thunk->end) : thunk->begin;\n\
       yyprintf((stderr, \"DO [%d] %p %s\\n\", pos, thunk->action, yytext));\n\
+      YY_ACTION_POS(thunk->begin);\n\
       thunk->action(yytext, yyleng);\n\
     }\n\
   yythunkpos= 0;\n\
@@ -520,7 +601,17 @@ YY_LOCAL(int) yyAccept(int tp0)\n\
   return 1;\n\
 }\n\
 \n\
-YY_LOCAL(void) yyPush(char *text, int count)	{ yyval += count; }\n\
+YY_LOCAL(void) yyPush(char *text, int count)\n\
+{\n\
+  yyval += count;\n\
+  while (yyval - yyvals >= yyvalslen)\n\
+    {\n\
+      int yyoff= yyval - yyvals;\n\
+      yyvalslen *= 2;\n\
+      yyvals= YY_REALLOC(yyvals, sizeof(YYSTYPE) * yyvalslen);\n\
+      yyval= yyvals + yyoff;\n\
+    }\n\
+}\n\
 YY_LOCAL(void) yyPop(char *text, int count)	{ yyval -= count; }\n\
 YY_LOCAL(void) yySet(char *text, int count)	{ yyval[count]= yy; }\n\
 \n\
@@ -542,13 +633,13 @@ YY_PARSE(int) YYPARSEFROM(yyrule yystart)\n\
   if (!yybuflen)\n\
     {\n\
       yybuflen= 1024;\n\
-      yybuf= malloc(yybuflen);\n\
+      yybuf= YY_MALLOC(yybuflen);\n\
       yytextlen= 1024;\n\
-      yytext= malloc(yytextlen);\n\
+      yytext= YY_MALLOC(yytextlen);\n\
       yythunkslen= 32;\n\
-      yythunks= malloc(sizeof(yythunk) * yythunkslen);\n\
+      yythunks= YY_MALLOC(sizeof(yythunk) * yythunkslen);\n\
       yyvalslen= 32;\n\
-      yyvals= malloc(sizeof(YYSTYPE) * yyvalslen);\n\
+      yyvals= YY_MALLOC(sizeof(YYSTYPE) * yyvalslen);\n\
       yybegin= yyend= yypos= yylimit= yythunkpos= 0;\n\
     }\n\
   yybegin= yyend= yypos;\n\
@@ -572,6 +663,9 @@ YY_PARSE(int) YYPARSEFROM(yyrule yystart)\n\
   (void)yyPop;\n\
   (void)yySet;\n\
   (void)yytextmax;\n\
+";
+
+static char *footer2= "\
 }\n\
 \n\
 YY_PARSE(int) YYPARSE(void)\n\
@@ -579,17 +673,114 @@ YY_PARSE(int) YYPARSE(void)\n\
   return YYPARSEFROM(yy_%s);\n\
 }\n\
 \n\
+YY_PARSE(void) YYRELEASE(void)\n\
+{\n\
+  if (yybuflen)\n\
+    {\n\
+      YY_FREE(yybuf);\n\
+      YY_FREE(yytext);\n\
+      YY_FREE(yythunks);\n\
+      YY_FREE(yyvals);\n\
+      yybuf= yytext= 0;\n\
+      yythunks= 0;\n\
+      yyval= yyvals= 0;\n\
+      yybuflen= yytextlen= yythunkslen= yyvalslen= 0;\n\
+    }\n\
+%s}\n\
+\n\
 #endif\n\
 ";
 
 void Rule_compile_c_header(void)
 {
-  fprintf(output, "/* A recursive-descent parser generated by peg %d.%d.%d */\n", PEG_MAJOR, PEG_MINOR, PEG_LEVEL);
+  fprintf(output, "/* A %s parser generated by peg %d.%d.%d */\n", bytecode ? "bytecode" : "recursive-descent", PEG_MAJOR, PEG_MINOR, PEG_LEVEL);
   fprintf(output, "\n");
   fprintf(output, "%s", header);
   fprintf(output, "#define YYRULECOUNT %d\n", ruleCount);
 }
 
+/* Number of nodes in an expression, a measure of the code it compiles to. */
+static int Node_size(Node *node)
+{
+  int size= 1;
+
+  switch (node->type)
+    {
+    case Alternate:
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	size += Node_size(node);
+      break;
+
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:
+      size += Node_size(node->query.element);
+      break;
+    }
+  return size;
+}
+
+/* True if 'node' calls 'rule', directly or through rules to be inlined. */
+static int callsInline(Node *node, Node *rule)
+{
+  int result= 0;
+
+  switch (node->type)
+    {
+    case Name:
+      if (node->name.rule == rule)
+	return 1;
+      node= node->name.rule;
+      if ((RuleInline & node->rule.flags) && !(RuleReached & node->rule.flags))
+	{
+	  node->rule.flags |= RuleReached;
+	  result= callsInline(node->rule.expression, rule);
+	  node->rule.flags &= ~RuleReached;
+	}
+      break;
+
+    case Alternate:
+    case Sequence:
+      for (node= node->sequence.first;  node && !result;  node= node->sequence.next)
+	result= callsInline(node, rule);
+      break;
+
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:
+      result= callsInline(node->query.element, rule);
+      break;
+    }
+  return result;
+}
+
+/* Decide which rules to compile into their callers: those marked with -I
+ * and those no bigger than inlineLimit that are not marked cold with -C,
+ * as long as they have no variables of their own and never call
+ * themselves. */
+static void chooseInlineRules(void)
+{
+  Node *n;
+
+  for (n= rules;  n;  n= n->rule.next)
+    {
+      if (!n->rule.expression)
+	n->rule.flags &= ~RuleInline;
+      else if (inlineLimit > 0 && !(RuleCold & n->rule.flags) && Node_size(n->rule.expression) <= inlineLimit)
+	n->rule.flags |= RuleInline;
+      if ((RuleInline & n->rule.flags) && n->rule.variables)
+	n->rule.flags &= ~RuleInline;
+    }
+  for (n= rules;  n;  n= n->rule.next)
+    if ((RuleInline & n->rule.flags) && callsInline(n->rule.expression, n))
+      n->rule.flags &= ~RuleInline;
+}
+
 int consumesInput(Node *node)
 {
   if (!node) return 0;
@@ -657,10 +848,18 @@ void Rule_compile_c(Node *node)
 
   for (n= rules;  n;  n= n->rule.next)
     consumesInput(n);
+  chooseInlineRules();
+  for (n= rules;  n;  n= n->rule.next)
+    if (RuleInline & n->rule.flags)
+      {
+	/* an inlined rule that cannot fail leaves its caller's label unused */
+	fprintf(output, "#ifdef __GNUC__\n#pragma GCC diagnostic ignored \"-Wunused-label\"\n#endif\n");
+	break;
+      }
 
   fprintf(output, "%s", preamble);
   for (n= node;  n;  n= n->rule.next)
-    fprintf(output, "YY_RULE(int) yy_%s(); /* %d */\n", n->rule.name, n->rule.id);
+    fprintf(output, "YY_RULE(int)%s yy_%s(); /* %d */\n", placement(n), n->rule.name, n->rule.id);
   fprintf(output, "\n");
   for (n= actions;  n;  n= n->action.list)
     {
@@ -671,6 +870,27 @@ void Rule_compile_c(Node *node)
       undefineVariables(n->action.rule->rule.variables);
       fprintf(output, "}\n");
     }
-  Rule_compile_c2(node);
-  fprintf(output, footer, start->rule.name);
+  if (bytecode)
+    Rule_compile_bytecode(node);
+  else
+    Rule_compile_c2(node);
+  fprintf(output, "%s", footer);
+  /* rules compiled into their callers, or into bytecode, may have no
+   * other use */
+  for (n= node;  n;  n= n->rule.next)
+    if (bytecode || (RuleInline & n->rule.flags))
+      fprintf(output, "  (void)yy_%s;\n", n->rule.name);
+  fprintf(output, footer2, start->rule.name,
+	  bytecode ? "  if (yystacklen)\n    {\n      YY_FREE(yystack);\n      yystack= 0;\n      yystacklen= 0;\n    }\n" : "");
+  if (inlinedCalls)
+    {
+      int count= 0, size= 0;
+      for (n= node;  n;  n= n->rule.next)
+	if (RuleInline & n->rule.flags)
+	  {
+	    ++count;
+	    size += Node_size(n->rule.expression);
+	  }
+      fprintf(stderr, "inlined %d calls to %d rules of %d nodes in all\n", inlinedCalls, count, size);
+    }
 }
@@ -11,8 +11,10 @@
 # include <stdio.h>
 # include <stdlib.h>
 # include <unistd.h>
+# include <getopt.h>
 # include <string.h>
 # include <libgen.h>
+# include <fnmatch.h>
 # include <assert.h>
 
   typedef struct Header Header;
@@ -167,7 +169,7 @@ YY_LOCAL(int) yymatchClass(unsigned char *bits)
 {
   int c;
   if (yypos >= yylimit && !yyrefill()) return 0;
-  c= yybuf[yypos];
+  c= (unsigned char)yybuf[yypos];
   if (bits[c >> 3] & (1 << (c & 7)))
     {
       ++yypos;
@@ -983,7 +985,13 @@ static void usage(char *name)
   version(name);
   fprintf(stderr, "usage: %s [<option>...] [<file>...]\n", name);
   fprintf(stderr, "where <option> can be\n");
+  fprintf(stderr, "  -a          (or --analyze) report on the grammar instead of generating a parser\n");
+  fprintf(stderr, "  -b          (or --bytecode) generate bytecode and an interpreter for it\n");
   fprintf(stderr, "  -h          print this help information\n");
+  fprintf(stderr, "  -i <n>      compile rules of at most <n> nodes into their callers\n");
+  fprintf(stderr, "  -I <rule>   compile <rule> into its callers\n");
+  fprintf(stderr, "  -H <rule>   place <rule> with the other hot code\n");
+  fprintf(stderr, "  -C <rule>   place <rule> apart with the cold code\n");
   fprintf(stderr, "  -o <ofile>  write output to <ofile>\n");
   fprintf(stderr, "  -v          be verbose\n");
   fprintf(stderr, "  -V          print version number and exit\n");
@@ -994,18 +1002,35 @@ static void usage(char *name)
 
 int main(int argc, char **argv)
 {
-  Node *n;
-  int   c;
+  Node  *n;
+  int    c;
+  char **named= calloc(argc, sizeof(char *));
+  int   *namedFlags= calloc(argc, sizeof(int));
+  int    namedCount= 0;
+  int    analyzeFlag= 0;
+  static struct option longOptions[]= {
+    { "analyze", no_argument, 0, 'a' },
+    { "bytecode", no_argument, 0, 'b' },
+    { 0, 0, 0, 0 }
+  };
 
   output= stdout;
   input= stdin;
   lineNumber= 1;
   fileName= "<stdin>";
 
-  while (-1 != (c= getopt(argc, argv, "Vho:v")))
+  while (-1 != (c= getopt_long(argc, argv, "abVhi:I:H:C:o:v", longOptions, 0)))
     {
       switch (c)
 	{
+	case 'a':
+	  analyzeFlag= 1;
+	  break;
+
+	case 'b':
+	  bytecode= 1;
+	  break;
+
 	case 'V':
 	  version(basename(argv[0]));
 	  exit(0);
@@ -1014,6 +1039,17 @@ int main(int argc, char **argv)
 	  usage(basename(argv[0]));
 	  break;
 
+	case 'i':
+	  inlineLimit= atoi(optarg);
+	  break;
+
+	case 'I':
+	case 'H':
+	case 'C':
+	  namedFlags[namedCount]= ('I' == c) ? RuleInline : ('H' == c) ? RuleHot : RuleCold;
+	  named[namedCount++]= optarg;
+	  break;
+
 	case 'o':
 	  if (!(output= fopen(optarg, "w")))
 	    {
@@ -1063,10 +1099,35 @@ int main(int argc, char **argv)
     if (!yyparse())
       yyerror("syntax error");
 
+  /* -I, -H and -C name rules by shell pattern; a later -H or -C
+   * overrides an earlier one for the rules they both match */
+  for (c= 0;  c < namedCount;  ++c)
+    {
+      int matched= 0;
+      for (n= rules;  n;  n= n->any.next)
+	if (!fnmatch(named[c], n->rule.name, 0))
+	  {
+	    if (RuleInline != namedFlags[c])
+	      n->rule.flags &= ~(RuleHot | RuleCold);
+	    n->rule.flags |= namedFlags[c];
+	    ++matched;
+	  }
+      if (!matched)
+	fprintf(stderr, "no rule matches '%s'\n", named[c]);
+    }
+  free(named);
+  free(namedFlags);
+
   if (verboseFlag)
     for (n= rules;  n;  n= n->any.next)
       Rule_print(n);
 
+  if (analyzeFlag)
+    {
+      Rule_analyze(rules);
+      return 0;
+    }
+
   Rule_compile_c_header();
 
   for (; headers;  headers= headers->next)
@@ -23,6 +23,9 @@ enum { Unknown= 0, Rule, Variable, Name, Dot, Character, String, Class, Action,
 enum {
   RuleUsed	= 1<<0,
   RuleReached	= 1<<1,
+  RuleInline	= 1<<2,
+  RuleHot	= 1<<3,
+  RuleCold	= 1<<4,
 };
 
 typedef union Node Node;
@@ -72,6 +75,8 @@ extern Node *rules;
 extern Node *start;
 
 extern int   ruleCount;
+extern int   inlineLimit;
+extern int   bytecode;
 
 extern FILE *output;
 
@@ -101,8 +106,13 @@ extern Node *push(Node *node);
 extern Node *top(void);
 extern Node *pop(void);
 
+extern int   classChar(unsigned char **cclass);
+extern void  charClassBits(unsigned char bits[32], unsigned char *cclass);
 extern void  Rule_compile_c_header(void);
 extern void  Rule_compile_c(Node *node);
+extern void  Rule_compile_bytecode(Node *node);
+extern void  Rule_analyze(Node *node);
+extern int   Node_firstChars(Node *node, unsigned char bits[32]);
 
 extern void  Node_print(Node *node);
 extern void  Rule_print(Node *node);
@@ -0,0 +1,962 @@
+/* bytecode.c - compile a grammar to bytecode for a small interpreter.
+ *
+ * leg -b writes, instead of a C function per rule, one array of
+ * instructions that yyvm (in the generated parser) runs.  Actions stay C
+ * functions and predicates become small ones; everything else is an
+ * instruction:
+ *
+ *   ENTER rule slots		start of a rule: room for its save slots
+ *   RETURN, FAIL		end of a rule, matched or not
+ *   CALL address ko		call a rule; go to ko if it fails
+ *   JUMP address
+ *   SAVE slot, RESTORE slot	the position and thunk position
+ *   DOT ko, CHAR c ko		match one character
+ *   STRING offset length ko	match a string from yyliterals
+ *   CLASS class ko		match one character in a class from yyclasses
+ *   TEST class ko		go to ko unless the next character is in a class
+ *   SPAN class			any number of characters in a class
+ *   SCAN offset length		any number of characters up to a string
+ *   ACTION action		record an action to run
+ *   PREDICATE predicate ko	test a semantic predicate
+ *   BEGIN ko, END ko		mark the start and end of yytext
+ *   PUSH count, POP count, SET -offset	 rule variables
+ *
+ * SPAN and SCAN take the place of whole repetitions: [a-z]*, (!'\n' .)*
+ * and (!"-->" .)*, and rules that amount to a character class, such as
+ * Spacechar = ' ' | '\t', are matched as one.  Runs of characters and
+ * strings in a sequence become one STRING.
+ *
+ * A choice tries each alternative only if the next character could start
+ * it (TEST, from the FIRST sets that analyze.c works out), and a test
+ * that fails before anything has moved goes past the RESTORE that would
+ * otherwise follow.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the same license as the rest of peg.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tree.h"
+
+enum { opENTER, opRETURN, opFAIL, opCALL, opJUMP, opSAVE, opRESTORE, opDOT, opCHAR, opSTRING,
+       opCLASS, opTEST, opSPAN, opSCAN, opACTION, opPREDICATE, opBEGIN, opEND, opPUSH, opPOP, opSET, opCount };
+
+static char *opNames[opCount]= {
+  "ENTER", "RETURN", "FAIL", "CALL", "JUMP", "SAVE", "RESTORE", "DOT", "CHAR", "STRING",
+  "CLASS", "TEST", "SPAN", "SCAN", "ACTION", "PREDICATE", "BEGIN", "END", "PUSH", "POP", "SET"
+};
+
+/* number of operands of each instruction */
+static int opSizes[opCount]= { 2, 0, 0, 2, 1, 1, 1, 1, 2, 3, 2, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1 };
+
+static int	 *code;		/* the instructions, with label numbers for addresses */
+static int	  codeLength, codeSize;
+static int	 *fixups;	/* where in code those label numbers are */
+static int	  fixupCount, fixupSize;
+static int	 *labels;	/* address of each label, or -1 */
+static int	  labelCount, labelSize;
+static int	 *ruleLabels;	/* label of each rule, by id */
+
+static unsigned char (*classes)[32];
+static int	  classCount, classSize;
+static unsigned char *literals;
+static int	  literalsLength, literalsSize;
+static Node	**predicates;
+static int	  predicateCount, predicateSize;
+
+static int	  slots, maxSlots;	/* save slots of the rule being compiled */
+static int	  cleanKo= -1, cleanLabel, cleanAt;	/* see koFor */
+
+static void *grow(void *array, int *size, int count, int elementSize)
+{
+  if (count < *size)
+    return array;
+  while (count >= *size)
+    *size= *size ? *size * 2 : 64;
+  if (!(array= realloc(array, *size * elementSize)))
+    {
+      perror("realloc");
+      exit(1);
+    }
+  return array;
+}
+
+static void emit(int word)
+{
+  code= grow(code, &codeSize, codeLength, sizeof(int));
+  code[codeLength++]= word;
+}
+
+static int newLabel(void)
+{
+  labels= grow(labels, &labelSize, labelCount, sizeof(int));
+  labels[labelCount]= -1;
+  return labelCount++;
+}
+
+static void placeLabel(int label)	{ labels[label]= codeLength; }
+
+static void emitLabel(int label)
+{
+  fixups= grow(fixups, &fixupSize, fixupCount, sizeof(int));
+  fixups[fixupCount++]= codeLength;
+  emit(label);
+}
+
+static int newSlot(void)
+{
+  if (++slots > maxSlots)
+    maxSlots= slots;
+  return slots - 1;
+}
+
+/* While nothing has been emitted since 'cleanAt', failing there leaves
+ * nothing to undo, so a test can go to 'cleanLabel', just past the
+ * RESTORE at 'cleanKo', instead. */
+static void setClean(int ko, int clean)
+{
+  cleanKo= ko;
+  cleanLabel= clean;
+  cleanAt= codeLength;
+}
+
+static int koFor(int ko)
+{
+  return (ko == cleanKo && codeLength == cleanAt) ? cleanLabel : ko;
+}
+
+static int addClass(unsigned char bits[32])
+{
+  int i;
+  for (i= 0;  i < classCount;  ++i)
+    if (!memcmp(classes[i], bits, 32))
+      return i;
+  classes= grow(classes, &classSize, classCount, 32);
+  memcpy(classes[classCount], bits, 32);
+  return classCount++;
+}
+
+static int addLiteral(unsigned char *bytes, int length)
+{
+  int i;
+  for (i= 0;  i + length <= literalsLength;  ++i)
+    if (!memcmp(literals + i, bytes, length))
+      return i;
+  while (literalsLength + length >= literalsSize)
+    literals= grow(literals, &literalsSize, literalsSize, 1);
+  memcpy(literals + literalsLength, bytes, length);
+  literalsLength += length;
+  return literalsLength - length;
+}
+
+static int actionIndex(Node *node)
+{
+  Node *n;
+  int   i= 0;
+  for (n= actions;  n != node;  n= n->action.list)
+    ++i;
+  return i;
+}
+
+/* The characters of a Character or String node, escapes decoded, stored
+ * at 'bytes'; returns how many. */
+static int literalBytes(Node *node, unsigned char *bytes)
+{
+  unsigned char *s= (unsigned char *)node->string.value;
+  int		 length= 0;
+  while (*s)
+    bytes[length++]= classChar(&s);
+  return length;
+}
+
+static int isLiteral(Node *node)	{ return Character == node->type || String == node->type; }
+
+/* True if 'node' matches exactly one character, from the set it leaves
+ * in 'bits', with no other effect. */
+static int charSet(Node *node, unsigned char bits[32])
+{
+  unsigned char	 other[32], s[8];
+  int		 i, result= 0;
+
+  switch (node->type)
+    {
+    case Dot:
+      memset(bits, 255, 32);
+      return 1;
+
+    case Character:
+    case String:
+      if (strlen(node->string.value) >= sizeof(s) || 1 != literalBytes(node, s))
+	return 0;
+      memset(bits, 0, 32);
+      bits[s[0] >> 3] |= 1 << (s[0] & 7);
+      return 1;
+
+    case Class:
+      charClassBits(bits, node->cclass.value);
+      return 1;
+
+    case Name:
+      node= node->name.rule;
+      if (node->rule.variables || !node->rule.expression || (RuleReached & node->rule.flags))
+	return 0;
+      node->rule.flags |= RuleReached;
+      result= charSet(node->rule.expression, bits);
+      node->rule.flags &= ~RuleReached;
+      return result;
+
+    case Alternate:
+      memset(bits, 0, 32);
+      for (node= node->alternate.first;  node;  node= node->alternate.next)
+	{
+	  if (!charSet(node, other))
+	    return 0;
+	  for (i= 0;  i < 32;  ++i)
+	    bits[i] |= other[i];
+	}
+      return 1;
+
+    case Sequence:		/* !a b */
+      node= node->sequence.first;
+      if (!node || PeekNot != node->type || !node->sequence.next || node->sequence.next->sequence.next)
+	return 0;
+      if (!charSet(node->peekNot.element, other) || !charSet(node->sequence.next, bits))
+	return 0;
+      for (i= 0;  i < 32;  ++i)
+	bits[i] &= ~other[i];
+      return 1;
+    }
+  return 0;
+}
+
+/* True if 'node' is (!"string" .), for SCAN; the string is left in
+ * 'bytes' and its length in 'length'. */
+static int scanUntil(Node *node, unsigned char **bytes, int *length)
+{
+  Node *not;
+
+  if (Sequence != node->type || !(not= node->sequence.first) || PeekNot != not->type
+      || !not->sequence.next || Dot != not->sequence.next->type || not->sequence.next->sequence.next
+      || !isLiteral(not->peekNot.element))
+    return 0;
+  *bytes= malloc(strlen(not->peekNot.element->string.value) + 1);
+  *length= literalBytes(not->peekNot.element, *bytes);
+  return 1;
+}
+
+static void emitCharSet(unsigned char bits[32], int ko)
+{
+  int c, count= 0, last= 0;
+
+  ko= koFor(ko);
+  for (c= 0;  c < 256;  ++c)
+    if (bits[c >> 3] & (1 << (c & 7)))
+      {
+	++count;
+	last= c;
+      }
+  if (256 == count)
+    emit(opDOT);
+  else if (1 == count)
+    {
+      emit(opCHAR);
+      emit(last);
+    }
+  else
+    {
+      emit(opCLASS);
+      emit(addClass(bits));
+    }
+  emitLabel(ko);
+}
+
+static void emitString(unsigned char *bytes, int length, int ko)
+{
+  if (!length)
+    return;
+  ko= koFor(ko);
+  if (1 == length)
+    {
+      emit(opCHAR);
+      emit(bytes[0]);
+    }
+  else
+    {
+      emit(opSTRING);
+      emit(addLiteral(bytes, length));
+      emit(length);
+    }
+  emitLabel(ko);
+}
+
+static void Node_compile_bytecode(Node *node, int ko);
+
+/* Before an alternative or a repetition that the next character can rule
+ * out, and that would not test it straight away anyway, test it; true if
+ * there is a test. */
+static int guard(Node *node, int ko)
+{
+  unsigned char	 bits[32];
+  Node		*head= (Sequence == node->type) ? node->sequence.first : node;
+  int		 c;
+
+  if (!head || isLiteral(head) || charSet(head, bits) || !Node_firstChars(node, bits))
+    return 0;
+  for (c= 0;  c < 32 && 255 == bits[c];  ++c)
+    ;
+  if (32 == c)
+    return 0;
+  ko= koFor(ko);
+  emit(opTEST);
+  emit(addClass(bits));
+  emitLabel(ko);
+  cleanAt= codeLength;		/* TEST moves nothing */
+  return 1;
+}
+
+/* The loop of a Star, or of a Plus after its first match. */
+static void compileRepetition(Node *element)
+{
+  unsigned char	 bits[32], *bytes;
+  int		 length;
+
+  if (charSet(element, bits))
+    {
+      emit(opSPAN);
+      emit(addClass(bits));
+    }
+  else if (scanUntil(element, &bytes, &length))
+    {
+      emit(opSCAN);
+      emit(addLiteral(bytes, length));
+      emit(length);
+      free(bytes);
+    }
+  else
+    {
+      int again= newLabel(), out= newLabel(), clean= newLabel(), slot= newSlot();
+      placeLabel(again);
+      setClean(out, clean);
+      guard(element, out);
+      emit(opSAVE);  emit(slot);
+      cleanAt= codeLength;
+      Node_compile_bytecode(element, out);
+      emit(opJUMP);  emitLabel(again);
+      placeLabel(out);
+      emit(opRESTORE);  emit(slot);
+      placeLabel(clean);
+      --slots;
+    }
+}
+
+static void Node_compile_bytecode(Node *node, int ko)
+{
+  unsigned char bits[32];
+
+  if (Dot != node->type && Class != node->type && !isLiteral(node) && charSet(node, bits))
+    {
+      emitCharSet(bits, ko);
+      if (Name == node->type && node->name.variable)
+	{
+	  emit(opSET);
+	  emit(-node->name.variable->variable.offset);
+	}
+      return;
+    }
+
+  switch (node->type)
+    {
+    case Dot:
+    case Class:
+      charSet(node, bits);
+      emitCharSet(bits, ko);
+      break;
+
+    case Character:
+    case String:
+      {
+	unsigned char *bytes= malloc(strlen(node->string.value) + 1);
+	emitString(bytes, literalBytes(node, bytes), ko);
+	free(bytes);
+      }
+      break;
+
+    case Name:
+      if (RuleInline & node->name.rule->rule.flags)
+	Node_compile_bytecode(node->name.rule->rule.expression, ko);
+      else
+	{
+	  ko= koFor(ko);
+	  emit(opCALL);
+	  emitLabel(ruleLabels[node->name.rule->rule.id]);
+	  emitLabel(ko);
+	}
+      if (node->name.variable)
+	{
+	  emit(opSET);
+	  emit(-node->name.variable->variable.offset);
+	}
+      break;
+
+    case Action:
+      emit(opACTION);
+      emit(actionIndex(node));
+      break;
+
+    case Predicate:		/* moves nothing, so leaves things clean */
+      {
+	int clean= (codeLength == cleanAt);
+	ko= koFor(ko);
+	if (!strcmp(node->predicate.text, "YY_BEGIN"))
+	  emit(opBEGIN);
+	else if (!strcmp(node->predicate.text, "YY_END"))
+	  emit(opEND);
+	else
+	  {
+	    predicates= grow(predicates, &predicateSize, predicateCount, sizeof(Node *));
+	    predicates[predicateCount]= node;
+	    emit(opPREDICATE);
+	    emit(predicateCount++);
+	  }
+	emitLabel(ko);
+	if (clean)
+	  cleanAt= codeLength;
+      }
+      break;
+
+    case Alternate:
+      {
+	int ok= newLabel(), slot= newSlot(), first= 1, resave= 0;
+	for (node= node->alternate.first;  node;  node= node->alternate.next)
+	  if (node->alternate.next)
+	    {
+	      int next= newLabel(), clean= newLabel();
+	      setClean(next, clean);
+	      if (first)
+		{
+		  /* a test of the first alternative can go before the SAVE,
+		   * which is then needed after it instead */
+		  resave= guard(node, next);
+		  emit(opSAVE);  emit(slot);
+		  cleanAt= codeLength;
+		  first= 0;
+		}
+	      else
+		guard(node, next);
+	      Node_compile_bytecode(node, next);
+	      emit(opJUMP);  emitLabel(ok);
+	      placeLabel(next);
+	      emit(opRESTORE);  emit(slot);
+	      placeLabel(clean);
+	      if (resave)
+		{
+		  emit(opSAVE);  emit(slot);
+		  resave= 0;
+		}
+	    }
+	  else
+	    {
+	      guard(node, ko);
+	      Node_compile_bytecode(node, ko);
+	    }
+	placeLabel(ok);
+	--slots;
+      }
+      break;
+
+    case Sequence:
+      for (node= node->sequence.first;  node;  )
+	if (isLiteral(node) && node->sequence.next && isLiteral(node->sequence.next))
+	  {
+	    Node	  *n;
+	    int		   size= 1, length= 0;
+	    unsigned char *bytes;
+	    for (n= node;  n && isLiteral(n);  n= n->sequence.next)
+	      size += strlen(n->string.value);
+	    bytes= malloc(size);
+	    for (;  node && isLiteral(node);  node= node->sequence.next)
+	      length += literalBytes(node, bytes + length);
+	    emitString(bytes, length, ko);
+	    free(bytes);
+	  }
+	else
+	  {
+	    Node_compile_bytecode(node, ko);
+	    node= node->sequence.next;
+	  }
+      break;
+
+    case PeekFor:
+      {
+	int slot= newSlot();
+	emit(opSAVE);  emit(slot);
+	Node_compile_bytecode(node->peekFor.element, ko);
+	emit(opRESTORE);  emit(slot);
+	--slots;
+      }
+      break;
+
+    case PeekNot:
+      {
+	int ok= newLabel(), clean= newLabel(), slot= newSlot();
+	emit(opSAVE);  emit(slot);
+	setClean(ok, clean);
+	Node_compile_bytecode(node->peekNot.element, ok);
+	emit(opJUMP);  emitLabel(ko);
+	placeLabel(ok);
+	emit(opRESTORE);  emit(slot);
+	placeLabel(clean);
+	--slots;
+      }
+      break;
+
+    case Query:
+      {
+	int qko= newLabel(), qok= newLabel(), slot= newSlot();
+	setClean(qko, qok);
+	guard(node->query.element, qko);
+	emit(opSAVE);  emit(slot);
+	cleanAt= codeLength;
+	Node_compile_bytecode(node->query.element, qko);
+	emit(opJUMP);  emitLabel(qok);
+	placeLabel(qko);
+	emit(opRESTORE);  emit(slot);
+	placeLabel(qok);
+	--slots;
+      }
+      break;
+
+    case Star:
+      compileRepetition(node->star.element);
+      break;
+
+    case Plus:
+      Node_compile_bytecode(node->plus.element, ko);
+      compileRepetition(node->plus.element);
+      break;
+
+    default:
+      fprintf(stderr, "\nNode_compile_bytecode: illegal node type %d\n", node->type);
+      exit(1);
+    }
+}
+
+static int countVariables(Node *node)
+{
+  int count= 0;
+  for (;  node;  node= node->variable.next)
+    ++count;
+  return count;
+}
+
+static void Rule_compile_bytecode2(Node *node)
+{
+  int ko= newLabel(), clean= newLabel(), safe, slotsAt;
+
+  safe= ((Query == node->rule.expression->type) || (Star == node->rule.expression->type));
+  placeLabel(ruleLabels[node->rule.id]);
+  emit(opENTER);
+  emit(node->rule.id);
+  slotsAt= codeLength;
+  emit(0);
+  slots= maxSlots= 1;
+  setClean(ko, clean);
+  if (!safe)
+    {
+      guard(node->rule.expression, ko);
+      emit(opSAVE);  emit(0);
+      cleanAt= codeLength;
+    }
+  if (node->rule.variables)
+    {
+      emit(opPUSH);
+      emit(countVariables(node->rule.variables));
+    }
+  Node_compile_bytecode(node->rule.expression, ko);
+  if (node->rule.variables)
+    {
+      emit(opPOP);
+      emit(countVariables(node->rule.variables));
+    }
+  emit(opRETURN);
+  if (!safe)
+    {
+      placeLabel(ko);
+      emit(opRESTORE);  emit(0);
+      placeLabel(clean);
+      emit(opFAIL);
+    }
+  code[slotsAt]= maxSlots;
+}
+
+static void printLiterals(void)
+{
+  int i;
+
+  fprintf(output, "static const char yyliterals[]= \"");
+  for (i= 0;  i < literalsLength;  ++i)
+    {
+      int c= literals[i];
+      if (i && !(i % 64))
+	fprintf(output, "\"\n  \"");
+      if (c >= ' ' && c < 0177 && '"' != c && '\\' != c && '?' != c)
+	fputc(c, output);
+      else
+	fprintf(output, "\\%03o", c);
+    }
+  fprintf(output, "\";\n");
+}
+
+static void printCode(Node **byId, int *ruleAt)
+{
+  int *startOf= calloc(codeLength + 1, sizeof(int));
+  int  pc, i;
+
+  for (i= 1;  i <= ruleCount;  ++i)
+    if (ruleAt[i] >= 0)
+      startOf[ruleAt[i]]= i;
+  fprintf(output, "static const yyword yycode[]= {\n");
+  for (pc= 0;  pc < codeLength;  pc += 1 + opSizes[code[pc]])
+    {
+      if (startOf[pc])
+	fprintf(output, "  /* %d: %s */\n", pc, byId[startOf[pc]]->rule.name);
+      fprintf(output, "  yyop_%s,", opNames[code[pc]]);
+      for (i= 1;  i <= opSizes[code[pc]];  ++i)
+	fprintf(output, " %d,", code[pc + i]);
+      fprintf(output, "\n");
+    }
+  fprintf(output, "};\n\n");
+  free(startOf);
+}
+
+static char *vm1= "\
+\n\
+/* yyvm runs the bytecode of the rule at 'yyentry', returning 1 if it\n\
+ * matched.  Calls between rules use yystack rather than the C stack:\n\
+ * each pushes the address to return to, the address to go to if the rule\n\
+ * fails and the caller's frame, after which come the callee's save slots,\n\
+ * each a (yypos, yythunkpos) pair. */\n\
+\n\
+#if defined(__GNUC__) && !defined(YY_SWITCH)\n\
+# define YY_THREADED	1\n\
+# define YY_OP(OP)	yyl_##OP\n\
+# define YY_NEXT	goto *yyops[*yyc]\n\
+#else\n\
+# define YY_OP(OP)	case yyop_##OP\n\
+# define YY_NEXT	goto yynext\n\
+#endif\n\
+#define YY_MORE		(YY_LIKELY(yypos < yylimit) || yyrefill())\n\
+#define YY_GOTO(N)	(yyc= yycode + (N))\n\
+#define YY_IN(BITS, C)	((BITS)[(C) >> 3] & (1 << ((C) & 7)))\n\
+\n\
+YY_VARIABLE(int *    ) yystack= 0;\n\
+YY_VARIABLE(int      ) yystacklen= 0;\n\
+YY_VARIABLE(int      ) yystackpos= 0;\n\
+\n\
+YY_LOCAL(int) yyvm(int yyentry)\n\
+{\n\
+#ifdef YY_THREADED\n\
+  static const void *yyops[]= {\n\
+";
+
+static char *vm2= "\
+  };\n\
+#endif\n\
+  const yyword *yyc= yycode + yyentry;\n\
+  int		 yybase= yystackpos, yysp, yyfp, yyret, yyok;\n\
+  int		*yyst;\n\
+\n\
+  if (!yystacklen)\n\
+    {\n\
+      yystacklen= 1024;\n\
+      yystack= YY_MALLOC(sizeof(int) * yystacklen);\n\
+    }\n\
+  while (yybase + 3 > yystacklen)\n\
+    {\n\
+      yystacklen *= 2;\n\
+      yystack= YY_REALLOC(yystack, sizeof(int) * yystacklen);\n\
+    }\n\
+  yyst= yystack;\n\
+  yyst[yybase]= yyst[yybase + 1]= yyst[yybase + 2]= 0;\n\
+  yysp= yyfp= yybase + 3;	/* a frame with nowhere to return to */\n\
+#ifdef YY_THREADED\n\
+  YY_NEXT;\n\
+#else\n\
+ yynext:\n\
+  switch (*yyc)\n\
+    {\n\
+#endif\n\
+    YY_OP(ENTER):		/* rule slots */\n\
+      yyprintf((stderr, \"%s\\n\", yyrulenames[yyc[1]]));\n\
+      if (YY_UNLIKELY(yysp + 2 * yyc[2] + 3 > yystacklen))\n\
+	{\n\
+	  while (yysp + 2 * yyc[2] + 3 > yystacklen)\n\
+	    yystacklen *= 2;\n\
+	  yystack= yyst= YY_REALLOC(yystack, sizeof(int) * yystacklen);\n\
+	}\n\
+      yysp += 2 * yyc[2];\n\
+      yyc += 3;\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(RETURN):\n\
+      yyok= 1;\n\
+      yyret= yyst[yyfp - 3];\n\
+      goto yyreturn;\n\
+\n\
+    YY_OP(FAIL):\n\
+      yyok= 0;\n\
+      yyret= yyst[yyfp - 2];\n\
+    yyreturn:\n\
+      yysp= yyfp - 3;\n\
+      yyfp= yyst[yysp + 2];\n\
+      if (yysp == yybase)\n\
+	return yyok;\n\
+      YY_GOTO(yyret);\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(CALL):		/* address ko */\n\
+      yyst[yysp]= yyc + 3 - yycode;\n\
+      yyst[yysp + 1]= yyc[2];\n\
+      yyst[yysp + 2]= yyfp;\n\
+      yyfp= yysp += 3;\n\
+      YY_GOTO(yyc[1]);\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(JUMP):		/* address */\n\
+      YY_GOTO(yyc[1]);\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(SAVE):		/* slot */\n\
+      yyst[yyfp + 2 * yyc[1]]= yypos;\n\
+      yyst[yyfp + 2 * yyc[1] + 1]= yythunkpos;\n\
+      yyc += 2;\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(RESTORE):		/* slot */\n\
+      yypos= yyst[yyfp + 2 * yyc[1]];\n\
+      yythunkpos= yyst[yyfp + 2 * yyc[1] + 1];\n\
+      yyc += 2;\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(DOT):			/* ko */\n\
+      if (YY_MORE)\n\
+	{\n\
+	  ++yypos;\n\
+	  yyc += 2;\n\
+	}\n\
+      else\n\
+	YY_GOTO(yyc[1]);\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(CHAR):		/* character ko */\n\
+      if (YY_MORE && (unsigned char)yybuf[yypos] == yyc[1])\n\
+	{\n\
+	  ++yypos;\n\
+	  yyc += 3;\n\
+	}\n\
+      else\n\
+	YY_GOTO(yyc[2]);\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(STRING):		/* offset length ko */\n\
+      {\n\
+	const char *s= yyliterals + yyc[1];\n\
+	int	    n= yyc[2], yysav= yypos;\n\
+	while (n && YY_MORE && yybuf[yypos] == *s)\n\
+	  ++yypos, ++s, --n;\n\
+	if (n)\n\
+	  {\n\
+	    yypos= yysav;\n\
+	    YY_GOTO(yyc[3]);\n\
+	  }\n\
+	else\n\
+	  yyc += 4;\n\
+      }\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(CLASS):		/* class ko */\n\
+      if (YY_MORE && YY_IN(yyclasses[yyc[1]], (unsigned char)yybuf[yypos]))\n\
+	{\n\
+	  ++yypos;\n\
+	  yyc += 3;\n\
+	}\n\
+      else\n\
+	YY_GOTO(yyc[2]);\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(TEST):		/* class ko */\n\
+      if (YY_MORE && YY_IN(yyclasses[yyc[1]], (unsigned char)yybuf[yypos]))\n\
+	yyc += 3;\n\
+      else\n\
+	YY_GOTO(yyc[2]);\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(SPAN):		/* class: as many characters of it as there are */\n\
+      {\n\
+	const unsigned char *bits= yyclasses[yyc[1]];\n\
+	while (YY_MORE && YY_IN(bits, (unsigned char)yybuf[yypos]))\n\
+	  ++yypos;\n\
+	yyc += 2;\n\
+      }\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(SCAN):		/* offset length: characters up to the string */\n\
+      for (;;)\n\
+	{\n\
+	  const char *s= yyliterals + yyc[1];\n\
+	  int	      n= yyc[2], yysav= yypos;\n\
+	  while (n && YY_MORE && yybuf[yypos] == *s)\n\
+	    ++yypos, ++s, --n;\n\
+	  yypos= yysav;\n\
+	  if (!n || !YY_MORE)\n\
+	    break;\n\
+	  ++yypos;\n\
+	}\n\
+      yyc += 3;\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(ACTION):		/* action */\n\
+      yyDo(yyactions[yyc[1]], yybegin, yyend);\n\
+      yyc += 2;\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(PREDICATE):		/* predicate ko */\n\
+      yystackpos= yysp;		/* in case it parses something itself */\n\
+      yyText(yybegin, yyend);\n\
+      yyok= yypredicates[yyc[1]]();\n\
+      yystackpos= yybase;\n\
+      yyst= yystack;\n\
+      if (yyok)\n\
+	yyc += 3;\n\
+      else\n\
+	YY_GOTO(yyc[2]);\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(BEGIN):		/* ko */\n\
+      if (YY_BEGIN)\n\
+	yyc += 2;\n\
+      else\n\
+	YY_GOTO(yyc[1]);\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(END):			/* ko */\n\
+      if (YY_END)\n\
+	yyc += 2;\n\
+      else\n\
+	YY_GOTO(yyc[1]);\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(PUSH):		/* count */\n\
+      yyDo(yyPush, yyc[1], 0);\n\
+      yyc += 2;\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(POP):			/* count */\n\
+      yyDo(yyPop, yyc[1], 0);\n\
+      yyc += 2;\n\
+      YY_NEXT;\n\
+\n\
+    YY_OP(SET):			/* -offset */\n\
+      yyDo(yySet, -yyc[1], 0);\n\
+      yyc += 2;\n\
+      YY_NEXT;\n\
+#ifndef YY_THREADED\n\
+    }\n\
+  return 0;\n\
+#endif\n\
+}\n\
+\n\
+";
+
+void Rule_compile_bytecode(Node *node)
+{
+  Node	**byId= calloc(ruleCount + 1, sizeof(Node *));
+  int	 *ruleAt= calloc(ruleCount + 1, sizeof(int));
+  Node	 *n;
+  int	  i, largest= 255;
+
+  ruleLabels= calloc(ruleCount + 1, sizeof(int));
+  for (n= node;  n;  n= n->rule.next)
+    {
+      byId[n->rule.id]= n;
+      ruleLabels[n->rule.id]= newLabel();
+    }
+  for (n= node;  n;  n= n->rule.next)
+    if (!n->rule.expression)
+      fprintf(stderr, "rule '%s' used but not defined\n", n->rule.name);
+    else
+      {
+	if ((!(RuleUsed & n->rule.flags)) && (n != start))
+	  fprintf(stderr, "rule '%s' defined but not used\n", n->rule.name);
+	Rule_compile_bytecode2(n);
+      }
+
+  for (i= 0;  i < fixupCount;  ++i)
+    {
+      int label= code[fixups[i]];
+      if (labels[label] < 0)
+	{
+	  fprintf(stderr, "\ninternal error #2 (label %d)\n", label);
+	  exit(1);
+	}
+      code[fixups[i]]= labels[label];
+    }
+  for (i= 0;  i < codeLength;  ++i)
+    if (code[i] > largest)
+      largest= code[i];
+  for (i= 1;  i <= ruleCount;  ++i)
+    ruleAt[i]= byId[i] && byId[i]->rule.expression ? labels[ruleLabels[i]] : -1;
+
+  fprintf(output, "\ntypedef unsigned %s yyword;\n\n", largest < 65536 ? "short" : "int");
+  fprintf(output, "enum {");
+  for (i= 0;  i < opCount;  ++i)
+    fprintf(output, "%s yyop_%s", i ? "," : "", opNames[i]);
+  fprintf(output, " };\n\n");
+
+  fprintf(output, "#ifdef YY_DEBUG\nstatic const char *yyrulenames[]= {\n  0,\n");
+  for (i= 1;  i <= ruleCount;  ++i)
+    fprintf(output, "  \"%s\",\n", byId[i] ? byId[i]->rule.name : "");
+  fprintf(output, "};\n#endif\n\n");
+
+  for (i= 0;  i < predicateCount;  ++i)
+    fprintf(output, "YY_ACTION(int) yypredicate%d(void)\t{ return (%s); }\n", i, predicates[i]->predicate.text);
+  fprintf(output, "\nstatic int (*const yypredicates[])(void)= {");
+  for (i= 0;  i < predicateCount;  ++i)
+    fprintf(output, "%s yypredicate%d", i ? "," : "", i);
+  fprintf(output, "%s };\n\n", predicateCount ? "" : " 0");
+
+  fprintf(output, "static const yyaction yyactions[]= {\n");
+  for (n= actions;  n;  n= n->action.list)
+    fprintf(output, "  yy%s,\n", n->action.name);
+  fprintf(output, "  0\n};\n\n");
+
+  fprintf(output, "static const unsigned char yyclasses[][32]= {\n");
+  for (i= 0;  i < classCount;  ++i)
+    {
+      int c;
+      fprintf(output, "  \"");
+      for (c= 0;  c < 32;  ++c)
+	fprintf(output, "\\%03o", classes[i][c]);
+      fprintf(output, "\",\n");
+    }
+  fprintf(output, "  \"\"\n};\n\n");
+  printLiterals();
+  fprintf(output, "\n");
+  printCode(byId, ruleAt);
+
+  fprintf(output, "%s", vm1);
+  for (i= 0;  i < opCount;  ++i)
+    fprintf(output, "    &&yyl_%s,\n", opNames[i]);
+  fprintf(output, "%s", vm2);
+
+  for (i= 1;  i <= ruleCount;  ++i)
+    if (byId[i] && byId[i]->rule.expression)
+      fprintf(output, "YY_RULE(int) yy_%s()\t{ return yyvm(%d); }\n", byId[i]->rule.name, ruleAt[i]);
+
+  fprintf(stderr, "bytecode: %d words, %d classes, %d bytes of strings\n", codeLength, classCount, literalsLength);
+  free(byId);
+  free(ruleAt);
+}
@@ -0,0 +1,8 @@
+100 let n=100000
+120 let m=0
+110 let s=0
+130 let m=m+1
+140 let s=s+m
+150 if m<n then goto 130
+160 print "interpreted ", n*3, " lines of code; answer is ", s
+170 end
@@ -0,0 +1,8 @@
+#include <stdio.h>
+#include "test.peg.c"
+
+int main()
+{
+  while (yyparse());
+  return 0;
+}
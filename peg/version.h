@@ -0,0 +1,3 @@
+#define PEG_MAJOR	0
+#define PEG_MINOR	1
+#define PEG_LEVEL	2
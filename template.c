@@ -0,0 +1,129 @@
+/**********************************************************************
+
+  template.c - preambles and postambles, compiled once.
+
+  A template is text with [%key] placeholders, each of which is replaced
+  by the value of that metadata key in the document being converted, or
+  by nothing if the document has no such key.  Keys are matched the way
+  metadata keys are, ignoring case, spaces and punctuation.  A template
+  is compiled when it is created into runs of literal text and slots, so
+  emitting it is a series of copies; once set, it is used by every
+  conversion, in any thread, and never modified.
+
+  The preambles and postambles built in for each format have no slots:
+  they are static strings, appended with lengths known at compile time.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+ ***********************************************************************/
+
+/* append_literal - append a string literal or static array, without
+   measuring it or going through a format string */
+#define append_literal(out, s)  g_string_append_len(out, s, sizeof(s) - 1)
+
+typedef struct {
+    char *text;             /* literal text, or the key of a slot */
+    size_t length;          /* of the literal text */
+    bool slot;
+} template_part;
+
+struct markdown_template {
+    template_part *parts;
+    int count;
+    char *text;             /* the literal parts point into this copy */
+};
+
+typedef void (*template_value_printer)(GString *out, char *value);
+
+/* Header and footer used in place of each format's own, or NULL */
+static const markdown_template *header_template = NULL;
+static const markdown_template *footer_template = NULL;
+
+static void template_add(markdown_template *tmpl, char *text, size_t length, bool slot) {
+    template_part *part;
+
+    if (!slot && length == 0)
+        return;
+    tmpl->parts = g_realloc(tmpl->parts, (tmpl->count + 1) * sizeof(template_part));
+    part = &tmpl->parts[tmpl->count++];
+    part->text = text;
+    part->length = length;
+    part->slot = slot;
+}
+
+/* markdown_template_create - compile 'text' into literals and slots.  A
+   "[%" with no "]" after it on the same line is left as it is. */
+markdown_template * markdown_template_create(const char *text) {
+    markdown_template *tmpl = g_malloc(sizeof(markdown_template));
+    char *start, *open, *close;
+
+    tmpl->parts = NULL;
+    tmpl->count = 0;
+    tmpl->text = g_strdup(text);
+
+    start = open = tmpl->text;
+    while ((open = strstr(open, "[%")) != NULL) {
+        close = open + 2 + strcspn(open + 2, "]\n");
+        if (*close != ']') {
+            open += 2;
+            continue;
+        }
+        template_add(tmpl, start, open - start, false);
+        *close = '\0';
+        template_add(tmpl, label_from_string(open + 2, 0), 0, true);
+        start = open = close + 1;
+    }
+    template_add(tmpl, start, strlen(start), false);
+    return tmpl;
+}
+
+/* markdown_template_destroy - free a template.  It must not be in use. */
+void markdown_template_destroy(markdown_template *tmpl) {
+    int i;
+
+    if (tmpl == NULL)
+        return;
+    if (header_template == tmpl)
+        header_template = NULL;
+    if (footer_template == tmpl)
+        footer_template = NULL;
+    for (i = 0; i < tmpl->count; i++)
+        if (tmpl->parts[i].slot)
+            g_free(tmpl->parts[i].text);
+    g_free(tmpl->parts);
+    g_free(tmpl->text);
+    g_free(tmpl);
+}
+
+/* markdown_set_templates - use 'header' and 'footer' in place of the
+   preamble and postamble of every format; either can be NULL */
+void markdown_set_templates(const markdown_template *header, const markdown_template *footer) {
+    header_template = header;
+    footer_template = footer;
+}
+
+/* template_emit - append 'tmpl' to 'out', with the value of each slot's
+   key in the metadata of 'list' printed by 'print_value' */
+static void template_emit(GString *out, const markdown_template *tmpl, element *list, template_value_printer print_value) {
+    element *meta = list;
+    element *step;
+    int i;
+
+    while (meta != NULL && meta->key != METADATA)
+        meta = meta->next;
+
+    for (i = 0; i < tmpl->count; i++) {
+        if (!tmpl->parts[i].slot) {
+            g_string_append_len(out, tmpl->parts[i].text, tmpl->parts[i].length);
+            continue;
+        }
+        for (step = meta ? meta->children : NULL; step != NULL; step = step->next) {
+            if (strcmp(step->contents.str, tmpl->parts[i].text) == 0) {
+                print_value(out, step->children->contents.str);
+                break;
+            }
+        }
+    }
+}
@@ -21,29 +21,42 @@ static element * cons(element *new, element *list) {
     return new;
 }
 
-/* reverse - reverse a list, returning pointer to new list */
-static element *reverse(element *list) {
-    element *new = NULL;
-    element *next = NULL;
-    while (list != NULL) {
-        next = list->next;
-        new = cons(list, new);
-        list = next;
+/* Lists under construction.  Parser actions build lists in order, one
+ * element at a time, keeping only a pointer to the last element; while
+ * the list is being built, the last element's 'next' points back to the
+ * first.  NULL is the empty list.  add_last and add_first return the new
+ * list; close_list makes it an ordinary list and returns its head. */
+
+/* add_last - add element to end of list under construction */
+static element * add_last(element *new, element *list) {
+    assert(new != NULL);
+    if (list == NULL) {
+        new->next = new;
+    } else {
+        new->next = list->next;
+        list->next = new;
     }
     return new;
 }
 
-/* append_list - add element to end of list */
-static void append_list(element *new, element *list) {
+/* add_first - add element to start of list under construction */
+static element * add_first(element *new, element *list) {
     assert(new != NULL);
-    element *step = list;
-    
-    while (step->next != NULL) {
-        step = step->next;
-    }
-    
-    new->next = NULL;
-    step->next = new;
+    if (list == NULL)
+        return add_last(new, list);
+    new->next = list->next;
+    list->next = new;
+    return list;
+}
+
+/* close_list - end a list under construction, returning its head */
+static element * close_list(element *list) {
+    element *head;
+    if (list == NULL)
+        return NULL;
+    head = list->next;
+    list->next = NULL;
+    return head;
 }
 
 /* concat_string_list - concatenates string contents of list of STR elements.
@@ -69,13 +82,21 @@ static GString *concat_string_list(element *list) {
 
  ***********************************************************************/
 
-static char *charbuf = "";     /* Buffer of characters to be parsed. */
-static element *references = NULL;    /* List of link references found. */
-static element *notes = NULL;         /* List of footnotes found. */
-static element *parse_result;  /* Results of parse. */
-int syntax_extensions;  /* Syntax extensions selected. */
+static MD_THREAD_LOCAL char *charbuf = "";     /* Buffer of characters to be parsed. */
+static MD_THREAD_LOCAL char *charbuf_end = NULL;  /* End of charbuf, if before its NUL. */
+static MD_THREAD_LOCAL element *references = NULL;    /* List of link references found. */
+static MD_THREAD_LOCAL element *notes = NULL;         /* List of footnotes found. */
+static MD_THREAD_LOCAL element *parse_result;  /* Results of parse. */
+extern MD_THREAD_LOCAL int syntax_extensions;  /* Syntax extensions selected;
+                                                  defined in parsing_functions.c */
+
+static MD_THREAD_LOCAL element *labels = NULL;      /* List of labels found in document. */
 
-static element *labels = NULL;      /* List of labels found in document. */
+/* Position given to new elements: that of the parser action making them,
+   which leg reports as the start of the text it last captured, or, while
+   a raw block is re-parsed, the position of the block. */
+static MD_THREAD_LOCAL int element_pos = 0;
+static MD_THREAD_LOCAL int raw_block_pos = -1;
 
 /**********************************************************************
 
@@ -87,11 +108,12 @@ static element *labels = NULL;      /* List of labels found in document. */
 
 /* mk_element - generic constructor for element */
 static element * mk_element(int key) {
-    element *result = malloc(sizeof(element));
+    element *result = g_malloc(sizeof(element));
     result->key = key;
     result->children = NULL;
     result->next = NULL;
     result->contents.str = NULL;
+    result->pos = element_pos;
     return result;
 }
 
@@ -100,15 +122,43 @@ static element * mk_str(char *string) {
     element *result;
     assert(string != NULL);
     result = mk_element(STR);
-    result->contents.str = strdup(string);
+    result->contents.str = g_strdup(string);
+    return result;
+}
+
+/* Interned tokens - one-character strings the grammar makes over and over
+ * (a space for every run of spaces, a newline for every line end).  The
+ * elements mk_token makes point into this table rather than at copies;
+ * free_element_contents leaves such strings alone, and nothing may write
+ * to them. */
+static char token_table[] = " \0\n\0\001\0[\0]\0!\0<\0>\0L\0l\0C\0c\0R\0r";
+
+/* is_token - true if 'string' is an interned token */
+static bool is_token(const char *string) {
+    return string >= token_table && string < token_table + sizeof(token_table);
+}
+
+/* mk_token - constructor for STR element holding the character 'c',
+ * interned if it is in the table */
+static element * mk_token(char c) {
+    element *result;
+    char *token = memchr(token_table, c, sizeof(token_table) - 1);
+    char string[2];
+    if (c == '\0' || token == NULL) {
+        string[0] = c;
+        string[1] = '\0';
+        return mk_str(string);
+    }
+    result = mk_element(STR);
+    result->contents.str = token;
     return result;
 }
 
 /* mk_str_from_list - makes STR element by concatenating a
- * reversed list of strings, adding optional extra newline */
+ * list of strings under construction, adding optional extra newline */
 static element * mk_str_from_list(element *list, bool extra_newline) {
     element *result;
-    GString *c = concat_string_list(reverse(list));
+    GString *c = concat_string_list(close_list(list));
     if (extra_newline)
         g_string_append(c, "\n");
     result = mk_element(STR);
@@ -117,13 +167,12 @@ static element * mk_str_from_list(element *list, bool extra_newline) {
     return result;
 }
 
-/* mk_list - makes new list with key 'key' and children the reverse of 'lst'.
- * This is designed to be used with cons to build lists in a parser action.
- * The reversing is necessary because cons adds to the head of a list. */
+/* mk_list - makes new list with key 'key' and children 'lst', a list
+ * under construction built with add_last in a parser action. */
 static element * mk_list(int key, element *lst) {
     element *result;
     result = mk_element(key);
-    result->children = reverse(lst);
+    result->children = close_list(lst);
     return result;
 }
 
@@ -131,12 +180,12 @@ static element * mk_list(int key, element *lst) {
 static element * mk_link(element *label, char *url, char *title, element *attr, char *id) {
     element *result;
     result = mk_element(LINK);
-    result->contents.link = malloc(sizeof(link));
+    result->contents.link = g_malloc(sizeof(link));
     result->contents.link->label = label;
-    result->contents.link->url = strdup(url);
-    result->contents.link->title = strdup(title);
+    result->contents.link->url = g_strdup(url);
+    result->contents.link->title = g_strdup(title);
     result->contents.link->attr = attr;
-    result->contents.link->identifier = strdup(id);
+    result->contents.link->identifier = g_strdup(id);
     return result;
 }
 
@@ -188,7 +237,8 @@ static bool match_inlines(element *l1, element *l2) {
     return (l1 == NULL && l2 == NULL);  /* return true if both lists exhausted */
 }
 
-/* find_reference - return true if link found in references matching label.
+/* find_reference - return true if link found in references matching label,
+ * or failing that in the shared reference index.
  * 'link' is modified with the matching url and title. */
 static bool find_reference(link *result, element *label) {
     element *cur = references;  /* pointer to walk up list of references */
@@ -202,6 +252,10 @@ static bool find_reference(link *result, element *label) {
         else
             cur = cur->next;
     }
+    if ((curitem = lookup_shared_reference(label)) != NULL) {
+        *result = *curitem;
+        return true;
+    }
     return false;
 }
 
@@ -239,20 +293,30 @@ static bool find_note(element **result, char *label) {
 #define YY_INPUT(buf, result, max_size)              \
 {                                                    \
     int yyc;                                         \
-    if (charbuf && *charbuf != '\0') {               \
-        yyc= *charbuf++;                             \
+    if (charbuf && charbuf != charbuf_end && *charbuf != '\0') { \
+        yyc= (unsigned char) *charbuf++;             \
     } else {                                         \
         yyc= EOF;                                    \
     }                                                \
     result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);     \
 }
 
+/* The parser's own buffers come from the library allocator too */
+#define YY_MALLOC(n)        g_malloc(n)
+#define YY_REALLOC(p, n)    g_realloc(p, n)
+#define YY_FREE(p)          g_free(p)
+
+#define YY_ACTION_POS(pos)  (element_pos = raw_block_pos >= 0 ? raw_block_pos : (pos))
+
+/* Each thread gets its own parser state and buffers */
+#define YY_VARIABLE(T)      static MD_THREAD_LOCAL T
+
 
 /* peg-multimarkdown additions */
 
 /* print_raw_element - print an element as original text */
 static void print_raw_element(GString *out, element *elt) {
-    if (elt->key == LINK) {
+    if (elt->key == LINK || elt->key == IMAGE) {
         print_raw_element_list(out,elt->contents.link->label);
     } else {
         if (elt->contents.str != NULL) {
@@ -280,8 +344,8 @@ static char *label_from_element_list(element *list, bool obfuscate) {
     GString *raw = g_string_new("");
     print_raw_element_list(raw, list);
     label =  label_from_string(raw->str,obfuscate);
-    label2 = strdup(label);
-    free(label);
+    label2 = g_strdup(label);
+    g_free(label);
     g_string_free(raw,true);
     return label2;
 }
@@ -328,7 +392,7 @@ static bool find_label(link *result, element *label) {
     print_raw_element_list(text, label);
     lab = label_from_string(text->str,0);
     GString *query = g_string_new(lab);
-    free(lab);
+    g_free(lab);
     g_string_free(text, true);
 
     while (cur != NULL) {